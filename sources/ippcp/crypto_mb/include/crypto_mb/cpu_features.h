@@ -93,10 +93,14 @@ enum MBX_ALGO {
    MBX_ALGO_CTR_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_OFB_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_OFB128_SM4 = MBX_ALGO_SM4,
+   MBX_ALGO_EC_SECP256K1,
+   MBX_ALGO_ECDSA_SECP256K1   = MBX_ALGO_EC_SECP256K1,
+   MBX_ALGO_SCHNORR_SECP256K1 = MBX_ALGO_EC_SECP256K1,
 };
 
 /* multi-buffer width implemented by library */
 enum MBX_WIDTH {
+    MBX_WIDTH_MB4  = 4,   /* AVX2 kernels: the mb8 API processes the batch as two halves */
     MBX_WIDTH_MB8  = 8,
     MBX_WIDTH_MB16 = 16,
     MBX_WIDTH_ANY  = (1 << 16) - 1
@@ -106,6 +110,9 @@ typedef int64u MBX_ALGO_INFO;
 
 /* check if algorithm is supported on current platform
  * returns: multi-buffer width mask or 0 if algorithm not supported
+ *
+ * Platforms without AVX512-IFMA (mbx_is_crypto_mb_applicable() returns 0), but with AVX2,
+ * report MBX_WIDTH_MB4 for X25519, NIST P-256 and RSA 1K-4K, served by the same mb8 entry points.
 */
 EXTERN_C MBX_ALGO_INFO mbx_get_algo_info(enum MBX_ALGO algo);
 
@@ -55,6 +55,9 @@ typedef unsigned long long int64u;
 #endif
 
 
+/* random number generator: fills pRand[nBytes] with random bytes, returns 0 on success */
+typedef int (*mbx_rand_func)(int8u* pRand, int nBytes, void* pRndParam);
+
 /* externals */
 #undef EXTERN_C
 
@@ -55,6 +55,55 @@ EXTERN_C mbx_status mbx_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
                                                   int64u* pa_pubz[8],
                                             const int64u* const pa_skey[8],
                                                    int8u* pBuffer);
+
+/*
+// Decodes public keys represented as SEC1 octet strings
+// pa_pubx[]      array of pointers to the public keys X-coordinates
+// pa_puby[]      array of pointers to the public keys Y-coordinates
+// pa_oct[]       array of pointers to the encoded points (02||x, 03||x or 04||x||y)
+// pa_oct_len[]   array of the encoded points lengths
+// pBuffer        pointer to the scratch buffer
+//
+// Note:
+// compressed points are decompressed, all points are checked to belong to EC;
+// output public key is represented by (x:y) affine coordinates
+// (pass pa_pubz[]==NULL to the ECDH and ECDSA verification APIs)
+*/
+#ifndef BN_OPENSSL_DISABLE
+EXTERN_C mbx_status mbx_nistp256_ec_decode_point_ssl_mb8(BIGNUM* pa_pubx[8],
+                                                        BIGNUM* pa_puby[8],
+                                                  const int8u* const pa_oct[8],
+                                                  const int pa_oct_len[8],
+                                                        int8u* pBuffer);
+#endif // BN_OPENSSL_DISABLE
+
+EXTERN_C mbx_status mbx_nistp256_ec_decode_point_mb8(int64u* pa_pubx[8],
+                                                    int64u* pa_puby[8],
+                                              const int8u* const pa_oct[8],
+                                              const int pa_oct_len[8],
+                                                    int8u* pBuffer);
+
+/*
+// Generates key pairs
+// pa_skey[]   array of pointers to the private keys
+// pa_pubx[]   array of pointers to the public keys X-coordinates
+// pa_puby[]   array of pointers to the public keys Y-coordinates
+// pa_pubz[]   array of pointers to the public keys Z-coordinates (or NULL, if affine coordinate requested)
+// rndFunc     random generator (or NULL, if RDRAND based generator requested)
+// pRndParam   random generator parameter
+// pBuffer     pointer to the scratch buffer
+//
+// Note:
+// private keys 0 < d < n are drawn by rejection sampling and public keys Q = [d]G are checked to belong to EC;
+// lanes failed because of random generator failure return MBX_STATUS_MISMATCH_PARAM_ERR
+*/
+EXTERN_C mbx_status mbx_nistp256_keygen_mb8(int64u* pa_skey[8],
+                                           int64u* pa_pubx[8],
+                                           int64u* pa_puby[8],
+                                           int64u* pa_pubz[8],
+                                     mbx_rand_func rndFunc,
+                                             void* pRndParam,
+                                            int8u* pBuffer);
 /*
 // Computes shared key
 // pa_shared_key[]   array of pointers to the shared keys
@@ -151,6 +200,39 @@ EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8
                                                  const int64u* const pa_puby[8],
                                                  const int64u* const pa_pubz[8],
                                                         int8u* pBuffer);
+
+/*
+// Returns size (in bytes) of the pre-computed table of a public key
+*/
+EXTERN_C int mbx_nistp256_ecdsa_verify_TableSize(void);
+
+/*
+// Pre-computes tables of the public keys for repeated ECDSA signature verification
+// pa_table[]        array of pointers to the tables (of mbx_nistp256_ecdsa_verify_TableSize() bytes each)
+// pa_pubx[]         array of pointers to the signer's public keys X-coordinates
+// pa_puby[]         array of pointers to the signer's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the signer's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+*/
+EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_precomp_mb8(int8u* pa_table[8],
+                                                   const int64u* const pa_pubx[8],
+                                                   const int64u* const pa_puby[8],
+                                                   const int64u* const pa_pubz[8],
+                                                          int8u* pBuffer);
+
+/*
+// Verifies ECDSA signature using the pre-computed tables of the public keys
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages that have been signed
+// pa_table[]        array of pointers to the tables computed by mbx_nistp256_ecdsa_verify_precomp_mb8()
+// pBuffer           pointer to the scratch buffer
+*/
+EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_tbl_mb8(const int8u* const pa_sign_r[8],
+                                                      const int8u* const pa_sign_s[8],
+                                                      const int8u* const pa_msg[8],
+                                                      const int8u* const pa_table[8],
+                                                            int8u* pBuffer);
 /*
 // OpenSSL's specific similar APIs
 */
@@ -182,5 +264,16 @@ EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_
                                                       const BIGNUM* const pa_pubz[8],
                                                      int8u* pBuffer);
 
+EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_precomp_ssl_mb8(int8u* pa_table[8],
+                                                       const BIGNUM* const pa_pubx[8],
+                                                       const BIGNUM* const pa_puby[8],
+                                                       const BIGNUM* const pa_pubz[8],
+                                                              int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_nistp256_ecdsa_verify_tbl_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
+                                                          const int8u* const pa_msg[8],
+                                                          const int8u* const pa_table[8],
+                                                                int8u* pBuffer);
+
 #endif // BN_OPENSSL_DISABLE
 #endif /* EC_NISTP256_H */
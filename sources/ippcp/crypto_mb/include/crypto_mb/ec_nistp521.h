@@ -55,6 +55,87 @@ EXTERN_C mbx_status mbx_nistp521_ecpublic_key_mb8(int64u* pa_pubx[8],
                                                   int64u* pa_pubz[8],
                                             const int64u* const pa_skey[8],
                                                    int8u* pBuffer);
+
+/*
+// Window 7 comb table of the base point
+//
+// The table (mbx_nistp521_base_TableSize() bytes) is computed once by mbx_nistp521_base_precomp()
+// and then is passed into the *_tbl_* functions below. It replaces the built-in window 4 table
+// and speeds up the base point multiplication at the cost of memory. The table contains
+// public data only and can be shared between the threads.
+*/
+EXTERN_C int mbx_nistp521_base_TableSize(void);
+EXTERN_C mbx_status mbx_nistp521_base_precomp(int8u* pTable);
+
+/*
+// Computes public key using the comb table of the base point
+// pTable      pointer to the table computed by mbx_nistp521_base_precomp() (or NULL, if the built-in table requested)
+// other parameters are the same as of mbx_nistp521_ecpublic_key_mb8()
+*/
+#ifndef BN_OPENSSL_DISABLE
+EXTERN_C mbx_status mbx_nistp521_ecpublic_key_tbl_ssl_mb8(BIGNUM* pa_pubx[8],
+                                                          BIGNUM* pa_puby[8],
+                                                          BIGNUM* pa_pubz[8],
+                                                    const BIGNUM* const pa_skey[8],
+                                                     const int8u* pTable,
+                                                           int8u* pBuffer);
+#endif // BN_OPENSSL_DISABLE
+
+EXTERN_C mbx_status mbx_nistp521_ecpublic_key_tbl_mb8(int64u* pa_pubx[8],
+                                                      int64u* pa_puby[8],
+                                                      int64u* pa_pubz[8],
+                                                const int64u* const pa_skey[8],
+                                                 const int8u* pTable,
+                                                       int8u* pBuffer);
+
+/*
+// Decodes public keys represented as SEC1 octet strings
+// pa_pubx[]      array of pointers to the public keys X-coordinates
+// pa_puby[]      array of pointers to the public keys Y-coordinates
+// pa_oct[]       array of pointers to the encoded points (02||x, 03||x or 04||x||y)
+// pa_oct_len[]   array of the encoded points lengths
+// pBuffer        pointer to the scratch buffer
+//
+// Note:
+// compressed points are decompressed, all points are checked to belong to EC;
+// output public key is represented by (x:y) affine coordinates
+// (pass pa_pubz[]==NULL to the ECDH and ECDSA verification APIs)
+*/
+#ifndef BN_OPENSSL_DISABLE
+EXTERN_C mbx_status mbx_nistp521_ec_decode_point_ssl_mb8(BIGNUM* pa_pubx[8],
+                                                        BIGNUM* pa_puby[8],
+                                                  const int8u* const pa_oct[8],
+                                                  const int pa_oct_len[8],
+                                                        int8u* pBuffer);
+#endif // BN_OPENSSL_DISABLE
+
+EXTERN_C mbx_status mbx_nistp521_ec_decode_point_mb8(int64u* pa_pubx[8],
+                                                    int64u* pa_puby[8],
+                                              const int8u* const pa_oct[8],
+                                              const int pa_oct_len[8],
+                                                    int8u* pBuffer);
+
+/*
+// Generates key pairs
+// pa_skey[]   array of pointers to the private keys
+// pa_pubx[]   array of pointers to the public keys X-coordinates
+// pa_puby[]   array of pointers to the public keys Y-coordinates
+// pa_pubz[]   array of pointers to the public keys Z-coordinates (or NULL, if affine coordinate requested)
+// rndFunc     random generator (or NULL, if RDRAND based generator requested)
+// pRndParam   random generator parameter
+// pBuffer     pointer to the scratch buffer
+//
+// Note:
+// private keys 0 < d < n are drawn by rejection sampling and public keys Q = [d]G are checked to belong to EC;
+// lanes failed because of random generator failure return MBX_STATUS_MISMATCH_PARAM_ERR
+*/
+EXTERN_C mbx_status mbx_nistp521_keygen_mb8(int64u* pa_skey[8],
+                                           int64u* pa_pubx[8],
+                                           int64u* pa_puby[8],
+                                           int64u* pa_pubz[8],
+                                     mbx_rand_func rndFunc,
+                                             void* pRndParam,
+                                            int8u* pBuffer);
 /*
 // Computes shared key
 // pa_shared_key[]   array of pointers to the shared keys
@@ -100,6 +181,18 @@ EXTERN_C mbx_status mbx_nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8]
                                                       int64u* pa_sign_rp[8],
                                                 const int64u* const pa_eph_skey[8],
                                                        int8u* pBuffer);
+
+/*
+// Pre-computes ECDSA signature using the comb table of the base point
+// pTable            pointer to the table computed by mbx_nistp521_base_precomp() (or NULL, if the built-in table requested)
+// other parameters are the same as of mbx_nistp521_ecdsa_sign_setup_mb8()
+*/
+EXTERN_C mbx_status mbx_nistp521_ecdsa_sign_setup_tbl_mb8(int64u* pa_inv_eph_skey[8],
+                                                          int64u* pa_sign_rp[8],
+                                                    const int64u* const pa_eph_skey[8],
+                                                     const int8u* pTable,
+                                                           int8u* pBuffer);
+
 /*
 // computes ECDSA signature
 //
@@ -160,6 +253,12 @@ EXTERN_C mbx_status mbx_nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_eph_ske
                                                     const BIGNUM* const pa_eph_skey[8],
                                                            int8u* pBuffer);
 
+EXTERN_C mbx_status mbx_nistp521_ecdsa_sign_setup_tbl_ssl_mb8(BIGNUM* pa_inv_eph_skey[8],
+                                                              BIGNUM* pa_sign_pr[8],
+                                                        const BIGNUM* const pa_eph_skey[8],
+                                                         const int8u* pTable,
+                                                               int8u* pBuffer);
+
 EXTERN_C mbx_status mbx_nistp521_ecdsa_sign_complete_ssl_mb8(int8u* pa_sign_r[8],
                                                              int8u* pa_sign_s[8],
                                                        const int8u* const pa_msg[8],
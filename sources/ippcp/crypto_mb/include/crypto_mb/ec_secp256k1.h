@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef EC_SECP256K1_H
+#define EC_SECP256K1_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+#ifndef BN_OPENSSL_DISABLE
+      #include <openssl/bn.h>
+      #include <openssl/ec.h>
+#endif // BN_OPENSSL_DISABLE
+
+/*
+// ECDSA
+*/
+
+/*
+// Verifies ECDSA signature
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages that have been signed
+// pa_pubx[]         array of pointers to the signer's public keys X-coordinates
+// pa_puby[]         array of pointers to the signer's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the signer's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+*/
+EXTERN_C mbx_status mbx_secp256k1_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                                   const int8u* const pa_sign_s[8],
+                                                   const int8u* const pa_msg[8],
+                                                  const int64u* const pa_pubx[8],
+                                                  const int64u* const pa_puby[8],
+                                                  const int64u* const pa_pubz[8],
+                                                         int8u* pBuffer);
+
+/*
+// Schnorr signatures (BIP-340)
+*/
+
+/*
+// Verifies BIP-340 Schnorr signature
+// pa_sign_r[]       array of pointers to the r-components of the signatures (32 bytes, big endian)
+// pa_sign_s[]       array of pointers to the s-components of the signatures (32 bytes, big endian)
+// pa_msg[]          array of pointers to the messages that have been signed
+// msg_len[]         array of messages length
+// pa_pubx[]         array of pointers to the signer's x-only public keys (32 bytes, big endian)
+// pBuffer           pointer to the scratch buffer
+*/
+EXTERN_C mbx_status mbx_secp256k1_schnorr_verify_mb8(const int8u* const pa_sign_r[8],
+                                                     const int8u* const pa_sign_s[8],
+                                                     const int8u* const pa_msg[8],
+                                                              const int msg_len[8],
+                                                     const int8u* const pa_pubx[8],
+                                                           int8u* pBuffer);
+
+/*
+// OpenSSL's specific similar APIs
+*/
+#ifndef BN_OPENSSL_DISABLE
+EXTERN_C mbx_status mbx_secp256k1_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
+                                                       const int8u* const pa_msg[8],
+                                                       const BIGNUM* const pa_pubx[8],
+                                                       const BIGNUM* const pa_puby[8],
+                                                       const BIGNUM* const pa_pubz[8],
+                                                      int8u* pBuffer);
+#endif // BN_OPENSSL_DISABLE
+
+#endif /* EC_SECP256K1_H */
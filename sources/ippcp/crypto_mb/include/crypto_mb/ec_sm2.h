@@ -25,6 +25,9 @@
       #include <openssl/ec.h>
 #endif // BN_OPENSSL_DISABLE
 
+/* SM2 ciphertext C1 || C3 || C2 is longer than the message by |C1| + |C3| = (1+32+32) + 32 bytes */
+#define SM2_PKE_OVERHEAD   (97)
+
 /*
 // Computes public key
 // pa_pubx[]   array of pointers to the public keys X-coordinates
@@ -110,6 +113,109 @@ EXTERN_C mbx_status mbx_sm2_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
                                             const int64u* const pa_pubz[8],
                                                          int8u* pBuffer);
 
+/*
+// Encrypts messages by SM2 public key encryption scheme
+// pa_cipher[]       array of pointers to the ciphertexts C1 || C3 || C2 (msg_len[i] + SM2_PKE_OVERHEAD bytes each)
+// pa_msg[]          array of pointers to the messages are being encrypted
+// msg_len[]         array of messages length
+// pa_eph_skey[]     array of pointers to the ephemeral private keys
+// pa_pubx[]         array of pointers to the party's public keys X-coordinates
+// pa_puby[]         array of pointers to the party's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the party's public keys Z-coordinates (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// C1 is stored in uncompressed form (04 || x1 || y1).
+*/
+EXTERN_C mbx_status mbx_sm2_encrypt_mb8(int8u* pa_cipher[8],
+                            const int8u* const pa_msg[8],
+                                     const int msg_len[8],
+                           const int64u* const pa_eph_skey[8],
+                           const int64u* const pa_pubx[8],
+                           const int64u* const pa_puby[8],
+                           const int64u* const pa_pubz[8],
+                                        int8u* pBuffer);
+
+/*
+// Decrypts ciphertexts by SM2 public key encryption scheme
+// pa_msg[]          array of pointers to the decrypted messages (cipher_len[i] - SM2_PKE_OVERHEAD bytes each)
+// pa_cipher[]       array of pointers to the ciphertexts C1 || C3 || C2
+// cipher_len[]      array of ciphertexts length
+// pa_skey[]         array of pointers to the own private keys
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// only uncompressed C1 is supported. If the C3 check fails the message is zeroed
+// and MBX_STATUS_MISMATCH_PARAM_ERR is set for the buffer.
+*/
+EXTERN_C mbx_status mbx_sm2_decrypt_mb8(int8u* pa_msg[8],
+                            const int8u* const pa_cipher[8],
+                                     const int cipher_len[8],
+                           const int64u* const pa_skey[8],
+                                        int8u* pBuffer);
+
+/*
+// Computes user's identification digests Z = SM3(ENTL || ID || a || b || xG || yG || xA || yA)
+// pa_z_digest[]     array of pointers to the Z digests (32 bytes each)
+// pa_user_id[]      array of pointers to the users ID
+// user_id_len[]     array of users ID length
+// pa_pubx[]         array of pointers to the users public keys X-coordinates
+// pa_puby[]         array of pointers to the users public keys Y-coordinates
+// pBuffer           pointer to the scratch buffer
+*/
+EXTERN_C mbx_status mbx_sm2_user_id_digest_mb8(int8u* pa_z_digest[8],
+                                   const int8u* const pa_user_id[8],
+                                            const int user_id_len[8],
+                                  const int64u* const pa_pubx[8],
+                                  const int64u* const pa_puby[8],
+                                               int8u* pBuffer);
+
+/* role of the party in the SM2 key exchange */
+enum MBX_SM2_KE_ROLE {
+   MBX_SM2_KE_REQUESTER,   /* A, initiator */
+   MBX_SM2_KE_RESPONDER    /* B */
+};
+
+/*
+// Computes shared keys by SM2 key exchange protocol
+// pa_shared_key[]   array of pointers to the shared keys
+// shared_key_len[]  array of shared keys length
+// pa_conf_self[]    array of pointers to the own key confirmation values, 32 bytes each (or NULL, if not requested)
+// pa_conf_peer[]    array of pointers to the expected party's key confirmation values, 32 bytes each (or NULL, if not requested)
+// pa_z_self[]       array of pointers to the own Z digests
+// pa_z_peer[]       array of pointers to the party's Z digests
+// pa_skey[]         array of pointers to the own private keys
+// pa_eph_skey[]     array of pointers to the own ephemeral private keys
+// pa_pubx[]         array of pointers to the party's public keys X-coordinates
+// pa_puby[]         array of pointers to the party's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the party's public keys Z-coordinates (or NULL, if affine coordinate requested)
+// pa_eph_pubx[]     array of pointers to the party's ephemeral public keys X-coordinates
+// pa_eph_puby[]     array of pointers to the party's ephemeral public keys Y-coordinates
+// pa_eph_pubz[]     array of pointers to the party's ephemeral public keys Z-coordinates (or NULL, if affine coordinate requested)
+// role              own role in the protocol
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// Key confirmation values are S2 (SA) for the requester and S1 (SB) for the responder.
+// The own ephemeral public key is recomputed from pa_eph_skey.
+*/
+EXTERN_C mbx_status mbx_sm2_key_exchange_mb8(int8u* pa_shared_key[8],
+                                         const int shared_key_len[8],
+                                            int8u* pa_conf_self[8],
+                                            int8u* pa_conf_peer[8],
+                                const int8u* const pa_z_self[8],
+                                const int8u* const pa_z_peer[8],
+                               const int64u* const pa_skey[8],
+                               const int64u* const pa_eph_skey[8],
+                               const int64u* const pa_pubx[8],
+                               const int64u* const pa_puby[8],
+                               const int64u* const pa_pubz[8],
+                               const int64u* const pa_eph_pubx[8],
+                               const int64u* const pa_eph_puby[8],
+                               const int64u* const pa_eph_pubz[8],
+                              enum MBX_SM2_KE_ROLE role,
+                                            int8u* pBuffer);
+
 /*
 // OpenSSL's specific similar APIs
 */
@@ -149,5 +255,44 @@ EXTERN_C mbx_status mbx_sm2_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_sig[8
                                                     const BIGNUM* const pa_puby[8],
                                                     const BIGNUM* const pa_pubz[8],
                                                                  int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_sm2_encrypt_ssl_mb8(int8u* pa_cipher[8],
+                                const int8u* const pa_msg[8],
+                                         const int msg_len[8],
+                               const BIGNUM* const pa_eph_skey[8],
+                               const BIGNUM* const pa_pubx[8],
+                               const BIGNUM* const pa_puby[8],
+                               const BIGNUM* const pa_pubz[8],
+                                            int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_sm2_decrypt_ssl_mb8(int8u* pa_msg[8],
+                                const int8u* const pa_cipher[8],
+                                         const int cipher_len[8],
+                               const BIGNUM* const pa_skey[8],
+                                            int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_sm2_user_id_digest_ssl_mb8(int8u* pa_z_digest[8],
+                                       const int8u* const pa_user_id[8],
+                                                const int user_id_len[8],
+                                      const BIGNUM* const pa_pubx[8],
+                                      const BIGNUM* const pa_puby[8],
+                                                   int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_sm2_key_exchange_ssl_mb8(int8u* pa_shared_key[8],
+                                             const int shared_key_len[8],
+                                                int8u* pa_conf_self[8],
+                                                int8u* pa_conf_peer[8],
+                                    const int8u* const pa_z_self[8],
+                                    const int8u* const pa_z_peer[8],
+                                   const BIGNUM* const pa_skey[8],
+                                   const BIGNUM* const pa_eph_skey[8],
+                                   const BIGNUM* const pa_pubx[8],
+                                   const BIGNUM* const pa_puby[8],
+                                   const BIGNUM* const pa_pubz[8],
+                                   const BIGNUM* const pa_eph_pubx[8],
+                                   const BIGNUM* const pa_eph_puby[8],
+                                   const BIGNUM* const pa_eph_pubz[8],
+                                  enum MBX_SM2_KE_ROLE role,
+                                                int8u* pBuffer);
 #endif // BN_OPENSSL_DISABLE
 #endif /* EC_SM2_H */
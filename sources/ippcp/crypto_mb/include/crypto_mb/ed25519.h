@@ -19,6 +19,7 @@
 
 #include <crypto_mb/defs.h>
 #include <crypto_mb/status.h>
+#include <crypto_mb/sha512.h>
 
 typedef int8u ed25519_sign_component[32];
 typedef ed25519_sign_component ed25519_sign[2];
@@ -62,4 +63,125 @@ EXTERN_C mbx_status mbx_ed25519_verify_mb8(const ed25519_sign_component* const p
                                            const int8u* const pa_msg[8], const int32u msgLen[8],
                                            const ed25519_public_key* const pa_public_key[8]);
 
+/*
+// Computes Ed25519ctx signature (RFC 8032, 5.1)
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages are being signed
+// msgLen[]          lengths of the messages are being signed
+// pa_context[]      array of pointers to the contexts
+// contextLen[]      array of contexts lengths (1..255 bytes)
+// pa_private_key[]  array of pointers to the signer's private keys
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+EXTERN_C mbx_status mbx_ed25519ctx_sign_mb8(ed25519_sign_component* pa_sign_r[8],
+                                            ed25519_sign_component* pa_sign_s[8],
+                                            const int8u* const pa_msg[8], const int32u msgLen[8],
+                                            const int8u* const pa_context[8], const int32u contextLen[8],
+                                            const ed25519_private_key* const pa_private_key[8],
+                                            const ed25519_public_key* const pa_public_key[8]);
+
+/*
+// Verifies Ed25519ctx signature
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_msg[]          array of pointers to the signed messages
+// msgLen[]          array of signed messages lengths
+// pa_context[]      array of pointers to the contexts
+// contextLen[]      array of contexts lengths (1..255 bytes)
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+EXTERN_C mbx_status mbx_ed25519ctx_verify_mb8(const ed25519_sign_component* const pa_sign_r[8],
+                                              const ed25519_sign_component* const pa_sign_s[8],
+                                              const int8u* const pa_msg[8], const int32u msgLen[8],
+                                              const int8u* const pa_context[8], const int32u contextLen[8],
+                                              const ed25519_public_key* const pa_public_key[8]);
+
+/*
+// Computes Ed25519ph signature (RFC 8032, 5.1)
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg_digest[]   array of pointers to the SHA512 digests (SHA512_DIGEST_SIZE bytes) of the messages
+// pa_context[]      array of pointers to the contexts (empty contexts if NULL)
+// contextLen[]      array of contexts lengths (0..255 bytes)
+// pa_private_key[]  array of pointers to the signer's private keys
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+EXTERN_C mbx_status mbx_ed25519ph_sign_mb8(ed25519_sign_component* pa_sign_r[8],
+                                           ed25519_sign_component* pa_sign_s[8],
+                                           const int8u* const pa_msg_digest[8],
+                                           const int8u* const pa_context[8], const int32u contextLen[8],
+                                           const ed25519_private_key* const pa_private_key[8],
+                                           const ed25519_public_key* const pa_public_key[8]);
+
+/*
+// Verifies Ed25519ph signature
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_msg_digest[]   array of pointers to the SHA512 digests (SHA512_DIGEST_SIZE bytes) of the signed messages
+// pa_context[]      array of pointers to the contexts (empty contexts if NULL)
+// contextLen[]      array of contexts lengths (0..255 bytes)
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+EXTERN_C mbx_status mbx_ed25519ph_verify_mb8(const ed25519_sign_component* const pa_sign_r[8],
+                                             const ed25519_sign_component* const pa_sign_s[8],
+                                             const int8u* const pa_msg_digest[8],
+                                             const int8u* const pa_context[8], const int32u contextLen[8],
+                                             const ed25519_public_key* const pa_public_key[8]);
+
+/*
+// Streaming Ed25519ph
+//
+// The messages are passed in pieces of any size into the SHA512 state by
+//    mbx_sha512_init_mb8(p_state);
+//    mbx_sha512_update_mb8(pa_msg_part, len, p_state); ...
+// and then signed (verified) in one pass without keeping the whole messages in memory.
+// The functions below finalize the digests of all 8 lanes and reset p_state.
+*/
+EXTERN_C mbx_status mbx_ed25519ph_sign_final_mb8(ed25519_sign_component* pa_sign_r[8],
+                                                 ed25519_sign_component* pa_sign_s[8],
+                                                 SHA512_CTX_mb8* p_state,
+                                                 const int8u* const pa_context[8], const int32u contextLen[8],
+                                                 const ed25519_private_key* const pa_private_key[8],
+                                                 const ed25519_public_key* const pa_public_key[8]);
+
+EXTERN_C mbx_status mbx_ed25519ph_verify_final_mb8(const ed25519_sign_component* const pa_sign_r[8],
+                                                   const ed25519_sign_component* const pa_sign_s[8],
+                                                   SHA512_CTX_mb8* p_state,
+                                                   const int8u* const pa_context[8], const int32u contextLen[8],
+                                                   const ed25519_public_key* const pa_public_key[8]);
+
+/*
+// Returns size of the scratch buffer of mbx_ed25519_batch_verify()
+// num               number of the verified signatures
+*/
+EXTERN_C int mbx_ed25519_batch_verify_BufferSize(int num);
+
+/*
+// Verifies batch of ed25519 signatures
+// pa_status[]       array of (num+7)/8 statuses of the verified signatures (status of the n-th signature
+//                   is MBX_GET_STS(pa_status[n/8], n%8)), could be NULL if statuses are not required
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_msg[]          array of pointers to the signed messages
+// msgLen[]          array of signed messages lengths
+// pa_public_key[]   array of pointers to the signer's public keys
+// num               number of the verified signatures
+// rndFunc           random generator (RDRAND is used if NULL)
+// pRndParam         random generator parameters
+// pBuffer           scratch buffer of mbx_ed25519_batch_verify_BufferSize(num) bytes (allocated if NULL)
+//
+// Returns MBX_STATUS_OK if all the signatures are valid.
+// Note: the batch equation is cofactored, signatures which differ from valid ones
+// by small order components could be accepted.
+*/
+EXTERN_C mbx_status mbx_ed25519_batch_verify(mbx_status pa_status[],
+                                             const ed25519_sign_component* const pa_sign_r[],
+                                             const ed25519_sign_component* const pa_sign_s[],
+                                             const int8u* const pa_msg[], const int32u msgLen[],
+                                             const ed25519_public_key* const pa_public_key[],
+                                             int num,
+                                             mbx_rand_func rndFunc, void* pRndParam,
+                                             int8u* pBuffer);
+
 #endif /* ED25519_H */
@@ -55,4 +55,33 @@ EXTERN_C mbx_status mbx_exp_mb8(int64u* const out_pa[8],
                          const int64u* const mod_pa[8], int mod_bits,
                                int8u* pBuffer, int bufferLen);
 
+/* variable-time sliding window exp operation (public exponents only) */
+EXTERN_C mbx_status mbx_exp_pub_mb8(int64u* const out_pa[8],
+                             const int64u* const base_pa[8],
+                             const int64u* const exp_pa[8], int exp_bits,
+                             const int64u* const mod_pa[8], int mod_bits,
+                                   int8u* pBuffer, int bufferLen);
+
+/*
+// fixed-base exp operation:
+//    pre-computed table of the bases is built once per (base, modulus) and
+//    re-used by any number of exponentiations with exponents up to exp_bits.
+//    The table stores the offset of its 64-byte aligned part from pTable:
+//    it may be copied only to the address of the same alignment (modulo 64),
+//    otherwise mbx_exp_fixed_base_mb8() returns MBX_STATUS_MISMATCH_PARAM_ERR
+//    for all lanes.
+*/
+EXTERN_C int mbx_exp_fixed_base_TableSize(int modulusBits, int exp_bits);
+
+EXTERN_C mbx_status mbx_exp_fixed_base_precomp_mb8(int8u* pTable, int tableLen,
+                                            const int64u* const base_pa[8],
+                                            const int64u* const mod_pa[8], int mod_bits,
+                                                  int exp_bits,
+                                                  int8u* pBuffer, int bufferLen);
+
+EXTERN_C mbx_status mbx_exp_fixed_base_mb8(int64u* const out_pa[8],
+                                    const int64u* const exp_pa[8], int exp_bits,
+                                    const int8u* pTable,
+                                          int8u* pBuffer, int bufferLen);
+
 #endif /* EXP_H */
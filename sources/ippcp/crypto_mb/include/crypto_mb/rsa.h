@@ -56,6 +56,7 @@ EXTERN_C const mbx_RSA_Method* mbx_RSA1K_pub65537_Method(void);
 EXTERN_C const mbx_RSA_Method* mbx_RSA2K_pub65537_Method(void);
 EXTERN_C const mbx_RSA_Method* mbx_RSA3K_pub65537_Method(void);
 EXTERN_C const mbx_RSA_Method* mbx_RSA4K_pub65537_Method(void);
+EXTERN_C const mbx_RSA_Method* mbx_RSA8K_pub65537_Method(void);
 EXTERN_C const mbx_RSA_Method* mbx_RSA_pub65537_Method(int rsaBitsize);
 
 /* rsa private key opertaion */
@@ -82,6 +83,23 @@ EXTERN_C mbx_status mbx_rsa_public_mb8(const int8u* const from_pa[8],
                               const mbx_RSA_Method* m,
                                              int8u* pBuffer);
 
+/*
+// rsa public key operation with short public exponent
+//
+// e[] holds public exponent of each lane (odd, e>=3, e.g. 3, 17, 65537).
+// rsaBitlen is 1024, 2048, 3072, 4096 or 8192 (mbx_rsa_public_mb8() accepts 8192 as well).
+// Lanes holding invalid exponent return MBX_STATUS_MISMATCH_PARAM_ERR.
+// pBuffer (if not NULL) must be at least mbx_RSA_Method_BufSize() of
+// mbx_RSA_pub65537_Method(rsaBitlen).
+*/
+EXTERN_C mbx_status mbx_rsa_public_exp_mb8(const int8u* const from_pa[8],
+                                                 int8u* const to_pa[8],
+                                          const int64u e[8],
+                                          const int64u* const n_pa[8],
+                                                    int rsaBitlen,
+                                  const mbx_RSA_Method* m,
+                                                 int8u* pBuffer);
+
 EXTERN_C mbx_status mbx_rsa_private_mb8(const int8u* const from_pa[8],
                                               int8u* const to_pa[8],
                                        const int64u* const d_pa[8],
@@ -100,4 +118,212 @@ EXTERN_C mbx_status mbx_rsa_private_crt_mb8(const int8u* const from_pa[8],
                                                      int rsaBitlen,
                                    const mbx_RSA_Method* m,
                                                   int8u* pBuffer);
+
+/*
+// rsa operations over batches of mixed rsa sizes
+//
+// rsaBitlen_pa[] holds size of rsa modulus of each lane (1024, 2048, 3072 or 4096).
+// The batch is processed as a sequence of homogeneous sub-batches, one per
+// distinct size present in the batch, so the cost of the call is the sum of
+// the costs of regular mb8 operations of each distinct size.
+// pBuffer (if not NULL) must be at least mbx_RSA_Method_BufSize() of the method
+// of the largest size in the batch.
+*/
+EXTERN_C mbx_status mbx_rsa_public_mixed_mb8(const int8u* const from_pa[8],
+                                                   int8u* const to_pa[8],
+                                            const int64u* const n_pa[8],
+                                                const int rsaBitlen_pa[8],
+                                                   int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_private_mixed_mb8(const int8u* const from_pa[8],
+                                                    int8u* const to_pa[8],
+                                             const int64u* const d_pa[8],
+                                             const int64u* const n_pa[8],
+                                                 const int rsaBitlen_pa[8],
+                                                    int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_private_crt_mixed_mb8(const int8u* const from_pa[8],
+                                                        int8u* const to_pa[8],
+                                                 const int64u* const p_pa[8],
+                                                 const int64u* const q_pa[8],
+                                                 const int64u* const dp_pa[8],
+                                                 const int64u* const dq_pa[8],
+                                                 const int64u* const iq_pa[8],
+                                                     const int rsaBitlen_pa[8],
+                                                        int8u* pBuffer);
+
+/*
+// rsa prepared keys
+//
+// The key is converted into radix 2^52 and Montgomery constants (k0, RR) are
+// computed once by mbx_rsa_*_key_prepare_mb8(). A prepared key is an opaque
+// object of mbx_RSA_*_PreparedKey_BufSize() bytes allocated by the caller;
+// it can be reused in any lane of any subsequent mbx_rsa_*_prepared_mb8() call.
+*/
+typedef struct _ifma_rsa_prepared_key mbx_RSA_PreparedKey;
+
+EXTERN_C int mbx_RSA_pub_PreparedKey_BufSize(int rsaBitsize);
+EXTERN_C int mbx_RSA_private_crt_PreparedKey_BufSize(int rsaBitsize);
+
+EXTERN_C mbx_status mbx_rsa_public_key_prepare_mb8(mbx_RSA_PreparedKey* const key_pa[8],
+                                                 const int64u* const n_pa[8],
+                                                           int rsaBitlen);
+
+EXTERN_C mbx_status mbx_rsa_private_crt_key_prepare_mb8(mbx_RSA_PreparedKey* const key_pa[8],
+                                                      const int64u* const p_pa[8],
+                                                      const int64u* const q_pa[8],
+                                                      const int64u* const dp_pa[8],
+                                                      const int64u* const dq_pa[8],
+                                                      const int64u* const iq_pa[8],
+                                                                int rsaBitlen);
+
+EXTERN_C mbx_status mbx_rsa_public_prepared_mb8(const int8u* const from_pa[8],
+                                                      int8u* const to_pa[8],
+                                  const mbx_RSA_PreparedKey* const key_pa[8],
+                                                         int rsaBitlen,
+                                       const mbx_RSA_Method* m,
+                                                      int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_private_crt_prepared_mb8(const int8u* const from_pa[8],
+                                                           int8u* const to_pa[8],
+                                       const mbx_RSA_PreparedKey* const key_pa[8],
+                                                              int rsaBitlen,
+                                            const mbx_RSA_Method* m,
+                                                           int8u* pBuffer);
+
+/*
+// rsa key generation
+//
+// Generates 8 independent rsa keys (public exponent e=65537). Random bytes are taken
+// from rndFunc. Each prime candidate is tested by nTrials rounds of Miller-Rabin
+// (FIPS 186-4, Table C.3 recommends at least 5 rounds for 1024- and 2048-bit rsa,
+// 4 rounds for 3072- and 4096-bit rsa). n and d are rsaBitlen bits long,
+// p, q, dp, dq and iq are rsaBitlen/2 bits long (BNU, 64-bit digits).
+// d_pa (or any of its entries) may be NULL if non-crt private exponent is not needed.
+// Lanes failed because of random generator failure return MBX_STATUS_MISMATCH_PARAM_ERR.
+// pBuffer (if not NULL) must be at least mbx_RSA_Method_BufSize() of
+// mbx_RSA_private_crt_Method(rsaBitlen).
+*/
+EXTERN_C mbx_status mbx_rsa_generate_keys_mb8(int64u* const n_pa[8],
+                                              int64u* const d_pa[8],
+                                              int64u* const p_pa[8],
+                                              int64u* const q_pa[8],
+                                              int64u* const dp_pa[8],
+                                              int64u* const dq_pa[8],
+                                              int64u* const iq_pa[8],
+                                                        int rsaBitlen,
+                                                        int nTrials,
+                                              mbx_rand_func rndFunc,
+                                                      void* pRndParam,
+                                                     int8u* pBuffer);
+
+/*
+// rsa padding schemes (PKCS #1 v2.2)
+//
+// RSAES-OAEP encryption/decryption and RSASSA-PSS signature generation/verification
+// on top of the mb8 rsa operations. Hashing and MGF1 of all 8 lanes are computed
+// by multi-buffer SHA-2. Random components are provided by the caller: OAEP seed
+// (hash length bytes) and PSS salt (saltLen bytes, the same length in all lanes).
+// Ciphertexts and signatures are rsaBitlen/8 bytes long (big endian).
+//
+// Lanes failed OAEP decoding return MBX_STATUS_MISMATCH_PARAM_ERR,
+// lanes failed PSS verification return MBX_STATUS_SIGNATURE_ERR.
+*/
+enum MBX_HASH_ALG {
+   MBX_HASH_SHA256,
+   MBX_HASH_SHA384,
+   MBX_HASH_SHA512
+};
+
+EXTERN_C mbx_status mbx_rsa_oaep_encrypt_mb8(const int8u* const msg_pa[8],
+                                                  const int msgLen_pa[8],
+                                           const int8u* const label_pa[8],
+                                                  const int labelLen_pa[8],
+                                           const int8u* const seed_pa[8],
+                                                 int8u* const to_pa[8],
+                                          const int64u* const n_pa[8],
+                                                        int rsaBitlen,
+                                          enum MBX_HASH_ALG hashAlg,
+                                      const mbx_RSA_Method* m,
+                                                     int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_oaep_decrypt_crt_mb8(const int8u* const from_pa[8],
+                                                     int8u* const to_pa[8],
+                                                            int msgLen_pa[8],
+                                               const int8u* const label_pa[8],
+                                                      const int labelLen_pa[8],
+                                              const int64u* const p_pa[8],
+                                              const int64u* const q_pa[8],
+                                              const int64u* const dp_pa[8],
+                                              const int64u* const dq_pa[8],
+                                              const int64u* const iq_pa[8],
+                                                            int rsaBitlen,
+                                              enum MBX_HASH_ALG hashAlg,
+                                          const mbx_RSA_Method* m,
+                                                         int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_pss_sign_crt_mb8(const int8u* const msg_pa[8],
+                                                  const int msgLen_pa[8],
+                                           const int8u* const salt_pa[8],
+                                                        int saltLen,
+                                                 int8u* const sign_pa[8],
+                                          const int64u* const p_pa[8],
+                                          const int64u* const q_pa[8],
+                                          const int64u* const dp_pa[8],
+                                          const int64u* const dq_pa[8],
+                                          const int64u* const iq_pa[8],
+                                                        int rsaBitlen,
+                                          enum MBX_HASH_ALG hashAlg,
+                                      const mbx_RSA_Method* m,
+                                                     int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_pss_verify_mb8(const int8u* const sign_pa[8],
+                                         const int8u* const msg_pa[8],
+                                                const int msgLen_pa[8],
+                                                      int saltLen,
+                                        const int64u* const n_pa[8],
+                                                      int rsaBitlen,
+                                        enum MBX_HASH_ALG hashAlg,
+                                    const mbx_RSA_Method* m,
+                                                   int8u* pBuffer);
+
+/*
+// rsa base blinding
+//
+// The blinding object keeps the pair (r^e, r^(-1)) mod n of the private crt key
+// (public exponent e=65537 implied) in radix 2^52 Montgomery form. It is an opaque
+// object of mbx_RSA_Blinding_BufSize() bytes allocated by the caller, one per key.
+// mbx_rsa_blinding_init_mb8() computes the pair from random r (1 < r < n, rsaBitlen/8
+// bytes, big endian) provided by the caller. Each mbx_rsa_private_crt_blinded_mb8()
+// call blinds the input by r^e, unblinds the result by r^(-1) and refreshes the pair
+// by squaring, so the object is updated by every call and must not be shared by
+// concurrent calls. The object is bound to its key: mbx_rsa_blinding_init_mb8() checks
+// n = p*q, and mbx_rsa_private_crt_blinded_mb8() rejects a lane whose object was
+// initialized for another key with MBX_STATUS_MISMATCH_PARAM_ERR.
+*/
+typedef struct _ifma_rsa_blinding mbx_RSA_Blinding;
+
+EXTERN_C int mbx_RSA_Blinding_BufSize(int rsaBitsize);
+
+EXTERN_C mbx_status mbx_rsa_blinding_init_mb8(mbx_RSA_Blinding* const blind_pa[8],
+                                            const int8u* const r_pa[8],
+                                           const int64u* const n_pa[8],
+                                           const int64u* const p_pa[8],
+                                           const int64u* const q_pa[8],
+                                           const int64u* const iq_pa[8],
+                                                         int rsaBitlen,
+                                       const mbx_RSA_Method* m,
+                                                      int8u* pBuffer);
+
+EXTERN_C mbx_status mbx_rsa_private_crt_blinded_mb8(const int8u* const from_pa[8],
+                                                          int8u* const to_pa[8],
+                                                   const int64u* const p_pa[8],
+                                                   const int64u* const q_pa[8],
+                                                   const int64u* const dp_pa[8],
+                                                   const int64u* const dq_pa[8],
+                                                   const int64u* const iq_pa[8],
+                                               mbx_RSA_Blinding* const blind_pa[8],
+                                                             int rsaBitlen,
+                                           const mbx_RSA_Method* m,
+                                                          int8u* pBuffer);
 #endif /* RSA_H */
@@ -0,0 +1,62 @@
+/*************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+#ifndef SHA512_H
+#define SHA512_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+#define SHA512_DIGEST_SIZE       (64)                       /*              sha512 digest size (bytes)               */
+#define SHA512_MSG_BLOCK_SIZE    (128)                      /*           sha512 message block size (bytes)           */
+
+#define SHA512_NUM_BUFFERS8      (8)                        /*      number of buffers in sha512 multi-buffer 8       */
+
+/*
+// sha512 context for mb8
+*/
+
+typedef int64u sha512_hash_mb8[8][SHA512_NUM_BUFFERS8];    /*  sha512 hash value in multi-buffer format: word i of buffer j is at [i][j] */
+
+struct _sha512_context_mb8 {
+    int             msg_buff_idx[SHA512_NUM_BUFFERS8];                       /*              buffer entry             */
+    int64u          msg_len[SHA512_NUM_BUFFERS8];                            /*              message length           */
+    int8u           msg_buffer[SHA512_NUM_BUFFERS8][SHA512_MSG_BLOCK_SIZE];  /*                  buffer               */
+    __ALIGN64
+    sha512_hash_mb8 msg_hash;                                                /*             intermediate hash         */
+};
+
+typedef struct _sha512_context_mb8 SHA512_CTX_mb8;
+
+/*
+// Buffers with len[i]==0 are skipped by update,
+// buffers with hash_pa[i]==NULL are neither finalized nor reset by final.
+*/
+EXTERN_C mbx_status mbx_sha512_init_mb8(SHA512_CTX_mb8* p_state);
+
+EXTERN_C mbx_status mbx_sha512_update_mb8(const int8u* const msg_pa[8],
+                                                 const int len[8],
+                                            SHA512_CTX_mb8* p_state);
+
+EXTERN_C mbx_status mbx_sha512_final_mb8(int8u* hash_pa[8],
+                                 SHA512_CTX_mb8* p_state);
+
+EXTERN_C mbx_status mbx_sha512_msg_digest_mb8(const int8u* const msg_pa[8],
+                                                     const int len[8],
+                                                         int8u* hash_pa[8]);
+
+#endif /* SHA512_H */
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef X448_H
+#define X448_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+/* size of X448 keys (bytes) */
+#define X448_KEY_SIZE  (56)
+
+/*
+// Computes X448 public keys (RFC 7748)
+// pa_public_key[]   array of pointers to the computed public keys (56 bytes each)
+// pa_private_key[]  array of pointers to the private keys (56 bytes each)
+*/
+EXTERN_C mbx_status mbx_x448_public_key_mb8(int8u* const pa_public_key[8],
+                                   const int8u* const pa_private_key[8]);
+
+/*
+// Computes X448 shared secrets (RFC 7748)
+// pa_shared_key[]   array of pointers to the computed shared secrets (56 bytes each)
+// pa_private_key[]  array of pointers to the own private keys
+// pa_public_key[]   array of pointers to the peer's public keys
+//
+// MBX_STATUS_LOW_ORDER_ERR is returned in lanes where the shared secret is all-zero
+*/
+EXTERN_C mbx_status mbx_x448_mb8(int8u* const pa_shared_key[8],
+                              const int8u* const pa_private_key[8],
+                              const int8u* const pa_public_key[8]);
+
+#endif /* X448_H */
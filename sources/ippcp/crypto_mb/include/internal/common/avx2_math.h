@@ -0,0 +1,233 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef AVX2_MATH_H
+#define AVX2_MATH_H
+
+/*
+// 4-lane AVX2 primitives of the kernels for the platforms without AVX512-IFMA.
+//
+// Same "vertical" layout as in ifma_math.h: the vector holds the same digit of 4 independent numbers.
+// There is no 52-bit multiplier in AVX2, the kernels use 32x32->64 unsigned multiplication
+// and keep the numbers in 25.5/26/28-bit radix, accumulating products without carry propagation.
+*/
+
+#include <immintrin.h>
+#include <internal/common/ifma_defs.h>
+
+typedef __m256i U64x4;
+
+#define MB4_WIDTH (4)
+
+__INLINE U64x4 loadu64x4(const void* p)
+{
+   return _mm256_loadu_si256((const __m256i*)p);
+}
+
+__INLINE void storeu64x4(void* p, U64x4 v)
+{
+   _mm256_storeu_si256((__m256i*)p, v);
+}
+
+__INLINE U64x4 set1x4(int64u a)
+{
+   return _mm256_set1_epi64x((long long)a);
+}
+
+__INLINE U64x4 get_zero64x4(void)
+{
+   return _mm256_setzero_si256();
+}
+
+#define add64x4    _mm256_add_epi64
+#define sub64x4    _mm256_sub_epi64
+#define and64x4    _mm256_and_si256
+#define andnot64x4 _mm256_andnot_si256  /* ~a & b */
+#define or64x4     _mm256_or_si256
+#define xor64x4    _mm256_xor_si256
+#define srli64x4   _mm256_srli_epi64
+#define slli64x4   _mm256_slli_epi64
+#define cmpeq64x4  _mm256_cmpeq_epi64
+#define cmpgt64x4  _mm256_cmpgt_epi64   /* signed */
+
+/* 64-bit product of low 32 bits of the lanes */
+#define mul32x4    _mm256_mul_epu32
+
+/* variable (but the same for all lanes) shifts, counts above 63 produce zero */
+__INLINE U64x4 srl64x4(U64x4 a, int s)
+{
+   return _mm256_srl_epi64(a, _mm_cvtsi32_si128(s));
+}
+
+__INLINE U64x4 sll64x4(U64x4 a, int s)
+{
+   return _mm256_sll_epi64(a, _mm_cvtsi32_si128(s));
+}
+
+/* r = mask? b : a (mask lanes are all-ones or zero) */
+__INLINE U64x4 select64x4(U64x4 mask, U64x4 a, U64x4 b)
+{
+   return _mm256_blendv_epi8(a, b, mask);
+}
+
+/* lanes mask of the lanes having bit0 set */
+__INLINE U64x4 bit0_mask64x4(U64x4 a)
+{
+   return sub64x4(get_zero64x4(), and64x4(a, set1x4(1)));
+}
+
+/* 4-bit mask of the mask lanes */
+__INLINE int8u mask64x4_to_bits(U64x4 mask)
+{
+   return (int8u)_mm256_movemask_pd(_mm256_castsi256_pd(mask));
+}
+
+/* lanes mask of the zero numbers */
+__INLINE U64x4 is_zero64x4(const U64x4* p, int len)
+{
+   U64x4 z = p[0];
+   for(int i=1; i<len; i++)
+      z = or64x4(z, p[i]);
+   return cmpeq64x4(z, get_zero64x4());
+}
+
+/*
+// conversions between 4 numbers (given by the pointers) and mb4 representation in 2^digsize radix
+// NULL pointers are treated as zero numbers
+*/
+
+/* little-endian int64u[] -> mb4 */
+__INLINE void BNU_to_mb4_radix(U64x4 out[], int outLen, const int64u* const inp_pa[MB4_WIDTH], int bitLen, int digsize)
+{
+   const int64u mask = ((int64u)1 << digsize) -1;
+   const int len64 = NUMBER_OF_DIGITS(bitLen, 64);
+   __ALIGN64 int64u t[MB4_WIDTH];
+
+   for(int i=0; i<outLen; i++) {
+      int bit = i*digsize;
+      for(int n=0; n<MB4_WIDTH; n++) {
+         const int64u* inp = inp_pa[n];
+         int64u d = 0;
+         if(NULL!=inp && bit<bitLen) {
+            int idx = bit/64;
+            int shift = bit%64;
+            d = inp[idx] >> shift;
+            if(shift>(64-digsize) && (idx+1)<len64)
+               d |= inp[idx+1] << (64-shift);
+         }
+         t[n] = d & mask;
+      }
+      out[i] = loadu64x4(t);
+   }
+   /* cut off bits beyond bitLen */
+   int topBits = bitLen - (NUMBER_OF_DIGITS(bitLen, digsize)-1)*digsize;
+   int topIdx = NUMBER_OF_DIGITS(bitLen, digsize)-1;
+   if(topIdx<outLen)
+      out[topIdx] = and64x4(out[topIdx], set1x4(((int64u)1 << topBits) -1));
+}
+
+/* little-endian int64u[] -> mb4 of 64-bit digits (transposition) */
+__INLINE void BNU_transpose_mb4(U64x4 out[], const int64u* const inp_pa[MB4_WIDTH], int bitLen)
+{
+   const int len64 = NUMBER_OF_DIGITS(bitLen, 64);
+   __ALIGN64 int64u t[MB4_WIDTH];
+
+   for(int i=0; i<len64; i++) {
+      for(int n=0; n<MB4_WIDTH; n++)
+         t[n] = (NULL!=inp_pa[n])? inp_pa[n][i] : 0;
+      out[i] = loadu64x4(t);
+   }
+}
+
+/* big-endian bytes string -> mb4 */
+__INLINE void HexStr_to_mb4_radix(U64x4 out[], int outLen, const int8u* const inp_pa[MB4_WIDTH], int bitLen, int digsize)
+{
+   const int64u mask = ((int64u)1 << digsize) -1;
+   const int len8 = NUMBER_OF_DIGITS(bitLen, 8);
+   __ALIGN64 int64u t[MB4_WIDTH];
+
+   for(int i=0; i<outLen; i++) {
+      int bit = i*digsize;
+      int byte0 = bit/8;
+      int byte1 = (bit+digsize-1)/8;
+      for(int n=0; n<MB4_WIDTH; n++) {
+         const int8u* inp = inp_pa[n];
+         int64u d = 0;
+         if(NULL!=inp) {
+            for(int j=byte1; j>=byte0; j--)
+               d = (d<<8) | ((j<len8)? inp[len8-1-j] : 0);
+         }
+         t[n] = (d >> (bit%8)) & mask;
+      }
+      out[i] = loadu64x4(t);
+   }
+}
+
+/* mb4 -> big-endian bytes string, NULL pointers are skipped */
+__INLINE void mb4_radix_to_HexStr(int8u* const out_pa[MB4_WIDTH], const U64x4 inp[], int inpLen, int bitLen, int digsize)
+{
+   const int len8 = NUMBER_OF_DIGITS(bitLen, 8);
+   __ALIGN64 int64u t[MB4_WIDTH];
+
+   for(int n=0; n<MB4_WIDTH; n++) {
+      int8u* out = out_pa[n];
+      if(NULL==out)
+         continue;
+
+      int64u acc = 0;
+      int accBits = 0;
+      int i = 0;
+      int byte;
+      for(byte=0; byte<len8; byte++) {
+         if(accBits<8 && i<inpLen) {
+            storeu64x4(t, inp[i++]);
+            acc |= t[n] << accBits;
+            accBits += digsize;
+         }
+         out[len8-1-byte] = (int8u)acc;
+         acc >>= 8;
+         accBits -= 8;
+      }
+   }
+}
+
+/* mb4 -> little-endian int64u[], NULL pointers are skipped */
+__INLINE void mb4_radix_to_BNU(int64u* const out_pa[MB4_WIDTH], const U64x4 inp[], int inpLen, int bitLen, int digsize)
+{
+   const int len64 = NUMBER_OF_DIGITS(bitLen, 64);
+   __ALIGN64 int64u t[MB4_WIDTH];
+
+   for(int n=0; n<MB4_WIDTH; n++) {
+      int64u* out = out_pa[n];
+      if(NULL==out)
+         continue;
+
+      for(int i=0; i<len64; i++)
+         out[i] = 0;
+      for(int i=0; i<inpLen; i++) {
+         int bit = i*digsize;
+         if(bit>=len64*64)
+            break;
+         storeu64x4(t, inp[i]);
+         out[bit/64] |= t[n] << (bit%64);
+         if((bit%64)+digsize>64 && (bit/64+1)<len64)
+            out[bit/64+1] |= t[n] >> (64-bit%64);
+      }
+   }
+}
+
+#endif /* AVX2_MATH_H */
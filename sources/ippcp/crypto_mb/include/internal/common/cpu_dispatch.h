@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include <internal/common/ifma_defs.h>
+
+/*
+// Kernels serving the mb8 entry points which have AVX2 implementation
+// (X25519, NIST P-256, RSA public and private key operations):
+//    - AVX512-IFMA kernels, native 8-lane
+//    - AVX2 kernels, 4-lane, the mb8 batch is processed as two halves
+//
+// Any other platform is routed to the AVX512-IFMA kernels, i.e. keeps the former behavior.
+*/
+typedef enum {
+   MBX_ISA_AVX512IFMA = 0,
+   MBX_ISA_AVX2       = 1,
+} MBX_ISA;
+
+/* detected on the first call and cached */
+EXTERN_C MBX_ISA mbx_kernels_isa(void);
+
+#endif /* CPU_DISPATCH_H */
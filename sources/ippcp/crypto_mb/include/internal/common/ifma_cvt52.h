@@ -40,4 +40,8 @@ EXTERN_C int8u ifma_BNU_transpose_copy(int64u out_mb8[][8], const int64u* const
 EXTERN_C int8u ifma_BN_transpose_copy(int64u out_mb8[][8], const BIGNUM* const inp[8], int bitLen);
 #endif /* BN_OPENSSL_DISABLE */
 
+// from mb8 to mb4 (and back) representation of the partially filled batch, lanes - mask of used mb8 lanes (4 at most)
+EXTERN_C void ifma_mb8_to_mb4(int64u out_mb4[][4], const int64u inp_mb8[][8], int len, int8u lanes);
+EXTERN_C void ifma_mb4_to_mb8(int64u out_mb8[][8], const int64u inp_mb4[][4], int len, int8u lanes);
+
 #endif /* IFMA_CVT52_H */
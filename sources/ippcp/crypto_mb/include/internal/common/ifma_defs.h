@@ -59,7 +59,7 @@
 #define SIMD_TYPE(LEN) typedef __m ## LEN ## i U64;
 
 /* max internal data bitsize */
-#define IFMA_MAX_BITSIZE   (4096)
+#define IFMA_MAX_BITSIZE   (8192)
 
 /* internal radix definition */
 #define DIGIT_SIZE (52)
@@ -81,4 +81,11 @@
 #define  REP4_DECL(a)   REP2_DECL(a), REP2_DECL(a)
 #define  REP8_DECL(a)   REP4_DECL(a), REP4_DECL(a)
 
+/* repetition of the value for each lane of the SIMD register */
+#if (SIMD_LEN == 512)
+    #define REP_NUM_BUFF_DECL(a) REP8_DECL(a)
+#else
+    #define REP_NUM_BUFF_DECL(a) REP4_DECL(a)
+#endif
+
 #endif /* IFMA_DEFS_H */
@@ -130,6 +130,9 @@
 
         #define srai64 _mm512_srai_epi64
         #define slli64 _mm512_slli_epi64
+        #define srlv64 _mm512_srlv_epi64
+        #define sllv64 _mm512_sllv_epi64
+        #define shrdv64 _mm512_shrdv_epi64
 
         __INLINE U64 and64_const(U64 a, unsigned long long mask) {
             return _mm512_and_epi64(a, _mm512_set1_epi64((long long)mask));
@@ -151,6 +154,15 @@
         #define mask_sub64   _mm512_mask_sub_epi64
         #define maskz_sub64  _mm512_maskz_sub_epi64
 
+        // Gather operations (variable-time, public data only)
+        #define mask_gather64(src, k, idx, base) _mm512_mask_i64gather_epi64((src), (k), (idx), (const void*)(base), 8)
+        #define mask_gather64_addr(src, k, addr)  _mm512_mask_i64gather_epi64((src), (k), (addr), (const void*)0, 1)
+        #define mask_scatter64(base, k, idx, v)   _mm512_mask_i64scatter_epi64((void*)(base), (k), (idx), (v), 8)
+
+        __INLINE U64 lane_idx64() {
+            return _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+        }
+
         __INLINE __mb_mask is_zero(U64* p, int len) {
             U64 Z = p[0];
             for(int i = 1; i < len; i++) {
@@ -197,7 +209,148 @@
             X5_ = _mm512_mask_shuffle_i64x2(X45H, 0b11001111, X0123H, X67H, 0b10001000 ); \
             X7_ = _mm512_mask_shuffle_i64x2(X67H, 0b00111111, X0123H, X45H, 0b10111101 ); \
         }
-        
+
+    #elif (SIMD_LEN == 256)
+        SIMD_TYPE(256)
+        typedef __mmask8 __mb_mask;
+
+        #define SIMD_LEN   256
+        #define SIMD_BYTES (SIMD_LEN/8)
+        #define MB_WIDTH   (SIMD_LEN/64)
+
+        __INLINE U64 loadu64(const void *p) {
+            return _mm256_loadu_si256((U64*)p);
+        }
+
+        __INLINE U64 loadstream64(const void *p) {
+            return _mm256_stream_load_si256 ((U64*)p);
+        }
+
+        __INLINE void storeu64(const void *p, U64 v) {
+            _mm256_storeu_si256((U64*)p, v);
+        }
+
+        #define mask_mov64 _mm256_mask_mov_epi64
+        #define set64      _mm256_set1_epi64x
+
+        __INLINE U64 fma52lo(U64 a, U64 b, U64 c) {
+            return _mm256_madd52lo_epu64(a, b, c);
+        }
+
+        __INLINE U64 fma52hi(U64 a, U64 b, U64 c) {
+            return _mm256_madd52hi_epu64(a, b, c);
+        }
+
+        __INLINE U64 mul52lo(U64 b, U64 c) {
+            return _mm256_madd52lo_epu64(_mm256_setzero_si256(), b, c);
+        }
+
+        #ifdef __GNUC__
+            // memory ops intrinsics - force load from original buffer
+            #define _mm256_madd52lo_epu64_(r, a, b, c, o) {\
+                r=a; \
+                __asm__ ( "vpmadd52luq " #o "(%2), %1, %0" : "+x" (r): "x" (b), "r" (c) ); \
+            }
+
+            #define _mm256_madd52hi_epu64_(r, a, b, c, o) {\
+                r=a; \
+                __asm__ ( "vpmadd52huq " #o "(%2), %1, %0" : "+x" (r): "x" (b), "r" (c) ); \
+            }
+        #else
+            // Use IFMA instrinsics for all other compilers
+            #define _mm256_madd52lo_epu64_(r, a, b, c, o) {\
+                r=fma52lo(a, b, _mm256_loadu_si256((U64*)(((char*)c)+o))); \
+            }
+
+            #define _mm256_madd52hi_epu64_(r, a, b, c, o) {\
+                r=fma52hi(a, b, _mm256_loadu_si256((U64*)(((char*)c)+o))); \
+            }
+        #endif
+
+        __INLINE U64 select64(__mb_mask k, U64 v, U64 *d) {
+            return _mm256_mask_blend_epi64(k, v, _mm256_loadu_si256(d));
+        }
+
+        #define fma52lo_mem(r, a, b, c, o) _mm256_madd52lo_epu64_(r, a, b, c, o)
+        #define fma52hi_mem(r, a, b, c, o) _mm256_madd52hi_epu64_(r, a, b, c, o)
+
+        __INLINE U64 add64(U64 a, U64 b) {
+            return _mm256_add_epi64(a, b);
+        }
+
+        __INLINE U64 sub64(U64 a, U64 b) {
+            return _mm256_sub_epi64(a, b);
+        }
+
+        __INLINE U64 get_zero64() {
+            return _mm256_setzero_si256();
+        }
+
+        __INLINE void set_zero64(U64 *a) {
+            *a = _mm256_xor_si256(*a, *a);
+        }
+
+        __INLINE U64 set1(unsigned long long a) {
+            return _mm256_set1_epi64x((long long)a);
+        }
+
+        __INLINE U64 srli64(U64 a, int s) {
+            return _mm256_srli_epi64(a, s);
+        }
+
+        #define srai64 _mm256_srai_epi64
+        #define slli64 _mm256_slli_epi64
+        #define srlv64 _mm256_srlv_epi64
+        #define sllv64 _mm256_sllv_epi64
+        #define shrdv64 _mm256_shrdv_epi64
+
+        __INLINE U64 and64_const(U64 a, unsigned long long mask) {
+            return _mm256_and_si256(a, _mm256_set1_epi64x((long long)mask));
+        }
+
+        __INLINE U64 and64(U64 a, U64 mask) {
+            return _mm256_and_si256(a, mask);
+        }
+
+        #define or64         _mm256_or_si256
+        #define xor64        _mm256_xor_si256
+        #define cmp64_mask   _mm256_cmp_epi64_mask
+        #define cmpeq16_mask _mm256_cmpeq_epi16_mask
+        #define cmpeq64_mask _mm256_cmpeq_epi64_mask
+
+        // Mask operations
+        #define mask_blend64 _mm256_mask_blend_epi64
+        #define mask_add64   _mm256_mask_add_epi64
+        #define mask_sub64   _mm256_mask_sub_epi64
+        #define maskz_sub64  _mm256_maskz_sub_epi64
+
+        // Gather operations (variable-time, public data only)
+        #define mask_gather64(src, k, idx, base) _mm256_mmask_i64gather_epi64((src), (k), (idx), (const void*)(base), 8)
+        #define mask_gather64_addr(src, k, addr)  _mm256_mmask_i64gather_epi64((src), (k), (addr), (const void*)0, 1)
+        #define mask_scatter64(base, k, idx, v)   _mm256_mask_i64scatter_epi64((void*)(base), (k), (idx), (v), 8)
+
+        __INLINE U64 lane_idx64() {
+            return _mm256_set_epi64x(3, 2, 1, 0);
+        }
+
+        __INLINE __mb_mask is_zero(U64* p, int len) {
+            U64 Z = p[0];
+            for(int i = 1; i < len; i++) {
+                Z = or64(Z, p[i]);
+            }
+
+            return cmpeq64_mask(Z, get_zero64());
+        }
+
+        #if defined(_MSC_VER) && !defined(__INTEL_COMPILER) && !defined(__INTEL_LLVM_COMPILER) // for MSVC
+            #define mask_xor(m1,m2) (__mb_mask)(_mm512_kxor((m1),(m2)))
+        #else
+            #define mask_xor _kxor_mask8
+        #endif
+
+        #define get_mask(a)       (a)
+        #define get_mask_value(a) (a)
+
     #else
         #error "Incorrect SIMD length"
     #endif  // SIMD_LEN
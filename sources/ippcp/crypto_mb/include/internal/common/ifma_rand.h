@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_RAND_H
+#define IFMA_RAND_H
+
+#include <crypto_mb/defs.h>
+#include <immintrin.h>
+
+/*
+// Default random generator (mbx_rand_func) based on RDRAND instruction
+// fills pRand[nBytes] with random bytes, returns 0 on success
+*/
+__INLINE int ifma_rdrand_bytes(int8u* pRand, int nBytes, void* pRndParam)
+{
+#define LOCAL_COUNTER (8)
+   (void)pRndParam;
+   while(nBytes>0) {
+      unsigned long long sample;
+      int n, k;
+      int success = 0;
+      for(n=0; n<LOCAL_COUNTER && !success; n++)
+         success = _rdrand64_step(&sample);
+      if(!success)
+         return -1;
+
+      for(k=0; k<8 && nBytes>0; k++, nBytes--, sample >>= 8)
+         *pRand++ = (int8u)sample;
+   }
+   return 0;
+#undef LOCAL_COUNTER
+}
+
+#endif /* IFMA_RAND_H */
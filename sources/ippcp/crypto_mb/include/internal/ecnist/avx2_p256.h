@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+#ifndef AVX2_P256_H
+#define AVX2_P256_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+/*
+// NIST P-256 kernels behind mbx_nistp256_ecpublic_key_mb8(), mbx_nistp256_ecdh_mb8(),
+// mbx_nistp256_ecdsa_sign_mb8() and mbx_nistp256_ecdsa_verify_mb8()
+// (see cpu_dispatch.h)
+*/
+
+/* AVX512-IFMA */
+EXTERN_C mbx_status ifma_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                                 int64u* pa_puby[8],
+                                                 int64u* pa_pubz[8],
+                                           const int64u* const pa_skey[8],
+                                                  int8u* pBuffer);
+EXTERN_C mbx_status ifma_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                                   const int64u* const pa_skey[8],
+                                   const int64u* const pa_pubx[8],
+                                   const int64u* const pa_puby[8],
+                                   const int64u* const pa_pubz[8],
+                                          int8u* pBuffer);
+EXTERN_C mbx_status ifma_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                               int8u* pa_sign_s[8],
+                                         const int8u* const pa_msg[8],
+                                        const int64u* const pa_eph_skey[8],
+                                        const int64u* const pa_reg_skey[8],
+                                               int8u* pBuffer);
+EXTERN_C mbx_status ifma_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                                 const int8u* const pa_sign_s[8],
+                                                 const int8u* const pa_msg[8],
+                                                const int64u* const pa_pubx[8],
+                                                const int64u* const pa_puby[8],
+                                                const int64u* const pa_pubz[8],
+                                                       int8u* pBuffer);
+
+/* AVX2 */
+EXTERN_C mbx_status avx2_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                                 int64u* pa_puby[8],
+                                                 int64u* pa_pubz[8],
+                                           const int64u* const pa_skey[8],
+                                                  int8u* pBuffer);
+EXTERN_C mbx_status avx2_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                                   const int64u* const pa_skey[8],
+                                   const int64u* const pa_pubx[8],
+                                   const int64u* const pa_puby[8],
+                                   const int64u* const pa_pubz[8],
+                                          int8u* pBuffer);
+EXTERN_C mbx_status avx2_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                               int8u* pa_sign_s[8],
+                                         const int8u* const pa_msg[8],
+                                        const int64u* const pa_eph_skey[8],
+                                        const int64u* const pa_reg_skey[8],
+                                               int8u* pBuffer);
+EXTERN_C mbx_status avx2_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                                 const int8u* const pa_sign_s[8],
+                                                 const int8u* const pa_msg[8],
+                                                const int64u* const pa_pubx[8],
+                                                const int64u* const pa_puby[8],
+                                                const int64u* const pa_pubz[8],
+                                                       int8u* pBuffer);
+
+/*
+// base point table of the AVX512-IFMA kernels (ifma_ecprecomp4_p256.h), shared with the AVX2 kernels:
+// [65][8] affine points of 2x5 digits in 2^52 radix, Montgomery domain (R = 2^260)
+*/
+#define P256_BP4_N_SLOTS  (65)
+#define P256_BP4_N_ENTRY  (8)
+extern const int64u* const ifma_ec_nistp256_bp_precomp4;
+
+#endif /* AVX2_P256_H */
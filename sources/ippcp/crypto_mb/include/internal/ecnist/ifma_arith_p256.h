@@ -29,15 +29,15 @@
 #define P256_LEN64  NUMBER_OF_DIGITS(P256_BITSIZE,64)
 
 __ALIGN64 static const int64u ones[P256_LEN52][sizeof(U64)/sizeof(int64u)] = {
-   { REP8_DECL(1) },
-   { REP8_DECL(0) },
-   { REP8_DECL(0) },
-   { REP8_DECL(0) },
-   { REP8_DECL(0) }
+   { REP_NUM_BUFF_DECL(1) },
+   { REP_NUM_BUFF_DECL(0) },
+   { REP_NUM_BUFF_DECL(0) },
+   { REP_NUM_BUFF_DECL(0) },
+   { REP_NUM_BUFF_DECL(0) }
 };
 
 static const int64u VMASK52[sizeof(U64)/sizeof(int64u)] = {
-   REP8_DECL(DIGIT_MASK)
+   REP_NUM_BUFF_DECL(DIGIT_MASK)
 };
 
 #define NORM_LSHIFTR(R, I, J) \
@@ -140,6 +140,7 @@ EXTERN_C void MB_FUNC_NAME(ifma_frommont52_p256_)(U64 r[], const U64 a[]);
 EXTERN_C void MB_FUNC_NAME(ifma_ams52_p256_)(U64 r[], const U64 va[]);
 EXTERN_C void MB_FUNC_NAME(ifma_amm52_p256_)(U64 r[], const U64 va[], const U64 vb[]);
 EXTERN_C void MB_FUNC_NAME(ifma_aminv52_p256_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amsqrt52_p256_)(U64 r[], const U64 a[]);
 EXTERN_C void MB_FUNC_NAME(ifma_add52_p256_)(U64 r[], const U64 a[], const U64 b[]);
 EXTERN_C void MB_FUNC_NAME(ifma_sub52_p256_)(U64 r[], const U64 a[], const U64 b[]);
 EXTERN_C void MB_FUNC_NAME(ifma_neg52_p256_)(U64 r[], const U64 a[]);
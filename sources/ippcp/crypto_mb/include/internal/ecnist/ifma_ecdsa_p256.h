@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_ECDSA_P256_H
+#define IFMA_ECDSA_P256_H
+
+#include <internal/ecnist/ifma_ecpoint_p256.h>
+
+/* ECDSA signature components */
+EXTERN_C void MB_FUNC_NAME(nistp256_ecdsa_inv_keys_)(U64 inv_skey[], const U64 skey[], int8u pBuffer[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(nistp256_ecdsa_sign_r_)(U64 sign_r[], const U64 skey[], int8u pBuffer[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(nistp256_ecdsa_sign_s_)(U64 sign_s[], U64 msg[], const U64 sign_r[],
+                                                        U64 inv_eph_skey[], U64 reg_skey[], int8u pBuffer[]);
+
+/*
+// ECDSA signature
+// mb8 - full batch, mb4 - partially filled batch (4 lanes at most)
+*/
+EXTERN_C void nistp256_ecdsa_sign_mb8(int64u sign_r[][8], int64u sign_s[][8], int64u eph_skey[][8],
+                                const int64u scalar[][8], int64u reg_skey[][8], int64u msg[][8], int8u pBuffer[]);
+EXTERN_C void nistp256_ecdsa_sign_mb4(int64u sign_r[][4], int64u sign_s[][4], int64u eph_skey[][4],
+                                const int64u scalar[][4], int64u reg_skey[][4], int64u msg[][4], int8u pBuffer[]);
+
+#endif /* IFMA_ECDSA_P256_H */
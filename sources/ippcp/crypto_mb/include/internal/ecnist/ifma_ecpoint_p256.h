@@ -36,6 +36,14 @@ typedef struct {
    int64u y[P256_LEN52];
 } SINGLE_P256_POINT_AFFINE;
 
+/*
+// window 7 comb table: [BP_N_SLOTS][BP_N_ENTRY] as ifma_ec_nistp256_bp_precomp[][] of ifma_ecprecomp7_p256.h
+// tbl[j][d-1] = [d*2^(7*j)]*P, d=1,..,64
+*/
+#define P256_COMB_WIN_SIZE  (7)
+#define P256_COMB_N_SLOTS   NUMBER_OF_DIGITS(P256_BITSIZE, P256_COMB_WIN_SIZE)
+#define P256_COMB_N_ENTRY   (1<<(P256_COMB_WIN_SIZE-1))
+
 
 
 /* check if coodinate is zero */
@@ -88,8 +96,13 @@ EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(P256_POINT* r, const P25
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_add_point_affine_)(P256_POINT* r, const P256_POINT* p, const P256_POINT_AFFINE* q);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(P256_POINT* r, const P256_POINT* p, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(P256_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_vartime_)(P256_POINT* r, const P256_POINT* p, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_vartime_)(P256_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_comb_vartime_)(P256_POINT* r, const SINGLE_P256_POINT_AFFINE* const tbl[], const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_precomp_comb_)(SINGLE_P256_POINT_AFFINE* const tbl[], const P256_POINT* p);
 EXTERN_C void MB_FUNC_NAME(get_nistp256_ec_affine_coords_)(U64 x[], U64 y[], const P256_POINT* P);
 EXTERN_C const U64* MB_FUNC_NAME(ifma_ec_nistp256_coord_one_)(void);
 EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p256_)(const P256_POINT* p, int use_jproj_coords);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_decompress_y_p256_)(U64 y[], const U64 x[]);
 
 #endif  /* IFMA_ECPOINT_P256_H */
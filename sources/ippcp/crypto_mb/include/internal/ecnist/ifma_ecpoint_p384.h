@@ -36,6 +36,14 @@ typedef struct {
    int64u y[P384_LEN52];
 } SINGLE_P384_POINT_AFFINE;
 
+/*
+// window 7 comb table of the base point computed at run time by ifma_ec_nistp384_precomp_comb_base_()
+// tbl[j][d-1] = [d*2^(7*j)]*G, d=1,..,64
+*/
+#define P384_COMB_WIN_SIZE  (7)
+#define P384_COMB_N_SLOTS   NUMBER_OF_DIGITS(P384_BITSIZE+1, P384_COMB_WIN_SIZE)
+#define P384_COMB_N_ENTRY   (1<<(P384_COMB_WIN_SIZE-1))
+
 
 
 /* check if coodinate is zero */
@@ -97,8 +105,13 @@ EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_add_point_)(P384_POINT* r, const P38
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_add_point_affine_)(P384_POINT* r, const P384_POINT* p, const P384_POINT_AFFINE* q);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_mul_point_)(P384_POINT* r, const P384_POINT* p, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_)(P384_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_mul_point_vartime_)(P384_POINT* r, const P384_POINT* p, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_vartime_)(P384_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_comb_)(P384_POINT* r, const SINGLE_P384_POINT_AFFINE* tbl, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp384_precomp_comb_base_)(SINGLE_P384_POINT_AFFINE* tbl);
 EXTERN_C void MB_FUNC_NAME(get_nistp384_ec_affine_coords_)(U64 x[], U64 y[], const P384_POINT* P);
 EXTERN_C const U64* MB_FUNC_NAME(ifma_ec_nistp384_coord_one_)(void);
 EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p384_)(const P384_POINT* p, int use_jproj_coords);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_decompress_y_p384_)(U64 y[], const U64 x[]);
 
 #endif  /* IFMA_ECPOINT_P384_H */
@@ -36,6 +36,14 @@ typedef struct {
    int64u y[P521_LEN52];
 } SINGLE_P521_POINT_AFFINE;
 
+/*
+// window 7 comb table of the base point computed at run time by ifma_ec_nistp521_precomp_comb_base_()
+// tbl[j][d-1] = [d*2^(7*j)]*G, d=1,..,64
+*/
+#define P521_COMB_WIN_SIZE  (7)
+#define P521_COMB_N_SLOTS   NUMBER_OF_DIGITS(P521_BITSIZE+1, P521_COMB_WIN_SIZE)
+#define P521_COMB_N_ENTRY   (1<<(P521_COMB_WIN_SIZE-1))
+
 
 
 /* check if coodinate is zero */
@@ -106,7 +114,12 @@ EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_add_point_)(P521_POINT* r, const P52
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_add_point_affine_)(P521_POINT* r, const P521_POINT* p, const P521_POINT_AFFINE* q);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_mul_point_)(P521_POINT* r, const P521_POINT* p, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_)(P521_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_mul_point_vartime_)(P521_POINT* r, const P521_POINT* p, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_vartime_)(P521_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_comb_)(P521_POINT* r, const SINGLE_P521_POINT_AFFINE* tbl, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp521_precomp_comb_base_)(SINGLE_P521_POINT_AFFINE* tbl);
 EXTERN_C void MB_FUNC_NAME(get_nistp521_ec_affine_coords_)(U64 x[], U64 y[], const P521_POINT* P);
 EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p521_)(const P521_POINT* p, int use_jproj_coords);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_decompress_y_p521_)(U64 y[], const U64 x[]);
 
 #endif  /* IFMA_ECPOINT_P521_H */
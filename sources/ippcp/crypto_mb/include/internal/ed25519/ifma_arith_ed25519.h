@@ -68,6 +68,10 @@ typedef struct ge52_cached_mb_t {
 /* bitsize of compression point */
 #define GE25519_COMP_BITSIZE  (P25519_BITSIZE+1)
 
+/* window size of the multi-scalar multiplication and number of the pre-computed points per input point */
+#define ED25519_MULTI_WIN_SIZE  (4)
+#define ED25519_MULTI_TBL_SIZE  (1 << (ED25519_MULTI_WIN_SIZE-1))
+
 /*
 // conversion
 */
@@ -153,7 +157,22 @@ void ifma_ed25519_mul_basepoint(ge52_ext_mb* r, const U64 scalar[]);
 void ifma_ed25519_mul_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 scalar[]);
 void ifma_ed25519_prod_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 scalarP[], const U64 scalarG[]);
 
+void ifma_ed25519_mul_point_multi_vartime(ge52_ext_mb* r,
+                                    const ge52_ext_mb p[],
+                                    const U64 scalar[][FE_LEN64+1],
+                                          int num,
+                                          ge52_cached_mb tbl[][ED25519_MULTI_TBL_SIZE]);
+void ifma_ed25519_mul_point_multi_bucket_vartime(ge52_ext_mb* r,
+                                           const ge52_ext_mb p[],
+                                           const U64 scalar[][FE_LEN64+1],
+                                                 int num,
+                                                 int win_size,
+                                                 ge52_cached_mb cached[],
+                                                 ge52_ext_mb bucket[]);
+
 void ge52_ext_compress(fe52_mb fe, const ge52_ext_mb* p);
 __mb_mask ge52_ext_decompress(ge52_ext_mb* p, const fe52_mb fe);
+void ge52_ext_add(ge52_ext_mb* r, const ge52_ext_mb* p, const ge52_ext_mb* q);
+__mb_mask ge52_ext_is_small_order(const ge52_ext_mb* p);
 
 #endif /* IFMA_ED25519_H */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef IFMA_ARITH_ED448_H
+#define IFMA_ARITH_ED448_H
+
+#include <internal/ed448/ifma_arith_p448.h>
+
+/*
+// Ed448 (RFC 8032, 5.2): untwisted Edwards curve x^2 + y^2 = 1 + d*x^2*y^2, d = -39081
+*/
+
+/* homogeneous: (X:Y:Z) satisfying x=X/Z, y=Y/Z */
+typedef struct ge448_homo_mb_t {
+   U64 X[P448_LEN52];
+   U64 Y[P448_LEN52];
+   U64 Z[P448_LEN52];
+} ge448_homo_mb;
+
+/* scalar precomputed group element: affine (x:y) */
+typedef struct ge448_precomp_t {
+   int64u x[P448_LEN52];
+   int64u y[P448_LEN52];
+} ge448_precomp;
+
+/* bitsize of compression point: y-coordinate and sign of x-coordinate in the most significant bit of 57-th byte */
+#define GE448_COMP_BITSIZE  (P448_BITSIZE+8)
+
+/* set GE to neutral */
+__INLINE void neutral_ge448_homo_mb(ge448_homo_mb* ge)
+{
+   MB_FUNC_NAME(zero_FE448_)(ge->X);
+   MB_FUNC_NAME(mov_FE448_)(ge->Y, MB_FUNC_NAME(ifma_one52_p448_)());
+   MB_FUNC_NAME(mov_FE448_)(ge->Z, MB_FUNC_NAME(ifma_one52_p448_)());
+}
+
+/* move GE under mask (conditionally): r = k? a : b */
+__INLINE void cmov_ge448_homo_mb(ge448_homo_mb* r, const ge448_homo_mb* b, __mb_mask k, const ge448_homo_mb* a)
+{
+   MB_FUNC_NAME(mask_mov_FE448_)(r->X, b->X, k, a->X);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->Y, b->Y, k, a->Y);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->Z, b->Z, k, a->Z);
+}
+
+/*
+// point operations
+*/
+EXTERN_C void ge448_add(ge448_homo_mb* r, const ge448_homo_mb* p, const ge448_homo_mb* q);
+EXTERN_C void ge448_dbl(ge448_homo_mb* r, const ge448_homo_mb* p);
+
+/* r = [scalar]*G, scalar is 64-bit digits number less than 2^N448_BITSIZE */
+EXTERN_C void ifma_ed448_mul_basepoint(ge448_homo_mb* r, const U64 scalar[]);
+/* r = [scalar]*p, scalar is 64-bit digits number less than 2^N448_BITSIZE */
+EXTERN_C void ifma_ed448_mul_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalar[]);
+/* r = [scalarP]*p + [scalarG]*G */
+EXTERN_C void ifma_ed448_prod_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalarP[], const U64 scalarG[]);
+
+/* compression and decompression, compressed point is in 2^52 radix */
+EXTERN_C void ge448_homo_compress(U64 r[P448_LEN52], const ge448_homo_mb* p);
+EXTERN_C __mb_mask ge448_homo_decompress(ge448_homo_mb* r, const U64 in[P448_LEN52]);
+
+#endif /* IFMA_ARITH_ED448_H */
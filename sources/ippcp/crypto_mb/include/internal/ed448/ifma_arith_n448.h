@@ -0,0 +1,36 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef IFMA_ARITH_N448_H
+#define IFMA_ARITH_N448_H
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+
+/* bitsize of base point order */
+#define N448_BITSIZE  (446)
+#define N448_LEN52    NUMBER_OF_DIGITS(N448_BITSIZE, DIGIT_SIZE)
+#define N448_LEN64    NUMBER_OF_DIGITS(N448_BITSIZE, 64)
+
+/* r = x mod n, x is (2*N448_LEN52) digits number */
+EXTERN_C void ifma52_ed448n_reduce(U64 r[N448_LEN52], const U64 x[N448_LEN52*2]);
+/* r = (a*b + c) mod n, a and b are any N448_LEN52 digits numbers, c<n */
+EXTERN_C void ifma52_ed448n_madd(U64 r[N448_LEN52], const U64 a[N448_LEN52], const U64 b[N448_LEN52], const U64 c[N448_LEN52]);
+/* a<n mask, a is normalized */
+EXTERN_C __mb_mask ifma52_ed448n_cmp_lt(const U64 a[N448_LEN52]);
+
+#endif /* IFMA_ARITH_N448_H */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef IFMA_ARITH_P448_H
+#define IFMA_ARITH_P448_H
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+
+/*
+// prime448 = 2^448 - 2^224 - 1 (Goldilocks prime of Curve448 and Ed448)
+*/
+
+/* underlying prime's size */
+#define P448_BITSIZE (448)
+
+/* lengths of FF elements */
+#define P448_LEN52  NUMBER_OF_DIGITS(P448_BITSIZE,DIGIT_SIZE)
+#define P448_LEN64  NUMBER_OF_DIGITS(P448_BITSIZE,64)
+
+/* set FE to zero */
+__INLINE void MB_FUNC_NAME(zero_FE448_)(U64 T[])
+{
+   for(int i=0; i<P448_LEN52; i++)
+      T[i] = get_zero64();
+}
+
+/* check if FE is zero */
+__INLINE __mb_mask MB_FUNC_NAME(is_zero_FE448_)(const U64 T[])
+{
+   U64 Z = or64(or64(or64(T[0], T[1]), or64(T[2], T[3])),
+                or64(or64(or64(T[4], T[5]), or64(T[6], T[7])), T[8]));
+   return cmpeq64_mask(Z, get_zero64());
+}
+
+/* move field element */
+__INLINE void MB_FUNC_NAME(mov_FE448_)(U64 r[], const U64 a[])
+{
+   for(int i=0; i<P448_LEN52; i++)
+      r[i] = a[i];
+}
+
+/* move coodinate using mask: R = k? A : B */
+__INLINE void MB_FUNC_NAME(mask_mov_FE448_)(U64 R[], const U64 B[], __mb_mask k, const U64 A[])
+{
+   for(int i=0; i<P448_LEN52; i++)
+      R[i] = mask_mov64(B[i], k, A[i]);
+}
+
+/* swap coodinates using mask: (A, B) = k? (B, A) : (A, B) */
+__INLINE void MB_FUNC_NAME(mask_swap_FE448_)(U64 A[], U64 B[], __mb_mask k)
+{
+   for(int i=0; i<P448_LEN52; i++) {
+      U64 t = mask_mov64(A[i], k, B[i]);
+      B[i] = mask_mov64(B[i], k, A[i]);
+      A[i] = t;
+   }
+}
+
+/* compare two FE */
+__INLINE __mb_mask MB_FUNC_NAME(cmp_eq_FE448_)(const U64 A[], const U64 B[])
+{
+   U64 T[P448_LEN52];
+   for(int i=0; i<P448_LEN52; i++)
+      T[i] = xor64(A[i], B[i]);
+   return MB_FUNC_NAME(is_zero_FE448_)(T);
+}
+
+/*
+// Specialized operations over p448
+//
+// Elements are kept in Montgomery domain (R = 2^(DIGIT_SIZE*P448_LEN52)) and in the [0, 2*p448) range,
+// ifma_frommont52_p448_() returns fully reduced result.
+// Multiplication and squaring accept operands up to 8*p448, that allows to skip reduction
+// after ifma_ladd52_p448_() and ifma_lsub52_p448_().
+*/
+EXTERN_C U64* MB_FUNC_NAME(ifma_one52_p448_)(void);
+EXTERN_C void MB_FUNC_NAME(ifma_tomont52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_frommont52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ams52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amm52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_aminv52_p448_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ampowp34_52_p448_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_add52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_sub52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_neg52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ladd52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_lsub52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_mulc52_p448_)(U64 r[], const U64 a[], int64u c);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_cmp_lt_p448_)(const U64 a[]);
+
+#endif /* IFMA_ARITH_P448_H */
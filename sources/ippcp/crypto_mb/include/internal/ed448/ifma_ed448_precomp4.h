@@ -0,0 +1,592 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef IFMA_ED448_PRECOMP_H
+#define IFMA_ED448_PRECOMP_H
+
+#include <internal/ed448/ifma_arith_ed448.h>
+
+#define MUL_BASEPOINT_WIN_SIZE (4)
+
+#define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE
+#define BP_N_ENTRY (1<<(BP_WIN_SIZE-1))
+
+/* affine (x:y) in Montgomery domain */
+__ALIGN64 static const ge448_precomp ifma_ed448_bp_precomp[][BP_N_ENTRY] = {
+{ /* slot=0 [{1,2,3,..,8} * 16^(2*0)] * G) */
+{{0x000b17aa38342068,0x0004f8fe6d35bf93,0x000b765fab7bc291,0x000e9b28e44cd37a,0x00086a834f3952a7,0x000eb444d6fb9be8,0x000b9ee96c7295e6,0x0006d16ef0905d88,0x000000005f0ea883}, {0x00079a99632d81f4,0x00023c2104ac119c,0x000fc5486da8e9ac,0x00098abb416ef259,0x000325146ff4948a,0x0004714fa9dd0122,0x00050a1f0e6acaf9,0x000765f7687a33ab,0x00000000fba18417}},
+{{0x000ffffffffaaaaa,0x000fffffffffffff,0x000fffffffffffff,0x000fffffffffffff,0x000aaa9aaaa9ffff,0x000aaaaaaaaaaaaa,0x000aaaaaaaaaaaaa,0x000aaaaaaaaaaaaa,0x00000000aaaaaaaa}, {0x000a276f460e6e49,0x000c780c107349a5,0x000b90c43756ed53,0x00083c6a10ed8406,0x00061d41fc33e1b5,0x000c45fb977d5a5a,0x000ca381ed8ab4fa,0x000e9ea0dddcd95c,0x0000000077ea3136}},
+{{0x00069b937095b0ae,0x0001c3e2e40299fa,0x0000855194b9c788,0x000bb27b5c4be484,0x0003e83adb038546,0x000e70dd1cc24c73,0x000cfdfcfaaa5df6,0x000ac0a1a1e839c1,0x000000000bffcbb2}, {0x00055731380ac596,0x000abb44db796fcd,0x0006b943540ad991,0x00004c9012e23342,0x000500478ad26349,0x0009fed033875257,0x0006fe6f2336548d,0x000d09e8ff1ce668,0x00000000f10655ee}},
+{{0x000dcb823ef0480c,0x0003eaf030d6d472,0x0002c48a80b63aea,0x000dc48c1d65777a,0x000c8adbf24c91f6,0x000f7edf663970b5,0x000a1354dd3fdf4b,0x000a4979911b9e6f,0x0000000057bd9d15}, {0x00036f2db5d24ab4,0x00050f8a373a0f3e,0x0001893d65fbff9c,0x000da6dea5b815c8,0x0009e8074c613a66,0x00093b91e7840000,0x000d87b57967ccfb,0x0003ccce60fbbe71,0x00000000b8b1a74c}},
+{{0x000e8da621d8ac73,0x0002c8c3560c4ab7,0x000b5de303b7c709,0x00004ea088bdb39c,0x000c4069aeed5b63,0x0005db6ef85f3fb1,0x000e5496bf15e983,0x000b96e95afcd4cb,0x000000008ebd4dc6}, {0x0004b5987e41292e,0x000bc3d67e6602e3,0x0002155985ff0ae2,0x000cef92c212e350,0x000d9dc7728568b4,0x0008b91792b223be,0x000f06aced438655,0x000095cbf3ed0652,0x00000000ba572078}},
+{{0x00075985701f2ab6,0x00083eaad8bbc470,0x000164a7a91f386e,0x000fd08e8a18756c,0x000b667910482acb,0x000d38f7b17bc071,0x000ebb7c66d5c39a,0x0000b818aa070223,0x000000000b1095c0}, {0x0000a4200eec811e,0x00060503a7656f36,0x00073f1a68cb7ca3,0x000cb537ad9c8d46,0x0008611508a10846,0x000dc1e0814e7407,0x0000e4c881dd87b5,0x0003db10cc06cab8,0x00000000a51f76b5}},
+{{0x000a41ed17b1d285,0x00004e397399d78b,0x000c2ffc1e8955e2,0x000e3df8a479cbae,0x000b7ff32b960967,0x000b0f5419af7987,0x00078c02050f911a,0x00081bc047491591,0x0000000097c46d9e}, {0x00078252c8e76f6f,0x0008a9cd83b21b80,0x000f2f13aed5dfad,0x0000823374dbedf8,0x000219d700f1139c,0x000efd8229c1429e,0x000bea5d38f1a283,0x000d114f61b5a526,0x00000000b76517f9}},
+{{0x000f730497910302,0x00000f996de160fc,0x0007e57a9fbb5ce1,0x00025308546c0907,0x000d5114e6e90d2a,0x000c459d89537d0c,0x00015d530d18c187,0x000bafd0044d4f3e,0x00000000d27c33ba}, {0x0004a432d17da458,0x00083426f8f371af,0x000de4d9e5d1d56d,0x0002981de3df7d5a,0x0007993ed34ba222,0x000fac982aeac61c,0x0009da3d797649f5,0x0009bec7fa7a13c2,0x00000000970be82b}},
+},
+{ /* slot=1 [{1,2,3,..,8} * 16^(2*1)] * G) */
+{{0x0005b655776c6a1d,0x000311bda7ce69d7,0x0002a786f9389e30,0x000ec7cbcb396f48,0x00002d09ba770e9e,0x000f856e83d3910b,0x00012363c2b56c43,0x000caf1c2dbe4539,0x000000005e8a42ef}, {0x000b8c30da44d1af,0x00004e224efb9ec3,0x0007e2dc3654bfbf,0x000fe8ec42bfc96f,0x000f72a5e4a7d115,0x000cfcca17b8e755,0x00091d531d935286,0x000c3f6da5d15191,0x000000006ddf0faa}},
+{{0x0004d2233aa0c4ea,0x000c06455425aa20,0x0002b2cca5e023de,0x000101f001bc21f6,0x0007b8b00fb818f8,0x000ec7786cda9103,0x0001edbd27a4cf4c,0x000b562f0ad4fa54,0x00000000eace584a}, {0x000cf33e1258c95d,0x000245ba2e230b5e,0x000a3568e8145343,0x000271134004262b,0x000370be125690ae,0x00073668d3055655,0x0002a11bf8515e39,0x0009fe3db257562f,0x0000000089c96264}},
+{{0x0000744768823ec2,0x000bf71f227d43b7,0x00043e48d63cbc24,0x000b23c16d4f9ef4,0x000b1ec4c53095ff,0x000c1ae5e7be4f04,0x000cec6ec2c6d264,0x000036e5bc29587b,0x00000000c6bc22d6}, {0x00016e25c68b5cf7,0x000f4c6083b713b3,0x000ce95d26a980b4,0x000bb664cd1983af,0x0001a7774159c352,0x000d9fd1965f04ba,0x0009061e181fe2ad,0x00003d3f3b71e399,0x00000000545fc4d1}},
+{{0x000f2f8cf003929b,0x00064c9ca8d9e9e1,0x0006eea64fd71af1,0x0004a87772cda8ce,0x000f9e4e441d5b3f,0x00074b47ff38309b,0x000f7ff0651261b5,0x00044cdf0a1f06f4,0x000000007b405456}, {0x000c9ad2603c7f68,0x000cbfd68ad658b8,0x00087087c1b0080e,0x0005fea802e79486,0x000b4e11bf654eb3,0x0008ca1e111c635e,0x000814a5bf79937c,0x000f457e56c70031,0x0000000098ba56c6}},
+{{0x000343d0a8ee4616,0x0000a072b3bb472d,0x000ad7dc0636e231,0x0007250f1b22f280,0x000086fead692e66,0x000598bf9ebbc4c9,0x000fa95b40241c45,0x000ada690fd89c1b,0x0000000002d6071f}, {0x0006d98b21695868,0x000b6cb8fb0f0d67,0x000d89261fc9a249,0x000234096b682b3b,0x000ed9d52383def5,0x000bcbfc669349eb,0x000841199b9992ad,0x0006d7b6e3baf620,0x0000000050c6b037}},
+{{0x0007f6efe2945af0,0x0004d222ee6ba65d,0x000affbef388471e,0x0009a17d22f9c6df,0x000990d777186bd5,0x0008bb09a6543604,0x0006fd23e41716d7,0x0005d76b31e5db97,0x00000000e82ae52a}, {0x0001a4fe003b1507,0x00095b325e1c7ab2,0x0008e288a5a88b3f,0x00009cc718bc22d3,0x000134556dfd9e0f,0x000ebc525e923d45,0x000d1bd84ceba369,0x0005bab7b1339bb3,0x000000000e67fa9e}},
+{{0x000f33d6599faf7d,0x00064225c045ce12,0x0009b6c888e5e4e3,0x000cabf1cf02e3a1,0x00026201f8d41a0c,0x00083f6c56ff550d,0x00030fd8cdc1d275,0x000fef73bedce9b5,0x00000000b13f0b6c}, {0x000b5877b0c3d3bb,0x000dc21309cca86d,0x0006492aa1c75496,0x00089554e2e59907,0x0005c9d0115531d4,0x000f55f29dc36b51,0x000609948dd76e5f,0x0003f9da5fb5fd84,0x0000000048915e36}},
+{{0x000bd8de241b6b06,0x000ba69edddd9841,0x000f056dfc7800c2,0x0006837bf0112195,0x000329fc1ae93027,0x0005232dd7894af7,0x000f81208abefa20,0x000423f2ddb598c1,0x000000007f7c7115}, {0x0009f00fc0169e0a,0x00099107b2208944,0x00073b7b6a163ae8,0x0003a39311ceac0b,0x0009cba4e345bc8f,0x00070bedc9a78461,0x00099eb1afdfcd44,0x000901a884881ecc,0x000000003c7ad088}},
+},
+{ /* slot=2 [{1,2,3,..,8} * 16^(2*2)] * G) */
+{{0x000619d4a8dd9add,0x000be9f1bccd2f4d,0x0009d3bb7a630a67,0x000dafd14463210f,0x0006366e6b5883da,0x0009fb24e7757483,0x00059ac622d42f1a,0x000b142b2dc2b860,0x0000000009875013}, {0x0005974d5b5bcf78,0x0007e9e88e6aa040,0x0008b0f8ce29c0b8,0x000d0760a561943b,0x00053535e1690dfc,0x00054e70068c67c4,0x000976ca23d0f9d4,0x0002c6a8f7e599aa,0x000000003a47f722}},
+{{0x0005339dbb4f775d,0x0000cace6bb7ad6f,0x0008d9986e318e62,0x0006003af320d318,0x000413e4719aa283,0x000a1b39e1e52be0,0x000a882e2629a684,0x00010875022eee7d,0x0000000003079fb3}, {0x000c38fd23819a0a,0x0007170eac98e198,0x00041a5902b217cf,0x000b0c646eaa9380,0x00067a3ad91c30db,0x0007fe75c8863319,0x000221b693f13e49,0x000edd7f353ac56f,0x000000009f08d9a6}},
+{{0x00029787750ce122,0x00001fd669777785,0x000caa33a99ff995,0x000cf0e866d43569,0x000a5f95dbf50b7d,0x000575eaabce0903,0x000bf4404ad1f837,0x0005d29a4fa3ee62,0x000000007459f33f}, {0x00089bacf2e2fac9,0x0000942c4e7855c1,0x0005b4c475400580,0x000143b10b4f9f61,0x00027aa696db04db,0x000b729eec32e71d,0x0003f3c7d78af677,0x0005310780af7407,0x0000000058bd4243}},
+{{0x00017f948bc31d1f,0x0008430a1a5964d8,0x0003c9c72ac03f00,0x00039d20d0a2c07c,0x0000ee2dc41aa783,0x0000f460ef3ebda5,0x0007e838efbdef90,0x000ff44c31b5a9b9,0x000000007dcf1332}, {0x0007ac5c6e97e7a4,0x000e150d5c91aed9,0x00010a297d12787f,0x000cd2de3936327d,0x000d893a6a8d8910,0x0006cb1b1c095e0d,0x0003e7e8d6abcdd1,0x00054309a21827e7,0x0000000051102b0d}},
+{{0x0002e881ec7f6239,0x0002ece2c77fe5f7,0x000b639832a28078,0x000d41aa3398b8cb,0x000c5c4251cfbfa8,0x000c56b717d030d0,0x000b40228a7d5433,0x000b6815e7f792be,0x00000000c023a4a4}, {0x000e8e3c29992791,0x00003f71666d1086,0x0009d9e79b9ccb51,0x00084f2909c0a4d8,0x00025bf78a33f66b,0x00041f7bc5268ff1,0x000e05b5c1f3c5e7,0x000e483087e65cfc,0x00000000afa6079c}},
+{{0x00059235c326eb9c,0x0002de9a894e5c97,0x000902d6d64a58a6,0x000c6355de42702c,0x0007b1d6fced7c81,0x0001cf735e2edee5,0x0009f4dccac1a664,0x0000247eb6eff543,0x00000000da48b90b}, {0x0002ab86caa8bf4b,0x000be601028e7e40,0x000b6e1600e19229,0x0003d3fb088271ab,0x00007c8202090b79,0x000c7c5194b43e8a,0x000d801017017caf,0x0001f54df8e9bbf0,0x000000008c456938}},
+{{0x0009334a198f2bf5,0x000fba4337aa501e,0x000cb23a768774d8,0x000a7c61580d0847,0x000224c3951ca962,0x000bdd3da20f0ebe,0x000e7a9a0b040a54,0x000110d6c81eff17,0x000000000d7f4a17}, {0x0005843a561baa0a,0x000eeaea56abfb5d,0x0002ba714fce6c09,0x00015ca4274afadb,0x000cd9cf22be8043,0x0005c2ef28e9bdcc,0x000d125fadc98f51,0x0003fe82999c62ab,0x00000000ac955b66}},
+{{0x0007ce9e40a91aef,0x00097ecc20d5c09b,0x00014f9f3b93bacf,0x0002cc1282b5246b,0x000030e76cc9f8ca,0x0002ea4416008ae5,0x00014950aac9e9ff,0x00036786ac1eb99c,0x00000000f2b553c3}, {0x0002ebe2e8aea7ad,0x0009eab0d2aa2791,0x00021c364a8c9648,0x000efb1bcabfdc06,0x000fde4fb129c5de,0x000d54150468d04d,0x00047e6a94b65fc1,0x000930d04ebb6b7d,0x00000000facb3536}},
+},
+{ /* slot=3 [{1,2,3,..,8} * 16^(2*3)] * G) */
+{{0x00009131ad11c92f,0x00081d34cdd62f26,0x000998b61634cdaa,0x000b67218edc73eb,0x000f59552df14846,0x0001953e17db9807,0x0009df8d0249ae88,0x000d2367c2c3929f,0x0000000051722e94}, {0x000720097647e981,0x000bc9b16b29ccd3,0x0001173530fa6738,0x0007b7cbf2786477,0x000f2a2775d88005,0x00030c8213c99144,0x000eeea92d02b0fe,0x000793837d487b5d,0x0000000018b4e2ce}},
+{{0x000bb758b52a5a45,0x0008485d0d38373e,0x0002a8c2693acf5f,0x000a4856843c40cd,0x000377424373eab6,0x0001089661d132ad,0x0004d1df30a7f0ab,0x00076c3e10268972,0x0000000055162981}, {0x000f7b5b3575fc23,0x000ba53c4280e1e3,0x000e07508e3856aa,0x0006aa7a4a99bf79,0x0000ff0e4159cc9b,0x000e41d15a8ff3c3,0x00091463fbdbb626,0x000024fa43c3c590,0x000000007cd0c589}},
+{{0x000bf400d33dc0d1,0x000e49440ec8e31a,0x00078f8851e2a019,0x000ec194a223ea8c,0x000bd1ddafef8ba4,0x000e60d50ac6dc43,0x000a533c39794192,0x000ce27bcc9858da,0x00000000d570cb1e}, {0x000b7f17489df675,0x000965c4fe88639c,0x00067705fce439f4,0x0001bc9e8743116c,0x00077baabc153621,0x000ce603f0d70cff,0x000cf0f9cb04ee07,0x000fb94b325311f8,0x000000000ce6d281}},
+{{0x0002972dbaeace5f,0x000f10a96532cf73,0x000c341a38ff191f,0x0000d42b063f6aa9,0x000046fcdd5e1fd7,0x0004cf3606e0b66a,0x000ebebf72f33d79,0x000207b7ab387c1b,0x000000009b0063c4}, {0x00067119ea6175c9,0x000ea8f37be66992,0x000f31a16768a717,0x00030e590f08ff4b,0x0000023adf6c0359,0x0000a45200a2a138,0x0007a1c9aa2c9d70,0x000861a98afbc7ed,0x000000003c210d10}},
+{{0x0005c0a22078c747,0x0009aeeb7e786ada,0x0001dad6747535e2,0x000fe20dc96695db,0x000d2cf0c94f6f26,0x000c2fe3f735c4fb,0x000f1faed8faea6c,0x00053c3646ae93bd,0x000000006bbf518b}, {0x000a65406cb388e0,0x000f86c4da0ecfd7,0x0005b1a370c0fef6,0x000afb57cb3a3f27,0x000de78680475986,0x000e3c19ea84ca5b,0x00010a6aeabf8d3e,0x000b6488abfb6c8c,0x0000000031f33f5d}},
+{{0x0007b5ec30f1c54c,0x000ab4b0beb8c3c3,0x0009e02a6ea1f56d,0x00032180f27b78ce,0x000f27c64baff817,0x000663f46a636c97,0x000a44e001a0a306,0x000c12bca4cec4f2,0x00000000dd067462}, {0x0001e8d6d69129e2,0x000fc5432ec59696,0x0000e2affdbfa24e,0x0002696069de7693,0x000895d282596de7,0x0001e2766c7966cc,0x000ca8d932ab131c,0x000c29644cb9fdcf,0x000000009cff3628}},
+{{0x0000af783ea37b57,0x00081842de775e41,0x0007f2c62d7a232c,0x000cccad1091aee4,0x0003c8c2ba54f286,0x0001262e79672241,0x00030e59cbcb4878,0x000949bdbc657506,0x00000000cab87bae}, {0x000db3e8526a4081,0x000fafe16d2b4990,0x000194cc546426a6,0x0002c23af077a0d0,0x0009b037fc8a06b8,0x000a34c1d36ae1a5,0x00081a38f1cbce25,0x00076841240a019c,0x00000000e3a23c6c}},
+{{0x0002efc56d3cb8a5,0x0000a2306dac6747,0x0009e558d21bbc27,0x000a1c5d31e6a144,0x000daec9b2167e98,0x00004574159b4687,0x000e1cf281fbd15c,0x000f935f398905b9,0x00000000a1f63bfe}, {0x000166f83b9d9f5f,0x00084022cf7e17f2,0x00010be9154ba1e1,0x00016a60fe46c593,0x0009044b16b24761,0x0006f16deac9acdf,0x00083236e80ba808,0x00018d17bf0cf0a7,0x000000003932ee06}},
+},
+{ /* slot=4 [{1,2,3,..,8} * 16^(2*4)] * G) */
+{{0x000db79e81dcf2c2,0x000ac378d1f628b8,0x000b0383df86997a,0x000e743c3a57938f,0x0002aedcaa2431c1,0x0007e3763550191a,0x0009edfab329d1cb,0x0001f7a0d81a96b1,0x00000000e936371c}, {0x000db9a2b070263a,0x0008eb07e6352c05,0x000f8794a5754578,0x00073c45c848bb07,0x000df0f5bbf18683,0x0009a50be31e211d,0x0009d3b24bfde3b1,0x00055c50f80a0ac4,0x00000000ab7af46f}},
+{{0x00044df95c5a3a20,0x0008153eeeb96aa9,0x000d35cbad502571,0x000549f6d4e57b3f,0x00061c7d77171706,0x0006b7c05a60e280,0x00090f399d4391ad,0x0005a258a726d745,0x00000000d6736009}, {0x000c9e7ac9ff50c9,0x0005ebab25698125,0x000c582973282058,0x0009563b56439543,0x00046b19c8cb8355,0x000397089cc0cd68,0x000f69b03d45f5ee,0x0009e31da50255ac,0x000000001ea3cdd5}},
+{{0x000bd9ed24859802,0x0000727067abb309,0x0004a2039d1c34d1,0x000d229f01954a38,0x000bc60f336965cb,0x000e93fb2a42fd5e,0x0008abe58c70deb6,0x000633a333594524,0x00000000f361abee}, {0x0001d172970d9081,0x00013d2783a6edab,0x000637ddab0e51b6,0x0005ca02df0c1b1a,0x0009e1ea981195a8,0x00028ecc4f82144c,0x000e553bdf4fe6c2,0x000aae9b4c88fa4a,0x0000000086f1c120}},
+{{0x00010ee122380f69,0x0000eabdb2b2cdb4,0x0000076a19b429ce,0x0005520bb0d96a66,0x000ca2ddf6598726,0x0008465b16cf8d7e,0x000e5eed9fffb136,0x000005b0527cc129,0x0000000045adc22f}, {0x000247f032d79cc2,0x000c95c2c483fe62,0x00026f3baa166786,0x000ec9cf15aef5d7,0x000ca6482d566490,0x000de519313a0222,0x000f00ebdc783e60,0x000683e46524add7,0x00000000f1d62025}},
+{{0x0000642d5ab0e088,0x0001871f3a51a4c6,0x0001ee38271d7151,0x000c1d797f570fdd,0x00071d58066deff1,0x000d65c663eb5f5c,0x0005ab0d70922a53,0x000e99fec5c9cfdc,0x000000001b8a6010}, {0x000ee89d2b0c6aa5,0x00071a685bfa18d2,0x0004b72c6805dedf,0x000bdf11ae0b6a5a,0x0006aa05b97aca91,0x0008acfca3edd560,0x0007afb1827b8e7e,0x000324f8e4ecda57,0x00000000f5115781}},
+{{0x000305e0bc06e94a,0x000eedafdef51b38,0x0000f14767821942,0x000d48c238de493c,0x000c21a0d7a12e1c,0x000e31f05bb8b1b4,0x0007f6b608dfe846,0x000737704cc8b943,0x0000000011cf3615}, {0x0007ffb0be9213fa,0x000211d35079163b,0x000909b0c7d29ad9,0x00020426b3624608,0x00049930624944d8,0x000b78ff8b9b3dd1,0x000480d4e5a8e90b,0x000b16ad4817c8ac,0x0000000011387728}},
+{{0x000ed7e847c06797,0x000329f8f488a49f,0x0002cad1e5a94b5a,0x0005a22b2a79d0b1,0x000119748139034d,0x00063c31094c30ce,0x000e87993f4cb37b,0x0009032536b91882,0x00000000c7530aa1}, {0x00004f5ecba6e78c,0x0003bfbe725ed6a9,0x000d41989c9c31f9,0x00026c5ef86e000f,0x000d01941953ae7d,0x000f4a7fe4240f9c,0x0000f38a2d4cfb1b,0x000270e968e81f15,0x0000000049efeda4}},
+{{0x0005ef284f27fafd,0x000fec98fb05c52a,0x000d94f0811bcb20,0x000caf0f9f705b70,0x000fa96959615779,0x000337ba04e359e3,0x000ac42c81f6f85c,0x000f923505992ac7,0x00000000c105a05c}, {0x0005c41f3b163cf7,0x000b51a113dae17a,0x00090d76bd4820d5,0x0005e7c7570cbcc8,0x0005033e89e5c255,0x000a2441ecbd8e36,0x000566ba867cd4b0,0x00043221a8039899,0x00000000ad5432c4}},
+},
+{ /* slot=5 [{1,2,3,..,8} * 16^(2*5)] * G) */
+{{0x00000ff75368c0e9,0x0009d5914e306710,0x000c899e92f6c033,0x000e514854e18afe,0x000bb5c4b8de7246,0x0000175d542a61f2,0x00054abb75176762,0x000034ddb514a156,0x0000000065996015}, {0x000e4848c9d1653f,0x000e6dc6312586cd,0x00072713eecb98f5,0x0006d8e3d32920ff,0x0001ab68d74887f0,0x000815f114ef80a7,0x000af4c2a4befd87,0x0000fe0cc4d2ea74,0x00000000dc795f09}},
+{{0x0009d2c1b032cd96,0x000c478e44f97dc6,0x000687ad235bce3c,0x00086fb51d042fea,0x000514a956438c1e,0x000cb6084b1c30f7,0x0005da511200dd54,0x00070b830a99c1fc,0x000000005eaf1817}, {0x000a853c858b21aa,0x000d669deee75909,0x000b3932f67eb9d6,0x000a8040a6cd7ca3,0x000dba79a2d66b7d,0x000db11efe883e3d,0x000fa31b00315a23,0x0005f26c091a977f,0x000000002a1983af}},
+{{0x000c7c4e6070be1e,0x00035afbb97d0abf,0x000954388f4a082c,0x00085fe44873dcb4,0x0005406da4f16a85,0x000911277d8bc47c,0x000ccfafceb275c2,0x00081e6265adfcce,0x00000000efa6fd5e}, {0x000f476cf6d87c2c,0x0004099387dd92b5,0x0005051fbeff28f3,0x0001fc9f00dda477,0x000e84cac5aaf416,0x0009cb7b88d771a4,0x0008bdc5fb0cf1ed,0x0004238690aa3e61,0x000000002ca7e4e1}},
+{{0x000b5c0972337121,0x00010a53f197b798,0x0002d83e06174298,0x00053fcc9d98e5d1,0x0009bde72cb0f68d,0x0004b915955f34fa,0x000bf605a59b22f5,0x0000f5a454db7e6d,0x0000000080ede45d}, {0x000dea746af38b1b,0x000c51e7444ca535,0x000ae83b666ae069,0x000f420f39a3746b,0x00022309f3cab998,0x000c9bc234d9699f,0x000a84985dfd6dbf,0x0009df0d5cbf04ae,0x00000000971d288b}},
+{{0x0000080640c4f736,0x000266f08313efc2,0x000fe6445a839a13,0x000864200a4020a2,0x000faf7bd06e2cd1,0x000036650ede13f3,0x0000264d866def22,0x000733dda2638f4a,0x00000000611e639a}, {0x00090066f34eb6f6,0x0000bac7ecb83e76,0x0001b0b59394430d,0x00019e693f3aecbc,0x00078b270598f52e,0x000a3aef86cdda28,0x000201bee9c6fbab,0x0005f88cab2cbc17,0x000000001bbe8188}},
+{{0x0008316608afa8aa,0x000ce623dcdb3532,0x00086718ee1b474b,0x000023713ab93f13,0x000ac428270591f8,0x000b99bf53870bcb,0x0007725178a29945,0x0005fe3e2a12c39e,0x00000000d7445af1}, {0x00063d3dad9dda59,0x00089ba14897a61b,0x000e4bc87f57a5c9,0x00021d4a577d9966,0x000c1b6fda9c32ef,0x0004d62260e3b9dc,0x00015781f82d9a97,0x000413b72a816658,0x0000000030f2cee2}},
+{{0x0006e0126b3ff0c9,0x0005ccdde643803c,0x000f515f57655eaa,0x000594c235be08b0,0x000875cc3789542e,0x0004f9d941205c64,0x00009f2d3c053c17,0x00039e9eed46726e,0x00000000d13a6fa3}, {0x000a2878fe5cf3d9,0x000d4ea8830d1a00,0x00014935eab63b97,0x0001e63451843b05,0x0004f90fa6b15963,0x00061164c89a22a7,0x0001807720271d90,0x000f3b43d78af6d4,0x00000000e2fcf27f}},
+{{0x000fbd06e5f812cc,0x0006e6b97d0cb2cd,0x0002213667ae405e,0x000b14ebb629e2aa,0x000530ab091b78f0,0x000f89ad7a8f7c78,0x000687d101334881,0x000b981fa40fc783,0x00000000174240b7}, {0x00098a37d0759642,0x000271f4ffec1787,0x0006bee97584cf07,0x000207d8c382987a,0x000950c4400afb0e,0x000de46adcf3ceee,0x000180fa715b35ff,0x00022f79e2e82d7f,0x0000000038a5f763}},
+},
+{ /* slot=6 [{1,2,3,..,8} * 16^(2*6)] * G) */
+{{0x0008a5f55d5a5f1a,0x00019b9779dfbda5,0x00076bd7ed658cb8,0x0000fa5c62fcb459,0x000ecf165159fe00,0x0006f2a902adb419,0x000615b866a297d6,0x000bcd4297aa25bf,0x00000000dd616182}, {0x000597a4b33939c4,0x00070bdd6669b4f5,0x00048b4247c5b2fb,0x0007c4c98006fafa,0x000d64be447da463,0x000dfa0f152f703b,0x000409ed59ada426,0x000f71ef8d903c92,0x00000000fcee3288}},
+{{0x00018230a911a901,0x0004be7d738c82d0,0x0004393ca3f6de74,0x000c449c7c9f10aa,0x0007e4a134ab44f6,0x0000f6276e536a90,0x0003f905b3a9535e,0x0004b8838e1517cc,0x0000000024be4b2e}, {0x0009242b2550e4cc,0x000bd495e1334fcb,0x0008671e225a37de,0x0006d3c8abd3e5ec,0x000a9711162d866d,0x000149dc29b59911,0x000dcac8c770882d,0x000edba527062570,0x00000000388ebbab}},
+{{0x0005d391cd59329a,0x00026eda608a7acf,0x000cf13c6f1dcb3d,0x0009bce4f79c1900,0x000538e77040b837,0x0002973d6538ee95,0x00044186337a6f10,0x0000ffdaf4ed3e1f,0x00000000555213f0}, {0x0005b2872f6dc0a8,0x000f777cf59d7719,0x000ec419e41b4fe1,0x0001d182cc0c4788,0x0009dabdb9c8754d,0x00025a172fc4316a,0x000bf9987b608930,0x0007f4f80451ac85,0x000000004dca26d8}},
+{{0x000173ce0e069515,0x0008111ba40a4402,0x000c4a9104a397f9,0x0003e9f9211ab0ac,0x00002eb0dabb5a3e,0x00065f28ee0e07b2,0x0000b6207e93c856,0x000c6860238c034c,0x00000000cd60891e}, {0x0007e332313c51d7,0x0005e09c6e20358a,0x000d6f5bf33d4876,0x000ad51cb4305686,0x000c4735552c4f54,0x000de0c192aa2635,0x0004f9a5c32571f2,0x000ff2fd29f27dd0,0x00000000ecc92239}},
+{{0x00074c6f78ca5600,0x00089eb27ede6e8a,0x000706970d28c8e5,0x0000ed6b912263ca,0x00053f23e30848bc,0x000fda6ff2fb37f1,0x0008503cce50b483,0x0005fdb9b0bdba70,0x00000000f20b71eb}, {0x00014e1b61355fb7,0x00063a6936a29524,0x0000618b0a6fb6c5,0x000dbbdd254850b9,0x0009f296012f0364,0x00086ffce5f2b2b7,0x000e458737af5340,0x000d37ab0617eaf0,0x0000000025eea0f1}},
+{{0x00006ec08a261cf2,0x00093f1709f9aaeb,0x00059a7c07324089,0x0009ddde58b847f9,0x00058ec0bd34c122,0x0003c037bc1d0713,0x000523ed5c41d2d6,0x0002343e9a4a8cb9,0x000000005f9fbb6e}, {0x00084356a8741ec3,0x000126058af65b47,0x00080ea3b9afa00e,0x00053570e0e1f9a7,0x0005a70ff8202a77,0x000f20e5d2deb0ed,0x00001bbe0d6b7104,0x000aeba436f73ccf,0x00000000423f5b49}},
+{{0x000705af407b8758,0x00017a867f31fcab,0x0000224d00164dc2,0x00003eba069a9b17,0x00086cc2c6c2fd10,0x0000b81a635bab7c,0x0003b5a14fb275b3,0x000eeaa14d49ef49,0x00000000b0fd6482}, {0x000be607bbcd9417,0x00059abb6e5df649,0x0000060472702e4c,0x000b820a27488111,0x0006075c829c77e2,0x0004d1c6aae0443a,0x00045e4abcb87b23,0x000477dd646d4272,0x000000003b0ffef2}},
+{{0x000e3416d9891a5c,0x0001793f3aeac2b3,0x0008ff5180c12124,0x000ec63712fda302,0x000e3b0d5b353918,0x000daf9b0ed7d383,0x00018d60b51ffc90,0x000357a1b7b65910,0x000000002c3627a0}, {0x000fc8ad4efe10de,0x0005849ba635cb72,0x000a39bed2a097ff,0x00041a2798bbe852,0x000dcfeee7cafc45,0x00000eb9c2d76df0,0x0003cf9f13f79d55,0x000ac2e477c48bdf,0x00000000e166e9c0}},
+},
+{ /* slot=7 [{1,2,3,..,8} * 16^(2*7)] * G) */
+{{0x0003622d9d6aa102,0x0006ecac68280540,0x000e78452e283742,0x000af5cc21253128,0x000043e3d77818ef,0x0003f6d7438f371d,0x00061c504ea248de,0x000b93d32001b45d,0x00000000f9f05e7f}, {0x00015c4ce5835aef,0x000be3a71b6b9fdf,0x000fb792df175c9f,0x00046e788c21ceea,0x00038d277415b227,0x0000106d44dcaeca,0x000437b657ccde3b,0x000e2f1860767478,0x0000000022ca8a66}},
+{{0x0006645932ff00da,0x0003b76b601e7c0d,0x000ea87d0a5da277,0x000f9d8957a554b4,0x000f1236324b6a7e,0x00002e74b76c74cc,0x0006e0559f03373b,0x00047aa20a61e967,0x000000003efcc06a}, {0x000ef1f2216178a0,0x0006fa45da052067,0x00053de852b9a3a9,0x0002a5f569c5b38a,0x00033ec75afa40d8,0x000036d2490d06d4,0x000d7e4aa629e1c1,0x000755d8b987d89b,0x0000000082ff53d8}},
+{{0x000516724d63b3c6,0x00045fd7d0f0151c,0x00095d50d5d0ba58,0x000e92ed9d95dc07,0x000d54a4fb4d4d85,0x000e725c2d6aad11,0x0009eb8236d5b50a,0x000ee33aa0fb8501,0x00000000cc0c9222}, {0x00091fb44439ce8a,0x00040630ee9a5293,0x000de58c23e1d759,0x000e1bf5122a77d3,0x0002372f24eedd74,0x00082eb2fe4c1892,0x0007e83fa912b63a,0x000d4d17443dcc8e,0x000000000c250bb7}},
+{{0x0005027ee6438f16,0x000f6245ae1a20b5,0x0005792215d024c2,0x000e0cfbafb7cd59,0x0000eb3540821531,0x000abecd81e4e79d,0x000cea88f560b8f1,0x000f5f58fbba9ceb,0x000000009dc83818}, {0x000c171c79b75ef5,0x00051df2fe8a7e21,0x00054a87f09a7a6f,0x000013b2e05ae987,0x000152e899c3264f,0x00078b8d2542d0fc,0x0006964025af8eeb,0x000be0ad9d32b044,0x0000000060303a33}},
+{{0x000e950f37c826b7,0x00092dc8798f4daa,0x0004dd3e83e3f086,0x0004e6b8077f41dd,0x000bedf21a54db64,0x000378a279f8a136,0x000aca1b2aae26ff,0x00074b3919cd1873,0x00000000814032d1}, {0x000e05316c50ca3e,0x000e2d3d17d25340,0x000180e7fbb7e003,0x000927bf711c728a,0x0008fe28c737b648,0x00059d52d3194ff2,0x00084ab8e86f7a32,0x00026a4dbde58244,0x00000000eeb05101}},
+{{0x000f1b314e9466c6,0x0004c5e75dcf395d,0x0003a73d2e41412e,0x00022c43224dee7f,0x000323732bcf7553,0x0003c2225450ab0d,0x00060d7e0a980530,0x0004918a210a8c5b,0x00000000e1880b4c}, {0x0005bddc4dfbb080,0x0006c8587c4a0983,0x00046361e00907a4,0x0007df585bcf5937,0x000565058c05d7d1,0x00086165e1e32412,0x0001aff11e7c7c1d,0x00006c58dab891bb,0x00000000938abaca}},
+{{0x000b3ea859eb98e1,0x00099494e8d191c1,0x000ef8a5c436f691,0x00073fa0ff2cd493,0x000b19f438536fb2,0x0004478411af0ce5,0x000f4f94dadf81f6,0x000e2b6ae16ad650,0x000000004429e57a}, {0x000d4810b3023033,0x000e913519777f1c,0x0004b79177891337,0x000b5a76e49c297b,0x00008297f111cfdd,0x000ccd871fadaf95,0x000921db83b9086f,0x00053b427f805f1c,0x00000000fff291c7}},
+{{0x000753260de9d0af,0x0009ddee15202a8a,0x0003987d932b3cbf,0x000bb292b74cbd72,0x0007be6d22484bb5,0x0003f7c0e725711b,0x000bd361499baef5,0x000b6c70cd49f1df,0x00000000b1aff1d9}, {0x00017efd0d8f5a00,0x0003554d5e87343e,0x0006dcff167a5649,0x0008fb188bb0cc49,0x000d8722606b4dae,0x0005fc899a23a50c,0x0003f3a6f56f81aa,0x00086a32bcde51d7,0x00000000e2dec03b}},
+},
+{ /* slot=8 [{1,2,3,..,8} * 16^(2*8)] * G) */
+{{0x00024fa39789e052,0x000863afc59652b7,0x000664363ec5c149,0x00013e0be41530bc,0x000eac4c2f283c86,0x0003791470db51b5,0x000bc8b6008f568f,0x0009ad60f539cdc4,0x000000001d2a5aab}, {0x0000cbe24db56b7f,0x000620dee6f145f5,0x000167911bc613a9,0x00004203d3ec05ae,0x000d62258574c06b,0x0001578e992befc8,0x000806c11ce6bdcf,0x000e6d528f8c72b4,0x00000000bb550b8b}},
+{{0x000be33d329e6b9b,0x0009288a9b8f1f74,0x00054544281f390a,0x000ad9010ae6240a,0x000d850bc4e14328,0x000436844f511620,0x0007d6291293f42b,0x0006a00d56a20d3d,0x00000000f8337aa8}, {0x0007cd26aa16efbc,0x00005b6afb824b0c,0x0009b9e5d02a9bf9,0x000032624c03584e,0x00028651a91484fc,0x000882ad047b44fe,0x0000694c9279c71b,0x00043cfae08ab345,0x00000000fd342d26}},
+{{0x00086a003dc286b3,0x000a0e1e4ab03867,0x000998aa43fce0a6,0x0001b9fb777b3f0d,0x00000269135cce2f,0x0005d603d62e9a5c,0x0006b8ee4e76a14c,0x0007aa96e2ec88c4,0x00000000f2f25cf7}, {0x0001275bd8224529,0x000a207ff4d439a5,0x00070d74e74f963a,0x000b8a07c9dc935b,0x000c681a1d838dc2,0x000764a6528b6e47,0x00079b88df27d7cc,0x000ef37d70dc13c4,0x00000000c0e7e1fb}},
+{{0x0001959880d83bc5,0x0001d7bd3f7552f4,0x0009ad69c7a029f4,0x000bb11a5ea85cf0,0x00086e133e2185bb,0x0009bcf416d237ef,0x000f74027e4542f6,0x000fc5a490d6ffbb,0x000000005903edcb}, {0x00084ec5b7d7d913,0x000f940416675900,0x0009a9c778010fc0,0x000a384da314f05b,0x00052b23abb9558a,0x00038736af6f4dd6,0x0008e036fe5ccda6,0x000f8982016f0d95,0x000000004e8f7ca5}},
+{{0x00070c7a4e9b98bc,0x0004234cefacad8a,0x000356a64ba7f7ea,0x000c41e7fe6e3a57,0x000c1bb4bc7a3347,0x000a489fe4daa8da,0x0009fce2cc0841e0,0x000f1a5ca54f9732,0x00000000c9e3d84c}, {0x000f5a70a0f9d0de,0x0003ea6b782596ed,0x00026963198e7cc2,0x000016b17bdf2a17,0x000c8c3ccaecad37,0x0009f3da420f5195,0x000aa502a1acfbbb,0x0005b0f183c18e2b,0x00000000cb7e1ed3}},
+{{0x0003a4e64e90ec74,0x0009a9d13d9b1944,0x000cda6c4fe9aee2,0x000d9c2d1998fa6a,0x0001b9995268cce8,0x000724c0d6421c87,0x000394f71f3fd41c,0x0002cff85b241270,0x00000000901085f5}, {0x0007531617838109,0x000911aa60a0e800,0x0007e648decab7dd,0x0005168ba8c93a9a,0x00083f0a1695d4cb,0x00095e12f3bcd6ec,0x000f3502af07ee15,0x000e9e46f189c249,0x000000003c80dfdf}},
+{{0x00095ae3edf7d58e,0x00045ae1fa924f20,0x0009b01ec76bb3f2,0x000241b08405bd15,0x000bbe02eee6913d,0x000242fd0a66d46f,0x000719f65e705269,0x000fc5e1c532bdf1,0x00000000af9b87eb}, {0x000e661e9377b13d,0x00022a3e56e87ca1,0x000305909f167c4d,0x000ea77f71f5c248,0x000f6c44d5ed3d39,0x000eea196e9401ed,0x00019e1be3944928,0x00057ffe1db73436,0x00000000f58f6c5e}},
+{{0x000b889933afd7df,0x00076a92c0e212c1,0x000b06367df24bdc,0x000cc8f8e4cde014,0x0007968fb5c33ca6,0x00068d8224e90eae,0x0001eaa8a5009416,0x0005ac8aa7238bde,0x00000000385e1d41}, {0x0005d9b089b48748,0x00078b4a46666eab,0x0007d28205f8789d,0x00055ae57f6f99b7,0x00068eacc2327e9a,0x000689d67f642337,0x0001fa746c9260b8,0x000955b4addbf868,0x000000004a39634f}},
+},
+{ /* slot=9 [{1,2,3,..,8} * 16^(2*9)] * G) */
+{{0x000510a792e1a50e,0x0003194ed4fc0274,0x000775392462515c,0x000c514d70877d97,0x0009ea83d4c2aafd,0x00082f6d0de7d6c2,0x000575a7fcb342c0,0x000cbb9ab79b03a9,0x000000007427dc13}, {0x000e530b9541904b,0x0006936098a57b0d,0x00073d663a5d679c,0x0007d7aa2322e1f1,0x000ca12146ba9afe,0x0000b6da32353cc5,0x00087044f2060f2f,0x000d65c0df6f438e,0x00000000b2ffcc84}},
+{{0x00031d327e12f53c,0x00042aedb96219d5,0x00065c02c5853d5a,0x000fc1615bbddf71,0x0004beb4426233b3,0x00003e8de3dc68b2,0x000abd6bd5b4cd86,0x000d95d87c761062,0x000000001553bcdc}, {0x000d0a20d620b3ab,0x000042971de2e3b6,0x000e0d9c11462c7f,0x0007122032280a0c,0x000bf102af43d3bc,0x00012fcb1159258d,0x000098557cf0d484,0x00093da78e87bb86,0x0000000090503c48}},
+{{0x000c571f1824e40b,0x0000a0088afe193d,0x00081ab53183fa34,0x000e74eabf5a1d16,0x000363874b04a02d,0x00007d3100febb67,0x000ce5d3e38e447c,0x0008b44b715512dd,0x000000002da44bad}, {0x000f7555f27561ac,0x00047377800cbda1,0x00029ca44cafce4c,0x000f47f736393982,0x0000221b7a087e61,0x000650b075fc2130,0x000ff9fb3488d932,0x0005ae65b4fcb4ea,0x000000002e1ace0c}},
+{{0x00098d35f6fce6c3,0x000ad2b2c17857a6,0x0005845a7e94d4ed,0x000d4d1e7655c8d2,0x000c9856220cebae,0x000ba5e8a33fc1a3,0x00029dda1ac72ce8,0x000c39856f112d9b,0x0000000021b080e1}, {0x000008e223f6a9f7,0x0004f0d5170d8004,0x000ebcaa6e5e1939,0x0000681121f810f5,0x000a4ada4ee1c5e1,0x0008b6071322db12,0x0000854556ca01a1,0x0005b6c800bef529,0x00000000dc6135c8}},
+{{0x000a78b46b723b6d,0x000c2669c965e5f2,0x000e2a5eaea27ed9,0x00096d7c8840642a,0x0005422a790a0e63,0x000501c332ec5520,0x000738b970c8fc1c,0x000cc4b736010398,0x000000006844b010}, {0x000cc4b12a92e8aa,0x000dfed63fcfdfbf,0x000d642a22f3bf08,0x000ee12cfe3c99ab,0x00037599d1cd349b,0x000b31246195a8e0,0x0008f204ed58493d,0x000eae858a40ef74,0x000000009eb4e32d}},
+{{0x0003c5fba47115e8,0x000558cf1a41b805,0x0003998d021a0313,0x000128115556f17e,0x00058566ccc5429e,0x000972f041e00453,0x000adb3058d4102f,0x0008393319e381cf,0x00000000ed47ff1f}, {0x00057dde0ca1f617,0x0005252d6aaa6b46,0x0007c4f9fc2b0544,0x0001a79ca7d78680,0x000e7901e36dbbe1,0x0001145d122683df,0x0002fc70d14d53a0,0x00029e41b7d31f44,0x00000000c4a6f91a}},
+{{0x0008bc3e4088edf5,0x00030ea9d2e65cdf,0x0001349d820536be,0x000cf708fb7f53f7,0x00090268e2e8d65d,0x0003df5e81089135,0x00025ad05a78c2ad,0x000d5c9156e3918d,0x0000000095d3d4fb}, {0x00039ecd13f0148f,0x000d34578435ee06,0x0003d5ff84e82414,0x00087651793c40e3,0x0000cf5a2f2cd774,0x0007037cd14c2355,0x0006ebc31a4ac959,0x0009432469f7c7f5,0x00000000a88bf479}},
+{{0x00083a8386834961,0x00027de9be14a5d8,0x0002c6938a87d7dc,0x000cd9559a0fac1c,0x000d9c71cb8e4316,0x0007f15700cf2fd1,0x000ddd985ddc4f75,0x000050fa24ebeebc,0x0000000023c67ba4}, {0x0006ae67b5ab00e5,0x0003ef8146f1e27c,0x00003649475337de,0x000389eed3e7e4d3,0x0005cfbdaca979cc,0x000ee79850b52c50,0x0006e29185d82dcf,0x0002d6147850e048,0x0000000003c31c0a}},
+},
+{ /* slot=10 [{1,2,3,..,8} * 16^(2*10)] * G) */
+{{0x000f71103b410f10,0x00036c505c504330,0x000f7f9fd41e8e83,0x000ac0bedc72a743,0x0003f393ace033d5,0x0009ef123a688ec5,0x0001958f9c42a99c,0x0008c5ff9bbb5fae,0x000000000251a7aa}, {0x0000af3c133081de,0x000b0b8489d0a84b,0x00030638734edc99,0x000a1b0e35aa6c82,0x0003131b6b9976f2,0x000c0501fbe77bed,0x000da39d895a832f,0x000b8f2cad8b2fb3,0x00000000dd25582b}},
+{{0x0008e997561cdf22,0x000c5352c4d205d9,0x0000155b3ddee7a6,0x00008c8a55e74d8f,0x0004500c12ba03e0,0x000b5635575dd674,0x0000e390d46cb560,0x00034164dd9a6df0,0x000000007a68a0a3}, {0x000065926a00c810,0x0007789b767a01e1,0x000b292d9e02b5bc,0x0003f6505f4192b7,0x000fb99ef9fcbe2b,0x000ab1cb3c03b329,0x0001dbf54e29a19f,0x0000825dbbaa5cdc,0x000000006b2e72ec}},
+{{0x000c8a1d8ab305ca,0x00049cce629ef8df,0x0009264f3235c6b0,0x000e9f2efa884d47,0x0006d3fd165c4604,0x0005f81106a80d3b,0x00076b46be444a48,0x00027ebd2e8a6644,0x00000000bec23180}, {0x000ec777a673371a,0x0002100042087bb9,0x000f65062e4dc365,0x000591e7bd135f31,0x000589f15de0746b,0x000de4374700ee03,0x000e4b2bfedf4475,0x000fede3c4b0ef92,0x00000000cac830cd}},
+{{0x000158631bfc0cf2,0x0003aff826637235,0x00070771b09a5ea2,0x000c000f53a202cd,0x00094ac1a717d654,0x000ae354b3b6f64e,0x0007e06e19636dc6,0x0006b5a766ccac5a,0x00000000859be83c}, {0x00054d971e5285d3,0x0005cfb20156d61f,0x00029033f30ab0ee,0x0001f18a89ebca7c,0x00024b3c6f80ccf4,0x00092b948dff06fb,0x000f6691dba967e8,0x00063ff9afa4ef68,0x000000006338b745}},
+{{0x000d49b6d65ad54f,0x0000fdd9a8bab8bc,0x0001ddb7a0ccd0d8,0x000366f4ffcdb3ad,0x00020a58e147a089,0x0001f2fbd74bc45b,0x0009141817017b94,0x000b4312727ae5f3,0x00000000dda13043}, {0x000c69f32a59fac1,0x000a9468425b14f9,0x00032496ba02dc2b,0x00031f26f5d0ade6,0x000dacdd5d018058,0x000f6cbdca67bd4a,0x000ad9f0f8e445dd,0x0006d938e6d7aa2e,0x00000000de06062b}},
+{{0x000daf2a22d005c4,0x0002161fed26c990,0x000f2e7b5a2ff1e8,0x000e9ad18b5034f2,0x00072ac39a68c3b5,0x0009d88395987256,0x0004ad230c32c759,0x000df48f83c58742,0x00000000db3640aa}, {0x0007439fc5e483b2,0x00097d0601162b5f,0x000164e3450969a7,0x00077fab15ecefc6,0x0004821f96aeafcc,0x000967f637f1ba7f,0x000cdfbc8e6477c7,0x0009f72e1ed831dd,0x0000000022afad4c}},
+{{0x0000cca2e924d22e,0x0000017b30264f40,0x0001224e5b813c43,0x0001a3ee1b3b15f5,0x000b66f748deb878,0x00000bdff9b54dc3,0x000f11aa30fe6e12,0x000e1d9106ada3ad,0x00000000acff6897}, {0x000a30af92a11b46,0x0001dc733f9792b0,0x000f7abf16f5a733,0x000fc14ccd5c9d9b,0x00092be7d084f5e9,0x00065b71382fbd28,0x000c240f0bd870fb,0x000cd42a158c2262,0x0000000086ede142}},
+{{0x000853868621d133,0x0008111234f4667c,0x000ecd8f3ed35fd6,0x00097dff73fd8d83,0x000a9c37f0805d81,0x00001b3dc472c479,0x00031e2f0cadf808,0x0007a40f3d7baf8d,0x00000000a9b3d972}, {0x00042cc32940ef4f,0x00015d622b14127f,0x0004da242280baba,0x0001091b83900248,0x00024b500420f2a4,0x0005be3118a76095,0x0000fc6faf49c2ba,0x0007199151a57861,0x00000000fbca6460}},
+},
+{ /* slot=11 [{1,2,3,..,8} * 16^(2*11)] * G) */
+{{0x000f9b4b662a1f70,0x000bbd7e8b2d768e,0x0000cc81f852aabe,0x0009c5a68f9e1bb1,0x000b0312676812cc,0x000a73e559ec6668,0x0000db1e61b6b089,0x000f34d34238c0e3,0x0000000058c44ff5}, {0x000fad564199cc39,0x0007b635302c0b9c,0x0006dd048e737612,0x000dd7071062311d,0x00032de9a4670865,0x00028ba623a096fb,0x000559c1dcb3f828,0x000ebdde9080dade,0x000000001b0aaca4}},
+{{0x0001dc11665bed46,0x000614d134398e03,0x000dc3713c260f8e,0x0001076279509454,0x000f635447e59ba8,0x000c20099c7e1663,0x00022bc262dc178f,0x0007637b0e504016,0x00000000369b06c0}, {0x000f17ee60495a0b,0x000a7d157c84b339,0x000bb639038f08dc,0x0009003f9520b62f,0x000b09ce5b14849e,0x000d43fd577216ca,0x0008f309528ae543,0x000a2be2944a7043,0x000000007bda2444}},
+{{0x000cab1b8c43aa95,0x000aa5e65c1c9e64,0x000d5702d9f15f92,0x0004728860acd9b9,0x0008d19b014e54ec,0x000874fa2b3f9a93,0x0008b6184fdf1055,0x000e15215f50bf84,0x00000000c0482259}, {0x0003b607cbfa2059,0x0006af85540084f5,0x00021d190ac85a70,0x0002e624ad075bc7,0x00087e78a338131c,0x000bdb42ae032d13,0x000c3f68cbc7bd3a,0x000e02462dc45962,0x000000001a1e0963}},
+{{0x000bcf0d926f10f0,0x000fefcf8bc7e992,0x000eec9bdf4a358d,0x0007b10b394f2515,0x0001a719a7421f03,0x000340bfedd3b47c,0x0002467971f16b9b,0x0002eeae68bc8f06,0x000000000ce79214}, {0x0001d301081d9e6a,0x0009523212e20ba2,0x000869a703c164ba,0x00029d3fdbe10838,0x000bfd83d832966a,0x000205a9991bbca4,0x0007beed05ad4e8d,0x0004e2b5898a4ced,0x000000009480842b}},
+{{0x000a7858ed190f00,0x0007ab5c62422359,0x0003137cc7eb4610,0x00086bef020dc143,0x000bed4594544db8,0x00077c40c30f92ef,0x0002af804f98a06c,0x000a69d65af0b2f6,0x00000000dae823e8}, {0x000ca647f867cef5,0x000d97d1a0777a0b,0x000f2e49b8ef19fa,0x00009ec853fb79fd,0x0004615ab397ba28,0x0003cc727d5d622e,0x0009b6b41b2c44b9,0x00088ca69d185f7b,0x0000000036b4bbad}},
+{{0x000bfa54b9a66b2c,0x0006e3784868fd16,0x000dc4a79421c138,0x000bbd69943fb751,0x000e2472f82e9808,0x000d62fbc73b7344,0x0001aa41e87629ce,0x000ff14cd9415082,0x00000000db1039bb}, {0x000fbdde60eed957,0x0000150cce76e285,0x000423a785bbbb6e,0x0008ad2cdb6e613a,0x00085a964998a148,0x000013e85b5ad6a1,0x0007fbb3e49d78de,0x000279ca5231bead,0x00000000b20c2ce2}},
+{{0x000b35e05089d1c2,0x0007afa155ffebe6,0x000ec78d766b33dc,0x000c6b933c2b3c3d,0x0000b7acc2580c0d,0x000c5f8389200fb6,0x0005a95e7b832d0f,0x000c39fadf747058,0x00000000ce78ba53}, {0x0004ef2dd7c53aa7,0x000434447824cb24,0x000b1b9c8e8229ff,0x0003c1a03710aa21,0x0007f25dc6220018,0x0001f79b4f5c1cab,0x000bdcc9d6c32d52,0x00028c1eb6e7dbc4,0x00000000bc325cb0}},
+{{0x000acea05b2d2275,0x0009d0ab1a3dd947,0x000978c1ecff1c8f,0x000b1b33f0b47fb6,0x00063d5c463ebaf2,0x000f10213a3fdaab,0x0009a0ab8f6a322b,0x000656a31b5b7460,0x00000000362da748}, {0x00043543ce922ec0,0x000ee55b403ab128,0x000716a9e9bc0620,0x000b7ad1fa7d910b,0x000a60c1c44ecd63,0x000e92409c888438,0x000465e09138e8fe,0x0006f4bf51ff0732,0x00000000a21ad691}},
+},
+{ /* slot=12 [{1,2,3,..,8} * 16^(2*12)] * G) */
+{{0x000aa2ca3970e9d9,0x00056f0152eed126,0x000d195e4447134c,0x000f3bb3b5e2c73c,0x000e568ff8177053,0x0000653199d1a3e0,0x000394d0eebd52f8,0x000bd6feffaa0eda,0x0000000067a85ed0}, {0x0001a869f6b5e581,0x000dc1421b31856a,0x0004b04532343f2c,0x0002107c7e588409,0x00075af84e2f50c8,0x00064183391ddff1,0x0001fdcc79c6b0f4,0x0005203e3acfe753,0x00000000d30e076e}},
+{{0x000d9a4154cd6a03,0x000c985b7e900aca,0x00076cdbf804912f,0x000a5d9072578fdb,0x000efafa352721c8,0x0002880a88aed950,0x00066c9eab167e0c,0x0007d760dd692ceb,0x00000000fb5804c1}, {0x000fb41f501342d5,0x000526b2e6757996,0x0003cf6fd4de197c,0x0003f790dcd6223e,0x000c79531d641583,0x00015c069230fb4c,0x000d860262bf3b17,0x00007c5ef36a3223,0x00000000543efc27}},
+{{0x000b58c1b7dbde21,0x000bf12bd13c711a,0x0007772bca3cb5ee,0x0003349f0e125f34,0x000e7b60018d7526,0x000b1f3743ea3310,0x00044739ddaf76b3,0x000d49b083260858,0x000000000e9b4ff3}, {0x000d71a7fa6187a2,0x000c58c81fa4f6e6,0x000d4d74769e9184,0x000f6abbe830a5ea,0x000ec5d72aa198c5,0x00096a177d4793a5,0x000a0e5b2f7c5965,0x000a5bd598b75d9f,0x00000000967ade9c}},
+{{0x000a4c5f4f4a71ef,0x0006c1bad5d07262,0x00026210d2ce8e25,0x00070bdb4a922d9c,0x000db71d37f6e4d4,0x000af0bb7dc5bf46,0x00089a91dc446e23,0x000a4cea0a2b7465,0x00000000b64937ae}, {0x0009f417c8dc2d7e,0x00034599013b0c66,0x000402e912e6c99d,0x00053ebab97cdd76,0x00053a566ecff9f7,0x0007f38503299369,0x00086cdd4bf06266,0x0001d95e04392e63,0x00000000a87768fb}},
+{{0x0005bef235bb685c,0x000cbc8df9423d4d,0x000f195e59aaf96c,0x0001b35fa5cfd8af,0x000eb3ca4a9376d1,0x000cdafe4e3fbbdd,0x00084d3b1431ab42,0x00005319b42fdb77,0x000000005007283b}, {0x0003e8ec407a6693,0x00053b83cf1709b1,0x00044064bf16506e,0x0005cfe4a533def4,0x00062042ecb0c482,0x0006db66c90b112a,0x0002024e20b81b6f,0x000059128b57eca3,0x000000005a2f8c2d}},
+{{0x000b7e4d307d8e53,0x00008537de913b0d,0x000846a4d727dbe9,0x000267f691eb5d86,0x000ddc0b921181c0,0x0004bc81c5769c11,0x000adf3c8b9a83b4,0x000e0aaea64e5e2b,0x000000000a0501a0}, {0x000b590188a40838,0x0008c06a1fdb9cb5,0x000de2fedafc3d52,0x00048ffd30da785f,0x0000b9c69efa3518,0x0001dee94992dc76,0x000d8686fb4e5aff,0x0001ea600f8e5312,0x0000000056187442}},
+{{0x00040d4f32090725,0x000d41cf77975d91,0x0002abb335746ddd,0x0002ffbd5ebafac8,0x00006d0f18ab3e77,0x0006a59beeaca047,0x000d6906cfb58f4b,0x0004fd3f412dead0,0x00000000fea0bae2}, {0x000cf3437dd57493,0x0000d67f13171495,0x0007106f145bbd2c,0x000a7f59b63e5d69,0x0004fede1952f6d9,0x0007d48a3eaffcf8,0x0003103d1aaf0c12,0x0001c674cd8fe036,0x000000008e7821c4}},
+{{0x000df8a1995f1564,0x000eb35a23620d4d,0x0003925ccc25feba,0x00059ce7f64aed1e,0x000de7e33116dc4a,0x0007d1416f186809,0x0002e28a1e8cf2ac,0x000ef711daf726f6,0x000000001ea051b6}, {0x000806ceec799093,0x0007897b80600dac,0x00000c199d3ef992,0x00095e5cbf5788cf,0x000f9a29ba0cee49,0x0005064c29fab71d,0x000accaa3b9bf873,0x000dcc62512c4883,0x000000000a516d72}},
+},
+{ /* slot=13 [{1,2,3,..,8} * 16^(2*13)] * G) */
+{{0x000d891784ba4051,0x0006c64105b7e686,0x0009b946c2c72c6a,0x000f77fdfc61c02d,0x0001fa382ac50707,0x0000fd34bbaa28df,0x000ae0d5c63ce649,0x000fb1514972d36e,0x00000000eb621c7e}, {0x0002f6214893cbf4,0x00097d66975e60c8,0x000025dcbc95dc4a,0x00038d7c7d0ddd0a,0x000b3f1198921557,0x0004fba3e8ae436b,0x000cf12aad37f835,0x0005af269736ca66,0x00000000bf6266ee}},
+{{0x00079959f980f5c2,0x000c56947bed6adb,0x00049e328d93011d,0x000dbdef2a917a4a,0x000d2c64f8280d31,0x000ca588e9220f8a,0x000bb0ff2a7d2c6c,0x000a3fb3e3574ed7,0x00000000b1a45c22}, {0x000cc06eb7419afa,0x000380cbb003fa56,0x00057bafea563dfc,0x0003e5e438069906,0x0002f24e0bb0d263,0x000c580e2a6f867d,0x000b3f6f57e476a7,0x000bc1b3cce2eaea,0x00000000ebc77cc6}},
+{{0x000608ae84c5ec7e,0x000053d983c63424,0x000220e234040e21,0x00044a8a11336a09,0x000c5cba1ef82321,0x00051614efafb3e8,0x0007444a5f73c1fb,0x00034625976f93de,0x00000000eaa85dd4}, {0x0003947a6e98f463,0x0007bff1601496d5,0x000a2ece246b2d3f,0x0008608afc0fc252,0x000ed11df7afc0b1,0x000dd677c46b2a59,0x00014acdb4eb7ae6,0x0009b01fa85ef810,0x00000000ea948aea}},
+{{0x00045565d137f2f0,0x000765dfe581fc3e,0x0001b96c530e4943,0x000620514a94d847,0x000af9a8ebd46445,0x0008186c519285a9,0x0002cf8a50eee2f9,0x0006622160736d50,0x00000000cdcc500c}, {0x000ca93a0a937718,0x0009b852e751c220,0x00013794ef5841a1,0x000d02eaab9bc83f,0x000e507aa1e72a19,0x0009c3e8dfa0399b,0x0006bf2cc25905d9,0x000c87b16bcba6ef,0x0000000086b6d491}},
+{{0x000301f2d1615838,0x000030c77102f8d5,0x000587ef676a4216,0x000a984e58fdfbf0,0x0004b2dae2937384,0x000b34a6a4bbd6f7,0x0001e4d5faca7d3f,0x000e8d83bca162b4,0x000000000fb65355}, {0x000a65b4557269a1,0x000d612e85d3c337,0x000e9eb417a65daa,0x0008347901f07aca,0x000c07660a1f4c95,0x0004339b0e5e207d,0x00071e3e96b7cef6,0x000d911868c982bd,0x000000003f015fc6}},
+{{0x0000debd98017c83,0x00020ab0e41c1109,0x000cece8ab45613f,0x000c38c3f3e3cbe5,0x00084ee4034a4ec0,0x0000f68bee0fdc14,0x0009287fdf88fa36,0x000340004e9fc410,0x0000000035068503}, {0x000fcf9dbb89964c,0x0001a55f54d0366c,0x0005037ed606e0e9,0x000dd452fabc5c43,0x00045857253127c4,0x00079d635543ecb5,0x0003c300434e2c9d,0x0009719274faa112,0x0000000030365d04}},
+{{0x00004614a7c3c6db,0x000dff6fd72bc912,0x000a7cdeca98fc71,0x000bd847433df664,0x00043d186da8e212,0x00032dd6ec77a9d6,0x000a6e619b128c74,0x00073530e4371c2e,0x00000000bdbe55f5}, {0x000d6cd52982aed1,0x0008769e6b9366e1,0x0008188239b527c0,0x0001c89631b8c708,0x000bcaaa604245e4,0x0007865ddc10e364,0x00031d981ffa27ec,0x000d3eb7ea07adca,0x000000008466d5fd}},
+{{0x00028a63733e1816,0x00024475fde8e34b,0x000836667884c015,0x000a991a3cade924,0x000ca8cf617e3424,0x00043c23e7b8893b,0x0008297e13fc74e6,0x000ebcebb18b232c,0x00000000f4ade61e}, {0x000d2250973bf51e,0x000fc8889002e2ea,0x00086c10bd62bbcb,0x0008d007a0902c3d,0x00088a1cd827489c,0x000695e3cd119945,0x0000bf722723fc62,0x00065a0d9521ff4c,0x000000009cb516cd}},
+},
+{ /* slot=14 [{1,2,3,..,8} * 16^(2*14)] * G) */
+{{0x00044cd687a3f8b1,0x000369b36db691ca,0x0009ba292a4895a2,0x00042e6cdad4dee8,0x000ad660e6b8c6d2,0x0005116caa131536,0x0007028028425ffe,0x000898e4f6e39843,0x00000000c84a72b2}, {0x0002c5899cee9f53,0x0000ce897df605c3,0x00063308ce238f8f,0x0004300a011a2c59,0x000edb5eb27513c0,0x000c3a25d00c4f17,0x00057db5ba315588,0x00015100755a406e,0x0000000053b6eb21}},
+{{0x000a76a7251e2a25,0x000cb16a6a2c8fea,0x000fb2e0c2203ae6,0x000b94e3ea985e4d,0x0003585a9c87dd1c,0x00001d936c7d1558,0x00082a405cab0403,0x00036d4d50ae05df,0x000000000b867da9}, {0x000fe3bda2af5c15,0x000c4d75a59342f9,0x000d49d8024cd350,0x00093cd71499db10,0x000697ccb2805d66,0x000d6d1ed5181be5,0x000f96969d6ae5a6,0x0004c251e78f3c6d,0x00000000b1e9d740}},
+{{0x000048a3e0706870,0x0005429185fb9de2,0x00011dc434cdda29,0x00038e61dbf2e4b8,0x00083c68b6d9e022,0x0003fce2b90f8778,0x00025c2f9da74f4b,0x000c85a617fde8e8,0x00000000367c3f0d}, {0x0005ca86c3d7c14b,0x0007721f80492069,0x000cc2704d5d964d,0x000e4a4b83948d4a,0x00075f86d8435c17,0x0008105ec9827fb6,0x000d9fbe9f6c1e00,0x0003e431fd594519,0x000000004aa68f9c}},
+{{0x00049d01e252735a,0x000603b8149bb734,0x0003c3eaec3afa4e,0x00082927e6869a2f,0x000d9f2285db7bd5,0x0006b393d5f006b8,0x0007b572d795772b,0x0003829fcf3e349d,0x00000000adf6c506}, {0x000c9e92cf5d73c4,0x000333e5df35b82c,0x0006ff3c4638edf4,0x000602c711e90afc,0x0006847fbad6d96c,0x000d074df237ac56,0x00038ad8055ec137,0x0003862c81df92fa,0x00000000f44eb56e}},
+{{0x0001f066556f72a8,0x000daaa1e3236a15,0x0006f422a845ff14,0x0009c0315172e48e,0x000c38eea4f8a56b,0x00095acc6214b46c,0x0006427220ffcd81,0x000764fa94378d70,0x000000005ee95292}, {0x000a382cc6e4c981,0x00063e8870fe05b6,0x0006bf145593b09f,0x000ff81bea9ea57b,0x00056e4cff3941ae,0x00074e706e126543,0x000b649e08b4395b,0x00035be4efb116ff,0x000000006ce29a6c}},
+{{0x0009285077aba89e,0x0002f1ecd3cb076e,0x000bc19f09963f0a,0x00091de0966bddae,0x0006678462efcb36,0x0002517cf6fa7f51,0x000b5486a29e23bb,0x0006d11d8ba73625,0x00000000956b9049}, {0x000b56849ba77e72,0x00057b8fec3acf38,0x000886e8a28a00f9,0x000a419e8d524998,0x000d8d90de2167f5,0x0003c4a43e0ae417,0x0009d622ca193073,0x000c9f444cdc0621,0x00000000a3f3f493}},
+{{0x000ed8c8ef0f084e,0x000bd82043618bbd,0x000b84a6b9bd0b7e,0x000442e11e86c258,0x0009bf18220ddaf8,0x0002813906bbcf3c,0x00048d8684a70b1b,0x00069777aa00265e,0x0000000034b7b995}, {0x000b2543eccc4227,0x000d2a7ef15a9afc,0x00060c0dcbb21293,0x000a59d1b10ccc82,0x0006a8c8c224310a,0x0009a16b49702b8d,0x000d0e22c3a500d5,0x00080dc43dad5354,0x0000000064e0aef9}},
+{{0x00047deb900ef3a7,0x0002c6ca0b30ab56,0x000cc4df6d6a62da,0x00046d9244fba1a7,0x00019898cdf476e4,0x0009cd84a0f0becc,0x00032f059e06a21d,0x0009f25e2f67e18d,0x00000000a2b30839}, {0x00096ec5ce9dcb04,0x0007e775f8eaa8f3,0x0009867605cee673,0x000638808ebea582,0x000aa58ef90b7916,0x0009e63f592edfda,0x0006a2680636e7c5,0x0007f78367f056be,0x000000005d7a3aed}},
+},
+{ /* slot=15 [{1,2,3,..,8} * 16^(2*15)] * G) */
+{{0x000d226375d9926e,0x000c5115d736c300,0x0001fe55ac95e8f9,0x0000bf870fada45e,0x000ca6d113194b02,0x000bf14bbcdf24f9,0x000f313acc50a1c6,0x000896e3c6c6193a,0x000000008d61400d}, {0x0003b575a6484cfd,0x00090e74470199dc,0x00051744acf51ed0,0x0000c6fe0add19d1,0x000bafdf75312456,0x000bab736842c5c3,0x0006dd204fa7e46d,0x0002c17907084302,0x00000000d627eb0f}},
+{{0x000a5ea3936a45a8,0x000c7efa9f6902ce,0x000c6d7067af0374,0x0001b85df9422f6e,0x000bd3bbdf26f5cb,0x0004f4e90cc3ed6a,0x0000013ff58adfee,0x000561fc91beafc4,0x000000004621ed7a}, {0x0001e249a6b89085,0x000442a518a08e15,0x000b0c7873032398,0x000ef32d1323f621,0x0005526a6d52ae2a,0x0009b10ec4a1c71f,0x000139bbe5f16408,0x00087a964040db1c,0x000000009723f33c}},
+{{0x0000b0530ed9267e,0x0009d21001b1f701,0x000ad090a9dd557e,0x000420172486b930,0x0004131225deee23,0x000a350fd901d65c,0x00026a625253b462,0x00050650d9f0ada6,0x00000000170c99e8}, {0x000284bd1691773c,0x00082139d84b6e0e,0x00001fba9f010dd3,0x0005a5c9bddded45,0x000e47c557fcf32c,0x000aea12102446b3,0x00019181cdcce7cf,0x0005913691f5fa4e,0x00000000dbc19497}},
+{{0x0000b5ceb34d86f1,0x00087e0b19c686cc,0x000dd0130169e2a7,0x000fc20bbbf825da,0x000cffd8fe7905c9,0x000d5f40af36bedc,0x000d8f58c81bac74,0x000fd443c3118c76,0x0000000070006ce0}, {0x0006e2affab7f9e9,0x0002a64f91c78160,0x000f1f732dd10323,0x0004a8d75e6c9a78,0x000169de45ceb5ad,0x0003f57bc212e21c,0x00076b65ed1d4c79,0x0003797a77af230c,0x00000000e0466631}},
+{{0x0007a7f757914770,0x000e225a35d4e0f4,0x000316b1563c211b,0x000560f6283fa113,0x000a347c2307b545,0x000c25ed8fb96f43,0x00037295ec126fa5,0x0000b9c8e74451c0,0x0000000095cf54c7}, {0x0006e17cd97da6ba,0x0003ccfd66c950fa,0x0001b78d624321a5,0x000e777e828163f6,0x000fc480b60b011c,0x000f3458b60b7fdc,0x000681f8b9b7eaf1,0x0000a4aa0065a47c,0x000000005c664e61}},
+{{0x00081b29da849ee4,0x00018d6a8c72fb1d,0x00015ed2d16a2c37,0x0006c75a972966e6,0x0002a5fa75b20629,0x000f4ff54d28dc66,0x000a9e39c5528f06,0x0005ee8412010e9d,0x0000000070884265}, {0x000cc8b6710793ae,0x00043b9a896e551d,0x0004a93cb064de3a,0x0000a287d06febf3,0x000446fe89d5dd56,0x000c3afee4d20c90,0x00004ea1f32ad48b,0x000d3fada5cdb4aa,0x000000009d89447a}},
+{{0x00013bef689752f5,0x000384823df4c8a1,0x00085cd2bda5a2c4,0x000d44b3b8dd947b,0x000a91b5ab2ac3e1,0x000e85115293208d,0x000802c08f3fbb62,0x000209f4c4219a55,0x0000000042d8ac0b}, {0x00069cc7114445f3,0x0008c64159e8bc97,0x00025c4c4a826fce,0x000d0a8e8a90424e,0x000f40160e2ed3b5,0x000c957868fd6f20,0x000ddf1245bff7c9,0x0002cd18ea182362,0x00000000ed494832}},
+{{0x00019dd8fce848c5,0x0008769ea75f389c,0x0006623468447d15,0x000afc0758e6ee5f,0x00081c677c205040,0x000588953a49ebbd,0x000d83ba9b1c700b,0x00069c28ce811562,0x000000009ad3ef64}, {0x0003ba55381ce23e,0x0004e3a501468421,0x000814cd79a42c20,0x00073dfa9e004166,0x000e6e68accb4491,0x0000f1ef43d791fe,0x00015d4300c63789,0x000d1946e3475cff,0x00000000da18c521}},
+},
+{ /* slot=16 [{1,2,3,..,8} * 16^(2*16)] * G) */
+{{0x000a458d386023bc,0x0003bf56da445d13,0x000e7653671c14e2,0x000812a76cf2d0e9,0x000e92d023cc1ff3,0x000e5ab71b97748d,0x00062460b9823f6b,0x0000a888e3fb8571,0x00000000c36e9b93}, {0x00038e251e9406fe,0x000c5fa863925fd9,0x000fbaa911b1df59,0x000ad694b172d603,0x00020e79b4ee0769,0x000aff2ecc49f9a2,0x000bbf1cae2a0169,0x000795b6ab667d24,0x00000000fc516d6a}},
+{{0x000cb32f48366ce7,0x000b3c206aced74b,0x0003f3f1b76411f4,0x00062fdf3306017f,0x000badc88511de25,0x0006aedab530327f,0x00024866a27ab4a9,0x000930f605d0a889,0x0000000094f40f14}, {0x00083c5ee4ef5776,0x0001bd3d32cf90d5,0x00022308dee04679,0x0006870a28dcc521,0x000bde776d606ddf,0x00097daa58805143,0x000ae50911f82e32,0x00056ac5672c0e33,0x00000000ecc996a6}},
+{{0x0000ec149bcd3143,0x00001e72a871f035,0x00001cce8f7fe7b5,0x0005e8f24818c0e9,0x0008e6082bb11f7d,0x000d1d967bcf5f8e,0x00092634ac95cea8,0x00067a3ab09a5e66,0x000000002387fadf}, {0x000a8907771f026f,0x000b526dcc7e2696,0x00014ff33eb91c40,0x00011adb8280471d,0x0005de2f9e50e756,0x00094bbc30ad93cb,0x000f2081580c6288,0x0003cb9c1236df6b,0x00000000abb43af3}},
+{{0x0004ad442d1399cf,0x000821c3ffc5bf02,0x0007d4e855dc236c,0x000fb0b8412db506,0x0004e03b39cbf4b2,0x000010a7319ee38f,0x0002f9a70ebd48d8,0x0007ad9427817ed6,0x00000000e5ae8be8}, {0x0009bf363478698b,0x000b123f22aaadef,0x00015dee99036d3d,0x000841de845b3c31,0x00078c83ad6db142,0x000f8f68f2aa36ce,0x000cb4ae07d83bae,0x0005554f9f87fa52,0x00000000a75fec3a}},
+{{0x0001c27c9c0a8320,0x00028ec8f15a54bd,0x0008c4393933e000,0x000ef9b09519b8cb,0x00090ba29b8ac409,0x000ff6fa6fa43b9e,0x00032bf905de792e,0x000c5e0ddff0808b,0x000000000ef0c740}, {0x000583cfcf2af083,0x000f97dc1636692b,0x000ac7349c15dfa7,0x000dfb695d478ca1,0x00078deed7aafbbe,0x0009c192b0db52b7,0x000e0baf116507d0,0x0007af790ffe1a42,0x00000000dab15e5b}},
+{{0x0008e6c6a785aef1,0x0008a96c9d1b36d4,0x0000e01cab507e0d,0x000306583352cb0f,0x000200e0be83478f,0x000df547e2ce30a5,0x0000f3a095c9b15e,0x0007755e26659b53,0x000000006688f6fc}, {0x0005052ec32fae44,0x000f350695143db5,0x0005ce3dee295a6b,0x0006414977be9241,0x000ec0b97749a0b5,0x0007b11471a6f415,0x000777116368bdb7,0x000ce925e511d7d3,0x000000003b47b66f}},
+{{0x0003a24926ab7e18,0x000bc668d282ef8c,0x00003d620701acc9,0x0005b00870f77487,0x0006235fd43e6c33,0x0003db3746744ea7,0x000b535c564b3c26,0x0005fa7166df2807,0x0000000083602b44}, {0x000ddeb17d2c4433,0x0009a8e775c49c24,0x000ce70bd673232e,0x0005dc40f915b66c,0x000f682152095005,0x0003790c6de85130,0x000bf95e80ae4b60,0x0008f0b76f962760,0x000000004494bf7a}},
+{{0x000753d09a87a681,0x0000bcffb7f7c73d,0x000dd7581b834bc5,0x0004faa3df5117c0,0x0006d639822a0752,0x000268a46bb73517,0x000baff5761abb23,0x00086cab033800e4,0x000000007b96b56d}, {0x0002c4ebae014181,0x00056bcb5b016f7f,0x000981f2b04b773a,0x0001d4fb98d8f29e,0x000c4fe861a45f19,0x00081160cd60017a,0x000ce52fec0fba35,0x000cc8a0f511164a,0x00000000022eb8a3}},
+},
+{ /* slot=17 [{1,2,3,..,8} * 16^(2*17)] * G) */
+{{0x000c496c2149a1e6,0x0003756dcf10c52c,0x000193e9f2961119,0x0002cc63dfcb3293,0x000eb93c893a2450,0x00021034370130e3,0x000dcb21325d08e4,0x00019e88e0235cd7,0x000000000bfd8bef}, {0x000de59a1313618d,0x000ff9a350ce9277,0x000784f732a38381,0x0004c627213c2f7d,0x000106d95c19a53c,0x0000ddda69b0a90c,0x000be8113757a227,0x0002a927c57795da,0x0000000095244017}},
+{{0x0009ec73e881c461,0x000dffc891393d5a,0x000607f142718dc8,0x0009e0144b450da4,0x000979449c0daf40,0x0003b4dc4e232eec,0x000b47a73813521a,0x0005a1f06525f793,0x00000000aa14a28d}, {0x000ab40d13603144,0x000a92ca6faad7d7,0x00077c46a2243022,0x000668a56001ba53,0x000de0556784099c,0x0007f0da35c31210,0x0008e7f9d1173ed5,0x000db0a5fd417a7c,0x000000004fc677ec}},
+{{0x000f362753fab530,0x00036aa82b486d55,0x000cb31192b99b79,0x00023088da5238fb,0x000d6a0f13dce4f2,0x0005321e243025fe,0x0009555e29a68664,0x0009302c1d0ea939,0x000000009a412518}, {0x00040aa270ecf16d,0x00025705d2dcc8a3,0x0000815a7dad4056,0x0003ddd62ef6eae0,0x000c756c87712c0f,0x000a916bc88396cb,0x000b7cc412da2a0a,0x0006c4797705b87b,0x00000000e6662748}},
+{{0x000b798a1d9f14bf,0x0004875fc6b68e3d,0x0004e6fc57110cb3,0x000321ff00ddc8ae,0x000a2fb5ca480e21,0x00032f61c1392a31,0x00053dc9be21877f,0x0000c07d766d4c82,0x000000007935e987}, {0x0009c0d0d743ba87,0x000b4c7ea53e2d36,0x0006cbf492abc6ac,0x0000efd3c18f7e69,0x000ba5b67a89412d,0x0008eab12b43f789,0x0008e2f965efbd5f,0x000e7c82adccc665,0x0000000091278382}},
+{{0x0004d49e246654f9,0x000d938670576e65,0x0002e3c27aa3e84d,0x00065334c7eaf50e,0x000552bf2d4a4f58,0x00098000a796d49e,0x000e3bd094e0a797,0x0009193ab578ccb9,0x00000000b4b119a6}, {0x0009e9dcf1ba1a47,0x00093d45b6818775,0x00046f67b129602c,0x0000f75f19067fa1,0x0002b2c389626b77,0x000a83320cec06e1,0x000aa9251c077bc1,0x000236ad6a93962d,0x000000008ad0c824}},
+{{0x000eb6d7ddad6786,0x000ae008c97efbef,0x0007055ead5e0a78,0x00064be3c2bab0f0,0x00056fbc70490081,0x000c829a563847ca,0x00092f06ed644f82,0x0005edc33cf1596a,0x00000000ae507801}, {0x000b35aad6917951,0x000211cb85ed9bee,0x000b7eeabf7fdf01,0x000d065ee30e4bf7,0x000787e7dba1596e,0x0002b3cdcd297fcd,0x000ea50ec834d321,0x0006428223a02a42,0x000000001ebeef6c}},
+{{0x0000ca2aa1ced691,0x0003b6c228185fdc,0x0005ac8746580edf,0x000fe57a07c75b80,0x0005dbaaaba6aa6f,0x00086a79bb8f38bf,0x0009376c006d330d,0x0004c2802ad2ab30,0x000000004cd779ca}, {0x00065bd45c18fba4,0x0000827bda98f28b,0x0000cf363c9bd063,0x000e978f802e28f0,0x000e30cc6df27a27,0x000d4b64b9a835d6,0x000278f03bc4f019,0x0009ce860dd11fb8,0x0000000022f94ba4}},
+{{0x000d151598aa99eb,0x000898bbcc8c01e3,0x000e26d1d284fac7,0x0005499fe54a7f97,0x00083a56fff81bdd,0x000a61179efa3254,0x0007166cb0013229,0x0006df7aa5b7e434,0x0000000069b8ad29}, {0x0009a4b30cf9b9a0,0x0000e7b587e69ff9,0x0002c35d16c302c7,0x000bb3ccbd21f330,0x000760b34aed22f0,0x000ef47f90357b41,0x000071d1cf461771,0x00081817527a7c89,0x0000000061ebfae6}},
+},
+{ /* slot=18 [{1,2,3,..,8} * 16^(2*18)] * G) */
+{{0x00035d5c213c7c65,0x00050330e8c4be84,0x0009c4f8bad526e2,0x00079b3f9a140df0,0x000f6a0f12eb2f67,0x0001774db421e92c,0x000c70c612943c75,0x0006e126640ca08c,0x00000000002f806d}, {0x0002fb7fcf42ee60,0x00053b6f013eaec7,0x0006dc1e7baba595,0x00052434179bc731,0x000dcde619b0694d,0x00013083a083fd5d,0x0008d5e1ac5ec436,0x000d5d8acd74472e,0x00000000e6dd7522}},
+{{0x0002183914266a76,0x00050f21d9c749ab,0x000b11e1ede13484,0x000307501732b69c,0x0003b2f37e2fe88f,0x000c51a680358ebb,0x00083dd055334567,0x000d3a283fde13de,0x000000004e90731c}, {0x0007255e8c92a43c,0x000b426b98857ba4,0x0001375eba8aa19f,0x00004f1b3bb19014,0x000e51a20f34747b,0x000cb860563abcd0,0x00065149a7ccb163,0x000ed0226549eeac,0x00000000e77eb0e2}},
+{{0x00049f0d4cef900e,0x00029350e2cc9bbd,0x00087dbd6e2c73a8,0x00055a01ae000b90,0x0004c1edc6f326a7,0x0008fd45f8368f73,0x00018f41536d0965,0x000f021f021f7d1c,0x0000000081cb472c}, {0x0004d96cabba8bee,0x0008b9bcb5cc9363,0x000b955cd5aa9dcb,0x000cd5759b55798a,0x00068ea5fe2960a6,0x0008549da89af6a3,0x00046d27f6245bca,0x0002bafa40e7fda0,0x00000000347c57c0}},
+{{0x00020d2022f2649d,0x0008d0cccfa64811,0x000bb667be94c81a,0x0003de5e11014e39,0x0004b4eafae87726,0x00003c14aa6b02eb,0x000179b610badaef,0x000e9a715cc99897,0x000000005bc549dd}, {0x000c226ec0caaec9,0x0004470f749e4c10,0x000c7375a432a360,0x0006a7301f31b680,0x000e69dafa63670f,0x000f9954abdf714b,0x000d1e19efb64d1b,0x000c7bb1ba60660f,0x000000000559972e}},
+{{0x000b1d3208478c9c,0x000c323ec801e29a,0x000afcb435835a5f,0x000f35787cec0983,0x0007853a00053553,0x000a2cd120e0f714,0x0004bef48964bcde,0x00003e194d23fb0b,0x000000000c82d274}, {0x0005bdf38cda0aaf,0x0005b6b62c33ccaa,0x0004b16fa58a0439,0x000fe7630f0af804,0x000ed2adab930e2b,0x000189b8a7ef5c8e,0x0009306b247f4ab2,0x0003a06e9261e146,0x00000000f49ef122}},
+{{0x000817a32a9df8cf,0x000f9eedfea32225,0x000ff47ac2e72b68,0x0004dbcbdb4c75a8,0x00021fd98d4bf0e6,0x000ce7c12897eaba,0x000dfdfa201259c1,0x00006ff4fa70dddb,0x00000000258d4044}, {0x0001d0da03f02d93,0x000b50b6f1b5f060,0x000c5ea02083547e,0x0007ff8b111816dc,0x000b283718f5fbf2,0x000f94fc2b50dd3f,0x000e5c652b00cc07,0x00063fc655815123,0x000000001d2d83e0}},
+{{0x00067fa0e1f42cc7,0x0000dd081e2afdc6,0x0008ebee03fb1c16,0x00040b3b9a389a25,0x00029b3a1228d742,0x0004f7a7468504d1,0x000a8d7ef2a0d1fa,0x000111425e9f19a1,0x0000000097e81fbb}, {0x000d8782f6eabda2,0x000bb95af9477c09,0x000616a434af972a,0x000102834bc8a70d,0x000dfa96ccc2dcf8,0x00034b6b3334fdb9,0x0005fd8002d73f54,0x000adce5f1aa13a7,0x0000000039f31de5}},
+{{0x0005ed1b819159f0,0x0000efb381e66447,0x00093681ad43ebb1,0x0002248e354d6c6b,0x0003bb063f8d3d1e,0x000028844c58fae0,0x00090a8d212b67e3,0x000b9dc5fdece995,0x00000000be78d443}, {0x0007b87b6d4689cb,0x000e4d37675ae4bc,0x000b1e6d59c604ff,0x000b51817514be0b,0x000d216d236fc969,0x0000e9a6b3ff76e2,0x0009db8c460f17c9,0x000f4a0c1e10b8e8,0x000000002cf0f0a8}},
+},
+{ /* slot=19 [{1,2,3,..,8} * 16^(2*19)] * G) */
+{{0x00021b5a158af00c,0x00048be78b546a53,0x00031686f98f0ac4,0x000fbe040cb3d250,0x00014cf5c6d58628,0x00004acc80bc1510,0x000f99d2e05b58d0,0x0000e18e43ef88fa,0x000000007cc13a27}, {0x000a34a3f2676994,0x0008f3c8304fb46c,0x000c2e5d354d96eb,0x00034a6ee75cee0e,0x000c0d69f97dc019,0x000e9af3d0dcbf6b,0x000a2275986bd31c,0x000bae91d221032a,0x00000000e369863a}},
+{{0x000673a060bd93d9,0x000a567efd97f67b,0x000acf5e53736c79,0x0009ce7c22834f69,0x000ffd7dea1b0adc,0x000be3241fb41ed4,0x00041944beac9185,0x00065fb45b125a24,0x000000002f71947a}, {0x000e089b5737d32f,0x000a5d1fd2ccf3a7,0x000cddbd06518b21,0x000d424fc7b9a1c3,0x000d593b18651262,0x000207bb3285afe8,0x000ff9b1293e604f,0x0004e4d6a690fbff,0x00000000ea70cb76}},
+{{0x00010135ba6ecc90,0x000c67618b47cb7b,0x000671fac2349ef2,0x00006a4a94ba60f6,0x000d9b3309f2be17,0x00030140ca7e45a4,0x0006a9fe792a8942,0x0002b32f3dc111ef,0x00000000ae90a054}, {0x0000a079c84a09da,0x0004fe61e1e17bfd,0x0000c33c8dbfacd8,0x0003a2cb253142cf,0x00094a315e3702ff,0x0002e5f28bab730c,0x0002e969eb28f1b3,0x00078104ccef53bf,0x0000000008da29e9}},
+{{0x000e69c94991da2c,0x0008169882fdb778,0x000bb0c1026efb5e,0x0009c58e8c70a083,0x000e3fde740ff47e,0x000b22de85c624c9,0x000e99b3712ac183,0x00053b66f49dde83,0x00000000e9be2dd4}, {0x0002fc49ae8e2d9e,0x000d2f5e113338a3,0x00004f6635e2a7c2,0x000ec728281b767d,0x00022e4c99ee216c,0x0008574aea943f36,0x000a644b956374a2,0x000b891eb65f5d59,0x000000009a785916}},
+{{0x000fc82e26cb1197,0x0007b99e1c0f0d5b,0x000b9d22a6f23e06,0x0003d07517726634,0x000a0483631f0685,0x000a357ef88667c8,0x00020778a0b97d9c,0x000723351ba51225,0x00000000db16be93}, {0x0001b71fd161e222,0x0004d233a2ab0174,0x00073d5fc232b577,0x000c26307f3c4c2a,0x0007c7fa11e735ed,0x000edf8b8c756940,0x000cd480aaa24015,0x00059f64fe61c4c2,0x0000000081b5d307}},
+{{0x0004902a51f0d7c9,0x00095d40d2540c8d,0x000119403d8292f5,0x000da233c63ea2a2,0x00072a4251b4a1de,0x00050b04bda93a5b,0x0005f42b073829ae,0x000d588db375ecec,0x0000000014efa038}, {0x0000ee6afa6c7ff6,0x0005d08e14ea3ca7,0x0005508b74eb9c04,0x000bdd7b082cb155,0x000132c2f1bc61f2,0x00048a1d4b829726,0x00098305f66fed82,0x00097664abe0e468,0x000000003b549a79}},
+{{0x000ba09c67ce7ace,0x00002bbd5f3ad59b,0x0007823313d1af0e,0x000a0938b99afde9,0x000539b5b8f32ce5,0x0009ccaedff73da7,0x000e17683c74505a,0x000db6ee71748714,0x000000002a047133}, {0x0006cddf55ec9717,0x0004a939ce612e11,0x000bd40876bbab91,0x00020292bc86063d,0x000374c2d2f03f35,0x000bb3778d8f5261,0x0004c0172debb779,0x000e59b7e7d429c4,0x00000000480178b0}},
+{{0x000ff6ff9a6ce15a,0x000f02241945b843,0x000815c692ddd20a,0x000b40be164658c6,0x000707bf58ef946b,0x0004b1b7f1f4dccb,0x00086c0c3e7ed78e,0x000f04f88ae52c9a,0x000000003c56ce9c}, {0x000d0c64225376b8,0x000acb0e2a542836,0x000dbccefe99243e,0x000e4b480a15865a,0x000aa9bed38d97ed,0x000b566179c32958,0x00048943df260236,0x0004cf5e4dd8dc5c,0x00000000920fdf67}},
+},
+{ /* slot=20 [{1,2,3,..,8} * 16^(2*20)] * G) */
+{{0x000ca71f43825739,0x0006d240e1d45696,0x00040e6e560b093f,0x000f89e33c80310e,0x000feef275e06d0c,0x000647621f18f8cc,0x0004098f4aee3c6c,0x00044e6d8d9eca2a,0x00000000f38fc971}, {0x000c43e079efd41a,0x000ed33a7393489f,0x0007d7112e309187,0x000ca29823eac951,0x000e00c5321632e6,0x000e376027b2414c,0x000ea9cbfee3838f,0x000c073c7244408b,0x000000000b92dd1a}},
+{{0x0004f2027c01b91a,0x000c2ded4e2d5b5e,0x00068f244ae3dd93,0x0002c819aae17dba,0x00034c8b4a900b30,0x00015e80a55ebf29,0x000d52e9a376459e,0x000fc0c15ed0c87f,0x0000000021fa9ec6}, {0x0005377119671e69,0x000986f6be40b720,0x0003f1d82a155dc1,0x000ef9fd33e14200,0x000ec68c1b4d10a7,0x0007782675b863b3,0x000f5b6b163657f0,0x00045ec56fe6b011,0x0000000095276405}},
+{{0x00025c999f907386,0x000babfcd8cb03fa,0x0008b39ffe32ed2a,0x000fa48259a4fdf9,0x00039aec4b93eaf5,0x00009841554f4953,0x00016f6d5f3ed332,0x00009354bbcce14f,0x00000000f59522ab}, {0x000774344536fe02,0x000dc0ab9887e18f,0x000ff9b511fad397,0x000245ce55048aeb,0x000b5d7fde1efb2d,0x000b79470129f95e,0x000a225c2c43420b,0x000651ce3dd7d502,0x00000000a80acf49}},
+{{0x000eb47f569406df,0x00013d679b209e9f,0x000eceab853725b8,0x000aa97262bb7995,0x000ed273f41e278a,0x00099f1e3195bf06,0x000c5b3dc565aaa8,0x000622af06423a88,0x000000003eaa84c8}, {0x0005f29956173fdd,0x000e2a6e4f299e85,0x0002bfc376f0231e,0x0009a96e1b8ca996,0x0003a8d2773c9f94,0x00015df5c50d38e0,0x0006f830ac4b12cb,0x000cc4c17f7a184b,0x000000001bd06c22}},
+{{0x0002b47351fb5da8,0x0000df69d86728bf,0x00051cb47eaf5eaa,0x000b93db4cd1826d,0x0000b685de4dd6bb,0x0002f14fbd6acc62,0x0008c195ee64c88c,0x0005b10fae1d1c9e,0x000000002d1d1d48}, {0x000858ab6149b3df,0x000997d79e38dc54,0x0004d37fc8c39e71,0x000cca9d3d5adb3b,0x000a04b87c97d6a0,0x0003fcb18a616cef,0x0006640e780b1f59,0x0009d3dacd79cfd9,0x00000000c35bbac9}},
+{{0x00057ca588a46c95,0x000becc5fab51507,0x000ee123b38f168b,0x0009e5a9e46c05c9,0x000b807d42c0ac9a,0x0004aaddd9e955ed,0x000c41afb2596ef5,0x0004617b996e7810,0x00000000daa0d561}, {0x0008680649bbcafe,0x0007ffbefee0e68b,0x0008f52bcbb568fd,0x000d07b3c20fbdf3,0x000c61d9f0bda8d2,0x0007890b0aee485d,0x0005f0e442fc358a,0x000e7e0ed4e6c774,0x000000003eeac8fd}},
+{{0x0006649735e9b588,0x000905fea3ed9e1f,0x000723574975b171,0x000aeb789b08b55c,0x000d85fdb89b2047,0x000752243c7493cf,0x0006085a6951c42f,0x0006c3164aab6f2c,0x00000000f41d06a8}, {0x000ffde6b1e3bfc8,0x000e9f356ef4ee0e,0x000bd6c593fabf80,0x00061b6c59268443,0x000e943a5ee4b420,0x000b4ffec4fce45f,0x000faa8aa9f21633,0x00058dd440d41cd3,0x0000000024944fb0}},
+{{0x00095de8bb934d39,0x000f8b620b642bb9,0x000aa322cd81fd16,0x00044c31195f9ea4,0x00025e0de2717793,0x00017be740c9c653,0x000adfc4ee5fa3fe,0x000c02055b9a0288,0x00000000fbf21c5e}, {0x000627b1e54a0e54,0x000089478fb39979,0x0002528804db1aff,0x00042758a5bd6961,0x000f1d7b4f0b823f,0x000358c32ec2f16c,0x00069186bde0e5a0,0x00021e4607f6658d,0x0000000019a0eb21}},
+},
+{ /* slot=21 [{1,2,3,..,8} * 16^(2*21)] * G) */
+{{0x00034be980cd2c16,0x00012687b13840f7,0x00075ded4f279bd7,0x00012f3708777329,0x000ea7b9ade512f6,0x0001f67d629a69dc,0x00011ec7f50cf374,0x0005650bf148056f,0x00000000e4508842}, {0x0009a0b73907d4a9,0x000085566992d3ff,0x00052acd8671a361,0x00059e518d0ccc04,0x0009efbd5e9af666,0x0006457323603695,0x00064320a0efb411,0x000ef53de5a856f6,0x000000009ff17bb0}},
+{{0x000cc590c452e7b1,0x00062f79453d2230,0x000c88540dcab7f2,0x000e21e1c7e77d22,0x00075ac6edb686c1,0x000dce0b313b0692,0x0003ae1b89c804e4,0x0007e383bd60d39d,0x0000000056c68504}, {0x0001f36efb7bccad,0x000e05711c111d97,0x0008e5221db09906,0x0009dbc1b1059106,0x000a1343e1616afa,0x000df68b34d2089e,0x0009550ff4ae027a,0x000194d6bec58c5c,0x00000000b8f81899}},
+{{0x000945bc5b8c1e47,0x0002c084ff3b92cd,0x00026e4e5d93ff42,0x0003cb77e16ab6eb,0x000eff42d87b6299,0x000bf1a18ef9e998,0x00091ad8a2a6f0db,0x000caa1ed8dd8fb3,0x00000000fd591f74}, {0x0009b1a415c48410,0x000b0b393939d628,0x000adc932404e915,0x0004f2f6f4c62c4a,0x0003c84dc50eaa5f,0x00093dbe87f03497,0x0004225e92a2fe20,0x000b532338abd9fe,0x00000000cb3364a6}},
+{{0x000db07636346134,0x000c217356793759,0x00026d6436573e78,0x0007a924ec5827d3,0x000e623d6f84a240,0x000920b5620c7f63,0x000144fce3d23b6b,0x0001d801ca407ffe,0x00000000a3c3a012}, {0x0007a392d73ff169,0x0009c7eb9df901fb,0x000054cf4c59c0fb,0x000fc30d43f8aa44,0x000f5dd8d278c5db,0x0007499c16a577c8,0x000cdcd8e1755511,0x0006faf9863e1216,0x00000000ce49bcd4}},
+{{0x00048fa2afbb46ab,0x000733de16ab805d,0x000ba9bae9a2546f,0x000326e5096f0b7a,0x0007cf60db0603aa,0x0004024a82b4b92c,0x000568c4b25d374a,0x000a5a4fda45db2a,0x00000000f4912124}, {0x0002e45118beb7e0,0x000ad8f9d06fe6f5,0x000e5f3d4e232b56,0x0006b61d5be371ad,0x000b7a9cfd83a7c3,0x0002675f53d52809,0x000ade5944a2608b,0x000f944906e73880,0x00000000012ca206}},
+{{0x000ef4fac56c062a,0x0009471066c5aec2,0x0001bc602e5d1396,0x000fec0ef350c452,0x000e70fd6f62c172,0x000d396bd8b88087,0x0001e774939161a6,0x0006f6e24c4bf907,0x0000000090ee7dab}, {0x000d47c276f22e2d,0x0009e1744923ad3b,0x000edec14d80b50f,0x000041356a55e4d7,0x000d0807e7fa58c3,0x000aeda3a971fe33,0x000cb08c0e346b84,0x000e83dc0ec89e36,0x00000000f52551fd}},
+{{0x00057d4aae95ce63,0x0004756c4dbcd617,0x0001f4fb9e40b9e9,0x000650dcaa15fea6,0x000262c18116c417,0x0009e951d75734b8,0x0005bea8d1bc25a2,0x000a6f9c3d1c5c5b,0x0000000084bcbc03}, {0x00039def16dd3429,0x00036757fa4424a3,0x00065e9ec59d5da9,0x00040331d61701bd,0x0003b513f8a9992c,0x00059095ba7ebfad,0x000c7a5e0f1062e9,0x0009af5a092f7005,0x000000004c8607ad}},
+{{0x000765afee23dc7e,0x000da07f6ceeebc3,0x000020ebf2d14473,0x000a28c4a7a12143,0x0009ac622c70b565,0x00008a23ee4bff41,0x000ef9a434359b32,0x0003a486f002286c,0x0000000068bce554}, {0x0006a5a9e468f2cd,0x000f483ffd2618d8,0x000068ef151b2be0,0x000b3fd0e610158e,0x000bcecf2e420759,0x000f5619491307e5,0x000fcfb5388e0c05,0x00062b12c916fa7d,0x0000000085ce7ad0}},
+},
+{ /* slot=22 [{1,2,3,..,8} * 16^(2*22)] * G) */
+{{0x0007b82d9ac31192,0x0001a18233af9d32,0x000832a39ec5dbc9,0x000a277877867c41,0x000cb8b37724b9d8,0x0007bc984f7ae4ca,0x000eb37332bdc06f,0x00035eee81841469,0x0000000017100285}, {0x00018610a76d61dc,0x000d8e68b387c33a,0x000be8f9388e5873,0x000ab7ca2eeac432,0x0006d566d6b92df5,0x0005fd6771f2f640,0x000afade3a436b20,0x000aacd204d0d19c,0x00000000274dc883}},
+{{0x0006662f300d582e,0x0005545797d6f02b,0x000d493c59863a95,0x000418d9643bc6c6,0x0001ed3dc569340b,0x000d5120c8dcbd3e,0x000058248fa91e1d,0x000bc7ffd794da59,0x000000002fe3b102}, {0x0004296e3c44535d,0x00018cd358e0b6fb,0x000f910ece75caa6,0x000d95229a15f47b,0x000c0c293dfbe28a,0x000a3cb62ac69bf5,0x000d7b5ce3eef493,0x000f697e6696c525,0x0000000084f7859f}},
+{{0x0001fb26d37e4737,0x0006a44ebc8fd537,0x00068636e52b01a6,0x000238be5e4041e3,0x0008ccd3777ccade,0x000e3247530342ad,0x0004e1dee7231055,0x0004496ad458a16b,0x0000000014021385}, {0x000df632d08800a8,0x000f850ce15bbfba,0x000d90d69c30fda0,0x0007de1ec77f2662,0x000877fec9100a75,0x000ce0fc47e77359,0x00022e379d16c18d,0x0002e65d66b9e51a,0x00000000d382d04e}},
+{{0x0007bb73f80b82e9,0x000c71c0f1c20366,0x0000a0ff65774f77,0x0000b35c7de1c483,0x00091b9154748ffb,0x000c24a7da225731,0x000aa8e70cd5ee06,0x0006317a53a26229,0x000000005845b00c}, {0x000406367e7e8010,0x0000fd1e5a4cdf40,0x0007af753d2af93a,0x0004cc7a29aa27b6,0x00073abcb1dfe57f,0x00051cf48e91ab78,0x0003012eab583689,0x0004823a8f8f9df8,0x000000004f85b4ca}},
+{{0x000b59e74e4d94ef,0x0007c62ba3cd9cd3,0x000a5a01302c7973,0x0000bf5699128211,0x000400e95658ca61,0x0002a77251d6d0a0,0x000385b0a310fbf6,0x0000563b089d1588,0x000000009eeca823}, {0x0001625a869daff3,0x000092a747284ad6,0x00060f4e3ec1f338,0x0004faf90259b208,0x000925387205256a,0x000d90ea8eb78428,0x0001a229e50aafe7,0x000d6b92c20f7c81,0x0000000056b83247}},
+{{0x0009f70d1d24b87f,0x000baaf70ca11135,0x000572101599c0cd,0x000c9491aeeaa742,0x000b77206f32e3dd,0x000e2465aa52c922,0x000ce93390ced038,0x0001ef4f0c2e3762,0x00000000217c2f04}, {0x000855bb7e8496d5,0x000fb73b812c77c4,0x000a9111225bfb2b,0x000c0931ac964380,0x0004cc92cfe355cd,0x0003fa62fb31db03,0x0005253642a70530,0x0007c975f132318d,0x0000000018c02a2e}},
+{{0x0009c72ef3f0a60a,0x00097026132d73e6,0x000c6559c1a4ac9a,0x0009e13d33fec9a5,0x000650b2b3a39d7f,0x00047623eddb2472,0x00013eba4ca9b3cc,0x0001c6a6a617f28e,0x0000000000ef4f01}, {0x0002c934d39f224f,0x000489ba9df9ef79,0x000c289cc5e6d678,0x0004671ce711d714,0x0003b37d0ba7f18b,0x0000acf6509897b7,0x0005685839c1e24c,0x000fa04a8cece368,0x00000000d9769014}},
+{{0x000d053bf908bd1d,0x0002665f9229e0a3,0x00083657180fc7d1,0x000e4f01886aa685,0x0001fb0e7ef2d5a6,0x0003f7d3d3a1625f,0x0001b9d9579761a4,0x0008414569dec1b9,0x000000008c4e35d9}, {0x0009c4e23de6ba34,0x0007e86b69307f31,0x0008b5b5310ad2ee,0x000759e953166476,0x0003c09cffede510,0x000be576c7244707,0x00074a003f48b245,0x000518c18cc1c0fd,0x000000009c6abc45}},
+},
+{ /* slot=23 [{1,2,3,..,8} * 16^(2*23)] * G) */
+{{0x0001f4be398f547e,0x000de5a0d453c02d,0x0004cca0aa5a9f03,0x0003cdeadf8eea62,0x000416bec0b446b7,0x000d604bee23762c,0x00034f1ec3f9f831,0x000a85a13f6cba29,0x00000000711b00ca}, {0x000f5b4ff8860c8d,0x0007920428978859,0x0003e87073818bea,0x00078e5f2286efc2,0x000d28e957c92224,0x0009e4638373bb55,0x000206781172bbc6,0x000e0668cb209068,0x000000000935817b}},
+{{0x00068fe0a57ea5ce,0x000bff8f977da4bb,0x000d5632970dd20d,0x000eed1e607586f6,0x000c8633b044ced6,0x00074c08262e428e,0x000b381f10fc1c39,0x0000388333ea4e50,0x000000009e1696cf}, {0x0009b18ace66f143,0x00086da370d0f2c3,0x0004d407fde7b0d3,0x00064677cbc78767,0x000f5c71a3e20301,0x00032bac2a19a119,0x00072516cb6c7acc,0x000eeb395815f291,0x00000000f396a90f}},
+{{0x00047d03aafa7ada,0x0001cf21393904fb,0x00069e44d1724ccb,0x0001bdbfdd9eecec,0x000496c18421a5f7,0x000d9117001c6b6e,0x000d603f25c0d8bd,0x00092772abc0d01b,0x00000000500934bb}, {0x000abd89e31ccb6b,0x000489470e4fde8a,0x0003f3dccaeeaaf3,0x000f7bb160143e67,0x000989d877cde4d4,0x000ecf15b758c4b1,0x000f09a493656d3c,0x000bf81b284e9b37,0x000000006e3d8c24}},
+{{0x000594f1bb798d12,0x000e37135bfa3d56,0x0005d81fcbf87f13,0x000b434b34773710,0x000e108c0e2a2391,0x0001b2737a4d49b6,0x0000ec6c25c5f399,0x0004886b45f6c7e2,0x00000000cc53c52f}, {0x00046bbe0b9b83e2,0x00045e1b4978be0d,0x000b105f1cc49db7,0x0009bb18c681b5e7,0x00067da77450e1d4,0x0008f6dc6336ef2c,0x000c0098863e670a,0x0007b3e743b46412,0x000000009b84536c}},
+{{0x000db87d8ce37264,0x00056430a4553d2a,0x0000bb820d288481,0x0009a4981462dad4,0x00022c99e18dbe94,0x0009bf87a579c92a,0x000c25520ce5a88d,0x000dbdbb95c4d2ee,0x000000003c83c987}, {0x000ca93cda26fb55,0x00070fda7d379236,0x0000ff9b4dee6035,0x0003225b4408d82a,0x0004ddab7bc02dcd,0x000a3f13407fd0e8,0x000ef8b61ccd4571,0x0003f74d60dec259,0x00000000552bcddf}},
+{{0x000e34c1c47a153b,0x000b71a0292af806,0x0006f1033f06e926,0x0008a44df7ce700c,0x000b11bb97dee4bc,0x000e5bb0519b44df,0x0001dfdecc79620f,0x00064a3ab633f6c9,0x00000000be5e0419}, {0x00086608bffa7931,0x000b8e79fd11e3a5,0x000f0ad1bf0f84b3,0x0007a43eff1d3f99,0x000df6cb151bda66,0x000bb833d5cc9dcc,0x000efcae777c4faf,0x00077b4493ff3ca1,0x000000003d3e3cd0}},
+{{0x0003d1b4166066b6,0x000015419a911f35,0x00008706e039d1fb,0x0008cd18172df9ed,0x0006860dcc4429ad,0x000ecd3a3e7a7828,0x0004ae096e2f621a,0x000a7a948006ec54,0x000000003da09c0f}, {0x000fd01afe35f9c2,0x000f40dff1f2fa3f,0x00026e8bbf644076,0x0004847d839ea747,0x00099ac63ecae9b5,0x000ce4398e5c1dd3,0x0008ddbfa4c8bc1e,0x000c2f478dbc1bfa,0x0000000038bd7f87}},
+{{0x00039f56c7c2dbad,0x000b41e7222cb4f9,0x0009555ebd804b87,0x000b858cab0f90f0,0x00016c7ab3880a12,0x000ab3593ca44ba1,0x000be141c61f8f82,0x0006e1c115d901c8,0x000000000c5b17d3}, {0x0004f733495bf3ed,0x00058e7744a66a2a,0x000695d4bf4d07be,0x000a864085dafb3a,0x0001e70b9b0a51b5,0x000ed72168dae104,0x000b50ce97288ea8,0x000615e41ade63ff,0x0000000047db1887}},
+},
+{ /* slot=24 [{1,2,3,..,8} * 16^(2*24)] * G) */
+{{0x000a3db7004cb16b,0x000833f3c93383ee,0x00095a61d2c21c95,0x000c700ae2c6272a,0x00086c8c58b388ac,0x0008a3c5907ba8ee,0x000285ba144f8786,0x000013473f1d8240,0x00000000a37d9909}, {0x000fe66f7eb82dfa,0x00007563b2ba43d4,0x000a6ae176da8b24,0x000dade42cb34618,0x0008bb9f3cf04991,0x000d32815f1a3522,0x000db14c5b696f5c,0x0007e2d78ae58dd9,0x000000003263127d}},
+{{0x000f4bab8e6b5740,0x0002e23cc378bca5,0x00024505878c8664,0x000dea9a523017e1,0x000923aeebbc7e7c,0x000844d224d34d5e,0x000bf6a44685785a,0x00033dc639b2a5f6,0x0000000029b9d057}, {0x000d3e582ddf8480,0x000c6b897ca80624,0x000cecc6ce0cc093,0x000b109e71089fac,0x000663f19bfe37ce,0x000fe36983bd6978,0x0002da81cabcda1b,0x000e7e5be6b15f67,0x00000000aa1445aa}},
+{{0x0001233fe4636694,0x0004559527286272,0x000fbd2d99371c81,0x000ecab467369bf7,0x0004656ae3de514c,0x000f541affa2706c,0x00012d6e2232312f,0x0002758169a68c99,0x000000007b425ab1}, {0x000c772803228439,0x0008a8bf52cc0c2d,0x000f399dd300e508,0x0008f8f3e1d88199,0x000a6b652e6d1247,0x000c93d1f9118bde,0x0009d27155635115,0x0004c5a375decbd1,0x0000000096bd49fc}},
+{{0x0008dc1f60e26531,0x0005d3fbbd8d52f7,0x0001a8ae3bac23e0,0x00062fb808ca583e,0x00017c36920300fb,0x000f470a0dd8decc,0x0009b62ce360c4c4,0x0002a0f19869aa1e,0x0000000083039799}, {0x0000a8fb66e35520,0x000687b9b0a83127,0x000b7ade9ed56b0d,0x00088715511114ef,0x000cd6dfe85014c8,0x0001d0235d07fbc6,0x000867007af3e937,0x0008ba8748b39a04,0x00000000984fc7fc}},
+{{0x000757672521dc34,0x000634f939906b7d,0x000107fc496c8f87,0x000b37cb4fd14ec0,0x000ce2f5e72561ef,0x000e23b2b0229a2e,0x0005448ad7181b1e,0x0009a1ae2ef7f13b,0x000000009716ca4b}, {0x0002f78130f8c24e,0x000448044011e8d3,0x000bca32c3d0b699,0x000059eb5f41ea79,0x000a20175f081164,0x00025f07cd0b1607,0x000e00e24655cf84,0x00029cadaf97d934,0x000000009839bc2f}},
+{{0x000eeefe95a27452,0x000a3cb423cfaa09,0x0009dea10a8b382c,0x000d1e1a2836d91a,0x000dcd847d384d58,0x000efd5dfa441628,0x0009e4bc1da5fe5f,0x000361b8a06d004b,0x00000000b6869d83}, {0x000e5d64d0cc466e,0x000c92d578a5c6c4,0x000ae31e1a2bc004,0x00022a21e44ba276,0x000e9c7cd4db3fe2,0x000a2c74695ae6da,0x000a9e30333e5725,0x000e61b8392e0863,0x0000000099696416}},
+{{0x0006e327faf049c1,0x00052e19313a1123,0x0008b24580c7828a,0x0004f2aceb5fbcd6,0x000e4b988b65ae80,0x000e10832a88d6c5,0x000919f61179c8c3,0x000d404939b514fa,0x00000000b4f6d1f6}, {0x00020da420f25f7e,0x000e32eb6965ff3b,0x0006cf4523eaba56,0x0009ac3721e9f840,0x00098ad0ee49420a,0x000c28120f349727,0x00093c5401092185,0x0003affbd56484fa,0x000000007ea49141}},
+{{0x000068a64608d4e2,0x000219589dfc2d42,0x000512100bdd4ae2,0x000430752c35d9e8,0x000d31c2029e2e38,0x000029cbc44c2888,0x000dddbca9aa767c,0x000d729dc9fade21,0x000000003be8f701}, {0x0008d4d53e333a79,0x0008aff1166083b7,0x00030926e4b76b29,0x000d461985c7f87b,0x000842a7f9bc121e,0x000d1f5534e5bf66,0x000fa9224a8de8d3,0x000df6aa91ff9600,0x00000000fd038135}},
+},
+{ /* slot=25 [{1,2,3,..,8} * 16^(2*25)] * G) */
+{{0x00009792684b81dc,0x0009f626db7edfd6,0x0002c5c257828a85,0x000914ef5b9e47b5,0x00056a50e82036bc,0x000a5f135b06a185,0x000f96bb962717c7,0x000f7263442243cf,0x000000004b1eb870}, {0x0003cb482fa23881,0x0003e42bee0550d2,0x0002ee3b690cdcf2,0x000c2415370012c3,0x0000383dc8f11170,0x0006fd02c4a0d78c,0x00017f88ef626d6f,0x0006dede2042121e,0x00000000ddd61567}},
+{{0x0007bbd34440243b,0x0007dc871d117f8e,0x0000ba8750114928,0x0007e2696d009912,0x000c46070d168b62,0x000af8c40ec5b4a9,0x0006319563bbd986,0x0006fcd8662c1308,0x00000000cb2351f4}, {0x000126e870cb4c04,0x0004dc23f1bc4a30,0x0006203bd49c1630,0x000c38c9f7d006a4,0x00035c01832e5554,0x00015bae3f62ceef,0x000a2eeb7c013697,0x000ebe67a6b9f263,0x00000000cfbb545a}},
+{{0x0000b99be5fef954,0x000eb68d1b2d1463,0x00088e3761b77762,0x0002d32fe95bc9a6,0x000326ab0687d153,0x000ca2926f169355,0x000686f533ee23b8,0x0009baaf8c2db6aa,0x00000000b2ecf4b4}, {0x0008f477100d97a8,0x0006d979fffb9df5,0x000a9f5a7cd9f573,0x00037baa9d58728a,0x0008d4bdfcbcbae9,0x00064a91577c7ad6,0x000677411538141d,0x000f3d952fe2e5d1,0x00000000bd94af0e}},
+{{0x0006df89fd0ad925,0x0000e01aedd4b055,0x000ad7bc06edc1ae,0x000fcb51e8c52b64,0x000146c2f8b2761c,0x000035686645c30b,0x0003fa4a484a221e,0x000d8309cd1433ed,0x00000000c1b927e1}, {0x0004d9b57eccac88,0x000c20e78f89c785,0x000120c3c65b62f1,0x000cc12902b53980,0x0008cb76065bffed,0x000abab193aa26a1,0x000489e2beb4092b,0x00036a3aca3a232d,0x0000000047ea91bc}},
+{{0x000b461df8c313a9,0x0002f62b51abe3a8,0x000df51af09a08bb,0x0003fdd384228bd1,0x0008d185d431fae6,0x000203de69fd52c9,0x000996596c1eb59c,0x0001c545273ff21a,0x00000000c45ac930}, {0x00010a2e3753cc2d,0x0004a0afe7dff6f6,0x00074db330a0cf37,0x00058d044b49347c,0x000128a01d8cc7ad,0x0004d011b735e845,0x0005980c4e7ba15f,0x000085da584883c8,0x000000002f8e25ed}},
+{{0x000e543ac2a0df8a,0x000319b610891775,0x000823ceb2f3efd8,0x000ffde34806dd97,0x000932c671aaaa18,0x000451e39e98ca08,0x0004e2c456c100a3,0x0007ebc88290e1e8,0x00000000c5fe42d0}, {0x000ae906967a71fa,0x000433ffe8c53510,0x0006eba4af93baad,0x000ceb9a1b195050,0x000091a0dbc2d6bb,0x0009b3a3c0f3122a,0x0001f5e250d5be42,0x000bf4074af0d752,0x000000007325240a}},
+{{0x000362d1a79cbde8,0x00047576d960f805,0x00036e5150a8f209,0x0001395d5052eb2d,0x000dec145c010dba,0x000557c2845b974f,0x000c582f2c423256,0x000bc1969b28b971,0x000000005ab3e3ea}, {0x0008fd46cfe9bf06,0x000f5f091261729b,0x0002df8f4800d9b4,0x000f2020a55507a6,0x0007bf35da864d33,0x000f66fe40840d29,0x0007bfdfbeef5b22,0x000630a40db4b05c,0x0000000084e0f97d}},
+{{0x000dc0fcf4221fc9,0x0007eb5b8bd73135,0x000dcd71485ce150,0x00040c10113092f2,0x000a3bbbf1ff5ff4,0x000cecf1d2508735,0x0002c119409c8db8,0x000f8f6a9b2fd95f,0x00000000b54dc054}, {0x0001dd2897d34f1c,0x000b652a85ea5e1b,0x00009bad1764352f,0x000bfc2464067dca,0x000673410207171a,0x000a0714a7eeb96b,0x000193a5ff55df6d,0x000d17b66764bc1e,0x00000000d37b0b25}},
+},
+{ /* slot=26 [{1,2,3,..,8} * 16^(2*26)] * G) */
+{{0x0009d0a5bee9728f,0x000a6c50ac27fa37,0x000684c34e089c4d,0x000f067773e42dd0,0x000f8e01fd1baf11,0x000257ae89e39dd1,0x000c94df6ed22d37,0x0008ccf3c05edab8,0x000000007a63e3eb}, {0x000bc0d5b83e9fdf,0x0002fae009689c88,0x0003e0cefe2d7394,0x000c87e7ca0d0af8,0x000224af3a3c254d,0x00005a66ceb9d764,0x000b90bf365ade3b,0x000ee6836976bbc1,0x00000000be24281d}},
+{{0x000b7772fd3870aa,0x00054603315d3df1,0x000dad0b1bcc798f,0x000786ada1562572,0x0008c61702a7739b,0x00069a6e815db705,0x0007fd940388caa2,0x00008cb458d290f4,0x0000000045dfa5c1}, {0x0009a73e0081837f,0x000dd44f405107c9,0x0008c9a77c7884e7,0x000e4bb197fc2cfe,0x000d19f28af598c1,0x0009565216093fb5,0x000134b2dd860fbe,0x000288954074bd3a,0x00000000d4b3b35c}},
+{{0x00066f6abdea4ec3,0x000272782cd9406a,0x000395f33d0d89fc,0x0003a5e82aa794e4,0x000362ab9da7931f,0x0001e6959ce3dab0,0x0004099fbe5d8ad2,0x0001ab2456466b00,0x00000000eabf9b7f}, {0x000ebb34d74e553d,0x0004d4b504ed462f,0x000f1accad4f989f,0x000d434f49f0759e,0x00093daa331ee480,0x000ecf30c1ebc2cf,0x00047b3ea274c982,0x000742ae78d51321,0x000000001c0bbc39}},
+{{0x0005f645b170e108,0x000ac7145297a6d2,0x000f4886144860c2,0x000e39e73a368ea4,0x000666b67f77abcd,0x000176ef442b339c,0x000c7747e9b438ab,0x0009d6d98a6a64ec,0x0000000028ec3a4d}, {0x000daf54b697d2aa,0x000dd8dd45197a96,0x000b8f78f8913417,0x0005101727ae91df,0x000482a02433654a,0x000d1366cfd6d011,0x00082c3ca57c67b1,0x0008f179cc7cc89f,0x000000000137edee}},
+{{0x000f6807beaecb30,0x000113bf8a1f101e,0x0006cca19c30bfb4,0x0007903313fc6f09,0x00090dfe1d19ed3f,0x0009335face6fea5,0x0000e0aec04d39d5,0x00011e5499700fdd,0x00000000e635eb41}, {0x0001998a8d77c76d,0x00093c4a71b936f0,0x00063526d4f2c9c1,0x000a0aab9d2fe50e,0x000c6af1c6e555df,0x0009c6cd0e748a03,0x00045e82cfba8244,0x0005988e8907053a,0x0000000092946b6e}},
+{{0x000f2b1737024a5c,0x00075e015d771542,0x000614d750ad9382,0x000405e535060154,0x000af4c234d17eb5,0x000a6ba5ffcaf1f4,0x0002b5373d1f2479,0x000624c73339ac71,0x00000000183b4085}, {0x000139d627be9098,0x0006856c2a4fbada,0x0005dc37c651cfff,0x0002d4737e8f2db4,0x0002a78e86911888,0x000c189ba2da3b35,0x0000e23f5a496733,0x0005b4044a9efbca,0x00000000bc2722df}},
+{{0x000f239762547949,0x0006dfeace7cd42b,0x00002ce9fbd2586f,0x0002bb3045f66647,0x0008e62b7c680a24,0x0000ba09a9ab416c,0x0009ff62db9a2fb0,0x00060aa864f15683,0x000000001b041dfe}, {0x0006fc523bdcbe67,0x0008356fafa888d2,0x000a4b7dfd6d13cd,0x000dfa4787fbf2c2,0x00064d292153a401,0x000ad9843db6047b,0x0004506c52f1d080,0x000224a7f3162c6b,0x000000004ae03939}},
+{{0x0001419e1eea835d,0x000fbe8b64262ed2,0x0005656463cd93bb,0x00049517570730e6,0x000e67a3770a6fec,0x000040edec2efc2f,0x000e0cca178e3b5d,0x000a5c68b1076035,0x000000008fb93a35}, {0x000b1da1d34b516b,0x000a8e712809f4e7,0x0006732ec20215bc,0x0006c1b1a00561ea,0x0008f45adcdd128e,0x0005b72f895fa37b,0x00081e7c9c59ab69,0x0009051d07fef3f2,0x000000002fcb70ef}},
+},
+{ /* slot=27 [{1,2,3,..,8} * 16^(2*27)] * G) */
+{{0x000b22d1cc07a0c5,0x0009d4c2e588d40e,0x000ecbd939eee03e,0x00053d0d2dbba4bd,0x0006f2cfc3386156,0x000924fbaa82d3d6,0x000bb2c7a2dd1400,0x000666609a466e13,0x00000000ed36b8e0}, {0x000763bbe157716b,0x0000dff41af0ae30,0x000cb1737f9ae47a,0x00086fe1444cbf82,0x0008e605e56f2de9,0x000ff9b461e808f4,0x000568fcf7705750,0x0000f1c5c5274c2d,0x00000000902b4cec}},
+{{0x00039f23e06921c6,0x000eb69fa8152f73,0x000afc763dc63db9,0x000547e5c64ad199,0x0000f2ebfbf40918,0x00070532ae832047,0x000e34ef762ac579,0x000541fe36c6a1ee,0x00000000d29b9903}, {0x0002f1a9330c2315,0x000168ce10730984,0x000fdad321911734,0x00078bcbaf1ca8a3,0x0007ef5183744f3f,0x0004b52cc57c6371,0x000323cb0cbead22,0x00033a926755892c,0x0000000007e49576}},
+{{0x000a6e643e1e85b0,0x000615ca50b1f4ba,0x000a56af352bb726,0x00008f930cc42345,0x00045cfe1cf8475a,0x00014eeb37af25e1,0x0004a9f3de7daaf5,0x000985e9690a8565,0x00000000cac648eb}, {0x0004424ed98f9002,0x000221d322747b6a,0x000a9001aea1f37b,0x000c21b76f9ee396,0x000c918fea06bfa4,0x0000c566a9cba71e,0x0008282e427db416,0x000a1830fd61a3aa,0x00000000478c9499}},
+{{0x000a53c7dd23234e,0x000abdc2cca40266,0x0006050678e0e1f2,0x000591365b236113,0x0007ad4215705baa,0x0009c82e53ffda5d,0x00012de9e1475e09,0x000ee2aa25867924,0x00000000a1f4c152}, {0x00044cfa380d638b,0x00014d4371ecd066,0x000382444ca28153,0x000e841e9ab1b095,0x000ed0b99298b394,0x0005c565eef8f04b,0x0004b86bb3009378,0x0009de3fb200b060,0x0000000065c18ea4}},
+{{0x0003e075392372ed,0x00035602f9ef68c2,0x000506b0c713b510,0x000505f99cfbb35d,0x000fec2a7475191d,0x0001159cf24c9c53,0x000004989efd3822,0x00005f0610b598f6,0x00000000c88a17dc}, {0x0002d88055c8835e,0x000884e4f015fcbb,0x00026308b7dffec7,0x0009a0d47fbd68e4,0x00096576e67150a0,0x0006ada6d282ad24,0x00061f8a85ddc66f,0x0002d69667ea0500,0x00000000a78ebdf4}},
+{{0x00060e0bb87570ec,0x000decdb4b66794a,0x000f54b27864f0c6,0x0007b8ea1258be7d,0x0008c12507a1a081,0x0000b19eaf1fdd14,0x000847516d524dce,0x000883bb489fa240,0x00000000f11976a8}, {0x00071b89cc8f7c98,0x000b092c4a1b178c,0x000f3b858f9fe56e,0x0009e8f2afae0d7b,0x000c86ccdc0c5013,0x000113cd2a700356,0x0006746c8e577a42,0x00084859886bcd77,0x00000000adab386a}},
+{{0x000bcc7a61833c82,0x000d9bc7e2b13fdc,0x0005d998161bd673,0x000e2f01fcfdd0e0,0x000c42a4f07b70f2,0x000cebf77c6baace,0x000fbc6048f4ff69,0x00099be4c3be1e79,0x00000000cd5bb7c9}, {0x000312fe545dd997,0x0001cffe133ab388,0x0008f524d460ac1b,0x0008d8b459add93b,0x000d119c8b9237da,0x0005046c37112737,0x0006cd8542967048,0x000ad0de228353c0,0x0000000098ccaaa4}},
+{{0x0003ae91567025d2,0x00007e7270fe3f98,0x000d969bc1f7e5f8,0x00051e2bc42287d8,0x000f8ccbb50e65e5,0x0008900d53703d82,0x000124687b28f039,0x0003cda01a082be7,0x00000000eda37122}, {0x00045e55a8576df5,0x000145c2ab6a4097,0x000b124888fe833f,0x000b24d86681875e,0x000447d03ffd0fec,0x0009723541de47e9,0x000927368af6de13,0x000a57080a9a41a0,0x000000004c6b37ed}},
+},
+{ /* slot=28 [{1,2,3,..,8} * 16^(2*28)] * G) */
+{{0x000f9393deea3f09,0x0008819f022d90b7,0x000c0a665c74ab02,0x000b57c3636f542f,0x000fb15e6621140d,0x00074db336d7595a,0x0006389b07383dec,0x0009bbe4b2d33801,0x00000000883c84a8}, {0x000d6d8b9752b016,0x0000778bd8062a08,0x000d2628fac45382,0x0001b4fa5efad2a9,0x0001d7fbc7f0a995,0x000976bc437387c5,0x000f135370981199,0x000842b90def5959,0x00000000d0777ee5}},
+{{0x000017f3b37cb33a,0x000ef867debfb6c7,0x00096f8d7d09768e,0x00071cc634993450,0x000d78d34c5ef3cf,0x00033361f7883c6d,0x0004da4e13ad45ae,0x00073baf7ec43b3e,0x00000000f18cbda3}, {0x00053207af0c775c,0x00030448601d0e6f,0x000b30f84e0d9696,0x000ed8e5854d289f,0x00055fced27bd1ed,0x000d9a09b3730906,0x000415982464e20a,0x000ccfd82e828566,0x000000008aab8d63}},
+{{0x0006524e597e2ffd,0x0001a155abb705ef,0x0004cbd9fa988c0e,0x000ce16c325f21a9,0x00020997df6f15aa,0x00095817868bacb4,0x000fb8c206a7c855,0x0006b13b3aa5fd57,0x00000000e12c7aa9}, {0x000f5d36c788f224,0x0004cd4dae4919f6,0x000939dff5c16cac,0x000979042425494e,0x0001056686e8d8af,0x000db7537232c859,0x0007899a252a4b6f,0x000369e2bcaed4d7,0x0000000068e83eb8}},
+{{0x00037d829815d64e,0x00010852af1a7705,0x000ebcdd962dda74,0x0008e83b808653ff,0x0006f1464c5ca7e7,0x0003edb965e97af2,0x00036db4a1f8fc35,0x000caf8d1f31e0af,0x000000008036de5d}, {0x0006efd1afc18c52,0x0008eec3eadbc36f,0x000a698fb22458e0,0x000b0a6f0b18d274,0x00003d8e0a811dd5,0x000bcbc10dd04419,0x000a81d3eb56a933,0x0006717a999fa917,0x000000005dfdbc38}},
+{{0x0003342daa13bad6,0x000c384f3a8973b3,0x0004efe1cf6075ab,0x0000122a9385f414,0x000f41f373b235f4,0x0007d0af88256d16,0x000b2a1dba240c93,0x00008a27a6bd0aa6,0x00000000765228c7}, {0x0005308466a187a7,0x000ab14c79beda48,0x000e88340db91c17,0x000f9304f5bb5c3e,0x00083d38ff6e1f89,0x0001680a5fd655ae,0x00086f2dfe061dd3,0x000ca2cb17789410,0x000000001b58110d}},
+{{0x000d1b82a677e668,0x000ad141adda89b2,0x0007f80535105017,0x000bbb3bec1434d1,0x000e4f68b19e8a7d,0x000c6c13293349ab,0x000d8b568e00ba6e,0x0004df211f7c8885,0x0000000072d3f05f}, {0x00078b6db7894e04,0x000876ea4f54d2a9,0x0007b68c98dc6687,0x0001735c0a7f1de7,0x0008c033c2c2601e,0x00024c9bb6ed267d,0x00039cb244a0ee31,0x00000e9844468b47,0x0000000072497339}},
+{{0x000811590c14f59a,0x0005255acb212545,0x000a8a86af3140da,0x000af1d25b72ad95,0x000212c6d0fb36d2,0x0006b2e7f7dde0f0,0x000cd4669621eba1,0x000d02b9b99f76a5,0x00000000a8a59592}, {0x0004f76e5dbd32b2,0x00019ea0551e07ea,0x0003319b32641944,0x00080901e8939828,0x00018612e33db17f,0x000d37ae8cc2d225,0x000ffa0d2690321f,0x00019d6565803ced,0x00000000c61e85b9}},
+{{0x000afe078db4e9f0,0x0009a55a500017ce,0x00019a26f3443a99,0x000195c8138acea8,0x0006d6b6db902371,0x0007a635a75063cb,0x00054cab6f6eaf86,0x00094b15fbbcc79c,0x0000000069b84b52}, {0x00088f2e7934316d,0x000add02ba3b16aa,0x000fbbc59d173ab0,0x00006f9c858e4a48,0x00003a2f8d5a4d21,0x00033a9f7ec4b848,0x0005afdeeb80fa07,0x0001a7176ff9067f,0x000000000075e683}},
+},
+{ /* slot=29 [{1,2,3,..,8} * 16^(2*29)] * G) */
+{{0x0008fcf262f5f8c5,0x000ee54d519f2e2b,0x000e62d7442793fa,0x0001bbd698322050,0x0008386bfde52c0d,0x000c016370791794,0x000062c2b1d9ce13,0x000f72cadba1c175,0x00000000d24ce5cd}, {0x0008bab9b7d485b5,0x000e3fb0c74ab33e,0x00025396c045b6c7,0x000d7f8f079076fb,0x0007858cd5eaff6a,0x0004c57e36c4318a,0x000f568d5ae81dff,0x0007f13c3d3db3f5,0x00000000ef6e9235}},
+{{0x000676f5e05a8cc5,0x000ce87345585ab3,0x000eb1fd4de848d9,0x000f0b149ec197c0,0x0001d4d7efc1b9b1,0x00001079af4850fb,0x0009ed15007e7129,0x000693dc38c46a87,0x0000000015c9f0a8}, {0x0000c39d5dcd2e52,0x000c68c4951d6b5e,0x000d6d2488b5b7bf,0x0008b36ff0aa7624,0x000a03240e1cc6a6,0x000620ad886cf3a0,0x00034f5b9029f970,0x000e45b54f52569d,0x00000000df7fa65d}},
+{{0x000535c89bf15b7d,0x000b01448215d9f9,0x00097a2e7a578d2a,0x000e137224fdf7b8,0x000b498670a17782,0x00026acec9e3323a,0x00007be4fd23a18f,0x000ff7206b0b6e0f,0x00000000b674e196}, {0x00053944c43221b7,0x00035b25c18bfff9,0x00051edd9ed14a01,0x000e05742dc47d35,0x00056a4edc6d9a8c,0x00049032140ba7b7,0x000fd10c10ec8b52,0x0004c5db3338d849,0x00000000e8e11aae}},
+{{0x0009a8d27d4ec404,0x000d9db8e17e5bc0,0x000db7186a977db3,0x0009e2cdce4f8ddc,0x000988a37f3ab883,0x000cc32856ef5747,0x000d1195610a1be4,0x000ace74cca7c9e3,0x00000000f4af1fea}, {0x00029557170cf0d1,0x0008a27fb8838fde,0x00062d50105f9b4a,0x000cf1dff36bbfb6,0x000402e678f94e9f,0x00082064ce98c975,0x000e87f454c0bc00,0x0001e5c315833d07,0x00000000c9e533eb}},
+{{0x00029bbc4e101800,0x0005921cd569e880,0x0007f48b8927fea5,0x000e09dedaccda5b,0x00050460720c3820,0x0002cfc6aede08d4,0x0003f07449647a3d,0x0000b78e55d63003,0x00000000a7c615ee}, {0x000cf544e4a291e6,0x000fc623a1bed29e,0x0003540e7ecebae8,0x0006e516bb993c9d,0x00045f5c5919503b,0x00002b36303523de,0x0003c7461641f223,0x000bc16e1e9ed5a3,0x0000000099f2458b}},
+{{0x000c6e91ea48669a,0x000bc8a36ea53a1e,0x00002a44bc1c9944,0x00083e6a91e1ca78,0x000d79865ee5c3cd,0x000ddf7ffc275a3d,0x00086449a14164ca,0x00038721a1a9dfec,0x0000000071e3143e}, {0x00041158dd4ffa49,0x000a23d82db5b13c,0x000bbf908bf83942,0x0005ae4c956bfa9e,0x0000032dca6d185e,0x0006d8ef6c1d8e6b,0x0004357b2f919d1e,0x0001651a60c66122,0x00000000ba346a2b}},
+{{0x0005688ffa53ed09,0x0006683514d20afb,0x0007e544735f4a6b,0x0005eb63bf6cf5a1,0x000a1338595a5c48,0x000d862f4b09e534,0x000ed4881c33fe8a,0x00003866581d7d8c,0x000000006febfc03}, {0x0005edcf0299817d,0x0006c2cb76577501,0x0002cd8740b25bac,0x0008fab63b1f0804,0x000a5a57cebe3845,0x00008823fb08ba9c,0x00064c6095bfb07e,0x000951ee49738e4d,0x00000000f919062c}},
+{{0x000c1896b7103013,0x0002d9032007307d,0x0008273fadc23869,0x00042741d2c75adb,0x000b22a07d77de10,0x000025dcb45fe5fa,0x0009055c4e716e91,0x0008e9a3162a8cd0,0x00000000fbf373da}, {0x0003b73d37aa09cb,0x0008bb1b748635e3,0x000df1e5665955d1,0x00063c2587fd057b,0x00035e6f033310a3,0x000deae57b902bef,0x0000dae71f1128a2,0x000acc8e3c95e4de,0x0000000014ef333a}},
+},
+{ /* slot=30 [{1,2,3,..,8} * 16^(2*30)] * G) */
+{{0x000c0d4d5643f8e3,0x00047cd8d21cbf44,0x000bd7e9ea7ce61d,0x00054719fa07ad23,0x000f71236f782bf5,0x000e288d506032d8,0x000c5f341e542884,0x0000c4e6bd6666f6,0x0000000075755a2e}, {0x0003648e022de7c5,0x0008c23c77dcbf42,0x000fabad960df113,0x0003a1e1b2771b24,0x000fdbb9a7ad9406,0x000a58088fb79359,0x00008a4ddc0a0c08,0x000699e6d3300236,0x00000000335dcdce}},
+{{0x000112b116a3db9f,0x000761040eec5c63,0x00080e04ec4ae45b,0x000806324d058302,0x000d91a380e6bc09,0x000135ee9417d106,0x000c4cd22a10dadd,0x0002fc8b18dd7d3a,0x000000006b3375b3}, {0x000cc99c4de31b17,0x000d3720638d7865,0x000917f745950540,0x000861f873623e82,0x00018c4091752c95,0x000373eae9b364af,0x000d660a788442d4,0x000b6127fc8941a9,0x00000000e47fcda2}},
+{{0x0000e7f848bf45b7,0x0006ec923983e060,0x0008515749a74098,0x000aadc8b78544b9,0x0002d647ec845322,0x000bef03e01dce6b,0x000140f63f5412b5,0x0003c348e15a3920,0x000000001c2512db}, {0x00066a290e19eba2,0x000b3656a3a8fe7a,0x0000574472a5b196,0x0005c1d442da3e8c,0x000f8a995adf5588,0x0009807df9fa017e,0x0000c6abd36c49d5,0x000a9e44d7703e6b,0x000000003479fd20}},
+{{0x0003f19e1df4155a,0x0005ea602582e172,0x000333e63d038c65,0x000c3a0d7f680a25,0x00030f684ff5a8b0,0x000d9380fcfc7493,0x0002c0230ac0ab89,0x000b7cc60b2d5fb3,0x00000000d972ba98}, {0x00030cc9d2007e9b,0x000b428da603a3b3,0x00082e11b9f06c0a,0x000e9fbee09ec38e,0x000f19f6b6ffd422,0x00020a47a164e606,0x000d15574ae513e6,0x000939b13dfafdc2,0x000000001a8d5f11}},
+{{0x000d24f64a9c32ac,0x000a514b5177add5,0x0004d4c24ddcc573,0x000b97558e204544,0x0001e2492a0da274,0x000a4acc96c536b5,0x0005bc0a2a254825,0x00012f130e97c4d2,0x00000000469cd1f9}, {0x000a07d1ff87b603,0x000ba2a5c8fe1c1c,0x000eac355f1aaddc,0x00070d6a8870f4e9,0x000d9c71d1727a82,0x000accb16e8a373b,0x0001929105d857ab,0x00050f9a964b7e92,0x0000000076590a29}},
+{{0x000ccd402c8d292c,0x0002840512f358ab,0x0004ea312e8b779f,0x00021b8f6f66197c,0x000bdcb023f57588,0x000d1fe9d1404058,0x00032aee151c6d19,0x000db6fe27cad48b,0x00000000dfa4f8dc}, {0x00009fa40397ea3d,0x000010336b5818dd,0x0008b54d9fb7edcc,0x000633b7a1af5591,0x000ce6b1bab55815,0x000e4544c2ff2c74,0x0001786e6236b573,0x0003edf55707c982,0x0000000045e950ea}},
+{{0x0003986050eece48,0x000e60bb42effb9c,0x000a75e117510638,0x000908c68b82cab3,0x000f154e39cf2ea5,0x000ce6d4b339afc4,0x0004794e4869d8e2,0x00009492a5adddea,0x0000000030a23847}, {0x00069202d503f43f,0x000301652cf5c902,0x0006a16b735dc500,0x000693343ecb1be6,0x000c4ecf31a381f4,0x000546cef398451c,0x000090499c9d5b67,0x00022618a49a3a89,0x00000000f584d8ce}},
+{{0x000dbe588ddc5a58,0x000ec0546c26aa20,0x000955a00243059e,0x0006d241b4570613,0x00038af577a5b820,0x000ed18c90040017,0x00071c28f5ef9505,0x000980011d2c37c0,0x00000000dcbd0102}, {0x00027bb31377d844,0x000efc03542af95d,0x0001c049b6c964a2,0x000203527cf27c95,0x000fbee6f752fdbe,0x000faf1826c1221a,0x0001214ae359bf7f,0x000e3073e69092f0,0x0000000042af3195}},
+},
+{ /* slot=31 [{1,2,3,..,8} * 16^(2*31)] * G) */
+{{0x0008d7582ff0b483,0x000d12c49a0f2f5d,0x000b8b69e8912fff,0x0001d90cdabce907,0x00048307ead6f7f2,0x00075e1b7215f457,0x000fe56356dc7778,0x000aaa6fa426bd21,0x00000000a631ea41}, {0x0003de44ef32390d,0x000d4d53f0203e7e,0x00064545d61ea4b0,0x00031fae427f7ff3,0x000cc8f8950a7076,0x0005b660ea6c0769,0x0003ca186ca7b369,0x000163d85420d6b2,0x0000000086029b4f}},
+{{0x00026a58db6e0ec6,0x000ba1f23b8b8c19,0x00039e4b325c80e0,0x0003c27543dbaa96,0x000ebb116362379c,0x0009886f3b0d646b,0x000ef10b44c4606c,0x000d9114281b38a7,0x000000003cbdde39}, {0x00016e86d78b36c1,0x00039d292159a969,0x000acb40566e3764,0x000821a86503d839,0x0007cc0cc8e310dd,0x00076f8fd0100718,0x000468a74142a67a,0x00011941b055c1f5,0x00000000be5bcde1}},
+{{0x000895b013047789,0x000fa29ec13fbf19,0x000f7fb8eae7aa81,0x000efffaf1d375c4,0x00072d7b38aa2b9c,0x000fcfdc18152073,0x000739eaca019d72,0x0009a6d5646d085c,0x00000000e6160224}, {0x000410107b8cace7,0x000e38e7ea087648,0x0002c9dd3e7e6a38,0x0003f165afb80bb3,0x00009b523983f2b7,0x000975ece0d3cb5b,0x0006651564b49a04,0x0001f14347440805,0x00000000c02847d0}},
+{{0x000ebf7530e722f4,0x000c959eaf391ec5,0x000e0a862e366604,0x000bb5f68d2b3933,0x0003ad7dbe53350a,0x000884bc9c481fa9,0x000553c920e39d78,0x000a6943ccd9adab,0x0000000037942e41}, {0x000dd1ea8cebfcbd,0x000290ef331d1624,0x0003b6494bd8ed03,0x0003f1106ff73f59,0x000ef3bca7bc0ad9,0x000885ca28892d85,0x0009b665fb681ef3,0x0008cb3bf785baf1,0x00000000b3d45a93}},
+{{0x00024009bb0b2580,0x00072bcbd81fe500,0x000d7dd7c9509da7,0x0003ca38734449a6,0x0005c95224ed2a2b,0x000bf3541c97f410,0x0001ccde1fc3c8ba,0x00067f41fbee0a18,0x00000000ef249f4c}, {0x000e6c1f7933810b,0x00059dd25ef93b1e,0x0007cd484d4654e0,0x000a29f41b95679d,0x000a3663f0071e93,0x00043998dc1caf70,0x0005432d051f6c13,0x000cc8b93ab30274,0x000000000fb9489b}},
+{{0x0002ad44ebab57f8,0x0000a85fe5392a69,0x000f2fc8445c0bc0,0x000b462e73c1f735,0x000a73c7b27cb001,0x0009bdd945dc2cbe,0x0005c8dd753fb2a1,0x000a9d460c693a1b,0x00000000a82ae19a}, {0x000f2bf9a30cd2f3,0x00019c0a88420ebb,0x0003a243573edfc7,0x000aa06877cd6595,0x000e8767c5bed6ec,0x000caaa676157be5,0x0009547a488ac931,0x000615019c5c1900,0x0000000085f41531}},
+{{0x0007ccd231c6004a,0x0003c801464653f0,0x0007912af83ee4c5,0x0007853390eba852,0x00016ede33ce26cf,0x000710b73816e562,0x00083846b6e5ef99,0x00014b24814aa587,0x0000000023a8ee1f}, {0x000e85b94b6d6923,0x000aeeeffafce3bb,0x00063392c7366e7c,0x000b574e57b4a1c7,0x00075e24ce66d6aa,0x000268f5e616c42e,0x000a0fb2e3580afd,0x000b451156e36203,0x000000008d8dff7d}},
+{{0x00039cb4b2e6c19a,0x000aaefdc87646a3,0x000a40591a900750,0x000ce23666b43487,0x00063553024e0791,0x0009c427ced3e6e6,0x0000b73cc292936b,0x0000ed4ab8b4d320,0x00000000029a9662}, {0x000285e13f00c240,0x00006af03f086d61,0x0005aea58b957067,0x00027d1086c2d301,0x000e443e71601223,0x0008022c4bac1cca,0x0009cb0d9fc53ff4,0x0004081549b740bc,0x000000005384897f}},
+},
+{ /* slot=32 [{1,2,3,..,8} * 16^(2*32)] * G) */
+{{0x000b3a7e912adc4b,0x000fe6ed08feafbe,0x0001720fd34248fa,0x00064d61a371610d,0x000ace267591810a,0x000eecd906174fd0,0x0007f480d377796a,0x00097f197fab4c41,0x00000000ca0ea832}, {0x0008a57e4735d7db,0x000dcf5e41db377d,0x00098f6d2b5c060e,0x00045093dcb73bc0,0x000ea9bea5d076b0,0x0004d86948a7de1d,0x0001d353cb90be74,0x0005ec8ec342836e,0x00000000a8bb6461}},
+{{0x00088c5239ce8fbb,0x000b29dbb97b75bd,0x00030732594e3b28,0x000514fa99d2c1d1,0x0009c2495fb0e551,0x000380b2b26f3a7f,0x00001e8b6394dc9f,0x0006c8a2fa54f893,0x00000000c94d1dbf}, {0x000f6628a6342cfb,0x000237d092e35b63,0x00078a39635c2eec,0x000ea8f052ff83c9,0x000d338f0dd8d23f,0x000886f32c00ecee,0x000c5a51df41874c,0x000d5f0a101445f9,0x000000005576c3f4}},
+{{0x000e560118ba8410,0x0009e5eb6ed26ff4,0x000d86d3be83eff9,0x00021f22eeaa25fa,0x000109cd127f24d9,0x00004d0fe35abe16,0x000a4091b29564ba,0x000551564ee3c4e9,0x000000005769591f}, {0x000791f4dd3f1808,0x000f2537e1240322,0x00030d5eca63ed0c,0x000ec7138416e54e,0x000354f94d3878db,0x000f97542da29f1a,0x00041a7bee4649e4,0x0005009eec269595,0x00000000f0eedce0}},
+{{0x0006bde6ed258709,0x000a639306df4a3c,0x00083998e5b944a1,0x0008486c5380c557,0x0006f1c5493f6685,0x0005e3315f6753e6,0x000bcbba27a1a355,0x00021ad9c8078224,0x000000003365bf9e}, {0x00078885e41df946,0x000be2bffcc79ea1,0x000a2ec1eeac0969,0x000dd61b2b04c576,0x0003e0b4ef7d748a,0x00007204657ecc1b,0x000b35db1ccd6521,0x00012d9389bdc0d4,0x00000000a3fa230a}},
+{{0x0003892207f6c056,0x000ffd710696d45d,0x0009dea50e9002d0,0x000f0ab41abe9372,0x000e8e7b88c2d439,0x0007d6c768ab17ba,0x0000ee45fb240d9f,0x0005b02141c8028b,0x00000000e6f0aa60}, {0x000c32ac90242afb,0x000cedfb269f1dc2,0x0008ea519f7d03dd,0x000be0129432946f,0x00020bc5ac8b8d6b,0x0000dae26437794b,0x0009b831e33be4a1,0x0000beca6e8a9fa5,0x0000000099b7ff81}},
+{{0x00082517e0cd530c,0x0004f0f7b9139c82,0x000587ffd1997dd8,0x0001219b5eb58b96,0x000987c04c30245c,0x000f48d7c325426b,0x000024d824f48067,0x000ce92d104173d7,0x0000000092d3dc9a}, {0x00089dc63415ca2e,0x00087febd412b5b2,0x000fe7abbac29b10,0x000cf362f6dbd647,0x000e52d9b656e05f,0x000c6547ba31504d,0x0005e0e618d502ab,0x000f98afa4662ca0,0x00000000026d0cea}},
+{{0x00017012ec908cb1,0x000627d9a281875b,0x0005718f3f1a7c4a,0x00003fbda6e5319f,0x000896eb4a6f258c,0x0005011968d49062,0x0000dd7234c42cf9,0x0001498e356c203f,0x0000000096365ae5}, {0x000e4d4689f1f537,0x0003692386aca706,0x0005631d6f991f79,0x000ed83e255d751d,0x000ae121f2fb2b8b,0x0009b09a5b6e21b5,0x00033d63090541a9,0x000f14f66106f65c,0x000000000e9dbdbf}},
+{{0x0000a92bc846b089,0x00020553e5c79b28,0x0003d1d03063f7ea,0x000a4e3abf1715e3,0x000e9963e05f4950,0x000b5bc35a7340c4,0x000e45849db0e696,0x000bd7e4ac61befd,0x000000000f8e886a}, {0x00099e7a71186c1e,0x000fc196c2aed71a,0x0009dd1a337d22e0,0x000ee88fc6c4de80,0x0000980184700859,0x00012e63107f1a21,0x0002f6d227efe0c7,0x000e90864be893ab,0x00000000cb72b35e}},
+},
+{ /* slot=33 [{1,2,3,..,8} * 16^(2*33)] * G) */
+{{0x000139721a760dc1,0x0000cba5fda2cbad,0x000eb25feea6d512,0x00085d7c20b289ac,0x0009142cb611dff7,0x000d46f4e8c6032e,0x0000c2e19ee1b10e,0x0000faed1b893d1b,0x0000000009a4f56d}, {0x000a71828ab88a27,0x000f11f63c8cfa9c,0x0007d1c1bc0cf4ef,0x00094619fd5a1ce8,0x00057bc23d7d6947,0x0007aa1b9633077b,0x000b5a8744067e91,0x000afdfee93e1957,0x0000000027019e3d}},
+{{0x000ab5f691f54517,0x000496a2be9f5161,0x000d2cb2b4015b81,0x000a7b5d9d514864,0x000b6537c8fb8b89,0x000ae7cc6bf2155c,0x000ba68d972dd657,0x000b9040f3b6b064,0x00000000bbc4bc54}, {0x00023c54261a90b9,0x000b16a847c97a57,0x000231ab3b7d6e0f,0x0009dc1a0a5fbe5b,0x00069fd123d03620,0x00064a2dd131a82a,0x00097ba5feba5afe,0x000572f143969490,0x00000000392fdc1b}},
+{{0x00094ff5e38c40f3,0x00034fd960340a83,0x000df3dcca3a7e84,0x00073c19aee97a7c,0x0004e6620adcb777,0x0006697e7525fc72,0x00074ca9f50916b9,0x000c9b402d3bc700,0x000000009e24bdf2}, {0x000809d7c50b9686,0x00036f67ccf44849,0x000f30a7c4777a4c,0x000cf4648b7d0159,0x000f63e6c8e3ff87,0x000feb4ecb17d4e3,0x0002da3ee48d3e41,0x00027eeca593f3b6,0x00000000188ccef9}},
+{{0x0001d94158a39759,0x000c3f8a253d474b,0x000310687793697b,0x00084d30c41d8bcb,0x0004dec2dcec8a0a,0x000c9d1197d9badc,0x000c92f5b560d214,0x0003892db3278ede,0x000000004d341293}, {0x000242b33fc35ac8,0x000c4094aacafd4a,0x0000ad5175a6bf9d,0x000c1230dc741d5b,0x0001a8d0d75bd9ef,0x000f1c9d7d4caa83,0x0008eda58ca7ab0b,0x0005618a281aac0b,0x0000000001be2719}},
+{{0x000fee0117b14b99,0x0005e868b3134bf6,0x000ecc8a99fdb8fc,0x000339c829e58a64,0x00023bd923c6113b,0x000649a1b32e8f30,0x000ae28c3ad309b4,0x00061dc7a306251e,0x00000000c1237521}, {0x000f88ff51e04bdb,0x00047475fec6a90d,0x00076b5887766cf7,0x000b07bdd072c6be,0x00056982b8f74f58,0x000b74d7f817b364,0x000b7bb7d15efb8d,0x0007d23deaa1c321,0x0000000053f8de34}},
+{{0x000945d6b8804333,0x0003dc324847226f,0x0007b568f948474a,0x0008a846d54372f3,0x000ee6e187b544f9,0x000fe3576ed25efc,0x0009e080bba21417,0x0009bea9ea6e6347,0x00000000b41718dc}, {0x000ae26626bf0296,0x0006a18d2fb188bd,0x00061234324bbe4a,0x000572e83417eeff,0x0006022c1ee67a6e,0x0005ed13622c4549,0x000013b5d13bfe1f,0x00065673df7ed4e6,0x00000000e0371453}},
+{{0x0009b946c1e7ed58,0x0007da4a4008794b,0x000fcdb786c9faa9,0x0000418b9219b3ce,0x0004bc79170ba791,0x0009dde94e1e93bf,0x000d161b287f9946,0x000922e9a1652137,0x00000000efa9b956}, {0x0009a5420592bc3b,0x00037e585004d1bb,0x0007efbcf727a796,0x0002366fc1e264a2,0x00037634bc0ba5af,0x000bb886640668cc,0x0008b3f02836be79,0x000befdcf9f33528,0x000000004a45d809}},
+{{0x0005ff1f94017c56,0x0000e6534f946ac7,0x000b0af1dc70c2db,0x0006f53dbcaa3cb4,0x000d7dd3f1079c8a,0x000a80d77de6dc8d,0x000883bbc0b59684,0x00005655c47c7992,0x00000000134c444f}, {0x00055db7a8ac49f5,0x0002a654f6af2275,0x00093a0ad609f580,0x000e88148d0e5ea6,0x0002f0eeecd04dc7,0x00014e42c2e53fcb,0x000fe2b9cca557da,0x0007545fedaa71e3,0x000000000d8ee5f7}},
+},
+{ /* slot=34 [{1,2,3,..,8} * 16^(2*34)] * G) */
+{{0x0000b34bd4a1bb0c,0x0008de85fd810870,0x00043c4b17d99815,0x00041d407ef36265,0x0005a0ca136be72c,0x000412a33007e433,0x000fd7c06f5410ba,0x000b46b44c34a6a0,0x00000000e5bfbec1}, {0x0009039db8f9e6ea,0x00095489f457e1f6,0x00061a2b46448a1a,0x000aea9e5bcb9fbc,0x0003157e457ea544,0x000a6fd8607c0455,0x000d03963879025a,0x0003fcbb3a1ffef6,0x000000009ee57414}},
+{{0x000dcfd72c8a22f5,0x0001b7204b96ea96,0x000a25ed406db601,0x000fe891aca18499,0x000dc73cb6edd555,0x000689b04c4317e7,0x0003041d6d1af12d,0x0006d6d9080e4edd,0x00000000971b0b2d}, {0x0006f3c71634e27c,0x000677d17ef8293e,0x00012e14a2968bdd,0x000215288f81c719,0x00024d72925ab930,0x000d2dbbe3edd2ee,0x000722aed9fd46f0,0x000fc83056922956,0x000000000565f77b}},
+{{0x000efa8ffbcc51a4,0x0005473dcb3d2583,0x0003f33a4cc8ac9c,0x0008453277ad0a3d,0x000732770b0fb1f4,0x00060334785b3ffb,0x0007147e112410df,0x0007e2c73c4762e8,0x00000000e9e091b9}, {0x0006361ec37eb785,0x000c8cbb2186f937,0x000a8d6b64217b62,0x000a8cf2bec9cde3,0x00083c4138869e14,0x000dc3e1c257063e,0x0006a4381d705b28,0x0007f4ceadce642e,0x000000008aec8bb7}},
+{{0x000ebbe622badda6,0x000bf476acaa1bf3,0x0006333f731120ef,0x000c356b08c6ebe5,0x000fd8682b91d2da,0x000f898fc69732bb,0x000a33174d809c63,0x0000d7d82b1aa37d,0x00000000203e6672}, {0x000c6c828da141ab,0x000c92ea67d8a531,0x0004eb3c742363c1,0x000ae1b59946bd9a,0x000e74a7d6c2e0da,0x0008f53d951b0c8a,0x000d54885ac6badc,0x0003db168f1191c4,0x00000000f226cec7}},
+{{0x0005341d480b4a4e,0x0004e0f90f8f31c4,0x0007aaa7aa9fba18,0x000bb211d9fa911d,0x000949923fb7ff5b,0x00040b8c6a6f7767,0x00097d2805bc56bb,0x000d0f69c2aa37b3,0x000000004fdd3392}, {0x0005df7a717444c7,0x000200adf34d8a68,0x0008cc33311f851b,0x000e55ebd1ef3d6e,0x000a8fd02650bb50,0x00003dba93e8a341,0x000b47fe184b0ec3,0x00049ece30ec55f7,0x00000000c2e485bd}},
+{{0x0005d3b42bddc7e1,0x000c3eeb9127e359,0x0005197a561d4c19,0x000c166fa38dfb17,0x0001e1efc5abcde8,0x000f9891328d5a42,0x000df8c3d8167f01,0x0002c01407b4f413,0x00000000acbfc313}, {0x000bf8e312b2cd77,0x000608f05eccff50,0x000463b35d585da4,0x00075f946c209c37,0x0006285b4cd18d96,0x000f306e87d1d2c2,0x000f2b16a9e36c46,0x0002dfd71ab80d6d,0x00000000157db70a}},
+{{0x000ace75c64ffabc,0x000b0c89395d19f3,0x000e6e2ed9fcd7af,0x0005a50fcfe00cbe,0x00041bd50a655453,0x0005baec22e0a408,0x0005bfd6e8540585,0x00056d1c8075b467,0x000000001b89e757}, {0x000c88486d755455,0x000555292c555009,0x000ecd85d05084c3,0x00012fad5e3946e0,0x0001092bb240117d,0x0004eb898f8df40f,0x0000d376c184bc79,0x000585043853454a,0x00000000e7becb52}},
+{{0x000a8e0fa066b0d9,0x0002e1c0af898b13,0x000ee2c229694050,0x0009a1234c1a0393,0x000ed7fe4f8ff6e6,0x0007af492402bb89,0x000ea96558743f68,0x000d2654d6614114,0x00000000b30196c7}, {0x0006411732a9659e,0x00070ac85e146e7e,0x00025b5d7de33c1e,0x0001642306b5df9d,0x000b30a607a467bb,0x000d81e33e681734,0x00090e8200849f3f,0x0005ac7044302d2b,0x000000004d690e51}},
+},
+{ /* slot=35 [{1,2,3,..,8} * 16^(2*35)] * G) */
+{{0x00069c3d8fafa349,0x0001867bc9654373,0x000b67aa9ce2add4,0x0005351eef758c0e,0x000e94d10c519b96,0x0000d39aa563fea9,0x00005137ed2e84ca,0x000e1aebeb0c88d7,0x000000003e007029}, {0x00003e17a1e8dae9,0x000963b630e2dffe,0x000adf23e19c3cc8,0x000009d7d5d2d704,0x000d25f8f9c0318a,0x000497134cf251ea,0x0002f9e77e0369b5,0x0005acb8acb060d7,0x00000000e91eb123}},
+{{0x000843c73a6eb6d2,0x00027e91acc98342,0x0002278c6cd8a4ad,0x000155112aad0a83,0x000921b4d33451d7,0x0002b2d231b9882d,0x000bc20e3434963e,0x000d544b972fb887,0x00000000068411de}, {0x000e069bf8ff0c95,0x000b5c754c81cba2,0x0001a7c40e48149a,0x000264ad8c6282ec,0x00001d5816350899,0x00012aaa00a1b9f7,0x00056a71d8228673,0x000b830c42079ad8,0x00000000015e0aa3}},
+{{0x00049f4a49fe7060,0x0000e1bd95d38e87,0x00062833cc691f93,0x000615bc891da3ca,0x000c0052cef72f4e,0x000803b6dbc6258e,0x00021396b6089303,0x0000005b46c0c4ff,0x000000007636970a}, {0x00079e0bb5dda834,0x0001dbd542c281fe,0x00014530f18f56b7,0x0003ec31d36021fa,0x000baa5f29ba83c8,0x0002f8821bdcbd70,0x0005204b543755ef,0x0000bcf085650702,0x00000000d6803464}},
+{{0x000ad178c2d0b7f3,0x00057b82ca881a28,0x0002ca3df303ff2b,0x000bf8e715190be3,0x00020137492deabe,0x00013f5a5bf63a86,0x000b91f199ccfbbf,0x0008b3afb6e922a4,0x00000000a02d89b8}, {0x000aec19ede554c9,0x00045cb1308b7b29,0x000ae4e573cdc592,0x000503956c8156f8,0x000e2cd19a41c6c0,0x0000749ec4366012,0x000bcb4bd470cb80,0x0002fcd069dc42ff,0x00000000bcaffb6c}},
+{{0x00088ed8ca2e7798,0x000369f86405adb5,0x000bf6f4ea1ad210,0x0009870b4237a200,0x0003aaf171fef8ed,0x000f9cc0bac9a618,0x000742c34ab5c2a2,0x0002af5c621b7054,0x000000002fe4f8f9}, {0x0004edaa3e9adb18,0x000e295fb83448c6,0x000ce7f409c9afb9,0x000941f130e5c94c,0x0002c56c64353d87,0x000caf8ccd93a9bc,0x0001b51813a91cb9,0x000e2f44e97bfc50,0x0000000006eccd35}},
+{{0x00091df2d3178939,0x0006b12428236a49,0x0001912af79ee703,0x0005810b037b457a,0x0006014715bf4699,0x00094040f1aa2b69,0x000d0ffcae72b749,0x0000e02a34ca2792,0x000000003ee7f33b}, {0x0000cb3bc04e0111,0x0004e764e048a85a,0x00047cfd3fb7bfd4,0x0009d4ca49783dfd,0x0004c0348c3d1178,0x000b6cf296222a2f,0x0008ed6a51237821,0x0009317d450b338a,0x000000004d3c5466}},
+{{0x0003084d03aec12a,0x0004c07d2bc64155,0x00015a6086724670,0x00081e96d3d950f4,0x0007b0b83b350097,0x00073ce8748120a4,0x000942f3795a085f,0x0004fbaef267d1e5,0x00000000c72a8ddd}, {0x000cc579d51c7bec,0x00010a0a70009e44,0x000d90fc30b16726,0x0005e8f52487bbd6,0x0003b6383f109f7b,0x000f7b4713cd8a43,0x000f6fc9f8cdcbe2,0x00093540f493ebc3,0x00000000a1a03b69}},
+{{0x0007f100c7972d8a,0x0000807120fdd5c2,0x000fe1fddf54f2a9,0x00006c0b6efb9258,0x000e61f438e391b3,0x0006a9378314c12c,0x000a64d9e0151d68,0x00038faac2aa78b5,0x00000000096a14dd}, {0x00025cac58b15a67,0x00017a7d59d8a727,0x000228ba42a4b095,0x0009b748a5051bd9,0x00042a502f7102e8,0x0006ec49b14fa89b,0x00056ffa36e382ec,0x0009e9d9d29d7751,0x000000002b5b950c}},
+},
+{ /* slot=36 [{1,2,3,..,8} * 16^(2*36)] * G) */
+{{0x0000080f9a167308,0x0000f148b7519ede,0x000291ba4b770567,0x0007a03651bfee14,0x000ecce729de7013,0x000c9962cc081486,0x0000aeed1fb925af,0x000b3328a12c6bbf,0x000000009faf6e76}, {0x000b56256c8be6c2,0x0003bff12ea2a539,0x0002218dd5be1236,0x000f065bb70449ff,0x000e8f08f59b2e21,0x0003f90e5b4f614d,0x00063b1530957959,0x00035f734823ab93,0x00000000fd4a9a5d}},
+{{0x0008dbd82593004b,0x000b07e5ebebf063,0x00053fa41e4f440f,0x000f82a186b964e9,0x000d849ac12b9113,0x0003f0f8cffda982,0x000c4507ce0125a3,0x000af2ab4b043667,0x0000000066e6e1a7}, {0x000d109216eeebad,0x000928ed1c9aca30,0x000c232cd3036c5f,0x000421e0152e197c,0x000de55def777d1c,0x000c5aa0b76202ef,0x0001cff875686719,0x0003503c9f42e088,0x00000000d8beb9ab}},
+{{0x000b0cdd758298a6,0x000f1815ae53760b,0x0004cd7d4fc47ca4,0x000e77374ac1f736,0x000e906629e38263,0x00089a6427143a40,0x0008652252dc08fc,0x0007f08ef63fef3f,0x000000008e6319ee}, {0x000e37c446ff7515,0x000572a0bc5f904f,0x0008473df532cd73,0x00038831296c46a1,0x0007c0d2f7650711,0x000b87860a70f4d3,0x0008d9232d06232e,0x000d60b0dd714b10,0x00000000d7282481}},
+{{0x00087ad6c92a0b7d,0x00084db7695c8fb0,0x000f1330a5180b51,0x00046e17c6047cb0,0x000c053ea1144dd8,0x00030c58cb485255,0x000fb70c97226b9a,0x00045461f90f5ba5,0x00000000baff32d2}, {0x00099bae1bff5b0d,0x000de82b2be43589,0x000d2052e33792c2,0x000f9995080be274,0x0001542bce3b4b32,0x0009f2bed69bcd47,0x0007e1301e36263b,0x0008a31bc72e224f,0x00000000982605b5}},
+{{0x000296787a7ac94d,0x000f65342b64722c,0x000186577ba62f35,0x0007dfc4626c3870,0x000f71c324092e95,0x000578a3ac4b9fd2,0x00013bbe39dfd3d0,0x0008330f7b42add1,0x000000003d06b783}, {0x000d784087d1dbf5,0x00028b55d270fa96,0x000c63e3abb4975e,0x000a403d14c3969a,0x0002ebc70e28660a,0x0007c7bf93516dce,0x00097f7b7d3a9936,0x00062c9625fa4c43,0x00000000dc71881d}},
+{{0x0008d5766c381efe,0x000d00c129a2f9b3,0x0007cb3634dc78f2,0x0009ab955c54e0a0,0x000ddfa92e0ddb64,0x0006ad3ac5db4149,0x000f840f56601735,0x00051a174620b4cd,0x00000000f153c6c0}, {0x00050cce14700ef2,0x000fb9831040078f,0x000aafcee8bf9e43,0x000fc99a438e9fc9,0x0006fc1153d9f942,0x0001672f69058d07,0x00064793f273d3c5,0x0000ec021e3a75ea,0x00000000bc174f71}},
+{{0x0001c390c1424587,0x000d1f92670314d4,0x00080a01812a0ae6,0x000ed78af7ce516b,0x000955753a2c132f,0x000592e56930a4a1,0x000d0b704768da08,0x00013bf7c5efa726,0x0000000020a200ff}, {0x0005fbbc0a8bfd56,0x0002d9da00c0c8b7,0x00064470fc051c5d,0x000445bfce2aaa0d,0x00012dd5dfdaa327,0x000b155b36a99bf5,0x0004759a7e6338ac,0x00051237365c5d4f,0x00000000cd5d8a52}},
+{{0x000f8002c5ecaf09,0x000c26dd41a3c756,0x0007f0f574560a73,0x00073354200f026b,0x000270b3371de271,0x00041b298c738123,0x000e593543a1e4e3,0x0000a916ff7582d8,0x000000004cc45d87}, {0x00029303ca105f53,0x0000157e0d935cc6,0x0004ef652cababf1,0x000f7dc3ae713e32,0x000b09f2cdec02a0,0x000a8e2dc225add9,0x000c7092be3f79c2,0x0001180fa000d8fb,0x000000009cd2c5ad}},
+},
+{ /* slot=37 [{1,2,3,..,8} * 16^(2*37)] * G) */
+{{0x000a596e2a5284ec,0x0002fd2557a19786,0x0007d1230daab1d0,0x000dc833b4c47058,0x000deae864bf3a9f,0x000724cd08026db9,0x000551c451909927,0x000aeda35da7b385,0x000000001bc204fb}, {0x000df4f727b6af29,0x00023626812834b3,0x0009e9a0e9855a7c,0x000617b6c81fad4a,0x000527fb5b1953da,0x000e71dd77a8c104,0x000a4d8d6a4c6229,0x000e7cbe4d378aff,0x000000002719777e}},
+{{0x000a572f83dbffdd,0x000063adc5286dff,0x00081e39569c9938,0x00034c8db66ff862,0x0009bcb0f36f49c9,0x0006af05ff2465b0,0x000f6d4ee9692c29,0x000464d731fd8f44,0x00000000174b5504}, {0x000b65d7dc5e360e,0x000c3c96064cddbe,0x0003a592ab0b64b4,0x00095e6eb6625b20,0x00020a3afd8f2d23,0x000ca30337ebff89,0x000a82cf54666cca,0x000bd771a106ebcd,0x0000000048f38a6f}},
+{{0x0009197151990b78,0x000df99feaa57f00,0x000e274676db9dc3,0x000bbadffbc73f30,0x0002657966ac297c,0x00049c25d3219957,0x000c8b5d8f69c135,0x000e77df1370af00,0x000000007c37c769}, {0x0001989bb566c2ef,0x000f9fc61eb3914e,0x000fe6aa67a31f20,0x0008ab466c21fbb2,0x000bbcb7c798c7b3,0x000af082043cde44,0x0001cef2fc879d54,0x000ad7c0549e014b,0x000000009cef20d3}},
+{{0x000cec616eed0ebd,0x0006ca1673b5edcd,0x000add8bcd818606,0x0003e2819fe2d091,0x000ffd25b68df946,0x000892a4944c6be0,0x000cd87f7f40e483,0x0007dc820e341f72,0x00000000e879064d}, {0x000b657f929694b7,0x0000b1d87c8815eb,0x0005f1f41d13abbd,0x0008b7654740d69c,0x000af23280613f33,0x000360ffca15cd13,0x0005701424a06473,0x000ed20e4e0e7be2,0x000000009f1bfb1f}},
+{{0x000f0ac25f92aac5,0x000bfdea107ba231,0x00060e2afda07313,0x000a9a08a305e071,0x0003a97f38e628b1,0x000a67fa471dda37,0x000e149907e97796,0x000b6075767953f0,0x000000007bd588a9}, {0x00013d72500a5622,0x000fdd50ec951f66,0x000b6662a85a9a65,0x000856524f7d369f,0x000c70d537d11dce,0x0006f6f81aac8dd6,0x00097b63c11bd0ea,0x0009943c5e625710,0x0000000030e8d21e}},
+{{0x000dafff2a698180,0x000c667d0bc093e5,0x000712de7d634683,0x00062beb132066ec,0x000af6e9fcbf9157,0x0008b0de310adafa,0x000dee166225c47a,0x000b5fa6e71dae38,0x000000006486a9d4}, {0x000d7ebb95695a7b,0x000b95139ba135b8,0x000da043fc92a257,0x000c54aec67fafc5,0x0000ca942fbf22d3,0x000c2ea1a6b26a50,0x0009720d4db4dd97,0x000c9bd3aa5142fa,0x00000000e43d01a0}},
+{{0x000eb4c840fddf6b,0x000544a6fd5a1ade,0x000289e52d99b4fd,0x0005ee0a0ad5cfe3,0x000919b685e98986,0x000a515b4d4f1e9c,0x0006ed403902e8cd,0x000ad3c867e99023,0x00000000129e884b}, {0x0002922090ee1f7e,0x000f5941e9da8ec0,0x0003e3efe7cc8783,0x000875eb8e637fc1,0x000bc247a6038b23,0x000316127abb5544,0x0005d47301ba8a56,0x000addf18884dfb8,0x00000000b171f9c0}},
+{{0x0005b4b20e090eef,0x0003ed4292ba62ad,0x00094a8d91d31d3d,0x0004c78aa821b26c,0x0008dec93b730f07,0x0002c5761e228a3c,0x000c980cf78d3e7f,0x00066b9357103ed9,0x0000000031d1edee}, {0x000de6cde36d21f7,0x0001ff1729a9e8fe,0x0004e76af242667a,0x0002ff4eb819b732,0x000063f055ff13ce,0x000506beede854f7,0x00048cb7de4e1a3b,0x000add163f2022fd,0x00000000ea0bad8e}},
+},
+{ /* slot=38 [{1,2,3,..,8} * 16^(2*38)] * G) */
+{{0x000983097386cf21,0x000c0e7fc8c61182,0x0009830e6e5f1a92,0x000a99e23bab3302,0x0007a202435177e9,0x00079d871a51ef70,0x0006bebdcb7fbe60,0x00075100ffc28aba,0x00000000174ec537}, {0x000aeacaa70029ac,0x00031672b8468d63,0x00037f7db099086d,0x00052c2fc14cf99d,0x000202179461b35c,0x000ed6769d548f48,0x000bb3c4781b0b07,0x000e419e81d39278,0x00000000468e63d2}},
+{{0x000e460ddc7f30c5,0x000d4365098a9382,0x000c1ae7f9eb97c9,0x000ba927b4f97b7c,0x00073bb786844384,0x000b68b1af02ccd2,0x000ba42b1e487b55,0x0003eeb3bc494206,0x00000000b5db9c8f}, {0x00033d64350e3a6e,0x000eeb313d049208,0x000eb966ffc00cef,0x00055f715643eef9,0x00023f9995ea9a14,0x000533b9395b8746,0x000b92faa5ca161a,0x00089484af1ca47b,0x0000000049aea24f}},
+{{0x000e0524adebe282,0x000445cf327a4526,0x000ee59583a0e80b,0x0004570ee26d8dfb,0x000fae3e11ddd16d,0x000e8a5e71973617,0x000c09d11b6c3eda,0x000916500871e529,0x000000005ffd38a2}, {0x000bee24309667c9,0x000afa3f6de889a9,0x000abf930c37cfcb,0x0007f3cbe7682440,0x000a54f6aa6619c2,0x000e574cb68a1b85,0x0004486bf026b2c7,0x00076430b56c272e,0x00000000e1c9ebfa}},
+{{0x000c6288758efdca,0x0001bc858f7ab8db,0x0006cdb991d4b065,0x0001f19b3950837f,0x000798f08ff8ae74,0x0004c6e48b2d8548,0x0008e03d4d68de94,0x000a299d6f279293,0x000000009c96a0dc}, {0x000d8b9668e528ce,0x000ff3ca2cbb2a76,0x0005543dccecad57,0x000fca1069bd95dd,0x000897114cee3102,0x000870b125f9b372,0x0005f6879b872ca7,0x0001ac0515c9b8fd,0x00000000e2a89141}},
+{{0x00098f29fbed63ea,0x0001061159a4dc22,0x00066da6b3601594,0x000a2cff55a3e576,0x000a6093af001ae4,0x0008129f362de331,0x00060afc9cc68adb,0x00054109d24a71ae,0x0000000031c9872c}, {0x000d6fc55a79f99e,0x000a9c2f958cbb56,0x000ab9fe3abf0b29,0x00033f56e0a376ce,0x00084519c5f2ff88,0x000c3b16d8ee5fd5,0x0004f4b7e23c6bf1,0x000c543a7b166259,0x00000000ee6f2f8a}},
+{{0x000ccacdeece08ce,0x0001faf4f6bd494f,0x000664cc304e0fbc,0x0000dcfb24ea968d,0x00073c0a74edf5a6,0x000d1b55f30f8d68,0x000b3366fc9ddbb5,0x00032131fde26334,0x00000000bf8a212b}, {0x00080b8edba58a8e,0x000423d223e69d37,0x0002adf318aacdf4,0x000acda6b115c9ef,0x000c3b98b0329c6c,0x0006be5f53e47509,0x000d4a43828790c3,0x0007ba576dbefb3c,0x00000000e748026f}},
+{{0x0000ecda19b6d6db,0x000383319d4f2dba,0x000e6afa895b701c,0x00051a9e14beaefd,0x000e9054253a0174,0x000fd3ce6ce2592c,0x000b3e3b7831706e,0x00044e689fb5edda,0x00000000d73c3c87}, {0x000e756f2f418674,0x000d7a9c6ee0edb0,0x00088e7321988eb5,0x000b85e42720e8bc,0x00050d634add30b0,0x000c244402717348,0x0001f1d4a3fddc71,0x0007685420b83ebb,0x0000000070f836f6}},
+{{0x0007ac558261f962,0x00021e18c2ecece6,0x000d0a679a6d3273,0x000a853971d700b1,0x000a15283c820563,0x0007155a4344efaf,0x000c048502075a00,0x0008dc8fa59bc66b,0x00000000f8a3d0e2}, {0x000bffb4177bd657,0x0001a1223efa2873,0x000f78b3acca1c1d,0x00074c83c9eb1155,0x00026c18d4a6ff45,0x000d898f6b556a17,0x0000955da1567893,0x000d202de104a432,0x000000007ac5e2d7}},
+},
+{ /* slot=39 [{1,2,3,..,8} * 16^(2*39)] * G) */
+{{0x0000b812533aa601,0x0006f8c31465b5d7,0x000a818e1c31765d,0x000e734e0a72d442,0x00014cf6df0d8c6e,0x00012baef441cf21,0x000db776619240c0,0x0001092fa449c4cf,0x00000000d040f634}, {0x000d9793e8b9aca8,0x0003a6ea42d1f39b,0x0008c8d218aa841a,0x00089a768d351169,0x000784ffcbac7981,0x000872b1816ce252,0x000ef7a49b96a180,0x0008a3ca8a76642f,0x0000000050f9800b}},
+{{0x0005a021011ad822,0x000788e60594cf27,0x00081485fb44ae6c,0x00014eb3bd07cc03,0x000a4aef1d3907ff,0x0000478da1511dd3,0x00030a62b96b3142,0x000fe6cdda0256ae,0x00000000bd8a589d}, {0x0009bdd5e76b35d4,0x00018d662d349bb6,0x0002621655aab1ec,0x00092f977e9494e4,0x0004b5e455f15ef3,0x000ad14bc11ab7fa,0x000fdd9be2951245,0x0009f0c633832d0f,0x00000000975b5294}},
+{{0x000c4ed5eac21798,0x000f1b2c91d7f79a,0x000a11e11ca16fcb,0x0005fd787c0da46e,0x000df80852d39e9d,0x00042a22d349692f,0x000fc98a263c2aa7,0x00040d59b4ed642b,0x00000000959d674e}, {0x0009ecf0ce565fdd,0x000ef3761b260ecf,0x0008091a734f61d3,0x00047cd4910fb92e,0x000afb6cdb09cafe,0x0003c7952022237d,0x000a3d0aa4ed0385,0x0004ab5cf7db0f58,0x0000000083bd7f0f}},
+{{0x000fd6a032b7794c,0x000e85d1e9a81ef5,0x00023aa45bbc56ad,0x0001eb51ddcc1a0a,0x00059e7a22e24471,0x000bc5f2a3a1dc13,0x000c7f2d3368d43d,0x0001577604983259,0x000000004f20022b}, {0x00026edcfba2ae13,0x000a7add3e6a76ee,0x000e73957f34380d,0x000bd8f7a47ad1fa,0x000374c57fae8aee,0x000a216add0054cb,0x0002c42cca4c0b68,0x000e00da1b99b2c2,0x00000000952a69a3}},
+{{0x000bc513eacd9cee,0x000d36ce0ff00cc9,0x000db52230de3b62,0x0007e3b3bd729388,0x0005de7b62e36944,0x000a9bab628890e8,0x000328b35e9c611c,0x00063fabaf834631,0x000000007427978d}, {0x00072f99091e37e4,0x00050dd0359202d0,0x0007ab87f9b15d1d,0x000f3d657fcd4779,0x000655ac5657ac33,0x00003ac307a966c9,0x000bf4631b61f716,0x000d680c8a936963,0x000000009479114f}},
+{{0x0000ff937cf52e6d,0x0001091c79c77fe2,0x000482f1488a6d68,0x000b3fc15d10464e,0x0006052ea7d89d6c,0x000155d268949cda,0x00089654870fbfac,0x000f30e760449649,0x000000009f1cb1d1}, {0x000096905bfa8aee,0x000d122ca0eed551,0x000f5583ed4a034c,0x00005aac0a767838,0x000da95861bc188a,0x00004186b3710b25,0x000da4373cd289cd,0x000490f76a0f7777,0x000000004167afa4}},
+{{0x000a04159417b6a3,0x0008f7c8ac7ac7f7,0x000a7cfe966fa2cb,0x0003be1219ddfa13,0x00084cf72aad0993,0x000fb727df7ebf96,0x000caeb67d63e14b,0x000d132810f96cc5,0x000000009fa2bf29}, {0x000f760fc3239012,0x000ea67dfae4757a,0x0007ffece92c823a,0x0005d9f5e9eb98a4,0x00040d9947ed1edc,0x0000a37cf6ff6534,0x000c078184cd97b6,0x000b6a60ba20468a,0x00000000e3659980}},
+{{0x0002caa988558feb,0x00009cbf83d18acf,0x000ecab1c0a3c978,0x000e863735f0297a,0x00085aed82993ea4,0x000e16994c6c6c05,0x00091619c3e75c1d,0x000eee33f6e7cc1d,0x00000000cd3ee98b}, {0x0003beca784c46b1,0x0007849b4ab369da,0x0007592fba221d0d,0x0000e3d191a92859,0x00017fe1bf3d6b69,0x0001e46d857f0c9d,0x0009f7e1807af24d,0x000eabbfeba852c5,0x00000000010d6af2}},
+},
+{ /* slot=40 [{1,2,3,..,8} * 16^(2*40)] * G) */
+{{0x0003fdf3e5b24d77,0x000cea60d0f00ca8,0x00072f6a050bb0a2,0x000b06affd2f731f,0x00038751e8264fa7,0x000d77085476d556,0x0007bd31364f6c7e,0x000b2d387c8ab5d8,0x000000008ddffb23}, {0x0006d329b2ec073b,0x00082abc99e65ac1,0x00091623ea07b688,0x00094f9798795711,0x0009beeb13c96d05,0x000df2eb43830f16,0x00066a312af891e2,0x0002d9f0b42570ee,0x00000000b7674127}},
+{{0x00005135881553cd,0x0002ed29820275b4,0x000a8d891e8ef893,0x000f8450e2030422,0x000a1b9a61864f91,0x0008b0a1a9b3324a,0x0000521e84f86933,0x000fa3198ee598c8,0x00000000bf6038d3}, {0x0002acc87ead1523,0x000efdf25a594799,0x0004516eeae84ac1,0x0009077ae8375825,0x0005f11bf3ca38f3,0x000f441755865290,0x0000d7cd6822a905,0x0007e266d76ac583,0x00000000a6117cd1}},
+{{0x000bb49ab1c035c4,0x000de8fbef40eda6,0x0008d65bc3de657b,0x000e9905468792e2,0x00001bc8c1c806c3,0x0003d91d8a3208f1,0x000cd052965bb5be,0x00025538c36508a7,0x000000004b92fb5c}, {0x0007ea97be0d40c3,0x000e05e765008f33,0x0009915f813d833b,0x0005893a21da8366,0x0002670c465316f8,0x000f03d515678ec5,0x000080ef92eb9789,0x000d3bdfa1bced18,0x000000002e467085}},
+{{0x000e06c8f2351373,0x000b2888858e4f17,0x0007e267e7fa490f,0x000d2058f698497c,0x0008a1dce7284dd9,0x000174170d2b3bfa,0x0002b9d43df50a53,0x00084321b41ee5a8,0x000000007f463e4f}, {0x0000d83b1bb9e3c5,0x00072cf1de56956c,0x000bfc6f76327bdc,0x0002fe29aff4b42a,0x00017399bc0a98d3,0x00049ea49d52f844,0x000e10ae21732abe,0x000f7ce15cd1fa48,0x00000000e555b4a5}},
+{{0x0009ff7d0220031c,0x000ec616a2e03fbd,0x000fcfa79aa30fef,0x000cd756bf47904c,0x000f9a137c4a8b12,0x000d9d4429e5d0d7,0x00048a01025e6025,0x000a9f4dd217a986,0x000000001a770494}, {0x000032ea05cf500c,0x00044b24fd0bfcf0,0x0008fcc69e988eb0,0x00059341fe3b0b97,0x000208b5df3531c3,0x000ea945ced71eca,0x0001f9968d2d0207,0x000e16272b1f99bb,0x00000000bc0be2ec}},
+{{0x000908bdc5deb4b8,0x000966ba0ae8970d,0x000daeda0173f04e,0x0002ca2f2ea464ca,0x0002ee156cb2eb62,0x0007c589435b3fa7,0x0000f0165c364046,0x0004b8371f502fc6,0x00000000a2381f92}, {0x000af40d8804f829,0x000ffd699bd8c56e,0x00083be6e6f63876,0x0001b663f1297788,0x0004d18ab84f7dd4,0x00050a7f7c63a919,0x00015f32a02d57d0,0x0006285eebf982b1,0x000000000d2d74d4}},
+{{0x0009d1b6cf009eb2,0x000bcc948ca775b8,0x00072d8ff434289a,0x000903bf78b19408,0x000b15947603d9b5,0x000443b045f6824e,0x000af6e62f7030ce,0x000931d4bb1dd10f,0x00000000246e1e19}, {0x000c030287b62e03,0x0008b8e679128007,0x0007bef101da8cf4,0x0008d4587144ee79,0x0000a06a32e2f73f,0x0008f5e70afa5bb9,0x000f3ab72e11008e,0x0001e2c48c2aff1a,0x00000000d76a9347}},
+{{0x00064bcc8e9f48e4,0x0009aff1e50eb48d,0x000a11c110d23209,0x000d40565b6ed850,0x000cd00b9b731121,0x00038f4888ab6d5c,0x000520aa31300aaf,0x000b217215a4fc0f,0x0000000053b00a5d}, {0x000995ee3d4970df,0x000b0a3e1e4b6d17,0x000cb668599fdc35,0x000811d7ac375925,0x000ce48f7ff3c12b,0x0007c8820a7d39dd,0x000fbc1c486e86c6,0x000a91c839be519f,0x000000002fdf0c31}},
+},
+{ /* slot=41 [{1,2,3,..,8} * 16^(2*41)] * G) */
+{{0x00077296a264d35e,0x000a22308d7b1f0c,0x0007da23c35898a3,0x000f2b3300b42386,0x0001c5d66b993780,0x00016d8e3ad7b054,0x00071b4a93d57051,0x000ea3744460672e,0x00000000f873790a}, {0x000d9f5320287844,0x0001b281beec0d27,0x000e1af9c88dca3e,0x000ad546221da3ad,0x000eb8b2e4cf78bd,0x000bc9eb05687a1a,0x0003500e4c14821a,0x000531be5d28a511,0x0000000091d0fb1e}},
+{{0x0009506c1f26618f,0x00057bd4a406c9c7,0x00048e85bb3b1657,0x000082aa2bd233c2,0x0005535d7d9c84ab,0x000f104bc1490d4a,0x000b55786ccfa000,0x0004e6b1ab62c871,0x000000001d1ee377}, {0x00088553e7645577,0x000818da5b377908,0x000025b22704f47d,0x000c9b827b9c69ee,0x00084e6bdd96e470,0x0002ce860761d355,0x000e8b14bf294acf,0x000fb6eaa0f9e662,0x000000006ccbf810}},
+{{0x000a7f88ad905c35,0x000dc57773d5cb1f,0x0007c188f8566cfc,0x0006fdd90fa6640f,0x000a1091cb6a829c,0x00007e6cb0296765,0x000e832f73f0cdfa,0x0006f77d2900ad62,0x0000000066bdf40f}, {0x0007ab7a7fec2d2a,0x0002b69ccb741649,0x000e28badcb6777e,0x000b454204731379,0x000512428e2c92f8,0x00045241be845742,0x00083e64670fe4e3,0x00063597f039c051,0x0000000080042515}},
+{{0x000db1fe5aefb2ca,0x000f1fedcb10fb30,0x0008a5ef112d0d6a,0x00046ddb3cbf74f2,0x000088514b1e34da,0x000165e988a5b555,0x000dd7e8ac0a1ef1,0x000adb3f298d071e,0x0000000024e4a2ec}, {0x00029a868b3d5b08,0x0001d808de7d9338,0x000dd37b329feb92,0x0003080d93f91420,0x000aec9b534be6c5,0x0008098ce321d397,0x00055453692e7259,0x0000b7abf0347abc,0x00000000dd377ef2}},
+{{0x000be8c65ba4fe1a,0x0009a15d6cc57c6b,0x000fcc753968e5a4,0x0002489025c2ccd6,0x000e95ae482868b7,0x000f5dcd8fb4b5d0,0x00034f84b710fbc1,0x0001befe3f548a6c,0x00000000112e65b0}, {0x0008493fee3751ee,0x00046130c5cfce13,0x000acab25f943ae5,0x0009e19d1b374aac,0x0002dc71187407c2,0x000b74b8bf5d810a,0x000bc53361d4f857,0x000b5a652d234088,0x00000000ff5ed897}},
+{{0x00045ca1388059aa,0x00096e813d6d8c1e,0x00003fa90cb3def5,0x00068f9fb5764601,0x00069b4bfc11a06a,0x0001016b7630f223,0x000190f57b13b7da,0x0006c1921f9ada62,0x00000000289d294e}, {0x00078fdb6546396a,0x00054c2a46626eaf,0x0001d2fc7c243cf2,0x000a412db41c717b,0x000f2fd3f00ce1ce,0x000b4a75a4b22406,0x000e88291772e45a,0x0002850f53b60db5,0x00000000f8e62f29}},
+{{0x000473f0c83146cc,0x0003e4ed0bdb86d3,0x000deafd20675523,0x00082d3aeb608d06,0x0000e94d22b3ad3b,0x000d768e273effbb,0x0002b26a41cc8512,0x00025036b5552dbf,0x000000004f782264}, {0x000a196290383324,0x0009609fb0428fb9,0x000175d9bb6cec2c,0x00077f1252ecbc3a,0x000910615ff25fb8,0x0007dc2a63bde14f,0x00009fdae18a244c,0x000beef71b96778b,0x00000000642e57d3}},
+{{0x000b7f38ae4493c6,0x000ed5bab321f31f,0x0007d7be77a3b08c,0x000ea7c7d76a9099,0x00059384f4e6863b,0x0006ba35639dcc0a,0x0001c4287e947547,0x000fb491cd822724,0x000000009d9a789a}, {0x0008a7c7b72eef55,0x000d4f58bdd779b7,0x0006e8b1d1039033,0x000badae2ead0daf,0x000f09af10bd12ac,0x000c650b9a080928,0x000d057d829244b6,0x0003f6f4ba712aa4,0x0000000002b7dbaf}},
+},
+{ /* slot=42 [{1,2,3,..,8} * 16^(2*42)] * G) */
+{{0x000935192b38dcdc,0x000635716a022330,0x00001ba09b962503,0x000d92343e4b0599,0x0003b0fe22afdc3b,0x000d3c95225121f6,0x0009397f683fec45,0x00039218371cf68c,0x0000000034622cbe}, {0x0006abb03c9c5e74,0x000e4c538f66c6d7,0x00046bf314ba6ff3,0x000020562fac6de9,0x0008a0c855909bd6,0x0000e682365539f3,0x00000bacb5278c13,0x0005f615a56d5e10,0x0000000086fea580}},
+{{0x000fb09cda4d2d54,0x00054e9bb7488f4e,0x000ff4a3c514974e,0x000855a862959591,0x00061b443db082d5,0x000df182adc8ba00,0x0009519ed0902d46,0x000876d14f2b9f58,0x00000000599c784b}, {0x00020eb9728c88f9,0x0006f3e7cfbc0889,0x000201826c601074,0x000f18cfe3d0ee01,0x000dd5291d759d0b,0x00085fe07478f985,0x0007fbc312f684a5,0x0002f90a222794b4,0x00000000abace58a}},
+{{0x0000f16d3904f27c,0x000871de353d153e,0x000feb494758a985,0x0002f595fcdca8d5,0x000401a6f5539abb,0x000e017079bc4ace,0x0003f76b0d89e1b8,0x000a43b227b6f009,0x00000000efe09763}, {0x0001478ae79c11f1,0x000c8ad75b6e35b7,0x000b3bf77f6f69d4,0x000998d6e3a35677,0x000bf636f5b811e3,0x000e07c97f71c3be,0x000df22b58c417da,0x00076b9178586e9b,0x00000000bfd57787}},
+{{0x000610ac18b33a4b,0x00077cd37584da22,0x00033060ac14d8c3,0x00060083e62e9047,0x000792792ebd9c4b,0x000848ae6ddbc784,0x000fe8806053652d,0x000ee7feb0ca5f7d,0x000000002c94ba22}, {0x0000e15030569f8a,0x000a412c31d90148,0x0007a5fbd760fcb6,0x000137de208a9302,0x000e5dac1dc65631,0x0008e918ce00798c,0x0002f55fffc6e62c,0x000f43c204de7fc8,0x0000000088ae3fcf}},
+{{0x00084192f5f64c06,0x000943a15e21661a,0x000d1ab2cd825885,0x000c3abd2c83586b,0x000b5dd4a12346bf,0x00064ba37a53a83f,0x0001329f3f4614e8,0x00019941e5e6e2b9,0x000000008ebce696}, {0x000420ca2e5f1350,0x00073e17a2d8b21c,0x0008c3f842dd6886,0x000394f30097787e,0x0005607acf956ec7,0x0007163df091276b,0x000e9ebe2f3a36fc,0x0000340db01ddc02,0x00000000a638e724}},
+{{0x000226ec863a486f,0x00049b123bfc64f2,0x0000d8099fc825e5,0x0006009eb38cc642,0x0005c32d9c4f4023,0x0007e26867f82ca1,0x000cb49d593d2be6,0x0004f73264f05b79,0x000000009d3717a6}, {0x0002759ce3297e21,0x0000201fa2f5e065,0x000ae81ef922d93b,0x000b0106964ec90d,0x0004ad237659620e,0x00080646f05670d7,0x00040b74cf5d5dac,0x00081c9518f3f725,0x00000000f1e3bfe9}},
+{{0x000c8f333e6a9f57,0x00084d1a4bf3bbc2,0x000a1afc9e4c778e,0x00045144b954c54f,0x0007e45ff9d91d34,0x0007f8bdae224977,0x0007435a60caf8c6,0x000ad0ad3d82b254,0x000000008d69d424}, {0x000d14087f98f88a,0x0007e16dffa50394,0x000dbaf6da48bd26,0x0002b16e00828921,0x000a7289274ef2ad,0x000033fb1861f0a4,0x00011e6debdd1c1e,0x0005cc317d7868db,0x000000004337c3c8}},
+{{0x00012c5ae07d04c5,0x000fb46cd42fcce3,0x00033efdde1fc2e2,0x00040ca76a3f4b23,0x000facede6d1d093,0x0009896d63ec517a,0x000f8a80560257d7,0x000c64c7cbb2f1fe,0x000000000e667f47}, {0x000b5f9fe602db8b,0x0005a5d674edb531,0x0002ce134db0d094,0x00030c50f10ef27c,0x00040cadc9bfd8db,0x00090a3e6b9e2fe9,0x000b3635621e2148,0x0001dbfb2d14be2b,0x00000000899ffa63}},
+},
+{ /* slot=43 [{1,2,3,..,8} * 16^(2*43)] * G) */
+{{0x0000b7c6ca81661f,0x0003a5bd55e83d6b,0x000ef4f4602224a3,0x000788ca64314e6a,0x000f3f91a93dc014,0x000a94575495e070,0x0008e60fb13021a7,0x0009ad5bb3b89af5,0x00000000cbbe2edc}, {0x0008d9390bf5ac2e,0x000d8e2287bc1f25,0x000cfed768f990a5,0x0000c39cd2dd5091,0x00081eae50a52123,0x000d84d00d25643e,0x00070e4f709b7840,0x00050f97c072f11c,0x0000000065fcc749}},
+{{0x00049f1fbce44310,0x00025a8fdea638d2,0x00003bc8b23c68e1,0x000f73abd746e531,0x0006e7bf0b194d6d,0x000c5006fe798a3f,0x000c554850c63752,0x00001b4691041e7f,0x0000000040a3c2ec}, {0x000ad219a4ca979d,0x000707fbda5f2a8b,0x000f111d9c73d08e,0x000dc66258e6822c,0x00026b016eda230e,0x000f95d955bb02cf,0x000162e8d08c362f,0x00091ab3956b56a7,0x0000000075195fbb}},
+{{0x000014534822792f,0x000266ff12367812,0x0005a3c5cf2ddb22,0x000917a316bfbebe,0x000a6c6b819edd7f,0x00021ef373e4a1f8,0x0003db7188611316,0x0009cfe9f2328282,0x00000000d529326b}, {0x0009e7c26d0d7cab,0x000803339e15c47d,0x000299b4885028bd,0x00057af76c9f78a2,0x000432831af17621,0x000e13a553aa2761,0x000883b21e4c0e60,0x000face61a384e74,0x0000000052035102}},
+{{0x000d98a8465cb3bc,0x000a2b512a991f61,0x000331fe997aa87d,0x000c0418bba8b200,0x00083bd3050178cf,0x0000186225e1e6e7,0x00023a279ab7e1c3,0x0004dcebb8175bfd,0x000000005b888e76}, {0x0005a4c67c97cbcd,0x000eb3442422f388,0x0001473e8f563380,0x0009ad2207042f83,0x00005cb52c88fe7f,0x0000bd227702ed5c,0x000680f81eb07b51,0x000fdaf91d217e31,0x00000000400a0d79}},
+{{0x000da1feedabf629,0x0002c6b754ac9528,0x000dfccd42854ff0,0x000fc1b2165cd319,0x000a2727474dca0c,0x0007fb246c69aa55,0x000eff2cd46ffbe9,0x000baa61b07a652c,0x0000000036527a6a}, {0x000504813ef5ec11,0x000f8d498373d277,0x00097cb70e389dd0,0x0008190a9b2d1b55,0x000136e4dca75dfd,0x000d101cb66814cf,0x0006e15fb40bf14c,0x000d6a559f3c6805,0x0000000014d90c9e}},
+{{0x0000cf2080b0bcff,0x000282daeadf4975,0x000c3514ae519cc6,0x00045aba2b78ba32,0x00039ac204fbaa6a,0x000b2c31ed2f53c3,0x000f9cac31c362de,0x00007c01d1ac5f11,0x00000000ff64617d}, {0x000df54b71176d44,0x000de153b24692e7,0x00087ffb915d241f,0x0002f7575e711267,0x0003c256589a2d26,0x000adfafd74c17dc,0x000ef586f7ec292f,0x0007c3cd590da6eb,0x000000001a71f40c}},
+{{0x000785868f46cca7,0x00047f427eb36901,0x0009cde889a6713f,0x000cd54242b76a1b,0x0006d691c273f083,0x0009c90b982f78e6,0x000dcf37aebca6d0,0x00039b43e8df5ec5,0x00000000f5f51452}, {0x0003026f7d7744a0,0x0003a5600d3ef952,0x00077c00899e0706,0x00055a969e76b69c,0x000a6a7b0f8ad1c3,0x00064e42e55a78ea,0x000b5e75b1279070,0x0003846ed7b61652,0x00000000310bfa01}},
+{{0x000c83cbf13e3448,0x0006b291234dcc99,0x0004b533d56abf1f,0x0004267204714af1,0x000f9e4d394ebfd5,0x00086c188170430e,0x0008efcac9992808,0x000b1d177efb75bd,0x000000001c0fee3d}, {0x00012754287c20e8,0x000d886d32d360e3,0x0008114da466e136,0x000ce72923a425f4,0x0005f84ca29b9e5c,0x00064fcb89212da3,0x0005ed5f1d0d82e9,0x000d4c766149e2b3,0x0000000086f0457c}},
+},
+{ /* slot=44 [{1,2,3,..,8} * 16^(2*44)] * G) */
+{{0x000efad55d2c4ff7,0x000bb4be2310cbfc,0x000a40278d198d8f,0x0009653819babba3,0x0004bf3e829ac1b9,0x000ba005dfb66809,0x000e1f6bdbf4fb11,0x0005bac597a51ccb,0x00000000580d281c}, {0x000219e454d8ef6a,0x0009898455e8bad5,0x000ea51cb38b0932,0x0000ef089c2c6933,0x000be560e8a53101,0x000a8dc778dde8b0,0x000f4cf67a8eba1f,0x000061c48e3f3cd2,0x0000000076a2dba1}},
+{{0x000d22101adfdd95,0x0009083139f132da,0x00014f468d0f0b3e,0x000cf68d5ba10486,0x000aee2ac88620f5,0x0004af5e612188cb,0x0006ba3f4688c8ce,0x00049fabd1e14e14,0x00000000c8ba4551}, {0x0008fe55d1d507ed,0x000dac77615e0fbc,0x000aac17603de7ee,0x00083fd033600f4a,0x0004a77e7d633b50,0x000e72b8915b7a6a,0x00037da3ae1b195f,0x0001a64b535641e5,0x000000008f52425e}},
+{{0x000d5763f85fcec3,0x00083ba9986de29b,0x000c5f5a72052fde,0x00003810a9f9970f,0x000950f37b8758a2,0x0004ab4925516032,0x0006b3c6e5bffb83,0x000fa0d124e3c95c,0x00000000ce5fb1a3}, {0x00018694481d82f5,0x0004fab7cde80c3d,0x0006faab2a1ba624,0x00057d5247647946,0x0006b114ef519714,0x000391b1db5146b1,0x0008f7dce6a7693f,0x00084f28c6875e14,0x00000000e7728299}},
+{{0x0007143270f2beb2,0x000bb97c0cf15d55,0x0007dc4c20fbe4a3,0x00060685f18e1785,0x0009898636633ac2,0x000b319dd605c576,0x000661ef8288853b,0x0006f52cf56218ab,0x0000000092510d3d}, {0x0005d8d1be1efac4,0x00092acb5b1bee7a,0x000403c407e531f0,0x0006e2b3b0e99abd,0x00044a9643c73cfd,0x000e0519a38b7177,0x000a834022ec73be,0x000083f624b0ae3e,0x0000000034725e50}},
+{{0x00067992bf9157bb,0x000ee040a6db3574,0x0005819f7824c49d,0x000aa84207198010,0x0001e32f6928b04b,0x00043897a1536eb8,0x00005e859c49a19f,0x0000358d3b3bba94,0x000000002e703a4c}, {0x00088cb3755e129d,0x000599408ecd9488,0x000574e3acc4c455,0x000bf30bcdaa5300,0x000074b69679904d,0x000ac3f0dfec8030,0x000ebf640d402da5,0x0007a5e1d70b556b,0x000000004227b3f5}},
+{{0x0002f87526032d25,0x0007c07aba177a0d,0x000e34db034167e0,0x0007864e8ba82505,0x000b0e3f7a97fade,0x00057ca0d62eb927,0x00050a1f62ccf169,0x000235dd999f45d1,0x000000005d5cf539}, {0x00070500decf47b8,0x000bc144deca91f4,0x00082c1431e0460d,0x000ace425e0e03e6,0x00051b2605d43a4b,0x0000d22fad0a8dd7,0x00043d1be3a92f27,0x0000bb599207423f,0x0000000019c480bc}},
+{{0x000c4fea56b13566,0x0008c10832f221bd,0x00088126a6330e31,0x000ed1584342f0af,0x000ae04b20a67fa9,0x000ad74dfecdfa52,0x0009d91983a3aa12,0x00052663368b0b5e,0x000000008bd91a17}, {0x000817b03119193f,0x0002af7aed46aa97,0x000fb69caa77ca52,0x000ea683db7e0672,0x0008206885471993,0x0002816c7f9066ad,0x000e949f4ec6708f,0x000ecb54931b2d3a,0x0000000027272eae}},
+{{0x0008025b7527ae17,0x0001b2fc7e991ad0,0x000a57a160aa7820,0x0000f6079485beb5,0x000dbf82af5fc3b1,0x0001a101abed190e,0x000dc055b118a0e5,0x000ba4ce3fcde384,0x000000006d8d87ec}, {0x000d69d70e14bb06,0x00045d981826b0a2,0x0003e12c6c602422,0x000c1a0a05148142,0x0007714ec4d6539c,0x00033e517e5c4efe,0x000dbe450eb1d80c,0x0003b726162bfeac,0x0000000099215d31}},
+},
+{ /* slot=45 [{1,2,3,..,8} * 16^(2*45)] * G) */
+{{0x000d2fcfea2e5ee4,0x000541aac1ba0207,0x000791e912b6c505,0x00096ba694fe63b3,0x0008b842fb22dab6,0x000f21e11e38c6bf,0x000592239ce17eb7,0x00074470f24580fd,0x000000000db34f79}, {0x000bf19fc29d3ed2,0x000a18cbbb3c9131,0x000ccb7e61d8a0c6,0x00047d2d2b78fb7a,0x00003ccfa8468592,0x0008cda2204b37a8,0x00038c75fbcec860,0x000778f591742013,0x00000000aab8d6cb}},
+{{0x00012752cb1e29c5,0x000c9e86ade000f6,0x000500d042186eb0,0x000fb77a0c598345,0x000963cd766c1562,0x0007682b583b6abe,0x00093faaf09c7d52,0x000795724a0e081d,0x00000000ffbe4c49}, {0x00061912e449cc59,0x0000b64ea51ad381,0x0001a887c14faadd,0x0009e837035273d0,0x000fd384375a88af,0x000279a0cfcaf07f,0x000161b9ad96f283,0x000103ffa448663d,0x00000000e7144438}},
+{{0x000db9aeb439a11f,0x000b1f6cfd65ad4b,0x00056a7df00d9705,0x0004a2921f4eb66e,0x00031bd700aaaeae,0x000bdb39fb2a2baf,0x000ce6d6719fbb8b,0x000c0e0ba26768e9,0x00000000037140ae}, {0x0007fa71b682f7e4,0x000821f2f21657e2,0x000f3dca9367671d,0x000409ef654c0b19,0x000b519a5da39837,0x0009300d665bcab8,0x000f915da32a4917,0x000b3acd7218ddbb,0x0000000082fb9f0f}},
+{{0x000cf18be29c07a3,0x000c8edeeac911d3,0x0002fe7a998e0467,0x00013e7ba6521848,0x000565f171f2b6e6,0x0008d3121c77f14c,0x0002dac28cf92b36,0x000256461052a338,0x0000000089da05a5}, {0x0008e1b033c04e44,0x000c59e4c5676d74,0x00006f372de59504,0x000513df4adf564c,0x000d25d16c532e7d,0x0001421db6e95422,0x0005887221bd79c9,0x000a20aa86aae436,0x000000000ac211ce}},
+{{0x0004311daf30503e,0x000ae8e3c7685a07,0x00096dfbaf06f8a4,0x0007227636a9e9fe,0x00027cc981699bc8,0x0006678e2aecaa72,0x000b293e1ac85e4a,0x000806428f2402f6,0x00000000367db7c5}, {0x00092011e243bef7,0x0006d9068b1bbf08,0x000c81c3d3f78d26,0x00066c4fb131d88f,0x000b11a682869787,0x00090542ce34c89b,0x0002fb9186d2cef3,0x00067f97662d0a63,0x00000000b78279a8}},
+{{0x0005b44b8eae97c6,0x000ff467660ff6ed,0x000a3c4d627c781b,0x000667fbb8a0c8b9,0x000e0d7028568957,0x000c825a42c8c882,0x000b9cf68e54bf18,0x000be28cdcfdbb6c,0x0000000092968215}, {0x000f7281913142e7,0x000f2638afbeb3b6,0x000f8875d78cae4b,0x00089167c3744921,0x000be5437de635d6,0x000d04b24895b9b3,0x000a2bd9944d57ad,0x000fe78204855abd,0x000000002804ea1a}},
+{{0x0000b5ba15081065,0x0009f9aa8279e970,0x0004078fbd555044,0x0005f99e728e8ed8,0x000f08de69f5cf12,0x000d857733c8b2e2,0x000a76bba618a315,0x000506e0e15ecc6e,0x0000000039877719}, {0x00029f2a64a75a73,0x00063ac815795bf4,0x000384a5b31c9706,0x000f2e8f41d105ca,0x000bf9422968e7a6,0x0004af74d17214e9,0x000c8b0d12652017,0x000eb6fb5c4cb5ad,0x0000000004f27d1d}},
+{{0x0008926b60994a12,0x0000380e02f7bcb0,0x000f96a003fcc733,0x000b963d532f1973,0x00038f73cd2a0792,0x000d1878ade82f28,0x000dd3da4c9c592e,0x0008a2830f622cdd,0x00000000f7b46fcd}, {0x000769f267e948b9,0x000af19c657214fd,0x0006d3452bfe0262,0x0008a8993db7d156,0x000ec7ba233ff509,0x00012e66db62bc85,0x000dd6eec7eb6b5a,0x00046c26ad2a9045,0x00000000de101b74}},
+},
+{ /* slot=46 [{1,2,3,..,8} * 16^(2*46)] * G) */
+{{0x000fd36deb98e97d,0x000145fac5756647,0x0004322175cebdc7,0x000c9912b54f7376,0x000c30374dfd9f4d,0x000572cdba2a8c71,0x0005e153faf8b279,0x000b3b8e753050ac,0x00000000457db8a1}, {0x000a016158c4ed63,0x000c820fd12a3363,0x000d7ee2482afc5b,0x000335fca027a83e,0x000dd2f2b72cd198,0x0007e2961abbc073,0x000ecc4bf4dacfcf,0x000dc82fcc629784,0x000000005de9f9e1}},
+{{0x0000884baef2a514,0x000af37f6b1f81b0,0x0008c2ff2bd5ed43,0x000097b25670397d,0x0001d7b49920daaf,0x0004f50657fbf8ea,0x0008ea28edca5870,0x00077943de111207,0x000000006ab9c19f}, {0x0000a3d6375c43f1,0x0000ad6cdae7bd82,0x0009e8d5a40014e5,0x000c1da993ac4452,0x0003f35fad198d76,0x0007de1ea2f457d7,0x00041168095be058,0x000b0dc202cb2c5f,0x00000000725c7c7d}},
+{{0x0003473401e7d9f2,0x000d4b9c8eda633b,0x000e916bf3c6029a,0x00061a22da743680,0x0007144762ce4a68,0x00031d6768ed6acf,0x000b8c205f578ad5,0x000f6a5e98e2f381,0x00000000294116b0}, {0x0007fd7f9eef9ef0,0x0007eee959019d26,0x00020e588db9690d,0x0009fad0e31be347,0x00000d275fc3fdaf,0x00001caf09842909,0x000d92b3d84b7969,0x000abfeed0d25a4b,0x00000000cbc0f79c}},
+{{0x000053b7869aec18,0x000eec1cafc729f6,0x000cb674f5bb3083,0x00043e83fb848c63,0x000af01ee1ebe14a,0x000c031dadf54884,0x000a34b30c2f63f6,0x000dd3419545efa4,0x00000000ad424b12}, {0x000a9214a4ce1a0f,0x000d7c00bdc14bf4,0x000da4ca91f172f5,0x000068317a9aa211,0x000b935d98c3501a,0x00012dd601d9b71f,0x000a294af1d48bd1,0x000c8c09def61d00,0x00000000383531f0}},
+{{0x000c8d55f1897f88,0x0006b87a3698e512,0x000253af954ed960,0x0001e02f16f90217,0x000650074530df13,0x000d2c3d91c6af79,0x000aee10b028af66,0x000cb4ea5b50b72b,0x000000007760b9ec}, {0x000b822e8964b68d,0x00073379209cd646,0x000f827fae883d7d,0x0002f5f3fd05dc49,0x0001f9bae4bebf3f,0x0007b8d64a8ce761,0x000cde2f38dc38cb,0x000641bcabc45c9f,0x0000000016efc9b5}},
+{{0x00050aa7e64183ba,0x0007160d45d27080,0x000ad7ef93df4eb4,0x000b1c0cfb9ae8f3,0x000f0c587c9ff792,0x000b6236ad6210ba,0x000ef2439d78d44b,0x00037db84477a322,0x000000004b53095e}, {0x000e201ba584e070,0x000fdf4ff19b8a46,0x000fc3fbb6402aa6,0x000336ee0b586449,0x000310c87bec3093,0x000315d1fba08286,0x000e1811dea8bc62,0x000c3fe51dd45c8f,0x000000002ed6ea20}},
+{{0x000ea336edbb2275,0x000cbf40256853c9,0x000f6f2044866383,0x000023c9bd571b54,0x0005b8b56b6f3bbd,0x000e5215ebbc4cb5,0x00063bd80c896d42,0x000a723f19e5ce25,0x00000000cb05953b}, {0x000ec672ff475cce,0x000497da5ed9aef0,0x000dca2cc873762f,0x000a235362c18bf7,0x0009bdaa1c816f23,0x000e41d7d3b08328,0x00010a988e771755,0x0002766db87dca47,0x00000000f44bd4ab}},
+{{0x000d5064b5573511,0x0004159795d75834,0x000f4ce84900e03c,0x000189e3e80d728b,0x000b61bbdfaf4c43,0x000016e4a7f695e8,0x0009cafd54c7fae0,0x000448abd4542d18,0x000000002250a17e}, {0x0002568258fb152e,0x000c1a5ffa02d16b,0x0000d491f798cf3d,0x00096210a87925ef,0x000dcef9454dd018,0x00094ff270333343,0x00000efb2561cff9,0x0005fd59ad978194,0x000000005a7fc1a8}},
+},
+{ /* slot=47 [{1,2,3,..,8} * 16^(2*47)] * G) */
+{{0x000787c7aeac5a5a,0x0008a2cdd5c623f2,0x00025419e68c7e0d,0x000876439f556d43,0x0009338f400beffd,0x00077c3fbf3236cf,0x000f03d2a67e9933,0x000dab6d9756cbc4,0x000000002997ab9b}, {0x000d086fd897221e,0x000b848d2e2313aa,0x000e2b1f5efc9704,0x000631fe595ea175,0x000f89a114d67845,0x0008111c35bc2e66,0x000b4ddd955296cd,0x0006da62e23b3617,0x00000000b15fa89e}},
+{{0x000574d49c187746,0x000bcd3c14043a70,0x000fadbedc9d732b,0x00059f0dc325d024,0x000b67d90306fb50,0x000bc6aa0c66b06c,0x000f30107111cdc7,0x000e085dca0f98c9,0x00000000b72fd495}, {0x0005eb35aa23a217,0x000ed43c48c0e628,0x000b72691017faba,0x000961ce2f7829d0,0x00064f711dbc4df7,0x000d25eb8d712eda,0x000f4af367aaf2c9,0x000dbca96eda6f6d,0x000000005be2d67b}},
+{{0x000b7be09314eb78,0x0008c3b720ed584b,0x000a94876f54161f,0x00076535b27099bb,0x000ff39f3368445d,0x0009c9373ffc891b,0x000a68199741edb4,0x00032c67ff3d7cbe,0x00000000d981c08d}, {0x0000c93226777dec,0x000bfaab75d48bb5,0x0004519f048e840c,0x0006ca2b671fb422,0x000741296d279cff,0x00032fb9b6ba7cc9,0x0008366c2cc5dc1a,0x0007ea5eb6523932,0x000000003d1894bb}},
+{{0x0009165e51ad7e61,0x000841f2e49aaf17,0x00078442a7ee2490,0x00063b703c46fefb,0x000148e7a0b461d8,0x000a95c94b2e5304,0x00065909493f6003,0x000afd512ddd3059,0x0000000069f66698}, {0x000639b9ea577cde,0x0003595d51e17ed5,0x00081f1820dce891,0x000e6b152a7269db,0x000ce34ea21189f3,0x00081319093a0559,0x000c4ccf3d6b7711,0x000ca8c0c434a502,0x00000000662f72b6}},
+{{0x000837dcbfc00687,0x000a30eac6f32400,0x000a014e409bb12d,0x000eacd657f18184,0x000a37ee9f08d6aa,0x00061985cb895ef0,0x000003f9605be94f,0x0006196258183e75,0x00000000cc261090}, {0x0009cb97f7d08a32,0x000bbb434a1dfc00,0x000130b6b53bb9ca,0x0007bdad6f443192,0x000c7018abb86603,0x0003fbf453d6d274,0x000bfbc03123b89e,0x00079e6a5142ac3c,0x00000000495ca42e}},
+{{0x0003330ce7eb36b4,0x00031b10373ac4cc,0x000fe45176cb4d04,0x00072cb3689afefa,0x0003652325e72403,0x000b845b3d44330a,0x0009537a1531f413,0x000473c2838ff0e8,0x00000000656e343c}, {0x000eebd50250ef9e,0x0006123371d49386,0x000cca0d21a5ccba,0x000a0d6415d01359,0x00037f3a55c7b9ee,0x0006a480432ec47e,0x000e675f957cab76,0x0004ffc920f3a5a2,0x0000000038afca3f}},
+{{0x00017d72131ee517,0x000bf42cd2371222,0x0008320a92725bc6,0x000bd7cc3ac70561,0x0001469cc5491607,0x000f14d950809a60,0x0002abcac386ced2,0x00015fef1a6fb808,0x00000000176e1536}, {0x0003dda5b45af834,0x000b05cc9b99d01a,0x0003f2e427335b27,0x0009d2e8a22d9c9e,0x000dc667d76e1a52,0x00033cca45c7dfe6,0x0008c85cfcba3cce,0x0007788ce9eb13fb,0x00000000b6b4b5ba}},
+{{0x000b86690b38f5ed,0x000b0d3f0b9ec18c,0x000a98d37ca97f95,0x000c64ee883b6a1a,0x000c0839449c5a82,0x0009cc2710a3f520,0x0001442d4b720a36,0x0004d77a3abccc15,0x000000008ed3a85d}, {0x000e329c17999dac,0x0008598022ee26f0,0x00016678014f2775,0x000226deece84a73,0x0003d6f5d6be9d9a,0x00015ef4ac14b8dd,0x00029a04d15dfdd7,0x0002cb30064b8b90,0x000000006a650e9f}},
+},
+{ /* slot=48 [{1,2,3,..,8} * 16^(2*48)] * G) */
+{{0x000febe757f8dde2,0x000dd8f3d6f0fe70,0x000bc2d34659205d,0x0005fb5456acbafa,0x0006561e065e8d01,0x0001658d84c63f73,0x00044416d2b53bc0,0x000ffd52960e7102,0x00000000b9fba773}, {0x000674eaf9b63d72,0x000447102eb72a3e,0x0009f7085d8677ab,0x000e4bcf356df288,0x00014dd2300534f1,0x000880d113ead600,0x000ad37c9ddb33d7,0x000a50f0fba4ec4a,0x00000000a42ddbff}},
+{{0x000eec5ae89b0264,0x0004ed592c9f2f8b,0x0009ee01606b69c8,0x00082af09f5f5f14,0x0005c2b8009cf7ca,0x000e36b19ce1833a,0x0005bdd464401818,0x000099e0448566ab,0x00000000b00408ab}, {0x0001dded651c00f4,0x0006d8200e72ece5,0x000fa512f673778b,0x000d5857c4699e5f,0x0006ee8ee69b5197,0x000a459411bb1bdc,0x00066e3a0ce20bfe,0x00061d51a508b50c,0x000000001952cf22}},
+{{0x000d4ac0ff63b343,0x0003de0c2f8af608,0x000352266df94037,0x00062631c4a77434,0x0003683fc8b8c366,0x0001f68e9dec77c0,0x0000f89008794a61,0x00027de90abfb0e7,0x00000000f3dc3d9c}, {0x000afabbf71c87d9,0x00096a1fcc918cba,0x000cf0b455ea6c8a,0x0005278435e4a32a,0x000b2ceb2474d31b,0x000e91cb9c266862,0x00066624070f7772,0x000906ca255ba4e0,0x0000000074e6704d}},
+{{0x000b0c017c6347cf,0x000064b167f9e7d0,0x0003ef3506e52a23,0x000710b9ee2a4856,0x000ef71a5b7a59f5,0x000260cf67567ffd,0x000f1d12b829eaef,0x0003fa7c711ef44d,0x00000000a49f31ad}, {0x0003de0faefcf7bb,0x00009cdd2a9fd119,0x000712b9712cd533,0x000c234b400c68f0,0x000a190c7b05cff8,0x000f9d89db62e532,0x00021803a5323577,0x000fd5c3bfdc65ee,0x0000000044ded9be}},
+{{0x0006b7922bc8b6c7,0x0003ef928c5708b8,0x000f70641cb44297,0x000cdd5a64c81890,0x0009c2d4999f54d9,0x0005f80b962ba4d0,0x0006bc11d81a97bc,0x0004c638e61924bb,0x0000000055c66af4}, {0x000ecd6ef8a85c61,0x0007ad2c3e30475f,0x000b25e326d66d94,0x000476e85a46cdfd,0x000ceb5785219285,0x0003228ed01efb60,0x000d407f7419483b,0x00004f609ad63525,0x0000000072483c42}},
+{{0x0000eafa0015fa97,0x00018f08d0d85100,0x000a937a89f5b623,0x0007be9d33c9abc5,0x000d6ca82aa35dd0,0x0007c2a981562968,0x000efa58158f59cc,0x0008aef715f114ef,0x00000000875550f0}, {0x0003525745b0f70a,0x000b8d0e75384bff,0x000dd04afcb7a3dc,0x000390f14a9e53d3,0x000d70592e9c8b38,0x00042104a0d4ba9a,0x0003f95317413e5d,0x000a2a5357273695,0x0000000088ce6a22}},
+{{0x0006f1abe53258fd,0x0008bfa779691d1c,0x0001d580f88fee97,0x00069ed776e6e346,0x00080f482b7b741a,0x00001cdd17028221,0x0008c89aaa447e61,0x00029ab51666937b,0x000000008b4f2ae7}, {0x0000f5e0dbde56fa,0x000946aee8df70cf,0x000dcd4bf1ce58f0,0x0002f2576446988d,0x000fa4539b50d598,0x000cd9a09104c1be,0x0000139a4772761e,0x000061c218d6b22f,0x00000000f28ca9b2}},
+{{0x0004e7aac8be6572,0x00057f564fb444ea,0x000f82d19c651d79,0x00053eb97d80ba7a,0x00001340b4818261,0x000b46bce9d62314,0x00043efa56856b0e,0x000ab7ac232d4bb6,0x000000004487299c}, {0x0009f90459d24f09,0x000cc539f9c73b00,0x000bf6cee490a613,0x00000726a1c60703,0x000b87eea998d4a7,0x000c29bebbfa1b7a,0x000879265553cc74,0x0004d728f94b16f7,0x00000000781ecec4}},
+},
+{ /* slot=49 [{1,2,3,..,8} * 16^(2*49)] * G) */
+{{0x0006dac97642889a,0x000100bcd7146e19,0x000e00c5cb1936ed,0x000daf8f6460f7e1,0x00004b5d3a774494,0x000f4b9736aa99b1,0x0003ebbd2c649f23,0x00018f31e5c44cd7,0x00000000d01f2995}, {0x0002a52940d43bea,0x000f232e58ac9da1,0x0008734972787dea,0x000714efd2e5ae63,0x00049d6775faadec,0x0002f5af2dc8dff1,0x000f956aa31c4db9,0x000673e39ea117a5,0x000000008d8af171}},
+{{0x000c1f94e89ed4b1,0x000200d20f059a6a,0x0003ad3a8461e886,0x000e9d5f5a209002,0x00094de38b40b7f5,0x0001761a149dda49,0x0006db96c8894ff8,0x0002c9484bf83d92,0x00000000a9605265}, {0x0009297fee80963b,0x0002344f855ccf44,0x00065418873129e5,0x0009580383775cc3,0x000b2ea1a45a9206,0x000af85f0f9e6df3,0x0001f986a5ee5f7e,0x00007fd1cdd9cd58,0x00000000a18fb0d8}},
+{{0x000c0ea1de89b518,0x000448fa5581274e,0x000fadc303e3f535,0x000bb5d01fb462c4,0x00022b640786f9e0,0x0009dac60a5e68ea,0x000a10584011b21e,0x0008cf81f5de0dbb,0x00000000cb37e5ca}, {0x0004912f78e9709d,0x00069f5cf5f255b6,0x000ddfee7dd70fda,0x0009283890a5084b,0x0004ff5a6bb209c1,0x0008b59d95e28f04,0x000bb43e6d362678,0x000fdf8ee5baf927,0x0000000059a50644}},
+{{0x000814d909e029ed,0x000dc582d8b2817f,0x00023b3fb0c20f31,0x000e63b0c4593bf5,0x000a405e3b5fc84c,0x0006f04d82912ff4,0x000a06e1e3dd85e6,0x0005af9e657a8579,0x00000000d3349574}, {0x0008852473a6edef,0x0007c47eb849c0b6,0x0001018778b5132c,0x000f91d91e19d4c5,0x00020962ececba14,0x0005bc21903f5f43,0x000eb108b04ff0b5,0x0009fae67229f255,0x000000008d018285}},
+{{0x0000f6e0a21235d2,0x000698ac2360345b,0x000d2e1d9e3b4d01,0x000a2441774004d2,0x000c3b52c95a257e,0x0006f63d9bc47ba5,0x000262640de37768,0x000399627da30bab,0x0000000076863083}, {0x000c9d7dd17bedf8,0x0006c3e24457be3f,0x0001f16339134892,0x00086382ea6b78bd,0x000ac763a56fe268,0x000a00dce48124d4,0x0009021d0852562a,0x0005194281ee438b,0x000000000af1c686}},
+{{0x000df23b04b2ea8e,0x000a9715f947b4ad,0x0003b8fbc8e39a2d,0x000cbcd093e16e90,0x000c1a4d608665c1,0x0006cc6daf61bad9,0x0002f1f0e8de6eaf,0x000d4deaf1aa22d7,0x00000000beade24e}, {0x00096e1433517bf0,0x000b344c37b14cb3,0x0001d9426116f6a0,0x000e81be6e6d5b5e,0x00054fef343a9c96,0x0009ccbf45328dd6,0x00065bf4438fbf45,0x0007ae896a18bed7,0x000000003b5220cb}},
+{{0x00006e32ad4331e4,0x00093ead5b4d8449,0x000c3fa0ec8442b5,0x000612cbfbc3fc54,0x000d7de4b941d693,0x0000ec14026daeb7,0x0002ce364c9de823,0x0002f457b46fd01b,0x00000000c7117310}, {0x00090da7c48a55d0,0x000450732d8c7cfb,0x0003abe58c5f0177,0x0006ab058a5805f3,0x0004fe00ac7be7c0,0x000f8dec2fb722d6,0x0008f0cf25e74edd,0x000d9bcc9025469a,0x00000000c3c492be}},
+{{0x00098ece3d95222e,0x000a13af0e9c7239,0x000b5fcbfb2ddec6,0x00097bcf193764dd,0x0002c60971f83cd9,0x0000eb2a32acb856,0x0009c09ef365957a,0x000f7d6808542360,0x000000004b8ea593}, {0x000e3ff14e95754f,0x00057ad7d7cf8577,0x0000594562abab83,0x0006cfeb7330a1d2,0x000c276d6dc0d6bc,0x000f6073b4db344b,0x000f03a2d6a12694,0x000c9098d9195b6d,0x0000000066184f51}},
+},
+{ /* slot=50 [{1,2,3,..,8} * 16^(2*50)] * G) */
+{{0x000bda387ad31054,0x0008af32f3ca5a34,0x000125a1ea2a3b95,0x00001e0979c818af,0x000107953fc84e8d,0x000ba82d2d2d9f79,0x000689fa6b201915,0x00069a5791ca5510,0x0000000040383b5b}, {0x0004eef50991a215,0x00074fb6ec05cec0,0x00091cdd122a9194,0x000624a80b51eb86,0x0003280de522ea5a,0x000a1cdaf1430d22,0x000cf54031be8ac5,0x000ba5a9928ef990,0x000000004f5ab6dc}},
+{{0x000452f681b7dc71,0x000b8bf69b566f84,0x000301a6ce193395,0x000e03a932a4e135,0x000dfa733ecc7ef2,0x0007b77f6c691e51,0x000b457a65f285cf,0x000b02c405aa4028,0x00000000e4b8edc8}, {0x000d4f2d755d974a,0x00014d2687ff53e8,0x00011f476495f99e,0x000e23edff2eddee,0x000fe4794f883604,0x000c34699e6ad216,0x000c388364b6b162,0x0009b96aec0e1a79,0x000000000ca5b560}},
+{{0x000a555cf78c39d2,0x000b0da80d39b0dc,0x00045b8948f7ff31,0x0003348087ae255c,0x000ed0a4f72831d2,0x000feb724a0be6ac,0x000227ea72c07006,0x0003b06df0157032,0x000000008ef4b9bb}, {0x0000574ce64611bd,0x000f7de839e289cb,0x000de628d6de0ec8,0x000b25ef4c894ea9,0x0008ed85e3598727,0x0006310b7a5f24a2,0x000559e4babc64c6,0x0001f04f45a747d6,0x00000000225e29c2}},
+{{0x00052bdf05f697fe,0x00096ea94d420273,0x000a0cb733e5fb56,0x000ea78af214e171,0x00031c6ed90cff9c,0x00020b957dbc7758,0x00082c827b3d423a,0x000fe894e96f4e5a,0x000000000b0ea2bf}, {0x000f99e729beaa23,0x000e2ce0c92f2b71,0x0004f2366d9e7f82,0x00047ddf38a07171,0x000b13e5e0332dfd,0x00099d16cbb56f49,0x000189f817ed133b,0x00015d96828851cc,0x00000000c2dd888b}},
+{{0x000dc4eb62d0b0d6,0x000e9e7ada8ce31c,0x000c68e4f2ffb0e8,0x0007e920ccf15e1a,0x00048b219f460d47,0x000f23e4ff976296,0x0001ed54a4c3dee4,0x000cfc7b51dfb5d3,0x00000000c3116b29}, {0x000c4451e9f58d2b,0x000a92d5162bda24,0x0009d6468136dd6e,0x00093d41c5cea26c,0x000291437214ac0c,0x00006a5ae04d9fff,0x0006587aaa3e0684,0x00008319a8cddb6e,0x0000000007eabf78}},
+{{0x0006663b5bb927a0,0x000e305dc2f9ef1c,0x00067189245e3e56,0x00029051e6b222a6,0x00000c48d47a8825,0x0000edd1a99510c0,0x000f5b5328c87c94,0x00010c422fc9af72,0x00000000b08f7a7c}, {0x000015d8984191cb,0x000832fe5793d839,0x0004a289120bd557,0x000f86181a5ccb4b,0x000d38cc6ebf1a12,0x00074bc9b76081b1,0x000d915812853e1b,0x0007e25bfcc06d2c,0x000000007e702821}},
+{{0x0000ae41807bd3c6,0x00063a25cee6e688,0x0006c78df72f086f,0x00065b5142b1a4b7,0x0006644679f09b3e,0x0007858595181317,0x000962f818c83a5c,0x0009a5fc5ed4dcdd,0x000000004e77e0eb}, {0x00084bc6db175372,0x00099034e4492a41,0x0001d9d5a90615e5,0x000fae7112fa1a1e,0x000a0bab7f98bac0,0x0003e58c0ebaad37,0x000a97024d24859b,0x0000fc4e1369b195,0x0000000039c628e3}},
+{{0x0006d7821a43143c,0x000040eceb888896,0x0006ba5703f88de7,0x000ac1f3e60f1e72,0x000d39ef15c6ad99,0x00050273babc3932,0x0009a92cec042cb1,0x000e1d50ee132322,0x000000004d1854e9}, {0x000098faf2964759,0x00070fd66ccb56a6,0x0009740cda3f7c12,0x00033cffb0b67f42,0x000d91419e166ab9,0x000e7c53c6c7ccbd,0x000a4fafb6fdfd53,0x000e48026188f837,0x0000000018804c34}},
+},
+{ /* slot=51 [{1,2,3,..,8} * 16^(2*51)] * G) */
+{{0x0001cfb13aa268fd,0x0002b5fb48f027f9,0x00044d3fd5b038d6,0x0005341873d59b3d,0x00070812cc3ff2ba,0x000eb5abcc9edf74,0x0000f9c1feaa8cbb,0x0008731e8b044bc8,0x00000000ef05a4df}, {0x0006e461726e4af4,0x000a862698907566,0x00093a83cd62317c,0x0007e0b392987b56,0x000bd3d94e6613a8,0x000240244070f769,0x0005e34133b315f4,0x0004f041ca6ac325,0x00000000ac49cc94}},
+{{0x000be2ff50668a92,0x0008516896fd91ca,0x000a20da7c431cd3,0x0002eb97c6acc107,0x000ccd3a34ef61a6,0x0004e94da9f47fdc,0x0009d639205ec229,0x00063dcefbc6d92c,0x0000000077b9ee07}, {0x0004ddc9d37aece0,0x0000b446351906fb,0x000da0d0c2abea32,0x00089e474133da5d,0x000d1a279027051c,0x000e23b7b3a77074,0x000817892b42cf7d,0x0002902c363a9833,0x00000000fcc70659}},
+{{0x000fe48a817c3656,0x0004c073e1e850fa,0x0000d89c0b4140bd,0x000bf131b8c030ee,0x00031975b027cbcb,0x000121cd89bd33a7,0x00013148cdf79335,0x000911c272dab77e,0x0000000061c93ed3}, {0x0002f73e2226f769,0x0002cda2faed5ca5,0x000a384f26cea297,0x0001e126f21e25ab,0x00077b8097ef6bdd,0x000f87b6e881c03a,0x000b1bb2ef84f997,0x0005a2f30ec25151,0x00000000d70fe18d}},
+{{0x0007404eada573a9,0x00047fdbae3881d1,0x00004ed4e47b4e2f,0x00047d3f5c9afa44,0x000a4628bd42ad81,0x000b626bd7cee250,0x0003d26dea8a40dd,0x000ad1ba52dc240e,0x00000000225be353}, {0x000114d27fa3dfa9,0x00042edb9afc66ef,0x000f6f18986c389d,0x00005baf255ffb91,0x000d4aacda3310bf,0x0005340c3eb25c60,0x000ae0e2d1714fa2,0x000192cec679e960,0x00000000bdce2f29}},
+{{0x000a3b792ad9d8b3,0x00006b07502a5cb0,0x0008a1abf7dbde67,0x000af6e96f0b31f1,0x0002fcdf051732c2,0x00061f840c02899e,0x0006f8cb52a1b0f9,0x000ffc4860996517,0x00000000e04bc809}, {0x0008e13677fda9e0,0x000a82f37e18cd0e,0x0008a277dbe4406c,0x000c7a02d1f9f5fa,0x000370e3e3513b43,0x0000999ec100ed78,0x000f08d29436edaa,0x000b5fe8cab9db9d,0x00000000ee8b2922}},
+{{0x000bfe44a9dcab5c,0x0003d1fe5e57fa24,0x0009361e80ba5d9d,0x000391bf9a0c9fa4,0x000003d421f2f62f,0x000a839a7c706e54,0x00098c47917c4a68,0x00069a0a50490e56,0x00000000f7367427}, {0x000fd698f2f26bb1,0x000ea19e9fcb9972,0x000b5229e91ebb5d,0x0009cf6196877383,0x0001b2286e4a775b,0x000daab053b065b7,0x00086e5c76904d72,0x000a854391b2da8b,0x00000000630f7dec}},
+{{0x0003bb3aa2355661,0x0000b8c8e8ba3654,0x0002d3fd00eddf31,0x0005a1e6d123b4f7,0x000c732bbfae058e,0x000874b650e8b5c7,0x000f65a26cabe9d1,0x00030ed5a54f8549,0x000000006bb3e57e}, {0x0001946b4d89883d,0x0008cc04c4c61ae7,0x00073001e3a4b152,0x000b5904a5820983,0x0001e8f5307cc517,0x000adc2e8b841908,0x00051189be35fece,0x000e89b12fb14ca8,0x0000000012452272}},
+{{0x000e58f99891a1c7,0x00037dd5d3b262db,0x000a820c0b80195f,0x0005023859df40c2,0x00028bba99dd2761,0x000c5a8f0b625225,0x0009462861cc74bf,0x000e3d579d71c4dd,0x000000003b651856}, {0x000e0b1e2f5276fa,0x00013aa348e62dec,0x000fc9432e3322c0,0x0000c90f73dc150b,0x000d68953a67c8e2,0x000b71703e0f9e82,0x000bd4f09624aa14,0x000801272a5545b4,0x00000000349be613}},
+},
+{ /* slot=52 [{1,2,3,..,8} * 16^(2*52)] * G) */
+{{0x000ce40eb91f0f26,0x0007a3875a6425fd,0x000229f0f3dc8647,0x000f95c37da400ec,0x000cc6174aeb9e41,0x0008b55b32855c4d,0x000dbe4f181b07c5,0x00091073925bffaf,0x00000000d266f1c9}, {0x00019e35c5c3024c,0x0003bee26b2d2d39,0x000efc4bc740a863,0x0009c4dc529e49ce,0x000f403e9d607055,0x0005c0a009a0c0f0,0x000ee0765bc431b5,0x00002e491300697f,0x00000000b8d46df1}},
+{{0x000ef1db94c232d0,0x0007680154408e83,0x0003c17ec3829095,0x0003de090c93c44c,0x000788b36e7f88f8,0x000fe8f400617541,0x0005d2178b524cd0,0x00004787c0f91522,0x000000004cfc0c1c}, {0x00004331f35c27f6,0x000772bf857e1980,0x000f8b768c1b1f7d,0x000e437fe51404d6,0x000d22ffe917517f,0x0005c5a32aeb3b02,0x0000ab3fac6da9ee,0x000d71e45eb96cca,0x00000000880613fd}},
+{{0x00011b3af295abfa,0x000c4c52883540d0,0x000b484c01a2174a,0x000aa5626ce15079,0x00014242efa54920,0x00089855133d2c89,0x0002230dd39dde8d,0x000373fa3f71ca77,0x000000009048a293}, {0x00018d25c07fd289,0x00041eb4b8599b1c,0x000417541963abf6,0x000213d593c6d2d8,0x0006f3428e1152f1,0x0006f8102665a695,0x000a3bc862e6191e,0x000e5628be3edc97,0x00000000b21b56b1}},
+{{0x0003d52e32a28b13,0x00040776605dc0f5,0x000a879f8d1a3a4c,0x00038d6c7ccf3e66,0x0000b36d0a1890a2,0x0004fc793ff422e1,0x0009e4cd5d958bd6,0x000b6f0a32d9b9bc,0x00000000ae7865a0}, {0x000fde09f2ba2b60,0x00048b6b9c2ab643,0x00033be02ddb7abc,0x00084f28a553ddeb,0x0003e740c819b098,0x0008fb89ac2c054b,0x000f5554dfa96be0,0x000e84d59843daea,0x00000000be06a028}},
+{{0x00053cb1a506abfa,0x0008e8680c995a85,0x0000b31e93988b6f,0x000ec501c5e2c0d6,0x000d81feb5937270,0x0009bf179ca2a49e,0x000f566fc33eb386,0x000c1c6b01c6f37a,0x000000007e53f8dd}, {0x000ebf8f99430853,0x0005971c43056ab8,0x0004dc75a477f3f0,0x000cf54ca2ce489c,0x000d353e456076cc,0x000bd52323b5ce9b,0x00053a156f748c04,0x00062365f831f42d,0x00000000d920facf}},
+{{0x00052c8238323176,0x000d3174ac7f4623,0x0008789576adf05f,0x00020b66593edf3c,0x0003ad6890edda19,0x000bd458c70bb925,0x00078110598d331b,0x000bb64671bc9beb,0x00000000b59f30a0}, {0x000d224f833002e3,0x00085f5fa7d57d94,0x000f9b679b14dd33,0x000efdd9f6bb5ded,0x0001f54bde25f052,0x000fd7df3630f914,0x0006006f2d87cdb8,0x000617bfa1009221,0x00000000017657b2}},
+{{0x0002f44a4dce4898,0x00001b52dd2ef663,0x00007cb9a22c4a86,0x0002fc5398c4865e,0x00006e1067184350,0x00007373eea0f270,0x000efa715d8e6c87,0x000ceda1d7f1037f,0x00000000657f3fcd}, {0x0003d90993c3ee6f,0x000c7d837218e2d0,0x00090c8b9a271a00,0x000c88669527380a,0x000d67d9f3b76ec1,0x000e3030c046599b,0x00064a675c4d18a8,0x0005eac0794214a7,0x000000008d50f9cd}},
+{{0x0004ed219e64b08e,0x000e9e01751945a5,0x000288519e54fb73,0x000b7502ac9c6c65,0x00092aeaafd5bb85,0x000b66d3ab7842af,0x0000290631b75b79,0x000ca7385243122d,0x000000008a0d5fb0}, {0x00081ece8f49da7c,0x000bf6bf9750235e,0x000743c99e3044a4,0x000fd0954a26343b,0x0007dffd17fd1260,0x0005122996e6ad86,0x000e3cb9870ba9bc,0x000f1a427653699a,0x00000000aeb65270}},
+},
+{ /* slot=53 [{1,2,3,..,8} * 16^(2*53)] * G) */
+{{0x0006d82a1e383a56,0x0006c7c6bc188061,0x00047746a39d210a,0x000ee96ae75323aa,0x000e0ac316604b04,0x0008fcc97a445ea7,0x0008255bb94f7d29,0x000e4b3f76e991d5,0x00000000a69bbcf9}, {0x0007282a3eeed869,0x0002c376b45b8016,0x000948bae0b3e9da,0x000be949e3de4bf4,0x000fdb88b0a0081b,0x00081499f4c0b025,0x0006826e8b49fe53,0x000c98ae3e04ada8,0x00000000e10784db}},
+{{0x0006aadaaac769e4,0x00091aa9748f1786,0x000e1397059979b3,0x0000d264afa83d7b,0x0003a4515207dd29,0x00055967abced35f,0x000c028a3bad08fa,0x00089e8580d19fba,0x000000000ade8b7a}, {0x000b5c65ea7d8042,0x00096755d5f0164d,0x000ede4e431300f9,0x000071a3a9931147,0x0000276ec095aa18,0x0007da81f9eba87c,0x000335c045719169,0x000ac429c2ccc7a2,0x000000003fbce0da}},
+{{0x000f554f76eb623f,0x000ff5185e80e442,0x0000d99df1cde1a7,0x0008c7abd8099655,0x000347bb23c6b8ee,0x0005cd0700a6e3f5,0x000b492cedfef888,0x000a7a68ff48e73d,0x00000000b7bc2be1}, {0x00022d71becc67dd,0x000652ccfaa37aca,0x0006c0baffe2d730,0x000e3acd93137143,0x00030676aa4a5d9c,0x0005f01dc780f146,0x0007b8cf0b85231a,0x00005bbc04f4896d,0x000000005a1339af}},
+{{0x00079f4ac416ffca,0x00039a4e6b4f3e6e,0x00024fa72e5022fc,0x0002a6d59405536e,0x0008d0a58a025315,0x000a983349b5de73,0x0009a73f72f2c57c,0x0003392ed32edc71,0x000000005bd022f8}, {0x000883513d1a9588,0x000b7d23da6628ca,0x0000f7aa03708e72,0x000a264221be3021,0x000483a5b6c17a16,0x000f864581aec751,0x0002bd0b1271a1cb,0x000eef10fc1689c5,0x0000000010a185d2}},
+{{0x00009dab05e6642a,0x000dc9e8539d69ba,0x00048fd69ae406b4,0x0004e79f3facfa9a,0x000ef984253ac520,0x0009b0818ded7954,0x00051db73180752e,0x0002e6480f2d5917,0x00000000fe0c6173}, {0x0009790a48fa7a04,0x000bde1bd7b61720,0x000863a0a59ef82d,0x0000cdf33fe06a3c,0x000b7b52bebde460,0x00043d5f210a95a4,0x000d3d74911ff33e,0x0003b0a6ae65b7e3,0x000000006a143064}},
+{{0x0002ef9782c08d9b,0x000d7ef5f0829920,0x000f4316955af324,0x000661bd53dd306e,0x0005a3e4b48ed4b8,0x0005b2b8551e1473,0x0001063e7649edbd,0x0001b95b9dad1b31,0x00000000987ec27c}, {0x00086761b3021794,0x000983e473273072,0x0008f7f7362e4bf6,0x0007c188d39433f1,0x00050f8a677110ac,0x000d4b1c361791a6,0x00073b03fafd070e,0x00018757aaa77d23,0x0000000010c5c08d}},
+{{0x0005b01ee42ec060,0x000c3dfa9b5f83e8,0x0001d132ce423dff,0x000cb2e1ae9f398c,0x000a56f09aa5692f,0x000455e79f9e5ef7,0x0006eede510eaa6b,0x000ee68d1d41e216,0x00000000062ce115}, {0x000e837c7dbd9034,0x000ac81b292eae62,0x000296583e20537a,0x0000edd6b6718721,0x00089e7885377faa,0x000a8f5d6aed7949,0x0002a615e42252d8,0x000cc4850b529487,0x0000000044aad6b8}},
+{{0x000accb48aa22df4,0x000bcaacfae3b1d9,0x000433af610e2db9,0x00087c3dc3949ae6,0x000d875dce68b23a,0x0002a8657e55308f,0x00084b72dcdce4bc,0x000162740a7a1786,0x000000002e5a69f2}, {0x0007838ab4629dce,0x0008da023f61a7a3,0x0001b54b51c13bd6,0x00079c960356c30e,0x000853aa6546053b,0x000583982e304b50,0x000d8d186c2fb09c,0x0003bdff157285b1,0x00000000967375da}},
+},
+{ /* slot=54 [{1,2,3,..,8} * 16^(2*54)] * G) */
+{{0x000023768cb77337,0x0007355d82dcf086,0x000a0c21be39422c,0x00063ed92b6fdb40,0x00058c1ac6b31bf8,0x000d47ea52acb342,0x00081db936c0664e,0x0000a9c1e88e9633,0x0000000000fd8b08}, {0x0001bf883dceb233,0x000a403c54a38a5a,0x0006fb9329eca033,0x000c7f0e3f29955b,0x00086ff7e95b76fb,0x000385d44c1bc08c,0x00064178bd0e2213,0x0000911c71e24013,0x000000001f03bb43}},
+{{0x000ae91e6a547b93,0x0006028d3ffe0c0f,0x000cfb32908ad5f2,0x0005baba9747b33a,0x000448e735938a64,0x000b5e8161f67604,0x0005b42025f14038,0x000f52d12c346201,0x0000000022dc6e1c}, {0x000cf6af2ce3f5f7,0x00067969c2ebd850,0x000bf2c13d687162,0x000ef82ab0ae619f,0x0001b10f09312a21,0x00036c5b63bdb42a,0x000e5b4ac40f3336,0x00032fb47378fb72,0x00000000aa970d4c}},
+{{0x0004532f9932c653,0x00087f45cfd60020,0x00026d2dbba45b79,0x0003aee3bd645df8,0x0001dda63fae4d1f,0x000b2db902b0cc3e,0x0001d4a6d3744da0,0x00024afc336594b1,0x00000000f67ceb3e}, {0x000ca019dbce3a26,0x000d7334c5550355,0x000c9b16b67b8dae,0x000599cbbe3c7db3,0x0006b02a6dc63c12,0x0006f76bde9c36d2,0x000f9a2e185671b3,0x00069bbad0a544b1,0x000000002e98e7ea}},
+{{0x0005aabf076c4968,0x0001d535c5699b35,0x0001ad1dc2c6cb5f,0x0001412851083d73,0x0003c66d1b2640f0,0x000557c8cda96d90,0x000b17fea489767d,0x000f5b0a1326372e,0x00000000b957ff4f}, {0x000809d96a004d00,0x000060fa67d274ad,0x0007bbcaf9e156e5,0x000c33429d4fa658,0x000fef27f4835055,0x0003366dfd150882,0x00010d40902958a4,0x0004afabd20377d0,0x000000005e9b0167}},
+{{0x0002fb2a7e601a98,0x00020d9f88d6776d,0x00095f9560eaa1fd,0x0005c7bbfa357d81,0x00019673190f1571,0x0004bbbd0545d761,0x0006c649bef06699,0x0008da3ca06ff9a0,0x000000004dd27336}, {0x0008f0517fd36e80,0x000b09a408ddbe8e,0x000092b6e00611fb,0x0003e5f7ea438505,0x0005e05e3a537a7e,0x000599591afb2c43,0x000c5dcb6bc729c1,0x0002f0f369318467,0x0000000086327829}},
+{{0x0006aa4a6b12f5b8,0x00070f357aa31b1f,0x000e9bad071c18eb,0x00080e75ab4cd681,0x0000f33054e405af,0x000c5f6f002f154d,0x00036ec61ebee613,0x0001c9ecf24e5ee7,0x00000000e3cead13}, {0x0001c912f44e79f2,0x000d967282c301cc,0x00039e7c785b1589,0x0002b2507a541abe,0x000d94b942980ab4,0x0004ba3d87424887,0x0001e8896c21d23c,0x000d474bec51b649,0x00000000b177287e}},
+{{0x000dc62b68be4dc1,0x000d113c95efe21b,0x00004a18c7806fef,0x00095c478bdf8c2f,0x0007598bfa421595,0x0008fc81632a370b,0x0003b6a8690f9d0c,0x000aba3d52228922,0x0000000014545d27}, {0x000b94f3a9b89573,0x0003b015a2ea45d2,0x000b095bd750aa68,0x000f4095526bf914,0x0000a3ec0e49fc73,0x00031e728c40dfdf,0x0007603665a311e3,0x0009f780e98382cc,0x000000007819e930}},
+{{0x000254fdcb62a61c,0x000f7ef903db35a7,0x000a4e4a96023363,0x000bba837851ab3f,0x000f593de321fc6e,0x00019e14ce2bbb03,0x000d8c7aa2d7bc5e,0x000ef1bac59985d5,0x00000000bbaa7bca}, {0x000686c8ea085d64,0x000f6c8460a3bccc,0x00068fb19c39a9b5,0x00092e6e078a1bab,0x0009336153aca543,0x000b045d725d6e0b,0x0001e6776597dd60,0x0004f68b860a1826,0x000000004d10c06e}},
+},
+{ /* slot=55 [{1,2,3,..,8} * 16^(2*55)] * G) */
+{{0x000e47f3729d2f7e,0x000a5cc3f5cd4786,0x00001488c2dfb1dc,0x000cbd736357109f,0x000686a89d1b9802,0x0007fc7ce0d1d750,0x00051f1f3a232c76,0x000b30cef5a653cd,0x00000000d52d6624}, {0x00080177e1e1affa,0x00031607b71316d0,0x000443f284ccc580,0x000053a9b8183806,0x000439eb563c2076,0x00082fa6a58b28ea,0x000dfe80f9cd371a,0x00021a45dc3f2f38,0x000000002815ef71}},
+{{0x0008b4148f3d10c6,0x000192f1997dc6ae,0x000739ba81d9ab28,0x0006da40d6a48b2e,0x000da452893e58ce,0x00016ac40c77fa4e,0x0006b63935f3f9e3,0x000a33f7b6d828d6,0x00000000267ec320}, {0x00082dcdc425a17d,0x000614ac28512c86,0x000c2f5a3d9665e1,0x000cb97d89d0124d,0x0008983596502d3d,0x000e864773429d10,0x00085dfd1086253e,0x0001ad135f2ac353,0x0000000017190147}},
+{{0x000b48a00264999f,0x0009e3615646e7a9,0x000788f3e90d73fb,0x000de379aa30f8d2,0x00083f627c5f5be0,0x00052f62051da28c,0x0001076283424b8e,0x0009f4f74a60ec2a,0x00000000536e2047}, {0x0007dd226c82aa2c,0x000b249059f9ed8b,0x000451551576baa3,0x0008cf816a89d1bb,0x0000702adac142ef,0x0008fba6a45e2bfc,0x000218223dd40a54,0x000f7d941c8188c8,0x00000000264df57c}},
+{{0x0008739fb4502c8c,0x0006fc5d44db2f66,0x000e0c4f1377b6ec,0x00053d31a49fc575,0x000ebe1d64226aa4,0x00059946a8a59869,0x0009e8eb059513ab,0x0006892278dd56b5,0x00000000789cb876}, {0x0005cd06e0d03a99,0x0003e256c1fc49ac,0x000d4d4822e37354,0x0004d83fbbb9c1fc,0x000b7d0c845268ac,0x0003120371933151,0x0003803fb1feeac4,0x000e61f4269ee3be,0x000000002d340c21}},
+{{0x000c03ec1113021f,0x000caddb4f8a4a77,0x000040764a32fd25,0x0002743e9386a7d3,0x0009e2d8b21da515,0x0005319131a5a569,0x0005c5a82a255728,0x000be7373122e311,0x000000005020e993}, {0x000f9bb430fafaf1,0x000a26caa34521ca,0x000f9a24c7482bbe,0x000bf4adddac5bb6,0x000ee04d85f56618,0x000e450600e293c4,0x0000f41d1d4605fb,0x000178a2ab30e454,0x00000000dfea96d9}},
+{{0x00086cb5770d4eba,0x00028a8af5f7ddeb,0x00076c32ed6c5e5b,0x000ed358580b2e11,0x000156182254ac84,0x000f8bacf2fe9db4,0x000934734134ebdb,0x00022d412fbaddf3,0x000000006807063f}, {0x0004ae0d07f92ad3,0x000b2031989251e7,0x000b8bfe1c2dc1c7,0x000ec342aec1c02b,0x000a9367212b7095,0x0004c1e59aa4bebb,0x00066867787e702f,0x0002f64710274ad0,0x00000000fc497e26}},
+{{0x0001baa27cff546a,0x0002ccc9cc8b497b,0x00057cafa5e9fa6f,0x000286b92ec5ace4,0x000982b2b4c8376d,0x00077b9c9672189a,0x00028ca11ab8a4e2,0x000e91d0e308cb03,0x0000000072042d46}, {0x0000de8db8b78a91,0x0005e9d1cf05cc39,0x000422e331397401,0x000fdf7f4ede0696,0x000602b48f2070c3,0x0005dc62ee944f7d,0x00072fbea0d84a47,0x00010547c8df16ed,0x000000005be74191}},
+{{0x000cd478c370cc36,0x0002493eb9977fee,0x000969ec94b7c5a7,0x000e80a1377861fe,0x000159a9ef448b2d,0x0002f7a4fb5854fa,0x000b7cc4635f66be,0x00092d779388a5e2,0x0000000090798fb4}, {0x00012e2f30e60516,0x000ca59e90475369,0x00099be19ab11d86,0x00065d80ccf84f29,0x00062ce5ad871514,0x000333e8df324505,0x000b7d2a7100752f,0x00069be31ead0ad0,0x0000000094b9ee96}},
+},
+};
+
+#endif /* IFMA_ED448_PRECOMP_H */
@@ -19,6 +19,7 @@
 #define IFMA_EXP_METHOD_H
 
 #include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
 
 /* exponetiation processing window */
 #define EXP_WIN_SIZE (5)
@@ -34,6 +35,26 @@
 /* map exp modulus bit size to exp modulus slot  */
 int bits_range(int bits);
 
+/* fixed-base exponentiation: number of comb teeth (table holds 2^EXP_COMB_TEETH entries) */
+#define EXP_COMB_TEETH     (6)
+#define EXP_COMB_TBL_SIZE  (1<<EXP_COMB_TEETH)
+#define EXP_COMB_TBL_ID    (0x4558504642ULL) /* "EXPFB" */
+
+/* sliding window exponentiation: number of pre-computed odd powers */
+#define EXP_SW_TBL_SIZE    (1<<(EXP_WIN_SIZE-1))
+
+/* Montgomery multiplication and squaring kernels of the modulus range */
+typedef void(*amm52_mb8)(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+typedef void(*ams52_mb8)(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+
+typedef struct _exp_kernels_mb8 {
+   int       len52;  /* length of the modulus in 2^52-radix digits */
+   amm52_mb8 amm;
+   ams52_mb8 ams;
+} exp_kernels_mb8;
+
+const exp_kernels_mb8* exp_kernels(int modulus_range);
+
 /* exponentiation propotype */
 typedef void(*exp_mb8)(int64u out[][8],
                  const int64u base[][8],
@@ -76,4 +97,45 @@ void ifma_modexp4096_mb(int64u out[][8],
                   const int64u k0[8],
                         int64u buffer[][8]);
 
+/* variable-time sliding window exponentiations (public exponents only) */
+void ifma_modexp1024_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u exp[][8], int exp_bits,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u buffer[][8]);
+
+void ifma_modexp2048_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u exp[][8], int exp_bits,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u buffer[][8]);
+
+void ifma_modexp3072_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u exp[][8], int exp_bits,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u buffer[][8]);
+
+void ifma_modexp4096_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u exp[][8], int exp_bits,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u buffer[][8]);
+
+/* common exponentiation frame: parameter checks and conversions */
+mbx_status ifma_exp_mb(int64u* const out_pa[8],
+                 const int64u* const base_pa[8],
+                 const int64u* const exp_pa[8], int exp_bits,
+                 const int64u* const mod_pa[8], int mod_bits,
+                       exp_mb8 expfunc,
+                       int8u* pBuffer, int bufferLen);
+
 #endif /* IFMA_EXP_METHOD_H */
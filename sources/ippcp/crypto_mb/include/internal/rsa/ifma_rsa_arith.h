@@ -27,12 +27,14 @@
 
 typedef int64u int64u_x8[8];        // alias   of 8-term vector of int64u each
 typedef int64u (*pint64u_x8) [8];   // pointer to 8-term vector of int64u each
+typedef int64u (*pint64u_x4) [4];   // pointer to 4-term vector of int64u each
 
 /* fixed size of RSA */
 #define RSA_1K (1024)
 #define RSA_2K (2*RSA_1K)
 #define RSA_3K (3*RSA_1K)
 #define RSA_4K (4*RSA_1K)
+#define RSA_8K (8*RSA_1K)
 
 #define NUMBER_OF_DIGITS(bitsize, digsize) (((bitsize) + (digsize)-1)/(digsize))
 #define MULTIPLE_OF(x, factor)             ((x) + (((factor) -((x)%(factor))) %(factor)))
@@ -48,13 +50,17 @@ EXTERN_C void ifma_amm52x60_mb8(int64u* out_mb8, const int64u* inpA_mb8, const i
 EXTERN_C void ifma_amm52x40_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void ifma_amm52x30_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void ifma_amm52x79_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void ifma_amm52x158_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 
 // New functions for almost half montgomery
 EXTERN_C void ifma_ahmm52x20_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpBx_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void ifma_ahmr52x20_mb8(int64u* out_mb, const int64u* inpA_mb, int64u* inpM_mb, const int64u* k0_mb);
 
 // 4x Mont Mul
+EXTERN_C void ifma_amm52x10_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpB_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
 EXTERN_C void ifma_amm52x20_mb4(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void ifma_amm52x30_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpB_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
+EXTERN_C void ifma_amm52x40_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpB_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
 
 // Diagonal sqr
 EXTERN_C void AMS52x10_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
@@ -70,15 +76,25 @@ EXTERN_C void AMS5x52x40_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, c
 EXTERN_C void AMS52x30_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void AMS52x60_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void AMS52x79_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void AMS52x158_diagonal_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 
 // 4x Diagonal sqr
+EXTERN_C void AMS52x10_diagonal_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
+EXTERN_C void AMS5x52x10_diagonal_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
 EXTERN_C void AMS52x20_diagonal_mb4(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void AMS5x52x20_diagonal_mb4(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void AMS52x30_diagonal_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
+EXTERN_C void AMS52x40_diagonal_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
+EXTERN_C void AMS5x52x40_diagonal_mb4(int64u* out_mb4, const int64u* inpA_mb4, const int64u* inpM_mb4, const int64u* k0_mb4);
 
 // clear/copy mb8 buffer
 EXTERN_C void zero_mb8(int64u(*redOut)[8], int len);
 EXTERN_C void copy_mb8(int64u out[][8], const int64u inp[][8], int len);
 
+// clear/copy mb4 buffer
+EXTERN_C void zero_mb4(int64u(*redOut)[4], int len);
+EXTERN_C void copy_mb4(int64u out[][4], const int64u inp[][4], int len);
+
 // other 2^52 radix arith functions
 EXTERN_C void ifma_montFactor52_mb8(int64u k0_mb8[8], const int64u m0_mb8[8]);
 
@@ -149,6 +165,39 @@ EXTERN_C void EXP52x79_mb8(int64u out[][8],
                      const int64u k0_mb8[8],
                      int64u work_buffer[][8]);
 
+// exponentiations (4x)
+EXTERN_C void EXP52x10_mb4(int64u out[][4],
+                     const int64u base[][4],
+                     const int64u exponent[][4],
+                     const int64u modulus[][4],
+                     const int64u toMont[][4],
+                     const int64u k0_mb4[4],
+                     int64u work_buffer[][4]);
+
+EXTERN_C void EXP52x20_mb4(int64u out[][4],
+                     const int64u base[][4],
+                     const int64u exponent[][4],
+                     const int64u modulus[][4],
+                     const int64u toMont[][4],
+                     const int64u k0_mb4[4],
+                     int64u work_buffer[][4]);
+
+EXTERN_C void EXP52x30_mb4(int64u out[][4],
+                     const int64u base[][4],
+                     const int64u exponent[][4],
+                     const int64u modulus[][4],
+                     const int64u toMont[][4],
+                     const int64u k0_mb4[4],
+                     int64u work_buffer[][4]);
+
+EXTERN_C void EXP52x40_mb4(int64u out[][4],
+                     const int64u base[][4],
+                     const int64u exponent[][4],
+                     const int64u modulus[][4],
+                     const int64u toMont[][4],
+                     const int64u k0_mb4[4],
+                     int64u work_buffer[][4]);
+
 // exponentiations (fixed short exponent ==65537)
 EXTERN_C void EXP52x20_pub65537_mb8(int64u out[][8],
                               const int64u base[][8],
@@ -179,4 +228,52 @@ EXTERN_C void EXP52x79_pub65537_mb8(int64u out[][8],
                               const int64u  k0[8],
                               int64u work_buffer[][8]);
 
+EXTERN_C void EXP52x158_pub65537_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
+// exponentiations (short per-lane public exponent)
+EXTERN_C void EXP52x20_pub_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u exponent[8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
+EXTERN_C void EXP52x40_pub_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u exponent[8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
+EXTERN_C void EXP52x60_pub_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u exponent[8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
+EXTERN_C void EXP52x79_pub_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u exponent[8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
+EXTERN_C void EXP52x158_pub_mb8(int64u out[][8],
+                              const int64u base[][8],
+                              const int64u exponent[8],
+                              const int64u modulus[][8],
+                              const int64u toMont[][8],
+                              const int64u  k0[8],
+                              int64u work_buffer[][8]);
+
 #endif /* _IFMA_INTERNAL_H_ */
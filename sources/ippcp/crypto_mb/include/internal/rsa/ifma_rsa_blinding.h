@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_RSA_BLINDING_H
+#define IFMA_RSA_BLINDING_H
+
+#include <crypto_mb/defs.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+
+/*
+// RSA base blinding object
+//
+// Holds the blinding pair of the private crt key in Montgomery domain of the modulus n,
+// so both blinding and unblinding are single Montgomery multiplications in radix 2^52.
+//
+// layout of data[] (len52 is the length of the modulus in 52-bit digits):
+//
+//    n[len52], a[len52], ai[len52]
+//
+// a = r^e*R mod n, ai = r^(-1)*R mod n (both are less than 2*n)
+*/
+struct _ifma_rsa_blinding {
+   int          id;             /* RSA_ID(RSA_PRV5_KEY, rsaBitsize) */
+   int          rsaBitsize;     /* size of rsa modulus (bits) */
+   int64u       k0;             /* Montgomery factor k0(n) */
+};
+
+#define RSA_BLINDING_DATA(blind)  ((int64u*)((blind)+1))
+
+/* offsets of blinding components (in int64u) */
+#define RSA_BLINDING_N_OFFSET(len52)   (0)
+#define RSA_BLINDING_A_OFFSET(len52)   ((len52))
+#define RSA_BLINDING_AI_OFFSET(len52)  ((len52)*2)
+#define RSA_BLINDING_DATA_LEN(len52)   ((len52)*3)
+
+#endif /* IFMA_RSA_BLINDING_H */
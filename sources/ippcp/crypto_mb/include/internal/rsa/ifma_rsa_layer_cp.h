@@ -27,6 +27,13 @@ EXTERN_C void ifma_cp_rsa_pub_layer_mb8(const int8u* const from_pa[8],
                                               int rsaBitlen,
                                         const mbx_RSA_Method* m,
                                               int8u* pBuffer);
+EXTERN_C void ifma_cp_rsa_pub_exp_layer_mb8(const int8u* const from_pa[8],
+                                                  int8u* const to_pa[8],
+                                            const int64u e[8],
+                                            const int64u* const n_pa[8],
+                                                  int rsaBitlen,
+                                            const mbx_RSA_Method* m,
+                                                  int8u* pBuffer);
 EXTERN_C void ifma_cp_rsa_prv2_layer_mb8(const int8u* const from_pa[8],
                                                int8u* const to_pa[8],
                                          const int64u* const d_pa[8],
@@ -44,5 +51,40 @@ EXTERN_C void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
                                                int rsaBitlen,
                                          const mbx_RSA_Method* m,
                                                int8u* pBuffer);
+EXTERN_C void ifma_cp_rsa_pub_prepared_layer_mb8(const int8u* const from_pa[8],
+                                                       int8u* const to_pa[8],
+                                         const mbx_RSA_PreparedKey* const key_pa[8],
+                                                       int rsaBitlen,
+                                                 const mbx_RSA_Method* m,
+                                                       int8u* pBuffer);
+EXTERN_C void ifma_cp_rsa_prv5_prepared_layer_mb8(const int8u* const from_pa[8],
+                                                        int8u* const to_pa[8],
+                                          const mbx_RSA_PreparedKey* const key_pa[8],
+                                                        int rsaBitlen,
+                                                  const mbx_RSA_Method* m,
+                                                        int8u* pBuffer);
+EXTERN_C void ifma_cp_rsa_blinding_layer_mb8(mbx_RSA_Blinding* const blind_pa[8],
+                                       const int8u* const r_pa[8],
+                                       const int64u* const e_pa[8],
+                                       const int64u* const n_pa[8],
+                                       const int64u* const p_pa[8],
+                                       const int64u* const q_pa[8],
+                                       const int64u* const pm2_pa[8],
+                                       const int64u* const qm2_pa[8],
+                                       const int64u* const iq_pa[8],
+                                             int rsaBitlen,
+                                       const mbx_RSA_Method* m,
+                                             int8u* pBuffer);
+EXTERN_C void ifma_cp_rsa_prv5_blinded_layer_mb8(const int8u* const from_pa[8],
+                                                       int8u* const to_pa[8],
+                                                 const int64u* const p_pa[8],
+                                                 const int64u* const q_pa[8],
+                                                 const int64u* const dp_pa[8],
+                                                 const int64u* const dq_pa[8],
+                                                 const int64u* const iq_pa[8],
+                                                 mbx_RSA_Blinding* const blind_pa[8],
+                                                       int rsaBitlen,
+                                                 const mbx_RSA_Method* m,
+                                                       int8u* pBuffer);
 
 #endif /* IFMA_CP_LAYER_H */
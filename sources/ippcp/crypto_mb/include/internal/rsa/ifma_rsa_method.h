@@ -35,6 +35,20 @@ typedef void(*EXP52x_mb8)(int64u out[][8],
    const int64u toMont[][8],
    const int64u k0_mb8[8],
    int64u work_buffer[][8]);
+typedef void(*EXP52x_mb4)(int64u out[][4],
+   const int64u base[][4],
+   const int64u exponent[][4],
+   const int64u modulus[][4],
+   const int64u toMont[][4],
+   const int64u k0_mb4[4],
+   int64u work_buffer[][4]);
+typedef void(*EXP52x_pub_mb8)(int64u out[][8],
+   const int64u base[][8],
+   const int64u exponent[8],
+   const int64u modulus[][8],
+   const int64u toMont[][8],
+   const int64u k0_mb8[8],
+   int64u work_buffer[][8]);
 
 
 /*
@@ -62,6 +76,7 @@ typedef enum {
    RSA2048 = 2048,
    RSA3072 = 3072,
    RSA4096 = 4096,
+   RSA8192 = 8192,
 } RSA_BITSIZE_ID;
 
 /* RSA ID */
@@ -81,6 +96,8 @@ struct _ifma_rsa_method {
    ammul52x_mb8  ammul52x;          /* multiplication */
    modsub52x_mb8 modsub52x;         /* subtration */
    addmul52x_mb8 mla52x;            /* multiply & add */
+   EXP52x_mb4    expfun_mb4;        /* "exp52x_arb_mb4" exponentiation of the partially filled batch */
+   EXP52x_pub_mb8 expfun_pub;       /* "exp52x_pub_mb8" exponentiation by short per-lane public exponent */
 };
 
 #endif /* IFMA_RSA_METHOD_H */
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_RSA_PAD_H
+#define IFMA_RSA_PAD_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/sha/sha2_mb8.h>
+
+/* max size of encoded message (bytes) */
+#define RSA_PAD_MAX_BYTELEN   (RSA_4K/8)
+
+/* hash function of the rsa padding scheme */
+typedef struct _ifma_rsa_hash {
+   int                  hashLen;   /* digest size (bytes)           */
+   sha2_msg_digest_mb8  digest;    /* multi-buffer one-shot digest  */
+} ifma_rsa_hash;
+
+EXTERN_C const ifma_rsa_hash* ifma_rsa_hash_info(enum MBX_HASH_ALG hashAlg);
+
+/*
+// out_pa[i] ^= MGF1(seed_pa[i]) of outLen bytes,
+// buffers with out_pa[i]==NULL are skipped
+*/
+EXTERN_C void ifma_mgf1_xor_mb8(int8u* const out_pa[8], int outLen,
+                          const int8u* const seed_pa[8], int seedLen,
+                          const ifma_rsa_hash* hash);
+
+/* status of padded operation: lanes failed at the padding stage keep their status */
+__INLINE mbx_status ifma_rsa_pad_status(mbx_status status, mbx_status rsa_status)
+{
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK==MBX_GET_STS(status, buf_no))
+         status = MBX_SET_STS(status, buf_no, MBX_GET_STS(rsa_status, buf_no));
+   }
+   return status;
+}
+
+#endif /* IFMA_RSA_PAD_H */
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_RSA_PREPARED_KEY_H
+#define IFMA_RSA_PREPARED_KEY_H
+
+#include <crypto_mb/defs.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+
+/*
+// RSA key prepared for multi-buffer processing
+//
+// All key components are stored in radix 2^52 (single buffer, not transposed),
+// so the only work left at the processing time is the transposition of 8 keys
+// into mb8 layout. Montgomery factor k0 and to_Montgomery domain converter RR
+// are computed once at the key preparation time.
+//
+// layout of data[] (len52 and len64 are the length of the modulus (public key)
+// or length of the factor (private crt key) in 52- and 64-bit digits):
+//
+//    public key:       n[len52], rr[len52]
+//    private crt key:  p[len52], q[len52], rrp[len52], rrq[len52],
+//                      dp[len64], dq[len64], iq_mont[len52]
+//
+// iq_mont = iq*R mod p is the CRT coefficient pre-converted to Montgomery domain
+*/
+struct _ifma_rsa_prepared_key {
+   int          id;             /* RSA_ID(RSA_PUB_KEY or RSA_PRV5_KEY, rsaBitsize) */
+   int          rsaBitsize;     /* size of rsa modulus (bits) */
+   int64u       k0[2];          /* Montgomery factor(s): k0(n) or k0(p), k0(q) */
+};
+
+#define RSA_PREPARED_KEY_DATA(key)  ((int64u*)((key)+1))
+
+/* offsets of public key components (in int64u) */
+#define RSA_PUB_N_OFFSET(len52)     (0)
+#define RSA_PUB_RR_OFFSET(len52)    ((len52))
+#define RSA_PUB_DATA_LEN(len52)     ((len52)*2)
+
+/* offsets of private crt key components (in int64u) */
+#define RSA_PRV5_P_OFFSET(len52, len64)     (0)
+#define RSA_PRV5_Q_OFFSET(len52, len64)     ((len52))
+#define RSA_PRV5_RRP_OFFSET(len52, len64)   ((len52)*2)
+#define RSA_PRV5_RRQ_OFFSET(len52, len64)   ((len52)*3)
+#define RSA_PRV5_DP_OFFSET(len52, len64)    ((len52)*4)
+#define RSA_PRV5_DQ_OFFSET(len52, len64)    ((len52)*4 + (len64))
+#define RSA_PRV5_IQ_OFFSET(len52, len64)    ((len52)*4 + (len64)*2)
+#define RSA_PRV5_DATA_LEN(len52, len64)     ((len52)*5 + (len64)*2)
+
+#endif /* IFMA_RSA_PREPARED_KEY_H */
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_ARITH_SECP256K1_H
+#define IFMA_ARITH_SECP256K1_H
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/ecnist/ifma_arith_p256.h>
+
+/* underlying prime's size */
+#define PK256_BITSIZE (256)
+
+#define PK256_LEN52  NUMBER_OF_DIGITS(PK256_BITSIZE,DIGIT_SIZE)
+#define PK256_LEN64  NUMBER_OF_DIGITS(PK256_BITSIZE,64)
+#define PK256_LEN8   NUMBER_OF_DIGITS(PK256_BITSIZE,8)
+
+/* size of the half-scalars of GLV decomposition (|k1|, |k2| < 2^128) */
+#define GLV_BITSIZE  (128)
+#define GLV_LEN64    NUMBER_OF_DIGITS(GLV_BITSIZE,64)
+
+/* Specialized operations over EC secp256k1 prime */
+EXTERN_C void MB_FUNC_NAME(ifma_tomont52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_frommont52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amm52_pk256_)(U64 r[], const U64 va[], const U64 vb[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ams52_pk256_)(U64 r[], const U64 va[]);
+EXTERN_C void MB_FUNC_NAME(ifma_aminv52_pk256_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amsqrt52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_add52_pk256_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_sub52_pk256_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_neg52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_double52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_tripple52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_reduce52_pk256_)(U64 r[], const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_zero_pk256_)(const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_cmp_lt_pk256_)(const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_check_range_pk256_)(const U64 a[]);
+
+/* Specialized operations over EC secp256k1 order */
+EXTERN_C U64* MB_FUNC_NAME(ifma_nk256_)(void);
+EXTERN_C void MB_FUNC_NAME(ifma_tomont52_nk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_frommont52_nk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ams52_nk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amm52_nk256_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_aminv52_nk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_add52_nk256_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_sub52_nk256_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_neg52_nk256_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_fastred52_pnk256_)(U64 r[], const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_cmp_lt_nk256_)(const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_check_range_nk256_)(const U64 a[]);
+
+/*
+// GLV decomposition of the scalar k (mod nk256, radix 2^52):
+//    k = (k1_neg? -k1 : k1) + (k2_neg? -k2 : k2)*lambda mod nk256, where k1, k2 < 2^GLV_BITSIZE
+*/
+EXTERN_C void MB_FUNC_NAME(ifma_glv_split52_nk256_)(U64 k1[], __mb_mask* k1_neg,
+                                                    U64 k2[], __mb_mask* k2_neg, const U64 k[]);
+
+#endif /* IFMA_ARITH_SECP256K1_H */
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#ifndef IFMA_ECPOINT_SECP256K1_H
+#define IFMA_ECPOINT_SECP256K1_H
+
+#include <internal/secp256k1/ifma_arith_secp256k1.h>
+
+typedef struct {
+   U64 X[PK256_LEN52];
+   U64 Y[PK256_LEN52];
+   U64 Z[PK256_LEN52];
+} SECP256K1_POINT;
+
+typedef struct {
+   U64 x[PK256_LEN52];
+   U64 y[PK256_LEN52];
+} SECP256K1_POINT_AFFINE;
+
+typedef struct {
+   int64u x[PK256_LEN52];
+   int64u y[PK256_LEN52];
+} SINGLE_SECP256K1_POINT_AFFINE;
+
+/* check if coodinate is zero */
+__INLINE __mb_mask MB_FUNC_NAME(is_zero_point_cordinate_)(const U64 T[])
+{
+   return MB_FUNC_NAME(ifma_is_zero_pk256_)(T);
+}
+
+/* set point to infinity */
+__INLINE void MB_FUNC_NAME(set_point_to_infinity_)(SECP256K1_POINT* r)
+{
+   r->X[0] = r->X[1] = r->X[2] = r->X[3] = r->X[4] = get_zero64();
+   r->Y[0] = r->Y[1] = r->Y[2] = r->Y[3] = r->Y[4] = get_zero64();
+   r->Z[0] = r->Z[1] = r->Z[2] = r->Z[3] = r->Z[4] = get_zero64();
+}
+
+EXTERN_C void MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(SECP256K1_POINT* r, const SECP256K1_POINT* p);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_secp256k1_add_point_)(SECP256K1_POINT* r, const SECP256K1_POINT* p, const SECP256K1_POINT* q);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_secp256k1_add_point_affine_)(SECP256K1_POINT* r, const SECP256K1_POINT* p, const SECP256K1_POINT_AFFINE* q);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_secp256k1_mul2_point_vartime_)(SECP256K1_POINT* r, const U64 g_scalar[], const SECP256K1_POINT* p, const U64 p_scalar[]);
+EXTERN_C void MB_FUNC_NAME(get_secp256k1_ec_affine_coords_)(U64 x[], U64 y[], const SECP256K1_POINT* P);
+EXTERN_C const U64* MB_FUNC_NAME(ifma_ec_secp256k1_coord_one_)(void);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_pk256_)(const SECP256K1_POINT* p, int use_jproj_coords);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_decompress_y_pk256_)(U64 y[], const U64 x[]);
+
+#endif /* IFMA_ECPOINT_SECP256K1_H */
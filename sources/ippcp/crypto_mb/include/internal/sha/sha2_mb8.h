@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#if !defined(_SHA2_MB8_H)
+#define _SHA2_MB8_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/sha512.h>
+#include <internal/common/ifma_defs.h>
+
+#include <immintrin.h>
+
+#define SHA2_NUM_BUFFERS8         (8)                             /* number of buffers in sha2 multi-buffer 8   */
+
+#define SHA256_DIGEST_SIZE        (32)                            /*        sha256 digest size (bytes)          */
+#define SHA256_MSG_BLOCK_SIZE     (64)                            /*      sha256 message block size (bytes)     */
+#define SHA256_MSG_LEN_REPR       (sizeof(int64u))                /*  size of message length representation     */
+
+#define SHA384_DIGEST_SIZE        (48)                            /*        sha384 digest size (bytes)          */
+#define SHA512_MSG_LEN_REPR       (sizeof(int64u)*2)              /*  size of message length representation     */
+
+#define SHA2_MAX_DIGEST_SIZE      (SHA512_DIGEST_SIZE)
+
+/* hash values in multi-buffer 8 format: word i of buffer j is stored at [i][j] */
+typedef int32u sha256_hash_mb8[8][SHA2_NUM_BUFFERS8];
+
+/* sha512 initial hash value, also used by the mbx_sha512_*_mb8() context */
+extern const int64u sha512_iv[8];
+
+/*
+// internal functions
+*/
+
+/* update hash of 8 buffers by len[i] bytes (multiple of the block size) of msg_pa[i], buffers of zero length are skipped */
+EXTERN_C void sha256_avx512_mb8(int32u hash_pa[][8], const int8u* const msg_pa[8], int len[8]);
+EXTERN_C void sha512_avx512_mb8(int64u hash_pa[][8], const int8u* const msg_pa[8], int len[8]);
+
+/* one-shot digest of 8 messages, buffers with hash_pa[i]==NULL are skipped */
+typedef void (*sha2_msg_digest_mb8)(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8]);
+
+EXTERN_C void sha256_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8]);
+EXTERN_C void sha384_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8]);
+EXTERN_C void sha512_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8]);
+
+/* completes digest of 8 messages starting from the hash state of prefix_len (multiple of the block size) already processed bytes */
+EXTERN_C void sha256_msg_digest_cont_mb8(int8u* const hash_pa[8], sha256_hash_mb8 hash, int prefix_len,
+                                         const int8u* const msg_pa[8], const int len[8]);
+
+#endif /* _SHA2_MB8_H */
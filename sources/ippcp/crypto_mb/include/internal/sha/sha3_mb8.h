@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#if !defined(_SHA3_MB8_H)
+#define _SHA3_MB8_H
+
+#include <crypto_mb/defs.h>
+#include <internal/common/ifma_defs.h>
+
+#include <immintrin.h>
+
+#define SHA3_NUM_BUFFERS8         (8)                             /* number of buffers in sha3 multi-buffer 8   */
+#define KECCAK_STATE_WORDS        (25)                            /*  Keccak-f[1600] state size (64-bit words)  */
+
+#define SHAKE256_RATE             (136)                           /*         shake256 rate (bytes)              */
+
+/* Keccak state of 8 buffers: word i of buffer j is stored at [i][j] */
+typedef struct {
+   int64u state[KECCAK_STATE_WORDS][SHA3_NUM_BUFFERS8];
+   int    pos[SHA3_NUM_BUFFERS8];                                 /* bytes absorbed into the current block    */
+} shake256_state_mb8;
+
+/*
+// internal functions
+*/
+
+/* Keccak-f[1600] permutation of the states of the buffers selected by mb_mask */
+EXTERN_C void keccak_f1600_avx512_mb8(int64u state[][8], __mmask8 mb_mask);
+
+/* SHAKE256 of 8 messages, absorbing is incremental, squeezing is done once by the final call */
+EXTERN_C void shake256_init_mb8(shake256_state_mb8* p_state);
+EXTERN_C void shake256_update_mb8(const int8u* const msg_pa[8], const int len[8], shake256_state_mb8* p_state);
+/* squeeze out_len bytes into every out_pa[i], buffers with out_pa[i]==NULL are skipped */
+EXTERN_C void shake256_final_mb8(int8u* const out_pa[8], int out_len, shake256_state_mb8* p_state);
+
+#endif /* _SHA3_MB8_H */
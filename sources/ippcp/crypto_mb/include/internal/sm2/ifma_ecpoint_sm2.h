@@ -86,6 +86,8 @@ EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_add_point_)(SM2_POINT* r, const SM2_POINT
 EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_add_point_affine_)(SM2_POINT* r, const SM2_POINT* p, const SM2_POINT_AFFINE* q);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(SM2_POINT* r, const SM2_POINT* p, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(SM2_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_mul_point_vartime_)(SM2_POINT* r, const SM2_POINT* p, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_vartime_)(SM2_POINT* r, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(get_sm2_ec_affine_coords_)(U64 x[], U64 y[], const SM2_POINT* P);
 EXTERN_C const U64* MB_FUNC_NAME(ifma_ec_sm2_coord_one_)(void);
 EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_psm2_)(const SM2_POINT* p, int use_jproj_coords);
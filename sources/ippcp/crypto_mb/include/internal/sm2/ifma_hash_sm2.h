@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#ifndef IFMA_HASH_SM2_H
+#define IFMA_HASH_SM2_H
+
+#include <crypto_mb/defs.h>
+
+/*
+// SM3 based primitives of the SM2 schemes, 8 lanes are hashed at once
+*/
+
+/* Z digest = SM3( ENTL || ID || a || b || xG || yG || xA || yA ), xA and yA are big endian */
+EXTERN_C void sm2_compute_z_digest_mb8(int8u* pa_z_digest[8],
+                                 const int8u* pa_user_id[8],
+                                    const int user_id_len[8],
+                                 const int8u* pa_pubx[8],
+                                 const int8u* pa_puby[8]);
+
+/*
+// Key derivation function (GB/T 32918.4-2016, 5.4.3)
+//    pa_out[i] = pa_inp[i] ^ KDF(pa_z[i], len[i])
+// or the plain KDF(pa_z[i], len[i]) if pa_inp is NULL.
+// All lanes share the same Z length z_len.
+*/
+EXTERN_C void sm2_kdf_mb8(int8u* const pa_out[8],
+                    const int8u* const pa_inp[8],
+                             const int len[8],
+                    const int8u* const pa_z[8],
+                                   int z_len);
+
+#endif /* IFMA_HASH_SM2_H */
@@ -80,6 +80,7 @@ set(CMAKE_CXX_FLAGS_RELEASE "${CMAKE_C_FLAGS_RELEASE}")
 
 # Optimisation dependent flags
 set(AVX512_CFLAGS " -march=icelake-server -mavx512dq -mavx512ifma -mavx512f -mavx512vbmi2 -mavx512cd -mavx512bw -mbmi2")
+set(AVX2_CFLAGS " -march=haswell -mavx2 -mbmi2")
 
 # Build with sanitizers
 # FIXME: so far it can be enabled from the IPPCP build only. Change it once crypto_mb build is separated.
@@ -76,3 +76,4 @@ set(CMAKE_CXX_FLAGS_RELEASE "${CMAKE_C_FLAGS_RELEASE}")
 
 # Optimisation dependent flags
 set(AVX512_CFLAGS " -xCORE-AVX512 -qopt-zmm-usage:high")
+set(AVX2_CFLAGS " -xCORE-AVX2")
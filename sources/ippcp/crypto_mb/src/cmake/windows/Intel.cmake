@@ -89,3 +89,4 @@ set(CMAKE_CXX_FLAGS_DEBUG "${CMAKE_C_FLAGS_DEBUG}")
 
 # Optimisation dependent flags
 set(AVX512_CFLAGS "-QxCORE-AVX512 -Qopt-zmm-usage:high")
+set(AVX2_CFLAGS "-QxCORE-AVX2")
@@ -72,3 +72,4 @@ set(CMAKE_CXX_FLAGS_DEBUG "${CMAKE_C_FLAGS_DEBUG}")
 
 # Optimisation dependent flags
 set(AVX512_CFLAGS "/arch:AVX512")
+set(AVX2_CFLAGS "/arch:AVX2")
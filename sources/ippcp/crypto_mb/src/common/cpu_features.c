@@ -17,6 +17,7 @@
 
 #include <crypto_mb/cpu_features.h>
 #include <internal/common/ifma_defs.h>
+#include <internal/common/cpu_dispatch.h>
 
 /* masks of bits */
 #define BIT00 0x00000001
@@ -243,6 +244,31 @@ int mbx_is_crypto_mb_applicable(int64u cpu_features)
    return (CRYPTO_MB_REQUIRED_CPU_FEATURES == (features & CRYPTO_MB_REQUIRED_CPU_FEATURES));
 }
 
+// based on c-flags: -mavx2 -mbmi2
+#define CRYPTO_MB_AVX2_REQUIRED_CPU_FEATURES ( \
+                           mbcpCPUID_BMI2 \
+                         | mbcpCPUID_AVX2 \
+                         | mbcpAVX_ENABLEDBYOS)
+
+static int mbx_is_avx2_applicable(int64u cpu_features)
+{
+   return (CRYPTO_MB_AVX2_REQUIRED_CPU_FEATURES == (cpu_features & CRYPTO_MB_AVX2_REQUIRED_CPU_FEATURES));
+}
+
+/* cached kernels ISA (-1 if not detected yet) */
+static volatile int mbx_isa = -1;
+
+MBX_ISA mbx_kernels_isa(void)
+{
+   int isa = mbx_isa;
+   if(0 > isa) {
+      int64u features = mbx_get_cpu_features();
+      isa = (!mbx_is_crypto_mb_applicable(features) && mbx_is_avx2_applicable(features))? MBX_ISA_AVX2 : MBX_ISA_AVX512IFMA;
+      mbx_isa = isa;
+   }
+   return (MBX_ISA)isa;
+}
+
 /* structure for determining the number of buffers(WIDTH) for the algorithm */
 typedef struct {
    enum MBX_ALGO algo;
@@ -261,23 +287,39 @@ static const algo_width_map arr_algo_width[] = {
    { MBX_ALGO_EC_NIST_P521, MBX_WIDTH_MB8  },
    { MBX_ALGO_EC_SM2,       MBX_WIDTH_MB8  },
    { MBX_ALGO_SM3,          MBX_WIDTH_MB16 },
-   { MBX_ALGO_SM4,          MBX_WIDTH_MB16 }
+   { MBX_ALGO_SM4,          MBX_WIDTH_MB16 },
+   { MBX_ALGO_EC_SECP256K1, MBX_WIDTH_MB8  }
+};
+
+/* algorithms served by the AVX2 kernels on the platforms without AVX512-IFMA */
+static const algo_width_map arr_algo_width_avx2[] = {
+   { MBX_ALGO_RSA_1K,       MBX_WIDTH_MB4  },
+   { MBX_ALGO_RSA_2K,       MBX_WIDTH_MB4  },
+   { MBX_ALGO_RSA_3K,       MBX_WIDTH_MB4  },
+   { MBX_ALGO_RSA_4K,       MBX_WIDTH_MB4  },
+   { MBX_ALGO_X25519,       MBX_WIDTH_MB4  },
+   { MBX_ALGO_EC_NIST_P256, MBX_WIDTH_MB4  }
 };
 /* clang-config on */
 
 DLL_PUBLIC
 MBX_ALGO_INFO mbx_get_algo_info(enum MBX_ALGO algo)
 {
-   const int mbx_mb_applicable = mbx_is_crypto_mb_applicable(0);
+   const int64u features = mbx_get_cpu_features();
+
+   const algo_width_map *tbl = arr_algo_width;
+   int num_tbl = sizeof(arr_algo_width) / sizeof(algo_width_map);
 
    int num_width = 0;
    /* check CPU feature */
-   if (0 == mbx_mb_applicable) {
-      return num_width;
+   if (0 == mbx_is_crypto_mb_applicable(features)) {
+      if (0 == mbx_is_avx2_applicable(features)) {
+         return num_width;
+      }
+      tbl = arr_algo_width_avx2;
+      num_tbl = sizeof(arr_algo_width_avx2) / sizeof(algo_width_map);
    }
-   const int num_tbl = sizeof(arr_algo_width) / sizeof(algo_width_map);
 
-   const algo_width_map *tbl = arr_algo_width;
    /* loop determining the number of buffers to process */
    for (int i = 0; i < num_tbl; ++i, ++tbl) {
       if (algo == (*tbl).algo) {
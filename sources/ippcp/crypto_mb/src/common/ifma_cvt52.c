@@ -523,3 +523,31 @@ int8u ifma_BN_transpose_copy(int64u out_mb8[][8], const BIGNUM* const bn[8], int
    return _mm512_cmpneq_epi64_mask(_mm512_loadu_si512((__m512i*)bn), _mm512_setzero_si512());
 }
 #endif /* BN_OPENSSL_DISABLE */
+
+/*
+// Packing of the partially filled batch.
+// The lanes of mb8 selected by the mask (no more than 4) are gathered into the
+// consecutive lanes of mb4, the rest of mb4 lanes are zeroed.
+*/
+void ifma_mb8_to_mb4(int64u out_mb4[][4], const int64u inp_mb8[][8], int len, int8u lanes)
+{
+   int n;
+   for (n = 0; n < len; n++) {
+      __m512i X = _mm512_maskz_compress_epi64(lanes, _mm512_loadu_si512(inp_mb8[n]));
+      _mm256_storeu_si256((__m256i*)out_mb4[n], _mm512_castsi512_si256(X));
+   }
+}
+
+/*
+// Unpacking of the partially filled batch.
+// The consecutive lanes of mb4 are scattered into the mb8 lanes selected by the mask,
+// the rest of mb8 lanes are zeroed.
+*/
+void ifma_mb4_to_mb8(int64u out_mb8[][8], const int64u inp_mb4[][4], int len, int8u lanes)
+{
+   int n;
+   for (n = 0; n < len; n++) {
+      __m512i X = _mm512_zextsi256_si512(_mm256_loadu_si256((const __m256i*)inp_mb4[n]));
+      _mm512_storeu_si512(out_mb8[n], _mm512_maskz_expand_epi64(lanes, X));
+   }
+}
@@ -0,0 +1,1598 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+/*
+// NIST P-256 for the platforms without AVX512-IFMA.
+//
+// 4-lane AVX2 code, field elements are 10 limbs of 26 bits.
+// The Montgomery domain is the same as of the AVX512-IFMA code (R = 2^260, 5 digits of 52 bits),
+// so that the pre-computed base point table of the AVX512-IFMA code is reused:
+// a 52-bit digit is split into two 26-bit limbs.
+//
+// Elements are kept in [0, 2*m) with normalized limbs, m = p256 or n256:
+//    - Montgomery multiplication of the elements less than 2*m < R/2 returns the element less than 2*m
+//    - 10 accumulated 52-bit products fit 64-bit lanes, the reduction is done after the whole product
+//
+// Point arithmetic and scalar multiplications follow ifma_ecpoint_p256.c step by step.
+*/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_nistp256.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_math.h>
+#include <internal/common/cpu_dispatch.h>
+#include <internal/ecnist/avx2_p256.h>
+
+#define P256_BITSIZE (256)
+#define P256_LEN64   NUMBER_OF_DIGITS(P256_BITSIZE, 64)
+
+#define FE26_LEN     (10)
+#define MASK26       (((int64u)1<<26) -1)
+
+/* p256 = 2^256 -2^224 +2^192 +2^96 -1 in 2^26 radix */
+static const int64u p256_x1[FE26_LEN] = {
+   0x3ffffff, 0x3ffffff, 0x3ffffff, 0x003ffff, 0x0000000, 0x0000000, 0x0000000, 0x0000400, 0x3ff0000, 0x03fffff };
+/* 2*p256 */
+static const int64u p256_x2[FE26_LEN] = {
+   0x3fffffe, 0x3ffffff, 0x3ffffff, 0x007ffff, 0x0000000, 0x0000000, 0x0000000, 0x0000800, 0x3fe0000, 0x07fffff };
+/* R^2 mod p256 */
+static const int64u p256_rr[FE26_LEN] = {
+   0x0000300, 0x0000000, 0x3f00000, 0x3ffffff, 0x3fffffb, 0x3ffffbf, 0x3ffffff, 0x3f7ffff, 0x0ffffff, 0x0000001 };
+/* R mod p256 (Montgomery 1) */
+static const int64u p256_one[FE26_LEN] = {
+   0x0000010, 0x0000000, 0x0000000, 0x3c00000, 0x3ffffff, 0x3ffffff, 0x3ffffff, 0x3ffbfff, 0x00fffff, 0x0000000 };
+/* EC b coefficient, Montgomery domain */
+static const int64u p256_b[FE26_LEN] = {
+   0x04bddfd, 0x37d88a7, 0x090d89c, 0x32a210c, 0x2cf005c, 0x084bb5a, 0x220abf7, 0x20d0568, 0x1dd4874, 0x030c018 };
+
+/* n256 (order of the base point) */
+static const int64u n256_x1[FE26_LEN] = {
+   0x0632551, 0x272b0bf, 0x1e84f3b, 0x2b69c5e, 0x3bce6fa, 0x3ffffff, 0x3ffffff, 0x00003ff, 0x3ff0000, 0x03fffff };
+/* 2*n256 */
+static const int64u n256_x2[FE26_LEN] = {
+   0x0c64aa2, 0x0e5617e, 0x3d09e77, 0x16d38bc, 0x379cdf5, 0x3ffffff, 0x3ffffff, 0x00007ff, 0x3fe0000, 0x07fffff };
+/* R^2 mod n256 */
+static const int64u n256_rr[FE26_LEN] = {
+   0x26dc3ba, 0x173037a, 0x3d8a084, 0x064a819, 0x15571bb, 0x2fb1658, 0x32392b6, 0x07f0916, 0x159d956, 0x0384b65 };
+/* -1/n256 mod 2^26 */
+#define N256_K0 (0x200bc4f)
+
+/*
+// field elements
+*/
+__INLINE void fe26_copy(U64x4 r[], const U64x4 a[])
+{
+   for(int i=0; i<FE26_LEN; i++)
+      r[i] = a[i];
+}
+
+__INLINE void fe26_set(U64x4 r[], const int64u a[])
+{
+   for(int i=0; i<FE26_LEN; i++)
+      r[i] = set1x4(a[i]);
+}
+
+__INLINE void fe26_zero(U64x4 r[])
+{
+   for(int i=0; i<FE26_LEN; i++)
+      r[i] = get_zero64x4();
+}
+
+/* r = mask? b : a */
+__INLINE void fe26_select(U64x4 r[], U64x4 mask, const U64x4 a[], const U64x4 b[])
+{
+   for(int i=0; i<FE26_LEN; i++)
+      r[i] = select64x4(mask, a[i], b[i]);
+}
+
+/* lanes mask of a==b (elements are reduced) */
+__INLINE U64x4 fe26_cmp_eq(const U64x4 a[], const U64x4 b[])
+{
+   U64x4 t = xor64x4(a[0], b[0]);
+   for(int i=1; i<FE26_LEN; i++)
+      t = or64x4(t, xor64x4(a[i], b[i]));
+   return cmpeq64x4(t, get_zero64x4());
+}
+
+/* lanes mask of a==0 mod m (a is in [0, 2*m)) */
+__INLINE U64x4 fe26_is_zero(const U64x4 a[], const int64u m[])
+{
+   U64x4 z = a[0];
+   U64x4 zm = xor64x4(a[0], set1x4(m[0]));
+   for(int i=1; i<FE26_LEN; i++) {
+      z = or64x4(z, a[i]);
+      zm = or64x4(zm, xor64x4(a[i], set1x4(m[i])));
+   }
+   return or64x4(cmpeq64x4(z, get_zero64x4()), cmpeq64x4(zm, get_zero64x4()));
+}
+
+/* lanes mask of a<m (a is any number of normalized limbs) */
+__INLINE U64x4 fe26_cmp_lt(const U64x4 a[], const int64u m[])
+{
+   U64x4 bw = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++)
+      bw = srli64x4(sub64x4(sub64x4(a[i], set1x4(m[i])), bw), 63);
+   return sub64x4(get_zero64x4(), bw);
+}
+
+/* lanes mask of the numbers out of (0, m) range */
+__INLINE U64x4 fe26_check_range(const U64x4 a[], const int64u m[])
+{
+   return or64x4(is_zero64x4(a, FE26_LEN), xor64x4(fe26_cmp_lt(a, m), set1x4((int64u)-1)));
+}
+
+/* r = a mod m (a is in [0, 2*m)) */
+__INLINE void fe26_reduce(U64x4 r[], const U64x4 a[], const int64u m[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   U64x4 d[FE26_LEN];
+   U64x4 bw = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      d[i] = sub64x4(sub64x4(a[i], set1x4(m[i])), bw);
+      bw = srli64x4(d[i], 63);
+      d[i] = and64x4(d[i], mask);
+   }
+   /* keep a if a<m */
+   fe26_select(r, sub64x4(get_zero64x4(), bw), d, a);
+}
+
+/* r = a+b mod 2*m */
+__INLINE void fe26_add(U64x4 r[], const U64x4 a[], const U64x4 b[], const int64u m2[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   U64x4 s[FE26_LEN];
+   U64x4 d[FE26_LEN];
+
+   U64x4 c = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      s[i] = add64x4(add64x4(a[i], b[i]), c);
+      c = srli64x4(s[i], 26);
+      s[i] = and64x4(s[i], mask);
+   }
+   U64x4 bw = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      d[i] = sub64x4(sub64x4(s[i], set1x4(m2[i])), bw);
+      bw = srli64x4(d[i], 63);
+      d[i] = and64x4(d[i], mask);
+   }
+   /* keep the sum if it is less than 2*m */
+   fe26_select(r, sub64x4(get_zero64x4(), bw), d, s);
+}
+
+/* r = a-b mod 2*m */
+__INLINE void fe26_sub(U64x4 r[], const U64x4 a[], const U64x4 b[], const int64u m2[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   U64x4 d[FE26_LEN];
+
+   U64x4 bw = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      d[i] = sub64x4(sub64x4(a[i], b[i]), bw);
+      bw = srli64x4(d[i], 63);
+      d[i] = and64x4(d[i], mask);
+   }
+   /* add 2*m if a<b, carry out of the top limb compensates the borrow */
+   U64x4 borrow_mask = sub64x4(get_zero64x4(), bw);
+   U64x4 c = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      d[i] = add64x4(add64x4(d[i], and64x4(borrow_mask, set1x4(m2[i]))), c);
+      c = srli64x4(d[i], 26);
+      r[i] = and64x4(d[i], mask);
+   }
+}
+
+/* r = a/2 mod m */
+__INLINE void fe26_half(U64x4 r[], const U64x4 a[], const int64u m[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   U64x4 s[FE26_LEN];
+
+   /* a odd? a+m : a */
+   U64x4 odd_mask = bit0_mask64x4(a[0]);
+   U64x4 c = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      s[i] = add64x4(add64x4(a[i], and64x4(odd_mask, set1x4(m[i]))), c);
+      c = srli64x4(s[i], 26);
+      s[i] = and64x4(s[i], mask);
+   }
+   for(int i=0; i<FE26_LEN-1; i++)
+      r[i] = or64x4(srli64x4(s[i], 1), and64x4(slli64x4(s[i+1], 25), mask));
+   r[FE26_LEN-1] = srli64x4(s[FE26_LEN-1], 1);
+}
+
+/*
+// Montgomery multiplication and squaring
+*/
+#define MADD(acc, x, y) (acc) = add64x4((acc), mul32x4((x), (y)))
+
+/* t = a*b, t[] is 2*FE26_LEN long, the limbs are not normalized */
+__INLINE void fe26_mul_wide(U64x4 t[], const U64x4 a[], const U64x4 b[])
+{
+   U64x4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+   U64x4 b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4], b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9];
+
+   t[0] = mul32x4(a0, b0);
+   t[1] = mul32x4(a0, b1);
+   MADD(t[1], a1, b0);
+   t[2] = mul32x4(a0, b2);
+   MADD(t[2], a1, b1);
+   MADD(t[2], a2, b0);
+   t[3] = mul32x4(a0, b3);
+   MADD(t[3], a1, b2);
+   MADD(t[3], a2, b1);
+   MADD(t[3], a3, b0);
+   t[4] = mul32x4(a0, b4);
+   MADD(t[4], a1, b3);
+   MADD(t[4], a2, b2);
+   MADD(t[4], a3, b1);
+   MADD(t[4], a4, b0);
+   t[5] = mul32x4(a0, b5);
+   MADD(t[5], a1, b4);
+   MADD(t[5], a2, b3);
+   MADD(t[5], a3, b2);
+   MADD(t[5], a4, b1);
+   MADD(t[5], a5, b0);
+   t[6] = mul32x4(a0, b6);
+   MADD(t[6], a1, b5);
+   MADD(t[6], a2, b4);
+   MADD(t[6], a3, b3);
+   MADD(t[6], a4, b2);
+   MADD(t[6], a5, b1);
+   MADD(t[6], a6, b0);
+   t[7] = mul32x4(a0, b7);
+   MADD(t[7], a1, b6);
+   MADD(t[7], a2, b5);
+   MADD(t[7], a3, b4);
+   MADD(t[7], a4, b3);
+   MADD(t[7], a5, b2);
+   MADD(t[7], a6, b1);
+   MADD(t[7], a7, b0);
+   t[8] = mul32x4(a0, b8);
+   MADD(t[8], a1, b7);
+   MADD(t[8], a2, b6);
+   MADD(t[8], a3, b5);
+   MADD(t[8], a4, b4);
+   MADD(t[8], a5, b3);
+   MADD(t[8], a6, b2);
+   MADD(t[8], a7, b1);
+   MADD(t[8], a8, b0);
+   t[9] = mul32x4(a0, b9);
+   MADD(t[9], a1, b8);
+   MADD(t[9], a2, b7);
+   MADD(t[9], a3, b6);
+   MADD(t[9], a4, b5);
+   MADD(t[9], a5, b4);
+   MADD(t[9], a6, b3);
+   MADD(t[9], a7, b2);
+   MADD(t[9], a8, b1);
+   MADD(t[9], a9, b0);
+   t[10] = mul32x4(a1, b9);
+   MADD(t[10], a2, b8);
+   MADD(t[10], a3, b7);
+   MADD(t[10], a4, b6);
+   MADD(t[10], a5, b5);
+   MADD(t[10], a6, b4);
+   MADD(t[10], a7, b3);
+   MADD(t[10], a8, b2);
+   MADD(t[10], a9, b1);
+   t[11] = mul32x4(a2, b9);
+   MADD(t[11], a3, b8);
+   MADD(t[11], a4, b7);
+   MADD(t[11], a5, b6);
+   MADD(t[11], a6, b5);
+   MADD(t[11], a7, b4);
+   MADD(t[11], a8, b3);
+   MADD(t[11], a9, b2);
+   t[12] = mul32x4(a3, b9);
+   MADD(t[12], a4, b8);
+   MADD(t[12], a5, b7);
+   MADD(t[12], a6, b6);
+   MADD(t[12], a7, b5);
+   MADD(t[12], a8, b4);
+   MADD(t[12], a9, b3);
+   t[13] = mul32x4(a4, b9);
+   MADD(t[13], a5, b8);
+   MADD(t[13], a6, b7);
+   MADD(t[13], a7, b6);
+   MADD(t[13], a8, b5);
+   MADD(t[13], a9, b4);
+   t[14] = mul32x4(a5, b9);
+   MADD(t[14], a6, b8);
+   MADD(t[14], a7, b7);
+   MADD(t[14], a8, b6);
+   MADD(t[14], a9, b5);
+   t[15] = mul32x4(a6, b9);
+   MADD(t[15], a7, b8);
+   MADD(t[15], a8, b7);
+   MADD(t[15], a9, b6);
+   t[16] = mul32x4(a7, b9);
+   MADD(t[16], a8, b8);
+   MADD(t[16], a9, b7);
+   t[17] = mul32x4(a8, b9);
+   MADD(t[17], a9, b8);
+   t[18] = mul32x4(a9, b9);
+   t[19] = get_zero64x4();
+}
+
+/* t = a^2, t[] is 2*FE26_LEN long, the limbs are not normalized */
+__INLINE void fe26_sqr_wide(U64x4 t[], const U64x4 a[])
+{
+   U64x4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+   U64x4 a0_2 = add64x4(a0, a0), a1_2 = add64x4(a1, a1), a2_2 = add64x4(a2, a2), a3_2 = add64x4(a3, a3), a4_2 = add64x4(a4, a4);
+   U64x4 a5_2 = add64x4(a5, a5), a6_2 = add64x4(a6, a6), a7_2 = add64x4(a7, a7), a8_2 = add64x4(a8, a8);
+
+   t[0] = mul32x4(a0, a0);
+   t[1] = mul32x4(a0_2, a1);
+   t[2] = mul32x4(a0_2, a2);
+   MADD(t[2], a1, a1);
+   t[3] = mul32x4(a0_2, a3);
+   MADD(t[3], a1_2, a2);
+   t[4] = mul32x4(a0_2, a4);
+   MADD(t[4], a1_2, a3);
+   MADD(t[4], a2, a2);
+   t[5] = mul32x4(a0_2, a5);
+   MADD(t[5], a1_2, a4);
+   MADD(t[5], a2_2, a3);
+   t[6] = mul32x4(a0_2, a6);
+   MADD(t[6], a1_2, a5);
+   MADD(t[6], a2_2, a4);
+   MADD(t[6], a3, a3);
+   t[7] = mul32x4(a0_2, a7);
+   MADD(t[7], a1_2, a6);
+   MADD(t[7], a2_2, a5);
+   MADD(t[7], a3_2, a4);
+   t[8] = mul32x4(a0_2, a8);
+   MADD(t[8], a1_2, a7);
+   MADD(t[8], a2_2, a6);
+   MADD(t[8], a3_2, a5);
+   MADD(t[8], a4, a4);
+   t[9] = mul32x4(a0_2, a9);
+   MADD(t[9], a1_2, a8);
+   MADD(t[9], a2_2, a7);
+   MADD(t[9], a3_2, a6);
+   MADD(t[9], a4_2, a5);
+   t[10] = mul32x4(a1_2, a9);
+   MADD(t[10], a2_2, a8);
+   MADD(t[10], a3_2, a7);
+   MADD(t[10], a4_2, a6);
+   MADD(t[10], a5, a5);
+   t[11] = mul32x4(a2_2, a9);
+   MADD(t[11], a3_2, a8);
+   MADD(t[11], a4_2, a7);
+   MADD(t[11], a5_2, a6);
+   t[12] = mul32x4(a3_2, a9);
+   MADD(t[12], a4_2, a8);
+   MADD(t[12], a5_2, a7);
+   MADD(t[12], a6, a6);
+   t[13] = mul32x4(a4_2, a9);
+   MADD(t[13], a5_2, a8);
+   MADD(t[13], a6_2, a7);
+   t[14] = mul32x4(a5_2, a9);
+   MADD(t[14], a6_2, a8);
+   MADD(t[14], a7, a7);
+   t[15] = mul32x4(a6_2, a9);
+   MADD(t[15], a7_2, a8);
+   t[16] = mul32x4(a7_2, a9);
+   MADD(t[16], a8, a8);
+   t[17] = mul32x4(a8_2, a9);
+   t[18] = mul32x4(a9, a9);
+   t[19] = get_zero64x4();
+}
+
+/* r = t[FE26_LEN, 2*FE26_LEN) with the limbs normalized */
+__INLINE void fe26_norm_high(U64x4 r[], U64x4 t[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   for(int i=FE26_LEN; i<2*FE26_LEN-1; i++) {
+      t[i+1] = add64x4(t[i+1], srli64x4(t[i], 26));
+      r[i-FE26_LEN] = and64x4(t[i], mask);
+   }
+   r[FE26_LEN-1] = t[2*FE26_LEN-1];
+}
+
+/*
+// r = t/R mod p256
+//
+// p256 = -1 mod 2^26, so the multiplier of the reduction step is just t[i] mod 2^26
+// and u*p256 = u*(2^256 -2^224 +2^192 +2^96 -1) is added by shifts:
+//    -u             clears low bits of t[i]
+//    u*2^18         to t[i+3]
+//    u*2^10         to t[i+7]
+//    u*(2^26-2^16)  to t[i+8]
+//    u*(2^22-1)     to t[i+9]
+*/
+__INLINE void fe26_red_p256(U64x4 r[], U64x4 t[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   for(int i=0; i<FE26_LEN; i++) {
+      U64x4 u = and64x4(t[i], mask);
+      t[i+1] = add64x4(t[i+1], srli64x4(t[i], 26));
+      t[i+3] = add64x4(t[i+3], slli64x4(u, 18));
+      t[i+7] = add64x4(t[i+7], slli64x4(u, 10));
+      t[i+8] = add64x4(t[i+8], sub64x4(slli64x4(u, 26), slli64x4(u, 16)));
+      t[i+9] = add64x4(t[i+9], sub64x4(slli64x4(u, 22), u));
+   }
+   fe26_norm_high(r, t);
+}
+
+/* r = t/R mod n256 */
+__INLINE void fe26_red_n256(U64x4 r[], U64x4 t[])
+{
+   const U64x4 mask = set1x4(MASK26);
+   const U64x4 k0 = set1x4(N256_K0);
+   U64x4 m[FE26_LEN];
+   fe26_set(m, n256_x1);
+
+   for(int i=0; i<FE26_LEN; i++) {
+      U64x4 u = and64x4(mul32x4(t[i], k0), mask);
+      MADD(t[i+0], u, m[0]);
+      MADD(t[i+1], u, m[1]);
+      MADD(t[i+2], u, m[2]);
+      MADD(t[i+3], u, m[3]);
+      MADD(t[i+4], u, m[4]);
+      MADD(t[i+5], u, m[5]);
+      MADD(t[i+6], u, m[6]);
+      MADD(t[i+7], u, m[7]);
+      MADD(t[i+8], u, m[8]);
+      MADD(t[i+9], u, m[9]);
+      t[i+1] = add64x4(t[i+1], srli64x4(t[i], 26));
+   }
+   fe26_norm_high(r, t);
+}
+
+static void fe26_mul_p256(U64x4 r[], const U64x4 a[], const U64x4 b[])
+{
+   U64x4 t[2*FE26_LEN];
+   fe26_mul_wide(t, a, b);
+   fe26_red_p256(r, t);
+}
+
+static void fe26_sqr_p256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 t[2*FE26_LEN];
+   fe26_sqr_wide(t, a);
+   fe26_red_p256(r, t);
+}
+
+static void fe26_mul_n256(U64x4 r[], const U64x4 a[], const U64x4 b[])
+{
+   U64x4 t[2*FE26_LEN];
+   fe26_mul_wide(t, a, b);
+   fe26_red_n256(r, t);
+}
+
+static void fe26_sqr_n256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 t[2*FE26_LEN];
+   fe26_sqr_wide(t, a);
+   fe26_red_n256(r, t);
+}
+
+/* r = a^(2^n) */
+static void fe26_sqr_n_p256(U64x4 r[], const U64x4 a[], int n)
+{
+   fe26_sqr_p256(r, a);
+   for(n--; n>0; n--)
+      fe26_sqr_p256(r, r);
+}
+
+/* simplify naming */
+#define mul    fe26_mul_p256
+#define sqr    fe26_sqr_p256
+#define sqr_n  fe26_sqr_n_p256
+#define add(r, a, b)  fe26_add((r), (a), (b), p256_x2)
+#define sub(r, a, b)  fe26_sub((r), (a), (b), p256_x2)
+#define mul2(r, a)    fe26_add((r), (a), (a), p256_x2)
+#define div2(r, a)    fe26_half((r), (a), p256_x1)
+
+__INLINE void mul3(U64x4 r[], const U64x4 a[])
+{
+   U64x4 t[FE26_LEN];
+   mul2(t, a);
+   add(r, t, a);
+}
+
+/* r = 1/a = a^(p256-2) (Montgomery domain) */
+static void fe26_inv_p256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 x2[FE26_LEN], x4[FE26_LEN], x8[FE26_LEN], x16[FE26_LEN], x32[FE26_LEN];
+   U64x4 t[FE26_LEN];
+
+   /* xk = a^(2^k-1) */
+   sqr(t, a);        mul(x2, t, a);
+   sqr_n(t, x2, 2);  mul(x4, t, x2);
+   sqr_n(t, x4, 4);  mul(x8, t, x4);
+   sqr_n(t, x8, 8);  mul(x16, t, x8);
+   sqr_n(t, x16, 16); mul(x32, t, x16);
+
+   /* p256-2 = ffffffff 00000001 00000000 00000000 00000000 ffffffff ffffffff fffffffd */
+   sqr_n(t, x32, 32); mul(t, t, a);
+   sqr_n(t, t, 128);  mul(t, t, x32);
+   sqr_n(t, t, 32);   mul(t, t, x32);
+   sqr_n(t, t, 16);   mul(t, t, x16);
+   sqr_n(t, t, 8);    mul(t, t, x8);
+   sqr_n(t, t, 4);    mul(t, t, x4);
+   sqr_n(t, t, 2);    mul(t, t, x2);
+   sqr_n(t, t, 2);    mul(r, t, a);
+}
+
+__INLINE void fe26_tomont_p256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 rr[FE26_LEN];
+   fe26_set(rr, p256_rr);
+   mul(r, a, rr);
+}
+
+/* from Montgomery domain, the result is reduced */
+__INLINE void fe26_frommont_p256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 one[FE26_LEN];
+   fe26_zero(one);
+   one[0] = set1x4(1);
+   mul(r, a, one);
+   fe26_reduce(r, r, p256_x1);
+}
+
+/*
+// arithmetic modulo n256
+*/
+__INLINE void fe26_tomont_n256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 rr[FE26_LEN];
+   fe26_set(rr, n256_rr);
+   fe26_mul_n256(r, a, rr);
+}
+
+/* from Montgomery domain, the result is reduced */
+__INLINE void fe26_frommont_n256(U64x4 r[], const U64x4 a[])
+{
+   U64x4 one[FE26_LEN];
+   fe26_zero(one);
+   one[0] = set1x4(1);
+   fe26_mul_n256(r, a, one);
+   fe26_reduce(r, r, n256_x1);
+}
+
+/* r = 1/a = a^(n256-2) (Montgomery domain), the exponent is public: fixed window of 4 bits */
+static void fe26_inv_n256(U64x4 r[], const U64x4 a[])
+{
+   static const int64u n256_minus2[P256_LEN64] = {
+      0xF3B9CAC2FC63254F, 0xBCE6FAADA7179E84, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000000 };
+
+   U64x4 tbl[16][FE26_LEN];
+   U64x4 t[FE26_LEN];
+
+   /* tbl[k] = a^k */
+   fe26_copy(tbl[1], a);
+   for(int k=2; k<16; k++)
+      fe26_mul_n256(tbl[k], tbl[k-1], a);
+
+   int nibble = P256_BITSIZE/4 -1;
+   fe26_copy(t, tbl[(n256_minus2[nibble/16] >> (4*(nibble%16))) & 0xF]);
+   for(nibble--; nibble>=0; nibble--) {
+      int d = (int)((n256_minus2[nibble/16] >> (4*(nibble%16))) & 0xF);
+      fe26_sqr_n256(t, t);
+      fe26_sqr_n256(t, t);
+      fe26_sqr_n256(t, t);
+      fe26_sqr_n256(t, t);
+      if(d)
+         fe26_mul_n256(t, t, tbl[d]);
+   }
+   fe26_copy(r, t);
+}
+
+/* 64-bit digits of the reduced element, the scalar is zero padded up to P256_LEN64+1 digits */
+__INLINE void fe26_to_scalar(U64x4 scalar[], const U64x4 a[])
+{
+   for(int k=0; k<P256_LEN64+1; k++)
+      scalar[k] = get_zero64x4();
+   for(int i=0; i<FE26_LEN; i++) {
+      int bit = 26*i;
+      scalar[bit/64] = or64x4(scalar[bit/64], sll64x4(a[i], bit%64));
+      if((bit%64)+26>64)
+         scalar[bit/64+1] = or64x4(scalar[bit/64+1], srl64x4(a[i], 64-bit%64));
+   }
+}
+
+/*
+// EC points
+//
+// Presentation of point at infinity:
+//    - projective (X : Y : 0)
+//    - affine     (0 : 0)
+*/
+typedef struct {
+   U64x4 X[FE26_LEN];
+   U64x4 Y[FE26_LEN];
+   U64x4 Z[FE26_LEN];
+} P256_POINT_MB4;
+
+typedef struct {
+   U64x4 x[FE26_LEN];
+   U64x4 y[FE26_LEN];
+} P256_POINT_AFFINE_MB4;
+
+__INLINE void point_copy(P256_POINT_MB4* r, const P256_POINT_MB4* p)
+{
+   fe26_copy(r->X, p->X);
+   fe26_copy(r->Y, p->Y);
+   fe26_copy(r->Z, p->Z);
+}
+
+/* r = mask? q : p */
+__INLINE void point_select(P256_POINT_MB4* r, U64x4 mask, const P256_POINT_MB4* p, const P256_POINT_MB4* q)
+{
+   fe26_select(r->X, mask, p->X, q->X);
+   fe26_select(r->Y, mask, p->Y, q->Y);
+   fe26_select(r->Z, mask, p->Z, q->Z);
+}
+
+/* R(X3:Y3:Z3) = [2]P(X1:Y1:Z1), see ifma_ec_nistp256_dbl_point_() */
+static void ec_nistp256_dbl_point_mb4(P256_POINT_MB4* r, const P256_POINT_MB4* p)
+{
+   U64x4 T[FE26_LEN];
+   U64x4 U[FE26_LEN];
+   U64x4 V[FE26_LEN];
+   U64x4 A[FE26_LEN];
+   U64x4 B[FE26_LEN];
+
+   const U64x4* X1 = p->X;   /* input point */
+   const U64x4* Y1 = p->Y;
+   const U64x4* Z1 = p->Z;
+   U64x4* X3 = r->X;         /* output point */
+   U64x4* Y3 = r->Y;
+   U64x4* Z3 = r->Z;
+
+   mul2(T, Y1);      /* T = 2*Y1 */
+
+   sqr(V, T);        /* V = 4*Y1^2 */
+   sqr(U, Z1);       /* U = Z1^2 */
+
+   sub(B, X1, U);    /* B = X1-Z1^2 */
+   add(U, X1, U);    /* U = X1+Z1^2 */
+
+   mul(A, V, X1);    /* A = 4*X*Y1^2 */
+   mul(B, B, U);     /* B = (X1^2-Z1^4) */
+
+   mul2(X3, A);      /* X3 = 2*A */
+   mul3(B, B);       /* B = 3*(X1^2-Z1^4) */
+
+   sqr(U, B);        /* U = B^2 */
+   sqr(Y3, V);       /* Y3= V^2 = 16*Y1^4 */
+
+   sub(X3, U, X3);   /* X3=B^2 - 2*A */
+   div2(Y3,Y3);      /* Y3=Y3/2 = 8*Y1^4 */
+
+   sub(U, A, X3);    /* U = A-X3 */
+
+   mul(Z3, T, Z1);   /* Z3= 2*Y1*Z1 */
+   mul(U, U, B);     /* U = B*(A-X3) */
+
+   sub(Y3, U, Y3);   /* Y3 = B*(A-X3) -8*Y1^4 */
+}
+
+/* R(X3:Y3:Z3) = P(X1:Y1:Z1) + Q(X2:Y2:Z2), see ifma_ec_nistp256_add_point_() */
+static void ec_nistp256_add_point_mb4(P256_POINT_MB4* r, const P256_POINT_MB4* p, const P256_POINT_MB4* q)
+{
+   /* coordinates of p */
+   const U64x4* X1 = p->X;
+   const U64x4* Y1 = p->Y;
+   const U64x4* Z1 = p->Z;
+   U64x4 p_at_infinity = fe26_is_zero(p->Z, p256_x1);
+
+   /* coordinates of q */
+   const U64x4* X2 = q->X;
+   const U64x4* Y2 = q->Y;
+   const U64x4* Z2 = q->Z;
+   U64x4 q_at_infinity = fe26_is_zero(q->Z, p256_x1);
+
+   /* temp point T(X3:Y3:Z3) */
+   P256_POINT_MB4 T;
+   U64x4* X3 = T.X;
+   U64x4* Y3 = T.Y;
+   U64x4* Z3 = T.Z;
+
+   /* temporary */
+   U64x4 U1[FE26_LEN];
+   U64x4 U2[FE26_LEN];
+   U64x4 S1[FE26_LEN];
+   U64x4 S2[FE26_LEN];
+   U64x4  H[FE26_LEN];
+   U64x4  R[FE26_LEN];
+
+   mul(S1, Y1, Z2);     /* S1 = Y1*Z2 */
+   sqr(U1, Z2);         /* U1 = Z2^2  */
+
+   mul(S2, Y2, Z1);     /* S2 = Y2*Z1 */
+   sqr(U2, Z1);         /* U2 = Z1^2 */
+
+   mul(S1, S1, U1);     /* S1 = Y1*Z2^3 */
+   mul(S2, S2, U2);     /* S2 = Y2*Z1^3 */
+
+   mul(U1, X1, U1);     /* U1 = X1*Z2^2 */
+   mul(U2, X2, U2);     /* U2 = X2*Z1^2 */
+
+   sub(R, S2, S1);      /* R = S2-S1 */
+   sub(H, U2, U1);      /* H = U2-U1 */
+
+   /* check if affine (p.x:p.y) == (q.x:q.y) and and do doubling if this happens */
+   U64x4 points_are_equal = andnot64x4(or64x4(p_at_infinity, q_at_infinity),
+                                       and64x4(fe26_is_zero(H, p256_x1), fe26_is_zero(R, p256_x1)));
+
+   P256_POINT_MB4 P2;
+   if(mask64x4_to_bits(points_are_equal))
+      ec_nistp256_dbl_point_mb4(&P2, p);
+
+   mul(Z3, Z1, Z2);     /* Z3 = Z1*Z2 */
+   sqr(U2, H);          /* U2 = H^2 */
+   mul(Z3, Z3, H);      /* Z3 = (Z1*Z2)*H */
+   sqr(S2, R);          /* S2 = R^2 */
+   mul(H, H, U2);       /* H = H^3 */
+
+   mul(U1, U1, U2);     /* U1 = U1*H^2 */
+   sub(X3, S2, H);      /* X3 = R^2 - H^3 */
+   mul2(U2, U1);        /* U2 = 2*U1*H^2 */
+   mul(S1, S1, H);      /* S1 = S1*H^3 */
+   sub(X3, X3, U2);     /* X3 = (R^2 - H^3) -2*U1*H^2 */
+
+   sub(Y3, U1, X3);     /* Y3 = R*(U1*H^2 - X3) -S1*H^3 */
+   mul(Y3, Y3, R);
+   sub(Y3, Y3, S1);
+
+   /* T = p_at_infinity? q : T */
+   point_select(&T, p_at_infinity, &T, q);
+   /* T = q_at_infinity? p : T */
+   point_select(&T, q_at_infinity, &T, p);
+
+   /* r = points_are_equal? P2 : T */
+   if(mask64x4_to_bits(points_are_equal))
+      point_select(r, points_are_equal, &T, &P2);
+   else
+      point_copy(r, &T);
+}
+
+/* R(X3:Y3:Z3) = P(X1:Y1:Z1) + Q(X2:Y2:Z2=1), see ifma_ec_nistp256_add_point_affine_() */
+static void ec_nistp256_add_point_affine_mb4(P256_POINT_MB4* r, const P256_POINT_MB4* p, const P256_POINT_AFFINE_MB4* q)
+{
+   /* coordinates of p (projective) */
+   const U64x4* X1 = p->X;
+   const U64x4* Y1 = p->Y;
+   const U64x4* Z1 = p->Z;
+   U64x4 p_at_infinity = fe26_is_zero(p->Z, p256_x1);
+
+   /* coordinates of q (affine) */
+   const U64x4* X2 = q->x;
+   const U64x4* Y2 = q->y;
+   U64x4 q_at_infinity = and64x4(is_zero64x4(q->x, FE26_LEN), is_zero64x4(q->y, FE26_LEN));
+
+   /* coordinates of temp point T(X3:Y3:Z3) */
+   U64x4 X3[FE26_LEN];
+   U64x4 Y3[FE26_LEN];
+   U64x4 Z3[FE26_LEN];
+
+   U64x4 U2[FE26_LEN];
+   U64x4 S2[FE26_LEN];
+   U64x4 H[FE26_LEN];
+   U64x4 R[FE26_LEN];
+
+   sqr(R, Z1);             // R = Z1^2
+   mul(S2, Y2, Z1);        // S2 = Y2*Z1
+   mul(U2, X2, R);         // U2 = X2*Z1^2
+   mul(S2, S2, R);         // S2 = Y2*Z1^3
+
+   sub(H, U2, X1);         // H = U2-X1
+   sub(R, S2, Y1);         // R = S2-Y1
+
+   mul(Z3, H, Z1);         // Z3 = H*Z1
+
+   sqr(U2, H);             // U2 = H^2
+   sqr(S2, R);             // S2 = R^2
+   mul(H, H, U2);          // H = H^3
+
+   mul(U2, U2, X1);        // U2 = X1*H^2
+
+   mul(Y3, H, Y1);         // T = Y1*H^3
+
+   mul2(X3, U2);           // X3 = 2*X1*H^2
+   sub(X3, S2, X3);        // X3 = R^2 - 2*X1*H^2
+   sub(X3, X3, H);         // X3 = R^2 - 2*X1*H^2 -H^3
+
+   sub(U2, U2, X3);        // U2 = X1*H^2 - X3
+   mul(U2, U2, R);         // U2 = R*(X1*H^2 - X3)
+   sub(Y3, U2, Y3);        // Y3 = -Y1*H^3 + R*(X1*H^2 - X3)
+
+   /* T = p_at_infinity? q : T */
+   U64x4 one[FE26_LEN];
+   fe26_set(one, p256_one);
+   fe26_select(X3, p_at_infinity, X3, q->x);
+   fe26_select(Y3, p_at_infinity, Y3, q->y);
+   fe26_select(Z3, p_at_infinity, Z3, one);
+   /* r = q_at_infinity? p : T */
+   fe26_select(r->X, q_at_infinity, X3, p->X);
+   fe26_select(r->Y, q_at_infinity, Y3, p->Y);
+   fe26_select(r->Z, q_at_infinity, Z3, p->Z);
+}
+
+/* affine coordinates of the point (Montgomery domain), x or y may be NULL */
+static void get_nistp256_ec_affine_coords_mb4(U64x4 x[], U64x4 y[], const P256_POINT_MB4* P)
+{
+   U64x4 invZ1[FE26_LEN];
+   U64x4 invZn[FE26_LEN];
+
+   /* 1/Z and 1/Z^2 */
+   fe26_inv_p256(invZ1, P->Z);
+   sqr(invZn, invZ1);
+
+   if(x)
+      mul(x, P->X, invZn);
+   if(y) {
+      mul(invZn, invZn, invZ1);
+      mul(y, P->Y, invZn);
+   }
+}
+
+/*
+// scalar multiplication, window of 4 bits, Booth recoding
+*/
+#define WIN_SIZE  (4)
+
+__INLINE void booth_recode_mb4(U64x4* sign, U64x4* dvalue, U64x4 wvalue)
+{
+   /* sign = wvalue>>WIN_SIZE, digit = sign? (2^(WIN_SIZE+1)-1) - wvalue : wvalue */
+   U64x4 s = sub64x4(get_zero64x4(), srli64x4(wvalue, WIN_SIZE));
+   U64x4 d = xor64x4(wvalue, and64x4(s, set1x4((1<<(WIN_SIZE+1))-1)));
+   d = add64x4(srli64x4(d, 1), and64x4(d, set1x4(1)));
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* bits [bit-1, bit+WIN_SIZE) of the scalar */
+__INLINE U64x4 get_window_mb4(const U64x4 scalar[], int bit)
+{
+   int chunk_no = (bit-1)/64;
+   int chunk_shift = (bit-1)%64;
+   U64x4 wvalue = or64x4(srl64x4(scalar[chunk_no], chunk_shift), sll64x4(scalar[chunk_no+1], 64-chunk_shift));
+   return and64x4(wvalue, set1x4((1<<(WIN_SIZE+1))-1));
+}
+
+/* extract point tbl[idx-1], idx==0 gives the point at infinity */
+static void extract_point_mb4(P256_POINT_MB4* r, const P256_POINT_MB4 tbl[], U64x4 idx)
+{
+   U64x4 idx_target = sub64x4(idx, set1x4(1));
+
+   fe26_zero(r->X);
+   fe26_zero(r->Y);
+   fe26_zero(r->Z);
+   for(int n=0; n<(1<<(WIN_SIZE-1)); n++) {
+      U64x4 k = cmpeq64x4(set1x4((int64u)n), idx_target);
+      for(int i=0; i<FE26_LEN; i++) {
+         r->X[i] = or64x4(r->X[i], and64x4(k, tbl[n].X[i]));
+         r->Y[i] = or64x4(r->Y[i], and64x4(k, tbl[n].Y[i]));
+         r->Z[i] = or64x4(r->Z[i], and64x4(k, tbl[n].Z[i]));
+      }
+   }
+}
+
+/* R = sign? -R : R */
+__INLINE void cneg_y_mb4(U64x4 y[], U64x4 sign)
+{
+   U64x4 zero[FE26_LEN];
+   U64x4 ny[FE26_LEN];
+   fe26_zero(zero);
+   sub(ny, zero, y);
+   fe26_select(y, sign, y, ny);
+}
+
+/* r = [scalar]*p, scalar is zero padded up to P256_LEN64+1 digits */
+static void ec_nistp256_mul_point_mb4(P256_POINT_MB4* r, const P256_POINT_MB4* p, const U64x4 scalar[])
+{
+   /* pre-computed table tbl[n-1] = [n]P, n=1,..,2^(WIN_SIZE-1) */
+   P256_POINT_MB4 tbl[1<<(WIN_SIZE-1)];
+
+   point_copy(&tbl[0], p);
+   ec_nistp256_dbl_point_mb4(&tbl[1], p);
+   for(int n=1; n < (1<<(WIN_SIZE-1))/2; n++) {
+      ec_nistp256_add_point_mb4(&tbl[2*n], &tbl[2*n-1], p);
+      ec_nistp256_dbl_point_mb4(&tbl[2*n+1], &tbl[n]);
+   }
+
+   P256_POINT_MB4 R;
+   P256_POINT_MB4 T;
+   U64x4 wvalue, dvalue, dsign;
+
+   /* first window */
+   int bit = P256_BITSIZE-(P256_BITSIZE % WIN_SIZE);
+   wvalue = get_window_mb4(scalar, bit);
+   booth_recode_mb4(&dsign, &dvalue, wvalue);
+   extract_point_mb4(&R, tbl, dvalue);
+
+   for(bit-=WIN_SIZE; bit>=WIN_SIZE; bit-=WIN_SIZE) {
+      ec_nistp256_dbl_point_mb4(&R, &R);
+      ec_nistp256_dbl_point_mb4(&R, &R);
+      ec_nistp256_dbl_point_mb4(&R, &R);
+      ec_nistp256_dbl_point_mb4(&R, &R);
+
+      wvalue = get_window_mb4(scalar, bit);
+      booth_recode_mb4(&dsign, &dvalue, wvalue);
+      extract_point_mb4(&T, tbl, dvalue);
+      cneg_y_mb4(T.Y, dsign);
+
+      ec_nistp256_add_point_mb4(&R, &R, &T);
+   }
+
+   /* last window */
+   ec_nistp256_dbl_point_mb4(&R, &R);
+   ec_nistp256_dbl_point_mb4(&R, &R);
+   ec_nistp256_dbl_point_mb4(&R, &R);
+   ec_nistp256_dbl_point_mb4(&R, &R);
+
+   wvalue = and64x4(slli64x4(scalar[0], 1), set1x4((1<<(WIN_SIZE+1))-1));
+   booth_recode_mb4(&dsign, &dvalue, wvalue);
+   extract_point_mb4(&T, tbl, dvalue);
+   cneg_y_mb4(T.Y, dsign);
+
+   ec_nistp256_add_point_mb4(&R, &R, &T);
+
+   point_copy(r, &R);
+
+   /* clear the secret context */
+   wvalue = dvalue = dsign = get_zero64x4();
+   fe26_zero(R.X); fe26_zero(R.Y); fe26_zero(R.Z);
+   fe26_zero(T.X); fe26_zero(T.Y); fe26_zero(T.Z);
+}
+
+/* extract affine point tbl[idx-1] of the base point table, idx==0 gives the point at infinity */
+static void extract_point_affine_mb4(P256_POINT_AFFINE_MB4* r, const int64u* tbl, U64x4 idx)
+{
+   const U64x4 mask = set1x4(MASK26);
+   U64x4 targIdx = sub64x4(idx, set1x4(1));
+
+   /* table entries are x[5],y[5] in 2^52 radix */
+   U64x4 ax[FE26_LEN/2];
+   U64x4 ay[FE26_LEN/2];
+   for(int j=0; j<FE26_LEN/2; j++)
+      ax[j] = ay[j] = get_zero64x4();
+
+   for(int n=0; n<P256_BP4_N_ENTRY; n++, tbl+=FE26_LEN) {
+      U64x4 k = cmpeq64x4(set1x4((int64u)n), targIdx);
+      for(int j=0; j<FE26_LEN/2; j++) {
+         ax[j] = or64x4(ax[j], and64x4(k, set1x4(tbl[j])));
+         ay[j] = or64x4(ay[j], and64x4(k, set1x4(tbl[FE26_LEN/2+j])));
+      }
+   }
+
+   /* 2^52 -> 2^26 radix */
+   for(int j=0; j<FE26_LEN/2; j++) {
+      r->x[2*j]   = and64x4(ax[j], mask);
+      r->x[2*j+1] = srli64x4(ax[j], 26);
+      r->y[2*j]   = and64x4(ay[j], mask);
+      r->y[2*j+1] = srli64x4(ay[j], 26);
+   }
+}
+
+/* r = [scalar]*G, scalar is zero padded up to P256_LEN64+1 digits */
+static void ec_nistp256_mul_pointbase_mb4(P256_POINT_MB4* r, const U64x4 scalar[])
+{
+   /* pre-computed table of base powers */
+   const int64u* tbl = ifma_ec_nistp256_bp_precomp4;
+
+   P256_POINT_MB4 R;
+   P256_POINT_AFFINE_MB4 A;
+   U64x4 wvalue, dvalue, dsign;
+
+   /* R = O */
+   fe26_zero(R.X);
+   fe26_zero(R.Y);
+   fe26_zero(R.Z);
+
+   /* first window - window[0] */
+   wvalue = and64x4(slli64x4(scalar[0], 1), set1x4((1<<(WIN_SIZE+1))-1));
+   booth_recode_mb4(&dsign, &dvalue, wvalue);
+   extract_point_affine_mb4(&A, tbl, dvalue);
+   tbl += P256_BP4_N_ENTRY*FE26_LEN;
+
+   cneg_y_mb4(A.y, dsign);
+   ec_nistp256_add_point_affine_mb4(&R, &R, &A);
+
+   for(int bit=WIN_SIZE; bit<=P256_BITSIZE; bit+=WIN_SIZE) {
+      wvalue = get_window_mb4(scalar, bit);
+      booth_recode_mb4(&dsign, &dvalue, wvalue);
+      extract_point_affine_mb4(&A, tbl, dvalue);
+      tbl += P256_BP4_N_ENTRY*FE26_LEN;
+
+      cneg_y_mb4(A.y, dsign);
+      ec_nistp256_add_point_affine_mb4(&R, &R, &A);
+   }
+
+   point_copy(r, &R);
+
+   /* clear the secret context */
+   wvalue = dvalue = dsign = get_zero64x4();
+   fe26_zero(R.X); fe26_zero(R.Y); fe26_zero(R.Z);
+   fe26_zero(A.x); fe26_zero(A.y);
+}
+#undef WIN_SIZE
+
+/* lanes mask of the points out of EC, coordinates are in Montgomery domain */
+static U64x4 is_on_curve_mb4(const P256_POINT_MB4* p)
+{
+   U64x4 rh[FE26_LEN];
+   U64x4 Z4[FE26_LEN], Z6[FE26_LEN], tmp[FE26_LEN];
+
+   /* rh = X^3 + a*X*Z^4 + b*Z^6  = X*(X^2 + a*Z^4) + b*Z^6, a = -3 */
+   sqr(rh, p->X);
+   sqr(tmp, p->Z);
+   sqr(Z4, tmp);
+   mul(Z6, Z4, tmp);
+
+   mul3(tmp, Z4);
+   sub(rh, rh, tmp);
+   mul(rh, rh, p->X);
+
+   U64x4 b[FE26_LEN];
+   fe26_set(b, p256_b);
+   mul(tmp, Z6, b);
+   add(rh, rh, tmp);
+   fe26_frommont_p256(rh, rh);
+
+   /* Y^2 */
+   sqr(tmp, p->Y);
+   fe26_frommont_p256(tmp, tmp);
+
+   return fe26_cmp_eq(tmp, rh);
+}
+
+/*
+// 4-lane kernels
+// the lanes given by NULL pointers are computed over zeros and are not stored,
+// the returned masks are the lanes of the errors
+*/
+
+/* public keys [skey]*G, pa_pubz==NULL requests affine coordinates */
+static int8u nistp256_ecpublic_key_mb4(int64u* pa_pubx[MB4_WIDTH],
+                                       int64u* pa_puby[MB4_WIDTH],
+                                       int64u* pa_pubz[MB4_WIDTH],
+                                 const int64u* const pa_skey[MB4_WIDTH])
+{
+   U64x4 scalar[P256_LEN64+1];
+   BNU_transpose_mb4(scalar, pa_skey, P256_BITSIZE);
+   scalar[P256_LEN64] = get_zero64x4();
+
+   int8u zero_mask = mask64x4_to_bits(is_zero64x4(scalar, P256_LEN64));
+
+   P256_POINT_MB4 P;
+   ec_nistp256_mul_pointbase_mb4(&P, scalar);
+   /* clear copy of the secret keys */
+   for(int k=0; k<P256_LEN64; k++)
+      scalar[k] = get_zero64x4();
+
+   if(NULL==pa_pubz)
+      get_nistp256_ec_affine_coords_mb4(P.X, P.Y, &P);
+
+   /* convert P coordinates to regular domain */
+   fe26_frommont_p256(P.X, P.X);
+   fe26_frommont_p256(P.Y, P.Y);
+   if(pa_pubz)
+      fe26_frommont_p256(P.Z, P.Z);
+
+   /* store result */
+   int64u* out_x[MB4_WIDTH];
+   int64u* out_y[MB4_WIDTH];
+   int64u* out_z[MB4_WIDTH];
+   for(int n=0; n<MB4_WIDTH; n++) {
+      int ok = !((zero_mask>>n) &1);
+      out_x[n] = ok? pa_pubx[n] : NULL;
+      out_y[n] = ok? pa_puby[n] : NULL;
+      out_z[n] = (ok && pa_pubz)? pa_pubz[n] : NULL;
+   }
+   mb4_radix_to_BNU(out_x, P.X, FE26_LEN, P256_BITSIZE, 26);
+   mb4_radix_to_BNU(out_y, P.Y, FE26_LEN, P256_BITSIZE, 26);
+   if(pa_pubz)
+      mb4_radix_to_BNU(out_z, P.Z, FE26_LEN, P256_BITSIZE, 26);
+
+   return zero_mask;
+}
+
+/* shared keys ([skey]*(X:Y:Z)).x, pa_pubz==NULL means affine coordinates of the party's public keys */
+static int8u nistp256_ecdh_mb4(int8u* pa_shared_key[MB4_WIDTH],
+                         const int64u* const pa_skey[MB4_WIDTH],
+                         const int64u* const pa_pubx[MB4_WIDTH],
+                         const int64u* const pa_puby[MB4_WIDTH],
+                         const int64u* const* pa_pubz)
+{
+   U64x4 scalar[P256_LEN64+1];
+   BNU_transpose_mb4(scalar, pa_skey, P256_BITSIZE);
+   scalar[P256_LEN64] = get_zero64x4();
+
+   U64x4 err_mask = is_zero64x4(scalar, P256_LEN64);
+
+   /* party's public keys in Montgomery domain */
+   P256_POINT_MB4 P;
+   BNU_to_mb4_radix(P.X, FE26_LEN, pa_pubx, P256_BITSIZE, 26);
+   BNU_to_mb4_radix(P.Y, FE26_LEN, pa_puby, P256_BITSIZE, 26);
+   if(pa_pubz)
+      BNU_to_mb4_radix(P.Z, FE26_LEN, pa_pubz, P256_BITSIZE, 26);
+   else {
+      fe26_zero(P.Z);
+      P.Z[0] = set1x4(1);
+   }
+   fe26_tomont_p256(P.X, P.X);
+   fe26_tomont_p256(P.Y, P.Y);
+   fe26_tomont_p256(P.Z, P.Z);
+
+   /* set points out of EC to infinity */
+   U64x4 not_on_curve_mask = xor64x4(is_on_curve_mb4(&P), set1x4((int64u)-1));
+   U64x4 zero[FE26_LEN];
+   fe26_zero(zero);
+   fe26_select(P.Z, not_on_curve_mask, P.Z, zero);
+   err_mask = or64x4(err_mask, not_on_curve_mask);
+
+   P256_POINT_MB4 R;
+   ec_nistp256_mul_point_mb4(&R, &P, scalar);
+   /* clear copy of the secret keys */
+   for(int k=0; k<P256_LEN64; k++)
+      scalar[k] = get_zero64x4();
+
+   /* affine R.x in regular domain */
+   get_nistp256_ec_affine_coords_mb4(R.X, NULL, &R);
+   fe26_frommont_p256(R.X, R.X);
+
+   /* store result */
+   int8u err = mask64x4_to_bits(err_mask);
+   int8u* out[MB4_WIDTH];
+   for(int n=0; n<MB4_WIDTH; n++)
+      out[n] = ((err>>n) &1)? NULL : pa_shared_key[n];
+   mb4_radix_to_HexStr(out, R.X, FE26_LEN, P256_BITSIZE, 26);
+
+   /* clear computed shared keys */
+   fe26_zero(R.X); fe26_zero(R.Y); fe26_zero(R.Z);
+
+   return err;
+}
+
+/* ECDSA signatures, returns lanes of the wrong parameters, *sign_err - lanes of zero r or s */
+static int8u nistp256_ecdsa_sign_mb4(int8u* pa_sign_r[MB4_WIDTH],
+                                     int8u* pa_sign_s[MB4_WIDTH],
+                               const int8u* const pa_msg[MB4_WIDTH],
+                              const int64u* const pa_eph_skey[MB4_WIDTH],
+                              const int64u* const pa_reg_skey[MB4_WIDTH],
+                                      int8u* sign_err)
+{
+   U64x4 inv_eph_key[FE26_LEN];
+   U64x4 reg_key[FE26_LEN];
+   U64x4 scalar[P256_LEN64+1];
+   U64x4 msg[FE26_LEN];
+   U64x4 sign_r[FE26_LEN];
+   U64x4 sign_s[FE26_LEN];
+   U64x4 tmp[FE26_LEN];
+
+   BNU_to_mb4_radix(inv_eph_key, FE26_LEN, pa_eph_skey, P256_BITSIZE, 26);
+   BNU_transpose_mb4(scalar, pa_eph_skey, P256_BITSIZE);
+   scalar[P256_LEN64] = get_zero64x4();
+   BNU_to_mb4_radix(reg_key, FE26_LEN, pa_reg_skey, P256_BITSIZE, 26);
+   HexStr_to_mb4_radix(msg, FE26_LEN, pa_msg, P256_BITSIZE, 26);
+
+   U64x4 err_mask = or64x4(is_zero64x4(inv_eph_key, FE26_LEN), is_zero64x4(reg_key, FE26_LEN));
+   err_mask = or64x4(err_mask, fe26_check_range(msg, n256_x1));
+
+   /* 1/eph_skey mod n256 (Montgomery domain) */
+   fe26_tomont_n256(inv_eph_key, inv_eph_key);
+   fe26_inv_n256(inv_eph_key, inv_eph_key);
+
+   /* r = ([eph_skey]*G).x mod n256 */
+   P256_POINT_MB4 P;
+   ec_nistp256_mul_pointbase_mb4(&P, scalar);
+   get_nistp256_ec_affine_coords_mb4(sign_r, NULL, &P);
+   fe26_frommont_p256(sign_r, sign_r);
+   fe26_reduce(sign_r, sign_r, n256_x1);
+
+   /* s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
+   fe26_tomont_n256(tmp, sign_r);
+   fe26_tomont_n256(msg, msg);
+   fe26_tomont_n256(reg_key, reg_key);
+   fe26_mul_n256(sign_s, reg_key, tmp);
+   fe26_add(sign_s, sign_s, msg, n256_x2);
+   fe26_mul_n256(sign_s, sign_s, inv_eph_key);
+   fe26_frommont_n256(sign_s, sign_s);
+
+   /* clear copy of the ephemeral and regular secret keys */
+   fe26_zero(inv_eph_key);
+   fe26_zero(reg_key);
+   for(int k=0; k<P256_LEN64; k++)
+      scalar[k] = get_zero64x4();
+
+   *sign_err = mask64x4_to_bits(or64x4(is_zero64x4(sign_r, FE26_LEN), is_zero64x4(sign_s, FE26_LEN)));
+
+   /* store signatures */
+   int8u err = mask64x4_to_bits(err_mask);
+   int8u* out_r[MB4_WIDTH];
+   int8u* out_s[MB4_WIDTH];
+   for(int n=0; n<MB4_WIDTH; n++) {
+      out_r[n] = ((err>>n) &1)? NULL : pa_sign_r[n];
+      out_s[n] = ((err>>n) &1)? NULL : pa_sign_s[n];
+   }
+   mb4_radix_to_HexStr(out_r, sign_r, FE26_LEN, P256_BITSIZE, 26);
+   mb4_radix_to_HexStr(out_s, sign_s, FE26_LEN, P256_BITSIZE, 26);
+
+   return err;
+}
+
+/* ECDSA signatures verification, returns lanes of the wrong parameters, *sign_err - lanes of the invalid signatures */
+static int8u nistp256_ecdsa_verify_mb4(const int8u* const pa_sign_r[MB4_WIDTH],
+                                       const int8u* const pa_sign_s[MB4_WIDTH],
+                                       const int8u* const pa_msg[MB4_WIDTH],
+                                      const int64u* const pa_pubx[MB4_WIDTH],
+                                      const int64u* const pa_puby[MB4_WIDTH],
+                                      const int64u* const* pa_pubz,
+                                              int8u* sign_err)
+{
+   U64x4 msg[FE26_LEN];
+   U64x4 sign_r[FE26_LEN];
+   U64x4 sign_s[FE26_LEN];
+
+   HexStr_to_mb4_radix(msg, FE26_LEN, pa_msg, P256_BITSIZE, 26);
+   HexStr_to_mb4_radix(sign_r, FE26_LEN, pa_sign_r, P256_BITSIZE, 26);
+   HexStr_to_mb4_radix(sign_s, FE26_LEN, pa_sign_s, P256_BITSIZE, 26);
+
+   U64x4 err_mask = fe26_check_range(msg, n256_x1);
+   err_mask = or64x4(err_mask, fe26_check_range(sign_r, n256_x1));
+   err_mask = or64x4(err_mask, fe26_check_range(sign_s, n256_x1));
+
+   P256_POINT_MB4 W;
+   BNU_to_mb4_radix(W.X, FE26_LEN, pa_pubx, P256_BITSIZE, 26);
+   BNU_to_mb4_radix(W.Y, FE26_LEN, pa_puby, P256_BITSIZE, 26);
+   if(pa_pubz)
+      BNU_to_mb4_radix(W.Z, FE26_LEN, pa_pubz, P256_BITSIZE, 26);
+   else {
+      fe26_zero(W.Z);
+      W.Z[0] = set1x4(1);
+   }
+   err_mask = or64x4(err_mask, fe26_check_range(W.X, p256_x1));
+   err_mask = or64x4(err_mask, fe26_check_range(W.Y, p256_x1));
+   err_mask = or64x4(err_mask, fe26_check_range(W.Z, p256_x1));
+
+   fe26_tomont_p256(W.X, W.X);
+   fe26_tomont_p256(W.Y, W.Y);
+   fe26_tomont_p256(W.Z, W.Z);
+
+   /* h = 1/sign_s, h1 = msg*h, h2 = sign_r*h */
+   U64x4 h1[FE26_LEN];
+   U64x4 h2[FE26_LEN];
+   fe26_tomont_n256(sign_s, sign_s);
+   fe26_inv_n256(sign_s, sign_s);
+   fe26_tomont_n256(h1, msg);
+   fe26_mul_n256(h1, h1, sign_s);
+   fe26_frommont_n256(h1, h1);
+   fe26_tomont_n256(h2, sign_r);
+   fe26_mul_n256(h2, h2, sign_s);
+   fe26_frommont_n256(h2, h2);
+
+   U64x4 h1_scalar[P256_LEN64+1];
+   U64x4 h2_scalar[P256_LEN64+1];
+   fe26_to_scalar(h1_scalar, h1);
+   fe26_to_scalar(h2_scalar, h2);
+
+   /* P = h1*G + h2*W */
+   P256_POINT_MB4 P;
+   P256_POINT_MB4 Q;
+   ec_nistp256_mul_point_mb4(&Q, &W, h2_scalar);
+   ec_nistp256_mul_pointbase_mb4(&P, h1_scalar);
+   ec_nistp256_add_point_mb4(&P, &P, &Q);
+
+   /* P != 0 */
+   U64x4 sign_err_mask = fe26_is_zero(P.Z, p256_x1);
+
+   /* sign_r_restored = P.X mod n */
+   U64x4 sign_r_restored[FE26_LEN];
+   get_nistp256_ec_affine_coords_mb4(sign_r_restored, NULL, &P);
+   fe26_frommont_p256(sign_r_restored, sign_r_restored);
+   fe26_reduce(sign_r_restored, sign_r_restored, n256_x1);
+
+   /* sign_r_restored != sign_r */
+   sign_err_mask = or64x4(sign_err_mask, xor64x4(fe26_cmp_eq(sign_r_restored, sign_r), set1x4((int64u)-1)));
+
+   *sign_err = mask64x4_to_bits(sign_err_mask);
+   return mask64x4_to_bits(err_mask);
+}
+
+/*
+// mb8 API over the 4-lane kernels: the batch is processed by halves,
+// the lanes of NULL pointers are excluded, the half is skipped if all its lanes are excluded
+*/
+/* sets status of the lanes [buf_no, buf_no+MB4_WIDTH) given by the mask */
+__INLINE mbx_status set_half_status(mbx_status status, int buf_no, int8u mask, mbx_status sttVal)
+{
+   for(int n=0; n<MB4_WIDTH; n++) {
+      if((mask>>n) &1)
+         status = MBX_SET_STS(status, buf_no+n, sttVal);
+   }
+   return status;
+}
+
+mbx_status avx2_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                         int64u* pa_puby[8],
+                                         int64u* pa_pubz[8],
+                                   const int64u* const pa_skey[8],
+                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_bubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   int64u* out_x[8];
+   int64u* out_y[8];
+   int64u* out_z[8];
+   const int64u* key[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      out_x[buf_no] = pa_pubx[buf_no];
+      out_y[buf_no] = pa_puby[buf_no];
+      out_z[buf_no] = use_jproj_coords? pa_pubz[buf_no] : NULL;
+      key[buf_no] = pa_skey[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==out_x[buf_no] || NULL==out_y[buf_no] || (use_jproj_coords && NULL==out_z[buf_no]) || NULL==key[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         out_x[buf_no] = out_y[buf_no] = out_z[buf_no] = NULL;
+         key[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      int8u half = (int8u)((lanes>>buf_no) & 0xF);
+      if(0==half)
+         continue;
+      int8u err = nistp256_ecpublic_key_mb4(out_x+buf_no, out_y+buf_no, use_jproj_coords? out_z+buf_no : NULL, key+buf_no);
+      status = set_half_status(status, buf_no, half & err, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   return status;
+}
+
+mbx_status avx2_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                          const int64u* const pa_skey[8],
+                          const int64u* const pa_pubx[8],
+                          const int64u* const pa_puby[8],
+                          const int64u* const pa_pubz[8],
+                                 int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_shared_key || NULL==pa_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   int8u* shared[8];
+   const int64u* skey[8];
+   const int64u* pubx[8];
+   const int64u* puby[8];
+   const int64u* pubz[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      shared[buf_no] = pa_shared_key[buf_no];
+      skey[buf_no] = pa_skey[buf_no];
+      pubx[buf_no] = pa_pubx[buf_no];
+      puby[buf_no] = pa_puby[buf_no];
+      pubz[buf_no] = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==shared[buf_no] || NULL==skey[buf_no] || NULL==pubx[buf_no] || NULL==puby[buf_no] || (use_jproj_coords && NULL==pubz[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         shared[buf_no] = NULL;
+         skey[buf_no] = pubx[buf_no] = puby[buf_no] = pubz[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      int8u half = (int8u)((lanes>>buf_no) & 0xF);
+      if(0==half)
+         continue;
+      int8u err = nistp256_ecdh_mb4(shared+buf_no, skey+buf_no, pubx+buf_no, puby+buf_no, use_jproj_coords? pubz+buf_no : NULL);
+      status = set_half_status(status, buf_no, half & err, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   return status;
+}
+
+mbx_status avx2_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                       int8u* pa_sign_s[8],
+                                 const int8u* const pa_msg[8],
+                                const int64u* const pa_eph_skey[8],
+                                const int64u* const pa_reg_skey[8],
+                                       int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_sign_r || NULL==pa_sign_s || NULL==pa_msg || NULL==pa_eph_skey || NULL==pa_reg_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check data pointers, lanes being processed */
+   int8u lanes = 0;
+   int8u* sign_r[8];
+   int8u* sign_s[8];
+   const int8u* msg[8];
+   const int64u* eph_key[8];
+   const int64u* reg_key[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      sign_r[buf_no] = pa_sign_r[buf_no];
+      sign_s[buf_no] = pa_sign_s[buf_no];
+      msg[buf_no] = pa_msg[buf_no];
+      eph_key[buf_no] = pa_eph_skey[buf_no];
+      reg_key[buf_no] = pa_reg_skey[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==sign_r[buf_no] || NULL==sign_s[buf_no] || NULL==msg[buf_no] || NULL==eph_key[buf_no] || NULL==reg_key[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         sign_r[buf_no] = sign_s[buf_no] = NULL;
+         msg[buf_no] = NULL;
+         eph_key[buf_no] = reg_key[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      int8u half = (int8u)((lanes>>buf_no) & 0xF);
+      if(0==half)
+         continue;
+      int8u sign_err;
+      int8u err = nistp256_ecdsa_sign_mb4(sign_r+buf_no, sign_s+buf_no, msg+buf_no, eph_key+buf_no, reg_key+buf_no, &sign_err);
+      status = set_half_status(status, buf_no, half & (int8u)(~err & sign_err), MBX_STATUS_SIGNATURE_ERR);
+      status = set_half_status(status, buf_no, half & err, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   return status;
+}
+
+mbx_status avx2_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                         const int8u* const pa_sign_s[8],
+                                         const int8u* const pa_msg[8],
+                                        const int64u* const pa_pubx[8],
+                                        const int64u* const pa_puby[8],
+                                        const int64u* const pa_pubz[8],
+                                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_msg || NULL==pa_sign_r || NULL==pa_sign_s) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   const int8u* sign_r[8];
+   const int8u* sign_s[8];
+   const int8u* msg[8];
+   const int64u* pubx[8];
+   const int64u* puby[8];
+   const int64u* pubz[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      sign_r[buf_no] = pa_sign_r[buf_no];
+      sign_s[buf_no] = pa_sign_s[buf_no];
+      msg[buf_no] = pa_msg[buf_no];
+      pubx[buf_no] = pa_pubx[buf_no];
+      puby[buf_no] = pa_puby[buf_no];
+      pubz[buf_no] = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==pubx[buf_no] || NULL==puby[buf_no] || NULL==msg[buf_no] || NULL==sign_r[buf_no] || NULL==sign_s[buf_no] || (use_jproj_coords && NULL==pubz[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         sign_r[buf_no] = sign_s[buf_no] = msg[buf_no] = NULL;
+         pubx[buf_no] = puby[buf_no] = pubz[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      int8u half = (int8u)((lanes>>buf_no) & 0xF);
+      if(0==half)
+         continue;
+      int8u sign_err;
+      int8u err = nistp256_ecdsa_verify_mb4(sign_r+buf_no, sign_s+buf_no, msg+buf_no, pubx+buf_no, puby+buf_no,
+                                            use_jproj_coords? pubz+buf_no : NULL, &sign_err);
+      status = set_half_status(status, buf_no, half & (int8u)(~err & sign_err), MBX_STATUS_SIGNATURE_ERR);
+      status = set_half_status(status, buf_no, half & err, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   return status;
+}
+
+/*
+// public entry points
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                         int64u* pa_puby[8],
+                                         int64u* pa_pubz[8],
+                                   const int64u* const pa_skey[8],
+                                          int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_nistp256_ecpublic_key_mb8(pa_pubx, pa_puby, pa_pubz, pa_skey, pBuffer);
+   return ifma_nistp256_ecpublic_key_mb8(pa_pubx, pa_puby, pa_pubz, pa_skey, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                          const int64u* const pa_skey[8],
+                          const int64u* const pa_pubx[8],
+                          const int64u* const pa_puby[8],
+                          const int64u* const pa_pubz[8],
+                                 int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_nistp256_ecdh_mb8(pa_shared_key, pa_skey, pa_pubx, pa_puby, pa_pubz, pBuffer);
+   return ifma_nistp256_ecdh_mb8(pa_shared_key, pa_skey, pa_pubx, pa_puby, pa_pubz, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                       int8u* pa_sign_s[8],
+                                 const int8u* const pa_msg[8],
+                                const int64u* const pa_eph_skey[8],
+                                const int64u* const pa_reg_skey[8],
+                                       int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_nistp256_ecdsa_sign_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_eph_skey, pa_reg_skey, pBuffer);
+   return ifma_nistp256_ecdsa_sign_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_eph_skey, pa_reg_skey, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                         const int8u* const pa_sign_s[8],
+                                         const int8u* const pa_msg[8],
+                                        const int64u* const pa_pubx[8],
+                                        const int64u* const pa_puby[8],
+                                        const int64u* const pa_pubz[8],
+                                               int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_nistp256_ecdsa_verify_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_pubx, pa_puby, pa_pubz, pBuffer);
+   return ifma_nistp256_ecdsa_verify_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_pubx, pa_puby, pa_pubz, pBuffer);
+}
@@ -341,18 +341,18 @@ void MB_FUNC_NAME(ifma_sub52x5_)(U64 R[], const U64 A[], const U64 B[], const U6
 void MB_FUNC_NAME(ifma_neg52x5_)(U64 R[], const U64 A[], const U64 M[])
 {
    /*  mask = a[]!=0? 1 : 0 */
-   U64 t = _mm512_or_epi64(A[0], A[1]);
-   t = _mm512_or_epi64(t, A[2]);
-   t = _mm512_or_epi64(t, A[3]);
-   t = _mm512_or_epi64(t, A[4]);
+   U64 t = or64(A[0], A[1]);
+   t = or64(t, A[2]);
+   t = or64(t, A[3]);
+   t = or64(t, A[4]);
    __mb_mask mask = cmp64_mask(t, get_zero64(), _MM_CMPINT_NE);
 
    /* r = M - A */
-   U64 r0 = _mm512_maskz_sub_epi64(mask, M[0], A[0]);
-   U64 r1 = _mm512_maskz_sub_epi64(mask, M[1], A[1]);
-   U64 r2 = _mm512_maskz_sub_epi64(mask, M[2], A[2]);
-   U64 r3 = _mm512_maskz_sub_epi64(mask, M[3], A[3]);
-   U64 r4 = _mm512_maskz_sub_epi64(mask, M[4], A[4]);
+   U64 r0 = maskz_sub64(mask, M[0], A[0]);
+   U64 r1 = maskz_sub64(mask, M[1], A[1]);
+   U64 r2 = maskz_sub64(mask, M[2], A[2]);
+   U64 r3 = maskz_sub64(mask, M[3], A[3]);
+   U64 r4 = maskz_sub64(mask, M[4], A[4]);
 
    /* normalize r0, r1, r2, r3, r4 */
    NORM_ASHIFTR(r, 0,1)
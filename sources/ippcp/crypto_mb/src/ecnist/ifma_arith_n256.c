@@ -24,36 +24,36 @@
 // EC NIST-P256 prime base point order
 // in 2^52 radix
 */
-__ALIGN64 static const int64u n256_mb[LEN52][8] = {
-   {0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551, 0x9cac2fc632551},
-   {0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b, 0xada7179e84f3b},
-   {0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa, 0xfffffffbce6fa},
-   {0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff, 0x0000fffffffff},
-   {0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000, 0x0ffffffff0000}
+__ALIGN64 static const int64u n256_mb[LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x9cac2fc632551) },
+   { REP_NUM_BUFF_DECL(0xada7179e84f3b) },
+   { REP_NUM_BUFF_DECL(0xfffffffbce6fa) },
+   { REP_NUM_BUFF_DECL(0x0000fffffffff) },
+   { REP_NUM_BUFF_DECL(0x0ffffffff0000) }
 };
 
-__ALIGN64 static const int64u n256x2_mb[LEN52][8] = {
-   {0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2, 0x39585f8c64aa2},
-   {0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77, 0x5b4e2f3d09e77},
-   {0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5, 0xfffffff79cdf5},
-   {0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff, 0x0001fffffffff},
-   {0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000, 0x1fffffffe0000}
+__ALIGN64 static const int64u n256x2_mb[LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x39585f8c64aa2) },
+   { REP_NUM_BUFF_DECL(0x5b4e2f3d09e77) },
+   { REP_NUM_BUFF_DECL(0xfffffff79cdf5) },
+   { REP_NUM_BUFF_DECL(0x0001fffffffff) },
+   { REP_NUM_BUFF_DECL(0x1fffffffe0000) }
 };
 
 /* k0 = -( (1/n256 mod 2^DIGIT_SIZE) ) mod 2^DIGIT_SIZE */
-__ALIGN64 static const int64u n256_k0_mb[8] = {
-   0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f, 0x1c8aaee00bc4f
+__ALIGN64 static const int64u n256_k0_mb[sizeof(U64)/sizeof(int64u)] = {
+   REP_NUM_BUFF_DECL(0x1c8aaee00bc4f)
 };
 
 /* to Montgomery conversion constant
 // rr = 2^((LEN52*DIGIT_SIZE)*2) mod n256
 */
-__ALIGN64 static const int64u n256_rr_mb[LEN52][8] = {
-   {0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba,0x0005cc0dea6dc3ba},
-   {0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084,0x000192a067d8a084},
-   {0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb,0x000bec59615571bb},
-   {0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6,0x0001fc245b2392b6},
-   {0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956,0x0000e12d9559d956}
+__ALIGN64 static const int64u n256_rr_mb[LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x0005cc0dea6dc3ba) },
+   { REP_NUM_BUFF_DECL(0x000192a067d8a084) },
+   { REP_NUM_BUFF_DECL(0x000bec59615571bb) },
+   { REP_NUM_BUFF_DECL(0x0001fc245b2392b6) },
+   { REP_NUM_BUFF_DECL(0x0000e12d9559d956) }
 };
 
 
@@ -24,20 +24,20 @@
 // prime256 = 2^256 - 2^224 + 2^192 + 2^96 -1
 // in 2^52 radix
 */
-__ALIGN64 static const int64u p256_mb[LEN52][8] = {
-   { REP8_DECL(0x000fffffffffffff) },
-   { REP8_DECL(0x00000fffffffffff) },
-   { REP8_DECL(0x0000000000000000) },
-   { REP8_DECL(0x0000001000000000) },
-   { REP8_DECL(0x0000ffffffff0000) }
+__ALIGN64 static const int64u p256_mb[LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x000fffffffffffff) },
+   { REP_NUM_BUFF_DECL(0x00000fffffffffff) },
+   { REP_NUM_BUFF_DECL(0x0000000000000000) },
+   { REP_NUM_BUFF_DECL(0x0000001000000000) },
+   { REP_NUM_BUFF_DECL(0x0000ffffffff0000) }
 };
 
-__ALIGN64 static const int64u p256x2_mb[LEN52][8] = {
-   { REP8_DECL(0x000ffffffffffffe) },
-   { REP8_DECL(0x00001fffffffffff) },
-   { REP8_DECL(0x0000000000000000) },
-   { REP8_DECL(0x0000002000000000) },
-   { REP8_DECL(0x0001fffffffe0000) }
+__ALIGN64 static const int64u p256x2_mb[LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x000ffffffffffffe) },
+   { REP_NUM_BUFF_DECL(0x00001fffffffffff) },
+   { REP_NUM_BUFF_DECL(0x0000000000000000) },
+   { REP_NUM_BUFF_DECL(0x0000002000000000) },
+   { REP_NUM_BUFF_DECL(0x0001fffffffe0000) }
 };
 
 /*
@@ -49,26 +49,24 @@ __ALIGN64 static const int64u p256x2_mb[LEN52][8] = {
 /* to Montgomery conversion constant
 // rr = 2^((5*DIGIT_SIZE)*2) mod p256
 */
-__ALIGN64 static const int64u p256_rr_mb[5][8] = {
-   { REP8_DECL(0x0000000000000300) },
-   { REP8_DECL(0x000ffffffff00000) },
-   { REP8_DECL(0x000ffffefffffffb) },
-   { REP8_DECL(0x000fdfffffffffff) },
-   { REP8_DECL(0x0000000004ffffff) }
+__ALIGN64 static const int64u p256_rr_mb[5][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x0000000000000300) },
+   { REP_NUM_BUFF_DECL(0x000ffffffff00000) },
+   { REP_NUM_BUFF_DECL(0x000ffffefffffffb) },
+   { REP_NUM_BUFF_DECL(0x000fdfffffffffff) },
+   { REP_NUM_BUFF_DECL(0x0000000004ffffff) }
 };
 
 
 
 /* other constants */
-__ALIGN64 static const int64u VDIGIT_MASK_[8] =
-        {DIGIT_MASK, DIGIT_MASK, DIGIT_MASK, DIGIT_MASK,
-         DIGIT_MASK, DIGIT_MASK, DIGIT_MASK, DIGIT_MASK};
+__ALIGN64 static const int64u VDIGIT_MASK_[sizeof(U64)/sizeof(int64u)] =
+        {REP_NUM_BUFF_DECL(DIGIT_MASK)};
 #define VDIGIT_MASK loadu64(VDIGIT_MASK_)
 
 #define P256_PRIME_TOP_ 0xFFFFFFFF0000LL
-__ALIGN64 static const int64u VP256_PRIME_TOP_[8] =
-        {P256_PRIME_TOP_, P256_PRIME_TOP_, P256_PRIME_TOP_, P256_PRIME_TOP_,
-         P256_PRIME_TOP_, P256_PRIME_TOP_, P256_PRIME_TOP_, P256_PRIME_TOP_};
+__ALIGN64 static const int64u VP256_PRIME_TOP_[sizeof(U64)/sizeof(int64u)] =
+        {REP_NUM_BUFF_DECL(P256_PRIME_TOP_)};
 #define VP256_PRIME_TOP loadu64(VP256_PRIME_TOP_)
 
 
@@ -593,6 +591,54 @@ void MB_FUNC_NAME(ifma_aminv52_p256_)(U64 r[], const U64 z[])
    mul_p256(r, tmp1, tmp2);
 }
 
+/*
+// computes r = sqrt(a) = a^((p256+1)/4) mod p256
+//       => r = a^(2^254 - 2^222 + 2^190 + 2^94)
+//
+// note: a in in Montgomery domain, r in Montgomery domain too
+//       r is the square root only if a is a quadratic residue, the caller has to check r^2 == a
+*/
+void MB_FUNC_NAME(ifma_amsqrt52_p256_)(U64 r[], const U64 a[])
+{
+   __ALIGN64 U64 tmp[LEN52];
+   __ALIGN64 U64 e2[LEN52];
+   __ALIGN64 U64 e4[LEN52];
+   __ALIGN64 U64 e8[LEN52];
+   __ALIGN64 U64 e16[LEN52];
+
+   int i;
+
+   /* e2 = tmp = a^(2^2 - 2^0) */
+   sqr_p256(tmp, a);
+   mul_p256(tmp, tmp, a);
+   MB_FUNC_NAME(mov_FE256_)(e2, tmp);
+   /* e4 = tmp = a^(2^4 - 2^0) */
+   for(i=0; i<2; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, e2);
+   MB_FUNC_NAME(mov_FE256_)(e4, tmp);
+   /* e8 = tmp = a^(2^8 - 2^0) */
+   for(i=0; i<4; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, e4);
+   MB_FUNC_NAME(mov_FE256_)(e8, tmp);
+   /* e16 = tmp = a^(2^16 - 2^0) */
+   for(i=0; i<8; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, e8);
+   MB_FUNC_NAME(mov_FE256_)(e16, tmp);
+   /* tmp = a^(2^32 - 2^0) */
+   for(i=0; i<16; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, e16);
+
+   /* tmp = a^(2^64 - 2^32 + 2^0) */
+   for(i=0; i<32; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, a);
+   /* tmp = a^(2^160 - 2^128 + 2^96 + 2^0) */
+   for(i=0; i<96; i++) sqr_p256(tmp, tmp);
+   mul_p256(tmp, tmp, a);
+   /* r = a^(2^254 - 2^222 + 2^190 + 2^94) */
+   for(i=0; i<93; i++) sqr_p256(tmp, tmp);
+   sqr_p256(r, tmp);
+}
+
 
 /*=====================================================================
 
@@ -398,6 +398,56 @@ void MB_FUNC_NAME(ifma_aminv52_p384_)(U64 r[], const U64 z[])
    fe52_mul(r, v, zD);
 }
 
+/*
+// computes r = sqrt(a) = a^((p384+1)/4) mod p384
+//       => r = a^(0x3FFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF BFFFFFFFC0000000 0000000040000000)
+//
+// note: a in in Montgomery domain, r in Montgomery domain too
+//       r is the square root only if a is a quadratic residue, the caller has to check r^2 == a
+*/
+void MB_FUNC_NAME(ifma_amsqrt52_p384_)(U64 r[], const U64 a[])
+{
+   __ALIGN64 U64   u[P384_LEN52];
+   __ALIGN64 U64  x2[P384_LEN52];
+   __ALIGN64 U64  x3[P384_LEN52];
+   __ALIGN64 U64 x15[P384_LEN52];
+   __ALIGN64 U64 x30[P384_LEN52];
+   __ALIGN64 U64 x32[P384_LEN52];
+
+   /* each xI holds a^(2^I-1) */
+   fe52_sqr(u, a);              /* x2  = a^(2^2-1) */
+   fe52_mul(x2, u, a);
+   fe52_sqr(u, x2);             /* x3  = a^(2^3-1) */
+   fe52_mul(x3, u, a);
+   fe52_sqr_pwr(u, x3, 3);      /* u   = a^(2^6-1) */
+   fe52_mul(u, u, x3);
+   fe52_sqr_pwr(x15, u, 6);     /* u   = a^(2^12-1) */
+   fe52_mul(u, x15, u);
+   fe52_sqr_pwr(u, u, 3);       /* x15 = a^(2^15-1) */
+   fe52_mul(x15, u, x3);
+   fe52_sqr_pwr(u, x15, 15);    /* x30 = a^(2^30-1) */
+   fe52_mul(x30, u, x15);
+   fe52_sqr_pwr(u, x30, 2);     /* x32 = a^(2^32-1) */
+   fe52_mul(x32, u, x2);
+   fe52_sqr_pwr(u, x30, 30);    /* u   = a^(2^60-1) */
+   fe52_mul(u, u, x30);
+   fe52_sqr_pwr(x2, u, 60);     /* u   = a^(2^120-1) */
+   fe52_mul(u, x2, u);
+   fe52_sqr_pwr(x2, u, 120);    /* u   = a^(2^240-1) */
+   fe52_mul(u, x2, u);
+   fe52_sqr_pwr(u, u, 15);      /* u   = a^(2^255-1) */
+   fe52_mul(u, u, x15);
+
+   /* u = a^(2^255-1).0.(2^32-1) */
+   fe52_sqr_pwr(u, u, 1+32);
+   fe52_mul(u, u, x32);
+   /* u = a^(2^255-1).0.(2^32-1).0{63}.1 */
+   fe52_sqr_pwr(u, u, 64);
+   fe52_mul(u, u, a);
+   /* r = a^(2^255-1).0.(2^32-1).0{63}.1.0{30} */
+   fe52_sqr_pwr(r, u, 30);
+}
+
 /*=====================================================================
 
  Specialized single operations over p384:  add, sub, neg
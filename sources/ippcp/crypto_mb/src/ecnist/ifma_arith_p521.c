@@ -570,6 +570,18 @@ void MB_FUNC_NAME(ifma_aminv52_p521_)(U64 r[], const U64 z[])
    fe52_mul(r, v, zD);
 }
 
+/*
+// computes r = sqrt(a) = a^((p521+1)/4) mod p521
+//       => r = a^(2^519)
+//
+// note: a in in Montgomery domain, r in Montgomery domain too
+//       r is the square root only if a is a quadratic residue, the caller has to check r^2 == a
+*/
+void MB_FUNC_NAME(ifma_amsqrt52_p521_)(U64 r[], const U64 a[])
+{
+   fe52_sqr_pwr(r, a, 519);
+}
+
 /*=====================================================================
 
  Specialized single operations over p521:  add, sub, neg
@@ -21,6 +21,7 @@
 #include <internal/common/ifma_cvt52.h>
 #include <internal/ecnist/ifma_ecpoint_p256.h>
 #include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ecnist/avx2_p256.h>
 
 #ifndef BN_OPENSSL_DISABLE
 #include <openssl/bn.h>
@@ -147,13 +148,12 @@ mbx_status mbx_nistp256_ecdh_ssl_mb8(int8u* pa_shared_key[8],
 }
 #endif // BN_OPENSSL_DISABLE
 
-DLL_PUBLIC
-mbx_status mbx_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
-                          const int64u* const pa_skey[8],
-                          const int64u* const pa_pubx[8],
-                          const int64u* const pa_puby[8],
-                          const int64u* const pa_pubz[8],
-                                 int8u* pBuffer)
+mbx_status ifma_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                           const int64u* const pa_skey[8],
+                           const int64u* const pa_pubx[8],
+                           const int64u* const pa_puby[8],
+                           const int64u* const pa_pubz[8],
+                                  int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
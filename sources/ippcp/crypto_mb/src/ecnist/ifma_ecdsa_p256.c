@@ -19,8 +19,9 @@
 
 #include <internal/common/ifma_defs.h>
 #include <internal/common/ifma_cvt52.h>
-#include <internal/ecnist/ifma_ecpoint_p256.h>
+#include <internal/ecnist/ifma_ecdsa_p256.h>
 #include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ecnist/avx2_p256.h>
 
 #ifndef BN_OPENSSL_DISABLE
 #include <openssl/bn.h>
@@ -35,93 +36,23 @@
 */
 
 /*
-// compute secret key inversion
-//
-// inv_skey 1/skey mod n256
-//
-// note: pay attention on skey[] presenttaion
-//       it should be FE element of N256 basef GF
-*/
-static void nistp256_ecdsa_inv_keys_mb8(U64 inv_skey[],
-                                  const U64 skey[],
-                                      int8u pBuffer[])
-{
-   /* compute inversion ober n256 of secret keys */
-   MB_FUNC_NAME(ifma_tomont52_n256_)(inv_skey, skey);
-   ifma_aminv52_n256_mb8(inv_skey, inv_skey);              /* 1/skeys mod n256 */
-   MB_FUNC_NAME(ifma_frommont52_n256_)(inv_skey, inv_skey);
-}
-
-/*
-// compute r-component of the ECDSA signature
-//
-// r = ([skey]*G).x mod n256
-//
-// note: pay attention on skey[] presenttaion
-//       it should be transposed and zero expanded 
-*/
-static __mb_mask nistp256_ecdsa_sign_r_mb8(U64 sign_r[],
-                                     const U64 skey[],
-                                         int8u pBuffer[])
-{
-   /* compute ephemeral public keys */
-   P256_POINT P;
-
-   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, skey);
-
-   /* extract affine P.x */
-   MB_FUNC_NAME(ifma_aminv52_p256_)(P.Z, P.Z); /* 1/Z   */
-   MB_FUNC_NAME(ifma_ams52_p256_)(P.Z, P.Z);   /* 1/Z^2 */
-   MB_FUNC_NAME(ifma_amm52_p256_)(P.X, P.X, P.Z);  /* x = (X) * (1/Z^2) */
-
-   /* convert x-coordinate to regular and then tp Montgomery n256 */
-   MB_FUNC_NAME(ifma_frommont52_p256_)(P.X, P.X);
-   MB_FUNC_NAME(ifma_fastred52_pn256_)(sign_r, P.X);  /* fast reduction p => n */
-
-   return MB_FUNC_NAME(is_zero_FE256_)(sign_r);
-}
-
-/*
-// compute s-component of the ECDSA signature
-//
-// s = (inv_eph) * (msg + prv_skey*sign_r) mod n256
+// ECDSA signature verification algorithm
 */
-static __mb_mask nistp256_ecdsa_sign_s_mb8(U64 sign_s[],
-                                           U64 msg[],
-                                     const U64 sign_r[],
-                                           U64 inv_eph_skey[],
-                                           U64 reg_skey[],
-                                         int8u pBuffer[])
-{
-   __ALIGN64 U64 tmp[P256_LEN52];
-
-   /* conver to Montgomery over n256 domain */
-   MB_FUNC_NAME(ifma_tomont52_n256_)(inv_eph_skey, inv_eph_skey);
-   MB_FUNC_NAME(ifma_tomont52_n256_)(tmp, sign_r);
-   MB_FUNC_NAME(ifma_tomont52_n256_)(msg, msg);
-   MB_FUNC_NAME(ifma_tomont52_n256_)(reg_skey, reg_skey);
-
-   /* s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
-   MB_FUNC_NAME(ifma_amm52_n256_)(sign_s, reg_skey, tmp);
-   MB_FUNC_NAME(ifma_add52_n256_)(sign_s, sign_s, msg);
-   MB_FUNC_NAME(ifma_amm52_n256_)(sign_s, sign_s, inv_eph_skey);
-   MB_FUNC_NAME(ifma_frommont52_n256_)(sign_s, sign_s);
-
-   return MB_FUNC_NAME(is_zero_FE256_)(sign_s);
-}
-
 /*
-// ECDSA signature verification algorithm
+// public key is either the point W or (if W is NULL) the lanes' pre-computed tables pa_tbl[]
 */
 static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
                                            U64 sign_s[],
                                            U64 msg[],
-                                   P256_POINT* W)
+                                   P256_POINT* W,
+                const SINGLE_P256_POINT_AFFINE* const pa_tbl[8])
 {
    /* convert public key coords to Montgomery */
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->X, W->X);
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Y, W->Y);
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Z, W->Z);
+   if(W) {
+      MB_FUNC_NAME(ifma_tomont52_p256_)(W->X, W->X);
+      MB_FUNC_NAME(ifma_tomont52_p256_)(W->Y, W->Y);
+      MB_FUNC_NAME(ifma_tomont52_p256_)(W->Z, W->Z);
+   }
 
    __ALIGN64 U64 h1[P256_LEN52];
    __ALIGN64 U64 h2[P256_LEN52];
@@ -152,11 +83,15 @@ static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
    h2[P256_LEN64] = get_zero64();
 
    P256_POINT P;
+   P256_POINT Q;
 
    // P = h1*G + h2*W
-   MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(W, W, h2);
-   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, h1);
-   MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&P, &P, W);
+   if(W)
+      MB_FUNC_NAME(ifma_ec_nistp256_mul_point_vartime_)(&Q, W, h2);
+   else
+      MB_FUNC_NAME(ifma_ec_nistp256_mul_point_comb_vartime_)(&Q, pa_tbl, h2);
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_vartime_)(&P, h1);
+   MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&P, &P, &Q);
 
    // P != 0
    __mb_mask signature_err_mask = MB_FUNC_NAME(is_zero_point_cordinate_)(P.Z);
@@ -173,6 +108,90 @@ static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
    return signature_err_mask;
 }
 
+/*
+// Pre-computed table of the public key: header followed by the comb table
+//    SINGLE_P256_POINT_AFFINE[P256_COMB_N_SLOTS][P256_COMB_N_ENTRY]
+*/
+#define PUBTBL_ID        (0x424d4f4336353250ULL)   /* "P256COMB" */
+#define PUBTBL_HDR_SIZE  (64)
+#define PUBTBL_SIZE      (PUBTBL_HDR_SIZE + (int)sizeof(SINGLE_P256_POINT_AFFINE)*P256_COMB_N_SLOTS*P256_COMB_N_ENTRY)
+
+/* computes tables of the public keys W (radix 2^52, lanes of status not OK are skipped) */
+static mbx_status nistp256_ecdsa_verify_precomp_mb8(int8u* const pa_table[8],
+                                                P256_POINT* W,
+                                                        int use_jproj_coords,
+                                                 mbx_status status)
+{
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_p256_)(W->X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_p256_)(W->Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_p256_)(W->Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* convert public key coords to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->X, W->X);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Y, W->Y);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Z, W->Z);
+
+   /* check if W does not belong to EC or is the point at infinity */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_p256_)(W, use_jproj_coords);
+   not_on_curve_mask |= MB_FUNC_NAME(is_zero_point_cordinate_)(W->Z);
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   SINGLE_P256_POINT_AFFINE* pa_tbl[8];
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      pa_tbl[buf_no] = MBX_STATUS_OK==MBX_GET_STS(status, buf_no)? (SINGLE_P256_POINT_AFFINE*)(pa_table[buf_no] + PUBTBL_HDR_SIZE) : NULL;
+
+   MB_FUNC_NAME(ifma_ec_nistp256_precomp_comb_)(pa_tbl, W);
+
+   /* set up headers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(pa_tbl[buf_no]) {
+         int64u* pHeader = (int64u*)pa_table[buf_no];
+         int n;
+         for(n=0; n<PUBTBL_HDR_SIZE/(int)sizeof(int64u); n++)
+            pHeader[n] = 0;
+         pHeader[0] = PUBTBL_ID;
+      }
+   }
+
+   return status;
+}
+
+/* checks headers and returns lanes' comb tables (lanes of status not OK refer to a table of valid lane) */
+static mbx_status nistp256_ecdsa_verify_pubtbl(const SINGLE_P256_POINT_AFFINE* pa_tbl[8],
+                                                           const int8u* const pa_table[8],
+                                                                 mbx_status status)
+{
+   const SINGLE_P256_POINT_AFFINE* pValid = NULL;
+   int buf_no;
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      pa_tbl[buf_no] = NULL;
+      if(MBX_STATUS_OK!=MBX_GET_STS(status, buf_no))
+         continue;
+
+      if(PUBTBL_ID != ((const int64u*)pa_table[buf_no])[0]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      pa_tbl[buf_no] = (const SINGLE_P256_POINT_AFFINE*)(pa_table[buf_no] + PUBTBL_HDR_SIZE);
+      pValid = pa_tbl[buf_no];
+   }
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_tbl[buf_no])
+         pa_tbl[buf_no] = pValid;
+   }
+
+   return status;
+}
+
 /*
 // ECDSA kernels
 */
@@ -230,7 +249,7 @@ mbx_status mbx_nistp256_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
       return status;
    }
 
-   nistp256_ecdsa_inv_keys_mb8(T, T, 0);
+   MB_FUNC_NAME(nistp256_ecdsa_inv_keys_)(T, T, 0);
    /* return results in suitable format */
    ifma_mb8_to_BNU(pa_inv_eph_skey, (const int64u(*)[8])T, P256_BITSIZE);
 
@@ -242,7 +261,7 @@ mbx_status mbx_nistp256_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
    ifma_BNU_transpose_copy((int64u (*)[8])scalarz, pa_eph_skey, P256_BITSIZE);
    scalarz[P256_LEN64] = get_zero64();
    /* compute r-component of the DSA signature */
-   int8u stt_mask = nistp256_ecdsa_sign_r_mb8(T, scalarz, pBuffer);
+   int8u stt_mask = MB_FUNC_NAME(nistp256_ecdsa_sign_r_)(T, scalarz, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
@@ -329,7 +348,7 @@ mbx_status mbx_nistp256_ecdsa_sign_complete_mb8(int8u* pa_sign_r[8],
    }
 
    /* compute s- signature component: s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
-   nistp256_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph, reg_skey, pBuffer);
+   MB_FUNC_NAME(nistp256_ecdsa_sign_s_)(sign_s, msg, sign_r, inv_eph, reg_skey, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])inv_eph, sizeof(inv_eph)/sizeof(U64));
@@ -349,6 +368,56 @@ mbx_status mbx_nistp256_ecdsa_sign_complete_mb8(int8u* pa_sign_r[8],
    return status;
 }
 
+/*
+// Signs the lanes having OK status, the lanes are packed and processed
+// by half-width (mb4) kernels if there are 4 of them at most.
+// Returns mask of the lanes being processed.
+*/
+static __mb_mask nistp256_ecdsa_sign_lanes(U64 sign_r[], U64 sign_s[], U64 inv_eph_key[], const U64 scalar[],
+                                           U64 reg_key[], U64 msg[], mbx_status status, int8u* pBuffer)
+{
+   __mb_mask lanes = 0;
+   int num_lanes = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK==MBX_GET_STS(status, buf_no)) {
+         lanes |= (__mb_mask)(1<<buf_no);
+         num_lanes++;
+      }
+   }
+
+   if(num_lanes<=4) {
+      /* partially filled batch: pack the lanes and use half-width (mb4) kernels */
+      __ALIGN64 int64u inv_eph_key_mb4[P256_LEN52][4];
+      __ALIGN64 int64u reg_key_mb4[P256_LEN52][4];
+      __ALIGN64 int64u sign_r_mb4[P256_LEN52][4];
+      __ALIGN64 int64u sign_s_mb4[P256_LEN52][4];
+      __ALIGN64 int64u scalar_mb4[P256_LEN64+1][4];
+      __ALIGN64 int64u msg_mb4[P256_LEN52][4];
+
+      ifma_mb8_to_mb4(inv_eph_key_mb4, (const int64u (*)[8])inv_eph_key, P256_LEN52, lanes);
+      ifma_mb8_to_mb4(scalar_mb4, (const int64u (*)[8])scalar, P256_LEN64+1, lanes);
+      ifma_mb8_to_mb4(reg_key_mb4, (const int64u (*)[8])reg_key, P256_LEN52, lanes);
+      ifma_mb8_to_mb4(msg_mb4, (const int64u (*)[8])msg, P256_LEN52, lanes);
+
+      nistp256_ecdsa_sign_mb4(sign_r_mb4, sign_s_mb4, inv_eph_key_mb4, (const int64u (*)[4])scalar_mb4, reg_key_mb4, msg_mb4, pBuffer);
+
+      ifma_mb4_to_mb8((int64u (*)[8])sign_r, (const int64u (*)[4])sign_r_mb4, P256_LEN52, lanes);
+      ifma_mb4_to_mb8((int64u (*)[8])sign_s, (const int64u (*)[4])sign_s_mb4, P256_LEN52, lanes);
+
+      /* clear copy of the ephemeral and regular secret keys */
+      zero_mb4(inv_eph_key_mb4, P256_LEN52);
+      zero_mb4(scalar_mb4, P256_LEN64+1);
+      zero_mb4(reg_key_mb4, P256_LEN52);
+   }
+   else {
+      nistp256_ecdsa_sign_mb8((int64u (*)[8])sign_r, (int64u (*)[8])sign_s, (int64u (*)[8])inv_eph_key,
+                              (const int64u (*)[8])scalar, (int64u (*)[8])reg_key, (int64u (*)[8])msg, pBuffer);
+   }
+
+   return lanes;
+}
+
 /*
 // Computes ECDSA signature
 // pa_sign_r[]       array of pointers to the computed r-components of the signatures
@@ -358,13 +427,12 @@ mbx_status mbx_nistp256_ecdsa_sign_complete_mb8(int8u* pa_sign_r[8],
 // pa_reg_skey[]     array of pointers to the signer's regular (long term) private keys
 // pBuffer           pointer to the scratch buffer
 */
-DLL_PUBLIC
-mbx_status mbx_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
-                                       int8u* pa_sign_s[8],
-                                 const int8u* const pa_msg[8],
-                                const int64u* const pa_eph_skey[8],
-                                const int64u* const pa_reg_skey[8],
-                                       int8u* pBuffer)
+mbx_status ifma_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                        int8u* pa_sign_s[8],
+                                  const int8u* const pa_msg[8],
+                                 const int64u* const pa_eph_skey[8],
+                                 const int64u* const pa_reg_skey[8],
+                                        int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
@@ -419,12 +487,8 @@ mbx_status mbx_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
       return status;
    }
 
-   /* compute inversion */
-   nistp256_ecdsa_inv_keys_mb8(inv_eph_key, inv_eph_key, pBuffer);
-   /* compute r-component */
-   nistp256_ecdsa_sign_r_mb8(sign_r, scalar, pBuffer);
-   /* compute s-component */
-   nistp256_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph_key, reg_key, pBuffer);
+   /* sign lanes having OK status */
+   __mb_mask lanes = nistp256_ecdsa_sign_lanes(sign_r, sign_s, inv_eph_key, scalar, reg_key, msg, status, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])inv_eph_key, sizeof(inv_eph_key)/sizeof(U64));
@@ -434,8 +498,8 @@ mbx_status mbx_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
    MB_FUNC_NAME(zero_)((int64u (*)[8])reg_key, sizeof(reg_key)/sizeof(U64));
 
    /* check if sign_r!=0 and sign_s!=0 */
-   int8u stt_mask_r = MB_FUNC_NAME(is_zero_FE256_)(sign_r);
-   int8u stt_mask_s = MB_FUNC_NAME(is_zero_FE256_)(sign_s);
+   int8u stt_mask_r = MB_FUNC_NAME(is_zero_FE256_)(sign_r) & lanes;
+   int8u stt_mask_s = MB_FUNC_NAME(is_zero_FE256_)(sign_s) & lanes;
 
    /* convert singnature components to strings */
    ifma_mb8_to_HexStr8(pa_sign_r, (const int64u(*)[8])sign_r, P256_BITSIZE);
@@ -455,14 +519,13 @@ mbx_status mbx_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
 // pa_puby[]         array of pointers to the public keys Y-coordinates
 // pa_pubz[]         array of pointers to the public keys Z-coordinates
 // pBuffer           pointer to the scratch buffer*/
-DLL_PUBLIC
-mbx_status mbx_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
-                                         const int8u* const pa_sign_s[8],
-                                         const int8u* const pa_msg[8],
-                                         const int64u* const pa_pubx[8],
-                                         const int64u* const pa_puby[8],
-                                         const int64u* const pa_pubz[8],                                       
-                                               int8u* pBuffer)
+mbx_status ifma_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                          const int8u* const pa_sign_s[8],
+                                          const int8u* const pa_msg[8],
+                                          const int64u* const pa_pubx[8],
+                                          const int64u* const pa_puby[8],
+                                          const int64u* const pa_pubz[8],                                       
+                                                int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
@@ -525,7 +588,133 @@ mbx_status mbx_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
    if(!MBX_IS_ANY_OK_STS(status))
       return status;
 
-   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, &W);
+   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, &W, NULL);
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   return status;
+}
+
+/*
+// Size of pre-computed table of the public key
+*/
+DLL_PUBLIC
+int mbx_nistp256_ecdsa_verify_TableSize(void)
+{
+   return PUBTBL_SIZE;
+}
+
+/*
+// Pre-computes tables of public keys for ECDSA signature verification
+// pa_table[]        array of pointers to the tables (mbx_nistp256_ecdsa_verify_TableSize() bytes each)
+// pa_pubx[]         array of pointers to the public keys X-coordinates
+// pa_puby[]         array of pointers to the public keys Y-coordinates
+// pa_pubz[]         array of pointers to the public keys Z-coordinates
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_verify_precomp_mb8(int8u* pa_table[8],
+                                   const int64u* const pa_pubx[8],
+                                   const int64u* const pa_puby[8],
+                                   const int64u* const pa_pubz[8],
+                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   P256_POINT W;
+
+   ifma_BNU_to_mb8((int64u (*)[8])W.X, (const int64u* (*))pa_pubx, P256_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])W.Y, (const int64u* (*))pa_puby, P256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BNU_to_mb8((int64u (*)[8])W.Z, (const int64u* (*))pa_pubz, P256_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FE256_)(W.Z, (U64*)ones);
+
+   return nistp256_ecdsa_verify_precomp_mb8(pa_table, &W, use_jproj_coords, status);
+}
+
+/*
+// Verifies ECDSA signature using pre-computed tables of public keys
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages are being signed
+// pa_table[]        array of pointers to the tables computed by mbx_nistp256_ecdsa_verify_precomp_mb8()
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_verify_tbl_mb8(const int8u* const pa_sign_r[8],
+                                             const int8u* const pa_sign_s[8],
+                                             const int8u* const pa_msg[8],
+                                             const int8u* const pa_table[8],
+                                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_msg || NULL==pa_sign_r || NULL==pa_sign_s) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pa_msg[buf_no] || NULL==pa_sign_r[buf_no] || NULL==pa_sign_s[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   const SINGLE_P256_POINT_AFFINE* pa_tbl[8];
+   status = nistp256_ecdsa_verify_pubtbl(pa_tbl, pa_table, status);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 U64 msg[P256_LEN52];
+   __ALIGN64 U64 sign_r[P256_LEN52];
+   __ALIGN64 U64 sign_s[P256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])msg, pa_msg, P256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_r, pa_sign_r, P256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_s, pa_sign_s, P256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(msg), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, NULL, pa_tbl);
    status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
 
    return status;
@@ -607,7 +796,7 @@ mbx_status mbx_nistp256_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
       return status;
    }
       
-   nistp256_ecdsa_inv_keys_mb8(T, T, 0);
+   MB_FUNC_NAME(nistp256_ecdsa_inv_keys_)(T, T, 0);
    /* store results in suitable format */
    ifma_mb8_to_BN_256(pa_inv_skey, (const int64u (*)[8])T);
 
@@ -619,7 +808,7 @@ mbx_status mbx_nistp256_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
    ifma_BN_transpose_copy((int64u (*)[8])scalarz, pa_eph_skey, P256_BITSIZE);
    scalarz[P256_LEN64] = get_zero64();
    /* compute r-component of the DSA signature */
-   int8u stt_mask = nistp256_ecdsa_sign_r_mb8(T, scalarz, pBuffer);
+   int8u stt_mask = MB_FUNC_NAME(nistp256_ecdsa_sign_r_)(T, scalarz, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
@@ -692,7 +881,7 @@ mbx_status mbx_nistp256_ecdsa_sign_complete_ssl_mb8(int8u* pa_sign_r[8],
    }
 
    /* compute s- signature component: s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
-   nistp256_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph, reg_skey, pBuffer);
+   MB_FUNC_NAME(nistp256_ecdsa_sign_s_)(sign_s, msg, sign_r, inv_eph, reg_skey, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])inv_eph, sizeof(inv_eph)/sizeof(U64));
@@ -772,12 +961,8 @@ mbx_status mbx_nistp256_ecdsa_sign_ssl_mb8(int8u* pa_sign_r[8],
       return status;
    }
 
-   /* compute inversion */
-   nistp256_ecdsa_inv_keys_mb8(inv_eph_key, inv_eph_key, pBuffer);
-   /* compute r-component */
-   nistp256_ecdsa_sign_r_mb8(sign_r, scalar, pBuffer);
-   /* compute s-component */
-   nistp256_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph_key, reg_key, pBuffer);
+   /* sign lanes having OK status */
+   __mb_mask lanes = nistp256_ecdsa_sign_lanes(sign_r, sign_s, inv_eph_key, scalar, reg_key, msg, status, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])inv_eph_key, sizeof(inv_eph_key)/sizeof(U64));
@@ -791,8 +976,8 @@ mbx_status mbx_nistp256_ecdsa_sign_ssl_mb8(int8u* pa_sign_r[8],
    ifma_mb8_to_HexStr8(pa_sign_s, (const int64u(*)[8])sign_s, P256_BITSIZE);
 
    /* check if sign_r!=0 and sign_s!=0 */
-   int8u stt_mask_r = MB_FUNC_NAME(is_zero_FE256_)(sign_r);
-   int8u stt_mask_s = MB_FUNC_NAME(is_zero_FE256_)(sign_s);
+   int8u stt_mask_r = MB_FUNC_NAME(is_zero_FE256_)(sign_r) & lanes;
+   int8u stt_mask_s = MB_FUNC_NAME(is_zero_FE256_)(sign_s) & lanes;
    status |= MBX_SET_STS_BY_MASK(status, stt_mask_r, MBX_STATUS_SIGNATURE_ERR);
    status |= MBX_SET_STS_BY_MASK(status, stt_mask_s, MBX_STATUS_SIGNATURE_ERR);
    return status;
@@ -878,7 +1063,119 @@ mbx_status mbx_nistp256_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
    if(!MBX_IS_ANY_OK_STS(status))
       return status;
 
-   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, &W);
+   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, &W, NULL);
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_verify_precomp_ssl_mb8(int8u* pa_table[8],
+                                       const BIGNUM* const pa_pubx[8],
+                                       const BIGNUM* const pa_puby[8],
+                                       const BIGNUM* const pa_pubz[8],
+                                              int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const BIGNUM* pubx = pa_pubx[buf_no];
+      const BIGNUM* puby = pa_puby[buf_no];
+      const BIGNUM* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   P256_POINT W;
+
+   ifma_BN_to_mb8((int64u (*)[8])W.X, pa_pubx, P256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])W.Y, pa_puby, P256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BN_to_mb8((int64u (*)[8])W.Z, pa_pubz, P256_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FE256_)(W.Z, (U64*)ones);
+
+   return nistp256_ecdsa_verify_precomp_mb8(pa_table, &W, use_jproj_coords, status);
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ecdsa_verify_tbl_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
+                                                 const int8u*  const pa_msg[8],
+                                                 const int8u*  const pa_table[8],
+                                                       int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_msg || NULL==pa_sig) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pa_msg[buf_no] || NULL==pa_sig[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   const SINGLE_P256_POINT_AFFINE* pa_tbl[8];
+   status = nistp256_ecdsa_verify_pubtbl(pa_tbl, pa_table, status);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   BIGNUM* pa_sign_r[8] = { 0,0,0,0,0,0,0,0 };
+   BIGNUM* pa_sign_s[8] = { 0,0,0,0,0,0,0,0 };
+
+   for (buf_no = 0; buf_no < 8; buf_no++)
+   {
+      if(pa_sig[buf_no] != NULL)
+      {
+         ECDSA_SIG_get0(pa_sig[buf_no], (const BIGNUM(**))pa_sign_r + buf_no,
+                                        (const BIGNUM(**))pa_sign_s + buf_no);
+      }
+   }
+
+   __ALIGN64 U64 msg[P256_LEN52];
+   __ALIGN64 U64 sign_r[P256_LEN52];
+   __ALIGN64 U64 sign_s[P256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])msg, pa_msg, P256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])sign_r, (const BIGNUM(**))pa_sign_r, P256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])sign_s, (const BIGNUM(**))pa_sign_s, P256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(msg), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __mb_mask signature_err_mask = nistp256_ecdsa_verify_mb8(sign_r,sign_s,msg, NULL, pa_tbl);
    status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
 
    return status;
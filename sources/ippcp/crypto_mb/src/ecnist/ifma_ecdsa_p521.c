@@ -59,15 +59,17 @@ static void nistp521_ecdsa_inv_keys_mb8(U64 inv_skey[],
 //
 // note: pay attention on skey[] presenttaion
 //       it should be transposed and zero expanded 
+//       tbl is the window 7 comb table of G (or NULL for the built-in table)
 */
 static __mb_mask nistp521_ecdsa_sign_r_mb8(U64 sign_r[],
                                      const U64 skey[],
+                   const SINGLE_P521_POINT_AFFINE* tbl,
                                          int8u pBuffer[])
 {
    /* compute ephemeral public keys */
    P521_POINT P;
 
-   MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_)(&P, skey);
+   MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_comb_)(&P, tbl, skey);
 
    /* extract affine P.x */
    MB_FUNC_NAME(ifma_aminv52_p521_)(P.Z, P.Z); /* 1/Z   */
@@ -154,8 +156,8 @@ static __mb_mask nistp521_ecdsa_verify_mb8(U64 sign_r[],
    P521_POINT P;
 
    // P = h1*G + h2*W
-   MB_FUNC_NAME(ifma_ec_nistp521_mul_point_)(W, W, h2);
-   MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_)(&P, h1);
+   MB_FUNC_NAME(ifma_ec_nistp521_mul_point_vartime_)(W, W, h2);
+   MB_FUNC_NAME(ifma_ec_nistp521_mul_pointbase_vartime_)(&P, h1);
    MB_FUNC_NAME(ifma_ec_nistp521_add_point_)(&P, &P, W);
 
    // P != 0
@@ -190,11 +192,11 @@ static __mb_mask nistp521_ecdsa_verify_mb8(U64 sign_r[],
 // - r-component of the signature
 // and are later used during the signing process
 */
-DLL_PUBLIC
-mbx_status mbx_nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
-                                             int64u* pa_sign_rp[8],
-                                       const int64u* const pa_eph_skey[8],
-                                              int8u* pBuffer)
+static mbx_status nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
+                                               int64u* pa_sign_rp[8],
+                                         const int64u* const pa_eph_skey[8],
+                                          const int8u* pTable,
+                                                int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
@@ -242,7 +244,7 @@ mbx_status mbx_nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
    ifma_BNU_transpose_copy((int64u (*)[8])scalarz, pa_eph_skey, P521_BITSIZE);
    scalarz[P521_LEN64] = get_zero64();
    /* compute r-component of the DSA signature */
-   int8u stt_mask = nistp521_ecdsa_sign_r_mb8(T, scalarz, pBuffer);
+   int8u stt_mask = nistp521_ecdsa_sign_r_mb8(T, scalarz, (const SINGLE_P521_POINT_AFFINE*)pTable, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
@@ -254,6 +256,29 @@ mbx_status mbx_nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
    return status;
 }
 
+DLL_PUBLIC
+mbx_status mbx_nistp521_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
+                                             int64u* pa_sign_rp[8],
+                                       const int64u* const pa_eph_skey[8],
+                                              int8u* pBuffer)
+{
+   return nistp521_ecdsa_sign_setup_mb8(pa_inv_eph_skey, pa_sign_rp, pa_eph_skey, NULL, pBuffer);
+}
+
+/*
+// the same as above, but [k]*G is computed with the window 7 comb table
+// pTable            pointer to the table computed by mbx_nistp521_base_precomp()
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp521_ecdsa_sign_setup_tbl_mb8(int64u* pa_inv_eph_skey[8],
+                                                 int64u* pa_sign_rp[8],
+                                           const int64u* const pa_eph_skey[8],
+                                            const int8u* pTable,
+                                                  int8u* pBuffer)
+{
+   return nistp521_ecdsa_sign_setup_mb8(pa_inv_eph_skey, pa_sign_rp, pa_eph_skey, pTable, pBuffer);
+}
+
 /*
 // computes ECDSA signature
 //
@@ -421,7 +446,7 @@ mbx_status mbx_nistp521_ecdsa_sign_mb8(int8u* pa_sign_r[8],
    /* compute inversion */ 
    nistp521_ecdsa_inv_keys_mb8(inv_eph_key, inv_eph_key, pBuffer);
    /* compute r-component */
-   nistp521_ecdsa_sign_r_mb8(sign_r, scalar, pBuffer);
+   nistp521_ecdsa_sign_r_mb8(sign_r, scalar, NULL, pBuffer);
    /* compute s-component */
    nistp521_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph_key, reg_key, pBuffer);
 
@@ -567,11 +592,11 @@ static void ifma_mb8_to_BN_521(BIGNUM* out_bn[8], const int64u inp_mb8[][8])
       out_bn[nb] = BN_bnu2bn(tmp[nb], P521_LEN64, out_bn[nb]);
 }
 
-DLL_PUBLIC
-mbx_status mbx_nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
-                                                 BIGNUM* pa_sign_rp[8],
-                                           const BIGNUM* const pa_eph_skey[8],
-                                                  int8u* pBuffer)
+static mbx_status nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
+                                                   BIGNUM* pa_sign_rp[8],
+                                             const BIGNUM* const pa_eph_skey[8],
+                                              const int8u* pTable,
+                                                    int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
@@ -619,7 +644,7 @@ mbx_status mbx_nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
    ifma_BN_transpose_copy((int64u (*)[8])scalarz, pa_eph_skey, P521_BITSIZE);
    scalarz[P521_LEN64] = get_zero64();
    /* compute r-component of the DSA signature */
-   int8u stt_mask = nistp521_ecdsa_sign_r_mb8(T, scalarz, pBuffer);
+   int8u stt_mask = nistp521_ecdsa_sign_r_mb8(T, scalarz, (const SINGLE_P521_POINT_AFFINE*)pTable, pBuffer);
 
    /* clear copy of the ephemeral secret keys */
    MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
@@ -631,6 +656,25 @@ mbx_status mbx_nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
    return status;
 }
 
+DLL_PUBLIC
+mbx_status mbx_nistp521_ecdsa_sign_setup_ssl_mb8(BIGNUM* pa_inv_skey[8],
+                                                 BIGNUM* pa_sign_rp[8],
+                                           const BIGNUM* const pa_eph_skey[8],
+                                                  int8u* pBuffer)
+{
+   return nistp521_ecdsa_sign_setup_ssl_mb8(pa_inv_skey, pa_sign_rp, pa_eph_skey, NULL, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_nistp521_ecdsa_sign_setup_tbl_ssl_mb8(BIGNUM* pa_inv_skey[8],
+                                                     BIGNUM* pa_sign_rp[8],
+                                               const BIGNUM* const pa_eph_skey[8],
+                                                const int8u* pTable,
+                                                      int8u* pBuffer)
+{
+   return nistp521_ecdsa_sign_setup_ssl_mb8(pa_inv_skey, pa_sign_rp, pa_eph_skey, pTable, pBuffer);
+}
+
 DLL_PUBLIC
 mbx_status mbx_nistp521_ecdsa_sign_complete_ssl_mb8(int8u* pa_sign_r[8],
                                                     int8u* pa_sign_s[8],
@@ -775,7 +819,7 @@ mbx_status mbx_nistp521_ecdsa_sign_ssl_mb8(int8u* pa_sign_r[8],
    /* compute inversion */ 
    nistp521_ecdsa_inv_keys_mb8(inv_eph_key, inv_eph_key, pBuffer);
    /* compute r-component */
-   nistp521_ecdsa_sign_r_mb8(sign_r, scalar, pBuffer);
+   nistp521_ecdsa_sign_r_mb8(sign_r, scalar, NULL, pBuffer);
    /* compute s-component */
    nistp521_ecdsa_sign_s_mb8(sign_s, msg, sign_r, inv_eph_key, reg_key, pBuffer);
 
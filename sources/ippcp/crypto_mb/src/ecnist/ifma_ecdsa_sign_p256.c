@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/ecnist/ifma_ecdsa_p256.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+/*
+// compute secret key inversion
+//
+// inv_skey 1/skey mod n256
+//
+// note: pay attention on skey[] presenttaion
+//       it should be FE element of N256 basef GF
+*/
+void MB_FUNC_NAME(nistp256_ecdsa_inv_keys_)(U64 inv_skey[],
+                                      const U64 skey[],
+                                          int8u pBuffer[])
+{
+   /* compute inversion ober n256 of secret keys */
+   MB_FUNC_NAME(ifma_tomont52_n256_)(inv_skey, skey);
+   MB_FUNC_NAME(ifma_aminv52_n256_)(inv_skey, inv_skey);   /* 1/skeys mod n256 */
+   MB_FUNC_NAME(ifma_frommont52_n256_)(inv_skey, inv_skey);
+}
+
+/*
+// compute r-component of the ECDSA signature
+//
+// r = ([skey]*G).x mod n256
+//
+// note: pay attention on skey[] presenttaion
+//       it should be transposed and zero expanded 
+*/
+__mb_mask MB_FUNC_NAME(nistp256_ecdsa_sign_r_)(U64 sign_r[],
+                                         const U64 skey[],
+                                             int8u pBuffer[])
+{
+   /* compute ephemeral public keys */
+   P256_POINT P;
+
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, skey);
+
+   /* extract affine P.x */
+   MB_FUNC_NAME(ifma_aminv52_p256_)(P.Z, P.Z); /* 1/Z   */
+   MB_FUNC_NAME(ifma_ams52_p256_)(P.Z, P.Z);   /* 1/Z^2 */
+   MB_FUNC_NAME(ifma_amm52_p256_)(P.X, P.X, P.Z);  /* x = (X) * (1/Z^2) */
+
+   /* convert x-coordinate to regular and then tp Montgomery n256 */
+   MB_FUNC_NAME(ifma_frommont52_p256_)(P.X, P.X);
+   MB_FUNC_NAME(ifma_fastred52_pn256_)(sign_r, P.X);  /* fast reduction p => n */
+
+   return MB_FUNC_NAME(is_zero_FE256_)(sign_r);
+}
+
+/*
+// compute s-component of the ECDSA signature
+//
+// s = (inv_eph) * (msg + prv_skey*sign_r) mod n256
+*/
+__mb_mask MB_FUNC_NAME(nistp256_ecdsa_sign_s_)(U64 sign_s[],
+                                               U64 msg[],
+                                         const U64 sign_r[],
+                                               U64 inv_eph_skey[],
+                                               U64 reg_skey[],
+                                             int8u pBuffer[])
+{
+   __ALIGN64 U64 tmp[P256_LEN52];
+
+   /* conver to Montgomery over n256 domain */
+   MB_FUNC_NAME(ifma_tomont52_n256_)(inv_eph_skey, inv_eph_skey);
+   MB_FUNC_NAME(ifma_tomont52_n256_)(tmp, sign_r);
+   MB_FUNC_NAME(ifma_tomont52_n256_)(msg, msg);
+   MB_FUNC_NAME(ifma_tomont52_n256_)(reg_skey, reg_skey);
+
+   /* s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
+   MB_FUNC_NAME(ifma_amm52_n256_)(sign_s, reg_skey, tmp);
+   MB_FUNC_NAME(ifma_add52_n256_)(sign_s, sign_s, msg);
+   MB_FUNC_NAME(ifma_amm52_n256_)(sign_s, sign_s, inv_eph_skey);
+   MB_FUNC_NAME(ifma_frommont52_n256_)(sign_s, sign_s);
+
+   return MB_FUNC_NAME(is_zero_FE256_)(sign_s);
+}
+
+/*
+// computes ECDSA signature
+//
+// sign_r[]    r-components of the signatures
+// sign_s[]    s-components of the signatures
+// eph_skey[]  ephemeral (nonce) private keys as FE, replaced by their inversion
+// scalar[]    ephemeral (nonce) private keys as transposed and zero expanded scalars
+// reg_skey[]  regular private keys as FE
+// msg[]       messages being signed as FE
+*/
+void MB_FUNC_NAME(nistp256_ecdsa_sign_)(int64u sign_r[][MB_WIDTH],
+                                        int64u sign_s[][MB_WIDTH],
+                                        int64u eph_skey[][MB_WIDTH],
+                                  const int64u scalar[][MB_WIDTH],
+                                        int64u reg_skey[][MB_WIDTH],
+                                        int64u msg[][MB_WIDTH],
+                                         int8u pBuffer[])
+{
+   /* compute inversion */
+   MB_FUNC_NAME(nistp256_ecdsa_inv_keys_)((U64*)eph_skey, (U64*)eph_skey, pBuffer);
+   /* compute r-component */
+   MB_FUNC_NAME(nistp256_ecdsa_sign_r_)((U64*)sign_r, (U64*)scalar, pBuffer);
+   /* compute s-component */
+   MB_FUNC_NAME(nistp256_ecdsa_sign_s_)((U64*)sign_s, (U64*)msg, (U64*)sign_r, (U64*)eph_skey, (U64*)reg_skey, pBuffer);
+}
@@ -194,11 +194,11 @@ void MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(P256_POINT* r, const P256_POINT*
 // r = 2^(P256_LEN52*DIGIT_SIZE) mod p256
 */
 __ALIGN64 static const int64u p256_r_mb[P256_LEN52][sizeof(U64)/sizeof(int64u)] = {
-   { REP8_DECL(0x0000000000000010) },
-   { REP8_DECL(0x000f000000000000) },
-   { REP8_DECL(0x000fffffffffffff) },
-   { REP8_DECL(0x000ffeffffffffff) },
-   { REP8_DECL(0x00000000000fffff) }
+   { REP_NUM_BUFF_DECL(0x0000000000000010) },
+   { REP_NUM_BUFF_DECL(0x000f000000000000) },
+   { REP_NUM_BUFF_DECL(0x000fffffffffffff) },
+   { REP_NUM_BUFF_DECL(0x000ffeffffffffff) },
+   { REP_NUM_BUFF_DECL(0x00000000000fffff) }
 };
 const U64* MB_FUNC_NAME(ifma_ec_nistp256_coord_one_)(void)
 {
@@ -434,12 +434,12 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(P256_POINT* r, const P256_POINT*
       wvalue = loadu64(&scalar[chunk_no]);
       #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
       {
-      __m512i t_lo_ = _mm512_srlv_epi64(wvalue, set64(chunk_shift));
-      __m512i t_hi_ = _mm512_sllv_epi64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+      U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+      U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
       wvalue = or64(t_lo_, t_hi_);
       }
       #else
-      wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+      wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
       #endif
       wvalue = and64(wvalue, idx_mask);
 
@@ -479,7 +479,7 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(P256_POINT* r, const P256_POINT*
    MB_FUNC_NAME(mov_FE256_)(r->Z, R.Z);
 
    /* clear r (to fix potential secutity flaw in case of ecdh */
-   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[MB_WIDTH])&R, sizeof(R)/sizeof(U64));
 
    /* clear stubs of secret scalar */
    clear_secret_context(&wvalue, &dvalue, &dsign);
@@ -492,6 +492,12 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(P256_POINT* r, const P256_POINT*
 
 #include <internal/ecnist/ifma_ecprecomp4_p256.h>
 
+#if (SIMD_LEN == 512)
+/* the table is shared with the AVX2 kernels (avx2_p256.h) */
+#include <internal/ecnist/avx2_p256.h>
+const int64u* const ifma_ec_nistp256_bp_precomp4 = &ifma_ec_nistp256_bp_precomp[0][0].x[0];
+#endif
+
 #define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE  /* defined in the header above */
 
 __INLINE void MB_FUNC_NAME(booth_recode_bp_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
@@ -598,12 +604,12 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(P256_POINT* r, const U64 scal
       wvalue = loadu64(&scalar[chunk_no]);
       #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
       {
-      __m512i t_lo_ = _mm512_srlv_epi64(wvalue, set64(chunk_shift));
-      __m512i t_hi_ = _mm512_sllv_epi64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+      U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+      U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
       wvalue = or64(t_lo_, t_hi_);
       }
       #else
-      wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+      wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
       #endif
       wvalue = and64(wvalue, idx_mask);
 
@@ -629,21 +635,159 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(P256_POINT* r, const U64 scal
 }
 #undef BP_WIN_SIZE
 
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Variable-time point multiplications.
+//
+// Intended for public scalars only (ECDSA signature verification):
+//    - pre-computed points are fetched by gather rather than by scanning the whole table
+//    - accumulation is skipped if digits of all lanes are zero
+*/
+
+#define VT_WIN_SIZE  (5)
+
+__INLINE void MB_FUNC_NAME(booth_recode_vt_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, VT_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(VT_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* gather point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_)(P256_POINT* r, const P256_POINT tbl[], U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset of the lane */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(P256_POINT)/sizeof(int64u)));
+   offset = add64(offset, lane_idx64());
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<P256_LEN52; n++) {
+      r->X[n] = mask_gather64(zero, k, offset, tbl[0].X+n);
+      r->Y[n] = mask_gather64(zero, k, offset, tbl[0].Y+n);
+      r->Z[n] = mask_gather64(zero, k, offset, tbl[0].Z+n);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_vartime_)(P256_POINT* r, const P256_POINT* p, const U64 scalar[])
+{
+   /* pre-computed table */
+   __ALIGN64 P256_POINT tbl[1<<(VT_WIN_SIZE-1)];
+
+   /* tbl[n] = [n+1]*p */
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].X, p->X);
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].Y, p->Y);
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].Z, p->Z);
+   MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&tbl[1], p);
+
+   int n;
+   for(n=1; n < (1<<(VT_WIN_SIZE-1))/2; n++) {
+      MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&tbl[2*n], &tbl[2*n-1], p);
+      MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&tbl[2*n+1], &tbl[n]);
+   }
+
+   P256_POINT R;
+   P256_POINT T;
+   U64 Ty[P256_LEN52];
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   /*
+   // point (LR) multiplication
+   */
+   U64 idx_mask = set1( (1<<(VT_WIN_SIZE+1))-1 );
+   int bit = P256_BITSIZE-(P256_BITSIZE % VT_WIN_SIZE);
+   int chunk_no = (bit-1)/64;
+   int chunk_shift = (bit-1)%64;
+
+   /* first window */
+   wvalue = loadu64(&scalar[chunk_no]);
+   wvalue = and64( srli64(wvalue, chunk_shift), idx_mask);
+
+   MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+   dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+   MB_FUNC_NAME(gather_point_)(&R, tbl, dvalue, dmask);
+
+   MB_FUNC_NAME(ifma_neg52_p256_)(Ty, R.Y);
+   MB_FUNC_NAME(secure_mask_mov_FE256_)(R.Y, R.Y, dsign, Ty);
+
+   for(bit-=VT_WIN_SIZE; bit>=0; bit-=VT_WIN_SIZE) {
+      /* doubling */
+      for(n=0; n<VT_WIN_SIZE; n++)
+         MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&R, &R);
+
+      /* window */
+      if(bit) {
+         chunk_no = (bit-1)/64;
+         chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      MB_FUNC_NAME(gather_point_)(&T, tbl, dvalue, dmask);
+
+      /* T = dsign? -T : T */
+      MB_FUNC_NAME(ifma_neg52_p256_)(Ty, T.Y);
+      MB_FUNC_NAME(secure_mask_mov_FE256_)(T.Y, T.Y, dsign, Ty);
+
+      /* acumulate T */
+      MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&R, &R, &T);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE256_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE256_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE256_)(r->Z, R.Z);
+}
+#undef VT_WIN_SIZE
+
 
 /* P256 parameters: mont(a), mont(b) */
-__ALIGN64 static const int64u mont_a_p256_mb[P256_LEN52][8] = {
-   { REP8_DECL(0x000fffffffffffcf) },
-   { REP8_DECL(0x00030fffffffffff) },
-   { REP8_DECL(0x000000000000000) },
-   { REP8_DECL(0x0000031000000000) },
-   { REP8_DECL(0x0000ffffffcf0000) }
+__ALIGN64 static const int64u mont_a_p256_mb[P256_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x000fffffffffffcf) },
+   { REP_NUM_BUFF_DECL(0x00030fffffffffff) },
+   { REP_NUM_BUFF_DECL(0x000000000000000) },
+   { REP_NUM_BUFF_DECL(0x0000031000000000) },
+   { REP_NUM_BUFF_DECL(0x0000ffffffcf0000) }
 };
-__ALIGN64 static const int64u mont_b_p256_mb[P256_LEN52][8] = {
-   { REP8_DECL(0x000df6229c4bddfd) },
-   { REP8_DECL(0x000ca8843090d89c) },
-   { REP8_DECL(0x000212ed6acf005c) },
-   { REP8_DECL(0x00083415a220abf7) },
-   { REP8_DECL(0x0000c30061dd4874) }
+__ALIGN64 static const int64u mont_b_p256_mb[P256_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP_NUM_BUFF_DECL(0x000df6229c4bddfd) },
+   { REP_NUM_BUFF_DECL(0x000ca8843090d89c) },
+   { REP_NUM_BUFF_DECL(0x000212ed6acf005c) },
+   { REP_NUM_BUFF_DECL(0x00083415a220abf7) },
+   { REP_NUM_BUFF_DECL(0x0000c30061dd4874) }
 };
 
 /*
@@ -694,3 +838,31 @@ __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p256_)(const P256_POINT* p, int use_jpro
 
    return is_on_curve_mask;
 }
+
+/*
+// Computes y-coordinate of the EC point by its x-coordinate:
+//      y = sqrt(x^3 + a*x + b)
+// Returns mask of lanes the square root exists for.
+//
+// note: x and y are in Montgomery domain, y is any of two roots
+*/
+__mb_mask MB_FUNC_NAME(ifma_decompress_y_p256_)(U64 y[], const U64 x[])
+{
+   U64 rh[P256_LEN52], tmp[P256_LEN52];
+
+   /* rh = x^3 + a*x + b = x*(x^2 +a) + b */
+   MB_FUNC_NAME(ifma_ams52_p256_)(rh, x);
+   MB_FUNC_NAME(ifma_add52_p256_)(rh, rh, (U64*)mont_a_p256_mb);
+   MB_FUNC_NAME(ifma_amm52_p256_)(rh, rh, x);
+   MB_FUNC_NAME(ifma_add52_p256_)(rh, rh, (U64*)mont_b_p256_mb);
+
+   /* y = rh^((p+1)/4) */
+   MB_FUNC_NAME(ifma_amsqrt52_p256_)(y, rh);
+
+   /* mask = y^2==rh */
+   MB_FUNC_NAME(ifma_ams52_p256_)(tmp, y);
+   MB_FUNC_NAME(ifma_frommont52_p256_)(tmp, tmp);
+   MB_FUNC_NAME(ifma_frommont52_p256_)(rh, rh);
+
+   return MB_FUNC_NAME(cmp_eq_FE256_)(tmp, rh);
+}
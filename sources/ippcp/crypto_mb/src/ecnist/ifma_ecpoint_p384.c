@@ -640,6 +640,451 @@ void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_)(P384_POINT* r, const U64 scal
    /* clear stubs of secret scalar */
    clear_secret_context(&wvalue, &dvalue, &dsign);
 }
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Base point multiplication with the window 7 comb table computed at run time
+// by ifma_ec_nistp384_precomp_comb_base_().
+//
+// The scalar is processed in P384_COMB_N_SLOTS windows, i.e. 55 affine additions
+// instead of 97 with the built-in window 4 table. Each window still scans all
+// entries of its slot to keep the access pattern independent of the secret digits.
+//
+// The slots are read in sequence. The slot of the next window is prefetched into L1
+// entry by entry while the current one is scanned, so the scan never waits for L2
+// (the whole table is about 440 KB and stays L2 resident between the calls).
+*/
+
+__INLINE void MB_FUNC_NAME(booth_recode_comb_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, P384_COMB_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(P384_COMB_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* extract affine point from the slot tbl[] and prefetch the same entries of the slot pf[] */
+__INLINE void MB_FUNC_NAME(extract_point_comb_)(P384_POINT_AFFINE* r, const SINGLE_P384_POINT_AFFINE* tbl, U64 idx,
+                                                const SINGLE_P384_POINT_AFFINE* pf)
+{
+   /* decrement index (the table does not contain [0]*P) */
+   U64 targIdx = sub64(idx, set1(1));
+
+   U64 ax[P384_LEN52];
+   U64 ay[P384_LEN52];
+
+   /* assume the point at infinity is what need */
+   int i;
+   for(i=0; i<P384_LEN52; i++)
+      ax[i] = ay[i] = get_zero64();
+
+   /* find out what we actually need or just keep original infinity */
+   int n;
+   U64 currIdx = get_zero64();
+   for(n=0; n<P384_COMB_N_ENTRY; n++, tbl++, pf++, currIdx = add64(currIdx, set1(1))) {
+      unsigned int offset;
+      for(offset=0; offset<sizeof(SINGLE_P384_POINT_AFFINE); offset+=64)
+         _mm_prefetch((const char*)pf + offset, _MM_HINT_T0);
+
+      __mb_mask k = cmp64_mask(currIdx, targIdx, _MM_CMPINT_EQ);
+
+      /* R = k? set1( tbl[] ) : R */
+      for(i=0; i<P384_LEN52; i++) {
+         ax[i] = mask_mov64(ax[i], k, set1( tbl->x[i] ));
+         ay[i] = mask_mov64(ay[i], k, set1( tbl->y[i] ));
+      }
+   }
+
+   for(i=0; i<P384_LEN52; i++) {
+      r->x[i] = ax[i];
+      r->y[i] = ay[i];
+   }
+}
+
+static void MB_FUNC_NAME(mul_pointbase_comb_)(P384_POINT* r, const SINGLE_P384_POINT_AFFINE* tbl, const U64 scalar[])
+{
+   P384_POINT R;
+   P384_POINT_AFFINE A;
+   U64 Ty[P384_LEN52];
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign;
+
+   U64 idx_mask = set1( (1<<(P384_COMB_WIN_SIZE+1))-1 );
+
+   int bit, slot;
+   for(bit=0, slot=0; bit<=P384_BITSIZE; bit+=P384_COMB_WIN_SIZE, slot++, tbl+=P384_COMB_N_ENTRY) {
+      if(bit) {
+         int chunk_no = (bit-1)/64;
+         int chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         __m512i t_lo_ = _mm512_srlv_epi64(wvalue, set64(chunk_shift));
+         __m512i t_hi_ = _mm512_sllv_epi64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_comb_)(&dsign, &dvalue, wvalue);
+      /* the last slot prefetches itself */
+      MB_FUNC_NAME(extract_point_comb_)(&A, tbl, dvalue, (slot+1<P384_COMB_N_SLOTS)? tbl+P384_COMB_N_ENTRY : tbl);
+
+      /* A = dsign? -A : A */
+      MB_FUNC_NAME(ifma_neg52_p384_)(Ty, A.y);
+      MB_FUNC_NAME(secure_mask_mov_FE384_)(A.y, A.y, dsign, Ty);
+
+      /* R += A */
+      MB_FUNC_NAME(ifma_ec_nistp384_add_point_affine_)(&R, &R, &A);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE384_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE384_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE384_)(r->Z, R.Z);
+
+   /* clear stubs of secret scalar */
+   clear_secret_context(&wvalue, &dvalue, &dsign);
+}
+
+/* tbl==NULL selects the built-in window 4 table */
+void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_comb_)(P384_POINT* r, const SINGLE_P384_POINT_AFFINE* tbl, const U64 scalar[])
+{
+   if(NULL==tbl)
+      MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_)(r, scalar);
+   else
+      MB_FUNC_NAME(mul_pointbase_comb_)(r, tbl, scalar);
+}
+
+/* number of points converted into affine at once */
+#define AFFINE_BATCH  (16)
+
+/* r[i] = affine(p[i]), i=0,..,AFFINE_BATCH-1 (single inversion by Montgomery's trick) */
+static void MB_FUNC_NAME(batch_affine_)(P384_POINT_AFFINE r[], const P384_POINT p[])
+{
+   __ALIGN64 U64 acc[AFFINE_BATCH][P384_LEN52];
+   __ALIGN64 U64 inv[P384_LEN52];
+   __ALIGN64 U64 invZ1[P384_LEN52];
+   __ALIGN64 U64 invZn[P384_LEN52];
+
+   /* acc[i] = Z[0]*..*Z[i] */
+   MB_FUNC_NAME(mov_FE384_)(acc[0], p[0].Z);
+   int i;
+   for(i=1; i<AFFINE_BATCH; i++)
+      MB_FUNC_NAME(ifma_amm52_p384_)(acc[i], acc[i-1], p[i].Z);
+
+   MB_FUNC_NAME(ifma_aminv52_p384_)(inv, acc[AFFINE_BATCH-1]);
+
+   for(i=AFFINE_BATCH-1; i>=0; i--) {
+      /* 1/Z[i] */
+      if(i) {
+         MB_FUNC_NAME(ifma_amm52_p384_)(invZ1, inv, acc[i-1]);
+         MB_FUNC_NAME(ifma_amm52_p384_)(inv, inv, p[i].Z);
+      }
+      else
+         MB_FUNC_NAME(mov_FE384_)(invZ1, inv);
+
+      /* x = X/Z^2, y = Y/Z^3 */
+      MB_FUNC_NAME(ifma_ams52_p384_)(invZn, invZ1);
+      MB_FUNC_NAME(ifma_amm52_p384_)(r[i].x, p[i].X, invZn);
+      MB_FUNC_NAME(ifma_amm52_p384_)(invZn, invZn, invZ1);
+      MB_FUNC_NAME(ifma_amm52_p384_)(r[i].y, p[i].Y, invZn);
+   }
+}
+
+/*
+// tbl[j][d-1] = [d*2^(7*j)]*G in affine coordinates (Montgomery domain)
+// the lanes compute 8 slots at once
+*/
+void MB_FUNC_NAME(ifma_ec_nistp384_precomp_comb_base_)(SINGLE_P384_POINT_AFFINE* tbl)
+{
+   __ALIGN64 P384_POINT T[AFFINE_BATCH];
+   __ALIGN64 P384_POINT_AFFINE A[AFFINE_BATCH];
+   __ALIGN64 int64u scalar[P384_LEN64+1][8];
+
+   P384_POINT B;
+
+   int slot, n, i;
+   for(slot=0; slot<P384_COMB_N_SLOTS; slot+=MB_WIDTH) {
+      /* B = [2^(7*(slot+lane))]*G */
+      int lane, k;
+      for(k=0; k<P384_LEN64+1; k++)
+         for(lane=0; lane<MB_WIDTH; lane++)
+            scalar[k][lane] = 0;
+      for(lane=0; lane<MB_WIDTH && (slot+lane)<P384_COMB_N_SLOTS; lane++) {
+         int bit = (slot+lane)*P384_COMB_WIN_SIZE;
+         scalar[bit/64][lane] = (int64u)1 << (bit%64);
+      }
+      MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_)(&B, (U64*)scalar);
+
+      for(n=0; n<P384_COMB_N_ENTRY; n+=AFFINE_BATCH) {
+         /* T[i] = [n+i+1]*B */
+         for(i=0; i<AFFINE_BATCH; i++) {
+            if(0==(n+i)) {
+               MB_FUNC_NAME(mov_FE384_)(T[0].X, B.X);
+               MB_FUNC_NAME(mov_FE384_)(T[0].Y, B.Y);
+               MB_FUNC_NAME(mov_FE384_)(T[0].Z, B.Z);
+            }
+            else if(1==(n+i))
+               MB_FUNC_NAME(ifma_ec_nistp384_dbl_point_)(&T[1], &B);
+            else
+               MB_FUNC_NAME(ifma_ec_nistp384_add_point_)(&T[i], &T[(i+AFFINE_BATCH-1)%AFFINE_BATCH], &B);
+         }
+
+         MB_FUNC_NAME(batch_affine_)(A, T);
+
+         /* scatter the lanes to their slots */
+         for(lane=0; lane<MB_WIDTH && (slot+lane)<P384_COMB_N_SLOTS; lane++) {
+            SINGLE_P384_POINT_AFFINE* pEntry = tbl + (slot+lane)*P384_COMB_N_ENTRY + n;
+            for(i=0; i<AFFINE_BATCH; i++) {
+               for(k=0; k<P384_LEN52; k++) {
+                  pEntry[i].x[k] = ((int64u*)&A[i].x[k])[lane];
+                  pEntry[i].y[k] = ((int64u*)&A[i].y[k])[lane];
+               }
+            }
+         }
+      }
+   }
+}
+#undef AFFINE_BATCH
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Variable-time point multiplications.
+//
+// Intended for public scalars only (ECDSA signature verification):
+//    - pre-computed points are fetched by gather rather than by scanning the whole table
+//    - accumulation is skipped if digits of all lanes are zero
+*/
+
+#define VT_WIN_SIZE  (5)
+
+__INLINE void MB_FUNC_NAME(booth_recode_vt_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, VT_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(VT_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* gather point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_)(P384_POINT* r, const P384_POINT tbl[], U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset of the lane */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(P384_POINT)/sizeof(int64u)));
+   offset = add64(offset, lane_idx64());
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<P384_LEN52; n++) {
+      r->X[n] = mask_gather64(zero, k, offset, tbl[0].X+n);
+      r->Y[n] = mask_gather64(zero, k, offset, tbl[0].Y+n);
+      r->Z[n] = mask_gather64(zero, k, offset, tbl[0].Z+n);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp384_mul_point_vartime_)(P384_POINT* r, const P384_POINT* p, const U64 scalar[])
+{
+   /* pre-computed table */
+   __ALIGN64 P384_POINT tbl[1<<(VT_WIN_SIZE-1)];
+
+   /* tbl[n] = [n+1]*p */
+   MB_FUNC_NAME(mov_FE384_)(tbl[0].X, p->X);
+   MB_FUNC_NAME(mov_FE384_)(tbl[0].Y, p->Y);
+   MB_FUNC_NAME(mov_FE384_)(tbl[0].Z, p->Z);
+   MB_FUNC_NAME(ifma_ec_nistp384_dbl_point_)(&tbl[1], p);
+
+   int n;
+   for(n=1; n < (1<<(VT_WIN_SIZE-1))/2; n++) {
+      MB_FUNC_NAME(ifma_ec_nistp384_add_point_)(&tbl[2*n], &tbl[2*n-1], p);
+      MB_FUNC_NAME(ifma_ec_nistp384_dbl_point_)(&tbl[2*n+1], &tbl[n]);
+   }
+
+   P384_POINT R;
+   P384_POINT T;
+   U64 Ty[P384_LEN52];
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   /*
+   // point (LR) multiplication
+   */
+   U64 idx_mask = set1( (1<<(VT_WIN_SIZE+1))-1 );
+   int bit = P384_BITSIZE-(P384_BITSIZE % VT_WIN_SIZE);
+   int chunk_no = (bit-1)/64;
+   int chunk_shift = (bit-1)%64;
+
+   /* first window */
+   wvalue = loadu64(&scalar[chunk_no]);
+   wvalue = and64( srli64(wvalue, chunk_shift), idx_mask);
+
+   MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+   dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+   MB_FUNC_NAME(gather_point_)(&R, tbl, dvalue, dmask);
+
+   MB_FUNC_NAME(ifma_neg52_p384_)(Ty, R.Y);
+   MB_FUNC_NAME(secure_mask_mov_FE384_)(R.Y, R.Y, dsign, Ty);
+
+   for(bit-=VT_WIN_SIZE; bit>=0; bit-=VT_WIN_SIZE) {
+      /* doubling */
+      for(n=0; n<VT_WIN_SIZE; n++)
+         MB_FUNC_NAME(ifma_ec_nistp384_dbl_point_)(&R, &R);
+
+      /* window */
+      if(bit) {
+         chunk_no = (bit-1)/64;
+         chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      MB_FUNC_NAME(gather_point_)(&T, tbl, dvalue, dmask);
+
+      /* T = dsign? -T : T */
+      MB_FUNC_NAME(ifma_neg52_p384_)(Ty, T.Y);
+      MB_FUNC_NAME(secure_mask_mov_FE384_)(T.Y, T.Y, dsign, Ty);
+
+      /* acumulate T */
+      MB_FUNC_NAME(ifma_ec_nistp384_add_point_)(&R, &R, &T);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE384_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE384_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE384_)(r->Z, R.Z);
+}
+#undef VT_WIN_SIZE
+
+/* gather affine point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_affine_)(P384_POINT_AFFINE* r, const SINGLE_P384_POINT_AFFINE* tbl, U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(SINGLE_P384_POINT_AFFINE)/sizeof(int64u)));
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<P384_LEN52; n++) {
+      r->x[n] = mask_gather64(zero, k, offset, tbl->x+n);
+      r->y[n] = mask_gather64(zero, k, offset, tbl->y+n);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp384_mul_pointbase_vartime_)(P384_POINT* r, const U64 scalar[])
+{
+   /* pre-computed table of base powers */
+   SINGLE_P384_POINT_AFFINE* tbl = &ifma_ec_nistp384_bp_precomp[0][0];
+
+   P384_POINT R;
+   P384_POINT_AFFINE A;
+   U64 Ty[P384_LEN52];
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   /*
+   // base point (RL) multiplication
+   */
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   U64 idx_mask = set1( (1<<(BP_WIN_SIZE+1))-1 );
+   int bit;
+   for(bit=0; bit<=P384_BITSIZE; bit+=BP_WIN_SIZE, tbl+=BP_N_ENTRY) {
+      if(bit) {
+         int chunk_no = (bit-1)/64;
+         int chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_bp_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      MB_FUNC_NAME(gather_point_affine_)(&A, tbl, dvalue, dmask);
+
+      /* A = dsign? -A : A */
+      MB_FUNC_NAME(ifma_neg52_p384_)(Ty, A.y);
+      MB_FUNC_NAME(secure_mask_mov_FE384_)(A.y, A.y, dsign, Ty);
+
+      /* R += A */
+      MB_FUNC_NAME(ifma_ec_nistp384_add_point_affine_)(&R, &R, &A);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE384_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE384_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE384_)(r->Z, R.Z);
+}
 #undef BP_WIN_SIZE
 
 
@@ -713,3 +1158,31 @@ __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p384_)(const P384_POINT* p, int use_jpro
 
    return is_on_curve_mask;
 }
+
+/*
+// Computes y-coordinate of the EC point by its x-coordinate:
+//      y = sqrt(x^3 + a*x + b)
+// Returns mask of lanes the square root exists for.
+//
+// note: x and y are in Montgomery domain, y is any of two roots
+*/
+__mb_mask MB_FUNC_NAME(ifma_decompress_y_p384_)(U64 y[], const U64 x[])
+{
+   U64 rh[P384_LEN52], tmp[P384_LEN52];
+
+   /* rh = x^3 + a*x + b = x*(x^2 +a) + b */
+   MB_FUNC_NAME(ifma_ams52_p384_)(rh, x);
+   MB_FUNC_NAME(ifma_add52_p384_)(rh, rh, (U64*)mont_a_p384_mb);
+   MB_FUNC_NAME(ifma_amm52_p384_)(rh, rh, x);
+   MB_FUNC_NAME(ifma_add52_p384_)(rh, rh, (U64*)mont_b_p384_mb);
+
+   /* y = rh^((p+1)/4) */
+   MB_FUNC_NAME(ifma_amsqrt52_p384_)(y, rh);
+
+   /* mask = y^2==rh */
+   MB_FUNC_NAME(ifma_ams52_p384_)(tmp, y);
+   MB_FUNC_NAME(ifma_frommont52_p384_)(tmp, tmp);
+   MB_FUNC_NAME(ifma_frommont52_p384_)(rh, rh);
+
+   return MB_FUNC_NAME(cmp_eq_FE384_)(tmp, rh);
+}
@@ -0,0 +1,233 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/ecnist/ifma_ecpoint_p256.h>
+
+/*
+// Variable-time comb multiplications (public scalars only).
+//
+// Pre-computed points are fetched by gather, so window 7 tables are affordable here:
+// 37 affine additions instead of 65 with the window 4 table used by
+// constant-time ifma_ec_nistp256_mul_pointbase_().
+//
+// The same code serves the base point (ifma_ecprecomp7_p256.h) and
+// the per-lane tables of public keys built by ifma_ec_nistp256_precomp_comb_().
+*/
+
+#include <internal/ecnist/ifma_ecprecomp7_p256.h>
+
+#define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE  /* defined in the header above */
+
+#if (BP_WIN_SIZE != P256_COMB_WIN_SIZE) || (BP_N_SLOTS != P256_COMB_N_SLOTS) || (BP_N_ENTRY != P256_COMB_N_ENTRY)
+   #error "base point table and public key tables layout mismatch"
+#endif
+
+__INLINE void MB_FUNC_NAME(booth_recode_bp_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, BP_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(BP_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* gather affine point by the lane's address of entry (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_affine_)(P256_POINT_AFFINE* r, U64 addr, __mb_mask k)
+{
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<P256_LEN52; n++) {
+      r->x[n] = mask_gather64_addr(zero, k, add64(addr, set1(sizeof(int64u)*n)));
+      r->y[n] = mask_gather64_addr(zero, k, add64(addr, set1(sizeof(int64u)*(P256_LEN52+n))));
+   }
+}
+
+/* comb (RL) multiplication, tbl_addr[] is the lane's address of the table */
+static void MB_FUNC_NAME(mul_point_comb_)(P256_POINT* r, U64 tbl_addr, const U64 scalar[])
+{
+   P256_POINT R;
+   P256_POINT_AFFINE A;
+   U64 Ty[P256_LEN52];
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   U64 idx_mask = set1( (1<<(BP_WIN_SIZE+1))-1 );
+   U64 entry_size = set1(sizeof(SINGLE_P256_POINT_AFFINE));
+   U64 slot_size = set1(sizeof(SINGLE_P256_POINT_AFFINE)*BP_N_ENTRY);
+
+   int bit;
+   for(bit=0; bit<P256_BITSIZE; bit+=BP_WIN_SIZE, tbl_addr=add64(tbl_addr, slot_size)) {
+      if(bit) {
+         int chunk_no = (bit-1)/64;
+         int chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_bp_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      /* table does not contain [0]*P */
+      U64 addr = add64(tbl_addr, mul52lo(sub64(dvalue, set1(1)), entry_size));
+      MB_FUNC_NAME(gather_point_affine_)(&A, addr, dmask);
+
+      /* A = dsign? -A : A */
+      MB_FUNC_NAME(ifma_neg52_p256_)(Ty, A.y);
+      MB_FUNC_NAME(secure_mask_mov_FE256_)(A.y, A.y, dsign, Ty);
+
+      /* R += A */
+      MB_FUNC_NAME(ifma_ec_nistp256_add_point_affine_)(&R, &R, &A);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE256_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE256_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE256_)(r->Z, R.Z);
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_vartime_)(P256_POINT* r, const U64 scalar[])
+{
+   MB_FUNC_NAME(mul_point_comb_)(r, set1((int64u)ifma_ec_nistp256_bp_precomp), scalar);
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_comb_vartime_)(P256_POINT* r, const SINGLE_P256_POINT_AFFINE* const tbl[], const U64 scalar[])
+{
+   MB_FUNC_NAME(mul_point_comb_)(r, loadu64(tbl), scalar);
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/* number of points converted into affine at once */
+#define AFFINE_BATCH  (16)
+
+/* r[i] = affine(p[i]), i=0,..,AFFINE_BATCH-1 (single inversion by Montgomery's trick) */
+static void MB_FUNC_NAME(batch_affine_)(P256_POINT_AFFINE r[], const P256_POINT p[])
+{
+   __ALIGN64 U64 acc[AFFINE_BATCH][P256_LEN52];
+   __ALIGN64 U64 inv[P256_LEN52];
+   __ALIGN64 U64 invZ1[P256_LEN52];
+   __ALIGN64 U64 invZn[P256_LEN52];
+
+   /* acc[i] = Z[0]*..*Z[i] */
+   MB_FUNC_NAME(mov_FE256_)(acc[0], p[0].Z);
+   int i;
+   for(i=1; i<AFFINE_BATCH; i++)
+      MB_FUNC_NAME(ifma_amm52_p256_)(acc[i], acc[i-1], p[i].Z);
+
+   MB_FUNC_NAME(ifma_aminv52_p256_)(inv, acc[AFFINE_BATCH-1]);
+
+   for(i=AFFINE_BATCH-1; i>=0; i--) {
+      /* 1/Z[i] */
+      if(i) {
+         MB_FUNC_NAME(ifma_amm52_p256_)(invZ1, inv, acc[i-1]);
+         MB_FUNC_NAME(ifma_amm52_p256_)(inv, inv, p[i].Z);
+      }
+      else
+         MB_FUNC_NAME(mov_FE256_)(invZ1, inv);
+
+      /* x = X/Z^2, y = Y/Z^3 */
+      MB_FUNC_NAME(ifma_ams52_p256_)(invZn, invZ1);
+      MB_FUNC_NAME(ifma_amm52_p256_)(r[i].x, p[i].X, invZn);
+      MB_FUNC_NAME(ifma_amm52_p256_)(invZn, invZn, invZ1);
+      MB_FUNC_NAME(ifma_amm52_p256_)(r[i].y, p[i].Y, invZn);
+   }
+}
+
+/*
+// tbl[lane][j][d-1] = [d*2^(7*j)]*p[lane] in affine coordinates (Montgomery domain)
+// the point p is expected to be on the curve and out of the point at infinity
+*/
+void MB_FUNC_NAME(ifma_ec_nistp256_precomp_comb_)(SINGLE_P256_POINT_AFFINE* const tbl[], const P256_POINT* p)
+{
+   __ALIGN64 P256_POINT T[AFFINE_BATCH];
+   __ALIGN64 P256_POINT_AFFINE A[AFFINE_BATCH];
+
+   /* B = [2^(7*j)]*p */
+   P256_POINT B;
+   MB_FUNC_NAME(mov_FE256_)(B.X, p->X);
+   MB_FUNC_NAME(mov_FE256_)(B.Y, p->Y);
+   MB_FUNC_NAME(mov_FE256_)(B.Z, p->Z);
+
+   int slot, n, i;
+   for(slot=0; slot<BP_N_SLOTS; slot++) {
+      for(n=0; n<BP_N_ENTRY; n+=AFFINE_BATCH) {
+         /* T[i] = [n+i+1]*B */
+         for(i=0; i<AFFINE_BATCH; i++) {
+            if(0==(n+i)) {
+               MB_FUNC_NAME(mov_FE256_)(T[0].X, B.X);
+               MB_FUNC_NAME(mov_FE256_)(T[0].Y, B.Y);
+               MB_FUNC_NAME(mov_FE256_)(T[0].Z, B.Z);
+            }
+            else if(1==(n+i))
+               MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&T[1], &B);
+            else
+               MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&T[i], &T[(i+AFFINE_BATCH-1)%AFFINE_BATCH], &B);
+         }
+
+         MB_FUNC_NAME(batch_affine_)(A, T);
+
+         /* scatter to the lane's tables */
+         int lane, k;
+         for(lane=0; lane<MB_WIDTH; lane++) {
+            if(NULL==tbl[lane])
+               continue;
+            SINGLE_P256_POINT_AFFINE* pEntry = tbl[lane] + slot*BP_N_ENTRY + n;
+            for(i=0; i<AFFINE_BATCH; i++) {
+               for(k=0; k<P256_LEN52; k++) {
+                  pEntry[i].x[k] = ((int64u*)&A[i].x[k])[lane];
+                  pEntry[i].y[k] = ((int64u*)&A[i].y[k])[lane];
+               }
+            }
+         }
+      }
+
+      /* B = [2^7]*B */
+      for(i=0; i<BP_WIN_SIZE; i++)
+         MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&B, &B);
+   }
+}
+#undef AFFINE_BATCH
+#undef BP_WIN_SIZE
@@ -21,6 +21,8 @@
 #include <internal/common/ifma_cvt52.h>
 #include <internal/ecnist/ifma_ecpoint_p256.h>
 #include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ecnist/avx2_p256.h>
+#include <internal/common/ifma_rand.h>
 
 #ifndef BN_OPENSSL_DISABLE
 #include <openssl/bn.h>
@@ -136,12 +138,11 @@ mbx_status mbx_nistp256_ecpublic_key_ssl_mb8(BIGNUM* pa_pubx[8],
 }
 #endif // BN_OPENSSL_DISABLE
 
-DLL_PUBLIC
-mbx_status mbx_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
-                                         int64u* pa_puby[8],
-                                         int64u* pa_pubz[8],
-                                   const int64u* const pa_skey[8],
-                                          int8u* pBuffer)
+mbx_status ifma_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                          int64u* pa_puby[8],
+                                          int64u* pa_pubz[8],
+                                    const int64u* const pa_skey[8],
+                                           int8u* pBuffer)
 {
    mbx_status status = 0;
    int buf_no;
@@ -211,3 +212,356 @@ mbx_status mbx_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
 
    return status;
 }
+
+/* max number of attempts to draw private key */
+#define KEYGEN_MAX_TRIALS (16)
+
+/*
+// Generates key pairs
+// pa_skey[]   array of pointers to the private keys
+// pa_pubx[]   array of pointers to the public keys X-coordinates
+// pa_puby[]   array of pointers to the public keys Y-coordinates
+// pa_pubz[]   array of pointers to the public keys Z-coordinates (or NULL, if affine coordinate requested)
+// rndFunc     random generator (or NULL, if RDRAND based generator requested)
+// pRndParam   random generator parameter
+// pBuffer     pointer to the scratch buffer
+//
+// Note:
+// private keys 0 < d < n are drawn by rejection sampling,
+// the candidates out of the range are discarded and drawn again in the rejected lanes only
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp256_keygen_mb8(int64u* pa_skey[8],
+                                  int64u* pa_pubx[8],
+                                  int64u* pa_puby[8],
+                                  int64u* pa_pubz[8],
+                            mbx_rand_func rndFunc,
+                                    void* pRndParam,
+                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_bubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_skey[buf_no] || NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no] || (use_jproj_coords && NULL==pa_pubz[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   if(NULL==rndFunc)
+      rndFunc = ifma_rdrand_bytes;
+
+   /*
+   // processing
+   */
+
+   /* private keys */
+   __ALIGN64 int64u skey[8][P256_LEN64];
+   const int64u* const pa_key[8] = {skey[0],skey[1],skey[2],skey[3],skey[4],skey[5],skey[6],skey[7]};
+   U64 K[P256_LEN52];
+
+   int rejected = 0;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int n;
+      for(n=0; n<P256_LEN64; n++)
+         skey[buf_no][n] = 0;
+      if(MBX_STATUS_OK==MBX_GET_STS(status, buf_no))
+         rejected |= 1<<buf_no;
+   }
+
+   /* draw candidates in the rejected lanes and check 0 < d < n */
+   int trial;
+   for(trial=0; rejected && trial<KEYGEN_MAX_TRIALS; trial++) {
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(0==((rejected>>buf_no) &1))
+            continue;
+
+         if(0 != rndFunc((int8u*)skey[buf_no], NUMBER_OF_DIGITS(P256_BITSIZE,8), pRndParam)) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+            rejected &= ~(1<<buf_no);
+            continue;
+         }
+      }
+
+      ifma_BNU_to_mb8((int64u (*)[8])K, pa_key, P256_BITSIZE);
+      rejected &= (int)MB_FUNC_NAME(ifma_check_range_n256_)(K);
+   }
+   MB_FUNC_NAME(zero_)((int64u (*)[8])K, sizeof(K)/sizeof(U64));
+
+   /* lanes have not drawn a valid key in KEYGEN_MAX_TRIALS attempts (broken random generator) */
+   status |= MBX_SET_STS_BY_MASK(status, (__mb_mask)rejected, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      MB_FUNC_NAME(zero_)((int64u (*)[8])skey, sizeof(skey)/sizeof(U64));
+      return status;
+   }
+
+   /* zero padded keys */
+   U64 scalarz[P256_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])scalarz, pa_key, P256_BITSIZE);
+   scalarz[P256_LEN64] = get_zero64();
+
+   /* public key */
+   P256_POINT P;
+
+   /* compute public keys */
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, scalarz);
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])scalarz, sizeof(scalarz)/sizeof(U64));
+
+   /* validate public keys: P belongs to EC and is not the point at infinity */
+   __mb_mask not_valid_mask = ~MB_FUNC_NAME(ifma_is_on_curve_p256_)(&P, 1);
+   not_valid_mask |= MB_FUNC_NAME(is_zero_point_cordinate_)(P.Z);
+   status |= MBX_SET_STS_BY_MASK(status, not_valid_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!use_jproj_coords)
+      MB_FUNC_NAME(get_nistp256_ec_affine_coords_)(P.X, P.Y, &P);
+
+   /* convert P coordinates to regular domain */
+   MB_FUNC_NAME(ifma_frommont52_p256_)(P.X, P.X);
+   MB_FUNC_NAME(ifma_frommont52_p256_)(P.Y, P.Y);
+   if(use_jproj_coords)
+      MB_FUNC_NAME(ifma_frommont52_p256_)(P.Z, P.Z);
+
+   /* store result */
+   int64u* pa_x[8];
+   int64u* pa_y[8];
+   int64u* pa_z[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int ok = MBX_STATUS_OK==MBX_GET_STS(status, buf_no);
+      pa_x[buf_no] = ok? pa_pubx[buf_no] : NULL;
+      pa_y[buf_no] = ok? pa_puby[buf_no] : NULL;
+      pa_z[buf_no] = (ok && use_jproj_coords)? pa_pubz[buf_no] : NULL;
+
+      if(ok) {
+         int n;
+         for(n=0; n<P256_LEN64; n++)
+            pa_skey[buf_no][n] = skey[buf_no][n];
+      }
+   }
+   ifma_mb8_to_BNU(pa_x, (const int64u (*)[8])P.X, P256_BITSIZE);
+   ifma_mb8_to_BNU(pa_y, (const int64u (*)[8])P.Y, P256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_mb8_to_BNU(pa_z, (const int64u (*)[8])P.Z, P256_BITSIZE);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])skey, sizeof(skey)/sizeof(U64));
+
+   return status;
+}
+
+/*
+// Decodes SEC1 octet strings (compressed or uncompressed) into the affine points (x,y)
+// Output coordinates are in regular domain, lanes with invalid encoding get MBX_STATUS_MISMATCH_PARAM_ERR
+*/
+static mbx_status nistp256_ec_decode_point(U64 x[], U64 y[],
+                                      const int8u* const pa_oct[8],
+                                      const int pa_oct_len[8],
+                                            mbx_status status)
+{
+   const int len = NUMBER_OF_DIGITS(P256_BITSIZE, 8);
+   const int8u* pa_x[8];
+   const int8u* pa_y[8];
+   int compressed = 0;
+   int odd = 0;
+   int buf_no;
+
+   /* parse point format */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int8u* oct = pa_oct[buf_no];
+      pa_x[buf_no] = NULL;
+      pa_y[buf_no] = NULL;
+
+      if(MBX_STATUS_OK!=MBX_GET_STS(status, buf_no))
+         continue;
+
+      /* compressed: 02||x or 03||x */
+      if((1+len)==pa_oct_len[buf_no] && (0x02==oct[0] || 0x03==oct[0])) {
+         pa_x[buf_no] = oct+1;
+         compressed |= 1<<buf_no;
+         odd |= (oct[0] & 1)<<buf_no;
+      }
+      /* uncompressed: 04||x||y */
+      else if((1+2*len)==pa_oct_len[buf_no] && 0x04==oct[0]) {
+         pa_x[buf_no] = oct+1;
+         pa_y[buf_no] = oct+1+len;
+      }
+      else
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   P256_POINT P;
+
+   /* convert coordinates and check their range */
+   ifma_HexStr8_to_mb8((int64u (*)[8])P.X, pa_x, P256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])P.Y, pa_y, P256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_p256_)(P.X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_p256_)(P.Y) & ~(__mb_mask)compressed, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   MB_FUNC_NAME(ifma_tomont52_p256_)(P.X, P.X);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(P.Y, P.Y);
+
+   __mb_mask not_on_curve_mask = 0;
+
+   /* uncompressed points: check if (x,y) belongs to EC */
+   if(0xFF!=compressed)
+      not_on_curve_mask |= ~MB_FUNC_NAME(ifma_is_on_curve_p256_)(&P, 0) & ~(__mb_mask)compressed;
+
+   /* compressed points: y = sqrt(x^3 + a*x + b), choose root of requested parity */
+   if(0!=compressed) {
+      U64 yc[P256_LEN52], tmp[P256_LEN52];
+
+      not_on_curve_mask |= ~MB_FUNC_NAME(ifma_decompress_y_p256_)(yc, P.X) & (__mb_mask)compressed;
+
+      MB_FUNC_NAME(ifma_frommont52_p256_)(tmp, yc);
+      __mb_mask is_odd = cmpeq64_mask(and64_const(tmp[0], 1), set1(1));
+      __mb_mask flip = mask_xor(is_odd, (__mb_mask)odd);
+
+      MB_FUNC_NAME(ifma_neg52_p256_)(tmp, yc);
+      MB_FUNC_NAME(mask_mov_FE256_)(yc, yc, flip, tmp);
+      MB_FUNC_NAME(mask_mov_FE256_)(P.Y, P.Y, (__mb_mask)compressed, yc);
+   }
+
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* convert coordinates to regular domain */
+   MB_FUNC_NAME(ifma_frommont52_p256_)(x, P.X);
+   MB_FUNC_NAME(ifma_frommont52_p256_)(y, P.Y);
+
+   return status;
+}
+
+#ifndef BN_OPENSSL_DISABLE
+/*
+// Decodes public keys represented as SEC1 octet strings
+// pa_pubx[]      array of pointers to the public keys X-coordinates
+// pa_puby[]      array of pointers to the public keys Y-coordinates
+// pa_oct[]       array of pointers to the encoded points (02||x, 03||x or 04||x||y)
+// pa_oct_len[]   array of the encoded points lengths
+// pBuffer        pointer to the scratch buffer
+//
+// Note:
+// output public key is represented by (x:y) affine coordinates
+*/
+DLL_PUBLIC
+mbx_status mbx_nistp256_ec_decode_point_ssl_mb8(BIGNUM* pa_pubx[8],
+                                               BIGNUM* pa_puby[8],
+                                         const int8u* const pa_oct[8],
+                                         const int pa_oct_len[8],
+                                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_oct || NULL==pa_oct_len) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no] || NULL==pa_oct[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   U64 X[P256_LEN52], Y[P256_LEN52];
+   status = nistp256_ec_decode_point(X, Y, pa_oct, pa_oct_len, status);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* convert public key and store BIGNUM result */
+   int8u tmp[8][NUMBER_OF_DIGITS(P256_BITSIZE,8)];
+   int8u* const pa_tmp[8] = {tmp[0],tmp[1],tmp[2],tmp[3],tmp[4],tmp[5],tmp[6],tmp[7]};
+
+   /* X */
+   ifma_mb8_to_HexStr8(pa_tmp, (const int64u (*)[8])X, P256_BITSIZE);
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK==MBX_GET_STS(status, buf_no))
+         BN_bin2bn(pa_tmp[buf_no], NUMBER_OF_DIGITS(P256_BITSIZE,8), pa_pubx[buf_no]);
+   }
+
+   /* Y */
+   ifma_mb8_to_HexStr8(pa_tmp, (const int64u (*)[8])Y, P256_BITSIZE);
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK==MBX_GET_STS(status, buf_no))
+         BN_bin2bn(pa_tmp[buf_no], NUMBER_OF_DIGITS(P256_BITSIZE,8), pa_puby[buf_no]);
+   }
+
+   return status;
+}
+#endif // BN_OPENSSL_DISABLE
+
+DLL_PUBLIC
+mbx_status mbx_nistp256_ec_decode_point_mb8(int64u* pa_pubx[8],
+                                           int64u* pa_puby[8],
+                                     const int8u* const pa_oct[8],
+                                     const int pa_oct_len[8],
+                                           int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_oct || NULL==pa_oct_len) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no] || NULL==pa_oct[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   U64 X[P256_LEN52], Y[P256_LEN52];
+   status = nistp256_ec_decode_point(X, Y, pa_oct, pa_oct_len, status);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* store result */
+   int64u* pa_x[8];
+   int64u* pa_y[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int ok = MBX_STATUS_OK==MBX_GET_STS(status, buf_no);
+      pa_x[buf_no] = ok? pa_pubx[buf_no] : NULL;
+      pa_y[buf_no] = ok? pa_puby[buf_no] : NULL;
+   }
+   ifma_mb8_to_BNU(pa_x, (const int64u (*)[8])X, P256_BITSIZE);
+   ifma_mb8_to_BNU(pa_y, (const int64u (*)[8])Y, P256_BITSIZE);
+
+   return status;
+}
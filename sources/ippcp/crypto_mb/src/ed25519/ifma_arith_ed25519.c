@@ -19,6 +19,7 @@
 #include <internal/common/ifma_math.h>
 
 #include <internal/ed25519/ifma_arith_p25519.h>
+#include <internal/ed25519/ifma_arith_n25519.h>
 #include <internal/ed25519/ifma_arith_ed25519.h>
 #include <internal/ed25519/ifma_ed25519_precomp4.h>
 
@@ -538,3 +539,291 @@ void ifma_ed25519_prod_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 sca
    ge_add(&t, r, &c);
    ge52_p1p1_to_ext_mb(r, &t);
 }
+
+/* r = p + q */
+void ge52_ext_add(ge52_ext_mb* r, const ge52_ext_mb* p, const ge52_ext_mb* q)
+{
+   __ALIGN64 ge52_cached_mb c;
+   __ALIGN64 ge52_p1p1_mb t;
+   ge_ext_to_cached_mb(&c, q);
+   ge_add(&t, p, &c);
+   ge52_p1p1_to_ext_mb(r, &t);
+}
+
+/* mask of lanes where [8]*p is the neutral element (p is of small order) */
+__mb_mask ge52_ext_is_small_order(const ge52_ext_mb* p)
+{
+   __ALIGN64 ge52_p1p1_mb t;
+   __ALIGN64 ge52_homo_mb s;
+
+   /* s = [8]*p */
+   ge52_ext_to_homo_mb(&s, p);
+   ge_dbl(&t, &s);
+   ge52_p1p1_to_homo_mb(&s, &t);
+   ge_dbl(&t, &s);
+   ge52_p1p1_to_homo_mb(&s, &t);
+   ge_dbl(&t, &s);
+   ge52_p1p1_to_homo_mb(&s, &t);
+
+   /* neutral element: X==0 and Y==Z */
+   fe52_mb x, y;
+   fe52_red(x, s.X);
+   fe52_sub(y, s.Y, s.Z);
+   fe52_red(y, y);
+
+   return fe52_mb_is_zero(x) & fe52_mb_is_zero(y);
+}
+
+/*
+// Variable-time multi-scalar multiplication (public data only):
+//    r = [scalar[0]]*p[0] + [scalar[1]]*p[1] + ... + [scalar[num-1]]*p[num-1]
+//
+// Straus' method: all the points share doublings of the single accumulator,
+// the lane's entries of the pre-computed tables are fetched by gather.
+// Scalars are less than 2^N25519_BITSIZE, windows being zero in every lane are skipped,
+// so short scalars cost less additions.
+*/
+#define SCALAR_BITSIZE  (N25519_BITSIZE)
+#define WIN_SIZE        (ED25519_MULTI_WIN_SIZE)
+
+#if (WIN_SIZE != 4)
+   #error "booth_recode() above is defined for the window of size 4"
+#endif
+
+/* gather the lane's table entries tbl[idx-1] (the lanes with idx==0 get neutral element) */
+static void gather_cached_point(ge52_cached_mb* r, const ge52_cached_mb tbl[], U64 idx, __mb_mask sign)
+{
+   __mb_mask k = cmp64_mask(idx, get_zero64(), _MM_CMPINT_NE);
+
+   /* index of the int64u element of the lane's entry */
+   U64 offset = add64(mul52lo(sub64(idx, set1(1)), set1(sizeof(ge52_cached_mb)/sizeof(int64u))), lane_idx64());
+
+   neutral_ge52_cached_mb(r);
+
+   int n;
+   for(n=0; n<FE_LEN52; n++) {
+      r->YsubX[n] = mask_gather64(r->YsubX[n], k, offset, &tbl[0].YsubX[n]);
+      r->YaddX[n] = mask_gather64(r->YaddX[n], k, offset, &tbl[0].YaddX[n]);
+      r->T2d[n]   = mask_gather64(r->T2d[n],   k, offset, &tbl[0].T2d[n]);
+      r->Z[n]     = mask_gather64(r->Z[n],     k, offset, &tbl[0].Z[n]);
+   }
+
+   /* adjust for sign */
+   fe52_mb neg;
+   fe52_neg(neg, r->T2d);
+   fe52_cswap_mb(r->YsubX, sign, r->YaddX);
+   fe52_cmov_mb(r->T2d, r->T2d, sign, neg);
+}
+
+void ifma_ed25519_mul_point_multi_vartime(ge52_ext_mb* r,
+                                    const ge52_ext_mb p[],
+                                    const U64 scalar[][FE_LEN64+1],
+                                          int num,
+                                          ge52_cached_mb tbl[][ED25519_MULTI_TBL_SIZE])
+{
+   __ALIGN64 ge52_p1p1_mb p1p1;
+   __ALIGN64 ge52_homo_mb homo;
+   __ALIGN64 ge52_cached_mb cached;
+   __ALIGN64 ge52_ext_mb ext;
+
+   /* tables tbl[n][] = {p[n], [2]p[n], .., [8]p[n]} */
+   int n, i;
+   for(n=0; n<num; n++) {
+      ge_ext_to_cached_mb(&tbl[n][0], &p[n]);
+      for(i=1; i<ED25519_MULTI_TBL_SIZE; i++) {
+         ge_add(&p1p1, &p[n], &tbl[n][i-1]);
+         ge52_p1p1_to_ext_mb(&ext, &p1p1);
+         ge_ext_to_cached_mb(&tbl[n][i], &ext);
+      }
+   }
+
+   neutral_ge52_ext_mb(&ext);
+
+   U64 idx_mask = set1((1 << (WIN_SIZE + 1)) - 1);
+   U64 wvalue, dvalue;
+   __mb_mask dsign;
+
+   int bit = SCALAR_BITSIZE - (SCALAR_BITSIZE % WIN_SIZE);
+   int first = 1;
+   for(; bit>=0; bit-=WIN_SIZE) {
+      /* ext = [2^WIN_SIZE]*ext */
+      if(!first) {
+         ge52_ext_to_homo_mb(&homo, &ext);
+         for(i=0; i<WIN_SIZE-1; i++) {
+            ge_dbl(&p1p1, &homo);
+            ge52_p1p1_to_homo_mb(&homo, &p1p1);
+         }
+         ge_dbl(&p1p1, &homo);
+         ge52_p1p1_to_ext_mb(&ext, &p1p1);
+      }
+
+      for(n=0; n<num; n++) {
+         if(bit) {
+            int chunk_no = (bit - 1) / 64;
+            int chunk_shift = (bit - 1) % 64;
+            wvalue = loadu64(&scalar[n][chunk_no]);
+            wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[n][chunk_no + 1]), set1((int32u)chunk_shift));
+            wvalue = and64(wvalue, idx_mask);
+         }
+         else
+            wvalue = and64(slli64(loadu64(&scalar[n][0]), 1), idx_mask);
+
+         booth_recode(&dsign, &dvalue, wvalue);
+
+         /* nothing to accumulate in any lane */
+         if(!cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE))
+            continue;
+
+         gather_cached_point(&cached, tbl[n], dvalue, dsign);
+
+         /* ext += cached */
+         ge_add(&p1p1, &ext, &cached);
+         ge52_p1p1_to_ext_mb(&ext, &p1p1);
+         first = 0;
+      }
+   }
+
+   *r = ext;
+}
+#undef SCALAR_BITSIZE
+#undef WIN_SIZE
+
+/*
+// Variable-time multi-scalar multiplication of many points (public data only):
+//    r = [scalar[0]]*p[0] + [scalar[1]]*p[1] + ... + [scalar[num-1]]*p[num-1]
+//
+// Pippenger's bucket method: scalars are split into signed digits of win_size bits.
+// In every window the points are added into the buckets of their digits
+// (bucket[k] collects the points having digit +/-(k+1)), then sum of (k+1)*bucket[k]
+// is found by running sums. The digits differ from lane to lane, each lane owns
+// its column of the bucket array, so buckets are fetched by gather and stored back by scatter.
+// Points are converted to the cached form once into cached[].
+*/
+#define SCALAR_BITSIZE  (N25519_BITSIZE)
+
+__INLINE void booth_recode_win(__mb_mask* sign, U64* dvalue, U64 wvalue, int win_size)
+{
+   U64 one = set1(1);
+   __mb_mask s = cmp64_mask(srli64(wvalue, win_size), get_zero64(), _MM_CMPINT_NE);
+   U64 d = sub64(sub64(set1(1LL << (win_size + 1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   d = add64(srli64(d, 1), and64(d, one));
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* r = k? p : -p */
+__INLINE void ge52_cached_cneg(ge52_cached_mb* r, const ge52_cached_mb* p, __mb_mask sign)
+{
+   fe52_mb neg;
+   fe52_neg(neg, p->T2d);
+   fe52_copy_mb(r->YsubX, p->YsubX);
+   fe52_copy_mb(r->YaddX, p->YaddX);
+   fe52_copy_mb(r->Z, p->Z);
+   fe52_cswap_mb(r->YsubX, sign, r->YaddX);
+   fe52_cmov_mb(r->T2d, p->T2d, sign, neg);
+}
+
+void ifma_ed25519_mul_point_multi_bucket_vartime(ge52_ext_mb* r,
+                                           const ge52_ext_mb p[],
+                                           const U64 scalar[][FE_LEN64+1],
+                                                 int num,
+                                                 int win_size,
+                                                 ge52_cached_mb cached[],
+                                                 ge52_ext_mb bucket[])
+{
+   __ALIGN64 ge52_p1p1_mb p1p1;
+   __ALIGN64 ge52_homo_mb homo;
+   __ALIGN64 ge52_cached_mb q;
+   __ALIGN64 ge52_ext_mb b;
+   __ALIGN64 ge52_ext_mb acc;
+   __ALIGN64 ge52_ext_mb sum;
+   __ALIGN64 ge52_ext_mb total;
+
+   int nbuckets = 1 << (win_size - 1);
+   int n, i;
+
+   for(n=0; n<num; n++)
+      ge_ext_to_cached_mb(&cached[n], &p[n]);
+
+   neutral_ge52_ext_mb(&acc);
+
+   U64 idx_mask = set1((1LL << (win_size + 1)) - 1);
+   U64 wvalue, dvalue;
+   __mb_mask dsign;
+
+   int bit = SCALAR_BITSIZE - (SCALAR_BITSIZE % win_size);
+   for(; bit>=0; bit-=win_size) {
+      /* acc = [2^win_size]*acc */
+      if(bit != SCALAR_BITSIZE - (SCALAR_BITSIZE % win_size)) {
+         ge52_ext_to_homo_mb(&homo, &acc);
+         for(i=0; i<win_size-1; i++) {
+            ge_dbl(&p1p1, &homo);
+            ge52_p1p1_to_homo_mb(&homo, &p1p1);
+         }
+         ge_dbl(&p1p1, &homo);
+         ge52_p1p1_to_ext_mb(&acc, &p1p1);
+      }
+
+      for(i=0; i<nbuckets; i++)
+         neutral_ge52_ext_mb(&bucket[i]);
+
+      /* accumulate points into the buckets */
+      int empty = 1;
+      for(n=0; n<num; n++) {
+         if(bit) {
+            int chunk_no = (bit - 1) / 64;
+            int chunk_shift = (bit - 1) % 64;
+            wvalue = loadu64(&scalar[n][chunk_no]);
+            wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[n][chunk_no + 1]), set1((int32u)chunk_shift));
+            wvalue = and64(wvalue, idx_mask);
+         }
+         else
+            wvalue = and64(slli64(loadu64(&scalar[n][0]), 1), idx_mask);
+
+         booth_recode_win(&dsign, &dvalue, wvalue, win_size);
+
+         __mb_mask k = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+         if(!k)
+            continue;
+         empty = 0;
+
+         /* index of the int64u element of the lane's bucket */
+         U64 offset = add64(mul52lo(sub64(dvalue, set1(1)), set1(sizeof(ge52_ext_mb)/sizeof(int64u))), lane_idx64());
+
+         for(i=0; i<FE_LEN52; i++) {
+            b.X[i] = mask_gather64(get_zero64(), k, offset, &bucket[0].X[i]);
+            b.Y[i] = mask_gather64(get_zero64(), k, offset, &bucket[0].Y[i]);
+            b.T[i] = mask_gather64(get_zero64(), k, offset, &bucket[0].T[i]);
+            b.Z[i] = mask_gather64(get_zero64(), k, offset, &bucket[0].Z[i]);
+         }
+
+         ge52_cached_cneg(&q, &cached[n], dsign);
+         ge_add(&p1p1, &b, &q);
+         ge52_p1p1_to_ext_mb(&b, &p1p1);
+
+         for(i=0; i<FE_LEN52; i++) {
+            mask_scatter64(&bucket[0].X[i], k, offset, b.X[i]);
+            mask_scatter64(&bucket[0].Y[i], k, offset, b.Y[i]);
+            mask_scatter64(&bucket[0].T[i], k, offset, b.T[i]);
+            mask_scatter64(&bucket[0].Z[i], k, offset, b.Z[i]);
+         }
+      }
+      if(empty)
+         continue;
+
+      /* total = sum (i+1)*bucket[i] */
+      neutral_ge52_ext_mb(&sum);
+      neutral_ge52_ext_mb(&total);
+      for(i=nbuckets-1; i>=0; i--) {
+         ge52_ext_add(&sum, &sum, &bucket[i]);
+         ge52_ext_add(&total, &total, &sum);
+      }
+
+      ge52_ext_add(&acc, &acc, &total);
+   }
+
+   *r = acc;
+}
+#undef SCALAR_BITSIZE
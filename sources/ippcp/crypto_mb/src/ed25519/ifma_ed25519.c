@@ -26,7 +26,10 @@
 #include <internal/ed25519/ifma_arith_ed25519.h>
 #include <internal/ed25519/ifma_arith_p25519.h>
 #include <internal/ed25519/ifma_arith_n25519.h>
-#include <internal/ed25519/sha512.h>
+#include <internal/sha/sha2_mb8.h>
+#include <internal/common/ifma_rand.h>
+
+#include <stdlib.h>
 
 /* length of SHA512 hash in bits and bytes */
 #define SHA512_HASH_BITLENGTH  (512)
@@ -34,11 +37,21 @@
 
 static void ed25519_expand_key(int8u* pa_secret_expand[8], const ed25519_private_key* const pa_secret_key[8])
 {
-   /* do hash of secret keys in sequence */
+   const int8u* pa_secret[8];
+   int8u* pa_hash[8];
+   int len[8];
+
    for (int n = 0; n < 8; n++) {
-      const ed25519_private_key* psecret = pa_secret_key[n];
-      if (psecret) {
-          SHA512MsgDigest(*psecret, sizeof(ed25519_private_key), pa_secret_expand[n]);
+      pa_secret[n] = (const int8u*)pa_secret_key[n];
+      pa_hash[n] = pa_secret_key[n] ? pa_secret_expand[n] : NULL;
+      len[n] = sizeof(ed25519_private_key);
+   }
+
+   /* do hash of secret keys in all lanes at once */
+   sha512_msg_digest_mb8(pa_hash, pa_secret, len);
+
+   for (int n = 0; n < 8; n++) {
+      if (pa_hash[n]) {
          /* prune the buffer according to RFC8032 */
          pa_secret_expand[n][0]  &= 0xf8;
          pa_secret_expand[n][31] &= 0x7f;
@@ -111,70 +124,139 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_public_key_)(ed25519_public_key* pa_public_k
 }
 
 /*
-// Computes ED2519 signature
-// pa_sign_r[]       array of pointers to the computed r-components of the signatures
-// pa_sign_s[]       array of pointers to the computed s-components of the signatures
-// pa_msg[]          array of pointers to the messages are being signed
-// msgLen[]          array of messages lengths (in bytes) 
-// pa_private_key[]  array of pointers to the signer's private keys
-// pa_public_key[]   array of pointers to the signer's public keys
+// dom2(F, C) = "SigEd25519 no Ed25519 collisions" || octet(F) || octet(OLEN(C)) || C
+// prefixes hash inputs of the Ed25519ctx and Ed25519ph variants (RFC 8032, 5.1)
+*/
+static const int8u ed25519_dom2_str[] = "SigEd25519 no Ed25519 collisions";
+
+#define ED25519_DOM2_STR_LEN     ((int)sizeof(ed25519_dom2_str)-1)
+#define ED25519_CONTEXT_MAX_LEN  (255)
+#define ED25519_DOM2_MAX_LEN     (ED25519_DOM2_STR_LEN + 2 + ED25519_CONTEXT_MAX_LEN)
+
+/* value of the F octet */
+#define ED25519_DOM2_CTX   (0)
+#define ED25519_DOM2_PH    (1)
+
+/*
+// Builds dom2 prefixes
+// dom[]             storage of the prefixes
+// pa_dom[], dom_len[] pointers to the prefixes and their lengths
+// phflag            F octet
+// pa_context[]      array of pointers to the contexts (empty contexts if NULL)
+// contextLen[]      array of contexts lengths
+// minContextLen     allowed minimal context length
+//
+// Returns MBX_STATUS_NULL_PARAM_ERR or MBX_STATUS_MISMATCH_PARAM_ERR in lanes of incorrect contexts
 */
-static void ed25519_nonce(int8u* pa_nonce[8], int8u* pa_az[8], const int8u* const pa_msg[8], const int32u msgLen[8])
+static mbx_status ed25519_dom2(int8u dom[8][ED25519_DOM2_MAX_LEN], const int8u* pa_dom[8], int dom_len[8],
+                               int8u phflag, const int8u* const pa_context[8], const int32u contextLen[8],
+                               int32u minContextLen)
 {
-   SHA512State pState;
+   mbx_status status = MBX_STATUS_OK;
 
-   for(int n=0; n<8; n++) {
-      int8u* az = pa_az[n] + HASH_LENGTH/2;
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      
-      SHA512Init(&pState);
-      SHA512Update(az, 32, &pState);
-      if (msg)
-          SHA512Update(msg, mlen, &pState);
-      
-      SHA512Final(pa_nonce[n], &pState);
+   for (int n = 0; n < 8; n++) {
+      const int8u* context = pa_context ? pa_context[n] : NULL;
+      int32u clen = pa_context ? contextLen[n] : 0;
+
+      pa_dom[n] = dom[n];
+      dom_len[n] = 0;
+
+      if (clen && NULL == context) {
+         status = MBX_SET_STS(status, n, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if (clen < minContextLen || clen > ED25519_CONTEXT_MAX_LEN) {
+         status = MBX_SET_STS(status, n, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+
+      for (int i = 0; i < ED25519_DOM2_STR_LEN; i++)
+         dom[n][i] = ed25519_dom2_str[i];
+      dom[n][ED25519_DOM2_STR_LEN] = phflag;
+      dom[n][ED25519_DOM2_STR_LEN + 1] = (int8u)clen;
+      for (int32u i = 0; i < clen; i++)
+         dom[n][ED25519_DOM2_STR_LEN + 2 + i] = context[i];
+      dom_len[n] = ED25519_DOM2_STR_LEN + 2 + (int)clen;
    }
+
+   return status;
 }
 
-static void ed25519_hash_r_pub_msg(int8u* pa_hram[8], const ed25519_sign_component* const pa_sign_r[], const ed25519_public_key* const pa_public_key[8], const int8u* const pa_msg[8], const int32u msgLen[8])
+/* nonce = SHA512(dom || az+32 || msg), dom is empty if pa_dom is NULL */
+static void ed25519_nonce(int8u* pa_nonce[8], int8u* pa_az[8],
+                          const int8u* const pa_dom[8], const int dom_len[8],
+                          const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   SHA512State pState;
+   __ALIGN64 SHA512_CTX_mb8 ctx;
+   const int8u* pa_prefix[8];
+   int prefix_len[8];
+   int msg_len[8];
 
-   for (int n = 0; n < 8; n++) {
-      const ed25519_sign_component* sign_r = pa_sign_r[n];
-      const ed25519_public_key* public = pa_public_key[n];
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      SHA512Init(&pState);
-
-      if(sign_r)
-          SHA512Update((const int8u*)sign_r, NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8), &pState);
-      if(public)
-          SHA512Update((const int8u*)public, sizeof(ed25519_public_key), &pState);
-      if(msg)
-          SHA512Update(msg, mlen, &pState);
-      SHA512Final(pa_hram[n], &pState);
+   for(int n=0; n<8; n++) {
+      pa_prefix[n] = pa_az[n] + HASH_LENGTH/2;
+      prefix_len[n] = HASH_LENGTH/2;
+      msg_len[n] = pa_msg[n] ? (int)msgLen[n] : 0;
    }
+
+   mbx_sha512_init_mb8(&ctx);
+   if (pa_dom)
+      mbx_sha512_update_mb8(pa_dom, dom_len, &ctx);
+   mbx_sha512_update_mb8(pa_prefix, prefix_len, &ctx);
+   mbx_sha512_update_mb8(pa_msg, msg_len, &ctx);
+   mbx_sha512_final_mb8(pa_nonce, &ctx);
+
+   /* clear copy of the secret prefix */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])&ctx, sizeof(ctx)/sizeof(U64));
 }
 
-DLL_PUBLIC
-mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
-                                           ed25519_sign_component* pa_sign_s[8],
-                                           const int8u* const pa_msg[8], const int32u msgLen[8],
-                                           const ed25519_private_key* const pa_private_key[8],
-                                           const ed25519_public_key* const pa_public_key[8])
+/* hram = SHA512(dom || sign_r || public_key || msg), dom is empty if pa_dom is NULL */
+static void ed25519_hash_r_pub_msg(int8u* pa_hram[8], const int8u* const pa_dom[8], const int dom_len[8],
+                                   const ed25519_sign_component* const pa_sign_r[], const ed25519_public_key* const pa_public_key[8],
+                                   const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   mbx_status status = MBX_STATUS_OK;
+   __ALIGN64 SHA512_CTX_mb8 ctx;
+   int r_len[8];
+   int pub_len[8];
+   int msg_len[8];
 
-   /* test input pointers */
-   if(NULL == pa_sign_r || NULL == pa_sign_s ||
-      NULL == pa_msg || NULL == msgLen ||
-      NULL == pa_private_key || NULL== pa_public_key) {
-      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
-      return status;
+   for (int n = 0; n < 8; n++) {
+      r_len[n]   = pa_sign_r[n] ? NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8) : 0;
+      pub_len[n] = pa_public_key[n] ? (int)sizeof(ed25519_public_key) : 0;
+      msg_len[n] = pa_msg[n] ? (int)msgLen[n] : 0;
    }
 
+   mbx_sha512_init_mb8(&ctx);
+   if (pa_dom)
+      mbx_sha512_update_mb8(pa_dom, dom_len, &ctx);
+   mbx_sha512_update_mb8((const int8u* const*)pa_sign_r, r_len, &ctx);
+   mbx_sha512_update_mb8((const int8u* const*)pa_public_key, pub_len, &ctx);
+   mbx_sha512_update_mb8(pa_msg, msg_len, &ctx);
+   mbx_sha512_final_mb8(pa_hram, &ctx);
+}
+
+/*
+// Computes ED2519 signature
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_dom[]          array of pointers to the dom2 prefixes (NULL for pure ed25519)
+// dom_len[]         array of dom2 prefixes lengths
+// pa_msg[]          array of pointers to the messages are being signed
+// msgLen[]          array of messages lengths (in bytes)
+// pa_private_key[]  array of pointers to the signer's private keys
+// pa_public_key[]   array of pointers to the signer's public keys
+// status            statuses of the lanes rejected by caller, signatures are not stored in such lanes
+*/
+static mbx_status ed25519_sign_dom(ed25519_sign_component* const pa_sign_r[8],
+                               ed25519_sign_component* const pa_sign_s[8],
+                               const int8u* const pa_dom[8], const int dom_len[8],
+                               const int8u* const pa_msg[8], const int32u msgLen[8],
+                               const ed25519_private_key* const pa_private_key[8],
+                               const ed25519_public_key* const pa_public_key[8],
+                               mbx_status status)
+{
+   ed25519_sign_component* loc_sign_r[8];
+   ed25519_sign_component* loc_sign_s[8];
+
    /* check pointers and values */
    int buf_no;
    for (buf_no = 0; buf_no < 8; buf_no++) {
@@ -189,6 +271,10 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
          NULL == secret || NULL == public) {
          status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
       }
+
+      /* signatures are stored in the correct lanes only */
+      loc_sign_r[buf_no] = MBX_GET_STS(status, buf_no) ? NULL : sign_r;
+      loc_sign_s[buf_no] = MBX_GET_STS(status, buf_no) ? NULL : sign_s;
    }
 
    /* continue processing if there are correct parameters */
@@ -223,7 +309,7 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
 
       /* computes nonce, nonce = H(az+32, msg)  */
       /* Note: only a second half of each pa_az[n] item is used in the ed25519_nonce() function */
-      ed25519_nonce((int8u**)pa_nonce, (int8u**)pa_az, pa_msg, msgLen);
+      ed25519_nonce((int8u**)pa_nonce, (int8u**)pa_az, pa_dom, dom_len, pa_msg, msgLen);
 
       /* reduce nonce wrt n */
       U64 mb_nonce[NUMBER_OF_DIGITS(SHA512_HASH_BITLENGTH, DIGIT_SIZE)];
@@ -241,10 +327,10 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
       ge52_ext_compress(mb_sign_r, &R);            /* compress point to r-component */
 
       /* store r-component of the  signature */
-      ifma_mb8_to_BNU((int64u * const*)pa_sign_r, (const int64u(*)[8])mb_sign_r, GE25519_COMP_BITSIZE);
+      ifma_mb8_to_BNU((int64u * const*)loc_sign_r, (const int64u(*)[8])mb_sign_r, GE25519_COMP_BITSIZE);
 
       /* computes hram, hram = H(r_sign, public_key,  msg)  */
-      ed25519_hash_r_pub_msg((int8u**)pa_hram, (const ed25519_sign_component**)pa_sign_r, pa_public_key, pa_msg, msgLen);
+      ed25519_hash_r_pub_msg((int8u**)pa_hram, pa_dom, dom_len, (const ed25519_sign_component**)loc_sign_r, pa_public_key, pa_msg, msgLen);
 
       U64 mb_hram[NUMBER_OF_DIGITS(SHA512_HASH_BITLENGTH, DIGIT_SIZE)];
       ifma_BNU_to_mb8((int64u(*)[8])mb_hram, (const int64u**)pa_hram, SHA512_HASH_BITLENGTH);
@@ -255,7 +341,7 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
       ifma52_ed25519n_madd(mb_sign_s, mb_hram, mb_az, mb_nonce);
 
       /* store s-component of the signature */
-      ifma_mb8_to_BNU((int64u * const*)pa_sign_s, (const int64u(*)[8])mb_sign_s, N25519_BITSIZE);
+      ifma_mb8_to_BNU((int64u * const*)loc_sign_s, (const int64u(*)[8])mb_sign_s, N25519_BITSIZE);
 
       /* clear memory containing potentially secret data */
       MB_FUNC_NAME(zero_)((int64u(*)[8])az, sizeof(az)/sizeof(U64));
@@ -278,22 +364,38 @@ __ALIGN64 static int64u ed25519n_mb64[NE_LEN64][sizeof(U64)/sizeof(int64u)] = {
    { REP8_DECL(0x1000000000000000) }
 };
 
-DLL_PUBLIC
-mbx_status MB_FUNC_NAME(mbx_ed25519_verify_)(const ed25519_sign_component* const pa_sign_r[8],
-                                             const ed25519_sign_component* const pa_sign_s[8],
-                                             const int8u* const pa_msg[8], const int32u msgLen[8],
-                                             const ed25519_public_key* const pa_public_key[8])
+/* mask of lanes where a (4 x 64-bit digits) is less than ed25519 n */
+static __mb_mask ed25519n_cmp_lt(const U64 a[])
 {
-   mbx_status status = MBX_STATUS_OK;
-
-   /* test input pointers */
-   if (NULL == pa_sign_r || NULL == pa_sign_s ||
-      NULL == pa_msg || NULL == msgLen ||
-      NULL == pa_public_key) {
-      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
-      return status;
+   const U64* n_mb = (const U64*)ed25519n_mb64;
+   __mb_mask lt = 0;
+   __mb_mask eq = (__mb_mask)0xFF;
+   int n;
+   for(n=NE_LEN64-1; n>=0; n--) {
+      lt |= eq & _mm512_cmp_epu64_mask(a[n], n_mb[n], _MM_CMPINT_LT);
+      eq &= _mm512_cmp_epu64_mask(a[n], n_mb[n], _MM_CMPINT_EQ);
    }
+   return lt;
+}
 
+/*
+// Verifies ED2519 signature
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_dom[]          array of pointers to the dom2 prefixes (NULL for pure ed25519)
+// dom_len[]         array of dom2 prefixes lengths
+// pa_msg[]          array of pointers to the signed messages
+// msgLen[]          array of signed messages lengths
+// pa_public_key[]   array of pointers to the signer's public keys
+// status            statuses of the lanes rejected by caller
+*/
+static mbx_status ed25519_verify_dom(const ed25519_sign_component* const pa_sign_r[8],
+                                 const ed25519_sign_component* const pa_sign_s[8],
+                                 const int8u* const pa_dom[8], const int dom_len[8],
+                                 const int8u* const pa_msg[8], const int32u msgLen[8],
+                                 const ed25519_public_key* const pa_public_key[8],
+                                 mbx_status status)
+{
    /* check pointers and values */
    int buf_no;
    for (buf_no = 0; buf_no < 8; buf_no++) {
@@ -318,7 +420,7 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_verify_)(const ed25519_sign_component* const
          (int64u*)h[0], (int64u*)h[1], (int64u*)h[2], (int64u*)h[3],
          (int64u*)h[4], (int64u*)h[5], (int64u*)h[6], (int64u*)h[7]
       };
-      ed25519_hash_r_pub_msg((int8u**)pa_h, pa_sign_r, pa_public_key, pa_msg, msgLen);
+      ed25519_hash_r_pub_msg((int8u**)pa_h, pa_dom, dom_len, pa_sign_r, pa_public_key, pa_msg, msgLen);
 
       /* reduce h %= n */
       __ALIGN64 U64 h_mb[NUMBER_OF_DIGITS(SHA512_HASH_BITLENGTH, DIGIT_SIZE)];
@@ -344,11 +446,7 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_verify_)(const ed25519_sign_component* const
       ifma_BNU_to_mb8((int64u(*)[8])pubfe_mb, (const int64u**)pa_public_key, P25519_BITSIZE + 1);
 
       /* check that s<n */
-      U64* n_mb = (U64*)ed25519n_mb64;
-      __mmask8 k = 0;
-      for(int n=NE_LEN64; n>0; n--) {
-         k |= cmp64_mask(n_mb[n - 1], s_mb[n - 1], _MM_CMPINT_NLE);
-      }
+      __mmask8 k = ed25519n_cmp_lt(s_mb);
       status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_MISMATCH_PARAM_ERR);
 
       /* continue processing if there are correct parameters */
@@ -378,3 +476,570 @@ mbx_status MB_FUNC_NAME(mbx_ed25519_verify_)(const ed25519_sign_component* const
 
    return status;
 }
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
+                                           ed25519_sign_component* pa_sign_s[8],
+                                           const int8u* const pa_msg[8], const int32u msgLen[8],
+                                           const ed25519_private_key* const pa_private_key[8],
+                                           const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if(NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_private_key || NULL== pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   return ed25519_sign_dom(pa_sign_r, pa_sign_s, NULL, NULL, pa_msg, msgLen, pa_private_key, pa_public_key, MBX_STATUS_OK);
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519_verify_)(const ed25519_sign_component* const pa_sign_r[8],
+                                             const ed25519_sign_component* const pa_sign_s[8],
+                                             const int8u* const pa_msg[8], const int32u msgLen[8],
+                                             const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if (NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   return ed25519_verify_dom(pa_sign_r, pa_sign_s, NULL, NULL, pa_msg, msgLen, pa_public_key, MBX_STATUS_OK);
+}
+
+/*
+// Ed25519ctx and Ed25519ph (RFC 8032, 5.1)
+*/
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ctx_sign_)(ed25519_sign_component* pa_sign_r[8],
+                                              ed25519_sign_component* pa_sign_s[8],
+                                              const int8u* const pa_msg[8], const int32u msgLen[8],
+                                              const int8u* const pa_context[8], const int32u contextLen[8],
+                                              const ed25519_private_key* const pa_private_key[8],
+                                              const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if(NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_context || NULL == contextLen ||
+      NULL == pa_private_key || NULL== pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   __ALIGN64 int8u dom[8][ED25519_DOM2_MAX_LEN];
+   const int8u* pa_dom[8];
+   int dom_len[8];
+   mbx_status status = ed25519_dom2(dom, pa_dom, dom_len, ED25519_DOM2_CTX, pa_context, contextLen, 1);
+
+   return ed25519_sign_dom(pa_sign_r, pa_sign_s, pa_dom, dom_len, pa_msg, msgLen, pa_private_key, pa_public_key, status);
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ctx_verify_)(const ed25519_sign_component* const pa_sign_r[8],
+                                                const ed25519_sign_component* const pa_sign_s[8],
+                                                const int8u* const pa_msg[8], const int32u msgLen[8],
+                                                const int8u* const pa_context[8], const int32u contextLen[8],
+                                                const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if (NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_context || NULL == contextLen ||
+      NULL == pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   __ALIGN64 int8u dom[8][ED25519_DOM2_MAX_LEN];
+   const int8u* pa_dom[8];
+   int dom_len[8];
+   mbx_status status = ed25519_dom2(dom, pa_dom, dom_len, ED25519_DOM2_CTX, pa_context, contextLen, 1);
+
+   return ed25519_verify_dom(pa_sign_r, pa_sign_s, pa_dom, dom_len, pa_msg, msgLen, pa_public_key, status);
+}
+
+/* message of Ed25519ph is SHA512 digest of the original message */
+static const int32u ed25519ph_msg_len[8] = { REP8_DECL(SHA512_DIGEST_SIZE) };
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ph_sign_)(ed25519_sign_component* pa_sign_r[8],
+                                             ed25519_sign_component* pa_sign_s[8],
+                                             const int8u* const pa_msg_digest[8],
+                                             const int8u* const pa_context[8], const int32u contextLen[8],
+                                             const ed25519_private_key* const pa_private_key[8],
+                                             const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if(NULL == pa_sign_r || NULL == pa_sign_s || NULL == pa_msg_digest ||
+      (NULL != pa_context && NULL == contextLen) ||
+      NULL == pa_private_key || NULL== pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   __ALIGN64 int8u dom[8][ED25519_DOM2_MAX_LEN];
+   const int8u* pa_dom[8];
+   int dom_len[8];
+   mbx_status status = ed25519_dom2(dom, pa_dom, dom_len, ED25519_DOM2_PH, pa_context, contextLen, 0);
+
+   return ed25519_sign_dom(pa_sign_r, pa_sign_s, pa_dom, dom_len, pa_msg_digest, ed25519ph_msg_len, pa_private_key, pa_public_key, status);
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ph_verify_)(const ed25519_sign_component* const pa_sign_r[8],
+                                               const ed25519_sign_component* const pa_sign_s[8],
+                                               const int8u* const pa_msg_digest[8],
+                                               const int8u* const pa_context[8], const int32u contextLen[8],
+                                               const ed25519_public_key* const pa_public_key[8])
+{
+   /* test input pointers */
+   if (NULL == pa_sign_r || NULL == pa_sign_s || NULL == pa_msg_digest ||
+      (NULL != pa_context && NULL == contextLen) ||
+      NULL == pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   __ALIGN64 int8u dom[8][ED25519_DOM2_MAX_LEN];
+   const int8u* pa_dom[8];
+   int dom_len[8];
+   mbx_status status = ed25519_dom2(dom, pa_dom, dom_len, ED25519_DOM2_PH, pa_context, contextLen, 0);
+
+   return ed25519_verify_dom(pa_sign_r, pa_sign_s, pa_dom, dom_len, pa_msg_digest, ed25519ph_msg_len, pa_public_key, status);
+}
+
+/*
+// Streaming Ed25519ph: the messages are absorbed by mbx_sha512_init_mb8()/mbx_sha512_update_mb8()
+// into p_state, the functions below finalize the digests and sign/verify them
+*/
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ph_sign_final_)(ed25519_sign_component* pa_sign_r[8],
+                                                   ed25519_sign_component* pa_sign_s[8],
+                                                   SHA512_CTX_mb8* p_state,
+                                                   const int8u* const pa_context[8], const int32u contextLen[8],
+                                                   const ed25519_private_key* const pa_private_key[8],
+                                                   const ed25519_public_key* const pa_public_key[8])
+{
+   if (NULL == p_state)
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+
+   __ALIGN64 int8u digest[8][SHA512_DIGEST_SIZE];
+   int8u* pa_digest[8] = { digest[0], digest[1], digest[2], digest[3],
+                           digest[4], digest[5], digest[6], digest[7] };
+   mbx_sha512_final_mb8(pa_digest, p_state);
+
+   return MB_FUNC_NAME(mbx_ed25519ph_sign_)(pa_sign_r, pa_sign_s, (const int8u* const*)pa_digest,
+                                            pa_context, contextLen, pa_private_key, pa_public_key);
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed25519ph_verify_final_)(const ed25519_sign_component* const pa_sign_r[8],
+                                                     const ed25519_sign_component* const pa_sign_s[8],
+                                                     SHA512_CTX_mb8* p_state,
+                                                     const int8u* const pa_context[8], const int32u contextLen[8],
+                                                     const ed25519_public_key* const pa_public_key[8])
+{
+   if (NULL == p_state)
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+
+   __ALIGN64 int8u digest[8][SHA512_DIGEST_SIZE];
+   int8u* pa_digest[8] = { digest[0], digest[1], digest[2], digest[3],
+                           digest[4], digest[5], digest[6], digest[7] };
+   mbx_sha512_final_mb8(pa_digest, p_state);
+
+   return MB_FUNC_NAME(mbx_ed25519ph_verify_)(pa_sign_r, pa_sign_s, (const int8u* const*)pa_digest,
+                                              pa_context, contextLen, pa_public_key);
+}
+
+/*
+// Batch verification
+//
+// Signatures are processed by columns of 8 (one signature per lane). The batch is accepted
+// if in every lane the random linear combination of the verification equations holds:
+//    [8]*([sum z*s]*G - sum [z*h]*A - sum [z]*R) == O
+// where z are random 128-bit numbers. The sum is computed by the multi-scalar multiplication,
+// doublings are shared by all the signatures of the lane. Small ranges of columns are summed
+// by Straus' method, large ones by Pippenger's bucket method.
+//
+// If the check of the lane fails, the range of columns is halved until the single column,
+// whose lanes are verified by mbx_ed25519_verify_mb8().
+*/
+
+/* number of columns processed by one multi-scalar multiplication */
+#define BATCH_CHUNK  (16)
+
+/* bitsize of random multiplier */
+#define BATCH_Z_BITSIZE  (128)
+
+/* bucket method parameters */
+#define BATCH_BUCKET_MIN_POINTS  (256)
+#define BATCH_BUCKET_MIN_WIN     (5)
+#define BATCH_BUCKET_MAX_WIN     (11)
+#define BATCH_BUCKET_WIN_STEP    (16)
+
+/*
+// Window size of the bucket method for npoints points per lane, 0 if Straus' method is cheaper.
+// Bucket additions cost more than Straus' ones (gather and scatter of the bucket),
+// but the number of additions per point drops from 253/4 to 253/win.
+*/
+static int ed25519_batch_win_size(int npoints)
+{
+   if(npoints < BATCH_BUCKET_MIN_POINTS)
+      return 0;
+   int win = BATCH_BUCKET_MIN_WIN;
+   while(win < BATCH_BUCKET_MAX_WIN && (npoints >> win) >= BATCH_BUCKET_WIN_STEP)
+      win++;
+   return win;
+}
+
+/* scratch buffer layout */
+typedef struct {
+   ge52_ext_mb*      pnt;       /* [2*ncols] -A, -R of the column            */
+   U64             (*scalar)[FE_LEN64+1];  /* [2*ncols] z*h, z of the column */
+   U64             (*zs)[NE_LEN52];        /* [ncols]   z*s of the column    */
+   ge52_cached_mb  (*tbl)[ED25519_MULTI_TBL_SIZE]; /* [2*BATCH_CHUNK]        */
+   ge52_cached_mb*   cached;    /* [2*ncols] points of the bucket method     */
+   ge52_ext_mb*      bucket;    /* [2^(win-1)] buckets                       */
+   mbx_status*       status;    /* [ncols] statuses of the column            */
+} ed25519_batch_buffer;
+
+DLL_PUBLIC
+int mbx_ed25519_batch_verify_BufferSize(int num)
+{
+   if(0>=num)
+      return 0;
+
+   int ncols = NUMBER_OF_DIGITS(num, 8);
+   int win = ed25519_batch_win_size(2*ncols);
+   return (int)(64 /* alignment */
+               + 2*ncols * sizeof(ge52_ext_mb)
+               + 2*ncols * sizeof(U64)*(FE_LEN64+1)
+               +   ncols * sizeof(U64)*NE_LEN52
+               + 2*BATCH_CHUNK * sizeof(ge52_cached_mb)*ED25519_MULTI_TBL_SIZE
+               + (win? 2*ncols * sizeof(ge52_cached_mb) + ((size_t)1 << (win-1)) * sizeof(ge52_ext_mb) : 0)
+               +   ncols * sizeof(mbx_status));
+}
+
+static void ed25519_batch_layout(ed25519_batch_buffer* buf, int8u* pBuffer, int ncols)
+{
+   int8u* ptr = (int8u*)IFMA_ALIGNED_PTR(pBuffer, 64);
+
+   buf->pnt = (ge52_ext_mb*)ptr;
+   ptr += 2*ncols * sizeof(ge52_ext_mb);
+   buf->scalar = (U64 (*)[FE_LEN64+1])ptr;
+   ptr += 2*ncols * sizeof(U64)*(FE_LEN64+1);
+   buf->zs = (U64 (*)[NE_LEN52])ptr;
+   ptr += ncols * sizeof(U64)*NE_LEN52;
+   buf->tbl = (ge52_cached_mb (*)[ED25519_MULTI_TBL_SIZE])ptr;
+   ptr += 2*BATCH_CHUNK * sizeof(ge52_cached_mb)*ED25519_MULTI_TBL_SIZE;
+   int win = ed25519_batch_win_size(2*ncols);
+   buf->cached = (ge52_cached_mb*)ptr;
+   buf->bucket = (ge52_ext_mb*)(ptr + (win? 2*ncols * sizeof(ge52_cached_mb) : 0));
+   ptr += win? 2*ncols * sizeof(ge52_cached_mb) + ((size_t)1 << (win-1)) * sizeof(ge52_ext_mb) : 0;
+   buf->status = (mbx_status*)ptr;
+}
+
+/* mask of lanes where encoded y-coordinate of the point is not less than prime25519 */
+static __mb_mask ed25519_noncanonical_y(const fe52_mb fe)
+{
+   __mb_mask k = cmpeq64_mask(and64_const(fe[FE_LEN52-1], PRIME25519_HI), set1(PRIME25519_HI));
+   k &= cmpeq64_mask(fe[3], set1(PRIME25519_MID));
+   k &= cmpeq64_mask(fe[2], set1(PRIME25519_MID));
+   k &= cmpeq64_mask(fe[1], set1(PRIME25519_MID));
+   k &= _mm512_cmp_epu64_mask(fe[0], set1(PRIME25519_LO), _MM_CMPINT_NLT);
+   return k;
+}
+
+/*
+// Decodes the column of signatures: checks parameters, hashes the messages,
+// draws random multipliers and prepares scalars and points of the multi-scalar multiplication.
+// Lanes having not OK status (or being out of batch) do not contribute into the sum.
+// Returns 0 if random generator failed.
+*/
+static int ed25519_batch_decode(ge52_ext_mb pnt[2], U64 scalar[2][FE_LEN64+1], U64 zs[NE_LEN52], mbx_status* pStatus,
+                                const ed25519_sign_component* const pa_sign_r[8],
+                                const ed25519_sign_component* const pa_sign_s[8],
+                                const int8u* const pa_msg[8], const int32u msgLen[8],
+                                const ed25519_public_key* const pa_public_key[8],
+                                mbx_rand_func rndFunc, void* pRndParam)
+{
+   mbx_status status = MBX_STATUS_OK;
+   __mb_mask ok;
+
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_sign_r[buf_no] || NULL==pa_sign_s[buf_no] || NULL==pa_msg[buf_no] || NULL==pa_public_key[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   /* h = SHA512(sign_r || public_key || msg) mod n */
+   __ALIGN64 int8u h[8][HASH_LENGTH] = { 0 };
+   int64u* pa_h[8] = {
+      (int64u*)h[0], (int64u*)h[1], (int64u*)h[2], (int64u*)h[3],
+      (int64u*)h[4], (int64u*)h[5], (int64u*)h[6], (int64u*)h[7]
+   };
+   ed25519_hash_r_pub_msg((int8u**)pa_h, NULL, NULL, pa_sign_r, pa_public_key, pa_msg, msgLen);
+
+   __ALIGN64 U64 h_mb[NUMBER_OF_DIGITS(SHA512_HASH_BITLENGTH, DIGIT_SIZE)];
+   ifma_BNU_to_mb8((int64u(*)[8])h_mb, (const int64u**)pa_h, SHA512_HASH_BITLENGTH);
+   ifma52_ed25519n_reduce(h_mb, h_mb);
+
+   /* s < n */
+   __ALIGN64 U64 s64_mb[NE_LEN64];
+   __ALIGN64 U64 s_mb[NE_LEN52];
+   ifma_BNU_transpose_copy((int64u(*)[8])s64_mb, (const int64u**)pa_sign_s, 256);
+   ifma_BNU_to_mb8((int64u(*)[8])s_mb, (const int64u**)pa_sign_s, 256);
+   status |= MBX_SET_STS_BY_MASK(status, ~ed25519n_cmp_lt(s64_mb), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* -A */
+   __ALIGN64 fe52_mb fe;
+   ifma_BNU_to_mb8((int64u(*)[8])fe, (const int64u**)pa_public_key, GE25519_COMP_BITSIZE);
+   ok = ge52_ext_decompress(&pnt[0], fe);
+   fe52_neg(pnt[0].X, pnt[0].X);
+   fe52_neg(pnt[0].T, pnt[0].T);
+   status |= MBX_SET_STS_BY_MASK(status, ~ok, MBX_STATUS_SIGNATURE_ERR);
+
+   /* -R, non-canonical encoding is rejected as mbx_ed25519_verify_mb8() compares encodings */
+   ifma_BNU_to_mb8((int64u(*)[8])fe, (const int64u**)pa_sign_r, GE25519_COMP_BITSIZE);
+   ok = ge52_ext_decompress(&pnt[1], fe);
+   ok &= ~ed25519_noncanonical_y(fe);
+   {
+      fe52_mb x;
+      fe52_red(x, pnt[1].X);
+      __mb_mask sign = cmp64_mask(srli64(fe[FE_LEN52-1], (GE25519_COMP_BITSIZE-1)%DIGIT_SIZE), get_zero64(), _MM_CMPINT_NE);
+      ok &= ~(fe52_mb_is_zero(x) & sign);
+   }
+   fe52_neg(pnt[1].X, pnt[1].X);
+   fe52_neg(pnt[1].T, pnt[1].T);
+   status |= MBX_SET_STS_BY_MASK(status, ~ok, MBX_STATUS_SIGNATURE_ERR);
+
+   /* random multipliers */
+   __ALIGN64 int64u z[8][NUMBER_OF_DIGITS(BATCH_Z_BITSIZE, 64)];
+   if(rndFunc((int8u*)z, sizeof(z), pRndParam))
+      return 0;
+   for(buf_no=0; buf_no<8; buf_no++)
+      z[buf_no][0] |= 1;   /* z != 0 */
+
+   const int64u* pa_z[8] = { z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7] };
+   __ALIGN64 U64 z_mb[NE_LEN52] = { 0 };
+   ifma_BNU_to_mb8((int64u(*)[8])z_mb, pa_z, BATCH_Z_BITSIZE);
+
+   /* exclude lanes with errors */
+   ok = 0;
+   for(buf_no=0; buf_no<8; buf_no++)
+      ok |= (__mb_mask)((MBX_STATUS_OK==MBX_GET_STS(status, buf_no)) << buf_no);
+   int n;
+   for(n=0; n<NE_LEN52; n++)
+      z_mb[n] = _mm512_maskz_mov_epi64(ok, z_mb[n]);
+
+   /* scalars: z*h, z, z*s */
+   __ALIGN64 U64 zero_mb[NE_LEN52] = { 0 };
+   __ALIGN64 U64 t_mb[NE_LEN52];
+   ifma52_ed25519n_madd(t_mb, z_mb, h_mb, zero_mb);
+   fe52_to_fe64_mb(scalar[0], t_mb);
+   scalar[0][FE_LEN64] = get_zero64();
+
+   fe52_to_fe64_mb(scalar[1], z_mb);
+   scalar[1][FE_LEN64] = get_zero64();
+
+   ifma52_ed25519n_madd(zs, z_mb, s_mb, zero_mb);
+
+   *pStatus = status;
+
+   /* clear copy of the random multipliers */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])z, sizeof(z)/sizeof(U64));
+   return 1;
+}
+
+/* mask of lanes failed the batch check over the columns [c0, c1) */
+static __mb_mask ed25519_batch_check(const ed25519_batch_buffer* buf, int c0, int c1)
+{
+   /* Q = [sum z*s]*G */
+   __ALIGN64 U64 g_mb[NE_LEN52] = { 0 };
+   __ALIGN64 U64 one_mb[NE_LEN52] = { 0 };
+   one_mb[0] = set1(1);
+   int c;
+   for(c=c0; c<c1; c++)
+      ifma52_ed25519n_madd(g_mb, buf->zs[c], one_mb, g_mb);
+
+   __ALIGN64 U64 g64_mb[FE_LEN64];
+   fe52_to_fe64_mb(g64_mb, g_mb);
+
+   __ALIGN64 ge52_ext_mb Q;
+   ifma_ed25519_mul_basepoint(&Q, g64_mb);
+
+   /* Q += sum [z*h]*(-A) + [z]*(-R) */
+   int win = ed25519_batch_win_size(2*(c1-c0));
+   if(win) {
+      __ALIGN64 ge52_ext_mb T;
+      ifma_ed25519_mul_point_multi_bucket_vartime(&T, buf->pnt+2*c0, (const U64 (*)[FE_LEN64+1])(buf->scalar+2*c0), 2*(c1-c0),
+                                                  win, buf->cached, buf->bucket);
+      ge52_ext_add(&Q, &Q, &T);
+   }
+   else for(c=c0; c<c1; c+=BATCH_CHUNK) {
+      int ncols = (c1-c < BATCH_CHUNK)? c1-c : BATCH_CHUNK;
+
+      __ALIGN64 ge52_ext_mb T;
+      ifma_ed25519_mul_point_multi_vartime(&T, buf->pnt+2*c, (const U64 (*)[FE_LEN64+1])(buf->scalar+2*c), 2*ncols, buf->tbl);
+      ge52_ext_add(&Q, &Q, &T);
+   }
+
+   return (__mb_mask)~ge52_ext_is_small_order(&Q);
+}
+
+/* finds failed signatures of the lanes fail_mask over the columns [c0, c1) */
+static void ed25519_batch_locate(const ed25519_batch_buffer* buf, int c0, int c1, __mb_mask fail_mask,
+                                 const ed25519_sign_component* const pa_sign_r[],
+                                 const ed25519_sign_component* const pa_sign_s[],
+                                 const int8u* const pa_msg[], const int32u msgLen[],
+                                 const ed25519_public_key* const pa_public_key[])
+{
+   if(1==(c1-c0)) {
+      /* verify failed lanes of the column separately */
+      const ed25519_sign_component* sign_r[8];
+      const ed25519_sign_component* sign_s[8];
+      const int8u* msg[8];
+      int32u len[8];
+      const ed25519_public_key* public_key[8];
+
+      int buf_no;
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int k = (fail_mask>>buf_no) & 1;
+         int idx = c0*8 + buf_no;
+         sign_r[buf_no] = k? pa_sign_r[idx] : NULL;
+         sign_s[buf_no] = k? pa_sign_s[idx] : NULL;
+         msg[buf_no] = k? pa_msg[idx] : NULL;
+         len[buf_no] = k? msgLen[idx] : 0;
+         public_key[buf_no] = k? pa_public_key[idx] : NULL;
+      }
+
+      mbx_status sts = MB_FUNC_NAME(mbx_ed25519_verify_)(sign_r, sign_s, msg, len, public_key);
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if((fail_mask>>buf_no) & 1)
+            buf->status[c0] = MBX_SET_STS(buf->status[c0], buf_no, MBX_GET_STS(sts, buf_no));
+      }
+      return;
+   }
+
+   int cm = (c0+c1)/2;
+   __mb_mask fail_lo = ed25519_batch_check(buf, c0, cm) & fail_mask;
+   /* the lanes passed in the first half failed in the second one */
+   __mb_mask fail_hi = fail_mask & ~fail_lo;
+   if(fail_lo)
+      fail_hi |= ed25519_batch_check(buf, cm, c1) & fail_mask & fail_lo;
+
+   if(fail_lo)
+      ed25519_batch_locate(buf, c0, cm, fail_lo, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+   if(fail_hi)
+      ed25519_batch_locate(buf, cm, c1, fail_hi, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+}
+
+DLL_PUBLIC
+mbx_status mbx_ed25519_batch_verify(mbx_status pa_status[],
+                                    const ed25519_sign_component* const pa_sign_r[],
+                                    const ed25519_sign_component* const pa_sign_s[],
+                                    const int8u* const pa_msg[], const int32u msgLen[],
+                                    const ed25519_public_key* const pa_public_key[],
+                                    int num,
+                                    mbx_rand_func rndFunc, void* pRndParam,
+                                    int8u* pBuffer)
+{
+   /* test input pointers */
+   if(NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_public_key)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if(0 >= num)
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   if(NULL == rndFunc)
+      rndFunc = ifma_rdrand_bytes;
+
+   int8u* buffer = pBuffer;
+   #if !defined(NO_USE_MALLOC)
+   int allocated_buf = 0;
+
+   /* check if allocated buffer) */
+   if(NULL==buffer) {
+      buffer = (int8u*)( malloc(mbx_ed25519_batch_verify_BufferSize(num)) );
+      if(NULL==buffer)
+         return MBX_STATUS_NULL_PARAM_ERR;
+      allocated_buf = 1;
+   }
+   #else
+   if(NULL==buffer)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   #endif
+
+   int ncols = NUMBER_OF_DIGITS(num, 8);
+   ed25519_batch_buffer buf;
+   ed25519_batch_layout(&buf, buffer, ncols);
+
+   /* decode signatures */
+   int rnd_ok = 1;
+   int c;
+   for(c=0; c<ncols && rnd_ok; c++) {
+      const ed25519_sign_component* sign_r[8] = { 0 };
+      const ed25519_sign_component* sign_s[8] = { 0 };
+      const int8u* msg[8] = { 0 };
+      int32u len[8] = { 0 };
+      const ed25519_public_key* public_key[8] = { 0 };
+
+      int buf_no;
+      for(buf_no=0; buf_no<8 && (c*8+buf_no)<num; buf_no++) {
+         int idx = c*8 + buf_no;
+         sign_r[buf_no] = pa_sign_r[idx];
+         sign_s[buf_no] = pa_sign_s[idx];
+         msg[buf_no] = pa_msg[idx];
+         len[buf_no] = msgLen[idx];
+         public_key[buf_no] = pa_public_key[idx];
+      }
+
+      rnd_ok = ed25519_batch_decode(buf.pnt+2*c, buf.scalar+2*c, buf.zs[c], &buf.status[c],
+                                    sign_r, sign_s, msg, len, public_key, rndFunc, pRndParam);
+
+      /* lanes out of the batch */
+      for(; buf_no<8; buf_no++)
+         buf.status[c] = MBX_SET_STS(buf.status[c], buf_no, MBX_STATUS_OK);
+   }
+
+   if(rnd_ok) {
+      __mb_mask fail_mask = ed25519_batch_check(&buf, 0, ncols);
+
+      /* find out failed signatures */
+      if(fail_mask) {
+         if(pa_status)
+            ed25519_batch_locate(&buf, 0, ncols, fail_mask, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+         else
+            buf.status[0] |= MBX_SET_STS_BY_MASK(0, fail_mask, MBX_STATUS_SIGNATURE_ERR);
+      }
+   }
+   /* no random multipliers - verify separately */
+   else {
+      for(c=0; c<ncols; c++) {
+         buf.status[c] = MBX_STATUS_OK;
+         __mb_mask lanes = (__mb_mask)((num-c*8 >= 8)? 0xFF : ((1<<(num-c*8))-1));
+         ed25519_batch_locate(&buf, c, c+1, lanes, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+      }
+   }
+
+   /* result */
+   mbx_status status = MBX_STATUS_OK;
+   for(c=0; c<ncols; c++) {
+      int buf_no;
+      for(buf_no=0; buf_no<8; buf_no++)
+         status |= MBX_GET_STS(buf.status[c], buf_no);
+   }
+   if(pa_status && MBX_STATUS_OK!=status) {
+      for(c=0; c<ncols; c++)
+         pa_status[c] = buf.status[c];
+   }
+
+   #if !defined(NO_USE_MALLOC)
+   /* release buffer */
+   if(allocated_buf)
+      free(buffer);
+   #endif
+
+   return status;
+}
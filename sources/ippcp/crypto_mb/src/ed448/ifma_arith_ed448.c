@@ -0,0 +1,347 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ed448/ifma_arith_ed448.h>
+#include <internal/ed448/ifma_arith_n448.h>
+#include <internal/ed448/ifma_ed448_precomp4.h>
+
+/* -d = 39081, multiplication by the plain constant keeps Montgomery domain */
+#define ED448_NEG_D  (39081)
+
+#define fe52_add  MB_FUNC_NAME(ifma_add52_p448_)
+#define fe52_sub  MB_FUNC_NAME(ifma_sub52_p448_)
+#define fe52_neg  MB_FUNC_NAME(ifma_neg52_p448_)
+#define fe52_ladd MB_FUNC_NAME(ifma_ladd52_p448_)
+#define fe52_lsub MB_FUNC_NAME(ifma_lsub52_p448_)
+#define fe52_mulc MB_FUNC_NAME(ifma_mulc52_p448_)
+#define fe52_mul  MB_FUNC_NAME(ifma_amm52_p448_)
+#define fe52_sqr  MB_FUNC_NAME(ifma_ams52_p448_)
+
+/*
+// Point addition and doubling (RFC 8032, 5.2.4).
+// Coordinates of the points are in [0, 2*p448), intermediate sums and differences are not reduced.
+*/
+
+/* r = p + q */
+void ge448_add(ge448_homo_mb* r, const ge448_homo_mb* p, const ge448_homo_mb* q)
+{
+   __ALIGN64 U64 A[P448_LEN52], B[P448_LEN52], C[P448_LEN52], D[P448_LEN52];
+   __ALIGN64 U64 E[P448_LEN52], F[P448_LEN52], G[P448_LEN52], H[P448_LEN52];
+   __ALIGN64 U64 T[P448_LEN52];
+
+   fe52_mul(A, p->Z, q->Z);      /* A = Z1*Z2     */
+   fe52_sqr(B, A);               /* B = A^2       */
+   fe52_mul(C, p->X, q->X);      /* C = X1*X2     */
+   fe52_mul(D, p->Y, q->Y);      /* D = Y1*Y2     */
+   fe52_mul(E, C, D);            /* E = -d*C*D    */
+   fe52_mulc(E, E, ED448_NEG_D);
+   fe52_ladd(F, B, E);           /* F = B-d*C*D   */
+   fe52_lsub(G, B, E);           /* G = B+d*C*D   */
+   fe52_ladd(H, p->X, p->Y);     /* H = (X1+Y1)*(X2+Y2) */
+   fe52_ladd(T, q->X, q->Y);
+   fe52_mul(H, H, T);
+
+   fe52_lsub(H, H, C);           /* X3 = A*F*(H-C-D) */
+   fe52_lsub(H, H, D);
+   fe52_lsub(T, D, C);           /* Y3 = A*G*(D-C)   */
+   fe52_mul(r->Z, F, G);         /* Z3 = F*G         */
+   fe52_mul(F, A, F);
+   fe52_mul(G, A, G);
+   fe52_mul(r->X, F, H);
+   fe52_mul(r->Y, G, T);
+}
+
+/* r = p + q, q is affine point */
+static void ge448_add_precomp(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 qx[], const U64 qy[])
+{
+   __ALIGN64 U64 B[P448_LEN52], C[P448_LEN52], D[P448_LEN52];
+   __ALIGN64 U64 E[P448_LEN52], F[P448_LEN52], G[P448_LEN52], H[P448_LEN52];
+   __ALIGN64 U64 T[P448_LEN52];
+
+   fe52_sqr(B, p->Z);            /* B = Z1^2      */
+   fe52_mul(C, p->X, qx);        /* C = X1*x2     */
+   fe52_mul(D, p->Y, qy);        /* D = Y1*y2     */
+   fe52_mul(E, C, D);            /* E = -d*C*D    */
+   fe52_mulc(E, E, ED448_NEG_D);
+   fe52_ladd(F, B, E);           /* F = B-d*C*D   */
+   fe52_lsub(G, B, E);           /* G = B+d*C*D   */
+   fe52_ladd(H, p->X, p->Y);     /* H = (X1+Y1)*(x2+y2) */
+   fe52_ladd(T, qx, qy);
+   fe52_mul(H, H, T);
+
+   fe52_lsub(H, H, C);           /* X3 = Z1*F*(H-C-D) */
+   fe52_lsub(H, H, D);
+   fe52_lsub(T, D, C);           /* Y3 = Z1*G*(D-C)   */
+   fe52_mul(E, F, G);            /* Z3 = F*G          */
+   fe52_mul(F, p->Z, F);
+   fe52_mul(G, p->Z, G);
+   fe52_mul(r->X, F, H);
+   fe52_mul(r->Y, G, T);
+   MB_FUNC_NAME(mov_FE448_)(r->Z, E);
+}
+
+/* r = [2]*p */
+void ge448_dbl(ge448_homo_mb* r, const ge448_homo_mb* p)
+{
+   __ALIGN64 U64 B[P448_LEN52], C[P448_LEN52], D[P448_LEN52];
+   __ALIGN64 U64 E[P448_LEN52], H[P448_LEN52], J[P448_LEN52];
+
+   fe52_ladd(B, p->X, p->Y);     /* B = (X1+Y1)^2 */
+   fe52_sqr(B, B);
+   fe52_sqr(C, p->X);            /* C = X1^2      */
+   fe52_sqr(D, p->Y);            /* D = Y1^2      */
+   fe52_add(E, C, D);            /* E = C+D       */
+   fe52_sqr(H, p->Z);            /* H = Z1^2      */
+   fe52_lsub(J, E, H);           /* J = E-2*H     */
+   fe52_lsub(J, J, H);
+
+   fe52_lsub(B, B, E);           /* X3 = (B-E)*J  */
+   fe52_lsub(C, C, D);           /* Y3 = E*(C-D)  */
+   fe52_mul(r->X, B, J);
+   fe52_mul(r->Y, E, C);
+   fe52_mul(r->Z, E, J);         /* Z3 = E*J      */
+}
+
+/*
+// Scalar is converted into the signed radix 16 representation:
+//    scalar = sum(digit[i]*16^i), -8 <= digit[i] < 8, digit[N-1] is not converted (scalar < 2^N448_BITSIZE)
+*/
+#define ED448_WIN_SIZE    (4)
+#define ED448_N_DIGITS    NUMBER_OF_DIGITS(N448_LEN64*64, ED448_WIN_SIZE)
+#define ED448_N_ENTRY     (1 << (ED448_WIN_SIZE-1))
+
+static void ed448_scalar_recode(U64 digit[ED448_N_DIGITS], const U64 scalar[])
+{
+   __mb_mask carry = 0;
+   int i = 0;
+
+   for(int n=0; n<N448_LEN64; n++) {
+      U64 scalarV = loadu64(&scalar[n]);
+
+      for(int m=0; m<64/ED448_WIN_SIZE; m++, i++) {
+         U64 q = and64_const(scalarV, 0x0f);
+         scalarV = srli64(scalarV, ED448_WIN_SIZE);
+
+         /* convert half-byte to signed */
+         q = mask_add64(q, carry, q, set1(1));
+         carry = cmp64_mask(set1(8), q, _MM_CMPINT_LE);
+         if((ED448_N_DIGITS-1)==i)
+            carry = 0;  /* avoid sign conversion for the last half-byte*/
+         digit[i] = mask_sub64(q, carry, q, set1(0x10));
+      }
+   }
+}
+
+/* r = table[|digit|-1] or neutral if digit is zero, negated if digit is negative */
+static void ed448_extract_point(ge448_homo_mb* r, const ge448_homo_mb tbl[ED448_N_ENTRY], U64 digit)
+{
+   __mb_mask is_neg = cmp64_mask(digit, get_zero64(), _MM_CMPINT_LT);
+   U64 idx = mask_sub64(digit, is_neg, get_zero64(), digit);
+
+   neutral_ge448_homo_mb(r);
+   for(int j=0; j<ED448_N_ENTRY; j++) {
+      __mb_mask k = cmp64_mask(idx, set1(j+1), _MM_CMPINT_EQ);
+      cmov_ge448_homo_mb(r, r, k, &tbl[j]);
+   }
+
+   __ALIGN64 U64 negX[P448_LEN52];
+   fe52_neg(negX, r->X);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->X, r->X, is_neg, negX);
+}
+
+/* x, y = affine point from the base point table */
+static void ed448_extract_precomputed_basepoint(U64 x[], U64 y[], const ge448_precomp tbl[BP_N_ENTRY], U64 digit)
+{
+   __mb_mask is_neg = cmp64_mask(digit, get_zero64(), _MM_CMPINT_LT);
+   U64 idx = mask_sub64(digit, is_neg, get_zero64(), digit);
+
+   /* neutral (0:1) by default */
+   MB_FUNC_NAME(zero_FE448_)(x);
+   MB_FUNC_NAME(mov_FE448_)(y, MB_FUNC_NAME(ifma_one52_p448_)());
+
+   for(int j=0; j<BP_N_ENTRY; j++) {
+      __mb_mask k = cmp64_mask(idx, set1(j+1), _MM_CMPINT_EQ);
+      for(int l=0; l<P448_LEN52; l++) {
+         x[l] = mask_mov64(x[l], k, set1(tbl[j].x[l]));
+         y[l] = mask_mov64(y[l], k, set1(tbl[j].y[l]));
+      }
+   }
+
+   __ALIGN64 U64 negX[P448_LEN52];
+   fe52_neg(negX, x);
+   MB_FUNC_NAME(mask_mov_FE448_)(x, x, is_neg, negX);
+}
+
+void ifma_ed448_mul_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalar[])
+{
+   __ALIGN64 ge448_homo_mb tbl[ED448_N_ENTRY];
+   __ALIGN64 U64 digit[ED448_N_DIGITS];
+   __ALIGN64 ge448_homo_mb h;
+
+   /* tbl[j] = [j+1]*p */
+   tbl[0] = *p;
+   ge448_dbl(&tbl[1], p);
+   for(int j=2; j<ED448_N_ENTRY; j++)
+      ge448_add(&tbl[j], &tbl[j-1], p);
+
+   ed448_scalar_recode(digit, scalar);
+
+   ed448_extract_point(r, tbl, digit[ED448_N_DIGITS-1]);
+   for(int i=ED448_N_DIGITS-2; i>=0; i--) {
+      ge448_dbl(r, r);
+      ge448_dbl(r, r);
+      ge448_dbl(r, r);
+      ge448_dbl(r, r);
+
+      ed448_extract_point(&h, tbl, digit[i]);
+      ge448_add(r, r, &h);
+   }
+
+   /* clear copy of the scalar */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])digit, sizeof(digit)/sizeof(U64));
+}
+
+void ifma_ed448_mul_basepoint(ge448_homo_mb* r, const U64 scalar[])
+{
+   /* implementation uses scalar representation over base b=16, digit[i] are signed half-bytes */
+   __ALIGN64 ge448_homo_mb r0; /* digit[0]*16^0 + digit[2]*16^2 + ... */
+   __ALIGN64 ge448_homo_mb r1; /* digit[1]*16^1 + digit[3]*16^3 + ... */
+   __ALIGN64 U64 digit[ED448_N_DIGITS];
+
+   /* point extracted from the pre-computed table */
+   __ALIGN64 U64 hx[P448_LEN52];
+   __ALIGN64 U64 hy[P448_LEN52];
+
+   /* inital values are nuetral */
+   neutral_ge448_homo_mb(&r0);
+   neutral_ge448_homo_mb(&r1);
+
+   ed448_scalar_recode(digit, scalar);
+
+   for(int i=0; i<ED448_N_DIGITS; i+=2) {
+      /* pre-computed basepoint table slot: {1,2,..,8} * 16^i * G */
+      const ge448_precomp* tbl = ifma_ed448_bp_precomp[i/2];
+
+      ed448_extract_precomputed_basepoint(hx, hy, tbl, digit[i]);
+      ge448_add_precomp(&r0, &r0, hx, hy);
+
+      ed448_extract_precomputed_basepoint(hx, hy, tbl, digit[i+1]);
+      ge448_add_precomp(&r1, &r1, hx, hy);
+   }
+
+   /* r1 = [16]*r1 */
+   ge448_dbl(&r1, &r1);
+   ge448_dbl(&r1, &r1);
+   ge448_dbl(&r1, &r1);
+   ge448_dbl(&r1, &r1);
+
+   /* r = r0 + r1 */
+   ge448_add(r, &r0, &r1);
+
+   /* clear copy of the scalar */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])digit, sizeof(digit)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u(*)[8])hx, sizeof(hx)/sizeof(U64));
+}
+
+void ifma_ed448_prod_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalarP[], const U64 scalarG[])
+{
+   __ALIGN64 ge448_homo_mb t;
+
+   ifma_ed448_mul_point(r, p, scalarP);
+   ifma_ed448_mul_basepoint(&t, scalarG);
+   ge448_add(r, r, &t);
+}
+
+/*
+// compression and decompression (RFC 8032, 5.2.2 and 5.2.3)
+*/
+
+/* position of the sign of x-coordinate in the most significant digit of compressed point */
+#define GE448_SIGN_BIT  (GE448_COMP_BITSIZE-1 - DIGIT_SIZE*(P448_LEN52-1))
+
+void ge448_homo_compress(U64 r[P448_LEN52], const ge448_homo_mb* p)
+{
+   __ALIGN64 U64 zi[P448_LEN52];
+   __ALIGN64 U64 x[P448_LEN52];
+
+   MB_FUNC_NAME(ifma_aminv52_p448_)(zi, p->Z);
+   fe52_mul(x, p->X, zi);
+   fe52_mul(r, p->Y, zi);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(x, x);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(r, r);
+
+   /* set sign of x-coordinate */
+   r[P448_LEN52-1] = or64(r[P448_LEN52-1], slli64(and64_const(x[0], 1), GE448_SIGN_BIT));
+}
+
+__mb_mask ge448_homo_decompress(ge448_homo_mb* r, const U64 in[P448_LEN52])
+{
+   __ALIGN64 U64 y[P448_LEN52];
+   __ALIGN64 U64 u[P448_LEN52], v[P448_LEN52];
+   __ALIGN64 U64 u2[P448_LEN52], u3[P448_LEN52], v3[P448_LEN52];
+   __ALIGN64 U64 x[P448_LEN52], t[P448_LEN52];
+
+   const U64* one = MB_FUNC_NAME(ifma_one52_p448_)();
+
+   /* sign of x-coordinate and y-coordinate */
+   U64 sign = and64_const(srli64(in[P448_LEN52-1], GE448_SIGN_BIT), 1);
+   __mb_mask x_odd = cmp64_mask(sign, get_zero64(), _MM_CMPINT_NE);
+   MB_FUNC_NAME(mov_FE448_)(y, in);
+   y[P448_LEN52-1] = and64_const(y[P448_LEN52-1], ~((int64u)1 << GE448_SIGN_BIT));
+
+   /* y must be canonical */
+   __mb_mask valid = MB_FUNC_NAME(ifma_cmp_lt_p448_)(y);
+   MB_FUNC_NAME(ifma_tomont52_p448_)(y, y);
+
+   /* u = y^2-1, v = d*y^2-1 */
+   fe52_sqr(t, y);
+   fe52_sub(u, t, one);
+   fe52_mulc(t, t, ED448_NEG_D);
+   fe52_add(t, t, one);
+   fe52_neg(v, t);
+
+   /* x = u^3*v * (u^5*v^3)^((p-3)/4) */
+   fe52_sqr(u2, u);
+   fe52_mul(u3, u2, u);
+   fe52_mul(u2, u3, u2);         /* u^5 */
+   fe52_sqr(v3, v);
+   fe52_mul(v3, v3, v);          /* v^3 */
+   fe52_mul(t, u2, v3);
+   MB_FUNC_NAME(ifma_ampowp34_52_p448_)(t, t);
+   fe52_mul(x, u3, v);
+   fe52_mul(x, x, t);
+
+   /* check v*x^2 == u */
+   fe52_sqr(t, x);
+   fe52_mul(t, t, v);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(t, t);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(u, u);
+   valid &= MB_FUNC_NAME(cmp_eq_FE448_)(t, u);
+
+   /* select root according to the sign, x=0 with odd sign is invalid */
+   MB_FUNC_NAME(ifma_frommont52_p448_)(t, x);
+   valid &= ~(MB_FUNC_NAME(is_zero_FE448_)(t) & x_odd);
+   __mb_mask x_is_odd = cmp64_mask(and64_const(t[0], 1), get_zero64(), _MM_CMPINT_NE);
+   fe52_neg(t, x);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->X, x, x_is_odd ^ x_odd, t);
+   MB_FUNC_NAME(mov_FE448_)(r->Y, y);
+   MB_FUNC_NAME(mov_FE448_)(r->Z, one);
+
+   return valid;
+}
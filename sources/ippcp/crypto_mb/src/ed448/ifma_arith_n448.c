@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/ed448/ifma_arith_n448.h>
+
+/*
+// ED448 prime base point order
+// n = 2^446-13818066809895115352007386748515426880336692474882178609894547503885
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u ed448n_mb[N448_LEN52][sizeof(U64) / sizeof(int64u)] = {
+   { REP8_DECL(0x0008c292ab5844f3) },
+   { REP8_DECL(0x000728dc58f55237) },
+   { REP8_DECL(0x000ed63690216cc2) },
+   { REP8_DECL(0x00023e9c44edb49a) },
+   { REP8_DECL(0x000fffffffff7cca) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000000003fffffff) }
+};
+
+/* mu = floor( 2^(2*DIGIT_SIZE*N448_LEN52)/n) */
+__ALIGN64 static const int64u ed448mu_mb[N448_LEN52+1][sizeof(U64) / sizeof(int64u)] = {
+   { REP8_DECL(0x0000e0d00aa4e7e0) },
+   { REP8_DECL(0x000c873d6d54a7bb) },
+   { REP8_DECL(0x0003d8d723a70aad) },
+   { REP8_DECL(0x00065129c96fde93) },
+   { REP8_DECL(0x00035dc163bb124b) },
+   { REP8_DECL(0x0000000000000083) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000400000) }
+};
+
+__ALIGN64 static const int64u VMASK52[sizeof(U64)/sizeof(int64u)] = {
+   REP8_DECL(DIGIT_MASK)
+};
+
+/* r = x<n? x : x-n, x is normalized */
+static void ifma52_sub_ed448n(U64 r[], const U64 x[])
+{
+   const U64* n = (const U64*)ed448n_mb;
+   U64 t[N448_LEN52];
+   U64 c = get_zero64();
+
+   for(int i=0; i<N448_LEN52; i++) {
+      t[i] = add64(sub64(x[i], n[i]), c);
+      c = srai64(t[i], DIGIT_SIZE);
+      t[i] = and64(t[i], loadu64(VMASK52));
+   }
+
+   /* keep x if x was smaller than n */
+   __mb_mask lt = cmp64_mask(c, get_zero64(), _MM_CMPINT_LT);
+   for(int i=0; i<N448_LEN52; i++)
+      r[i] = mask_mov64(t[i], lt, x[i]);
+}
+
+__mb_mask ifma52_ed448n_cmp_lt(const U64 a[N448_LEN52])
+{
+   const U64* n = (const U64*)ed448n_mb;
+   U64 c = get_zero64();
+
+   for(int i=0; i<N448_LEN52; i++)
+      c = srai64(add64(sub64(a[i], n[i]), c), DIGIT_SIZE);
+
+   return cmp64_mask(c, get_zero64(), _MM_CMPINT_LT);
+}
+
+/*
+// Barrett reduction: r = x mod n
+//    where x and n are (2*k) and (k) digits numbers represented in radix b
+//       b = 2^DIGIT_SIZE, k = ceil(446, DIGIT_SIZE) = 9
+//
+// pre-computed mu = floor(b^(2*k)/n)
+//
+// 1. q1 = floor(x/b^(k-1))
+// 2. q2 = q1*mu
+// 3. q3 = floor(q2/b^(k+1))
+// 4. r1 = x mod b^(k+1)
+// 5. r2 = q3*n mod b^(k+1)
+// 6. r = r1-r2, if r<0 then r+=b^(k+1)
+// 7. if r>n then r -=n  -- at most 2 final reductions
+*/
+void ifma52_ed448n_reduce(U64 r[N448_LEN52], const U64 x[N448_LEN52*2])
+{
+   /* 1. q1 = x/b^(k-1) -- (k+1) most significant digits */
+   const U64* q1 = x + (N448_LEN52-1);
+
+   /* 2-3. q3 = (q1*mu)/b^(k+1), the whole product is computed for simplicity */
+   const U64* mu = (const U64*)ed448mu_mb;
+   U64 q2[2*(N448_LEN52+1)];
+   int i, j;
+
+   for(i=0; i<2*(N448_LEN52+1); i++)
+      q2[i] = get_zero64();
+   for(i=0; i<N448_LEN52+1; i++) {
+      for(j=0; j<N448_LEN52+1; j++) {
+         q2[i+j]   = fma52lo(q2[i+j],   q1[i], mu[j]);
+         q2[i+j+1] = fma52hi(q2[i+j+1], q1[i], mu[j]);
+      }
+   }
+   for(i=0; i<2*(N448_LEN52+1)-1; i++) {
+      q2[i+1] = add64(q2[i+1], srli64(q2[i], DIGIT_SIZE));
+      q2[i] = and64(q2[i], loadu64(VMASK52));
+   }
+   const U64* q3 = q2 + (N448_LEN52+1);
+
+   /* 4. r1 = x mod b^(k+1) is just (k+1) least significant digits of x */
+   const U64* r1 = x;
+
+   /* 5. r2 = (q3*n) mod b^(k+1), the most significant digits of the product are discarded */
+   const U64* n = (const U64*)ed448n_mb;
+   U64 r2[N448_LEN52+1];
+
+   for(i=0; i<N448_LEN52+1; i++)
+      r2[i] = get_zero64();
+   for(i=0; i<N448_LEN52+1; i++) {
+      for(j=0; j<N448_LEN52 && (i+j)<N448_LEN52+1; j++) {
+         r2[i+j] = fma52lo(r2[i+j], q3[i], n[j]);
+         if((i+j+1) < N448_LEN52+1)
+            r2[i+j+1] = fma52hi(r2[i+j+1], q3[i], n[j]);
+      }
+   }
+
+   /* 6. r = (r1-r2) mod b^(k+1), the result is less than 3*n and fits into k digits */
+   U64 t[N448_LEN52+1];
+   U64 c = get_zero64();
+   for(i=0; i<N448_LEN52+1; i++) {
+      t[i] = add64(sub64(r1[i], r2[i]), c);
+      c = srai64(t[i], DIGIT_SIZE);
+      t[i] = and64(t[i], loadu64(VMASK52));
+   }
+
+   /* 7. reduce modulo twice */
+   ifma52_sub_ed448n(r, t);
+   ifma52_sub_ed448n(r, r);
+}
+
+/* r = a*b+c %n */
+void ifma52_ed448n_madd(U64 r[N448_LEN52], const U64 a[N448_LEN52], const U64 b[N448_LEN52], const U64 c[N448_LEN52])
+{
+   U64 t[N448_LEN52*2];
+   int i, j;
+
+   /* (a*b) + c */
+   for(i=0; i<N448_LEN52; i++)
+      t[i] = c[i];
+   for(; i<N448_LEN52*2; i++)
+      t[i] = get_zero64();
+
+   for(i=0; i<N448_LEN52; i++) {
+      for(j=0; j<N448_LEN52; j++) {
+         t[i+j]   = fma52lo(t[i+j],   a[i], b[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], a[i], b[j]);
+      }
+   }
+
+   /* normalize result */
+   for(i=0; i<N448_LEN52*2-1; i++) {
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], loadu64(VMASK52));
+   }
+
+   ifma52_ed448n_reduce(r, t);
+}
@@ -0,0 +1,736 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/ed448/ifma_arith_p448.h>
+
+/* Constants */
+
+/*
+// p448 = 2^448 - 2^224 - 1
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u p448_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000ffffffffeffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00000000ffffffff) }
+};
+
+/* 2*p448 */
+__ALIGN64 static const int64u p448_x2[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000ffffffffffffe) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000ffffffffdffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00000001ffffffff) }
+};
+
+/*
+// Note that
+// k0 = -(1/p448 mod 2^DIGIT_SIZE)  equals 1
+// and all the digits of p448 but p448[4] and p448[8] are (2^DIGIT_SIZE -1).
+// The implementation takes these facts into account
+*/
+
+/* to Montgomery conversion constant
+// rr = 2^((P448_LEN52*DIGIT_SIZE)*2) mod p448
+*/
+__ALIGN64 static const int64u p448_rr_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x0000020000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000030) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+/* 1 in Montgomery domain: 2^(P448_LEN52*DIGIT_SIZE) mod p448 */
+__ALIGN64 static const int64u p448_one_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x0000000000100000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000001000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+__ALIGN64 static const int64u ones[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(1) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) }
+};
+
+static const int64u VMASK52[sizeof(U64)/sizeof(int64u)] = {
+   REP8_DECL(DIGIT_MASK)
+};
+
+#define NORM_LSHIFTR(R, I, J) \
+    R##J = add64(R##J, srli64(R##I, DIGIT_SIZE)); \
+    R##I = and64(R##I, loadu64(VMASK52));
+
+#define NORM_ASHIFTR(R, I, J) \
+    R##J = add64(R##J, srai64(R##I, DIGIT_SIZE)); \
+    R##I = and64(R##I, loadu64(VMASK52));
+
+U64* MB_FUNC_NAME(ifma_one52_p448_)(void)
+{
+   return (U64*)p448_one_mb;
+}
+
+/*=====================================================================
+
+ Specialized operations over p448:  sqr & mul
+
+=====================================================================*/
+
+void MB_FUNC_NAME(ifma_amm52_p448_)(U64 r[], const U64 va[], const U64 vb[])
+{
+   U64 r0, r1, r2, r3, r4, r5, r6, r7, r8;
+   int itr;
+
+   r0 = r1 = r2 = r3 = r4 = r5 = r6 = r7 = r8 = get_zero64();
+
+   for(itr=0; itr < P448_LEN52; itr++) {
+      U64 Yi, T, LO, HI;
+      U64 Bi = loadu64(vb);
+      vb++;
+
+      fma52lo_mem(r0, r0, Bi, va, SIMD_BYTES * 0);
+         Yi = and64(r0, loadu64(VMASK52));   /* k0 = 1 */
+         T = sub64(get_zero64(), Yi);
+         LO = and64(T, loadu64(VMASK52));    /* lo(Yi*(2^52-1)) */
+         HI = add64(Yi, srai64(T,63));       /* hi(Yi*(2^52-1)) */
+      fma52lo_mem(r1, r1, Bi, va, SIMD_BYTES * 1);
+      fma52lo_mem(r2, r2, Bi, va, SIMD_BYTES * 2);
+      fma52lo_mem(r3, r3, Bi, va, SIMD_BYTES * 3);
+      fma52lo_mem(r4, r4, Bi, va, SIMD_BYTES * 4);
+      fma52lo_mem(r5, r5, Bi, va, SIMD_BYTES * 5);
+      fma52lo_mem(r6, r6, Bi, va, SIMD_BYTES * 6);
+      fma52lo_mem(r7, r7, Bi, va, SIMD_BYTES * 7);
+      fma52lo_mem(r8, r8, Bi, va, SIMD_BYTES * 8);
+
+      r0 = add64(r0, LO);     /* fma52lo_mem(r0, r0, Yi, p448_mb, SIMD_BYTES * 0); */
+      r1 = add64(r1, LO);     /* fma52lo_mem(r1, r1, Yi, p448_mb, SIMD_BYTES * 1); */
+         r1 = add64(r1, srli64(r0, DIGIT_SIZE));      /* carry propagation */
+      r2 = add64(r2, LO);     /* fma52lo_mem(r2, r2, Yi, p448_mb, SIMD_BYTES * 2); */
+      r3 = add64(r3, LO);     /* fma52lo_mem(r3, r3, Yi, p448_mb, SIMD_BYTES * 3); */
+      fma52lo_mem(r4, r4, Yi, p448_mb, SIMD_BYTES * 4);
+      r5 = add64(r5, LO);     /* fma52lo_mem(r5, r5, Yi, p448_mb, SIMD_BYTES * 5); */
+      r6 = add64(r6, LO);     /* fma52lo_mem(r6, r6, Yi, p448_mb, SIMD_BYTES * 6); */
+      r7 = add64(r7, LO);     /* fma52lo_mem(r7, r7, Yi, p448_mb, SIMD_BYTES * 7); */
+      fma52lo_mem(r8, r8, Yi, p448_mb, SIMD_BYTES * 8);
+
+      fma52hi_mem(r0, r1, Bi, va, SIMD_BYTES * 0);
+      fma52hi_mem(r1, r2, Bi, va, SIMD_BYTES * 1);
+      fma52hi_mem(r2, r3, Bi, va, SIMD_BYTES * 2);
+      fma52hi_mem(r3, r4, Bi, va, SIMD_BYTES * 3);
+      fma52hi_mem(r4, r5, Bi, va, SIMD_BYTES * 4);
+      fma52hi_mem(r5, r6, Bi, va, SIMD_BYTES * 5);
+      fma52hi_mem(r6, r7, Bi, va, SIMD_BYTES * 6);
+      fma52hi_mem(r7, r8, Bi, va, SIMD_BYTES * 7);
+      fma52hi_mem(r8, get_zero64(), Bi, va, SIMD_BYTES * 8);
+
+      r0 = add64(r0, HI);     /* fma52hi_mem(r0, r0, Yi, p448_mb, SIMD_BYTES * 0); */
+      r1 = add64(r1, HI);     /* fma52hi_mem(r1, r1, Yi, p448_mb, SIMD_BYTES * 1); */
+      r2 = add64(r2, HI);     /* fma52hi_mem(r2, r2, Yi, p448_mb, SIMD_BYTES * 2); */
+      r3 = add64(r3, HI);     /* fma52hi_mem(r3, r3, Yi, p448_mb, SIMD_BYTES * 3); */
+      fma52hi_mem(r4, r4, Yi, p448_mb, SIMD_BYTES * 4);
+      r5 = add64(r5, HI);     /* fma52hi_mem(r5, r5, Yi, p448_mb, SIMD_BYTES * 5); */
+      r6 = add64(r6, HI);     /* fma52hi_mem(r6, r6, Yi, p448_mb, SIMD_BYTES * 6); */
+      r7 = add64(r7, HI);     /* fma52hi_mem(r7, r7, Yi, p448_mb, SIMD_BYTES * 7); */
+      fma52hi_mem(r8, r8, Yi, p448_mb, SIMD_BYTES * 8);
+   }
+
+   // normalization
+   NORM_LSHIFTR(r, 0, 1)
+   NORM_LSHIFTR(r, 1, 2)
+   NORM_LSHIFTR(r, 2, 3)
+   NORM_LSHIFTR(r, 3, 4)
+   NORM_LSHIFTR(r, 4, 5)
+   NORM_LSHIFTR(r, 5, 6)
+   NORM_LSHIFTR(r, 6, 7)
+   NORM_LSHIFTR(r, 7, 8)
+
+   r[0] = r0;
+   r[1] = r1;
+   r[2] = r2;
+   r[3] = r3;
+   r[4] = r4;
+   r[5] = r5;
+   r[6] = r6;
+   r[7] = r7;
+   r[8] = r8;
+}
+
+#define ROUND_MUL(I, J, R_LO, R_HI) \
+    R_LO = fma52lo(R_LO, va[I], va[J]); \
+    R_HI = fma52hi(R_HI, va[I], va[J]);
+
+/* (2^52-1) limbs of the modulus are processed by LO/HI trick, limbs 4 and 8 are multiplied */
+#define P448_REDUCTION_ROUND(u, r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, modulus) \
+{  \
+   U64 t = sub64(get_zero64(), u); \
+   U64 lo = and64(t, loadu64(VMASK52)); \
+   U64 hi = add64(u, srai64(t,63)); \
+   \
+   r0 = add64(r0, lo); /*r0 = fma52lo(r0, u, modulus[0]); */ \
+   r1 = add64(r1, lo); /*r1 = fma52lo(r1, u, modulus[1]); */ \
+   r2 = add64(r2, lo); /*r2 = fma52lo(r2, u, modulus[2]); */ \
+   r3 = add64(r3, lo); /*r3 = fma52lo(r3, u, modulus[3]); */ \
+   r4 = fma52lo(r4, u, modulus[4]); \
+   r5 = add64(r5, lo); /*r5 = fma52lo(r5, u, modulus[5]); */ \
+   r6 = add64(r6, lo); /*r6 = fma52lo(r6, u, modulus[6]); */ \
+   r7 = add64(r7, lo); /*r7 = fma52lo(r7, u, modulus[7]); */ \
+   r8 = fma52lo(r8, u, modulus[8]); \
+   \
+      r1 = add64(r1, srli64(r0, DIGIT_SIZE)); /* carry propagation */ \
+   \
+   r1 = add64(r1, hi); /*r1 = fma52hi(r1, u, modulus[0]); */ \
+   r2 = add64(r2, hi); /*r2 = fma52hi(r2, u, modulus[1]); */ \
+   r3 = add64(r3, hi); /*r3 = fma52hi(r3, u, modulus[2]); */ \
+   r4 = add64(r4, hi); /*r4 = fma52hi(r4, u, modulus[3]); */ \
+   r5 = fma52hi(r5, u, modulus[4]); \
+   r6 = add64(r6, hi); /*r6 = fma52hi(r6, u, modulus[5]); */ \
+   r7 = add64(r7, hi); /*r7 = fma52hi(r7, u, modulus[6]); */ \
+   r8 = add64(r8, hi); /*r8 = fma52hi(r8, u, modulus[7]); */ \
+   r9 = fma52hi(r9, u, modulus[8]); \
+      u = and64(r1, loadu64(VMASK52)); /* update u = r1*k, k = 1 */ \
+}
+
+void MB_FUNC_NAME(ifma_ams52_p448_)(U64 r[], const U64 va[])
+{
+   U64* modulus = (U64*)p448_mb;
+
+   U64 r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17;
+   r0 = r1 = r2 = r3 = r4 = r5 = r6 = r7 = r8 = r9 =
+   r10 = r11 = r12 = r13 = r14 = r15 = r16 = r17 = get_zero64();
+
+   // full square
+   ROUND_MUL(0, 1, r1, r2)
+   ROUND_MUL(0, 2, r2, r3)
+   ROUND_MUL(0, 3, r3, r4)
+   ROUND_MUL(0, 4, r4, r5)
+   ROUND_MUL(0, 5, r5, r6)
+   ROUND_MUL(0, 6, r6, r7)
+   ROUND_MUL(0, 7, r7, r8)
+   ROUND_MUL(0, 8, r8, r9)
+
+   ROUND_MUL(1, 2, r3, r4)
+   ROUND_MUL(1, 3, r4, r5)
+   ROUND_MUL(1, 4, r5, r6)
+   ROUND_MUL(1, 5, r6, r7)
+   ROUND_MUL(1, 6, r7, r8)
+   ROUND_MUL(1, 7, r8, r9)
+   ROUND_MUL(1, 8, r9, r10)
+
+   ROUND_MUL(2, 3, r5, r6)
+   ROUND_MUL(2, 4, r6, r7)
+   ROUND_MUL(2, 5, r7, r8)
+   ROUND_MUL(2, 6, r8, r9)
+   ROUND_MUL(2, 7, r9, r10)
+   ROUND_MUL(2, 8, r10, r11)
+
+   ROUND_MUL(3, 4, r7, r8)
+   ROUND_MUL(3, 5, r8, r9)
+   ROUND_MUL(3, 6, r9, r10)
+   ROUND_MUL(3, 7, r10, r11)
+   ROUND_MUL(3, 8, r11, r12)
+
+   ROUND_MUL(4, 5, r9, r10)
+   ROUND_MUL(4, 6, r10, r11)
+   ROUND_MUL(4, 7, r11, r12)
+   ROUND_MUL(4, 8, r12, r13)
+
+   ROUND_MUL(5, 6, r11, r12)
+   ROUND_MUL(5, 7, r12, r13)
+   ROUND_MUL(5, 8, r13, r14)
+
+   ROUND_MUL(6, 7, r13, r14)
+   ROUND_MUL(6, 8, r14, r15)
+
+   ROUND_MUL(7, 8, r15, r16)
+
+   r1  = add64(r1, r1);
+   r2  = add64(r2, r2);
+   r3  = add64(r3, r3);
+   r4  = add64(r4, r4);
+   r5  = add64(r5, r5);
+   r6  = add64(r6, r6);
+   r7  = add64(r7, r7);
+   r8  = add64(r8, r8);
+   r9  = add64(r9, r9);
+   r10 = add64(r10, r10);
+   r11 = add64(r11, r11);
+   r12 = add64(r12, r12);
+   r13 = add64(r13, r13);
+   r14 = add64(r14, r14);
+   r15 = add64(r15, r15);
+   r16 = add64(r16, r16);
+
+   U64 u;
+   ROUND_MUL(0, 0, r0, r1)
+   u = and64(r0, loadu64(VMASK52)); /* k0 = 1 */
+   ROUND_MUL(1, 1, r2, r3)
+   ROUND_MUL(2, 2, r4, r5)
+   ROUND_MUL(3, 3, r6, r7)
+   ROUND_MUL(4, 4, r8, r9)
+   ROUND_MUL(5, 5, r10, r11)
+   ROUND_MUL(6, 6, r12, r13)
+   ROUND_MUL(7, 7, r14, r15)
+   ROUND_MUL(8, 8, r16, r17)
+
+   // reduction
+   P448_REDUCTION_ROUND(u, r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, modulus);
+   P448_REDUCTION_ROUND(u, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, modulus);
+   P448_REDUCTION_ROUND(u, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, modulus);
+   P448_REDUCTION_ROUND(u, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, modulus);
+   P448_REDUCTION_ROUND(u, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, modulus);
+   P448_REDUCTION_ROUND(u, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, modulus);
+   P448_REDUCTION_ROUND(u, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, modulus);
+   P448_REDUCTION_ROUND(u, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, modulus);
+   P448_REDUCTION_ROUND(u, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, modulus);
+
+   // normalization
+   NORM_LSHIFTR(r, 9, 10)
+   NORM_LSHIFTR(r, 10, 11)
+   NORM_LSHIFTR(r, 11, 12)
+   NORM_LSHIFTR(r, 12, 13)
+   NORM_LSHIFTR(r, 13, 14)
+   NORM_LSHIFTR(r, 14, 15)
+   NORM_LSHIFTR(r, 15, 16)
+   NORM_LSHIFTR(r, 16, 17)
+
+   r[0] = r9;
+   r[1] = r10;
+   r[2] = r11;
+   r[3] = r12;
+   r[4] = r13;
+   r[5] = r14;
+   r[6] = r15;
+   r[7] = r16;
+   r[8] = r17;
+}
+
+/* R = A<M? A : A-M, A is normalized */
+__INLINE void MB_FUNC_NAME(cond_sub52_p448_)(U64 R[], const U64 A[], const U64 M[])
+{
+   U64 r0 = sub64(A[0], M[0]);
+   U64 r1 = sub64(A[1], M[1]);
+   U64 r2 = sub64(A[2], M[2]);
+   U64 r3 = sub64(A[3], M[3]);
+   U64 r4 = sub64(A[4], M[4]);
+   U64 r5 = sub64(A[5], M[5]);
+   U64 r6 = sub64(A[6], M[6]);
+   U64 r7 = sub64(A[7], M[7]);
+   U64 r8 = sub64(A[8], M[8]);
+
+   /* normalize r0 - r8 */
+   NORM_ASHIFTR(r, 0, 1)
+   NORM_ASHIFTR(r, 1, 2)
+   NORM_ASHIFTR(r, 2, 3)
+   NORM_ASHIFTR(r, 3, 4)
+   NORM_ASHIFTR(r, 4, 5)
+   NORM_ASHIFTR(r, 5, 6)
+   NORM_ASHIFTR(r, 6, 7)
+   NORM_ASHIFTR(r, 7, 8)
+
+   /* r = a<m? a : r */
+   __mb_mask lt = cmp64_mask(r8, get_zero64(), _MM_CMPINT_LT);
+   R[0] = mask_mov64(r0, lt, A[0]);
+   R[1] = mask_mov64(r1, lt, A[1]);
+   R[2] = mask_mov64(r2, lt, A[2]);
+   R[3] = mask_mov64(r3, lt, A[3]);
+   R[4] = mask_mov64(r4, lt, A[4]);
+   R[5] = mask_mov64(r5, lt, A[5]);
+   R[6] = mask_mov64(r6, lt, A[6]);
+   R[7] = mask_mov64(r7, lt, A[7]);
+   R[8] = mask_mov64(r8, lt, A[8]);
+}
+
+void MB_FUNC_NAME(ifma_tomont52_p448_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_p448_)(r, a, (U64*)p448_rr_mb);
+}
+
+void MB_FUNC_NAME(ifma_frommont52_p448_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_p448_)(r, a, (U64*)ones);
+   MB_FUNC_NAME(cond_sub52_p448_)(r, r, (U64*)p448_mb);
+}
+
+#define fe52_sqr  MB_FUNC_NAME(ifma_ams52_p448_)
+#define fe52_mul  MB_FUNC_NAME(ifma_amm52_p448_)
+
+/* r = base^(2^n) */
+__INLINE void fe52_sqr_pwr(U64 r[], const U64 base[], int n)
+{
+   if(r!=base)
+      MB_FUNC_NAME(mov_FE448_)(r, base);
+   for(; n>0; n--)
+      fe52_sqr(r,r);
+}
+
+/*
+// computes z^(2^222 -1) and z^(2^223 -1)
+// the powers are common parts of 1/z and z^((p448-3)/4)
+*/
+static void fe52_pow_2_223(U64 e222[], U64 e223[], const U64 z[])
+{
+   __ALIGN64 U64 e3[P448_LEN52];
+   __ALIGN64 U64 e6[P448_LEN52];
+   __ALIGN64 U64 e24[P448_LEN52];
+   __ALIGN64 U64 t[P448_LEN52];
+
+   /* ek = z^(2^k -1) */
+   fe52_sqr(t, z);
+   fe52_mul(t, t, z);            /* t  = z^(2^2 -1) */
+   fe52_sqr(t, t);
+   fe52_mul(e3, t, z);           /* e3 = z^(2^3 -1) */
+   fe52_sqr_pwr(t, e3, 3);
+   fe52_mul(e6, t, e3);          /* e6 = z^(2^6 -1) */
+   fe52_sqr_pwr(t, e6, 6);
+   fe52_mul(t, t, e6);           /* t  = z^(2^12 -1) */
+   fe52_sqr_pwr(e24, t, 12);
+   fe52_mul(e24, e24, t);        /* e24 = z^(2^24 -1) */
+   fe52_sqr_pwr(t, e24, 24);
+   fe52_mul(t, t, e24);          /* t  = z^(2^48 -1) */
+   fe52_sqr_pwr(e222, t, 48);
+   fe52_mul(t, e222, t);         /* t  = z^(2^96 -1) */
+   fe52_sqr_pwr(e222, t, 96);
+   fe52_mul(t, e222, t);         /* t  = z^(2^192 -1) */
+   fe52_sqr_pwr(t, t, 24);
+   fe52_mul(t, t, e24);          /* t  = z^(2^216 -1) */
+   fe52_sqr_pwr(t, t, 6);
+   fe52_mul(e222, t, e6);        /* e222 = z^(2^222 -1) */
+   fe52_sqr(t, e222);
+   fe52_mul(e223, t, z);         /* e223 = z^(2^223 -1) */
+}
+
+/*
+// computes r = 1/z = z^(p448-2) mod p448
+//    p448-2 = (2^223 -1)*2^225 + (2^222 -1)*2^2 + 1
+//
+// note: z in in Montgomery domain (as soon mul() and sqr() below are amm-functions
+//       r in Montgomery domain too
+*/
+void MB_FUNC_NAME(ifma_aminv52_p448_)(U64 r[], const U64 z[])
+{
+   __ALIGN64 U64 e222[P448_LEN52];
+   __ALIGN64 U64 e223[P448_LEN52];
+
+   fe52_pow_2_223(e222, e223, z);
+
+   fe52_sqr_pwr(e222, e222, 2);
+   fe52_mul(e222, e222, z);
+   fe52_sqr_pwr(e223, e223, 225);
+   fe52_mul(r, e223, e222);
+}
+
+/*
+// computes r = z^((p448-3)/4) mod p448, used by square root computation
+//    (p448-3)/4 = (2^223 -1)*2^223 + (2^222 -1)
+*/
+void MB_FUNC_NAME(ifma_ampowp34_52_p448_)(U64 r[], const U64 z[])
+{
+   __ALIGN64 U64 e222[P448_LEN52];
+   __ALIGN64 U64 e223[P448_LEN52];
+
+   fe52_pow_2_223(e222, e223, z);
+
+   fe52_sqr_pwr(e223, e223, 223);
+   fe52_mul(r, e223, e222);
+}
+
+/*=====================================================================
+
+ Specialized single operations over p448:  add, sub, neg
+
+=====================================================================*/
+
+void MB_FUNC_NAME(ifma_add52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   /* r = a + b */
+   U64 r0 = add64(A[0], B[0]);
+   U64 r1 = add64(A[1], B[1]);
+   U64 r2 = add64(A[2], B[2]);
+   U64 r3 = add64(A[3], B[3]);
+   U64 r4 = add64(A[4], B[4]);
+   U64 r5 = add64(A[5], B[5]);
+   U64 r6 = add64(A[6], B[6]);
+   U64 r7 = add64(A[7], B[7]);
+   U64 r8 = add64(A[8], B[8]);
+
+   /* normalize r0 - r8 */
+   NORM_LSHIFTR(r, 0, 1)
+   NORM_LSHIFTR(r, 1, 2)
+   NORM_LSHIFTR(r, 2, 3)
+   NORM_LSHIFTR(r, 3, 4)
+   NORM_LSHIFTR(r, 4, 5)
+   NORM_LSHIFTR(r, 5, 6)
+   NORM_LSHIFTR(r, 6, 7)
+   NORM_LSHIFTR(r, 7, 8)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+   R[5] = r5;
+   R[6] = r6;
+   R[7] = r7;
+   R[8] = r8;
+
+   /* r = r<2*p? r : r-2*p */
+   MB_FUNC_NAME(cond_sub52_p448_)(R, R, (U64*)p448_x2);
+}
+
+void MB_FUNC_NAME(ifma_sub52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   /* r = a - b */
+   U64 r0 = sub64(A[0], B[0]);
+   U64 r1 = sub64(A[1], B[1]);
+   U64 r2 = sub64(A[2], B[2]);
+   U64 r3 = sub64(A[3], B[3]);
+   U64 r4 = sub64(A[4], B[4]);
+   U64 r5 = sub64(A[5], B[5]);
+   U64 r6 = sub64(A[6], B[6]);
+   U64 r7 = sub64(A[7], B[7]);
+   U64 r8 = sub64(A[8], B[8]);
+
+   /* normalize r0 - r8 */
+   NORM_ASHIFTR(r, 0, 1)
+   NORM_ASHIFTR(r, 1, 2)
+   NORM_ASHIFTR(r, 2, 3)
+   NORM_ASHIFTR(r, 3, 4)
+   NORM_ASHIFTR(r, 4, 5)
+   NORM_ASHIFTR(r, 5, 6)
+   NORM_ASHIFTR(r, 6, 7)
+   NORM_ASHIFTR(r, 7, 8)
+
+   /* r = r<0? r+2*p : r */
+   __mb_mask lt = cmp64_mask(r8, get_zero64(), _MM_CMPINT_LT);
+   r0 = mask_add64(r0, lt, r0, ((U64*)(p448_x2))[0]);
+   r1 = mask_add64(r1, lt, r1, ((U64*)(p448_x2))[1]);
+   r2 = mask_add64(r2, lt, r2, ((U64*)(p448_x2))[2]);
+   r3 = mask_add64(r3, lt, r3, ((U64*)(p448_x2))[3]);
+   r4 = mask_add64(r4, lt, r4, ((U64*)(p448_x2))[4]);
+   r5 = mask_add64(r5, lt, r5, ((U64*)(p448_x2))[5]);
+   r6 = mask_add64(r6, lt, r6, ((U64*)(p448_x2))[6]);
+   r7 = mask_add64(r7, lt, r7, ((U64*)(p448_x2))[7]);
+   r8 = mask_add64(r8, lt, r8, ((U64*)(p448_x2))[8]);
+
+   /* normalize r0 - r8 */
+   NORM_ASHIFTR(r, 0, 1)
+   NORM_ASHIFTR(r, 1, 2)
+   NORM_ASHIFTR(r, 2, 3)
+   NORM_ASHIFTR(r, 3, 4)
+   NORM_ASHIFTR(r, 4, 5)
+   NORM_ASHIFTR(r, 5, 6)
+   NORM_ASHIFTR(r, 6, 7)
+   NORM_ASHIFTR(r, 7, 8)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+   R[5] = r5;
+   R[6] = r6;
+   R[7] = r7;
+   R[8] = r8;
+}
+
+void MB_FUNC_NAME(ifma_neg52_p448_)(U64 R[], const U64 A[])
+{
+   __ALIGN64 U64 zero[P448_LEN52];
+   MB_FUNC_NAME(zero_FE448_)(zero);
+   MB_FUNC_NAME(ifma_sub52_p448_)(R, zero, A);
+}
+
+/*
+// Lazy add and sub: the result is normalized but not reduced,
+// it stays in the range acceptable by ifma_amm52_p448_() and ifma_ams52_p448_() as long as
+// both operands of the add and the minuend of the sub are below 4*p448
+*/
+void MB_FUNC_NAME(ifma_ladd52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   /* r = a + b */
+   U64 r0 = add64(A[0], B[0]);
+   U64 r1 = add64(A[1], B[1]);
+   U64 r2 = add64(A[2], B[2]);
+   U64 r3 = add64(A[3], B[3]);
+   U64 r4 = add64(A[4], B[4]);
+   U64 r5 = add64(A[5], B[5]);
+   U64 r6 = add64(A[6], B[6]);
+   U64 r7 = add64(A[7], B[7]);
+   U64 r8 = add64(A[8], B[8]);
+
+   /* normalize r0 - r8 */
+   NORM_LSHIFTR(r, 0, 1)
+   NORM_LSHIFTR(r, 1, 2)
+   NORM_LSHIFTR(r, 2, 3)
+   NORM_LSHIFTR(r, 3, 4)
+   NORM_LSHIFTR(r, 4, 5)
+   NORM_LSHIFTR(r, 5, 6)
+   NORM_LSHIFTR(r, 6, 7)
+   NORM_LSHIFTR(r, 7, 8)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+   R[5] = r5;
+   R[6] = r6;
+   R[7] = r7;
+   R[8] = r8;
+}
+
+/* r = a - b + 2*p448, b is expected to be in [0, 2*p448) */
+void MB_FUNC_NAME(ifma_lsub52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   /* r = a + 2*p - b */
+   U64 r0 = sub64(add64(A[0], ((U64*)(p448_x2))[0]), B[0]);
+   U64 r1 = sub64(add64(A[1], ((U64*)(p448_x2))[1]), B[1]);
+   U64 r2 = sub64(add64(A[2], ((U64*)(p448_x2))[2]), B[2]);
+   U64 r3 = sub64(add64(A[3], ((U64*)(p448_x2))[3]), B[3]);
+   U64 r4 = sub64(add64(A[4], ((U64*)(p448_x2))[4]), B[4]);
+   U64 r5 = sub64(add64(A[5], ((U64*)(p448_x2))[5]), B[5]);
+   U64 r6 = sub64(add64(A[6], ((U64*)(p448_x2))[6]), B[6]);
+   U64 r7 = sub64(add64(A[7], ((U64*)(p448_x2))[7]), B[7]);
+   U64 r8 = sub64(add64(A[8], ((U64*)(p448_x2))[8]), B[8]);
+
+   /* normalize r0 - r8 */
+   NORM_ASHIFTR(r, 0, 1)
+   NORM_ASHIFTR(r, 1, 2)
+   NORM_ASHIFTR(r, 2, 3)
+   NORM_ASHIFTR(r, 3, 4)
+   NORM_ASHIFTR(r, 4, 5)
+   NORM_ASHIFTR(r, 5, 6)
+   NORM_ASHIFTR(r, 6, 7)
+   NORM_ASHIFTR(r, 7, 8)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+   R[5] = r5;
+   R[6] = r6;
+   R[7] = r7;
+   R[8] = r8;
+}
+
+/*
+// r = a*c for the small constant c < 2^20 and a < 4*p448, result is in [0, 2*p448).
+// Multiplication by a plain (not Montgomery) constant keeps the domain of a.
+*/
+void MB_FUNC_NAME(ifma_mulc52_p448_)(U64 R[], const U64 A[], int64u c)
+{
+   U64 C = set64((long long)c);
+   U64 r0, r1, r2, r3, r4, r5, r6, r7, r8, r9;
+
+   r0 = fma52lo(get_zero64(), A[0], C);
+   r1 = fma52lo(get_zero64(), A[1], C);
+   r2 = fma52lo(get_zero64(), A[2], C);
+   r3 = fma52lo(get_zero64(), A[3], C);
+   r4 = fma52lo(get_zero64(), A[4], C);
+   r5 = fma52lo(get_zero64(), A[5], C);
+   r6 = fma52lo(get_zero64(), A[6], C);
+   r7 = fma52lo(get_zero64(), A[7], C);
+   r8 = fma52lo(get_zero64(), A[8], C);
+
+   r1 = fma52hi(r1, A[0], C);
+   r2 = fma52hi(r2, A[1], C);
+   r3 = fma52hi(r3, A[2], C);
+   r4 = fma52hi(r4, A[3], C);
+   r5 = fma52hi(r5, A[4], C);
+   r6 = fma52hi(r6, A[5], C);
+   r7 = fma52hi(r7, A[6], C);
+   r8 = fma52hi(r8, A[7], C);
+   r9 = fma52hi(get_zero64(), A[8], C);
+
+   /* normalize r0 - r9 */
+   NORM_LSHIFTR(r, 0, 1)
+   NORM_LSHIFTR(r, 1, 2)
+   NORM_LSHIFTR(r, 2, 3)
+   NORM_LSHIFTR(r, 3, 4)
+   NORM_LSHIFTR(r, 4, 5)
+   NORM_LSHIFTR(r, 5, 6)
+   NORM_LSHIFTR(r, 6, 7)
+   NORM_LSHIFTR(r, 7, 8)
+   NORM_LSHIFTR(r, 8, 9)
+
+   /* fold bits above 2^448: h*2^448 = h*2^224 + h (mod p448), h < 2^24 */
+   U64 h = or64(srli64(r8, 32), slli64(r9, DIGIT_SIZE-32));
+   r8 = and64_const(r8, 0xffffffff);
+   r0 = add64(r0, h);
+   r4 = add64(r4, slli64(h, 224-4*DIGIT_SIZE));
+
+   /* normalize r0 - r8 */
+   NORM_LSHIFTR(r, 0, 1)
+   NORM_LSHIFTR(r, 1, 2)
+   NORM_LSHIFTR(r, 2, 3)
+   NORM_LSHIFTR(r, 3, 4)
+   NORM_LSHIFTR(r, 4, 5)
+   NORM_LSHIFTR(r, 5, 6)
+   NORM_LSHIFTR(r, 6, 7)
+   NORM_LSHIFTR(r, 7, 8)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+   R[5] = r5;
+   R[6] = r6;
+   R[7] = r7;
+   R[8] = r8;
+}
+
+/* a<p448 mask, a is normalized */
+__mb_mask MB_FUNC_NAME(ifma_cmp_lt_p448_)(const U64 a[])
+{
+   U64 r8 = get_zero64();
+   U64 c = get_zero64();
+   for(int i=0; i<P448_LEN52; i++) {
+      r8 = add64(sub64(a[i], ((U64*)(p448_mb))[i]), c);
+      c = srai64(r8, DIGIT_SIZE);
+   }
+   return cmp64_mask(r8, get_zero64(), _MM_CMPINT_LT);
+}
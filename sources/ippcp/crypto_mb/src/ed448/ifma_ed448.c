@@ -0,0 +1,413 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#include <crypto_mb/ed448.h>
+#include <internal/ed448/ifma_arith_ed448.h>
+#include <internal/ed448/ifma_arith_p448.h>
+#include <internal/ed448/ifma_arith_n448.h>
+#include <internal/sha/sha3_mb8.h>
+
+/* length of SHAKE256 output in bits and bytes (RFC 8032, 5.2) */
+#define HASH_LENGTH            (2*sizeof(ed448_private_key))
+#define HASH_BITLENGTH         (HASH_LENGTH*8)
+
+/* length of compressed point and signature component in bytes */
+#define COMP_LENGTH            NUMBER_OF_DIGITS(GE448_COMP_BITSIZE, 8)
+
+/* buffer for the values of COMP_LENGTH bytes converted from mb8 (output is multiple of 64 bits) */
+#define COMP_BUFF_LENGTH       (NUMBER_OF_DIGITS(GE448_COMP_BITSIZE, 64)*sizeof(int64u))
+
+/*
+// dom4(0, "") = "SigEd448" || octet(0) || octet(0)
+// prefixes all hash inputs of Ed448 with empty context (RFC 8032, 5.2)
+*/
+#define ED448_DOM4_LEN  (10)
+static const int8u ed448_dom4[ED448_DOM4_LEN] = { 'S','i','g','E','d','4','4','8', 0x00, 0x00 };
+static const int8u* const ed448_pa_dom4[8] = { REP8_DECL(ed448_dom4) };
+static const int ed448_dom4_len[8] = { REP8_DECL(ED448_DOM4_LEN) };
+
+static void ed448_expand_key(int8u* pa_secret_expand[8], const ed448_private_key* const pa_secret_key[8])
+{
+   __ALIGN64 shake256_state_mb8 ctx;
+   const int8u* pa_secret[8];
+   int8u* pa_hash[8];
+   int len[8];
+
+   for (int n = 0; n < 8; n++) {
+      pa_secret[n] = (const int8u*)pa_secret_key[n];
+      pa_hash[n] = pa_secret_key[n] ? pa_secret_expand[n] : NULL;
+      len[n] = pa_secret_key[n] ? (int)sizeof(ed448_private_key) : 0;
+   }
+
+   /* do hash of secret keys in all lanes at once */
+   shake256_init_mb8(&ctx);
+   shake256_update_mb8(pa_secret, len, &ctx);
+   shake256_final_mb8(pa_hash, HASH_LENGTH, &ctx);
+
+   for (int n = 0; n < 8; n++) {
+      if (pa_hash[n]) {
+         /* prune the buffer according to RFC8032 */
+         pa_secret_expand[n][0]  &= 0xfc;
+         pa_secret_expand[n][55] |= 0x80;
+         pa_secret_expand[n][56]  = 0;
+      }
+   }
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])&ctx, sizeof(ctx)/sizeof(U64));
+}
+
+/* convert scalar 2^52 radix => 2^64 radix */
+static void ed448_scalar52_to_64(U64 out[N448_LEN64], const U64 in[N448_LEN52])
+{
+   __ALIGN64 int64u buf[8][N448_LEN64];
+   int64u* pa_buf[8] = { buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], buf[7] };
+
+   ifma_mb8_to_BNU(pa_buf, (const int64u(*)[8])in, N448_BITSIZE);
+   ifma_BNU_transpose_copy((int64u(*)[8])out, (const int64u**)pa_buf, N448_BITSIZE);
+
+   MB_FUNC_NAME(zero_)((int64u(*)[8])buf, sizeof(buf)/sizeof(U64));
+}
+
+/* store compressed point or signature component into the non-NULL lanes of pa_out */
+static void ed448_store_comp(int8u* const pa_out[8], const U64 in[P448_LEN52])
+{
+   __ALIGN64 int8u buf[8][COMP_BUFF_LENGTH];
+   int64u* pa_buf[8] = {
+      (int64u*)buf[0], (int64u*)buf[1], (int64u*)buf[2], (int64u*)buf[3],
+      (int64u*)buf[4], (int64u*)buf[5], (int64u*)buf[6], (int64u*)buf[7]
+   };
+
+   ifma_mb8_to_BNU(pa_buf, (const int64u(*)[8])in, GE448_COMP_BITSIZE);
+
+   for (int n = 0; n < 8; n++) {
+      if (pa_out[n]) {
+         for (int i = 0; i < COMP_LENGTH; i++)
+            pa_out[n][i] = buf[n][i];
+      }
+   }
+}
+
+/*
+// r = SHAKE256(dom4 || pa_x || pa_y || msg, 114) mod n
+// pa_x[] are COMP_LENGTH bytes each, pa_y[] are y_len bytes each or pa_y is NULL
+*/
+static void ed448_hash_mod_n(U64 r[N448_LEN52],
+                             const int8u* const pa_x[8], const int8u* const pa_y[8], int y_len,
+                             const int8u* const pa_msg[8], const int32u msgLen[8])
+{
+   __ALIGN64 shake256_state_mb8 ctx;
+   __ALIGN64 int8u hash[8][HASH_LENGTH];
+   int8u* pa_hash[8] = { hash[0], hash[1], hash[2], hash[3], hash[4], hash[5], hash[6], hash[7] };
+   int x_len[8];
+   int y_lens[8];
+   int msg_len[8];
+
+   for (int n = 0; n < 8; n++) {
+      x_len[n] = pa_x[n] ? COMP_LENGTH : 0;
+      y_lens[n] = (pa_y && pa_y[n]) ? y_len : 0;
+      msg_len[n] = pa_msg[n] ? (int)msgLen[n] : 0;
+   }
+
+   shake256_init_mb8(&ctx);
+   shake256_update_mb8(ed448_pa_dom4, ed448_dom4_len, &ctx);
+   shake256_update_mb8(pa_x, x_len, &ctx);
+   if (pa_y)
+      shake256_update_mb8(pa_y, y_lens, &ctx);
+   shake256_update_mb8(pa_msg, msg_len, &ctx);
+   shake256_final_mb8(pa_hash, HASH_LENGTH, &ctx);
+
+   /* reduce hash wrt n */
+   __ALIGN64 U64 hash_mb[N448_LEN52*2];
+   ifma_BNU_to_mb8((int64u(*)[8])hash_mb, (const int64u**)pa_hash, HASH_BITLENGTH);
+   ifma52_ed448n_reduce(r, hash_mb);
+
+   /* clear the hash, it could depend on the secret prefix */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])&ctx, sizeof(ctx)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u(*)[8])hash, sizeof(hash)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u(*)[8])hash_mb, sizeof(hash_mb)/sizeof(U64));
+}
+
+/* s = az mod n (the secret scalar is 448-bit number), 2^64 radix */
+static void ed448_secret_scalar(U64 s64[N448_LEN64], const U64 az[P448_LEN52])
+{
+   __ALIGN64 U64 t[N448_LEN52*2];
+   __ALIGN64 U64 s[N448_LEN52];
+   int i;
+
+   for (i = 0; i < N448_LEN52; i++)
+      t[i] = az[i];
+   for (; i < N448_LEN52*2; i++)
+      t[i] = get_zero64();
+   ifma52_ed448n_reduce(s, t);
+   ed448_scalar52_to_64(s64, s);
+
+   MB_FUNC_NAME(zero_)((int64u(*)[8])t, sizeof(t)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u(*)[8])s, sizeof(s)/sizeof(U64));
+}
+
+/*
+// Computes public key
+// pa_public_key[]   array of pointers to the computed public keys
+// pa_private_key[]  array of pointers to the private keys
+*/
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed448_public_key_)(ed448_public_key* pa_public_key[8],
+                                         const ed448_private_key* const pa_private_key[8])
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test input pointers */
+   if (NULL == pa_private_key || NULL == pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   int buf_no;
+   for (buf_no = 0; buf_no < 8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if (NULL == pa_private_key[buf_no] || NULL == pa_public_key[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      __ALIGN64 int8u az[8][HASH_LENGTH] = { 0 };
+      int8u* pa_az[8] = { az[0], az[1], az[2], az[3], az[4], az[5], az[6], az[7] };
+
+      /* expand secret keys */
+      ed448_expand_key(pa_az, pa_private_key);
+
+      /* convert into mb format */
+      __ALIGN64 U64 az_mb[P448_LEN52];
+      __ALIGN64 U64 scalar[N448_LEN64];
+      ifma_BNU_to_mb8((int64u(*)[8])az_mb, (const int64u**)pa_az, P448_BITSIZE);
+      ed448_secret_scalar(scalar, az_mb);
+
+      /* r = [scalar]*G */
+      __ALIGN64 ge448_homo_mb r;
+      ifma_ed448_mul_basepoint(&r, scalar);
+
+      /* compress point to public */
+      __ALIGN64 U64 packed_point[P448_LEN52];
+      ge448_homo_compress(packed_point, &r);
+
+      /* return result */
+      ed448_store_comp((int8u* const*)pa_public_key, packed_point);
+
+      /* clear memory containing potentially secret data */
+      MB_FUNC_NAME(zero_)((int64u(*)[8])az, sizeof(az)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])az_mb, sizeof(az_mb)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])scalar, sizeof(scalar)/sizeof(U64));
+   }
+
+   return status;
+}
+
+/*
+// Computes ED448 signature
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages are being signed
+// msgLen[]          array of messages lengths (in bytes)
+// pa_private_key[]  array of pointers to the signer's private keys
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed448_sign_)(ed448_sign_component* pa_sign_r[8],
+                                         ed448_sign_component* pa_sign_s[8],
+                                         const int8u* const pa_msg[8], const int32u msgLen[8],
+                                         const ed448_private_key* const pa_private_key[8],
+                                         const ed448_public_key* const pa_public_key[8])
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test input pointers */
+   if(NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_private_key || NULL== pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   int8u* loc_sign_r[8];
+   int8u* loc_sign_s[8];
+
+   /* check pointers and values */
+   int buf_no;
+   for (buf_no = 0; buf_no < 8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL == pa_sign_r[buf_no] || NULL == pa_sign_s[buf_no] || NULL == pa_msg[buf_no] ||
+         NULL == pa_private_key[buf_no] || NULL == pa_public_key[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+
+      /* signatures are stored in the correct lanes only */
+      loc_sign_r[buf_no] = MBX_GET_STS(status, buf_no) ? NULL : (int8u*)pa_sign_r[buf_no];
+      loc_sign_s[buf_no] = MBX_GET_STS(status, buf_no) ? NULL : (int8u*)pa_sign_s[buf_no];
+   }
+
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      /* expanded secret keys */
+      __ALIGN64 int8u az[8][HASH_LENGTH] = { 0 };
+      int8u* pa_az[8] = { az[0], az[1], az[2], az[3], az[4], az[5], az[6], az[7] };
+      const int8u* pa_prefix[8];
+
+      /* expands secret key,  az = H(private_key) */
+      ed448_expand_key(pa_az, pa_private_key);
+      __ALIGN64 U64 mb_az[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])mb_az, (const int64u**)pa_az, P448_BITSIZE);
+
+      /* computes nonce, nonce = H(dom4, az+57, msg) mod n */
+      for (buf_no = 0; buf_no < 8; buf_no++)
+         pa_prefix[buf_no] = loc_sign_r[buf_no] ? pa_az[buf_no] + sizeof(ed448_private_key) : NULL;
+      __ALIGN64 U64 mb_nonce[N448_LEN52];
+      ed448_hash_mod_n(mb_nonce, pa_prefix, NULL, 0, pa_msg, msgLen);
+
+      /* computes r-component of the signature, R = [nonce]*G */
+      __ALIGN64 U64 mb_scalar[N448_LEN64];
+      ed448_scalar52_to_64(mb_scalar, mb_nonce);
+
+      __ALIGN64 ge448_homo_mb R;
+      ifma_ed448_mul_basepoint(&R, mb_scalar);
+      __ALIGN64 U64 mb_sign_r[P448_LEN52];
+      ge448_homo_compress(mb_sign_r, &R);
+
+      /* store r-component of the signature */
+      ed448_store_comp(loc_sign_r, mb_sign_r);
+
+      /* computes hram, hram = H(dom4, r_sign, public_key, msg) mod n */
+      const int8u* pa_pub[8];
+      for (buf_no = 0; buf_no < 8; buf_no++)
+         pa_pub[buf_no] = loc_sign_r[buf_no] ? (const int8u*)pa_public_key[buf_no] : NULL;
+      __ALIGN64 U64 mb_hram[N448_LEN52];
+      ed448_hash_mod_n(mb_hram, (const int8u**)loc_sign_r, pa_pub, sizeof(ed448_public_key), pa_msg, msgLen);
+
+      /* s = hram*az + nonce */
+      __ALIGN64 U64 mb_sign_s[N448_LEN52];
+      ifma52_ed448n_madd(mb_sign_s, mb_hram, mb_az, mb_nonce);
+
+      /* store s-component of the signature */
+      ed448_store_comp(loc_sign_s, mb_sign_s);
+
+      /* clear memory containing potentially secret data */
+      MB_FUNC_NAME(zero_)((int64u(*)[8])az, sizeof(az)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_az, sizeof(mb_az)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_nonce, sizeof(mb_nonce)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_scalar, sizeof(mb_scalar)/sizeof(U64));
+   }
+
+   return status;
+}
+
+/*
+// Verifies ED448 signature
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_msg[]          array of pointers to the signed messages
+// msgLen[]          array of signed messages lengths
+// pa_public_key[]   array of pointers to the signer's public keys
+*/
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_ed448_verify_)(const ed448_sign_component* const pa_sign_r[8],
+                                           const ed448_sign_component* const pa_sign_s[8],
+                                           const int8u* const pa_msg[8], const int32u msgLen[8],
+                                           const ed448_public_key* const pa_public_key[8])
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test input pointers */
+   if (NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_public_key) {
+      return MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   /* check pointers and values */
+   int buf_no;
+   for (buf_no = 0; buf_no < 8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if (NULL == pa_sign_r[buf_no] || NULL == pa_sign_s[buf_no] || NULL == pa_msg[buf_no] ||
+         NULL == pa_public_key[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+
+      /* h = SHAKE256(dom4 || sign_r || public_key || msg) mod n */
+      __ALIGN64 U64 h_mb[N448_LEN52];
+      ed448_hash_mod_n(h_mb, (const int8u* const*)pa_sign_r, (const int8u* const*)pa_public_key, sizeof(ed448_public_key), pa_msg, msgLen);
+
+      __ALIGN64 U64 h64_mb[N448_LEN64];
+      ed448_scalar52_to_64(h64_mb, h_mb);
+
+      /* input r-components to mb */
+      __ALIGN64 U64 inputR_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])inputR_mb, (const int64u**)pa_sign_r, GE448_COMP_BITSIZE);
+
+      /* input s-components to mb */
+      __ALIGN64 U64 s_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])s_mb, (const int64u**)pa_sign_s, GE448_COMP_BITSIZE);
+
+      /* (comppressed) publickey to mb */
+      __ALIGN64 U64 pubfe_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])pubfe_mb, (const int64u**)pa_public_key, GE448_COMP_BITSIZE);
+
+      /* check that s<n */
+      __mb_mask k = ifma52_ed448n_cmp_lt(s_mb);
+      status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+      /* continue processing if there are correct parameters */
+      if (MBX_IS_ANY_OK_STS(status)) {
+         __ALIGN64 U64 s64_mb[N448_LEN64];
+         ed448_scalar52_to_64(s64_mb, s_mb);
+
+         /* decompress public to point -A */
+         __ALIGN64 ge448_homo_mb pubA_mb;
+         k = ge448_homo_decompress(&pubA_mb, pubfe_mb);
+         MB_FUNC_NAME(ifma_neg52_p448_)(pubA_mb.X, pubA_mb.X);
+         status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+
+         if (MBX_IS_ANY_OK_STS(status)) {
+            /* R = [h](-A) + [s]G */
+            __ALIGN64 ge448_homo_mb R_mb;
+            ifma_ed448_prod_point(&R_mb, &pubA_mb, h64_mb, s64_mb);
+
+            /* recovered r-components */
+            __ALIGN64 U64 checkR_mb[P448_LEN52];
+            ge448_homo_compress(checkR_mb, &R_mb);
+
+            /* check that recovered r- and input r- components are equal each other */
+            k = MB_FUNC_NAME(cmp_eq_FE448_)(checkR_mb, inputR_mb);
+            status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+         }
+      }
+   }
+
+   return status;
+}
@@ -0,0 +1,338 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/exp.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/exp/ifma_exp_method.h>
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/common/ifma_cvt52.h>
+
+/*
+// Fixed-base exponentiation (Lim-Lee comb).
+//
+// For the exponent of expBitLen bits and h = EXP_COMB_TEETH teeth
+// the exponent is split into h rows of a = ceil(expBitLen/h) bits:
+//    e = sum(E_i * 2^(i*a)), i=0,..,h-1
+// and the table holds
+//    T[v] = prod(g^(2^(i*a))) for all bits i set in v, v=0,..,2^h-1
+// so that g^e requires a-1 squarings and a multiplications only.
+//
+// Layout of the table:
+//    offset (1 byte, pTable[0]) of the 64-byte aligned part from pTable
+//    header[1]  (int64u[8] rows from here on)
+//    k0[1]
+//    modulus[MULTIPLE_OF(len52, 10)]
+//    T[EXP_COMB_TBL_SIZE][len52]
+*/
+
+/* header of the pre-computed table */
+#define TBL_HDR_ID       (0)
+#define TBL_HDR_MODBITS  (1)
+#define TBL_HDR_EXPBITS  (2)
+#define TBL_HDR_TEETH    (3)
+#define TBL_HDR_LANES    (4)   /* lanes with valid pre-computation */
+
+#define COMB_ROW_BITS(expBitLen) (NUMBER_OF_DIGITS((expBitLen), EXP_COMB_TEETH))
+
+/*
+// The aligned part of the table starts at 1..64 bytes from pTable,
+// the offset is kept in pTable[0]. The table moved to the address
+// of other alignment is detected by the offset that no longer points
+// to the 64-byte boundary.
+*/
+__INLINE int8u* comb_table_aligned_ptr(int8u* pTable)
+{
+   return (int8u*)IFMA_ALIGNED_PTR(pTable+1, 64);
+}
+
+__INLINE const int8u* comb_table_stored_ptr(const int8u* pTable)
+{
+   const int8u* ptr = pTable + pTable[0];
+   return (0 == IFMA_BYTES_TO_ALIGN(ptr, 64)) ? ptr : NULL;
+}
+
+DLL_PUBLIC
+int mbx_exp_fixed_base_TableSize(int modulusBits, int exp_bits)
+{
+   int modulusRange = bits_range(modulusBits);
+
+   if(modulusRange && 0<exp_bits && exp_bits<=modulusBits) {
+      int len52 = NUMBER_OF_DIGITS(modulusRange, DIGIT_SIZE);
+      int tableSize = (8                                /* alignment */
+                     + 1*8                              /* header */
+                     + 1*8                              /* k0 */
+                     + MULTIPLE_OF(len52, 10)*8         /* modulus */
+                     + EXP_COMB_TBL_SIZE * len52*8      /* pre-computed table */
+                     ) * sizeof(int64u);
+      return tableSize;
+   }
+   else
+      return 0;
+}
+
+/* comb digit: bits j, a+j, 2a+j, ... of the exponents */
+__INLINE __m512i comb_digit(const int64u expz[][8], int a, int j)
+{
+   __m512i one = _mm512_set1_epi64(1);
+   __m512i digit = _mm512_setzero_si512();
+   int i;
+   for (i = 0; i < EXP_COMB_TEETH; i++) {
+      int bit = i*a + j;
+      __m512i T = _mm512_load_si512(expz[bit/64]);
+      T = _mm512_and_si512(_mm512_srli_epi64(T, (unsigned int)(bit%64)), one);
+      digit = _mm512_or_si512(digit, _mm512_slli_epi64(T, (unsigned int)i));
+   }
+   return digit;
+}
+
+/* constant-time table look up */
+static void extract_comb_multiplier_mb8(int64u out[][8], const int64u tbl[][8], int len52, __m512i idx_target)
+{
+   __mmask8 k[EXP_COMB_TBL_SIZE];
+   int n, d;
+
+   for (n = 1; n < EXP_COMB_TBL_SIZE; n++)
+      k[n] = _mm512_cmpeq_epu64_mask(_mm512_set1_epi64(n), idx_target);
+
+   for (d = 0; d < len52; d++) {
+      __m512i X = _mm512_load_si512(tbl[d]);
+      for (n = 1; n < EXP_COMB_TBL_SIZE; n++)
+         X = _mm512_mask_mov_epi64(X, k[n], _mm512_load_si512(tbl[n*len52 + d]));
+      _mm512_store_si512(out[d], X);
+   }
+}
+
+DLL_PUBLIC
+mbx_status mbx_exp_fixed_base_precomp_mb8(int8u* pTable, int tableLen,
+                                    const int64u* const base_pa[8],
+                                    const int64u* const mod_pa[8], int mod_bits,
+                                          int exp_bits,
+                                          int8u* pBuffer, int bufferLen)
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test input pointers */
+   if (NULL==pTable || NULL==base_pa || NULL==mod_pa || NULL==pBuffer) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* test modulus range and exp length */
+   int modulus_range = bits_range(mod_bits);
+   if (0 == modulus_range || exp_bits <= 0 || exp_bits > mod_bits) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* test length of table and buffer */
+   if (tableLen < mbx_exp_fixed_base_TableSize(mod_bits, exp_bits) || bufferLen < mbx_exp_BufferSize(mod_bits)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   int64u valid_lanes = 0;
+   int buf_no;
+   for (buf_no = 0; buf_no < 8; buf_no++) {
+      if (NULL == base_pa[buf_no] || NULL == mod_pa[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      else
+         valid_lanes |= (int64u)1 << buf_no;
+   }
+
+   /*
+   // processing
+   */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      const exp_kernels_mb8* kernels = exp_kernels(modulus_range);
+      int len52 = kernels->len52;
+      int a = COMB_ROW_BITS(exp_bits);
+      int i, n, v;
+
+      /* table */
+      int8u* pAlignedTable = comb_table_aligned_ptr(pTable);
+      pint64u_x8 hdr_mb8 = (pint64u_x8)pAlignedTable;
+      pint64u_x8 k0_mb8 = hdr_mb8 + 1;
+      pint64u_x8 mod_mb8 = k0_mb8 + 1;
+      pint64u_x8 tbl_mb8 = mod_mb8 + MULTIPLE_OF(len52, 10);
+
+      /* scratch buffer */
+      pint64u_x8 rr_mb8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer, 64);
+      pint64u_x8 inp_mb8 = rr_mb8 + len52;
+
+      /* convert modulus to ifma fmt */
+      zero_mb8(mod_mb8, MULTIPLE_OF(len52, 10));
+      ifma_BNU_to_mb8(mod_mb8, mod_pa, mod_bits);
+
+      /* compute k0[] */
+      ifma_montFactor52_mb8(k0_mb8[0], mod_mb8[0]);
+
+      /* compute to_Montgomery domain converter */
+      ifma_montRR52x_mb8(rr_mb8, mod_mb8, mod_bits);
+
+      /* T[0] = mont(1) */
+      zero_mb8(inp_mb8, len52);
+      _mm512_store_si512(inp_mb8, _mm512_set1_epi64(1));
+      kernels->amm((int64u*)tbl_mb8, (int64u*)inp_mb8, (int64u*)rr_mb8, (int64u*)mod_mb8, (int64u*)k0_mb8);
+
+      /* T[1] = mont(g) */
+      ifma_BNU_to_mb8(inp_mb8, base_pa, mod_bits);
+      kernels->amm((int64u*)(tbl_mb8 + len52), (int64u*)inp_mb8, (int64u*)rr_mb8, (int64u*)mod_mb8, (int64u*)k0_mb8);
+
+      /* T[2^i] = T[2^(i-1)]^(2^a) */
+      for (i = 1; i < EXP_COMB_TEETH; i++) {
+         int64u* prev = (int64u*)(tbl_mb8 + (1<<(i-1))*len52);
+         int64u* curr = (int64u*)(tbl_mb8 + (1<<i)*len52);
+         kernels->ams(curr, prev, (int64u*)mod_mb8, (int64u*)k0_mb8);
+         for (n = 1; n < a; n++)
+            kernels->ams(curr, curr, (int64u*)mod_mb8, (int64u*)k0_mb8);
+      }
+
+      /* T[v] = T[v without its lowest bit] * T[lowest bit of v] */
+      for (v = 3; v < EXP_COMB_TBL_SIZE; v++) {
+         int low = v & (-v);
+         if (low == v)
+            continue;
+         kernels->amm((int64u*)(tbl_mb8 + v*len52),
+                      (int64u*)(tbl_mb8 + (v-low)*len52),
+                      (int64u*)(tbl_mb8 + low*len52),
+                      (int64u*)mod_mb8, (int64u*)k0_mb8);
+      }
+
+      /* header */
+      pTable[0] = (int8u)(pAlignedTable - pTable);
+      zero_mb8(hdr_mb8, 1);
+      hdr_mb8[0][TBL_HDR_ID]      = EXP_COMB_TBL_ID;
+      hdr_mb8[0][TBL_HDR_MODBITS] = (int64u)mod_bits;
+      hdr_mb8[0][TBL_HDR_EXPBITS] = (int64u)exp_bits;
+      hdr_mb8[0][TBL_HDR_TEETH]   = EXP_COMB_TEETH;
+      hdr_mb8[0][TBL_HDR_LANES]   = valid_lanes;
+
+      /* clear converted base */
+      zero_mb8(inp_mb8, len52);
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_exp_fixed_base_mb8(int64u* const out_pa[8],
+                            const int64u* const exp_pa[8], int exp_bits,
+                            const int8u* pTable,
+                                  int8u* pBuffer, int bufferLen)
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test input pointers */
+   if (NULL==out_pa || NULL==exp_pa || NULL==pTable || NULL==pBuffer) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* table (moved to the address of other alignment is not accepted) */
+   const int8u* pAlignedTable = comb_table_stored_ptr(pTable);
+   if (NULL == pAlignedTable) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   const int64u (*hdr_mb8)[8] = (const int64u(*)[8])pAlignedTable;
+
+   /* test table and exp length */
+   if (EXP_COMB_TBL_ID != hdr_mb8[0][TBL_HDR_ID] || EXP_COMB_TEETH != hdr_mb8[0][TBL_HDR_TEETH]) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   int mod_bits = (int)hdr_mb8[0][TBL_HDR_MODBITS];
+   int tbl_exp_bits = (int)hdr_mb8[0][TBL_HDR_EXPBITS];
+   if (exp_bits <= 0 || exp_bits > tbl_exp_bits) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* test length of buffer */
+   if (bufferLen < mbx_exp_BufferSize(mod_bits)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and pre-computation */
+   int buf_no;
+   for (buf_no = 0; buf_no < 8; buf_no++) {
+      if (NULL == out_pa[buf_no] || NULL == exp_pa[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      else if (0 == ((hdr_mb8[0][TBL_HDR_LANES] >> buf_no) & 1))
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   /*
+   // processing
+   */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      const exp_kernels_mb8* kernels = exp_kernels(bits_range(mod_bits));
+      int len52 = kernels->len52;
+      int a = COMB_ROW_BITS(tbl_exp_bits);
+      int len64 = NUMBER_OF_DIGITS(a*EXP_COMB_TEETH, 64);
+      int j;
+
+      const int64u (*k0_mb8)[8] = hdr_mb8 + 1;
+      const int64u (*mod_mb8)[8] = k0_mb8 + 1;
+      const int64u (*tbl_mb8)[8] = mod_mb8 + MULTIPLE_OF(len52, 10);
+
+      /* allocate mb8 buffers */
+      pint64u_x8 expz_mb8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer, 64);
+      pint64u_x8 red_Y = expz_mb8 + (len64+1);
+      pint64u_x8 red_X = red_Y + len52;
+      pint64u_x8 red_T = red_X + len52;
+
+      /* re-arrange exps to ifma */
+      zero_mb8(expz_mb8, len64+1);
+      ifma_BNU_transpose_copy(expz_mb8, exp_pa, exp_bits);
+
+      /* Y = T[top comb digit] */
+      extract_comb_multiplier_mb8(red_Y, tbl_mb8, len52, comb_digit((const int64u(*)[8])expz_mb8, a, a-1));
+
+      for (j = a-2; j >= 0; j--) {
+         pint64u_x8 swap;
+
+         kernels->ams((int64u*)red_Y, (int64u*)red_Y, (int64u*)mod_mb8, (int64u*)k0_mb8);
+
+         extract_comb_multiplier_mb8(red_X, tbl_mb8, len52, comb_digit((const int64u(*)[8])expz_mb8, a, j));
+         kernels->amm((int64u*)red_T, (int64u*)red_Y, (int64u*)red_X, (int64u*)mod_mb8, (int64u*)k0_mb8);
+
+         swap = red_Y; red_Y = red_T; red_T = swap;
+      }
+
+      /* convert result back in regular 2^52 domain */
+      zero_mb8(red_X, len52);
+      _mm512_store_si512(red_X, _mm512_set1_epi64(1));
+      kernels->amm((int64u*)red_T, (int64u*)red_Y, (int64u*)red_X, (int64u*)mod_mb8, (int64u*)k0_mb8);
+
+      /* convert result from ifma fmt */
+      ifma_mb8_to_BNU(out_pa, (const int64u(*)[8])red_T, mod_bits);
+
+      /* clear exponents and intermediate results */
+      zero_mb8(expz_mb8, len64+1);
+      zero_mb8(red_Y, len52);
+      zero_mb8(red_X, len52);
+      zero_mb8(red_T, len52);
+   }
+
+   return status;
+}
@@ -249,3 +249,38 @@ mbx_status mbx_exp_mb8(int64u* const out_pa[8],
                       expfunc,
                       pBuffer, bufferLen);
 }
+
+DLL_PUBLIC
+mbx_status mbx_exp_pub_mb8(int64u* const out_pa[8],
+                     const int64u* const base_pa[8],
+                     const int64u* const exp_pa[8], int exp_bits,
+                     const int64u* const mod_pa[8], int mod_bits,
+                           int8u* pBuffer, int bufferLen)
+{
+   mbx_status status = MBX_STATUS_OK;
+
+   /* test exp modulus range */
+   int modulus_range = bits_range(mod_bits);
+   if(0 == modulus_range) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   //
+   // processing
+   //
+   exp_mb8 expfunc = NULL;
+   switch (modulus_range) {
+      case EXP_MODULUS_1024: expfunc = ifma_modexp1024_sw_mb; break;
+      case EXP_MODULUS_2048: expfunc = ifma_modexp2048_sw_mb; break;
+      case EXP_MODULUS_3072: expfunc = ifma_modexp3072_sw_mb; break;
+      case EXP_MODULUS_4096: expfunc = ifma_modexp4096_sw_mb; break;
+      default: break;
+   }
+
+   return ifma_exp_mb(out_pa, base_pa,
+                      exp_pa, exp_bits,
+                      mod_pa, mod_bits,
+                      expfunc,
+                      pBuffer, bufferLen);
+}
@@ -38,6 +38,23 @@ int bits_range(int modulusBits)
    }
 }
 
+/* Montgomery kernels of the exp modulus range */
+static const exp_kernels_mb8 exp_kernels_1024 = { NUMBER_OF_DIGITS(EXP_MODULUS_1024, DIGIT_SIZE), ifma_amm52x20_mb8, AMS52x20_diagonal_mb8 };
+static const exp_kernels_mb8 exp_kernels_2048 = { NUMBER_OF_DIGITS(EXP_MODULUS_2048, DIGIT_SIZE), ifma_amm52x40_mb8, AMS52x40_diagonal_mb8 };
+static const exp_kernels_mb8 exp_kernels_3072 = { NUMBER_OF_DIGITS(EXP_MODULUS_3072, DIGIT_SIZE), ifma_amm52x60_mb8, AMS52x60_diagonal_mb8 };
+static const exp_kernels_mb8 exp_kernels_4096 = { NUMBER_OF_DIGITS(EXP_MODULUS_4096, DIGIT_SIZE), ifma_amm52x79_mb8, AMS52x79_diagonal_mb8 };
+
+const exp_kernels_mb8* exp_kernels(int modulus_range)
+{
+   switch (modulus_range) {
+   case EXP_MODULUS_1024: return &exp_kernels_1024;
+   case EXP_MODULUS_2048: return &exp_kernels_2048;
+   case EXP_MODULUS_3072: return &exp_kernels_3072;
+   case EXP_MODULUS_4096: return &exp_kernels_4096;
+   default: return NULL;
+   }
+}
+
 /* size of scratch bufer */
 DLL_PUBLIC
 int mbx_exp_BufferSize(int modulusBits)
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/exp/ifma_exp_method.h>
+
+/*
+// Variable-time sliding window exponentiation.
+//
+// Intended for public exponents only: the sequence of operations
+// depends on the exponent bits of all 8 lanes.
+// Exponentiation starts from the top set bit of the longest exponent,
+// the sliding windows are used if all the lanes share the exponent.
+*/
+
+/* bit of the lane's exponent */
+__INLINE int exp_bit(const int64u expz[][8], int lane, int bit)
+{
+   return (int)((expz[bit/64][lane] >> (bit%64)) & 1);
+}
+
+/*
+// Next window of the lane at or below |bit|:
+// returns position of the lowest (set) bit of the window or -1,
+// |pValue| holds the (odd) window value.
+*/
+static int next_window(const int64u expz[][8], int lane, int bit, int* pValue)
+{
+   int hi, lo, n;
+   int value = 0;
+
+   /* skip zeros */
+   for (hi = bit; hi >= 0 && !exp_bit(expz, lane, hi); hi--) ;
+   if (hi < 0)
+      return -1;
+
+   /* window cannot be wider than EXP_WIN_SIZE and ends by set bit */
+   lo = (hi - EXP_WIN_SIZE + 1) > 0 ? (hi - EXP_WIN_SIZE + 1) : 0;
+   while (!exp_bit(expz, lane, lo))
+      lo++;
+
+   for (n = hi; n >= lo; n--)
+      value = (value << 1) | exp_bit(expz, lane, n);
+
+   *pValue = value;
+   return lo;
+}
+
+/* get table entries by per-lane index, lanes out of mask are not loaded */
+static void gather_multiplier_mb8(int64u out[][8], const int64u tbl[][8], int len52, __mmask8 k, const int64u idx[8])
+{
+   __m512i lane = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+   __m512i offs = _mm512_mullo_epi64(_mm512_loadu_si512(idx), _mm512_set1_epi64((long long)len52*8));
+   offs = _mm512_add_epi64(offs, lane);
+
+   int n;
+   for (n = 0; n < len52; n++) {
+      __m512i X = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), k, offs, (const long long*)tbl[n], 8);
+      _mm512_store_si512(out[n], X);
+   }
+}
+
+static void ifma_modexp_sw_mb(int64u out[][8],
+                        const int64u base[][8],
+                        const int64u expz[][8], int expBitLen,
+                        const int64u modulus[][8],
+                        const int64u toMont[][8],
+                        const int64u k0[8],
+                              int64u scratchBuffer[][8],
+                        const exp_kernels_mb8* kernels,
+                              exp_mb8 fixed_win_exp)
+{
+   int lane, n, idx;
+
+   /* bit length of the longest exponent */
+   int top = -1;
+   for (lane = 0; lane < 8; lane++) {
+      for (n = expBitLen-1; n > top; n--) {
+         if (exp_bit(expz, lane, n)) {
+            top = n;
+            break;
+         }
+      }
+   }
+
+   /*
+   // Sliding windows of the lanes are aligned only if the exponents are equal,
+   // otherwise use fixed window exponentiation limited by the longest exponent
+   */
+   {
+      int equal = 1;
+      for (n = 0; n <= top/64 && equal; n++) {
+         __m512i E = _mm512_load_si512(expz[n]);
+         equal = (0xFF == _mm512_cmpeq_epu64_mask(E, _mm512_set1_epi64((long long)expz[n][0])));
+      }
+      if (!equal) {
+         fixed_win_exp(out, base, expz, top+1, modulus, toMont, k0, scratchBuffer);
+         return;
+      }
+   }
+
+   int len52 = kernels->len52;
+   amm52_mb8 amm = kernels->amm;
+   ams52_mb8 ams = kernels->ams;
+
+   /* allocate red(undant) result Y, multiplier X and product T */
+   pint64u_x8 red_Y = (pint64u_x8)scratchBuffer;
+   pint64u_x8 red_X = red_Y + len52;
+   pint64u_x8 red_T = red_X + len52;
+
+   /* pre-computed table of odd base powers base^(2*i+1), i=0, ..., EXP_SW_TBL_SIZE-1 */
+   pint64u_x8 red_table = red_T + len52;
+
+   /*
+   // compute table of odd powers
+   */
+   amm((int64u*)red_table, (int64u*)base, (int64u*)toMont, (int64u*)modulus, (int64u*)k0);
+   ams((int64u*)red_X, (int64u*)red_table, (int64u*)modulus, (int64u*)k0);
+   for (idx = 1; idx < EXP_SW_TBL_SIZE; idx++)
+      amm((int64u*)(red_table + idx*len52), (int64u*)(red_table + (idx-1)*len52), (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+
+   /* Y = mont(1) */
+   zero_mb8(red_X, len52);
+   _mm512_store_si512(red_X, _mm512_set1_epi64(1));
+   amm((int64u*)red_Y, (int64u*)red_X, (int64u*)toMont, (int64u*)modulus, (int64u*)k0);
+
+   /* exponentiation */
+   {
+      int win_lo[8];
+      int win_val[8];
+      __ALIGN64 int64u red_table_idx[8];
+
+      for (lane = 0; lane < 8; lane++)
+         win_lo[lane] = next_window(expz, lane, top, &win_val[lane]);
+
+      for (n = top; n >= 0; n--) {
+         __mmask8 k = 0;
+
+         if (n < top)
+            ams((int64u*)red_Y, (int64u*)red_Y, (int64u*)modulus, (int64u*)k0);
+
+         for (lane = 0; lane < 8; lane++) {
+            red_table_idx[lane] = 0;
+            if (win_lo[lane] == n) {
+               k |= (__mmask8)(1 << lane);
+               red_table_idx[lane] = (int64u)(win_val[lane] >> 1);
+               win_lo[lane] = next_window(expz, lane, n-1, &win_val[lane]);
+            }
+         }
+
+         if (k) {
+            gather_multiplier_mb8(red_X, (const int64u(*)[8])red_table, len52, k, red_table_idx);
+            amm((int64u*)red_T, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+            for (idx = 0; idx < len52; idx++)
+               _mm512_store_si512(red_Y[idx], _mm512_mask_mov_epi64(_mm512_load_si512(red_Y[idx]), k, _mm512_load_si512(red_T[idx])));
+         }
+      }
+   }
+
+   /* convert result back in regular 2^52 domain */
+   zero_mb8(red_X, len52);
+   _mm512_store_si512(red_X, _mm512_set1_epi64(1));
+   amm((int64u*)out, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+}
+
+void ifma_modexp1024_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u expz[][8], int expBitLen,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u scratchBuffer[][8])
+{
+   ifma_modexp_sw_mb(out, base, expz, expBitLen, modulus, toMont, k0, scratchBuffer, exp_kernels(EXP_MODULUS_1024), ifma_modexp1024_mb);
+}
+
+void ifma_modexp2048_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u expz[][8], int expBitLen,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u scratchBuffer[][8])
+{
+   ifma_modexp_sw_mb(out, base, expz, expBitLen, modulus, toMont, k0, scratchBuffer, exp_kernels(EXP_MODULUS_2048), ifma_modexp2048_mb);
+}
+
+void ifma_modexp3072_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u expz[][8], int expBitLen,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u scratchBuffer[][8])
+{
+   ifma_modexp_sw_mb(out, base, expz, expBitLen, modulus, toMont, k0, scratchBuffer, exp_kernels(EXP_MODULUS_3072), ifma_modexp3072_mb);
+}
+
+void ifma_modexp4096_sw_mb(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u expz[][8], int expBitLen,
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u scratchBuffer[][8])
+{
+   ifma_modexp_sw_mb(out, base, expz, expBitLen, modulus, toMont, k0, scratchBuffer, exp_kernels(EXP_MODULUS_4096), ifma_modexp4096_mb);
+}
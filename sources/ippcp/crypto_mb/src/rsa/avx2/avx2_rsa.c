@@ -0,0 +1,932 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+/*
+// RSA for the platforms without AVX512-IFMA.
+//
+// 4-lane AVX2 code, numbers are in 2^28 radix. Almost Montgomery multiplication
+// (operands and result less than 2*m, R = 2^(28*len) > 4*m) computes the product
+// (or the square) first and then reduces it, both steps process 4 rows per pass.
+// 56-bit products are accumulated in 64-bit lanes without carry propagation,
+// the accumulator is normalized every NORM28_PERIOD rows of the longer numbers.
+//
+// Private exponentiation uses fixed window of EXP_WIN4_SIZE bits with the
+// table lookup scanning all the entries.
+*/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_math.h>
+#include <internal/common/cpu_dispatch.h>
+#include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/avx2_rsa.h>
+
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
+#define DIGIT_SIZE28   (28)
+#define MASK28         (((int64u)1<<DIGIT_SIZE28) -1)
+
+/* length (in 2^28 radix digits) of the number of bitLen bits, 4*m < R */
+#define LEN28(bitLen)  (NUMBER_OF_DIGITS((bitLen)+2, DIGIT_SIZE28))
+#define MAX_LEN28      (LEN28(RSA8192))
+
+/* no more than 2*(NORM28_PERIOD+4) products of 56 bits are accumulated before normalization */
+#define NORM28_PERIOD  (64)
+
+/* exponentiation processing window */
+#define EXP_WIN4_SIZE  (4)
+#define EXP_WIN4_MASK  ((1<<EXP_WIN4_SIZE) -1)
+#define EXP_TBL4_SIZE  (1<<EXP_WIN4_SIZE)
+
+__INLINE void zero28_mb4(U64x4 r[], int len)
+{
+   for(int i=0; i<len; i++)
+      r[i] = get_zero64x4();
+}
+
+__INLINE void copy28_mb4(U64x4 r[], const U64x4 a[], int len)
+{
+   for(int i=0; i<len; i++)
+      r[i] = a[i];
+}
+
+/* r = normalized a, returns carry out of the most significant digit */
+static U64x4 norm28_mb4(U64x4 r[], const U64x4 a[], int len)
+{
+   const U64x4 mask = set1x4(MASK28);
+   U64x4 c = get_zero64x4();
+   for(int i=0; i<len; i++) {
+      U64x4 t = add64x4(a[i], c);
+      r[i] = and64x4(t, mask);
+      c = srli64x4(t, DIGIT_SIZE28);
+   }
+   return c;
+}
+
+/* k0 = -m^(-1) mod 2^28 */
+static U64x4 montFactor28_mb4(const U64x4 m[])
+{
+   const U64x4 mask32 = set1x4(0xFFFFFFFF);
+   const U64x4 two = set1x4(2);
+   /* m*m = 1 mod 8, each Newton step doubles number of valid bits */
+   U64x4 inv = m[0];
+   for(int i=0; i<4; i++) {
+      U64x4 t = sub64x4(two, mul32x4(m[0], inv));
+      inv = and64x4(mul32x4(inv, t), mask32);
+   }
+   return and64x4(sub64x4(get_zero64x4(), inv), set1x4(MASK28));
+}
+
+/*
+// t[q] += a[0]*b[q] + a[1]*b[q-1] + a[2]*b[q-2] + a[3]*b[q-3], q = q0,...,bLen+2
+// (b[] is zero outside [0,bLen))
+//
+// 4 rows of the product are processed per pass, so that the accumulator
+// is loaded and stored once per 4 multiplications.
+*/
+static void mac4x28_mb4(U64x4 t[], const U64x4 a[4], const U64x4 b[], int bLen, int q0)
+{
+   const U64x4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+   U64x4 b1 = (0<=q0-1 && q0-1<bLen)? b[q0-1] : get_zero64x4();
+   U64x4 b2 = (0<=q0-2 && q0-2<bLen)? b[q0-2] : get_zero64x4();
+   U64x4 b3 = (0<=q0-3 && q0-3<bLen)? b[q0-3] : get_zero64x4();
+   int q;
+
+   for(q=q0; q<bLen; q++) {
+      U64x4 b0 = b[q];
+      t[q] = add64x4(t[q], add64x4(add64x4(mul32x4(a0, b0), mul32x4(a1, b1)),
+                                   add64x4(mul32x4(a2, b2), mul32x4(a3, b3))));
+      b3 = b2; b2 = b1; b1 = b0;
+   }
+   for(; q<bLen+3; q++) {
+      t[q] = add64x4(t[q], add64x4(mul32x4(a1, b1), add64x4(mul32x4(a2, b2), mul32x4(a3, b3))));
+      b3 = b2; b2 = b1; b1 = get_zero64x4();
+   }
+}
+
+/* t[q] += a*b[q], q = 0,...,bLen-1 */
+__INLINE void mac1x28_mb4(U64x4 t[], U64x4 a, const U64x4 b[], int bLen)
+{
+   for(int q=0; q<bLen; q++)
+      t[q] = add64x4(t[q], mul32x4(a, b[q]));
+}
+
+/*
+// normalization of the accumulator part which still gets the products,
+// done each NORM28_PERIOD rows for the lengths above NORM28_PERIOD
+*/
+__INLINE void norm_period28_mb4(U64x4 t[], int row, int len)
+{
+   if(len>NORM28_PERIOD && 0==(row%NORM28_PERIOD))
+      norm28_mb4(t+row, t+row, 2*len-row);
+}
+
+/* t[2*len] = a*b */
+static void mul28_mb4(U64x4 t[], const U64x4 a[], const U64x4 b[], int len)
+{
+   int i;
+   zero28_mb4(t, 2*len);
+   for(i=0; i+4<=len; i+=4) {
+      mac4x28_mb4(t+i, a+i, b, len, 0);
+      norm_period28_mb4(t, i+4, len);
+   }
+   for(; i<len; i++)
+      mac1x28_mb4(t+i, a[i], b, len);
+}
+
+/* t[2*len] = a^2 */
+static void sqr28_mb4(U64x4 t[], const U64x4 a[], int len)
+{
+   int i;
+   zero28_mb4(t, 2*len);
+   for(i=0; i+4<=len; i+=4) {
+      const U64x4 a0 = a[i], a1 = a[i+1], a2 = a[i+2], a3 = a[i+3];
+      U64x4 x2[4];
+      x2[0] = add64x4(a0, a0);
+      x2[1] = add64x4(a1, a1);
+      x2[2] = add64x4(a2, a2);
+      x2[3] = add64x4(a3, a3);
+
+      /* 4x4 diagonal block */
+      t[2*i]   = add64x4(t[2*i],   mul32x4(a0, a0));
+      t[2*i+1] = add64x4(t[2*i+1], mul32x4(x2[0], a1));
+      t[2*i+2] = add64x4(t[2*i+2], add64x4(mul32x4(x2[0], a2), mul32x4(a1, a1)));
+      t[2*i+3] = add64x4(t[2*i+3], add64x4(mul32x4(x2[0], a3), mul32x4(x2[1], a2)));
+      t[2*i+4] = add64x4(t[2*i+4], add64x4(mul32x4(x2[1], a3), mul32x4(a2, a2)));
+      t[2*i+5] = add64x4(t[2*i+5], mul32x4(x2[2], a3));
+      t[2*i+6] = add64x4(t[2*i+6], mul32x4(a3, a3));
+
+      /* doubled products by the digits above the block */
+      if(i+4<len)
+         mac4x28_mb4(t+2*i+4, x2, a+i+4, len-i-4, 0);
+      norm_period28_mb4(t, i+4, len);
+   }
+   for(; i<len; i++) {
+      t[2*i] = add64x4(t[2*i], mul32x4(a[i], a[i]));
+      mac1x28_mb4(t+2*i+1, add64x4(a[i], a[i]), a+i+1, len-i-1);
+   }
+}
+
+/*
+// Montgomery reduction of t[2*len] (t is destroyed)
+// r = t/R mod m, r < t/R + m
+*/
+static void mred28_mb4(U64x4 r[], U64x4 t[], const U64x4 m[], U64x4 k0, int len)
+{
+   const U64x4 mask = set1x4(MASK28);
+   int i, n, j;
+
+   for(i=0; i+4<=len; i+=4) {
+      U64x4 u[4];
+      /* u[n] = t[i+n]*k0 mod 2^28, contributions of u[] to t[i..i+3] are added right away */
+      for(n=0; n<4; n++) {
+         u[n] = and64x4(mul32x4(t[i+n], k0), mask);
+         for(j=0; j<4-n; j++)
+            t[i+n+j] = add64x4(t[i+n+j], mul32x4(u[n], m[j]));
+         t[i+n+1] = add64x4(t[i+n+1], srli64x4(t[i+n], DIGIT_SIZE28));
+      }
+      mac4x28_mb4(t+i, u, m, len, 4);
+      norm_period28_mb4(t, i+4, len);
+   }
+   for(; i<len; i++) {
+      U64x4 u = and64x4(mul32x4(t[i], k0), mask);
+      mac1x28_mb4(t+i, u, m, len);
+      t[i+1] = add64x4(t[i+1], srli64x4(t[i], DIGIT_SIZE28));
+   }
+
+   /* result < 2^(28*len), no carry out */
+   norm28_mb4(r, t+len, len);
+}
+
+/*
+// almost Montgomery multiplication and squaring
+// r = a*b/R mod m, a,b < 2*m -> r < 2*m
+*/
+static void amm28_mb4(U64x4 r[], const U64x4 a[], const U64x4 b[], const U64x4 m[], U64x4 k0, int len)
+{
+   __ALIGN64 U64x4 t[2*MAX_LEN28];
+   mul28_mb4(t, a, b, len);
+   mred28_mb4(r, t, m, k0, len);
+}
+
+static void ams28_mb4(U64x4 r[], const U64x4 a[], const U64x4 m[], U64x4 k0, int len)
+{
+   __ALIGN64 U64x4 t[2*MAX_LEN28];
+   sqr28_mb4(t, a, len);
+   mred28_mb4(r, t, m, k0, len);
+}
+
+/*
+// almost Montgomery reduction
+// r = a/R mod m, a < 2^(28*aLen), aLen <= 2*len
+//    - a < 2*m gives r <= m
+//    - a < R*m gives r < 2*m
+*/
+static void amred28_mb4(U64x4 r[], const U64x4 a[], int aLen, const U64x4 m[], U64x4 k0, int len)
+{
+   __ALIGN64 U64x4 t[2*MAX_LEN28];
+   copy28_mb4(t, a, aLen);
+   zero28_mb4(t+aLen, 2*len-aLen);
+   mred28_mb4(r, t, m, k0, len);
+}
+
+/* r = a<m? a : a-m, a < 2*m */
+static void csub28_mb4(U64x4 r[], const U64x4 a[], const U64x4 m[], int len)
+{
+   const U64x4 mask = set1x4(MASK28);
+   U64x4 bw = get_zero64x4();
+   int i;
+
+   /* borrow of a-m */
+   for(i=0; i<len; i++)
+      bw = srli64x4(sub64x4(sub64x4(a[i], m[i]), bw), 63);
+
+   /* subtract m from the lanes having no borrow */
+   U64x4 msub = and64x4(sub64x4(bw, set1x4(1)), mask);
+   bw = get_zero64x4();
+   for(i=0; i<len; i++) {
+      U64x4 t = sub64x4(sub64x4(a[i], and64x4(m[i], msub)), bw);
+      bw = srli64x4(t, 63);
+      r[i] = and64x4(t, mask);
+   }
+}
+
+/* r = (a-b) mod m, a,b < m */
+static void modsub28_mb4(U64x4 r[], const U64x4 a[], const U64x4 b[], const U64x4 m[], int len)
+{
+   const U64x4 mask = set1x4(MASK28);
+   U64x4 bw = get_zero64x4();
+   int i;
+
+   for(i=0; i<len; i++) {
+      U64x4 t = sub64x4(sub64x4(a[i], b[i]), bw);
+      bw = srli64x4(t, 63);
+      r[i] = and64x4(t, mask);
+   }
+
+   /* add m to the lanes having borrow */
+   U64x4 madd = sub64x4(get_zero64x4(), bw);
+   U64x4 c = get_zero64x4();
+   for(i=0; i<len; i++) {
+      U64x4 t = add64x4(add64x4(r[i], and64x4(m[i], madd)), c);
+      c = srli64x4(t, DIGIT_SIZE28);
+      r[i] = and64x4(t, mask);
+   }
+}
+
+/* r = 2*a mod m, a < m */
+static void dbl28_mb4(U64x4 r[], const U64x4 a[], const U64x4 m[], int len)
+{
+   for(int i=0; i<len; i++)
+      r[i] = add64x4(a[i], a[i]);
+   norm28_mb4(r, r, len);
+   csub28_mb4(r, r, m, len);
+}
+
+/*
+// rr = R^2 mod m
+//
+// R mod m is computed by modular doublings of 2^(bitLen-1) < m,
+// R^2 mod m (the Montgomery form of 2^(28*len)) by square-and-double over the bits of 28*len.
+*/
+static void montRR28_mb4(U64x4 rr[], const U64x4 m[], U64x4 k0, int bitLen, int len)
+{
+   int pwr = DIGIT_SIZE28*len;
+   int i;
+
+   zero28_mb4(rr, len);
+   rr[(bitLen-1)/DIGIT_SIZE28] = set1x4((int64u)1 << ((bitLen-1)%DIGIT_SIZE28));
+   for(i=bitLen-1; i<pwr; i++)
+      dbl28_mb4(rr, rr, m, len);
+
+   for(i=31; i>=0 && 0==((pwr>>i) &1); i--) ;
+   for(; i>=0; i--) {
+      ams28_mb4(rr, rr, m, k0, len);
+      csub28_mb4(rr, rr, m, len);
+      if((pwr>>i) &1)
+         dbl28_mb4(rr, rr, m, len);
+   }
+}
+
+/* constant-time r = tbl[idx] */
+static void gather28_mb4(U64x4 r[], const U64x4 tbl[], U64x4 idx, int len)
+{
+   int i, n;
+   zero28_mb4(r, len);
+   for(n=0; n<EXP_TBL4_SIZE; n++) {
+      U64x4 mask = cmpeq64x4(idx, set1x4((int64u)n));
+      for(i=0; i<len; i++)
+         r[i] = or64x4(r[i], and64x4(mask, tbl[n*len+i]));
+   }
+}
+
+/*
+// y = x^e mod m (y < m)
+//
+// x < 2*m, e is given by 64-bit digits, expBits is multiple of EXP_WIN4_SIZE,
+// tbl[] holds EXP_TBL4_SIZE*len numbers
+*/
+static void exp28_mb4(U64x4 y[],
+                const U64x4 x[],
+                const U64x4 e[], int expBits,
+                const U64x4 m[],
+                const U64x4 rr[],
+                      U64x4 k0, int len,
+                      U64x4 tbl[])
+{
+   const U64x4 wmask = set1x4(EXP_WIN4_MASK);
+   int bit, n;
+
+   /* tbl[n] = x^n*R mod m */
+   amred28_mb4(tbl, rr, len, m, k0, len);
+   amm28_mb4(tbl+len, x, rr, m, k0, len);
+   for(n=2; n<EXP_TBL4_SIZE; n++) {
+      if(n&1)
+         amm28_mb4(tbl+n*len, tbl+(n-1)*len, tbl+len, m, k0, len);
+      else
+         ams28_mb4(tbl+n*len, tbl+(n/2)*len, m, k0, len);
+   }
+
+   bit = expBits - EXP_WIN4_SIZE;
+   gather28_mb4(y, tbl, and64x4(srl64x4(e[bit/64], bit%64), wmask), len);
+
+   __ALIGN64 U64x4 t[MAX_LEN28];
+   for(bit-=EXP_WIN4_SIZE; bit>=0; bit-=EXP_WIN4_SIZE) {
+      for(n=0; n<EXP_WIN4_SIZE; n++)
+         ams28_mb4(y, y, m, k0, len);
+      gather28_mb4(t, tbl, and64x4(srl64x4(e[bit/64], bit%64), wmask), len);
+      amm28_mb4(y, y, t, m, k0, len);
+   }
+
+   /* convert result back to the regular domain */
+   amred28_mb4(y, y, len, m, k0, len);
+   csub28_mb4(y, y, m, len);
+
+   zero28_mb4(t, len);
+}
+
+/* y = x^65537 mod m (y < m), x < 2*m */
+static void exp28_65537_mb4(U64x4 y[], const U64x4 x[], const U64x4 m[], const U64x4 rr[], U64x4 k0, int len)
+{
+   __ALIGN64 U64x4 t[MAX_LEN28];
+
+   amm28_mb4(t, x, rr, m, k0, len);
+   ams28_mb4(y, t, m, k0, len);
+   for(int n=1; n<16; n++)
+      ams28_mb4(y, y, m, k0, len);
+   amm28_mb4(y, y, t, m, k0, len);
+
+   amred28_mb4(y, y, len, m, k0, len);
+   csub28_mb4(y, y, m, len);
+}
+
+/* r = a + b*c, a of 2*len, b and c of len digits */
+static void addmul28_mb4(U64x4 r[], const U64x4 a[], const U64x4 b[], const U64x4 c[], int len)
+{
+   __ALIGN64 U64x4 t[2*MAX_LEN28];
+   mul28_mb4(t, b, c, len);
+   for(int i=0; i<2*len; i++)
+      t[i] = add64x4(t[i], a[i]);
+   norm28_mb4(r, t, 2*len);
+}
+
+/*
+// mb4 layers
+//
+// NULL pointers designate the lanes excluded from processing:
+// the inputs are treated as zero numbers, the outputs are not written.
+// pBuffer is 64-byte aligned.
+*/
+
+static void rsa_pub_mb4(const int8u* const from_pa[MB4_WIDTH],
+                              int8u* const to_pa[MB4_WIDTH],
+                        const int64u* const n_pa[MB4_WIDTH],
+                              int rsaBitlen,
+                              U64x4* pBuffer)
+{
+   int len = LEN28(rsaBitlen);
+
+   U64x4* n = pBuffer;
+   U64x4* rr = n +len;
+   U64x4* x = rr +len;
+
+   BNU_to_mb4_radix(n, len, n_pa, rsaBitlen, DIGIT_SIZE28);
+   U64x4 k0 = montFactor28_mb4(n);
+   montRR28_mb4(rr, n, k0, rsaBitlen, len);
+
+   HexStr_to_mb4_radix(x, len, from_pa, rsaBitlen, DIGIT_SIZE28);
+   exp28_65537_mb4(x, x, n, rr, k0, len);
+   mb4_radix_to_HexStr(to_pa, x, len, rsaBitlen, DIGIT_SIZE28);
+}
+
+static void rsa_prv2_mb4(const int8u* const from_pa[MB4_WIDTH],
+                               int8u* const to_pa[MB4_WIDTH],
+                         const int64u* const d_pa[MB4_WIDTH],
+                         const int64u* const n_pa[MB4_WIDTH],
+                               int rsaBitlen,
+                               U64x4* pBuffer)
+{
+   int len = LEN28(rsaBitlen);
+   int len64 = NUMBER_OF_DIGITS(rsaBitlen, 64);
+
+   U64x4* n = pBuffer;
+   U64x4* rr = n +len;
+   U64x4* x = rr +len;
+   U64x4* d = x +len;
+   U64x4* tbl = d +len64;
+
+   BNU_to_mb4_radix(n, len, n_pa, rsaBitlen, DIGIT_SIZE28);
+   U64x4 k0 = montFactor28_mb4(n);
+   montRR28_mb4(rr, n, k0, rsaBitlen, len);
+
+   HexStr_to_mb4_radix(x, len, from_pa, rsaBitlen, DIGIT_SIZE28);
+   BNU_transpose_mb4(d, d_pa, rsaBitlen);
+   exp28_mb4(x, x, d, rsaBitlen, n, rr, k0, len, tbl);
+   mb4_radix_to_HexStr(to_pa, x, len, rsaBitlen, DIGIT_SIZE28);
+
+   /* clear exponent and table */
+   zero28_mb4(d, len64);
+   zero28_mb4(tbl, EXP_TBL4_SIZE*len);
+}
+
+/*
+// crt exponentiation, the buffer is allocated as inp[2*len], q, p, rr, xq, xp, d, tbl
+*/
+static void rsa_prv5_mb4(const int8u* const from_pa[MB4_WIDTH],
+                               int8u* const to_pa[MB4_WIDTH],
+                         const int64u* const p_pa[MB4_WIDTH],
+                         const int64u* const q_pa[MB4_WIDTH],
+                         const int64u* const dp_pa[MB4_WIDTH],
+                         const int64u* const dq_pa[MB4_WIDTH],
+                         const int64u* const iq_pa[MB4_WIDTH],
+                               int rsaBitlen,
+                               U64x4* pBuffer)
+{
+   int factorBitlen = rsaBitlen/2;
+   int len = LEN28(factorBitlen);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   U64x4* inp = pBuffer;
+   U64x4* q = inp +2*len;
+   U64x4* p = q +len;
+   U64x4* rr = p +len;
+   U64x4* xq = rr +len;
+   U64x4* xp = xq +len;
+   U64x4* d = xp +len;
+   U64x4* tbl = d +len64;
+   U64x4 k0;
+
+   /* input is less than 2^rsaBitlen < R*q, R*p */
+   HexStr_to_mb4_radix(inp, 2*len, from_pa, rsaBitlen, DIGIT_SIZE28);
+
+   /*
+   // q exponentiation
+   */
+   BNU_to_mb4_radix(q, len, q_pa, factorBitlen, DIGIT_SIZE28);
+   k0 = montFactor28_mb4(q);
+   montRR28_mb4(rr, q, k0, factorBitlen, len);
+   /* xq = x mod q (< 2*q) */
+   amred28_mb4(xq, inp, 2*len, q, k0, len);
+   amm28_mb4(xq, xq, rr, q, k0, len);
+
+   BNU_transpose_mb4(d, dq_pa, factorBitlen);
+   exp28_mb4(xq, xq, d, factorBitlen, q, rr, k0, len, tbl);
+
+   /*
+   // p exponentiation
+   */
+   BNU_to_mb4_radix(p, len, p_pa, factorBitlen, DIGIT_SIZE28);
+   k0 = montFactor28_mb4(p);
+   montRR28_mb4(rr, p, k0, factorBitlen, len);
+   /* xp = x mod p (< 2*p) */
+   amred28_mb4(xp, inp, 2*len, p, k0, len);
+   amm28_mb4(xp, xp, rr, p, k0, len);
+
+   BNU_transpose_mb4(d, dp_pa, factorBitlen);
+   exp28_mb4(xp, xp, d, factorBitlen, p, rr, k0, len, tbl);
+
+   /*
+   // crt recombination
+   */
+
+   /* xp = (xp-xq) mod p, xq < q < 2*p */
+   csub28_mb4(inp, xq, p, len);
+   modsub28_mb4(xp, xp, inp, p, len);
+
+   /* xp = (xp*iq) mod p */
+   BNU_to_mb4_radix(inp, len, iq_pa, factorBitlen, DIGIT_SIZE28);
+   amm28_mb4(xp, xp, rr, p, k0, len);
+   amm28_mb4(xp, xp, inp, p, k0, len);
+   csub28_mb4(xp, xp, p, len);
+
+   /* y = xp*q + xq */
+   copy28_mb4(inp, xq, len);
+   zero28_mb4(inp+len, len);
+   addmul28_mb4(inp, inp, xp, q, len);
+
+   mb4_radix_to_HexStr(to_pa, inp, 2*len, rsaBitlen, DIGIT_SIZE28);
+
+   /* clear exponents, p, q and table */
+   zero28_mb4(d, len64);
+   zero28_mb4(q, len);
+   zero28_mb4(p, len);
+   zero28_mb4(xq, 2*len);
+   zero28_mb4(tbl, EXP_TBL4_SIZE*len);
+}
+
+/*
+// mb8 operations
+//
+// Parameters are checked the same way as in ifma_rsa_mb8.c, the batch is processed
+// as two halves of 4 lanes. The lanes of NULL pointers are excluded,
+// the half is skipped if all its lanes are excluded.
+//
+// The buffer of mbx_RSA_Method_BufSize(m) is enough for the mb4 layers.
+*/
+
+mbx_status avx2_rsa_public_mb8(const int8u* const from_pa[8],
+                                     int8u* const to_pa[8],
+                              const int64u* const n_pa[8],
+                                        int expected_rsa_bitsize,
+                      const mbx_RSA_Method* m,
+                                     int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(RSA1024 != expected_rsa_bitsize && RSA2048 != expected_rsa_bitsize &&
+      RSA3072 != expected_rsa_bitsize && RSA4096 != expected_rsa_bitsize &&
+      RSA8192 != expected_rsa_bitsize) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   const int8u* from[8];
+   int8u* to[8];
+   const int64u* n[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      from[buf_no] = from_pa[buf_no];
+      to[buf_no] = to_pa[buf_no];
+      n[buf_no] = n_pa[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==from[buf_no] || NULL==to[buf_no] || NULL==n[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         from[buf_no] = NULL;
+         to[buf_no] = NULL;
+         n[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_pub65537_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PUB_KEY != OP_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      U64x4* buffer_mb4 = (U64x4*)IFMA_ALIGNED_PTR(buffer, 64);
+      for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+         if(0==((lanes>>buf_no) & 0xF))
+            continue;
+         rsa_pub_mb4(from+buf_no, to+buf_no, n+buf_no, expected_rsa_bitsize, buffer_mb4);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+mbx_status avx2_rsa_private_mb8(const int8u* const from_pa[8],
+                                      int8u* const to_pa[8],
+                               const int64u* const d_pa[8],
+                               const int64u* const n_pa[8],
+                                        int expected_rsa_bitsize,
+                      const mbx_RSA_Method* m,
+                                     int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==d_pa || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(RSA1024 != expected_rsa_bitsize && RSA2048 != expected_rsa_bitsize &&
+      RSA3072 != expected_rsa_bitsize && RSA4096 != expected_rsa_bitsize) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   const int8u* from[8];
+   int8u* to[8];
+   const int64u* d[8];
+   const int64u* n[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      from[buf_no] = from_pa[buf_no];
+      to[buf_no] = to_pa[buf_no];
+      d[buf_no] = d_pa[buf_no];
+      n[buf_no] = n_pa[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==from[buf_no] || NULL==to[buf_no] || NULL==d[buf_no] || NULL==n[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         from[buf_no] = NULL;
+         to[buf_no] = NULL;
+         d[buf_no] = n[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_private_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PRV2_KEY != OP_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      U64x4* buffer_mb4 = (U64x4*)IFMA_ALIGNED_PTR(buffer, 64);
+      for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+         if(0==((lanes>>buf_no) & 0xF))
+            continue;
+         rsa_prv2_mb4(from+buf_no, to+buf_no, d+buf_no, n+buf_no, expected_rsa_bitsize, buffer_mb4);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+mbx_status avx2_rsa_private_crt_mb8(const int8u* const from_pa[8],
+                                          int8u* const to_pa[8],
+                                   const int64u* const p_pa[8],
+                                   const int64u* const q_pa[8],
+                                   const int64u* const dp_pa[8],
+                                   const int64u* const dq_pa[8],
+                                   const int64u* const iq_pa[8],
+                                             int expected_rsa_bitsize,
+                           const mbx_RSA_Method* m,
+                                          int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(RSA1024 != expected_rsa_bitsize && RSA2048 != expected_rsa_bitsize &&
+      RSA3072 != expected_rsa_bitsize && RSA4096 != expected_rsa_bitsize) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values, lanes being processed */
+   int8u lanes = 0;
+   const int8u* from[8];
+   int8u* to[8];
+   const int64u* p[8];
+   const int64u* q[8];
+   const int64u* dp[8];
+   const int64u* dq[8];
+   const int64u* iq[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      from[buf_no] = from_pa[buf_no];
+      to[buf_no] = to_pa[buf_no];
+      p[buf_no] = p_pa[buf_no];
+      q[buf_no] = q_pa[buf_no];
+      dp[buf_no] = dp_pa[buf_no];
+      dq[buf_no] = dq_pa[buf_no];
+      iq[buf_no] = iq_pa[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==from[buf_no] || NULL==to[buf_no] || NULL==q[buf_no] || NULL==p[buf_no] ||
+         NULL==dq[buf_no] || NULL==dp[buf_no] || NULL==iq[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         from[buf_no] = NULL;
+         to[buf_no] = NULL;
+         p[buf_no] = q[buf_no] = dp[buf_no] = dq[buf_no] = iq[buf_no] = NULL;
+      }
+      else
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_private_crt_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PRV5_KEY != OP_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      U64x4* buffer_mb4 = (U64x4*)IFMA_ALIGNED_PTR(buffer, 64);
+      for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+         if(0==((lanes>>buf_no) & 0xF))
+            continue;
+         rsa_prv5_mb4(from+buf_no, to+buf_no, p+buf_no, q+buf_no, dp+buf_no, dq+buf_no, iq+buf_no,
+                      expected_rsa_bitsize, buffer_mb4);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+/*
+// public entry points
+*/
+DLL_PUBLIC
+mbx_status mbx_rsa_public_mb8(const int8u* const from_pa[8],
+                                    int8u* const to_pa[8],
+                             const int64u* const n_pa[8],
+                                       int expected_rsa_bitsize,
+                     const mbx_RSA_Method* m,
+                                    int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_rsa_public_mb8(from_pa, to_pa, n_pa, expected_rsa_bitsize, m, pBuffer);
+   return ifma_rsa_public_mb8(from_pa, to_pa, n_pa, expected_rsa_bitsize, m, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_mb8(const int8u* const from_pa[8],
+                                     int8u* const to_pa[8],
+                              const int64u* const d_pa[8],
+                              const int64u* const n_pa[8],
+                                       int expected_rsa_bitsize,
+                     const mbx_RSA_Method* m,
+                                    int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_rsa_private_mb8(from_pa, to_pa, d_pa, n_pa, expected_rsa_bitsize, m, pBuffer);
+   return ifma_rsa_private_mb8(from_pa, to_pa, d_pa, n_pa, expected_rsa_bitsize, m, pBuffer);
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_crt_mb8(const int8u* const from_pa[8],
+                                         int8u* const to_pa[8],
+                                  const int64u* const p_pa[8],
+                                  const int64u* const q_pa[8],
+                                  const int64u* const dp_pa[8],
+                                  const int64u* const dq_pa[8],
+                                  const int64u* const iq_pa[8],
+                                            int expected_rsa_bitsize,
+                          const mbx_RSA_Method* m,
+                                         int8u* pBuffer)
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_rsa_private_crt_mb8(from_pa, to_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa, expected_rsa_bitsize, m, pBuffer);
+   return ifma_rsa_private_crt_mb8(from_pa, to_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa, expected_rsa_bitsize, m, pBuffer);
+}
@@ -17,9 +17,9 @@
 
 #include <internal/common/ifma_math.h>
 
-void ifma_amm52x10_mb8(int64u *out_mb, const int64u *inpA_mb,
-                       const int64u *inpB_mb, const int64u *inpM_mb,
-                       const int64u *k0_mb) {
+void MB_FUNC_NAME(ifma_amm52x10_)(int64u *out_mb, const int64u *inpA_mb,
+                                  const int64u *inpB_mb, const int64u *inpM_mb,
+                                  const int64u *k0_mb) {
   U64 res00, res01, res02, res03, res04, res05, res06, res07, res08, res09;
   U64 K = loadu64(k0_mb);
   int itr;
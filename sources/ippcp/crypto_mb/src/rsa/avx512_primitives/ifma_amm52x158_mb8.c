@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+
+/*
+// The 8K modulus is too long to keep the accumulator in registers,
+// so unlike the shorter kernels this one is loop based and keeps res[] in memory
+*/
+#define LEN52 (158)
+
+void ifma_amm52x158_mb8(int64u *out_mb, const int64u *inpA_mb,
+                        const int64u *inpB_mb, const int64u *inpM_mb,
+                        const int64u *k0_mb) {
+  __ALIGN64 U64 res[LEN52];
+  U64 *a = (U64 *)inpA_mb;
+  U64 *b = (U64 *)inpB_mb;
+  U64 *m = (U64 *)inpM_mb;
+  U64 *r = (U64 *)out_mb;
+  U64 K = loadu64(k0_mb);
+  int itr, j;
+
+  for (j = 0; j < LEN52; j++)
+    res[j] = get_zero64();
+
+  for (itr = 0; itr < LEN52; itr++) {
+    U64 Yi;
+    U64 Bi = loadu64(b + itr);
+
+    for (j = 0; j < LEN52; j++)
+      res[j] = fma52lo(res[j], Bi, loadu64(a + j));
+
+    Yi = fma52lo(get_zero64(), res[0], K);
+
+    for (j = 0; j < LEN52; j++)
+      res[j] = fma52lo(res[j], Yi, loadu64(m + j));
+
+    /* shift accumulator down by one digit and add high parts */
+    res[1] = add64(res[1], srli64(res[0], DIGIT_SIZE));
+    for (j = 0; j < LEN52 - 1; j++) {
+      U64 t = fma52hi(res[j + 1], Bi, loadu64(a + j));
+      res[j] = fma52hi(t, Yi, loadu64(m + j));
+    }
+    res[LEN52 - 1] = fma52hi(fma52hi(get_zero64(), Bi, loadu64(a + LEN52 - 1)),
+                             Yi, loadu64(m + LEN52 - 1));
+  }
+
+  // Normalization
+  for (j = 0; j < LEN52 - 1; j++) {
+    storeu64(r + j, and64_const(res[j], DIGIT_MASK));
+    res[j + 1] = add64(res[j + 1], srli64(res[j], DIGIT_SIZE));
+  }
+  storeu64(r + LEN52 - 1, and64_const(res[LEN52 - 1], DIGIT_MASK));
+}
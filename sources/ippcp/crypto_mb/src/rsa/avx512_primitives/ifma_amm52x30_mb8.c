@@ -17,9 +17,9 @@
 
 #include <internal/common/ifma_math.h>
 
-void ifma_amm52x30_mb8(int64u *out_mb, const int64u *inpA_mb,
-                       const int64u *inpB_mb, const int64u *inpM_mb,
-                       const int64u *k0_mb) {
+void MB_FUNC_NAME(ifma_amm52x30_)(int64u *out_mb, const int64u *inpA_mb,
+                                  const int64u *inpB_mb, const int64u *inpM_mb,
+                                  const int64u *k0_mb) {
   U64 res00, res01, res02, res03, res04, res05, res06, res07, res08, res09,
       res10, res11, res12, res13, res14, res15, res16, res17, res18, res19,
       res20, res21, res22, res23, res24, res25, res26, res27, res28, res29;
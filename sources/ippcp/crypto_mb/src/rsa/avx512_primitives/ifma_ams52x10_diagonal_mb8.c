@@ -23,8 +23,8 @@
 #define ASM(a)
 #endif
 
-void AMS52x10_diagonal_mb8(int64u *out_mb, const int64u *inpA_mb,
-                           const int64u *inpM_mb, const int64u *k0_mb) {
+void MB_FUNC_NAME(AMS52x10_diagonal_)(int64u *out_mb, const int64u *inpA_mb,
+                                      const int64u *inpM_mb, const int64u *k0_mb) {
   U64 res0, res1, res2, res3, res4, res5, res6, res7, res8, res9, res10, res11,
       res12, res13, res14, res15, res16, res17, res18, res19;
 
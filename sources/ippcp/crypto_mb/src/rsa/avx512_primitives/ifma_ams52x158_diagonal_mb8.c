@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+
+/*
+// Loop based version of the diagonal squaring for 8K modulus
+*/
+#define LEN52 (158)
+
+void AMS52x158_diagonal_mb8(int64u *out_mb, const int64u *inpA_mb,
+                            const int64u *inpM_mb, const int64u *k0_mb) {
+
+  __ALIGN64 U64 res[2 * LEN52];
+  U64 k;
+  U64 *a = (U64 *)inpA_mb;
+  U64 *m = (U64 *)inpM_mb;
+  U64 *r = (U64 *)out_mb;
+  int i, j;
+
+  k = loadu64((U64 *)k0_mb);
+  for (i = 0; i < 2 * LEN52; ++i)
+    res[i] = get_zero64();
+
+  // Calculate full square
+  for (i = 0; i < LEN52; i++) { // Sum of the off-diagonal products
+    U64 ai = loadu64(a + i);
+    for (j = i + 1; j < LEN52; j++) {
+      U64 aj = loadu64(a + j);
+      res[i + j] = fma52lo(res[i + j], ai, aj);
+      res[i + j + 1] = fma52hi(res[i + j + 1], ai, aj);
+    }
+  }
+  for (i = 0; i < LEN52; i++) { // Double and add squares
+    U64 ai = loadu64(a + i);
+    res[2 * i] = add64(res[2 * i], res[2 * i]);
+    res[2 * i + 1] = add64(res[2 * i + 1], res[2 * i + 1]);
+    res[2 * i] = fma52lo(res[2 * i], ai, ai);
+    res[2 * i + 1] = fma52hi(res[2 * i + 1], ai, ai);
+  }
+
+  // Montgomery Reduction
+  for (i = 0; i < LEN52; i++) {
+    U64 u;
+    if (i > 0)
+      res[i] = add64(res[i], srli64(res[i - 1], DIGIT_SIZE));
+    u = mul52lo(res[i], k);
+    for (j = 0; j < LEN52; j++) {
+      U64 mj = loadu64(m + j);
+      res[i + j] = fma52lo(res[i + j], u, mj);
+      res[i + j + 1] = fma52hi(res[i + j + 1], u, mj);
+    }
+  }
+  res[LEN52] = add64(res[LEN52], srli64(res[LEN52 - 1], DIGIT_SIZE));
+
+  // Normalization
+  for (i = 0; i < LEN52 - 1; i++) {
+    r[i] = and64_const(res[LEN52 + i], DIGIT_MASK);
+    res[LEN52 + i + 1] =
+        add64(res[LEN52 + i + 1], srli64(res[LEN52 + i], DIGIT_SIZE));
+  }
+  r[LEN52 - 1] = and64_const(res[2 * LEN52 - 1], DIGIT_MASK);
+}
@@ -23,8 +23,8 @@
 #define ASM(a)
 #endif
 
-void AMS52x30_diagonal_mb8(int64u *out_mb, const int64u *inpA_mb,
-                           const int64u *inpM_mb, const int64u *k0_mb) {
+void MB_FUNC_NAME(AMS52x30_diagonal_)(int64u *out_mb, const int64u *inpA_mb,
+                                      const int64u *inpM_mb, const int64u *k0_mb) {
 
   __ALIGN64 U64 res[60];
   __ALIGN64 U64 u[30];
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+/*
+// Exponentiation by short public exponent (e=3, e=17, e=65537, ...).
+// Exponent is individual for each lane. Left-to-right binary addition chain:
+// squaring is applied to all lanes, multiplication by the base is merged
+// into the lanes where the current exponent's bit is set.
+// Lanes having shorter exponent start from Montgomery one and so are aligned
+// to the longest exponent of the batch.
+// No secret data processed, so the code is not constant time.
+*/
+
+typedef void (*amm52x_func)(int64u* out, const int64u* inpA, const int64u* inpB, const int64u* inpM, const int64u* k0);
+typedef void (*ams52x_func)(int64u* out, const int64u* inpA, const int64u* inpM, const int64u* k0);
+
+/* lanes where bit of exponent is set */
+static __mb_mask exp_bit_mask(U64 e, int bit)
+{
+   return cmp64_mask(and64(e, set64((int64u)1 << bit)), get_zero64(), _MM_CMPINT_NE);
+}
+
+static void exp52x_pub_mb8(int64u out[][8],
+                     const int64u base[][8],
+                     const int64u exponent[8],
+                     const int64u modulus[][8],
+                     const int64u toMont[][8],
+                     const int64u k0[8],
+                           int64u work_buffer[][8],
+                           int bitsize,
+                           amm52x_func amm,
+                           ams52x_func ams)
+{
+   int len52 = NUMBER_OF_DIGITS(bitsize, DIGIT_SIZE);
+
+   /* allocate red(undant) result Y, multiplier X and temporary T */
+   pint64u_x8 red_Y = (pint64u_x8)(work_buffer + 1);
+   pint64u_x8 red_X = (pint64u_x8)(red_Y + len52);
+   pint64u_x8 red_T = (pint64u_x8)(red_X + len52);
+
+   U64 e = loadu64(exponent);
+   int expBits = 0;
+   int n, i;
+
+   /* the longest exponent of the batch */
+   for(n=0; n<8; n++) {
+      int bits = 0;
+      int64u x = exponent[n];
+      for(; x; x>>=1) bits++;
+      expBits = (bits>expBits)? bits : expBits;
+   }
+
+   /* convert base into redundant domain */
+   zero_mb8(red_X, len52);
+   amm((int64u*)red_X, (int64u*)base, (int64u*)toMont, (int64u*)modulus, (int64u*)k0);
+
+   /* Montgomery one */
+   zero_mb8(red_T, len52);
+   _mm512_store_si512(red_T, _mm512_set1_epi64(1));
+   amm((int64u*)red_Y, (int64u*)toMont, (int64u*)red_T, (int64u*)modulus, (int64u*)k0);
+
+   /* start: base in the lanes of the longest exponent, one in others */
+   if(expBits) {
+      __mb_mask sel = exp_bit_mask(e, expBits-1);
+      for(i=0; i<len52; i++)
+         storeu64(red_Y[i], mask_mov64(loadu64(red_Y[i]), sel, loadu64(red_X[i])));
+   }
+
+   for(n=expBits-2; n>=0; n--) {
+      __mb_mask sel = exp_bit_mask(e, n);
+
+      ams((int64u*)red_Y, (int64u*)red_Y, (int64u*)modulus, (int64u*)k0);
+
+      if(sel) {
+         amm((int64u*)red_T, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+         for(i=0; i<len52; i++)
+            storeu64(red_Y[i], mask_mov64(loadu64(red_Y[i]), sel, loadu64(red_T[i])));
+      }
+   }
+
+   /* convert result back in regular 2^52 domain */
+   zero_mb8(red_X, len52);
+   _mm512_store_si512(red_X, _mm512_set1_epi64(1));
+   amm((int64u*)out, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+}
+
+void EXP52x20_pub_mb8(int64u out[][8],
+                const int64u base[][8],
+                const int64u exponent[8],
+                const int64u modulus[][8],
+                const int64u toMont[][8],
+                const int64u k0[8],
+                      int64u work_buffer[][8])
+{
+   exp52x_pub_mb8(out, base, exponent, modulus, toMont, k0, work_buffer, RSA_1K,
+                  ifma_amm52x20_mb8, AMS52x20_diagonal_mb8);
+}
+
+void EXP52x40_pub_mb8(int64u out[][8],
+                const int64u base[][8],
+                const int64u exponent[8],
+                const int64u modulus[][8],
+                const int64u toMont[][8],
+                const int64u k0[8],
+                      int64u work_buffer[][8])
+{
+   exp52x_pub_mb8(out, base, exponent, modulus, toMont, k0, work_buffer, RSA_2K,
+                  ifma_amm52x40_mb8, AMS52x40_diagonal_mb8);
+}
+
+void EXP52x60_pub_mb8(int64u out[][8],
+                const int64u base[][8],
+                const int64u exponent[8],
+                const int64u modulus[][8],
+                const int64u toMont[][8],
+                const int64u k0[8],
+                      int64u work_buffer[][8])
+{
+   exp52x_pub_mb8(out, base, exponent, modulus, toMont, k0, work_buffer, RSA_3K,
+                  ifma_amm52x60_mb8, AMS52x60_diagonal_mb8);
+}
+
+void EXP52x79_pub_mb8(int64u out[][8],
+                const int64u base[][8],
+                const int64u exponent[8],
+                const int64u modulus[][8],
+                const int64u toMont[][8],
+                const int64u k0[8],
+                      int64u work_buffer[][8])
+{
+   exp52x_pub_mb8(out, base, exponent, modulus, toMont, k0, work_buffer, RSA_4K,
+                  ifma_amm52x79_mb8, AMS52x79_diagonal_mb8);
+}
+
+void EXP52x158_pub_mb8(int64u out[][8],
+                const int64u base[][8],
+                const int64u exponent[8],
+                const int64u modulus[][8],
+                const int64u toMont[][8],
+                const int64u k0[8],
+                      int64u work_buffer[][8])
+{
+   exp52x_pub_mb8(out, base, exponent, modulus, toMont, k0, work_buffer, RSA_8K,
+                  ifma_amm52x158_mb8, AMS52x158_diagonal_mb8);
+}
@@ -33,7 +33,7 @@ const mbx_RSA_Method* mbx_RSA1K_pub65537_Method(void)
    static mbx_RSA_Method m = {
       RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
       RSA_BITLEN,
-      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2) * sizeof(int64u), /* buffer */
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*3 + 8) * sizeof(int64u), /* buffer */
       //ifma_BNU_to_mb8,
       //NULL,
       EXP52x20_pub65537_mb8,
@@ -41,7 +41,9 @@ const mbx_RSA_Method* mbx_RSA1K_pub65537_Method(void)
       NULL,
       NULL,
       NULL,
-      NULL
+      NULL,
+      NULL,
+      EXP52x20_pub_mb8
    };
    return &m;
    #undef RSA_BITLEN
@@ -56,7 +58,7 @@ const mbx_RSA_Method* mbx_RSA2K_pub65537_Method(void)
    static mbx_RSA_Method m = {
       RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
       RSA_BITLEN,
-      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2) * sizeof(int64u), /* buffer */
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*3 + 8) * sizeof(int64u), /* buffer */
       //ifma_BNU_to_mb8,
       //NULL,
       EXP52x40_pub65537_mb8,
@@ -64,7 +66,9 @@ const mbx_RSA_Method* mbx_RSA2K_pub65537_Method(void)
       NULL,
       NULL,
       NULL,
-      NULL
+      NULL,
+      NULL,
+      EXP52x40_pub_mb8
    };
    return &m;
 #undef RSA_BITLEN
@@ -79,7 +83,7 @@ const mbx_RSA_Method* mbx_RSA3K_pub65537_Method(void)
    static mbx_RSA_Method m = {
       RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
       RSA_BITLEN,
-      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2) * sizeof(int64u), /* buffer */
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*3 + 8) * sizeof(int64u), /* buffer */
       //ifma_BNU_to_mb8,
       //NULL,
       EXP52x60_pub65537_mb8,
@@ -87,7 +91,9 @@ const mbx_RSA_Method* mbx_RSA3K_pub65537_Method(void)
       NULL,
       NULL,
       NULL,
-      NULL
+      NULL,
+      NULL,
+      EXP52x60_pub_mb8
    };
    return &m;
 #undef RSA_BITLEN
@@ -102,7 +108,7 @@ const mbx_RSA_Method* mbx_RSA4K_pub65537_Method(void)
    static mbx_RSA_Method m = {
       RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
       RSA_BITLEN,
-      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2 + 1) * sizeof(int64u), /* buffer */
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*3 + 8) * sizeof(int64u), /* buffer */
       //ifma_BNU_to_mb8,
       //NULL,
       EXP52x79_pub65537_mb8,
@@ -110,7 +116,34 @@ const mbx_RSA_Method* mbx_RSA4K_pub65537_Method(void)
       NULL,
       NULL,
       NULL,
-      NULL
+      NULL,
+      NULL,
+      EXP52x79_pub_mb8
+   };
+   return &m;
+#undef RSA_BITLEN
+#undef LEN52
+}
+
+DLL_PUBLIC
+const mbx_RSA_Method* mbx_RSA8K_pub65537_Method(void)
+{
+#define RSA_BITLEN (RSA_8K)
+#define LEN52      (NUMBER_OF_DIGITS(RSA_BITLEN, DIGIT_SIZE))
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
+      RSA_BITLEN,
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*3 + 8) * sizeof(int64u), /* buffer */
+      //ifma_BNU_to_mb8,
+      //NULL,
+      EXP52x158_pub65537_mb8,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      EXP52x158_pub_mb8
    };
    return &m;
 #undef RSA_BITLEN
@@ -125,6 +158,7 @@ const mbx_RSA_Method* mbx_RSA_pub65537_Method(int rsaBitsize)
    case RSA_2K: return mbx_RSA2K_pub65537_Method();
    case RSA_3K: return mbx_RSA3K_pub65537_Method();
    case RSA_4K: return mbx_RSA4K_pub65537_Method();
+   case RSA_8K: return mbx_RSA8K_pub65537_Method();
    default: return NULL;
    }
 }
@@ -267,7 +301,8 @@ const mbx_RSA_Method* mbx_RSA1K_private_crt_Method(void)
       ifma_amred52x10_mb8,
       ifma_amm52x10_mb8,
       ifma_modsub52x10_mb8,
-      ifma_addmul52x10_mb8
+      ifma_addmul52x10_mb8,
+      EXP52x10_mb4
    };
    return &m;
    #undef RSA_BITLEN
@@ -294,7 +329,8 @@ const mbx_RSA_Method* mbx_RSA2K_private_crt_Method(void)
       ifma_amred52x20_mb8,
       ifma_amm52x20_mb8,
       ifma_modsub52x20_mb8,
-      ifma_addmul52x20_mb8
+      ifma_addmul52x20_mb8,
+      EXP52x20_mb4
    };
    return &m;
    #undef RSA_BITLEN
@@ -321,7 +357,8 @@ const mbx_RSA_Method* mbx_RSA3K_private_crt_Method(void)
       ifma_amred52x30_mb8,
       ifma_amm52x30_mb8,
       ifma_modsub52x30_mb8,
-      ifma_addmul52x30_mb8
+      ifma_addmul52x30_mb8,
+      EXP52x30_mb4
    };
    return &m;
    #undef RSA_BITLEN
@@ -348,7 +385,8 @@ const mbx_RSA_Method* mbx_RSA4K_private_crt_Method(void)
       ifma_amred52x40_mb8,
       ifma_amm52x40_mb8,
       ifma_modsub52x40_mb8,
-      ifma_addmul52x40_mb8
+      ifma_addmul52x40_mb8,
+      EXP52x40_mb4
    };
    return &m;
    #undef RSA_BITLEN
@@ -2372,7 +2372,7 @@ void ifma_mreduce52x_mb8(int64u pX[][8], int nsX, int64u pM[][8], int nsM)
 /* rr = 2^(2*ifmaBitLen) mod m */
 void ifma_montRR52x_mb8 (int64u pRR[][8], int64u pM[][8], int convBitLen)
 {
-   #define MAX_IFMA_MODULUS_BITLEN  BASE52_BITSIZE(RSA_4K)
+   #define MAX_IFMA_MODULUS_BITLEN  BASE52_BITSIZE(RSA_8K)
 
    /* buffer to hold 2^(2*MAX_IFMA_MODULUS_BITLEN) */
    __ALIGN64 int64u pwr2_mb8[(NUMBER_OF_DIGITS(2 * MAX_IFMA_MODULUS_BITLEN + 1, DIGIT_SIZE)) + 1][8]; /* +1 is necessary extension for ifma_mreduce52x_mb8() purpose */
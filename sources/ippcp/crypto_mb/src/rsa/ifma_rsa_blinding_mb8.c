@@ -0,0 +1,369 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_layer_cp.h>
+#include <internal/rsa/ifma_rsa_blinding.h>
+
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
+#define MAX_FACTOR_LEN64 (NUMBER_OF_DIGITS(RSA_4K/2, 64))
+
+static int is_supported_rsa_bitsize(int rsaBitsize)
+{
+   return (RSA_1K == rsaBitsize || RSA_2K == rsaBitsize ||
+           RSA_3K == rsaBitsize || RSA_4K == rsaBitsize);
+}
+
+/* get method and check it is suitable for the private crt operation of requested size */
+static const mbx_RSA_Method* blinding_method(const mbx_RSA_Method* m, int rsaBitlen)
+{
+   const mbx_RSA_Method* meth = m? m : mbx_RSA_private_crt_Method(rsaBitlen);
+   if(NULL==meth ||
+      RSA_PRV5_KEY != OP_RSA_ID(meth->id) ||
+      rsaBitlen != BISIZE_RSA_ID(meth->id))
+      return NULL;
+   return meth;
+}
+
+/*
+// prod = p*q, p and q are len64 words factors, prod is 2*len64 words
+// (schoolbook multiplication over 32-bit digits)
+*/
+static void factors_product(int64u prod[], const int64u p[], const int64u q[], int len64)
+{
+   int32u prod32[4*MAX_FACTOR_LEN64];
+   int len32 = len64*2;
+   int i, j;
+
+   for(i=0; i<len32*2; i++)
+      prod32[i] = 0;
+
+   for(i=0; i<len32; i++) {
+      int64u a = (int32u)(p[i/2] >> (32*(i&1)));
+      int64u carry = 0;
+      for(j=0; j<len32; j++) {
+         int64u b = (int32u)(q[j/2] >> (32*(j&1)));
+         int64u t = a*b + prod32[i+j] + carry;
+         prod32[i+j] = (int32u)t;
+         carry = t >> 32;
+      }
+      prod32[i+len32] = (int32u)carry;
+   }
+
+   for(i=0; i<len64*2; i++)
+      prod[i] = ((int64u)prod32[2*i+1] << 32) | prod32[2*i];
+
+   /* clear partial products */
+   for(i=0; i<len32*2; i++)
+      prod32[i] = 0;
+}
+
+/* check that n = p*q, n is given by rsaBitlen/64 words */
+static int is_modulus_of_factors(const int64u n[], const int64u p[], const int64u q[], int rsaBitlen)
+{
+   int64u prod[2*MAX_FACTOR_LEN64];
+   int len64 = NUMBER_OF_DIGITS(rsaBitlen/2, 64);
+   int64u diff = 0;
+   int i;
+
+   factors_product(prod, p, q, len64);
+   for(i=0; i<len64*2; i++)
+      diff |= prod[i] ^ n[i];
+   return 0==diff;
+}
+
+/* check that modulus of blinding object (radix 2^52 digits) is n = p*q */
+static int is_blinding_of_factors(const mbx_RSA_Blinding* blind, const int64u p[], const int64u q[], int rsaBitlen)
+{
+   int64u prod[2*MAX_FACTOR_LEN64+1];
+   int len64 = NUMBER_OF_DIGITS(rsaBitlen/2, 64);
+   int lenN52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+   const int64u* n52 = RSA_BLINDING_DATA(blind) + RSA_BLINDING_N_OFFSET(lenN52);
+   int64u diff = 0;
+   int i;
+
+   factors_product(prod, p, q, len64);
+   prod[len64*2] = 0;
+
+   for(i=0; i<lenN52; i++) {
+      int bit = i*DIGIT_SIZE;
+      int sh = bit%64;
+      int64u digit = prod[bit/64] >> sh;
+      if(sh > 64-DIGIT_SIZE)
+         digit |= prod[bit/64+1] << (64-sh);
+      diff |= (digit & DIGIT_MASK) ^ n52[i];
+   }
+   return 0==diff;
+}
+
+/*
+// size of blinding object
+*/
+DLL_PUBLIC
+int mbx_RSA_Blinding_BufSize(int rsaBitsize)
+{
+   if(!is_supported_rsa_bitsize(rsaBitsize))
+      return 0;
+   int len52 = NUMBER_OF_DIGITS(rsaBitsize, DIGIT_SIZE);
+   return (int)sizeof(mbx_RSA_Blinding) + RSA_BLINDING_DATA_LEN(len52) * (int)sizeof(int64u);
+}
+
+/*
+// blinding pair computation
+*/
+DLL_PUBLIC
+mbx_status mbx_rsa_blinding_init_mb8(mbx_RSA_Blinding* const blind_pa[8],
+                                   const int8u* const r_pa[8],
+                                  const int64u* const n_pa[8],
+                                  const int64u* const p_pa[8],
+                                  const int64u* const q_pa[8],
+                                  const int64u* const iq_pa[8],
+                                                int rsaBitlen,
+                              const mbx_RSA_Method* m,
+                                             int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth;
+   mbx_RSA_Blinding* valid_blind_pa[8];
+   const int64u* e_pa[8];
+   const int64u* pm2_pa[8];
+   const int64u* qm2_pa[8];
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==blind_pa || NULL==r_pa ||
+      NULL==n_pa || NULL==p_pa || NULL==q_pa || NULL==iq_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(rsaBitlen)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* test method */
+   meth = blinding_method(m, rsaBitlen);
+   if(NULL==meth) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      valid_blind_pa[buf_no] = NULL;
+      if(NULL==blind_pa[buf_no] || NULL==r_pa[buf_no] ||
+         NULL==n_pa[buf_no] || NULL==p_pa[buf_no] || NULL==q_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* modulus must be the product of the factors */
+      if(!is_modulus_of_factors(n_pa[buf_no], p_pa[buf_no], q_pa[buf_no], rsaBitlen)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      valid_blind_pa[buf_no] = blind_pa[buf_no];
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int len64 = NUMBER_OF_DIGITS(rsaBitlen/2, 64);
+
+      /* exponents: e=65537, p-2 and q-2 (Fermat inversion modulo factors) */
+      int64u e[MAX_FACTOR_LEN64];
+      int64u pm2[8][MAX_FACTOR_LEN64];
+      int64u qm2[8][MAX_FACTOR_LEN64];
+
+      int8u* buffer = pBuffer;
+      int n;
+
+      e[0] = 65537;
+      for(n=1; n<len64; n++)
+         e[n] = 0;
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         e_pa[buf_no] = pm2_pa[buf_no] = qm2_pa[buf_no] = NULL;
+         if(NULL==valid_blind_pa[buf_no])
+            continue;
+
+         int64u borrow_p = 2, borrow_q = 2;
+         for(n=0; n<len64; n++) {
+            int64u p = p_pa[buf_no][n];
+            int64u q = q_pa[buf_no][n];
+            pm2[buf_no][n] = p - borrow_p;
+            qm2[buf_no][n] = q - borrow_q;
+            borrow_p = (p < borrow_p);
+            borrow_q = (q < borrow_q);
+         }
+         e_pa[buf_no] = e;
+         pm2_pa[buf_no] = pm2[buf_no];
+         qm2_pa[buf_no] = qm2[buf_no];
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      ifma_cp_rsa_blinding_layer_mb8(valid_blind_pa, r_pa, e_pa, n_pa,
+                                     p_pa, q_pa, pm2_pa, qm2_pa, iq_pa,
+                                     rsaBitlen, meth,
+                                     buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+
+      /* clear exponents */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         for(n=0; n<len64; n++)
+            pm2[buf_no][n] = qm2[buf_no][n] = 0;
+      }
+   }
+
+   return status;
+}
+
+/*
+// blinded private crt operation
+*/
+DLL_PUBLIC
+mbx_status mbx_rsa_private_crt_blinded_mb8(const int8u* const from_pa[8],
+                                                 int8u* const to_pa[8],
+                                          const int64u* const p_pa[8],
+                                          const int64u* const q_pa[8],
+                                          const int64u* const dp_pa[8],
+                                          const int64u* const dq_pa[8],
+                                          const int64u* const iq_pa[8],
+                                      mbx_RSA_Blinding* const blind_pa[8],
+                                                    int expected_rsa_bitsize,
+                                  const mbx_RSA_Method* m,
+                                                 int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth;
+   const int8u* valid_from_pa[8];
+   int8u* valid_to_pa[8];
+   mbx_RSA_Blinding* valid_blind_pa[8];
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==blind_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(expected_rsa_bitsize)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* test method */
+   meth = blinding_method(m, expected_rsa_bitsize);
+   if(NULL==meth) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and blinding objects */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const mbx_RSA_Blinding* blind = blind_pa[buf_no];
+
+      valid_from_pa[buf_no] = NULL;
+      valid_to_pa[buf_no] = NULL;
+      valid_blind_pa[buf_no] = NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] || NULL==blind ||
+         NULL==p_pa[buf_no] || NULL==q_pa[buf_no] ||
+         NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* blinding object must be initialized for the private crt key of requested size */
+      if(RSA_ID(RSA_PRV5_KEY, expected_rsa_bitsize) != blind->id) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      /* and bound to the key: blinding modulus must be p*q */
+      if(!is_blinding_of_factors(blind, p_pa[buf_no], q_pa[buf_no], expected_rsa_bitsize)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      valid_from_pa[buf_no] = from_pa[buf_no];
+      valid_to_pa[buf_no] = to_pa[buf_no];
+      valid_blind_pa[buf_no] = blind_pa[buf_no];
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      ifma_cp_rsa_prv5_blinded_layer_mb8(valid_from_pa, valid_to_pa,
+                                         p_pa, q_pa, dp_pa, dq_pa, iq_pa,
+                                         valid_blind_pa,
+                                         expected_rsa_bitsize, meth,
+                                         buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
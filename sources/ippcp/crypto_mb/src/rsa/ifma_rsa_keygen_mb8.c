@@ -0,0 +1,715 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
+/*
+// Multi-buffer RSA key generation (public exponent e=65537)
+//
+// Every lane searches for its own pair of primes. Random odd candidates with two
+// top bits set are sieved by small primes incrementally (c, c+2, c+4, ...) and
+// the survivors are tested by Miller-Rabin. A Miller-Rabin round of all 8 lanes
+// is a single mb8 exponentiation, so each lane advances independently: a lane whose
+// candidate is rejected (or accepted after nTrials rounds) takes the next candidate
+// at the next round, and the lane which has found both primes stays idle.
+*/
+
+#define RSA_E           (65537)
+#define MAX_FACTOR_LEN64 (NUMBER_OF_DIGITS(RSA_4K/2, 64))
+#define MAX_FACTOR_LEN52 (NUMBER_OF_DIGITS(RSA_4K/2, DIGIT_SIZE))
+
+/* max distance from the random start point to the candidate */
+#define MAX_SIEVE_DELTA (1<<16)
+
+/* odd primes < 2048 */
+static const int16u small_primes[] = {
+      3,   5,   7,  11,  13,  17,  19,  23,  29,  31,  37,  41,  43,  47,  53,  59,
+     61,  67,  71,  73,  79,  83,  89,  97, 101, 103, 107, 109, 113, 127, 131, 137,
+    139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227,
+    229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313,
+    317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419,
+    421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509,
+    521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617,
+    619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727,
+    733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829,
+    839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947,
+    953, 967, 971, 977, 983, 991, 997,1009,1013,1019,1021,1031,1033,1039,1049,1051,
+   1061,1063,1069,1087,1091,1093,1097,1103,1109,1117,1123,1129,1151,1153,1163,1171,
+   1181,1187,1193,1201,1213,1217,1223,1229,1231,1237,1249,1259,1277,1279,1283,1289,
+   1291,1297,1301,1303,1307,1319,1321,1327,1361,1367,1373,1381,1399,1409,1423,1427,
+   1429,1433,1439,1447,1451,1453,1459,1471,1481,1483,1487,1489,1493,1499,1511,1523,
+   1531,1543,1549,1553,1559,1567,1571,1579,1583,1597,1601,1607,1609,1613,1619,1621,
+   1627,1637,1657,1663,1667,1669,1693,1697,1699,1709,1721,1723,1733,1741,1747,1753,
+   1759,1777,1783,1787,1789,1801,1811,1823,1831,1847,1861,1867,1871,1873,1877,1879,
+   1889,1901,1907,1913,1931,1933,1949,1951,1973,1979,1987,1993,1997,1999,2003,2011,
+   2017,2027,2029,2039,
+};
+#define NUM_SMALL_PRIMES ((int)(sizeof(small_primes)/sizeof(small_primes[0])))
+
+/* prime search state of the lane */
+typedef struct {
+   int64u  start[MAX_FACTOR_LEN64];       /* random start point */
+   int32u  residue[NUM_SMALL_PRIMES];     /* start mod small primes */
+   int32u  residue_e;                     /* start mod e */
+   int32u  delta;                         /* candidate = start + delta */
+   int64u  cand[MAX_FACTOR_LEN64];        /* candidate */
+   int64u  exp[MAX_FACTOR_LEN64];         /* (cand-1) = 2^s * exp */
+   int     s;
+   int     rounds;                        /* number of Miller-Rabin rounds passed */
+   int     nprimes;                       /* number of primes found */
+} keygen_lane;
+
+/* random number generation status */
+#define RND_OK    (0)
+#define RND_FAIL  (1)
+
+/*
+// basic operations over BNU
+*/
+static int32u bnu_mod32(const int64u* a, int len, int32u m)
+{
+   const int32u* a32 = (const int32u*)a;
+   int64u r = 0;
+   int i;
+   for(i=len*2-1; i>=0; i--)
+      r = ((r<<32) | a32[i]) % m;
+   return (int32u)r;
+}
+
+/* r = a*k + c, returns carry */
+static int32u bnu_mul_add32(int64u* r, const int64u* a, int len, int32u k, int32u c)
+{
+   const int32u* a32 = (const int32u*)a;
+   int32u* r32 = (int32u*)r;
+   int64u t = c;
+   int i;
+   for(i=0; i<len*2; i++) {
+      t += (int64u)a32[i] * k;
+      r32[i] = (int32u)t;
+      t >>= 32;
+   }
+   return (int32u)t;
+}
+
+/* r = (hi:a)/k (hi < k) */
+static void bnu_div32(int64u* r, const int64u* a, int len, int32u hi, int32u k)
+{
+   const int32u* a32 = (const int32u*)a;
+   int32u* r32 = (int32u*)r;
+   int64u t = hi;
+   int i;
+   for(i=len*2-1; i>=0; i--) {
+      t = (t<<32) | a32[i];
+      r32[i] = (int32u)(t / k);
+      t %= k;
+   }
+}
+
+/* r = a-b, returns borrow */
+static int64u bnu_sub(int64u* r, const int64u* a, const int64u* b, int len)
+{
+   int64u borrow = 0;
+   int i;
+   for(i=0; i<len; i++) {
+      int64u ai = a[i];
+      int64u t = ai - b[i];
+      int64u bo = (t > ai);
+      r[i] = t - borrow;
+      borrow = bo | (r[i] > t);
+   }
+   return borrow;
+}
+
+/* r = a-k (k < 2^64), returns borrow */
+static int64u bnu_sub_word(int64u* r, const int64u* a, int len, int64u k)
+{
+   int i;
+   for(i=0; i<len; i++) {
+      int64u ai = a[i];
+      r[i] = ai - k;
+      k = (r[i] > ai);
+   }
+   return k;
+}
+
+/* r = a+k (k < 2^64), returns carry */
+static int64u bnu_add_word(int64u* r, const int64u* a, int len, int64u k)
+{
+   int i;
+   for(i=0; i<len; i++) {
+      r[i] = a[i] + k;
+      k = (r[i] < k);
+   }
+   return k;
+}
+
+static int bnu_bitsize(const int64u* a, int len)
+{
+   int i;
+   for(i=len-1; i>=0; i--) {
+      if(a[i]) {
+         int64u x = a[i];
+         int bits = 0;
+         while(x) { bits++; x >>= 1; }
+         return i*64 + bits;
+      }
+   }
+   return 0;
+}
+
+/* x^(-1) mod e */
+static int32u inv_mod_e(int32u x)
+{
+   int64u r = 1, b = x % RSA_E;
+   int32u n = RSA_E-2;
+   while(n) {
+      if(n & 1) r = r*b % RSA_E;
+      b = b*b % RSA_E;
+      n >>= 1;
+   }
+   return (int32u)r;
+}
+
+/* r = e^(-1) mod x (x is coprime to e), r must accommodate len+1 words */
+static void inv_e_mod(int64u* r, const int64u* x, int len)
+{
+   /* k*x + 1 = 0 mod e  =>  r = (k*x + 1)/e */
+   int32u k = RSA_E - inv_mod_e(bnu_mod32(x, len, RSA_E));
+   int32u hi = bnu_mul_add32(r, x, len, k, 1);
+   bnu_div32(r, r, len, hi, RSA_E);
+}
+
+/*
+// prime search
+*/
+
+/* new random start point of factorBitlen bits, two top bits and low bit set */
+static int new_start(keygen_lane* lane, int factorBitlen, mbx_rand_func rndFunc, void* pRndParam)
+{
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   int topBit = (factorBitlen-1) % 64;
+   int i;
+
+   for(i=0; i<len64; i++)
+      lane->start[i] = 0;
+   if(0 != rndFunc((int8u*)lane->start, factorBitlen/8, pRndParam))
+      return RND_FAIL;
+
+   lane->start[len64-1] |= (int64u)1 << topBit;
+   lane->start[len64-1] |= (int64u)1 << (topBit-1);
+   lane->start[0] |= 1;
+
+   for(i=0; i<NUM_SMALL_PRIMES; i++)
+      lane->residue[i] = bnu_mod32(lane->start, len64, small_primes[i]);
+   lane->residue_e = bnu_mod32(lane->start, len64, RSA_E);
+   lane->delta = 0;
+   return RND_OK;
+}
+
+/* next candidate surviving the sieve: no small factors and (cand-1) coprime to e */
+static int next_candidate(keygen_lane* lane, int factorBitlen, mbx_rand_func rndFunc, void* pRndParam)
+{
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   for(;;) {
+      int i;
+      if(lane->delta > MAX_SIEVE_DELTA) {
+         if(RND_OK != new_start(lane, factorBitlen, rndFunc, pRndParam))
+            return RND_FAIL;
+      }
+
+      for(i=0; i<NUM_SMALL_PRIMES; i++) {
+         if(0 == (lane->residue[i] + lane->delta) % small_primes[i])
+            break;
+      }
+      if(i==NUM_SMALL_PRIMES && 1 != (lane->residue_e + lane->delta) % RSA_E) {
+         /* candidate must not overflow factorBitlen */
+         bnu_add_word(lane->cand, lane->start, len64, lane->delta);
+         if(bnu_bitsize(lane->cand, len64) == factorBitlen)
+            break;
+         lane->delta = MAX_SIEVE_DELTA+2;
+         continue;
+      }
+      lane->delta += 2;
+   }
+   lane->delta += 2;
+
+   /* cand-1 = 2^s * exp */
+   {
+      int i, s = 0;
+      bnu_sub_word(lane->exp, lane->cand, len64, 1);
+      while(0 == ((lane->exp[s/64] >> (s%64)) & 1))
+         s++;
+      for(i=0; i<len64; i++) {
+         int idx = i + s/64;
+         int64u lo = (idx<len64)? lane->exp[idx] : 0;
+         int64u hi = (idx+1<len64)? lane->exp[idx+1] : 0;
+         lane->exp[i] = (s%64)? (lo >> (s%64)) | (hi << (64 - s%64)) : lo;
+      }
+      lane->s = s;
+   }
+   lane->rounds = 0;
+   return RND_OK;
+}
+
+/* random Miller-Rabin witness 2 <= a < 2^(factorBitlen-2) < cand */
+static int new_witness(int64u* a, int factorBitlen, mbx_rand_func rndFunc, void* pRndParam)
+{
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   int topBit = (factorBitlen-1) % 64;
+   int i;
+
+   for(i=0; i<len64; i++)
+      a[i] = 0;
+   if(0 != rndFunc((int8u*)a, factorBitlen/8, pRndParam))
+      return RND_FAIL;
+
+   a[len64-1] &= ((int64u)1 << (topBit-1)) - 1;
+   if(bnu_bitsize(a, len64) < 2)
+      a[0] = 2;
+   return RND_OK;
+}
+
+/* is lane value of mb8 number equal to BNU in radix 2^52 */
+static int is_equal_lane(const int64u x_mb8[][8], const int64u* y, int len52, int buf_no)
+{
+   int64u diff = 0;
+   int i;
+   for(i=0; i<len52; i++)
+      diff |= x_mb8[i][buf_no] ^ y[i];
+   return 0==diff;
+}
+
+/*
+// Miller-Rabin round over candidates of all lanes,
+// returns mask of lanes whose candidates passed the round
+*/
+static int8u miller_rabin_mb8(const int64u* const cand_pa[8],
+                              const int64u* const exp_pa[8],
+                              const int64u* const witness_pa[8],
+                              const int s[8],
+                                    int8u lanes,
+                                    int factorBitlen,
+                              const mbx_RSA_Method* m,
+                                    pint64u_x8 pBuffer_x8)
+{
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 p_mb8 = k0_mb8 +1;
+   pint64u_x8 rr_mb8 = p_mb8 +len52;
+   pint64u_x8 y_mb8 = rr_mb8 +len52;
+   pint64u_x8 d_mb8 = y_mb8 +len52;
+   pint64u_x8 work_buffer = d_mb8 +len64;
+
+   __ALIGN64 int64u one[MAX_FACTOR_LEN52];
+   __ALIGN64 int64u pm1[8][MAX_FACTOR_LEN52];
+
+   int8u passed = 0;
+   int8u pending = 0;
+   int max_s = 0;
+   int buf_no, i, j;
+
+   /* y = a^exp mod cand */
+   ifma_BNU_to_mb8(p_mb8, cand_pa, factorBitlen);
+   ifma_montFactor52_mb8(k0_mb8[0], p_mb8[0]);
+   ifma_montRR52x_mb8(rr_mb8, p_mb8, factorBitlen);
+   ifma_BNU_to_mb8(y_mb8, witness_pa, factorBitlen);
+   ifma_BNU_transpose_copy(d_mb8, exp_pa, factorBitlen);
+
+   m->expfun(y_mb8,
+      (const int64u(*)[8])y_mb8,
+      (const int64u(*)[8])d_mb8,
+      (const int64u(*)[8])p_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0],
+      (int64u (*)[8])work_buffer);
+
+   /* y==1 or y==cand-1 pass the round */
+   for(i=0; i<len52; i++)
+      one[i] = 0;
+   one[0] = 1;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      for(i=0; i<len52; i++)
+         pm1[buf_no][i] = p_mb8[i][buf_no];
+      pm1[buf_no][0] -= 1;
+
+      if(0 == ((lanes>>buf_no) &1))
+         continue;
+      if(is_equal_lane((const int64u(*)[8])y_mb8, one, len52, buf_no) ||
+         is_equal_lane((const int64u(*)[8])y_mb8, pm1[buf_no], len52, buf_no))
+         passed |= (int8u)(1<<buf_no);
+      else if(s[buf_no] > 1) {
+         pending |= (int8u)(1<<buf_no);
+         if(max_s < s[buf_no]) max_s = s[buf_no];
+      }
+   }
+
+   /* y = y^2 mod cand, up to s-1 times: y==cand-1 pass, y==1 fail */
+   for(j=1; j<max_s && pending; j++) {
+      m->ammul52x((int64u*)y_mb8, (int64u*)y_mb8, (int64u*)y_mb8, (int64u*)p_mb8, k0_mb8[0]);
+      m->ammul52x((int64u*)y_mb8, (int64u*)y_mb8, (int64u*)rr_mb8, (int64u*)p_mb8, k0_mb8[0]);
+      m->modsub52x(y_mb8, (const int64u(*)[8])y_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(0 == ((pending>>buf_no) &1))
+            continue;
+         if(is_equal_lane((const int64u(*)[8])y_mb8, pm1[buf_no], len52, buf_no)) {
+            passed |= (int8u)(1<<buf_no);
+            pending &= (int8u)~(1<<buf_no);
+         }
+         else if(is_equal_lane((const int64u(*)[8])y_mb8, one, len52, buf_no) || j+1 >= s[buf_no])
+            pending &= (int8u)~(1<<buf_no);
+      }
+   }
+
+   zero_mb8(d_mb8, len64);
+   zero_mb8(y_mb8, len52);
+   return passed;
+}
+
+/*
+// key generation layer
+*/
+static mbx_status rsa_generate_keys(int64u* const n_pa[8],
+                                    int64u* const d_pa[8],
+                                    int64u* const p_pa[8],
+                                    int64u* const q_pa[8],
+                                    int64u* const dp_pa[8],
+                                    int64u* const dq_pa[8],
+                                    int64u* const iq_pa[8],
+                                    int8u lanes,
+                                    int rsaBitlen,
+                                    int nTrials,
+                                    mbx_rand_func rndFunc,
+                                    void* pRndParam,
+                              const mbx_RSA_Method* m,
+                                    int8u* pBuffer)
+{
+   int factorBitlen = rsaBitlen/2;
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   int nlen64 = NUMBER_OF_DIGITS(rsaBitlen, 64);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   keygen_lane lane[8];
+   int64u witness[8][MAX_FACTOR_LEN64];
+   const int64u* cand_pa[8];
+   const int64u* exp_pa[8];
+   const int64u* witness_pa[8];
+   int s[8];
+
+   mbx_status status = 0;
+   int8u active = lanes;
+   int buf_no, i;
+
+   /* first candidates */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      lane[buf_no].nprimes = 0;
+      if(0 == ((active>>buf_no) &1))
+         continue;
+      if(RND_OK != new_start(&lane[buf_no], factorBitlen, rndFunc, pRndParam) ||
+         RND_OK != next_candidate(&lane[buf_no], factorBitlen, rndFunc, pRndParam)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         active &= (int8u)~(1<<buf_no);
+      }
+   }
+
+   /*
+   // search for primes
+   */
+   while(active) {
+      int8u passed;
+      int any_lane = 0;
+
+      /* idle lanes repeat the data of any active lane */
+      while(0 == ((active>>any_lane) &1))
+         any_lane++;
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int src = ((active>>buf_no) &1)? buf_no : any_lane;
+         if(src==buf_no &&
+            RND_OK != new_witness(witness[buf_no], factorBitlen, rndFunc, pRndParam)) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+            active &= (int8u)~(1<<buf_no);
+         }
+         cand_pa[buf_no] = lane[src].cand;
+         exp_pa[buf_no] = lane[src].exp;
+         witness_pa[buf_no] = witness[src];
+         s[buf_no] = lane[src].s;
+      }
+      if(0 == ((active>>any_lane) &1))
+         continue;
+
+      passed = miller_rabin_mb8(cand_pa, exp_pa, witness_pa, s, active, factorBitlen, m, pBuffer_x8);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         keygen_lane* ln = &lane[buf_no];
+         int next = 1;
+
+         if(0 == ((active>>buf_no) &1))
+            continue;
+
+         if((passed>>buf_no) &1) {
+            ln->rounds++;
+            if(ln->rounds < nTrials)
+               next = 0;
+            else if(0 == ln->nprimes) {
+               /* p found, q is searched from the new start point */
+               for(i=0; i<len64; i++)
+                  p_pa[buf_no][i] = ln->cand[i];
+               ln->nprimes = 1;
+               ln->delta = MAX_SIEVE_DELTA+2;
+            }
+            else {
+               /* q found, |p-q| > 2^(factorBitlen-100) is required */
+               int64u diff[MAX_FACTOR_LEN64];
+               if(bnu_sub(diff, p_pa[buf_no], ln->cand, len64))
+                  bnu_sub(diff, ln->cand, p_pa[buf_no], len64);
+               if(bnu_bitsize(diff, len64) > factorBitlen-100) {
+                  for(i=0; i<len64; i++)
+                     q_pa[buf_no][i] = ln->cand[i];
+                  ln->nprimes = 2;
+                  active &= (int8u)~(1<<buf_no);
+                  next = 0;
+               }
+            }
+         }
+
+         if(next &&
+            RND_OK != next_candidate(ln, factorBitlen, rndFunc, pRndParam)) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+            active &= (int8u)~(1<<buf_no);
+         }
+      }
+   }
+
+   /* lanes having both primes */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(2 != lane[buf_no].nprimes)
+         lanes &= (int8u)~(1<<buf_no);
+   }
+
+   /*
+   // key components
+   */
+   if(lanes) {
+      /* allocate mb8 buffers */
+      pint64u_x8 k0_mb8 = pBuffer_x8;
+      pint64u_x8 p_mb8 = k0_mb8 +1;
+      pint64u_x8 q_mb8 = p_mb8 +len52;
+      pint64u_x8 rr_mb8 = q_mb8 +len52;
+      pint64u_x8 d_mb8 = rr_mb8 +len52;
+      pint64u_x8 n_mb8 = d_mb8 +len64;
+      pint64u_x8 work_buffer = n_mb8 + len52*2;
+
+      const int64u* pp_pa[8];
+      const int64u* qq_pa[8];
+      int64u* nn_pa[8];
+      int64u* iiq_pa[8];
+      int64u pm2[8][MAX_FACTOR_LEN64];
+      const int64u* pm2_pa[8];
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int active_lane = (lanes>>buf_no) &1;
+         pp_pa[buf_no] = active_lane? p_pa[buf_no] : NULL;
+         qq_pa[buf_no] = active_lane? q_pa[buf_no] : NULL;
+         nn_pa[buf_no] = active_lane? n_pa[buf_no] : NULL;
+         iiq_pa[buf_no] = active_lane? iq_pa[buf_no] : NULL;
+         pm2_pa[buf_no] = active_lane? pm2[buf_no] : NULL;
+         if(active_lane)
+            bnu_sub_word(pm2[buf_no], p_pa[buf_no], len64, 2);
+      }
+
+      /* n = p*q */
+      ifma_BNU_to_mb8(p_mb8, pp_pa, factorBitlen);
+      ifma_BNU_to_mb8(q_mb8, qq_pa, factorBitlen);
+      zero_mb8(n_mb8, len52*2);
+      m->mla52x(n_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])q_mb8);
+      ifma_mb8_to_BNU(nn_pa, (const int64u(*)[8])n_mb8, rsaBitlen);
+
+      /* iq = q^(p-2) mod p */
+      ifma_montFactor52_mb8(k0_mb8[0], p_mb8[0]);
+      ifma_montRR52x_mb8(rr_mb8, p_mb8, factorBitlen);
+      ifma_BNU_transpose_copy(d_mb8, pm2_pa, factorBitlen);
+      m->expfun(q_mb8,
+         (const int64u(*)[8])q_mb8,
+         (const int64u(*)[8])d_mb8,
+         (const int64u(*)[8])p_mb8,
+         (const int64u(*)[8])rr_mb8,
+         k0_mb8[0],
+         (int64u (*)[8])work_buffer);
+      m->modsub52x(q_mb8, (const int64u(*)[8])q_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);
+      ifma_mb8_to_BNU(iiq_pa, (const int64u(*)[8])q_mb8, factorBitlen);
+
+      /* dp = e^(-1) mod (p-1), dq = e^(-1) mod (q-1), d = e^(-1) mod (p-1)*(q-1) */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int64u x[MAX_FACTOR_LEN64*2+1];
+         int64u phi[MAX_FACTOR_LEN64*2];
+
+         if(0 == ((lanes>>buf_no) &1))
+            continue;
+
+         bnu_sub_word(x, p_pa[buf_no], len64, 1);
+         inv_e_mod(x, x, len64);
+         for(i=0; i<len64; i++)
+            dp_pa[buf_no][i] = x[i];
+
+         bnu_sub_word(x, q_pa[buf_no], len64, 1);
+         inv_e_mod(x, x, len64);
+         for(i=0; i<len64; i++)
+            dq_pa[buf_no][i] = x[i];
+
+         if(NULL != d_pa[buf_no]) {
+            /* phi = n - p - q + 1 */
+            for(i=0; i<nlen64; i++)
+               x[i] = (i<len64)? p_pa[buf_no][i] : 0;
+            bnu_sub(phi, n_pa[buf_no], x, nlen64);
+            for(i=0; i<nlen64; i++)
+               x[i] = (i<len64)? q_pa[buf_no][i] : 0;
+            bnu_sub(phi, phi, x, nlen64);
+            bnu_add_word(phi, phi, nlen64, 1);
+
+            inv_e_mod(x, phi, nlen64);
+            for(i=0; i<nlen64; i++)
+               d_pa[buf_no][i] = x[i];
+            for(i=0; i<nlen64; i++)
+               phi[i] = x[i] = 0;
+         }
+         for(i=0; i<len64*2+1; i++)
+            x[i] = 0;
+         for(i=0; i<len64; i++)
+            pm2[buf_no][i] = 0;
+      }
+
+      zero_mb8(d_mb8, len64);
+      zero_mb8(p_mb8, len52);
+      zero_mb8(q_mb8, len52);
+      zero_mb8(n_mb8, len52*2);
+   }
+
+   /* clear search state */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      for(i=0; i<MAX_FACTOR_LEN64; i++) {
+         lane[buf_no].start[i] = lane[buf_no].cand[i] = lane[buf_no].exp[i] = 0;
+         witness[buf_no][i] = 0;
+      }
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_generate_keys_mb8(int64u* const n_pa[8],
+                                     int64u* const d_pa[8],
+                                     int64u* const p_pa[8],
+                                     int64u* const q_pa[8],
+                                     int64u* const dp_pa[8],
+                                     int64u* const dq_pa[8],
+                                     int64u* const iq_pa[8],
+                                               int rsaBitlen,
+                                               int nTrials,
+                                     mbx_rand_func rndFunc,
+                                             void* pRndParam,
+                                            int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth;
+   int64u* valid_d_pa[8];
+
+   mbx_status status = 0;
+   int8u lanes = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==n_pa || NULL==p_pa || NULL==q_pa ||
+      NULL==dp_pa || NULL==dq_pa || NULL==iq_pa || NULL==rndFunc) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size and number of Miller-Rabin rounds */
+   if((RSA_1K != rsaBitlen && RSA_2K != rsaBitlen &&
+       RSA_3K != rsaBitlen && RSA_4K != rsaBitlen) || 1 > nTrials) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   meth = mbx_RSA_private_crt_Method(rsaBitlen);
+   if(NULL==meth) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      valid_d_pa[buf_no] = (NULL==d_pa)? NULL : d_pa[buf_no];
+
+      if(NULL==n_pa[buf_no] || NULL==p_pa[buf_no] || NULL==q_pa[buf_no] ||
+         NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      lanes |= (int8u)(1<<buf_no);
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      status |= rsa_generate_keys(n_pa, valid_d_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa,
+                                  lanes, rsaBitlen, nTrials, rndFunc, pRndParam,
+                                  meth, buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
@@ -19,6 +19,8 @@
 #include <internal/common/ifma_cvt52.h>
 #include <internal/rsa/ifma_rsa_arith.h>
 #include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_prepared_key.h>
+#include <internal/rsa/ifma_rsa_blinding.h>
 
 /*
 // public exponent e=65537 implied
@@ -67,6 +69,69 @@ void ifma_cp_rsa_pub_layer_mb8(const int8u* const from_pa[8],
    ifma_mb8_to_HexStr8(to_pa, (const int64u(*)[8])inout_mb8, rsaBitlen);
 }
 
+/*
+// short public exponent, individual for each lane
+*/
+void ifma_cp_rsa_pub_exp_layer_mb8(const int8u* const from_pa[8],
+                                         int8u* const to_pa[8],
+                                   const int64u e[8],
+                                   const int64u* const n_pa[8],
+                                         int rsaBitlen,
+                                   const mbx_RSA_Method* m,
+                                         int8u* pBuffer)
+{
+   int len52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 rr_mb8 = k0_mb8 +1;
+   pint64u_x8 inout_mb8 = rr_mb8 +len52;
+   pint64u_x8 n_mb8 = inout_mb8 +len52;
+   pint64u_x8 work_buffer = n_mb8 + len52;
+
+   /* batch of e=65537 uses dedicated addition chain */
+   int is65537 = 1;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      is65537 &= (0x10001==e[buf_no]);
+
+   /* convert modulus to ifma fmt */
+   zero_mb8(n_mb8, MULTIPLE_OF(len52, 10));
+   ifma_BNU_to_mb8(n_mb8, n_pa, rsaBitlen);
+
+   /* compute k0[] */
+   ifma_montFactor52_mb8(k0_mb8[0], n_mb8[0]);
+
+   /* compute to_Montgomery domain converters */
+   ifma_montRR52x_mb8(rr_mb8, n_mb8, rsaBitlen);
+
+   /* convert input to ifma fmt */
+   ifma_HexStr8_to_mb8(inout_mb8, from_pa, rsaBitlen);
+
+   /* exponentiation */
+   if(is65537)
+      m->expfunc65537(inout_mb8,
+               (const int64u (*)[8])inout_mb8,
+               (const int64u (*)[8])n_mb8,
+               (const int64u (*)[8])rr_mb8,
+               k0_mb8[0],
+               (int64u (*)[8])work_buffer);
+   else
+      m->expfun_pub(inout_mb8,
+               (const int64u (*)[8])inout_mb8,
+               e,
+               (const int64u (*)[8])n_mb8,
+               (const int64u (*)[8])rr_mb8,
+               k0_mb8[0],
+               (int64u (*)[8])work_buffer);
+
+   /* convert result from ifma fmt */
+   ifma_mb8_to_HexStr8(to_pa, (const int64u(*)[8])inout_mb8, rsaBitlen);
+}
+
 /*
 // private key
 */
@@ -128,6 +193,186 @@ void ifma_cp_rsa_prv2_layer_mb8(const int8u* const from_pa[8],
 /*
 // private key (ctr)
 */
+
+/* mask of the lanes being processed (both input and output are specified) */
+static int8u used_lanes(const int8u* const from_pa[8], int8u* const to_pa[8])
+{
+   int8u lanes = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL!=from_pa[buf_no] && NULL!=to_pa[buf_no])
+         lanes |= (int8u)(1<<buf_no);
+   }
+   return lanes;
+}
+
+/*
+// exponentiation of the CRT component
+//
+// If no more than 4 lanes are processed, the lanes are packed
+// and the half-width (mb4) exponentiation is used instead of mb8 one.
+// Packed operands and mb4 work buffer fit into the mb8 work buffer.
+*/
+static void exp_crt_component(int64u out[][8],
+                        const int64u base[][8],
+                        const int64u exp[][8],
+                        const int64u modulus[][8],
+                        const int64u toMont[][8],
+                        const int64u k0[8],
+                              int64u work_buffer[][8],
+                              int factorBitlen,
+                              int8u lanes,
+                        const mbx_RSA_Method* m)
+{
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   int num_lanes = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      num_lanes += (lanes>>buf_no) &1;
+
+   if(NULL!=m->expfun_mb4 && num_lanes<=4) {
+      /* allocate mb4 buffers */
+      pint64u_x4 k0_mb4 = (pint64u_x4)work_buffer;
+      pint64u_x4 x_mb4 = k0_mb4 +1;
+      pint64u_x4 d_mb4 = x_mb4 +len52;
+      pint64u_x4 n_mb4 = d_mb4 +len64;
+      pint64u_x4 rr_mb4 = n_mb4 +len52;
+      pint64u_x4 work_mb4 = rr_mb4 +len52;
+
+      ifma_mb8_to_mb4(k0_mb4, (const int64u(*)[8])k0, 1, lanes);
+      ifma_mb8_to_mb4(x_mb4, base, len52, lanes);
+      ifma_mb8_to_mb4(d_mb4, exp, len64, lanes);
+      ifma_mb8_to_mb4(n_mb4, modulus, len52, lanes);
+      ifma_mb8_to_mb4(rr_mb4, toMont, len52, lanes);
+
+      m->expfun_mb4(x_mb4,
+         (const int64u(*)[4])x_mb4,
+         (const int64u(*)[4])d_mb4,
+         (const int64u(*)[4])n_mb4,
+         (const int64u(*)[4])rr_mb4,
+         k0_mb4[0],
+         work_mb4);
+
+      ifma_mb4_to_mb8(out, (const int64u(*)[4])x_mb4, len52, lanes);
+
+      /* clear exponents */
+      zero_mb4(d_mb4, len64);
+   }
+   else {
+      m->expfun(out, base, exp, modulus, toMont, k0, work_buffer);
+   }
+}
+
+/*
+// crt exponentiation
+//
+// The layer buffer is allocated as k0, inp[len52*2], p, q, d, rr, xp, xq, work.
+// The input (less than 2*p*q) is taken from inp_mb8 slot of the buffer
+// and the result (less than p*q) is returned into the same slot.
+*/
+static void prv5_crt_exp(int64u* pBuffer,
+                   const int64u* const p_pa[8],
+                   const int64u* const q_pa[8],
+                   const int64u* const dp_pa[8],
+                   const int64u* const dq_pa[8],
+                   const int64u* const iq_pa[8],
+                         int factorBitlen,
+                         int8u lanes,
+                   const mbx_RSA_Method* m)
+{
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = (pint64u_x8)pBuffer;
+   pint64u_x8 inp_mb8 = k0_mb8 +1;
+   pint64u_x8 p_mb8 = inp_mb8 + len52*2;
+   pint64u_x8 q_mb8 = p_mb8 +len52;
+   pint64u_x8 d_mb8 = q_mb8 +len52;
+   pint64u_x8 rr_mb8 = d_mb8 +len64;
+   pint64u_x8 xp_mb8 = rr_mb8 +len52;
+   pint64u_x8 xq_mb8 = xp_mb8 +len52;
+   pint64u_x8 work_buffer = xq_mb8 +len52;
+
+   /*
+   // q exponentiation
+   */
+
+   /* convert modulus to ifma fmt */
+   ifma_BNU_to_mb8(q_mb8, q_pa, factorBitlen);
+   /* compute k0[] */
+   ifma_montFactor52_mb8(k0_mb8[0], q_mb8[0]);
+   /* compute to_Montgomery domain converters */
+   ifma_montRR52x_mb8(rr_mb8, q_mb8, factorBitlen);
+   /* xq = x mod q */
+   m->amred52x(xq_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])q_mb8, k0_mb8[0]);
+   m->ammul52x((int64u*)xq_mb8, (int64u*)xq_mb8, (int64u*)rr_mb8, (int64u*)q_mb8, k0_mb8[0]);
+   m->modsub52x(xq_mb8, (const int64u(*)[8])xq_mb8, (const int64u(*)[8])q_mb8, (const int64u(*)[8])q_mb8); // ??
+   /* re-arrange exps to ifma */
+   ifma_BNU_transpose_copy(d_mb8, dq_pa, factorBitlen);
+
+   exp_crt_component(xq_mb8,
+      (const int64u(*)[8])xq_mb8,
+      (const int64u(*)[8])d_mb8,
+      (const int64u(*)[8])q_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0],
+      (int64u (*)[8])work_buffer,
+      factorBitlen, lanes, m);
+
+   /*
+   // p exponentiation
+   */
+
+   /* convert modulus to ifma fmt */
+   ifma_BNU_to_mb8(p_mb8, p_pa, factorBitlen);
+   /* compute k0[] */
+   ifma_montFactor52_mb8(k0_mb8[0], p_mb8[0]);
+   /* compute to_Montgomery domain converters */
+   ifma_montRR52x_mb8(rr_mb8, p_mb8, factorBitlen);
+   /* xq = x mod q */
+   m->amred52x(xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0]);
+   m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)rr_mb8, (int64u*)p_mb8, k0_mb8[0]);
+   m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8); // ??
+   /* re-arrange exps to ifma */
+   ifma_BNU_transpose_copy(d_mb8, dp_pa, factorBitlen);
+
+   exp_crt_component(xp_mb8,
+      (const int64u(*)[8])xp_mb8,
+      (const int64u(*)[8])d_mb8,
+      (const int64u(*)[8])p_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0],
+      (int64u (*)[8])work_buffer,
+      factorBitlen, lanes, m);
+
+   /*
+   // crt recombination
+   */
+
+   /* xp = (xp-xq) mod p */
+   m->modsub52x(inp_mb8,(const int64u(*)[8])xq_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8); /* for specific case p<q */
+   m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8);
+
+   /* xp = (xp*coef) mod p */
+   ifma_BNU_to_mb8(inp_mb8, iq_pa, factorBitlen); /* coef */
+   m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)rr_mb8, (int64u*)p_mb8, k0_mb8[0]);                     /* -> mont domain */
+   m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)inp_mb8, (int64u*)p_mb8, k0_mb8[0]);                    /* mmul */
+   m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);/* correction */
+
+   /* xp = (xp*q + xq) */
+   zero_mb8(inp_mb8, len52*2);
+   copy_mb8(inp_mb8, (const int64u(*)[8])xq_mb8, len52);
+   m->mla52x(inp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])q_mb8);
+
+   /* clear exponents, p, q */
+   zero_mb8(d_mb8, len64);
+   zero_mb8(q_mb8, len52);
+   zero_mb8(p_mb8, len52);
+}
+
 void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
                                       int8u* const to_pa[8],
                                   const int64u* const p_pa[8],
@@ -139,10 +384,325 @@ void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
                                   const mbx_RSA_Method* m,
                                         int8u* pBuffer)
 
+{
+   int factorBitlen = rsaBitlen/2;
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+   pint64u_x8 inp_mb8 = pBuffer_x8 +1;
+
+   /* lanes being processed */
+   int8u lanes = used_lanes(from_pa, to_pa);
+
+   /* convert input to ifma fmt */
+   zero_mb8(inp_mb8, len52*2);
+   ifma_HexStr8_to_mb8(inp_mb8, from_pa, rsaBitlen);
+
+   prv5_crt_exp((int64u*)pBuffer_x8, p_pa, q_pa, dp_pa, dq_pa, iq_pa, factorBitlen, lanes, m);
+
+   /* convert result from ifma fmt */
+   ifma_mb8_to_HexStr8(to_pa, (const int64u(*)[8])inp_mb8, rsaBitlen);
+}
+
+/*
+// private key (ctr), blinded
+//
+// Blinding object holds n, A = r^e*R mod n and Ai = r^(-1)*R mod n, all in radix 2^52
+// (A and Ai are almost reduced, i.e. less than 2*n). Since Montgomery multiplication
+// (x,A) -> x*r^e and (y,Ai) -> y*r^(-1) mod n, the base blinding and unblinding cost
+// one full-size multiplication each. The pair is refreshed by Montgomery squaring
+// (A,Ai) -> (A^2/R, Ai^2/R) = (r^2e*R, r^(-2)*R), the same way as BN_BLINDING does.
+*/
+
+/* full-size almost Montgomery multiplication */
+static ammul52x_mb8 blinding_amm(int rsaBitlen)
+{
+   switch(rsaBitlen) {
+   case RSA_1K: return ifma_amm52x20_mb8;
+   case RSA_2K: return ifma_amm52x40_mb8;
+   case RSA_3K: return ifma_amm52x60_mb8;
+   case RSA_4K: return ifma_amm52x79_mb8;
+   default:     return NULL;
+   }
+}
+
+/* res = (res<n)? res : res-n (constant time) */
+static void blinding_reduce(int64u res[][8], const int64u n[][8], int len)
+{
+   U64 borrow = get_zero64();
+   __mb_mask ge;
+   int i;
+
+   for(i=0; i<len; i++) {
+      U64 t = sub64(sub64(loadu64(res[i]), loadu64(n[i])), borrow);
+      borrow = srli64(t, 63);
+   }
+   ge = cmp64_mask(borrow, get_zero64(), _MM_CMPINT_EQ);
+
+   borrow = get_zero64();
+   for(i=0; i<len; i++) {
+      U64 r = loadu64(res[i]);
+      U64 t = sub64(sub64(r, loadu64(n[i])), borrow);
+      borrow = srli64(t, 63);
+      storeu64(res[i], mask_mov64(r, ge, and64_const(t, DIGIT_MASK)));
+   }
+}
+
+/* load/store blinding values located at the specified offset of the blinding objects */
+static void blinding_load(int64u out_mb8[][8], mbx_RSA_Blinding* const blind_pa[8], int offset, int len)
+{
+   int buf_no, n;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int64u* data = (NULL==blind_pa[buf_no])? NULL : RSA_BLINDING_DATA(blind_pa[buf_no]) + offset;
+      for(n=0; n<len; n++)
+         out_mb8[n][buf_no] = data? data[n] : 0;
+   }
+}
+
+static void blinding_store(mbx_RSA_Blinding* const blind_pa[8], int offset, const int64u inp_mb8[][8], int len)
+{
+   int buf_no, n;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==blind_pa[buf_no])
+         continue;
+      int64u* data = RSA_BLINDING_DATA(blind_pa[buf_no]) + offset;
+      for(n=0; n<len; n++)
+         data[n] = inp_mb8[n][buf_no];
+   }
+}
+
+/* gather Montgomery factors k0(n) of the blinding objects */
+static void blinding_k0(int64u k0_mb8[8], mbx_RSA_Blinding* const blind_pa[8])
+{
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      k0_mb8[buf_no] = (NULL==blind_pa[buf_no])? 0 : blind_pa[buf_no]->k0;
+}
+
+void ifma_cp_rsa_blinding_layer_mb8(mbx_RSA_Blinding* const blind_pa[8],
+                              const int8u* const r_pa[8],
+                              const int64u* const e_pa[8],
+                              const int64u* const n_pa[8],
+                              const int64u* const p_pa[8],
+                              const int64u* const q_pa[8],
+                              const int64u* const pm2_pa[8],
+                              const int64u* const qm2_pa[8],
+                              const int64u* const iq_pa[8],
+                                    int rsaBitlen,
+                              const mbx_RSA_Method* m,
+                                    int8u* pBuffer)
+{
+   int factorBitlen = rsaBitlen/2;
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   int lenN52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+   ammul52x_mb8 amm = blinding_amm(rsaBitlen);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers (beyond the crt exponentiation's ones) */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 inp_mb8 = k0_mb8 +1;
+   pint64u_x8 n_mb8 = inp_mb8 + len52*7 + len64;
+   pint64u_x8 rr_mb8 = n_mb8 + len52*2;
+   pint64u_x8 a_mb8 = rr_mb8 + len52*2;
+
+   /* lanes being processed */
+   int8u lanes = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL!=blind_pa[buf_no])
+         lanes |= (int8u)(1<<buf_no);
+   }
+
+   /* r^e mod n (kept in the blinding objects until conversion) */
+   zero_mb8(inp_mb8, len52*2);
+   ifma_HexStr8_to_mb8(inp_mb8, r_pa, rsaBitlen);
+   prv5_crt_exp((int64u*)pBuffer_x8, p_pa, q_pa, e_pa, e_pa, iq_pa, factorBitlen, lanes, m);
+   blinding_store(blind_pa, RSA_BLINDING_A_OFFSET(lenN52), (const int64u(*)[8])inp_mb8, lenN52);
+
+   /* inp = r^(-1) mod n = (r^(p-2) mod p, r^(q-2) mod q) */
+   zero_mb8(inp_mb8, len52*2);
+   ifma_HexStr8_to_mb8(inp_mb8, r_pa, rsaBitlen);
+   prv5_crt_exp((int64u*)pBuffer_x8, p_pa, q_pa, pm2_pa, qm2_pa, iq_pa, factorBitlen, lanes, m);
+
+   /* convert modulus to ifma fmt */
+   zero_mb8(n_mb8, len52*2);
+   ifma_BNU_to_mb8(n_mb8, n_pa, rsaBitlen);
+   /* compute k0[] */
+   ifma_montFactor52_mb8(k0_mb8[0], n_mb8[0]);
+   /* compute to_Montgomery domain converters */
+   ifma_montRR52x_mb8(rr_mb8, n_mb8, rsaBitlen);
+
+   /* A = r^e*R, Ai = r^(-1)*R */
+   zero_mb8(a_mb8, len52*2);
+   blinding_load(a_mb8, blind_pa, RSA_BLINDING_A_OFFSET(lenN52), lenN52);
+   amm((int64u*)a_mb8, (int64u*)a_mb8, (int64u*)rr_mb8, (int64u*)n_mb8, k0_mb8[0]);
+   amm((int64u*)inp_mb8, (int64u*)inp_mb8, (int64u*)rr_mb8, (int64u*)n_mb8, k0_mb8[0]);
+
+   /* store blinding objects */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL!=blind_pa[buf_no]) {
+         blind_pa[buf_no]->id = RSA_ID(RSA_PRV5_KEY, rsaBitlen);
+         blind_pa[buf_no]->rsaBitsize = rsaBitlen;
+         blind_pa[buf_no]->k0 = k0_mb8[0][buf_no];
+      }
+   }
+   blinding_store(blind_pa, RSA_BLINDING_N_OFFSET(lenN52), (const int64u(*)[8])n_mb8, lenN52);
+   blinding_store(blind_pa, RSA_BLINDING_A_OFFSET(lenN52), (const int64u(*)[8])a_mb8, lenN52);
+   blinding_store(blind_pa, RSA_BLINDING_AI_OFFSET(lenN52), (const int64u(*)[8])inp_mb8, lenN52);
+
+   /* clear blinding values */
+   zero_mb8(a_mb8, len52*2);
+   zero_mb8(inp_mb8, len52*2);
+}
+
+void ifma_cp_rsa_prv5_blinded_layer_mb8(const int8u* const from_pa[8],
+                                              int8u* const to_pa[8],
+                                        const int64u* const p_pa[8],
+                                        const int64u* const q_pa[8],
+                                        const int64u* const dp_pa[8],
+                                        const int64u* const dq_pa[8],
+                                        const int64u* const iq_pa[8],
+                                        mbx_RSA_Blinding* const blind_pa[8],
+                                              int rsaBitlen,
+                                        const mbx_RSA_Method* m,
+                                              int8u* pBuffer)
+{
+   int factorBitlen = rsaBitlen/2;
+   int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   int lenN52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+   ammul52x_mb8 amm = blinding_amm(rsaBitlen);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers (beyond the crt exponentiation's ones) */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 inp_mb8 = k0_mb8 +1;
+   pint64u_x8 n_mb8 = inp_mb8 + len52*7 + len64;
+   pint64u_x8 a_mb8 = n_mb8 + len52*2;
+
+   /* lanes being processed */
+   int8u lanes = used_lanes(from_pa, to_pa);
+
+   /* convert input to ifma fmt */
+   zero_mb8(inp_mb8, len52*2);
+   ifma_HexStr8_to_mb8(inp_mb8, from_pa, rsaBitlen);
+
+   /* x = x*r^e mod n (almost reduced), A = A^2 */
+   zero_mb8(n_mb8, len52*2);
+   zero_mb8(a_mb8, len52*2);
+   blinding_load(n_mb8, blind_pa, RSA_BLINDING_N_OFFSET(lenN52), lenN52);
+   blinding_load(a_mb8, blind_pa, RSA_BLINDING_A_OFFSET(lenN52), lenN52);
+   blinding_k0(k0_mb8[0], blind_pa);
+   amm((int64u*)inp_mb8, (int64u*)inp_mb8, (int64u*)a_mb8, (int64u*)n_mb8, k0_mb8[0]);
+   amm((int64u*)a_mb8, (int64u*)a_mb8, (int64u*)a_mb8, (int64u*)n_mb8, k0_mb8[0]);
+   blinding_store(blind_pa, RSA_BLINDING_A_OFFSET(lenN52), (const int64u(*)[8])a_mb8, lenN52);
+
+   prv5_crt_exp((int64u*)pBuffer_x8, p_pa, q_pa, dp_pa, dq_pa, iq_pa, factorBitlen, lanes, m);
+
+   /* y = y*r^(-1) mod n, Ai = Ai^2 (n and A have been overwritten by exponentiation) */
+   zero_mb8(n_mb8, len52*2);
+   zero_mb8(a_mb8, len52*2);
+   blinding_load(n_mb8, blind_pa, RSA_BLINDING_N_OFFSET(lenN52), lenN52);
+   blinding_load(a_mb8, blind_pa, RSA_BLINDING_AI_OFFSET(lenN52), lenN52);
+   blinding_k0(k0_mb8[0], blind_pa);
+   amm((int64u*)inp_mb8, (int64u*)inp_mb8, (int64u*)a_mb8, (int64u*)n_mb8, k0_mb8[0]);
+   blinding_reduce(inp_mb8, (const int64u(*)[8])n_mb8, lenN52);
+   amm((int64u*)a_mb8, (int64u*)a_mb8, (int64u*)a_mb8, (int64u*)n_mb8, k0_mb8[0]);
+   blinding_store(blind_pa, RSA_BLINDING_AI_OFFSET(lenN52), (const int64u(*)[8])a_mb8, lenN52);
+
+   /* convert result from ifma fmt */
+   ifma_mb8_to_HexStr8(to_pa, (const int64u(*)[8])inp_mb8, rsaBitlen);
+
+   /* clear blinding values */
+   zero_mb8(a_mb8, len52*2);
+}
+
+/*
+// prepared keys
+*/
+
+/* pointers to the key component located at the specified offset of the prepared key */
+static void prepared_key_component(const int64u* out_pa[8], const mbx_RSA_PreparedKey* const key_pa[8], int offset)
+{
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      out_pa[buf_no] = (NULL==key_pa[buf_no])? NULL : RSA_PREPARED_KEY_DATA(key_pa[buf_no]) + offset;
+}
+
+/* gather Montgomery factors of the prepared keys */
+static void prepared_key_k0(int64u k0_mb8[8], const mbx_RSA_PreparedKey* const key_pa[8], int idx)
+{
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++)
+      k0_mb8[buf_no] = (NULL==key_pa[buf_no])? 0 : key_pa[buf_no]->k0[idx];
+}
+
+/*
+// public exponent e=65537 implied, prepared key
+*/
+void ifma_cp_rsa_pub_prepared_layer_mb8(const int8u* const from_pa[8],
+                                              int8u* const to_pa[8],
+                                const mbx_RSA_PreparedKey* const key_pa[8],
+                                              int rsaBitlen,
+                                        const mbx_RSA_Method* m,
+                                              int8u* pBuffer)
+{
+   int len52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+   const int64u* comp_pa[8];
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 rr_mb8 = k0_mb8 +1;
+   pint64u_x8 inout_mb8 = rr_mb8 +len52;
+   pint64u_x8 n_mb8 = inout_mb8 +len52;
+   pint64u_x8 work_buffer = n_mb8 + len52;
+
+   /* re-arrange modulus and converter to ifma */
+   zero_mb8(n_mb8, MULTIPLE_OF(len52, 10));
+   prepared_key_component(comp_pa, key_pa, RSA_PUB_N_OFFSET(len52));
+   ifma_BNU_transpose_copy(n_mb8, comp_pa, len52*64);
+   prepared_key_component(comp_pa, key_pa, RSA_PUB_RR_OFFSET(len52));
+   ifma_BNU_transpose_copy(rr_mb8, comp_pa, len52*64);
+   prepared_key_k0(k0_mb8[0], key_pa, 0);
+
+   /* convert input to ifma fmt */
+   ifma_HexStr8_to_mb8(inout_mb8, from_pa, rsaBitlen);
+
+   /* exponentiation */
+   m->expfunc65537(inout_mb8,
+            (const int64u (*)[8])inout_mb8,
+            (const int64u (*)[8])n_mb8,
+            (const int64u (*)[8])rr_mb8,
+            k0_mb8[0],
+            (int64u (*)[8])work_buffer);
+
+   /* convert result from ifma fmt */
+   ifma_mb8_to_HexStr8(to_pa, (const int64u(*)[8])inout_mb8, rsaBitlen);
+}
+
+/*
+// private key (ctr), prepared key
+*/
+void ifma_cp_rsa_prv5_prepared_layer_mb8(const int8u* const from_pa[8],
+                                               int8u* const to_pa[8],
+                                 const mbx_RSA_PreparedKey* const key_pa[8],
+                                               int rsaBitlen,
+                                         const mbx_RSA_Method* m,
+                                               int8u* pBuffer)
 {
    int factorBitlen = rsaBitlen/2;
    int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
    int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+   const int64u* comp_pa[8];
 
    /* 64-byte aligned buffer of int64[8] */
    pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
@@ -158,6 +718,9 @@ void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
    pint64u_x8 inp_mb8 = xq_mb8 +len52;
    pint64u_x8 work_buffer = inp_mb8 + len52*2;
 
+   /* lanes being processed */
+   int8u lanes = used_lanes(from_pa, to_pa);
+
    /* convert input to ifma fmt */
    zero_mb8(inp_mb8, len52*2);
    ifma_HexStr8_to_mb8(inp_mb8, from_pa, rsaBitlen);
@@ -166,51 +729,55 @@ void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
    // q exponentiation
    */
 
-   /* convert modulus to ifma fmt */
-   ifma_BNU_to_mb8(q_mb8, q_pa, factorBitlen);
-   /* compute k0[] */
-   ifma_montFactor52_mb8(k0_mb8[0], q_mb8[0]);
-   /* compute to_Montgomery domain converters */
-   ifma_montRR52x_mb8(rr_mb8, q_mb8, factorBitlen);
+   /* re-arrange modulus, converter and k0 to ifma */
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_Q_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(q_mb8, comp_pa, len52*64);
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_RRQ_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(rr_mb8, comp_pa, len52*64);
+   prepared_key_k0(k0_mb8[0], key_pa, 1);
    /* xq = x mod q */
    m->amred52x(xq_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])q_mb8, k0_mb8[0]);
    m->ammul52x((int64u*)xq_mb8, (int64u*)xq_mb8, (int64u*)rr_mb8, (int64u*)q_mb8, k0_mb8[0]);
-   m->modsub52x(xq_mb8, (const int64u(*)[8])xq_mb8, (const int64u(*)[8])q_mb8, (const int64u(*)[8])q_mb8); // ??
+   m->modsub52x(xq_mb8, (const int64u(*)[8])xq_mb8, (const int64u(*)[8])q_mb8, (const int64u(*)[8])q_mb8);
    /* re-arrange exps to ifma */
-   ifma_BNU_transpose_copy(d_mb8, dq_pa, factorBitlen);
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_DQ_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(d_mb8, comp_pa, factorBitlen);
 
-   m->expfun(xq_mb8,
+   exp_crt_component(xq_mb8,
       (const int64u(*)[8])xq_mb8,
       (const int64u(*)[8])d_mb8,
       (const int64u(*)[8])q_mb8,
       (const int64u(*)[8])rr_mb8,
       k0_mb8[0],
-      (int64u (*)[8])work_buffer);
+      (int64u (*)[8])work_buffer,
+      factorBitlen, lanes, m);
 
    /*
    // p exponentiation
    */
 
-   /* convert modulus to ifma fmt */
-   ifma_BNU_to_mb8(p_mb8, p_pa, factorBitlen);
-   /* compute k0[] */
-   ifma_montFactor52_mb8(k0_mb8[0], p_mb8[0]);
-   /* compute to_Montgomery domain converters */
-   ifma_montRR52x_mb8(rr_mb8, p_mb8, factorBitlen);
-   /* xq = x mod q */
+   /* re-arrange modulus, converter and k0 to ifma */
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_P_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(p_mb8, comp_pa, len52*64);
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_RRP_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(rr_mb8, comp_pa, len52*64);
+   prepared_key_k0(k0_mb8[0], key_pa, 0);
+   /* xp = x mod p */
    m->amred52x(xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0]);
    m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)rr_mb8, (int64u*)p_mb8, k0_mb8[0]);
-   m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8); // ??
+   m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);
    /* re-arrange exps to ifma */
-   ifma_BNU_transpose_copy(d_mb8, dp_pa, factorBitlen);
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_DP_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(d_mb8, comp_pa, factorBitlen);
 
-   m->expfun(xp_mb8,
+   exp_crt_component(xp_mb8,
       (const int64u(*)[8])xp_mb8,
       (const int64u(*)[8])d_mb8,
       (const int64u(*)[8])p_mb8,
       (const int64u(*)[8])rr_mb8,
       k0_mb8[0],
-      (int64u (*)[8])work_buffer);
+      (int64u (*)[8])work_buffer,
+      factorBitlen, lanes, m);
 
    /*
    // crt recombination
@@ -220,9 +787,9 @@ void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
    m->modsub52x(inp_mb8,(const int64u(*)[8])xq_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8); /* for specific case p<q */
    m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8);
 
-   /* xp = (xp*coef) mod p */
-   ifma_BNU_to_mb8(inp_mb8, iq_pa, factorBitlen); /* coef */
-   m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)rr_mb8, (int64u*)p_mb8, k0_mb8[0]);                     /* -> mont domain */
+   /* xp = (xp*coef) mod p, coef is already in Montgomery domain */
+   prepared_key_component(comp_pa, key_pa, RSA_PRV5_IQ_OFFSET(len52, len64));
+   ifma_BNU_transpose_copy(inp_mb8, comp_pa, len52*64);
    m->ammul52x((int64u*)xp_mb8, (int64u*)xp_mb8, (int64u*)inp_mb8, (int64u*)p_mb8, k0_mb8[0]);                    /* mmul */
    m->modsub52x(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);/* correction */
 
@@ -23,19 +23,19 @@
 #include <internal/rsa/ifma_rsa_arith.h>
 #include <internal/rsa/ifma_rsa_method.h>
 #include <internal/rsa/ifma_rsa_layer_cp.h>
+#include <internal/rsa/avx2_rsa.h>
 
 #if !defined(NO_USE_MALLOC)
 #include <stdlib.h>
 #endif
 
 // y = x^65537 mod n
-DLL_PUBLIC
-mbx_status mbx_rsa_public_mb8(const int8u* const from_pa[8],
-                                    int8u* const to_pa[8],
-                             const int64u* const n_pa[8],
-                                       int expected_rsa_bitsize,
-                     const mbx_RSA_Method* m,
-                                    int8u* pBuffer)
+mbx_status ifma_rsa_public_mb8(const int8u* const from_pa[8],
+                                     int8u* const to_pa[8],
+                              const int64u* const n_pa[8],
+                                        int expected_rsa_bitsize,
+                      const mbx_RSA_Method* m,
+                                     int8u* pBuffer)
 {
    const mbx_RSA_Method* meth = m;
 
@@ -49,7 +49,8 @@ mbx_status mbx_rsa_public_mb8(const int8u* const from_pa[8],
    }
    /* test rsa modulus size */
    if(RSA_1K != expected_rsa_bitsize && RSA_2K != expected_rsa_bitsize &&
-      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize) {
+      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize &&
+      RSA_8K != expected_rsa_bitsize) {
       status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
       return status;
    }
@@ -120,14 +121,126 @@ mbx_status mbx_rsa_public_mb8(const int8u* const from_pa[8],
    return status;
 }
 
+// y = x^e mod n, short e individual for each lane
 DLL_PUBLIC
-mbx_status mbx_rsa_private_mb8(const int8u* const from_pa[8],
-                                     int8u* const to_pa[8],
-                              const int64u* const d_pa[8],
-                              const int64u* const n_pa[8],
-                                       int expected_rsa_bitsize,
-                     const mbx_RSA_Method* m,
-                                    int8u* pBuffer)
+mbx_status mbx_rsa_public_exp_mb8(const int8u* const from_pa[8],
+                                        int8u* const to_pa[8],
+                                 const int64u e[8],
+                                 const int64u* const n_pa[8],
+                                           int expected_rsa_bitsize,
+                         const mbx_RSA_Method* m,
+                                        int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* lanes with error status are excluded from processing */
+   const int8u* valid_from_pa[8];
+   int8u* valid_to_pa[8];
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==e || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(RSA_1K != expected_rsa_bitsize && RSA_2K != expected_rsa_bitsize &&
+      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize &&
+      RSA_8K != expected_rsa_bitsize) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int8u* inp = from_pa[buf_no];
+            int8u* out = to_pa[buf_no];
+      const int64u* n = n_pa[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==inp || NULL==out || NULL==n) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* public exponent must be odd and greater than 1 */
+      if(3 > e[buf_no] || 0 == (e[buf_no] & 1)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+   }
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int valid = (MBX_STATUS_OK==MBX_GET_STS(status, buf_no));
+      valid_from_pa[buf_no] = valid? from_pa[buf_no] : NULL;
+      valid_to_pa[buf_no] = valid? to_pa[buf_no] : NULL;
+   }
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_pub65537_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PUB_KEY != OP_RSA_ID(meth->id) || NULL==meth->expfun_pub) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      /* excluded lanes take e=3 to keep the exponent valid for the kernel */
+      __ALIGN64 int64u exp_mb8[8];
+      for(buf_no=0; buf_no<8; buf_no++)
+         exp_mb8[buf_no] = MBX_GET_STS(status, buf_no)? 3 : e[buf_no];
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      ifma_cp_rsa_pub_exp_layer_mb8(valid_from_pa, valid_to_pa, exp_mb8, n_pa,
+                                    expected_rsa_bitsize, meth,
+                                    buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+mbx_status ifma_rsa_private_mb8(const int8u* const from_pa[8],
+                                      int8u* const to_pa[8],
+                               const int64u* const d_pa[8],
+                               const int64u* const n_pa[8],
+                                        int expected_rsa_bitsize,
+                      const mbx_RSA_Method* m,
+                                     int8u* pBuffer)
 {
    const mbx_RSA_Method* meth = m;
 
@@ -213,17 +326,16 @@ mbx_status mbx_rsa_private_mb8(const int8u* const from_pa[8],
    return status;
 }
 
-DLL_PUBLIC
-mbx_status mbx_rsa_private_crt_mb8(const int8u* const from_pa[8],
-                                         int8u* const to_pa[8],
-                                  const int64u* const p_pa[8],
-                                  const int64u* const q_pa[8],
-                                  const int64u* const dp_pa[8],
-                                  const int64u* const dq_pa[8],
-                                  const int64u* const iq_pa[8],
-                                            int expected_rsa_bitsize,
-                          const mbx_RSA_Method* m,
-                                         int8u* pBuffer)
+mbx_status ifma_rsa_private_crt_mb8(const int8u* const from_pa[8],
+                                          int8u* const to_pa[8],
+                                   const int64u* const p_pa[8],
+                                   const int64u* const q_pa[8],
+                                   const int64u* const dp_pa[8],
+                                   const int64u* const dq_pa[8],
+                                   const int64u* const iq_pa[8],
+                                             int expected_rsa_bitsize,
+                           const mbx_RSA_Method* m,
+                                          int8u* pBuffer)
 {
    const mbx_RSA_Method* meth = m;
 
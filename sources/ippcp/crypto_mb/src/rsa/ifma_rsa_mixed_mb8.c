@@ -0,0 +1,341 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_layer_cp.h>
+
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
+/*
+// Mixed RSA sizes
+//
+// The batch is split into homogeneous sub-batches, one per RSA size present in
+// the batch. Each sub-batch is processed by the regular mb8 kernel of its size
+// with lanes of other sizes excluded, so the batch cost is the sum of the costs
+// of full mb8 operations of each distinct size, e.g.
+//    {2048 x4, 4096 x4} costs cost(2048) + cost(4096)
+//    {2048 x7, 3072 x1} costs cost(2048) + cost(3072)
+//
+// (Zero-extension of all lanes up to the widest kernel is not used: the radix
+// 2^52 modular reduction used for the RR computation requires the modulus to
+// occupy its top digit.)
+*/
+
+static const int rsa_bitsizes[] = {RSA_1K, RSA_2K, RSA_3K, RSA_4K};
+#define RSA_NUM_SIZES ((int)(sizeof(rsa_bitsizes)/sizeof(rsa_bitsizes[0])))
+
+/* select lanes of the specified size, returns mask of selected lanes */
+static int8u select_lanes(const void* sel_pa[8], const void* const pa[8],
+                          const int rsaBitlen_pa[8], int rsaBitlen, mbx_status status)
+{
+   int8u mask = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int sel = (MBX_STATUS_OK==MBX_GET_STS(status, buf_no)) && (rsaBitlen==rsaBitlen_pa[buf_no]);
+      sel_pa[buf_no] = sel? pa[buf_no] : NULL;
+      mask |= (int8u)(sel << buf_no);
+   }
+   return mask;
+}
+
+/* returns non-zero if the size is one of rsa_bitsizes[] */
+static int is_mixed_bitsize(int rsaBitlen)
+{
+   int n;
+   for(n=0; n<RSA_NUM_SIZES; n++) {
+      if(rsaBitlen==rsa_bitsizes[n])
+         return 1;
+   }
+   return 0;
+}
+
+/*
+// check sizes of rsa and find size of scratch buffer required by the largest one
+// lanes already having error status are skipped,
+// sizes out of rsa_bitsizes[] are rejected even if the method supports them
+*/
+static mbx_status check_mixed_bitsizes(int* pBufSize, const int rsaBitlen_pa[8],
+                                       const mbx_RSA_Method* (*get_method)(int),
+                                       mbx_status status)
+{
+   int bufSize = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK!=MBX_GET_STS(status, buf_no))
+         continue;
+
+      const mbx_RSA_Method* meth = is_mixed_bitsize(rsaBitlen_pa[buf_no])? get_method(rsaBitlen_pa[buf_no]) : NULL;
+      if(NULL==meth) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      if(bufSize < mbx_RSA_Method_BufSize(meth))
+         bufSize = mbx_RSA_Method_BufSize(meth);
+   }
+   *pBufSize = bufSize;
+   return status;
+}
+
+// y = x^65537 mod n
+DLL_PUBLIC
+mbx_status mbx_rsa_public_mixed_mb8(const int8u* const from_pa[8],
+                                          int8u* const to_pa[8],
+                                   const int64u* const n_pa[8],
+                                       const int rsaBitlen_pa[8],
+                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int bufSize;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==n_pa || NULL==rsaBitlen_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] || NULL==n_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+   }
+   /* test rsa modulus sizes */
+   status = check_mixed_bitsizes(&bufSize, rsaBitlen_pa, mbx_RSA_pub65537_Method, status);
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+      int n;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(bufSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      for(n=0; n<RSA_NUM_SIZES; n++) {
+         int rsaBitlen = rsa_bitsizes[n];
+         const int8u* from[8];
+               int8u* to[8];
+         const int64u* nn[8];
+
+         if(0==select_lanes((const void**)from, (const void* const*)from_pa, rsaBitlen_pa, rsaBitlen, status))
+            continue;
+         select_lanes((const void**)to, (const void* const*)to_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)nn, (const void* const*)n_pa, rsaBitlen_pa, rsaBitlen, status);
+
+         ifma_cp_rsa_pub_layer_mb8(from, to, nn,
+                                   rsaBitlen, mbx_RSA_pub65537_Method(rsaBitlen),
+                                   buffer);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_mixed_mb8(const int8u* const from_pa[8],
+                                           int8u* const to_pa[8],
+                                    const int64u* const d_pa[8],
+                                    const int64u* const n_pa[8],
+                                        const int rsaBitlen_pa[8],
+                                           int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int bufSize;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==d_pa || NULL==n_pa || NULL==rsaBitlen_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] || NULL==d_pa[buf_no] || NULL==n_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+   }
+   /* test rsa modulus sizes */
+   status = check_mixed_bitsizes(&bufSize, rsaBitlen_pa, mbx_RSA_private_Method, status);
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+      int n;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(bufSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      for(n=0; n<RSA_NUM_SIZES; n++) {
+         int rsaBitlen = rsa_bitsizes[n];
+         const int8u* from[8];
+               int8u* to[8];
+         const int64u* dd[8];
+         const int64u* nn[8];
+
+         if(0==select_lanes((const void**)from, (const void* const*)from_pa, rsaBitlen_pa, rsaBitlen, status))
+            continue;
+         select_lanes((const void**)to, (const void* const*)to_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)dd, (const void* const*)d_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)nn, (const void* const*)n_pa, rsaBitlen_pa, rsaBitlen, status);
+
+         ifma_cp_rsa_prv2_layer_mb8(from, to, dd, nn,
+                                    rsaBitlen, mbx_RSA_private_Method(rsaBitlen),
+                                    buffer);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_crt_mixed_mb8(const int8u* const from_pa[8],
+                                               int8u* const to_pa[8],
+                                        const int64u* const p_pa[8],
+                                        const int64u* const q_pa[8],
+                                        const int64u* const dp_pa[8],
+                                        const int64u* const dq_pa[8],
+                                        const int64u* const iq_pa[8],
+                                            const int rsaBitlen_pa[8],
+                                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int bufSize;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa || NULL==rsaBitlen_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] ||
+         NULL==p_pa[buf_no] || NULL==q_pa[buf_no] || NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+   }
+   /* test rsa modulus sizes */
+   status = check_mixed_bitsizes(&bufSize, rsaBitlen_pa, mbx_RSA_private_crt_Method, status);
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+      int n;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(bufSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      for(n=0; n<RSA_NUM_SIZES; n++) {
+         int rsaBitlen = rsa_bitsizes[n];
+         const int8u* from[8];
+               int8u* to[8];
+         const int64u* pp[8];
+         const int64u* qq[8];
+         const int64u* dp[8];
+         const int64u* dq[8];
+         const int64u* iq[8];
+
+         if(0==select_lanes((const void**)from, (const void* const*)from_pa, rsaBitlen_pa, rsaBitlen, status))
+            continue;
+         select_lanes((const void**)to, (const void* const*)to_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)pp, (const void* const*)p_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)qq, (const void* const*)q_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)dp, (const void* const*)dp_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)dq, (const void* const*)dq_pa, rsaBitlen_pa, rsaBitlen, status);
+         select_lanes((const void**)iq, (const void* const*)iq_pa, rsaBitlen_pa, rsaBitlen, status);
+
+         ifma_cp_rsa_prv5_layer_mb8(from, to, pp, qq, dp, dq, iq,
+                                    rsaBitlen, mbx_RSA_private_crt_Method(rsaBitlen),
+                                    buffer);
+      }
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
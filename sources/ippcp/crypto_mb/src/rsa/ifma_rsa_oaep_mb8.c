@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/mem_fns.h>
+#include <internal/rsa/ifma_rsa_pad.h>
+
+/*
+// RSAES-OAEP (PKCS #1 v2.2, 7.1)
+//
+//    EM = 0x00 || maskedSeed || maskedDB, where
+//    DB = lHash || PS || 0x01 || M
+//    maskedDB   = DB ^ MGF(seed, k-hLen-1)
+//    maskedSeed = seed ^ MGF(maskedDB, hLen)
+*/
+
+/* constant time: 0xFFFFFFFF if x==0 and 0 otherwise */
+__INLINE int32u is_zero_ct(int32u x)
+{
+   return (int32u)0 - ((x - 1) >> 31);
+}
+
+/*
+// Decode EM in constant time,
+// returns the offset of the message in DB or -1 if decoding failed
+*/
+static int oaep_decode(const int8u* em, const int8u* lHash, int k, int hLen)
+{
+   const int8u* db = em + 1 + hLen;
+   int dbLen = k - hLen - 1;
+
+   int32u good = is_zero_ct(em[0]);
+   int32u found = 0;
+   int32u msgOffset = 0;
+   int32u diff = 0;
+   int n;
+
+   for(n=0; n<hLen; n++)
+      diff |= db[n] ^ lHash[n];
+   good &= is_zero_ct(diff);
+
+   /* PS must be followed by 0x01 */
+   for(n=hLen; n<dbLen; n++) {
+      int32u zero = is_zero_ct(db[n]);
+      int32u one = is_zero_ct(db[n] ^ 0x01);
+      msgOffset |= ~found & one & (int32u)(n+1);
+      good &= found | zero | one;
+      found |= one;
+   }
+   good &= found;
+
+   return (int)((good & msgOffset) | (~good & (int32u)(-1)));
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_oaep_encrypt_mb8(const int8u* const msg_pa[8],
+                                           const int msgLen_pa[8],
+                                    const int8u* const label_pa[8],
+                                           const int labelLen_pa[8],
+                                    const int8u* const seed_pa[8],
+                                          int8u* const to_pa[8],
+                                   const int64u* const n_pa[8],
+                                                 int rsaBitlen,
+                                   enum MBX_HASH_ALG hashAlg,
+                               const mbx_RSA_Method* m,
+                                              int8u* pBuffer)
+{
+   const ifma_rsa_hash* hash = ifma_rsa_hash_info(hashAlg);
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==msg_pa || NULL==msgLen_pa || NULL==seed_pa || NULL==to_pa || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size and hash */
+   if((RSA_1K != rsaBitlen && RSA_2K != rsaBitlen &&
+       RSA_3K != rsaBitlen && RSA_4K != rsaBitlen) || NULL==hash) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   int k = rsaBitlen/8;
+   int hLen = hash->hashLen;
+   int dbLen = k - hLen - 1;
+
+   __ALIGN64 int8u em[8][RSA_PAD_MAX_BYTELEN];
+   const int8u* em_pa[8];
+   int8u* seed_em_pa[8];
+   int8u* db_pa[8];
+   const int8u* label_loc[8];
+   int labelLen_loc[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      em_pa[buf_no] = NULL;
+      seed_em_pa[buf_no] = NULL;
+      db_pa[buf_no] = NULL;
+      label_loc[buf_no] = (NULL==label_pa || NULL==labelLen_pa)? NULL : label_pa[buf_no];
+      labelLen_loc[buf_no] = (NULL==label_loc[buf_no])? 0 : labelLen_pa[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==msg_pa[buf_no] || NULL==seed_pa[buf_no] || NULL==to_pa[buf_no] || NULL==n_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* message too long */
+      if(msgLen_pa[buf_no]<0 || msgLen_pa[buf_no] > k-2*hLen-2 || labelLen_loc[buf_no]<0) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+
+      em_pa[buf_no] = em[buf_no];
+      seed_em_pa[buf_no] = em[buf_no] + 1;
+      db_pa[buf_no] = em[buf_no] + 1 + hLen;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      /* DB = lHash || PS || 0x01 || M */
+      hash->digest(db_pa, label_loc, labelLen_loc);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int8u* db = db_pa[buf_no];
+         int msgLen;
+         if(NULL==db)
+            continue;
+         msgLen = msgLen_pa[buf_no];
+         PadBlock(0, db + hLen, dbLen - hLen - msgLen - 1);
+         db[dbLen - msgLen - 1] = 0x01;
+         CopyBlock(msg_pa[buf_no], db + dbLen - msgLen, msgLen);
+
+         em[buf_no][0] = 0;
+         CopyBlock(seed_pa[buf_no], seed_em_pa[buf_no], hLen);
+      }
+
+      /* maskedDB = DB ^ MGF(seed), maskedSeed = seed ^ MGF(maskedDB) */
+      ifma_mgf1_xor_mb8(db_pa, dbLen, (const int8u* const*)seed_em_pa, hLen, hash);
+      ifma_mgf1_xor_mb8(seed_em_pa, hLen, (const int8u* const*)db_pa, dbLen, hash);
+
+      status = ifma_rsa_pad_status(status, mbx_rsa_public_mb8(em_pa, to_pa, n_pa, rsaBitlen, m, pBuffer));
+
+      /* clear encoded messages */
+      PadBlock(0, em, sizeof(em));
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_oaep_decrypt_crt_mb8(const int8u* const from_pa[8],
+                                              int8u* const to_pa[8],
+                                                     int msgLen_pa[8],
+                                        const int8u* const label_pa[8],
+                                               const int labelLen_pa[8],
+                                       const int64u* const p_pa[8],
+                                       const int64u* const q_pa[8],
+                                       const int64u* const dp_pa[8],
+                                       const int64u* const dq_pa[8],
+                                       const int64u* const iq_pa[8],
+                                                     int rsaBitlen,
+                                       enum MBX_HASH_ALG hashAlg,
+                                   const mbx_RSA_Method* m,
+                                                  int8u* pBuffer)
+{
+   const ifma_rsa_hash* hash = ifma_rsa_hash_info(hashAlg);
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==msgLen_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size and hash */
+   if((RSA_1K != rsaBitlen && RSA_2K != rsaBitlen &&
+       RSA_3K != rsaBitlen && RSA_4K != rsaBitlen) || NULL==hash) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   int k = rsaBitlen/8;
+   int hLen = hash->hashLen;
+   int dbLen = k - hLen - 1;
+
+   __ALIGN64 int8u em[8][RSA_PAD_MAX_BYTELEN];
+   __ALIGN64 int8u lHash[8][SHA2_MAX_DIGEST_SIZE];
+   const int8u* from_loc[8];
+   int8u* em_pa[8];
+   int8u* seed_em_pa[8];
+   int8u* db_pa[8];
+   int8u* lHash_pa[8];
+   const int8u* label_loc[8];
+   int labelLen_loc[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      msgLen_pa[buf_no] = 0;
+      from_loc[buf_no] = NULL;
+      em_pa[buf_no] = NULL;
+      label_loc[buf_no] = (NULL==label_pa || NULL==labelLen_pa)? NULL : label_pa[buf_no];
+      labelLen_loc[buf_no] = (NULL==label_loc[buf_no])? 0 : labelLen_pa[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] || NULL==p_pa[buf_no] || NULL==q_pa[buf_no] ||
+         NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(labelLen_loc[buf_no]<0) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+
+      from_loc[buf_no] = from_pa[buf_no];
+      em_pa[buf_no] = em[buf_no];
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      status = ifma_rsa_pad_status(status, mbx_rsa_private_crt_mb8(from_loc, em_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa,
+                                                                   rsaBitlen, m, pBuffer));
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int ok = MBX_STATUS_OK==MBX_GET_STS(status, buf_no);
+         seed_em_pa[buf_no] = ok? em[buf_no] + 1 : NULL;
+         db_pa[buf_no] = ok? em[buf_no] + 1 + hLen : NULL;
+         lHash_pa[buf_no] = ok? lHash[buf_no] : NULL;
+      }
+
+      /* seed = maskedSeed ^ MGF(maskedDB), DB = maskedDB ^ MGF(seed) */
+      ifma_mgf1_xor_mb8(seed_em_pa, hLen, (const int8u* const*)db_pa, dbLen, hash);
+      ifma_mgf1_xor_mb8(db_pa, dbLen, (const int8u* const*)seed_em_pa, hLen, hash);
+
+      hash->digest(lHash_pa, label_loc, labelLen_loc);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int msgOffset;
+         if(NULL==db_pa[buf_no])
+            continue;
+
+         msgOffset = oaep_decode(em[buf_no], lHash[buf_no], k, hLen);
+         if(msgOffset<0) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+            continue;
+         }
+         msgLen_pa[buf_no] = dbLen - msgOffset;
+         CopyBlock(db_pa[buf_no] + msgOffset, to_pa[buf_no], msgLen_pa[buf_no]);
+      }
+
+      /* clear decrypted messages */
+      PadBlock(0, em, sizeof(em));
+   }
+
+   return status;
+}
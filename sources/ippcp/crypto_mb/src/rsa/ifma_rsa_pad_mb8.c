@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/mem_fns.h>
+#include <internal/rsa/ifma_rsa_pad.h>
+
+static const ifma_rsa_hash rsa_hash_sha256 = { SHA256_DIGEST_SIZE, sha256_msg_digest_mb8 };
+static const ifma_rsa_hash rsa_hash_sha384 = { SHA384_DIGEST_SIZE, sha384_msg_digest_mb8 };
+static const ifma_rsa_hash rsa_hash_sha512 = { SHA512_DIGEST_SIZE, sha512_msg_digest_mb8 };
+
+const ifma_rsa_hash* ifma_rsa_hash_info(enum MBX_HASH_ALG hashAlg)
+{
+   switch(hashAlg) {
+      case MBX_HASH_SHA256: return &rsa_hash_sha256;
+      case MBX_HASH_SHA384: return &rsa_hash_sha384;
+      case MBX_HASH_SHA512: return &rsa_hash_sha512;
+      default: return NULL;
+   }
+}
+
+/*
+// MGF1 (PKCS #1 v2.2, B.2.1)
+//
+// Hash(seed || counter) of all buffers is computed by single multi-buffer digest
+// call per counter value.
+*/
+void ifma_mgf1_xor_mb8(int8u* const out_pa[8], int outLen,
+                 const int8u* const seed_pa[8], int seedLen,
+                 const ifma_rsa_hash* hash)
+{
+   __ALIGN64 int8u seed_cnt[8][RSA_PAD_MAX_BYTELEN + sizeof(int32u)];
+   __ALIGN64 int8u mask[8][SHA2_MAX_DIGEST_SIZE];
+   const int8u* seed_cnt_pa[8];
+   int8u* mask_pa[8];
+   int len[8];
+
+   int hashLen = hash->hashLen;
+   int32u cnt;
+   int offset, buf_no, n;
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==out_pa[buf_no]) {
+         seed_cnt_pa[buf_no] = NULL;
+         mask_pa[buf_no] = NULL;
+         len[buf_no] = 0;
+         continue;
+      }
+      CopyBlock(seed_pa[buf_no], seed_cnt[buf_no], seedLen);
+      seed_cnt_pa[buf_no] = seed_cnt[buf_no];
+      mask_pa[buf_no] = mask[buf_no];
+      len[buf_no] = seedLen + (int)sizeof(int32u);
+   }
+
+   for(cnt=0, offset=0; offset<outLen; cnt++, offset+=hashLen) {
+      int chunk = (outLen-offset < hashLen)? outLen-offset : hashLen;
+
+      /* seed || counter (big endian) */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(NULL==out_pa[buf_no])
+            continue;
+         seed_cnt[buf_no][seedLen+0] = (int8u)(cnt>>24);
+         seed_cnt[buf_no][seedLen+1] = (int8u)(cnt>>16);
+         seed_cnt[buf_no][seedLen+2] = (int8u)(cnt>>8);
+         seed_cnt[buf_no][seedLen+3] = (int8u)cnt;
+      }
+
+      hash->digest(mask_pa, seed_cnt_pa, len);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int8u* out = out_pa[buf_no];
+         if(NULL==out)
+            continue;
+         for(n=0; n<chunk; n++)
+            out[offset+n] ^= mask[buf_no][n];
+      }
+   }
+
+   /* clear copies of seeds and masks */
+   PadBlock(0, seed_cnt, sizeof(seed_cnt));
+   PadBlock(0, mask, sizeof(mask));
+}
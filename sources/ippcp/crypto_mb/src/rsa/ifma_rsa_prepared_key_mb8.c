@@ -0,0 +1,442 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_layer_cp.h>
+#include <internal/rsa/ifma_rsa_prepared_key.h>
+
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
+#define MAX_LEN52 (MULTIPLE_OF(NUMBER_OF_DIGITS(RSA_4K, DIGIT_SIZE), 10))
+
+static int is_supported_rsa_bitsize(int rsaBitsize)
+{
+   return (RSA_1K == rsaBitsize || RSA_2K == rsaBitsize ||
+           RSA_3K == rsaBitsize || RSA_4K == rsaBitsize);
+}
+
+/* extract single lane of mb8 value */
+static void mb8_extract_lane(int64u* out, const int64u inp_mb8[][8], int len, int buf_no)
+{
+   int n;
+   for(n=0; n<len; n++)
+      out[n] = inp_mb8[n][buf_no];
+}
+
+/*
+// size of prepared keys
+*/
+DLL_PUBLIC
+int mbx_RSA_pub_PreparedKey_BufSize(int rsaBitsize)
+{
+   if(!is_supported_rsa_bitsize(rsaBitsize))
+      return 0;
+   int len52 = NUMBER_OF_DIGITS(rsaBitsize, DIGIT_SIZE);
+   return (int)sizeof(mbx_RSA_PreparedKey) + RSA_PUB_DATA_LEN(len52) * (int)sizeof(int64u);
+}
+
+DLL_PUBLIC
+int mbx_RSA_private_crt_PreparedKey_BufSize(int rsaBitsize)
+{
+   if(!is_supported_rsa_bitsize(rsaBitsize))
+      return 0;
+   int len52 = NUMBER_OF_DIGITS(rsaBitsize/2, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(rsaBitsize/2, 64);
+   return (int)sizeof(mbx_RSA_PreparedKey) + RSA_PRV5_DATA_LEN(len52, len64) * (int)sizeof(int64u);
+}
+
+/*
+// key preparation
+*/
+DLL_PUBLIC
+mbx_status mbx_rsa_public_key_prepare_mb8(mbx_RSA_PreparedKey* const key_pa[8],
+                                        const int64u* const n_pa[8],
+                                                  int rsaBitlen)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==key_pa || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(rsaBitlen)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==key_pa[buf_no] || NULL==n_pa[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int len52 = NUMBER_OF_DIGITS(rsaBitlen, DIGIT_SIZE);
+
+      __ALIGN64 int64u k0_mb8[8];
+      __ALIGN64 int64u n_mb8[MAX_LEN52][8];
+      __ALIGN64 int64u rr_mb8[MAX_LEN52][8];
+
+      /* convert modulus to ifma fmt */
+      zero_mb8(n_mb8, MULTIPLE_OF(len52, 10));
+      ifma_BNU_to_mb8(n_mb8, n_pa, rsaBitlen);
+
+      /* compute k0[] */
+      ifma_montFactor52_mb8(k0_mb8, n_mb8[0]);
+
+      /* compute to_Montgomery domain converters */
+      ifma_montRR52x_mb8(rr_mb8, n_mb8, rsaBitlen);
+
+      /* store prepared keys */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(MBX_STATUS_OK != MBX_GET_STS(status, buf_no))
+            continue;
+
+         mbx_RSA_PreparedKey* key = key_pa[buf_no];
+         int64u* data = RSA_PREPARED_KEY_DATA(key);
+
+         key->id = RSA_ID(RSA_PUB_KEY, rsaBitlen);
+         key->rsaBitsize = rsaBitlen;
+         key->k0[0] = k0_mb8[buf_no];
+         key->k0[1] = 0;
+         mb8_extract_lane(data + RSA_PUB_N_OFFSET(len52), (const int64u(*)[8])n_mb8, len52, buf_no);
+         mb8_extract_lane(data + RSA_PUB_RR_OFFSET(len52), (const int64u(*)[8])rr_mb8, len52, buf_no);
+      }
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_crt_key_prepare_mb8(mbx_RSA_PreparedKey* const key_pa[8],
+                                             const int64u* const p_pa[8],
+                                             const int64u* const q_pa[8],
+                                             const int64u* const dp_pa[8],
+                                             const int64u* const dq_pa[8],
+                                             const int64u* const iq_pa[8],
+                                                       int rsaBitlen)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==key_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(rsaBitlen)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==key_pa[buf_no] ||
+         NULL==p_pa[buf_no] || NULL==q_pa[buf_no] ||
+         NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      const mbx_RSA_Method* meth = mbx_RSA_private_crt_Method(rsaBitlen);
+
+      int factorBitlen = rsaBitlen/2;
+      int len52 = NUMBER_OF_DIGITS(factorBitlen, DIGIT_SIZE);
+      int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+      __ALIGN64 int64u k0p_mb8[8];
+      __ALIGN64 int64u k0q_mb8[8];
+      __ALIGN64 int64u p_mb8[MAX_LEN52/2][8];
+      __ALIGN64 int64u q_mb8[MAX_LEN52/2][8];
+      __ALIGN64 int64u rrp_mb8[MAX_LEN52/2][8];
+      __ALIGN64 int64u rrq_mb8[MAX_LEN52/2][8];
+      __ALIGN64 int64u iq_mb8[MAX_LEN52/2][8];
+
+      /* convert factors to ifma fmt */
+      ifma_BNU_to_mb8(p_mb8, p_pa, factorBitlen);
+      ifma_BNU_to_mb8(q_mb8, q_pa, factorBitlen);
+
+      /* compute k0[] */
+      ifma_montFactor52_mb8(k0p_mb8, p_mb8[0]);
+      ifma_montFactor52_mb8(k0q_mb8, q_mb8[0]);
+
+      /* compute to_Montgomery domain converters */
+      ifma_montRR52x_mb8(rrp_mb8, p_mb8, factorBitlen);
+      ifma_montRR52x_mb8(rrq_mb8, q_mb8, factorBitlen);
+
+      /* iq_mont = iq*R mod p */
+      ifma_BNU_to_mb8(iq_mb8, iq_pa, factorBitlen);
+      meth->ammul52x((int64u*)iq_mb8, (int64u*)iq_mb8, (int64u*)rrp_mb8, (int64u*)p_mb8, k0p_mb8);
+      meth->modsub52x(iq_mb8, (const int64u(*)[8])iq_mb8, (const int64u(*)[8])p_mb8, (const int64u(*)[8])p_mb8);
+
+      /* store prepared keys */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(MBX_STATUS_OK != MBX_GET_STS(status, buf_no))
+            continue;
+
+         mbx_RSA_PreparedKey* key = key_pa[buf_no];
+         int64u* data = RSA_PREPARED_KEY_DATA(key);
+         int n;
+
+         key->id = RSA_ID(RSA_PRV5_KEY, rsaBitlen);
+         key->rsaBitsize = rsaBitlen;
+         key->k0[0] = k0p_mb8[buf_no];
+         key->k0[1] = k0q_mb8[buf_no];
+         mb8_extract_lane(data + RSA_PRV5_P_OFFSET(len52, len64),   (const int64u(*)[8])p_mb8,   len52, buf_no);
+         mb8_extract_lane(data + RSA_PRV5_Q_OFFSET(len52, len64),   (const int64u(*)[8])q_mb8,   len52, buf_no);
+         mb8_extract_lane(data + RSA_PRV5_RRP_OFFSET(len52, len64), (const int64u(*)[8])rrp_mb8, len52, buf_no);
+         mb8_extract_lane(data + RSA_PRV5_RRQ_OFFSET(len52, len64), (const int64u(*)[8])rrq_mb8, len52, buf_no);
+         mb8_extract_lane(data + RSA_PRV5_IQ_OFFSET(len52, len64),  (const int64u(*)[8])iq_mb8,  len52, buf_no);
+         for(n=0; n<len64; n++) {
+            data[RSA_PRV5_DP_OFFSET(len52, len64) + n] = dp_pa[buf_no][n];
+            data[RSA_PRV5_DQ_OFFSET(len52, len64) + n] = dq_pa[buf_no][n];
+         }
+      }
+
+      /* clear factors */
+      zero_mb8(p_mb8, len52);
+      zero_mb8(q_mb8, len52);
+      zero_mb8(iq_mb8, len52);
+   }
+
+   return status;
+}
+
+/*
+// processing with prepared keys
+*/
+
+/*
+// check prepared keys and exclude ones which are not suitable for requested operation:
+// lanes with error status get NULL key, input and output, so their outputs are left untouched
+*/
+static mbx_status check_prepared_keys(const mbx_RSA_PreparedKey* valid_key_pa[8],
+                                      const int8u* valid_from_pa[8],
+                                            int8u* valid_to_pa[8],
+                                      const int8u* const from_pa[8],
+                                            int8u* const to_pa[8],
+                                      const mbx_RSA_PreparedKey* const key_pa[8],
+                                      int keyId)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const mbx_RSA_PreparedKey* key = key_pa[buf_no];
+      valid_key_pa[buf_no] = NULL;
+      valid_from_pa[buf_no] = NULL;
+      valid_to_pa[buf_no] = NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==from_pa[buf_no] || NULL==to_pa[buf_no] || NULL==key) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* key must be prepared for requested operation and size of rsa */
+      if(keyId != key->id) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      valid_key_pa[buf_no] = key;
+      valid_from_pa[buf_no] = from_pa[buf_no];
+      valid_to_pa[buf_no] = to_pa[buf_no];
+   }
+
+   return status;
+}
+
+// y = x^65537 mod n
+DLL_PUBLIC
+mbx_status mbx_rsa_public_prepared_mb8(const int8u* const from_pa[8],
+                                             int8u* const to_pa[8],
+                         const mbx_RSA_PreparedKey* const key_pa[8],
+                                                int expected_rsa_bitsize,
+                              const mbx_RSA_Method* m,
+                                             int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+   const mbx_RSA_PreparedKey* valid_key_pa[8];
+   const int8u* valid_from_pa[8];
+   int8u* valid_to_pa[8];
+
+   mbx_status status = 0;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==key_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(expected_rsa_bitsize)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and keys */
+   status = check_prepared_keys(valid_key_pa, valid_from_pa, valid_to_pa,
+                                from_pa, to_pa, key_pa,
+                                RSA_ID(RSA_PUB_KEY, expected_rsa_bitsize));
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_pub65537_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PUB_KEY != OP_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      ifma_cp_rsa_pub_prepared_layer_mb8(valid_from_pa, valid_to_pa, valid_key_pa,
+                                         expected_rsa_bitsize, meth,
+                                         buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_private_crt_prepared_mb8(const int8u* const from_pa[8],
+                                                  int8u* const to_pa[8],
+                              const mbx_RSA_PreparedKey* const key_pa[8],
+                                                     int expected_rsa_bitsize,
+                                   const mbx_RSA_Method* m,
+                                                  int8u* pBuffer)
+{
+   const mbx_RSA_Method* meth = m;
+   const mbx_RSA_PreparedKey* valid_key_pa[8];
+   const int8u* valid_from_pa[8];
+   int8u* valid_to_pa[8];
+
+   mbx_status status = 0;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==key_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size */
+   if(!is_supported_rsa_bitsize(expected_rsa_bitsize)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and keys */
+   status = check_prepared_keys(valid_key_pa, valid_from_pa, valid_to_pa,
+                                from_pa, to_pa, key_pa,
+                                RSA_ID(RSA_PRV5_KEY, expected_rsa_bitsize));
+
+   /* test method */
+   if(NULL==meth) {
+      meth = mbx_RSA_private_crt_Method(expected_rsa_bitsize);
+      if(NULL==meth) {
+         status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+         return status;
+      }
+   }
+   /* check if requested operation matched to method's */
+   if(RSA_PRV5_KEY != OP_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+   /* check if requested RSA matched to method's */
+   if(expected_rsa_bitsize != BISIZE_RSA_ID(meth->id)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      int8u* buffer = pBuffer;
+
+      #if !defined(NO_USE_MALLOC)
+      int allocated_buf = 0;
+
+      /* check if allocated buffer) */
+      if(NULL==buffer) {
+         buffer = (int8u*)( malloc(meth->buffSize) );
+         if(NULL==buffer) {
+            status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+            return status;
+         }
+         allocated_buf = 1;
+      }
+      #endif
+
+      ifma_cp_rsa_prv5_prepared_layer_mb8(valid_from_pa, valid_to_pa, valid_key_pa,
+                                          expected_rsa_bitsize, meth,
+                                          buffer);
+
+      #if !defined(NO_USE_MALLOC)
+      /* release buffer */
+      if(allocated_buf)
+         free(buffer);
+      #endif
+   }
+
+   return status;
+}
@@ -0,0 +1,316 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/rsa.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/mem_fns.h>
+#include <internal/rsa/ifma_rsa_pad.h>
+
+/*
+// RSASSA-PSS (PKCS #1 v2.2, 8.1, 9.1)
+//
+//    EM = maskedDB || H || 0xbc, where
+//    M' = (0x)00 00 00 00 00 00 00 00 || mHash || salt
+//    H  = Hash(M')
+//    DB = PS || 0x01 || salt
+//    maskedDB = DB ^ MGF(H, emLen-hLen-1)
+//
+// The bit size of rsa modulus is multiple of 8, so emLen = k and
+// the leftmost bit of EM is cleared only.
+*/
+
+#define PSS_PADDING1_LEN   (8)
+#define PSS_TRAILER        (0xBC)
+
+/* M' = (0x)00 00 00 00 00 00 00 00 || mHash || salt */
+#define PSS_MSG_PRIME_MAX_LEN (PSS_PADDING1_LEN + SHA2_MAX_DIGEST_SIZE + RSA_PAD_MAX_BYTELEN)
+
+/* signature (big endian) is less than modulus */
+static int is_less_than_modulus(const int8u* sign, const int64u* n, int k)
+{
+   int i;
+   for(i=0; i<k; i++) {
+      int byte_no = k-1-i;
+      int8u n_byte = (int8u)(n[byte_no/8] >> ((byte_no%8)*8));
+      if(sign[i] != n_byte)
+         return sign[i] < n_byte;
+   }
+   return 0;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_pss_sign_crt_mb8(const int8u* const msg_pa[8],
+                                           const int msgLen_pa[8],
+                                    const int8u* const salt_pa[8],
+                                                 int saltLen,
+                                          int8u* const sign_pa[8],
+                                   const int64u* const p_pa[8],
+                                   const int64u* const q_pa[8],
+                                   const int64u* const dp_pa[8],
+                                   const int64u* const dq_pa[8],
+                                   const int64u* const iq_pa[8],
+                                                 int rsaBitlen,
+                                   enum MBX_HASH_ALG hashAlg,
+                               const mbx_RSA_Method* m,
+                                              int8u* pBuffer)
+{
+   const ifma_rsa_hash* hash = ifma_rsa_hash_info(hashAlg);
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==msg_pa || NULL==msgLen_pa || NULL==sign_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa ||
+      (NULL==salt_pa && saltLen)) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size and hash */
+   if((RSA_1K != rsaBitlen && RSA_2K != rsaBitlen &&
+       RSA_3K != rsaBitlen && RSA_4K != rsaBitlen) || NULL==hash) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   int emLen = rsaBitlen/8;
+   int hLen = hash->hashLen;
+   int dbLen = emLen - hLen - 1;
+
+   /* test salt length */
+   if(saltLen<0 || saltLen > emLen-hLen-2) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   __ALIGN64 int8u em[8][RSA_PAD_MAX_BYTELEN];
+   __ALIGN64 int8u msg_prime[8][PSS_MSG_PRIME_MAX_LEN];
+   const int8u* em_pa[8];
+   int8u* db_pa[8];
+   int8u* h_pa[8];
+   int8u* mHash_pa[8];
+   const int8u* msg_prime_pa[8];
+   int msg_prime_len[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      em_pa[buf_no] = NULL;
+      db_pa[buf_no] = NULL;
+      h_pa[buf_no] = NULL;
+      mHash_pa[buf_no] = NULL;
+      msg_prime_pa[buf_no] = NULL;
+      msg_prime_len[buf_no] = 0;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==msg_pa[buf_no] || NULL==sign_pa[buf_no] || (saltLen && NULL==salt_pa[buf_no]) ||
+         NULL==p_pa[buf_no] || NULL==q_pa[buf_no] || NULL==dp_pa[buf_no] || NULL==dq_pa[buf_no] || NULL==iq_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(msgLen_pa[buf_no]<0) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+
+      em_pa[buf_no] = em[buf_no];
+      db_pa[buf_no] = em[buf_no];
+      h_pa[buf_no] = em[buf_no] + dbLen;
+      mHash_pa[buf_no] = msg_prime[buf_no] + PSS_PADDING1_LEN;
+      msg_prime_pa[buf_no] = msg_prime[buf_no];
+      msg_prime_len[buf_no] = PSS_PADDING1_LEN + hLen + saltLen;
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      /* mHash = Hash(M) */
+      hash->digest(mHash_pa, msg_pa, msgLen_pa);
+
+      /* H = Hash(M') */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         if(NULL==em_pa[buf_no])
+            continue;
+         PadBlock(0, msg_prime[buf_no], PSS_PADDING1_LEN);
+         CopyBlock(salt_pa? salt_pa[buf_no] : NULL, msg_prime[buf_no] + PSS_PADDING1_LEN + hLen, saltLen);
+      }
+      hash->digest(h_pa, msg_prime_pa, msg_prime_len);
+
+      /* EM = (DB ^ MGF(H)) || H || 0xbc */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int8u* db = db_pa[buf_no];
+         if(NULL==db)
+            continue;
+         PadBlock(0, db, dbLen - saltLen - 1);
+         db[dbLen - saltLen - 1] = 0x01;
+         CopyBlock(salt_pa? salt_pa[buf_no] : NULL, db + dbLen - saltLen, saltLen);
+         em[buf_no][emLen-1] = PSS_TRAILER;
+      }
+      ifma_mgf1_xor_mb8(db_pa, dbLen, (const int8u* const*)h_pa, hLen, hash);
+      for(buf_no=0; buf_no<8; buf_no++)
+         em[buf_no][0] &= 0x7F;
+
+      status = ifma_rsa_pad_status(status, mbx_rsa_private_crt_mb8(em_pa, sign_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa,
+                                                                   rsaBitlen, m, pBuffer));
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_rsa_pss_verify_mb8(const int8u* const sign_pa[8],
+                                  const int8u* const msg_pa[8],
+                                         const int msgLen_pa[8],
+                                               int saltLen,
+                                 const int64u* const n_pa[8],
+                                               int rsaBitlen,
+                                 enum MBX_HASH_ALG hashAlg,
+                             const mbx_RSA_Method* m,
+                                            int8u* pBuffer)
+{
+   const ifma_rsa_hash* hash = ifma_rsa_hash_info(hashAlg);
+
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==sign_pa || NULL==msg_pa || NULL==msgLen_pa || NULL==n_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+   /* test rsa modulus size and hash */
+   if((RSA_1K != rsaBitlen && RSA_2K != rsaBitlen &&
+       RSA_3K != rsaBitlen && RSA_4K != rsaBitlen) || NULL==hash) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   int emLen = rsaBitlen/8;
+   int hLen = hash->hashLen;
+   int dbLen = emLen - hLen - 1;
+
+   /* test salt length */
+   if(saltLen<0 || saltLen > emLen-hLen-2) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      return status;
+   }
+
+   __ALIGN64 int8u em[8][RSA_PAD_MAX_BYTELEN];
+   __ALIGN64 int8u msg_prime[8][PSS_MSG_PRIME_MAX_LEN];
+   __ALIGN64 int8u h_prime[8][SHA2_MAX_DIGEST_SIZE];
+   const int8u* sign_loc[8];
+   int8u* em_pa[8];
+   int8u* db_pa[8];
+   int8u* h_pa[8];
+   int8u* mHash_pa[8];
+   int8u* h_prime_pa[8];
+   const int8u* msg_prime_pa[8];
+   int msg_prime_len[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      sign_loc[buf_no] = NULL;
+      em_pa[buf_no] = NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==sign_pa[buf_no] || NULL==msg_pa[buf_no] || NULL==n_pa[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(msgLen_pa[buf_no]<0) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      /* signature representative out of range */
+      if(!is_less_than_modulus(sign_pa[buf_no], n_pa[buf_no], emLen)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_SIGNATURE_ERR);
+         continue;
+      }
+
+      sign_loc[buf_no] = sign_pa[buf_no];
+      em_pa[buf_no] = em[buf_no];
+   }
+
+   /*
+   // processing
+   */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      status = ifma_rsa_pad_status(status, mbx_rsa_public_mb8(sign_loc, em_pa, n_pa, rsaBitlen, m, pBuffer));
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int ok = MBX_STATUS_OK==MBX_GET_STS(status, buf_no);
+
+         /* check trailer and the leftmost bit */
+         if(ok && (PSS_TRAILER!=em[buf_no][emLen-1] || (em[buf_no][0] & 0x80))) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_SIGNATURE_ERR);
+            ok = 0;
+         }
+         db_pa[buf_no] = ok? em[buf_no] : NULL;
+         h_pa[buf_no] = ok? em[buf_no] + dbLen : NULL;
+         mHash_pa[buf_no] = ok? msg_prime[buf_no] + PSS_PADDING1_LEN : NULL;
+         h_prime_pa[buf_no] = ok? h_prime[buf_no] : NULL;
+         msg_prime_pa[buf_no] = ok? msg_prime[buf_no] : NULL;
+         msg_prime_len[buf_no] = ok? PSS_PADDING1_LEN + hLen + saltLen : 0;
+      }
+
+      /* mHash = Hash(M) */
+      hash->digest(mHash_pa, msg_pa, msgLen_pa);
+
+      /* DB = maskedDB ^ MGF(H) */
+      ifma_mgf1_xor_mb8(db_pa, dbLen, (const int8u* const*)h_pa, hLen, hash);
+
+      /* check DB = PS || 0x01 || salt and build M' */
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int8u* db = db_pa[buf_no];
+         int8u diff;
+         int n;
+         if(NULL==db)
+            continue;
+
+         db[0] &= 0x7F;
+         diff = db[dbLen - saltLen - 1] ^ 0x01;
+         for(n=0; n<dbLen - saltLen - 1; n++)
+            diff |= db[n];
+         if(diff) {
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_SIGNATURE_ERR);
+            h_prime_pa[buf_no] = NULL;
+            continue;
+         }
+
+         PadBlock(0, msg_prime[buf_no], PSS_PADDING1_LEN);
+         CopyBlock(db + dbLen - saltLen, msg_prime[buf_no] + PSS_PADDING1_LEN + hLen, saltLen);
+      }
+
+      /* H' = Hash(M') */
+      hash->digest(h_prime_pa, msg_prime_pa, msg_prime_len);
+
+      for(buf_no=0; buf_no<8; buf_no++) {
+         int8u diff = 0;
+         int n;
+         if(NULL==h_prime_pa[buf_no])
+            continue;
+         for(n=0; n<hLen; n++)
+            diff |= h_prime[buf_no][n] ^ h_pa[buf_no][n];
+         if(diff)
+            status = MBX_SET_STS(status, buf_no, MBX_STATUS_SIGNATURE_ERR);
+      }
+   }
+
+   return status;
+}
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+/*
+// Fixed window exponentiation for the partially filled batches.
+// Code is common for all operand lengths: almost Montgomery multiplication
+// and squaring kernels of the required length are passed as parameters,
+// the kernel of 5 consecutive squarings is optional.
+*/
+
+#define EXP_WIN_SIZE (5)
+#define EXP_WIN_MASK ((1<<EXP_WIN_SIZE) -1)
+
+typedef void (*amm52x_func)(int64u* out, const int64u* inpA, const int64u* inpB, const int64u* inpM, const int64u* k0);
+typedef void (*ams52x_func)(int64u* out, const int64u* inpA, const int64u* inpM, const int64u* k0);
+
+/* constant time extraction of the pre-computed multiplier */
+static void MB_FUNC_NAME(extract_multiplier_)(int64u out[][MB_WIDTH], int64u tbl[][MB_WIDTH], U64 idx, int len52)
+{
+   __mb_mask sel[1<<EXP_WIN_SIZE];
+   int n, i;
+
+   for(n=0; n<(1<<EXP_WIN_SIZE); n++)
+      sel[n] = cmpeq64_mask(idx, set64(n));
+
+   for(i=0; i<len52; i++) {
+      U64 X = get_zero64();
+      for(n=0; n<(1<<EXP_WIN_SIZE); n++)
+         X = select64(sel[n], X, (U64*)tbl[n*len52+i]);
+      storeu64(out[i], X);
+   }
+}
+
+static void MB_FUNC_NAME(exp52x_)(int64u out[][MB_WIDTH],
+                            const int64u base[][MB_WIDTH],
+                            const int64u exp[][MB_WIDTH],
+                            const int64u modulus[][MB_WIDTH],
+                            const int64u toMont[][MB_WIDTH],
+                            const int64u k0[MB_WIDTH],
+                                  int64u work_buffer[][MB_WIDTH],
+                                  int bitsize,
+                                  amm52x_func amm,
+                                  ams52x_func ams,
+                                  ams52x_func ams5x)
+{
+   int len52 = NUMBER_OF_DIGITS(bitsize, DIGIT_SIZE);
+   int len64 = NUMBER_OF_DIGITS(bitsize, 64);
+
+   /* allocate red(undant) result Y and multiplier X */
+   int64u (*red_Y)[MB_WIDTH] = work_buffer;
+   int64u (*red_X)[MB_WIDTH] = red_Y + len52;
+
+   /* allocate expanded exponent */
+   int64u (*expz)[MB_WIDTH] = red_X + len52;
+
+   /* pre-computed table of base powers: (1<<EXP_WIN_SIZE) entries of len52 digits each */
+   int64u (*red_table)[MB_WIDTH] = expz + len64 + 1;
+
+   int idx;
+
+   /*
+   // compute table of powers base^i, i=0, ..., (2^EXP_WIN_SIZE) -1
+   */
+   MB_FUNC_NAME(zero_)(red_X, len52);   /* table[0] = mont(x^0) = mont(1) */
+   storeu64(red_X[0], set64(1));
+   amm((int64u*)red_table[0], (int64u*)red_X, (int64u*)toMont, (int64u*)modulus, (int64u*)k0);
+
+   amm((int64u*)red_table[len52], (int64u*)base, (int64u*)toMont, (int64u*)modulus, (int64u*)k0);
+
+   for(idx=1; idx<(1<<EXP_WIN_SIZE)/2; idx++) {
+      ams((int64u*)red_table[(2*idx)*len52], (int64u*)red_table[idx*len52], (int64u*)modulus, (int64u*)k0);
+      amm((int64u*)red_table[(2*idx+1)*len52], (int64u*)red_table[(2*idx)*len52], (int64u*)red_table[len52], (int64u*)modulus, (int64u*)k0);
+   }
+
+   /* copy and expand exponents */
+   MB_FUNC_NAME(copy_)(expz, exp, len64);
+   storeu64(expz[len64], get_zero64());
+
+   /* exponentition */
+   {
+      int rem = bitsize % EXP_WIN_SIZE;
+      int delta = rem? rem : EXP_WIN_SIZE;
+      U64 table_idx_mask = set64(EXP_WIN_MASK);
+
+      int exp_bit_no = bitsize-delta;
+      int exp_chunk_no = exp_bit_no/64;
+      int exp_chunk_shift = exp_bit_no%64;
+
+      /* process 1-st exp window - just init result */
+      U64 red_table_idx = srli64(loadu64(expz[exp_chunk_no]), exp_chunk_shift);
+      MB_FUNC_NAME(extract_multiplier_)(red_Y, red_table, red_table_idx, len52);
+
+      /* process other exp windows */
+      for(exp_bit_no-=EXP_WIN_SIZE; exp_bit_no>=0; exp_bit_no-=EXP_WIN_SIZE) {
+         U64 T;
+         int n;
+
+         /* series of squaring */
+         if(ams5x)
+            ams5x((int64u*)red_Y, (int64u*)red_Y, (int64u*)modulus, (int64u*)k0);
+         else {
+            for(n=0; n<EXP_WIN_SIZE; n++)
+               ams((int64u*)red_Y, (int64u*)red_Y, (int64u*)modulus, (int64u*)k0);
+         }
+
+         /* extract pre-computed multiplier from the table */
+         exp_chunk_no = exp_bit_no/64;
+         exp_chunk_shift = exp_bit_no%64;
+
+         red_table_idx = srli64(loadu64(expz[exp_chunk_no]), exp_chunk_shift);
+         T = slli64(loadu64(expz[exp_chunk_no+1]), 64-exp_chunk_shift);
+         red_table_idx = and64(xor64(red_table_idx, T), table_idx_mask);
+
+         MB_FUNC_NAME(extract_multiplier_)(red_X, red_table, red_table_idx, len52);
+
+         /* and multiply */
+         amm((int64u*)red_Y, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+      }
+   }
+
+   /* clear exponents */
+   MB_FUNC_NAME(zero_)(expz, len64);
+
+   /* convert result back in regular 2^52 domain */
+   MB_FUNC_NAME(zero_)(red_X, len52);
+   storeu64(red_X[0], set64(1));
+   amm((int64u*)out, (int64u*)red_Y, (int64u*)red_X, (int64u*)modulus, (int64u*)k0);
+}
+
+void MB_FUNC_NAME(EXP52x10_)(int64u out[][MB_WIDTH],
+                       const int64u base[][MB_WIDTH],
+                       const int64u exp[][MB_WIDTH],
+                       const int64u modulus[][MB_WIDTH],
+                       const int64u toMont[][MB_WIDTH],
+                       const int64u k0[MB_WIDTH],
+                             int64u work_buffer[][MB_WIDTH])
+{
+   MB_FUNC_NAME(exp52x_)(out, base, exp, modulus, toMont, k0, work_buffer, RSA_1K/2,
+                         MB_FUNC_NAME(ifma_amm52x10_), MB_FUNC_NAME(AMS52x10_diagonal_), MB_FUNC_NAME(AMS5x52x10_diagonal_));
+}
+
+void MB_FUNC_NAME(EXP52x20_)(int64u out[][MB_WIDTH],
+                       const int64u base[][MB_WIDTH],
+                       const int64u exp[][MB_WIDTH],
+                       const int64u modulus[][MB_WIDTH],
+                       const int64u toMont[][MB_WIDTH],
+                       const int64u k0[MB_WIDTH],
+                             int64u work_buffer[][MB_WIDTH])
+{
+   MB_FUNC_NAME(exp52x_)(out, base, exp, modulus, toMont, k0, work_buffer, RSA_2K/2,
+                         MB_FUNC_NAME(ifma_amm52x20_), MB_FUNC_NAME(AMS52x20_diagonal_), MB_FUNC_NAME(AMS5x52x20_diagonal_));
+}
+
+void MB_FUNC_NAME(EXP52x30_)(int64u out[][MB_WIDTH],
+                       const int64u base[][MB_WIDTH],
+                       const int64u exp[][MB_WIDTH],
+                       const int64u modulus[][MB_WIDTH],
+                       const int64u toMont[][MB_WIDTH],
+                       const int64u k0[MB_WIDTH],
+                             int64u work_buffer[][MB_WIDTH])
+{
+   MB_FUNC_NAME(exp52x_)(out, base, exp, modulus, toMont, k0, work_buffer, RSA_3K/2,
+                         MB_FUNC_NAME(ifma_amm52x30_), MB_FUNC_NAME(AMS52x30_diagonal_), NULL);
+}
+
+void MB_FUNC_NAME(EXP52x40_)(int64u out[][MB_WIDTH],
+                       const int64u base[][MB_WIDTH],
+                       const int64u exp[][MB_WIDTH],
+                       const int64u modulus[][MB_WIDTH],
+                       const int64u toMont[][MB_WIDTH],
+                       const int64u k0[MB_WIDTH],
+                             int64u work_buffer[][MB_WIDTH])
+{
+   MB_FUNC_NAME(exp52x_)(out, base, exp, modulus, toMont, k0, work_buffer, RSA_4K/2,
+                         MB_FUNC_NAME(ifma_amm52x40_), MB_FUNC_NAME(AMS52x40_diagonal_), MB_FUNC_NAME(AMS5x52x40_diagonal_));
+}
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#ifdef __GNUC__
+#define ASM(a) __asm__(a);
+#else
+#define ASM(a)
+#endif
+
+__NOINLINE
+void MB_FUNC_NAME(zero_)(int64u (*out)[MB_WIDTH], int len)
+{
+#if defined(__GNUC__)
+   // Avoid dead code elimination for GNU compilers
+   ASM("");
+#endif
+   U64 T = get_zero64();
+   int i;
+   for(i=0; i<len; i++)
+      storeu64(out[i], T);
+}
+
+void MB_FUNC_NAME(copy_)(int64u out[][MB_WIDTH], const int64u inp[][MB_WIDTH], int len)
+{
+   int i;
+   for(i=0; i<len; i++)
+      storeu64(out[i], loadu64(inp[i]));
+}
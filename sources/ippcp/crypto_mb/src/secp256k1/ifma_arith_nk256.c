@@ -0,0 +1,347 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/secp256k1/ifma_arith_secp256k1.h>
+
+/* Constants */
+#define LEN52    PK256_LEN52
+
+/*
+// EC secp256k1 base point order
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u nk256_mb[LEN52][8] = {
+   { REP8_DECL(0x00025e8cd0364141) },
+   { REP8_DECL(0x000e6af48a03bbfd) },
+   { REP8_DECL(0x000ffffffebaaedc) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x0000ffffffffffff) }
+};
+
+__ALIGN64 static const int64u nk256x2_mb[LEN52][8] = {
+   { REP8_DECL(0x0004bd19a06c8282) },
+   { REP8_DECL(0x000cd5e9140777fa) },
+   { REP8_DECL(0x000ffffffd755db9) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x0001ffffffffffff) }
+};
+
+/* k0 = -( (1/nk256 mod 2^DIGIT_SIZE) ) mod 2^DIGIT_SIZE */
+__ALIGN64 static const int64u nk256_k0_mb[8] = {
+   REP8_DECL(0x000dff665588b13f)
+};
+
+/* to Montgomery conversion constant
+// rr = 2^((LEN52*DIGIT_SIZE)*2) mod nk256
+*/
+__ALIGN64 static const int64u nk256_rr_mb[LEN52][8] = {
+   { REP8_DECL(0x000e180c268b3b23) },
+   { REP8_DECL(0x00094fd6e33e4c8e) },
+   { REP8_DECL(0x000d07c73b975948) },
+   { REP8_DECL(0x000c5e697f5e45bc) },
+   { REP8_DECL(0x0000671cd581c69b) }
+};
+
+/*=====================================================================
+
+ Specialized single operations in nk256 - sqr & mul
+
+=====================================================================*/
+EXTERN_C U64* MB_FUNC_NAME(ifma_nk256_)(void)
+{
+   return (U64*)nk256_mb;
+}
+
+void MB_FUNC_NAME(ifma_ams52_nk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_ams52x5_)(r, a, (U64*)nk256_mb, nk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_amm52_nk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_amm52x5_)(r, a, b, (U64*)nk256_mb, nk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_tomont52_nk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52x5_)(r, a, (U64*)nk256_rr_mb, (U64*)nk256_mb, nk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_frommont52_nk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_nk256_)(r, a, (U64*)ones);
+   MB_FUNC_NAME(ifma_fastred52_pnk256_)(r, r);
+}
+
+/*
+// computes r = 1/z = z^(nk256-2) mod nk256
+//
+// note: z in in Montgomery domain (as soon mul() and sqr() below are amm-functions
+//       r in Montgomery domain too
+*/
+#define sqr_nk256    MB_FUNC_NAME(ifma_ams52_nk256_)
+#define mul_nk256    MB_FUNC_NAME(ifma_amm52_nk256_)
+
+void MB_FUNC_NAME(ifma_aminv52_nk256_)(U64 r[], const U64 z[])
+{
+   int i;
+
+   // pwr_z_Tbl[i][] = z^i, i=0,..,15
+   __ALIGN64 U64 pwr_z_Tbl[16][LEN52];
+
+   MB_FUNC_NAME(ifma_tomont52_nk256_)(pwr_z_Tbl[0], (U64*)ones);
+   MB_FUNC_NAME(mov_FE256_)(pwr_z_Tbl[1], z);
+
+   for(i=2; i<16; i+=2) {
+      sqr_nk256(pwr_z_Tbl[i], pwr_z_Tbl[i/2]);
+      mul_nk256(pwr_z_Tbl[i+1], pwr_z_Tbl[i], z);
+   }
+
+   // pwr = (nk256-2) in big endian
+   int8u pwr[] = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF"
+                 "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFE"
+                 "\xBA\xAE\xDC\xE6\xAF\x48\xA0\x3B"
+                 "\xBF\xD2\x5E\x8C\xD0\x36\x41\x3F";
+   // init r = 1
+   MB_FUNC_NAME(mov_FE256_)(r, pwr_z_Tbl[0]);
+
+   for(i=0; i<32; i++) {
+      int v = pwr[i];
+      int hi = (v>>4) &0xF;
+      int lo = v & 0xF;
+
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      if(hi)
+         mul_nk256(r, r, pwr_z_Tbl[hi]);
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      sqr_nk256(r, r);
+      if(lo)
+         mul_nk256(r, r, pwr_z_Tbl[lo]);
+   }
+}
+
+/*=====================================================================
+
+ Specialized single operations in nk256 - add, sub & neg
+
+=====================================================================*/
+
+void MB_FUNC_NAME(ifma_add52_nk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_add52x5_)(r, a, b, (U64*)nk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_sub52_nk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_sub52x5_)(r, a, b, (U64*)nk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_neg52_nk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_neg52x5_)(r, a, (U64*)nk256x2_mb);
+}
+
+static __mb_mask MB_FUNC_NAME(lt_mbx_digit_)(const U64 a, const U64 b, const __mb_mask lt_mask)
+{
+   U64 d = mask_sub64(sub64(a, b), lt_mask, sub64(a, b), set1(1));
+   return cmp64_mask(d, get_zero64(), _MM_CMPINT_LT);
+}
+
+/* r = (a>=nk256)? a-nk256 : a */
+void MB_FUNC_NAME(ifma_fastred52_pnk256_)(U64 R[], const U64 A[])
+{
+   /* r = a - b */
+   U64 r0 = sub64(A[0], ((U64*)(nk256_mb))[0]);
+   U64 r1 = sub64(A[1], ((U64*)(nk256_mb))[1]);
+   U64 r2 = sub64(A[2], ((U64*)(nk256_mb))[2]);
+   U64 r3 = sub64(A[3], ((U64*)(nk256_mb))[3]);
+   U64 r4 = sub64(A[4], ((U64*)(nk256_mb))[4]);
+
+   /* lt = {r0 - r4} < 0 */
+   __mb_mask
+   lt = MB_FUNC_NAME(lt_mbx_digit_)(r0, get_zero64(), 0);
+   lt = MB_FUNC_NAME(lt_mbx_digit_)(r1, get_zero64(), lt);
+   lt = MB_FUNC_NAME(lt_mbx_digit_)(r2, get_zero64(), lt);
+   lt = MB_FUNC_NAME(lt_mbx_digit_)(r3, get_zero64(), lt);
+   lt = MB_FUNC_NAME(lt_mbx_digit_)(r4, get_zero64(), lt);
+
+   r0 = mask_mov64(A[0], ~lt, r0);
+   r1 = mask_mov64(A[1], ~lt, r1);
+   r2 = mask_mov64(A[2], ~lt, r2);
+   r3 = mask_mov64(A[3], ~lt, r3);
+   r4 = mask_mov64(A[4], ~lt, r4);
+
+   /* normalize r0 - r4 */
+   NORM_ASHIFTR(r, 0,1)
+   NORM_ASHIFTR(r, 1,2)
+   NORM_ASHIFTR(r, 2,3)
+   NORM_ASHIFTR(r, 3,4)
+
+   R[0] = r0;
+   R[1] = r1;
+   R[2] = r2;
+   R[3] = r3;
+   R[4] = r4;
+}
+
+__mb_mask MB_FUNC_NAME(ifma_cmp_lt_nk256_)(const U64 a[])
+{
+   return MB_FUNC_NAME(cmp_lt_FE256_)(a,(const U64 (*))nk256_mb);
+}
+
+__mb_mask MB_FUNC_NAME(ifma_check_range_nk256_)(const U64 A[])
+{
+   __mb_mask
+   mask = MB_FUNC_NAME(is_zero_FE256_)(A);
+   mask |= ~MB_FUNC_NAME(ifma_cmp_lt_nk256_)(A);
+
+   return mask;
+}
+
+/*=====================================================================
+
+ GLV decomposition of the scalar
+
+=====================================================================*/
+
+/*
+// Lattice basis of the endomorphism lambda (lambda^3 = 1 mod nk256):
+//    g1 = round(2^384 * b2/nk256), g2 = round(2^384 * (-b1)/nk256)
+//    -b1, -b2 and -lambda are in Montgomery domain
+*/
+__ALIGN64 static const int64u glv_g1_mb[LEN52][8] = {
+   { REP8_DECL(0x0003209a45dbb031) },
+   { REP8_DECL(0x0001471e8ca7fe89) },
+   { REP8_DECL(0x000284eb153daa8a) },
+   { REP8_DECL(0x0006bcde86c90e49) },
+   { REP8_DECL(0x00003086d221a7d4) }
+};
+__ALIGN64 static const int64u glv_g2_mb[LEN52][8] = {
+   { REP8_DECL(0x0001b4ae8ac47f71) },
+   { REP8_DECL(0x000ac9df506c6157) },
+   { REP8_DECL(0x000abfe4c4221208) },
+   { REP8_DECL(0x00088286f547fa90) },
+   { REP8_DECL(0x0000e4437ed6010e) }
+};
+__ALIGN64 static const int64u mont_glv_minus_b1_mb[LEN52][8] = {
+   { REP8_DECL(0x0001cfe70d25e13e) },
+   { REP8_DECL(0x000924bdd93b4d0a) },
+   { REP8_DECL(0x000c47f7143c6a66) },
+   { REP8_DECL(0x0006c61571b4ae8a) },
+   { REP8_DECL(0x000021208ac9df50) }
+};
+__ALIGN64 static const int64u mont_glv_minus_b2_mb[LEN52][8] = {
+   { REP8_DECL(0x0009766cdeb95a54) },
+   { REP8_DECL(0x0008f043e10c3cce) },
+   { REP8_DECL(0x000244fcf1287681) },
+   { REP8_DECL(0x000580176cdf65ba) },
+   { REP8_DECL(0x000025575eb8e173) }
+};
+__ALIGN64 static const int64u mont_glv_minus_lambda_mb[LEN52][8] = {
+   { REP8_DECL(0x000f8370481ebda6) },
+   { REP8_DECL(0x0008fdf4a7c97770) },
+   { REP8_DECL(0x00096826e596dab2) },
+   { REP8_DECL(0x0009c68c5699f9ad) },
+   { REP8_DECL(0x0000cd7bfe87aa72) }
+};
+
+/* (nk256-1)/2 */
+__ALIGN64 static const int64u nk256_half_mb[LEN52][8] = {
+   { REP8_DECL(0x00092f46681b20a0) },
+   { REP8_DECL(0x0007357a4501ddfe) },
+   { REP8_DECL(0x000fffffff5d576e) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00007fffffffffff) }
+};
+
+/* c = round(k*g / 2^384) */
+static void MB_FUNC_NAME(mul_shift384_)(U64 c[], const U64 k[], const U64 g[])
+{
+   U64 t[2*LEN52];
+   int i, j;
+
+   for(i=0; i<2*LEN52; i++)
+      t[i] = get_zero64();
+
+   for(i=0; i<LEN52; i++) {
+      for(j=0; j<LEN52; j++) {
+         t[i+j]   = fma52lo(t[i+j],   k[i], g[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], k[i], g[j]);
+      }
+   }
+   for(i=0; i<2*LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+      t[i]   = and64(t[i], loadu64(VMASK52));
+   }
+
+   /* 384 = 7*DIGIT_SIZE + 20 */
+   c[0] = or64(srli64(t[7], 20), and64(slli64(t[8], DIGIT_SIZE-20), loadu64(VMASK52)));
+   c[1] = or64(srli64(t[8], 20), and64(slli64(t[9], DIGIT_SIZE-20), loadu64(VMASK52)));
+   c[2] = srli64(t[9], 20);
+   c[3] = get_zero64();
+   c[4] = get_zero64();
+
+   /* rounding by the bit 383 */
+   c[0] = add64(c[0], and64(srli64(t[7], 19), set1(1)));
+   c[1] = add64(c[1], srli64(c[0], DIGIT_SIZE));
+   c[0] = and64(c[0], loadu64(VMASK52));
+   c[2] = add64(c[2], srli64(c[1], DIGIT_SIZE));
+   c[1] = and64(c[1], loadu64(VMASK52));
+}
+
+/* r = (a > (nk256-1)/2)? nk256-a : a, a is reduced */
+static __mb_mask MB_FUNC_NAME(abs_nk256_)(U64 r[], const U64 a[])
+{
+   __ALIGN64 U64 t[LEN52];
+   __mb_mask neg = MB_FUNC_NAME(cmp_lt_FE256_)((const U64 (*))nk256_half_mb, a);
+
+   MB_FUNC_NAME(ifma_neg52x5_)(t, a, (U64*)nk256_mb);
+   MB_FUNC_NAME(mask_mov_FE256_)(r, a, neg, t);
+   return neg;
+}
+
+void MB_FUNC_NAME(ifma_glv_split52_nk256_)(U64 k1[], __mb_mask* k1_neg,
+                                           U64 k2[], __mb_mask* k2_neg, const U64 k[])
+{
+   __ALIGN64 U64 c1[LEN52];
+   __ALIGN64 U64 c2[LEN52];
+   __ALIGN64 U64 r1[LEN52];
+   __ALIGN64 U64 r2[LEN52];
+
+   MB_FUNC_NAME(mul_shift384_)(c1, k, (U64*)glv_g1_mb);
+   MB_FUNC_NAME(mul_shift384_)(c2, k, (U64*)glv_g2_mb);
+
+   /* r2 = c1*(-b1) + c2*(-b2) */
+   mul_nk256(c1, c1, (U64*)mont_glv_minus_b1_mb);
+   mul_nk256(c2, c2, (U64*)mont_glv_minus_b2_mb);
+   MB_FUNC_NAME(ifma_add52_nk256_)(r2, c1, c2);
+
+   /* r1 = k + r2*(-lambda) */
+   mul_nk256(r1, r2, (U64*)mont_glv_minus_lambda_mb);
+   MB_FUNC_NAME(ifma_add52_nk256_)(r1, r1, k);
+
+   MB_FUNC_NAME(ifma_fastred52_pnk256_)(r1, r1);
+   MB_FUNC_NAME(ifma_fastred52_pnk256_)(r2, r2);
+
+   *k1_neg = MB_FUNC_NAME(abs_nk256_)(k1, r1);
+   *k2_neg = MB_FUNC_NAME(abs_nk256_)(k2, r2);
+}
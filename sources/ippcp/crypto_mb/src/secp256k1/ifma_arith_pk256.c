@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/secp256k1/ifma_arith_secp256k1.h>
+
+/* Constants */
+#define LEN52    PK256_LEN52
+
+/*
+// EC secp256k1 prime = 2^256 - 2^32 - 977
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u pk256_mb[LEN52][8] = {
+   { REP8_DECL(0x000ffffefffffc2f) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x0000ffffffffffff) }
+};
+
+__ALIGN64 static const int64u pk256x2_mb[LEN52][8] = {
+   { REP8_DECL(0x000ffffdfffff85e) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x0001ffffffffffff) }
+};
+
+/* k0 = -( (1/pk256 mod 2^DIGIT_SIZE) ) mod 2^DIGIT_SIZE */
+__ALIGN64 static const int64u pk256_k0_mb[8] = {
+   REP8_DECL(0x0008091dd2253531)
+};
+
+/* to Montgomery conversion constant
+// rr = 2^((LEN52*DIGIT_SIZE)*2) mod pk256
+*/
+__ALIGN64 static const int64u pk256_rr_mb[LEN52][8] = {
+   { REP8_DECL(0x0007a2000e90a100) },
+   { REP8_DECL(0x0000000000100000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+/*=====================================================================
+
+ Specialized single operations in pk256 - sqr & mul
+
+=====================================================================*/
+
+void MB_FUNC_NAME(ifma_amm52_pk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_amm52x5_)(r, a, b, (U64*)pk256_mb, pk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_ams52_pk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_ams52x5_)(r, a, (U64*)pk256_mb, pk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_tomont52_pk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52x5_)(r, a, (U64*)pk256_rr_mb, (U64*)pk256_mb, pk256_k0_mb);
+}
+
+void MB_FUNC_NAME(ifma_frommont52_pk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_pk256_)(r, a, (U64*)ones);
+   MB_FUNC_NAME(ifma_reduce52_pk256_)(r, r);
+}
+
+#define sqr_pk256    MB_FUNC_NAME(ifma_ams52_pk256_)
+#define mul_pk256    MB_FUNC_NAME(ifma_amm52_pk256_)
+
+/* r = a^(2^n) */
+static void MB_FUNC_NAME(sqr_pk256_pwr_)(U64 r[], const U64 a[], int n)
+{
+   sqr_pk256(r, a);
+   for(n--; n>0; n--)
+      sqr_pk256(r, r);
+}
+
+/*
+// x223 = a^(2^223 -1) and x22 = a^(2^22 -1), x2 = a^(2^2 -1)
+// the common part of the inversion and square root addition chains
+*/
+static void MB_FUNC_NAME(pwr_x223_pk256_)(U64 x223[], U64 x22[], U64 x2[], const U64 a[])
+{
+   __ALIGN64 U64 x3[LEN52];
+   __ALIGN64 U64 x6[LEN52];
+   __ALIGN64 U64 x44[LEN52];
+   __ALIGN64 U64 x88[LEN52];
+
+   sqr_pk256(x2, a);
+   mul_pk256(x2, x2, a);                                 /* x2  = a^(2^2 -1) */
+   sqr_pk256(x3, x2);
+   mul_pk256(x3, x3, a);                                 /* x3  = a^(2^3 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x6, x3, 3);
+   mul_pk256(x6, x6, x3);                                /* x6  = a^(2^6 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x22, x6, 3);
+   mul_pk256(x22, x22, x3);                              /* x9  = a^(2^9 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x22, x22, 2);
+   mul_pk256(x6, x22, x2);                               /* x11 = a^(2^11 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x22, x6, 11);
+   mul_pk256(x22, x22, x6);                              /* x22 = a^(2^22 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x44, x22, 22);
+   mul_pk256(x44, x44, x22);                             /* x44 = a^(2^44 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x88, x44, 44);
+   mul_pk256(x88, x88, x44);                             /* x88 = a^(2^88 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x223, x88, 88);
+   mul_pk256(x223, x223, x88);                           /* x176 = a^(2^176 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x223, x223, 44);
+   mul_pk256(x223, x223, x44);                           /* x220 = a^(2^220 -1) */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(x223, x223, 3);
+   mul_pk256(x223, x223, x3);                            /* x223 = a^(2^223 -1) */
+}
+
+/*
+// computes r = 1/z = z^(pk256-2) mod pk256
+//
+// note: z in in Montgomery domain (as soon mul() and sqr() below are amm-functions
+//       r in Montgomery domain too
+*/
+void MB_FUNC_NAME(ifma_aminv52_pk256_)(U64 r[], const U64 z[])
+{
+   __ALIGN64 U64 x223[LEN52];
+   __ALIGN64 U64 x22[LEN52];
+   __ALIGN64 U64 x2[LEN52];
+
+   MB_FUNC_NAME(pwr_x223_pk256_)(x223, x22, x2, z);
+
+   /* pk256-2 = (2^223 -1)*2^33 + (2^22 -1)*2^10 + 2^5 + (2^2 -1)*2^2 + 2^0 */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, x223, 23);
+   mul_pk256(r, r, x22);
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, r, 5);
+   mul_pk256(r, r, z);
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, r, 3);
+   mul_pk256(r, r, x2);
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, r, 2);
+   mul_pk256(r, r, z);
+}
+
+/*
+// computes r = a^((pk256+1)/4) mod pk256,
+// that is square root of a if a is a quadratic residue (pk256 = 3 mod 4)
+//
+// note: a and r in Montgomery domain
+*/
+void MB_FUNC_NAME(ifma_amsqrt52_pk256_)(U64 r[], const U64 a[])
+{
+   __ALIGN64 U64 x223[LEN52];
+   __ALIGN64 U64 x22[LEN52];
+   __ALIGN64 U64 x2[LEN52];
+
+   MB_FUNC_NAME(pwr_x223_pk256_)(x223, x22, x2, a);
+
+   /* (pk256+1)/4 = (2^223 -1)*2^31 + (2^22 -1)*2^8 + (2^2 -1)*2^2 */
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, x223, 23);
+   mul_pk256(r, r, x22);
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, r, 6);
+   mul_pk256(r, r, x2);
+   MB_FUNC_NAME(sqr_pk256_pwr_)(r, r, 2);
+}
+
+/*=====================================================================
+
+ Specialized single operations in pk256 - add, sub & neg
+
+=====================================================================*/
+
+void MB_FUNC_NAME(ifma_add52_pk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_add52x5_)(r, a, b, (U64*)pk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_sub52_pk256_)(U64 r[], const U64 a[], const U64 b[])
+{
+   MB_FUNC_NAME(ifma_sub52x5_)(r, a, b, (U64*)pk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_neg52_pk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_neg52x5_)(r, a, (U64*)pk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_double52_pk256_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_add52x5_)(r, a, a, (U64*)pk256x2_mb);
+}
+
+void MB_FUNC_NAME(ifma_tripple52_pk256_)(U64 r[], const U64 a[])
+{
+   __ALIGN64 U64 t[LEN52];
+   MB_FUNC_NAME(ifma_add52x5_)(t, a, a, (U64*)pk256x2_mb);
+   MB_FUNC_NAME(ifma_add52x5_)(r, t, a, (U64*)pk256x2_mb);
+}
+
+/* r = (a>=pk256)? a-pk256 : a */
+void MB_FUNC_NAME(ifma_reduce52_pk256_)(U64 R[], const U64 A[])
+{
+   /* r = a - pk256_mb */
+   U64 r0 = sub64(A[0], ((U64*)(pk256_mb))[0]);
+   U64 r1 = sub64(A[1], ((U64*)(pk256_mb))[1]);
+   U64 r2 = sub64(A[2], ((U64*)(pk256_mb))[2]);
+   U64 r3 = sub64(A[3], ((U64*)(pk256_mb))[3]);
+   U64 r4 = sub64(A[4], ((U64*)(pk256_mb))[4]);
+
+   /* normalize r0 - r4 */
+   NORM_ASHIFTR(r, 0, 1)
+   NORM_ASHIFTR(r, 1, 2)
+   NORM_ASHIFTR(r, 2, 3)
+   NORM_ASHIFTR(r, 3, 4)
+
+   /* r = a<pk256_mb? a : r */
+   __mb_mask lt = cmp64_mask(r4, get_zero64(), _MM_CMPINT_LT);
+   R[0] = mask_mov64(r0, lt, A[0]);
+   R[1] = mask_mov64(r1, lt, A[1]);
+   R[2] = mask_mov64(r2, lt, A[2]);
+   R[3] = mask_mov64(r3, lt, A[3]);
+   R[4] = mask_mov64(r4, lt, A[4]);
+}
+
+/* a==0 mod pk256 (a is expected in [0, 2*pk256) range) */
+__mb_mask MB_FUNC_NAME(ifma_is_zero_pk256_)(const U64 a[])
+{
+   return MB_FUNC_NAME(is_zero_FE256_)(a) | MB_FUNC_NAME(cmp_eq_FE256_)(a, (const U64 (*))pk256_mb);
+}
+
+__mb_mask MB_FUNC_NAME(ifma_cmp_lt_pk256_)(const U64 a[])
+{
+   return MB_FUNC_NAME(cmp_lt_FE256_)(a,(const U64 (*))pk256_mb);
+}
+
+__mb_mask MB_FUNC_NAME(ifma_check_range_pk256_)(const U64 A[])
+{
+   __mb_mask
+   mask = MB_FUNC_NAME(is_zero_FE256_)(A);
+   mask |= ~MB_FUNC_NAME(ifma_cmp_lt_pk256_)(A);
+
+   return mask;
+}
@@ -0,0 +1,300 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_secp256k1.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/secp256k1/ifma_ecpoint_secp256k1.h>
+
+#ifndef BN_OPENSSL_DISABLE
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#ifdef OPENSSL_IS_BORINGSSL
+#include <openssl/ecdsa.h>
+#endif
+#endif
+
+/* pk256 - nk256 */
+__ALIGN64 static const int64u pk256_minus_nk256_mb[PK256_LEN52][8] = {
+   { REP8_DECL(0x000da1722fc9baee) },
+   { REP8_DECL(0x0001950b75fc4402) },
+   { REP8_DECL(0x0000000001455123) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+/*
+// checks x-coordinate of the point P(X:Y:Z) against the value v (v < nk256):
+//    X/Z^2 == v (mod nk256) <=> X == v*Z^2 or X == (v+nk256)*Z^2 (if v+nk256 < pk256)
+// (no inversion required)
+*/
+static __mb_mask secp256k1_x_eq_mod_n(const SECP256K1_POINT* P, const U64 v[])
+{
+   __ALIGN64 U64 Z2[PK256_LEN52];
+   __ALIGN64 U64 X[PK256_LEN52];
+   __ALIGN64 U64 T[PK256_LEN52];
+
+   MB_FUNC_NAME(ifma_ams52_pk256_)(Z2, P->Z);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(X, P->X);
+
+   /* T = v*Z^2 */
+   MB_FUNC_NAME(ifma_tomont52_pk256_)(T, v);
+   MB_FUNC_NAME(ifma_amm52_pk256_)(T, T, Z2);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(T, T);
+   __mb_mask eq_mask = MB_FUNC_NAME(cmp_eq_FE256_)(T, X);
+
+   /* rare case: v+nk256 is a field element too */
+   __mb_mask vn_mask = MB_FUNC_NAME(cmp_lt_FE256_)(v, (const U64 (*))pk256_minus_nk256_mb) & ~eq_mask;
+   if(vn_mask) {
+      const U64* n = MB_FUNC_NAME(ifma_nk256_)();
+      int i;
+      for(i=0; i<PK256_LEN52; i++)
+         T[i] = add64(v[i], n[i]);
+      for(i=0; i<PK256_LEN52-1; i++) {
+         T[i+1] = add64(T[i+1], srli64(T[i], DIGIT_SIZE));
+         T[i] = and64(T[i], loadu64(VMASK52));
+      }
+      MB_FUNC_NAME(ifma_tomont52_pk256_)(T, T);
+      MB_FUNC_NAME(ifma_amm52_pk256_)(T, T, Z2);
+      MB_FUNC_NAME(ifma_frommont52_pk256_)(T, T);
+      eq_mask |= vn_mask & MB_FUNC_NAME(cmp_eq_FE256_)(T, X);
+   }
+
+   return eq_mask;
+}
+
+/*
+// ECDSA signature verification algorithm
+*/
+static __mb_mask secp256k1_ecdsa_verify_mb8(U64 sign_r[],
+                                            U64 sign_s[],
+                                            U64 msg[],
+                                SECP256K1_POINT* W)
+{
+   /* convert public key coords to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_pk256_)(W->X, W->X);
+   MB_FUNC_NAME(ifma_tomont52_pk256_)(W->Y, W->Y);
+   MB_FUNC_NAME(ifma_tomont52_pk256_)(W->Z, W->Z);
+
+   __ALIGN64 U64 h1[PK256_LEN52];
+   __ALIGN64 U64 h2[PK256_LEN52];
+
+   /* h = (sign_s)^(-1) */
+   MB_FUNC_NAME(ifma_tomont52_nk256_)(sign_s, sign_s);
+   MB_FUNC_NAME(ifma_aminv52_nk256_)(sign_s, sign_s);
+   /* h1 = msg * h */
+   MB_FUNC_NAME(ifma_tomont52_nk256_)(h1, msg);
+   MB_FUNC_NAME(ifma_amm52_nk256_)(h1, h1, sign_s);
+   MB_FUNC_NAME(ifma_frommont52_nk256_)(h1, h1);
+   /* h2 = sign_r * h */
+   MB_FUNC_NAME(ifma_tomont52_nk256_)(h2, sign_r);
+   MB_FUNC_NAME(ifma_amm52_nk256_)(h2, h2, sign_s);
+   MB_FUNC_NAME(ifma_frommont52_nk256_)(h2, h2);
+
+   // P = h1*G + h2*W
+   SECP256K1_POINT P;
+   MB_FUNC_NAME(ifma_ec_secp256k1_mul2_point_vartime_)(&P, h1, W, h2);
+
+   // P != 0
+   __mb_mask signature_err_mask = MB_FUNC_NAME(is_zero_point_cordinate_)(P.Z);
+
+   /* P.x mod n != sign_r */
+   signature_err_mask |= ~secp256k1_x_eq_mod_n(&P, sign_r);
+
+   return signature_err_mask;
+}
+
+/*
+// Verifies ECDSA signature
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages are being signed
+// pa_pubx[]         array of pointers to the public keys X-coordinates
+// pa_puby[]         array of pointers to the public keys Y-coordinates
+// pa_pubz[]         array of pointers to the public keys Z-coordinates
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_secp256k1_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                          const int8u* const pa_sign_s[8],
+                                          const int8u* const pa_msg[8],
+                                          const int64u* const pa_pubx[8],
+                                          const int64u* const pa_puby[8],
+                                          const int64u* const pa_pubz[8],
+                                                int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_msg || NULL==pa_sign_r || NULL==pa_sign_s) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+      const int8u* msg = pa_msg[buf_no];
+      const int8u* r = pa_sign_r[buf_no];
+      const int8u* s = pa_sign_s[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pubx || NULL==puby || NULL==msg || NULL== r || NULL==s || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 U64 msg[PK256_LEN52];
+   __ALIGN64 U64 sign_r[PK256_LEN52];
+   __ALIGN64 U64 sign_s[PK256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])msg, pa_msg, PK256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_r, pa_sign_r, PK256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_s, pa_sign_s, PK256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(msg), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   SECP256K1_POINT W;
+
+   ifma_BNU_to_mb8((int64u (*)[8])W.X, (const int64u* (*))pa_pubx, PK256_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])W.Y, (const int64u* (*))pa_puby, PK256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BNU_to_mb8((int64u (*)[8])W.Z, (const int64u* (*))pa_pubz, PK256_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FE256_)(W.Z, (U64*)ones);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __mb_mask signature_err_mask = secp256k1_ecdsa_verify_mb8(sign_r,sign_s,msg, &W);
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   return status;
+}
+
+/*
+// OpenSSL's specific implementations
+*/
+#ifndef BN_OPENSSL_DISABLE
+
+DLL_PUBLIC
+mbx_status mbx_secp256k1_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
+                                              const int8u*  const pa_msg[8],
+                                              const BIGNUM* const pa_pubx[8],
+                                              const BIGNUM* const pa_puby[8],
+                                              const BIGNUM* const pa_pubz[8],
+                                                    int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_puby || NULL==pa_msg || NULL==pa_sig) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const BIGNUM* pubx = pa_pubx[buf_no];
+      const BIGNUM* puby = pa_puby[buf_no];
+      const BIGNUM* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+      const int8u* msg = pa_msg[buf_no];
+      const ECDSA_SIG* sig = pa_sig[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pubx || NULL==puby || NULL==msg || NULL==sig || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+  /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   BIGNUM* pa_sign_r[8] = { 0,0,0,0,0,0,0,0 };
+   BIGNUM* pa_sign_s[8] = { 0,0,0,0,0,0,0,0 };
+
+   for (buf_no = 0; buf_no < 8; buf_no++)
+   {
+      if(pa_sig[buf_no] != NULL)
+      {
+         ECDSA_SIG_get0(pa_sig[buf_no], (const BIGNUM(**))pa_sign_r + buf_no,
+                                        (const BIGNUM(**))pa_sign_s + buf_no);
+      }
+   }
+
+   __ALIGN64 U64 msg[PK256_LEN52];
+   __ALIGN64 U64 sign_r[PK256_LEN52];
+   __ALIGN64 U64 sign_s[PK256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])msg, pa_msg, PK256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])sign_r, (const BIGNUM(**))pa_sign_r, PK256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])sign_s, (const BIGNUM(**))pa_sign_s, PK256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(msg), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nk256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   SECP256K1_POINT W;
+
+   ifma_BN_to_mb8((int64u (*)[8])W.X, pa_pubx, PK256_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])W.Y, pa_puby, PK256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BN_to_mb8((int64u (*)[8])W.Z, pa_pubz, PK256_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FE256_)(W.Z, (U64*)ones);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_pk256_)(W.Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __mb_mask signature_err_mask = secp256k1_ecdsa_verify_mb8(sign_r,sign_s,msg, &W);
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   return status;
+}
+
+#endif // BN_OPENSSL_DISABLE
@@ -0,0 +1,630 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/secp256k1/ifma_ecpoint_secp256k1.h>
+#include <internal/secp256k1/ifma_arith_secp256k1.h>
+
+/* simplify naming */
+#define sqr    MB_FUNC_NAME(ifma_ams52_pk256_)
+#define mul    MB_FUNC_NAME(ifma_amm52_pk256_)
+#define add    MB_FUNC_NAME(ifma_add52_pk256_)
+#define sub    MB_FUNC_NAME(ifma_sub52_pk256_)
+#define mul2   MB_FUNC_NAME(ifma_double52_pk256_)
+#define mul3   MB_FUNC_NAME(ifma_tripple52_pk256_)
+
+/*
+// Presentation of point at infinity:
+//    - projective (X : Y : 0)
+//    - affine     (0 : 0)
+*/
+
+/*
+// R(X3:Y3:Z3) = [2]P(X1:Y1:Z1)
+//
+// formulas (a=0):
+//    A = X1^2        B = Y1^2        C = B^2
+//    D = 2*((X1+B)^2 -A -C)
+//    E = 3*A
+//    X3= E^2 -2*D
+//    Y3= E*(D-X3) -8*C
+//    Z3= 2*Y1*Z1
+//
+// cost: 5S+2M+11A
+//
+*/
+void MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(SECP256K1_POINT* r, const SECP256K1_POINT* p)
+{
+   __ALIGN64 U64 A[PK256_LEN52];
+   __ALIGN64 U64 B[PK256_LEN52];
+   __ALIGN64 U64 C[PK256_LEN52];
+   __ALIGN64 U64 D[PK256_LEN52];
+   __ALIGN64 U64 E[PK256_LEN52];
+
+   const U64* X1 = p->X;   /* input point */
+   const U64* Y1 = p->Y;
+   const U64* Z1 = p->Z;
+   U64* X3 = r->X;         /* output point */
+   U64* Y3 = r->Y;
+   U64* Z3 = r->Z;
+
+   sqr(A, X1);       /* A = X1^2 */
+   sqr(B, Y1);       /* B = Y1^2 */
+   add(D, X1, B);    /* D = X1+B */
+   sqr(C, B);        /* C = Y1^4 */
+   sqr(D, D);        /* D = (X1+B)^2 */
+   sub(D, D, A);
+   sub(D, D, C);
+   mul2(D, D);       /* D = 2*((X1+B)^2 -A -C) = 4*X1*Y1^2 */
+   mul3(E, A);       /* E = 3*X1^2 */
+
+   mul(Z3, Y1, Z1);  /* Z3 = Y1*Z1 */
+   mul2(Z3, Z3);     /* Z3 = 2*Y1*Z1 */
+
+   sqr(X3, E);       /* X3 = E^2 */
+   mul2(A, D);
+   sub(X3, X3, A);   /* X3 = E^2 -2*D */
+
+   mul2(C, C);
+   mul2(C, C);
+   mul2(C, C);       /* C = 8*Y1^4 */
+   sub(D, D, X3);
+   mul(Y3, E, D);    /* Y3 = E*(D-X3) */
+   sub(Y3, Y3, C);   /* Y3 = E*(D-X3) -8*Y1^4 */
+}
+
+/*
+// R(X3:Y3:Z3) = P(X1:Y1:Z1) + Q(X2:Y2:Z2)
+//
+// formulas:
+//    A = X1*Z2^2     B = X2*Z1^2     C = Y1*Z2^3     D = Y2*Z1^3
+//    E = B-A         F = D-C
+//    X3= -E^3 -2*A*E^2 + F^2
+//    Y3= -C*E^3 + F*(A*E^2 -X3)
+//    Z3= Z1*Z2*E
+//
+// cost: 4S+12M+7A
+//
+*/
+void MB_FUNC_NAME(ifma_ec_secp256k1_add_point_)(SECP256K1_POINT* r, const SECP256K1_POINT* p, const SECP256K1_POINT* q)
+{
+   /* coordinates of p */
+   const U64* X1 = p->X;
+   const U64* Y1 = p->Y;
+   const U64* Z1 = p->Z;
+   __mb_mask p_at_infinity = MB_FUNC_NAME(is_zero_point_cordinate_)(p->Z);
+
+   /* coordinates of q */
+   const U64* X2 = q->X;
+   const U64* Y2 = q->Y;
+   const U64* Z2 = q->Z;
+   __mb_mask q_at_infinity = MB_FUNC_NAME(is_zero_point_cordinate_)(q->Z);
+
+   /* coordinates of temp point T(X3:Y3:Z3) */
+   __ALIGN64 U64 X3[PK256_LEN52];
+   __ALIGN64 U64 Y3[PK256_LEN52];
+   __ALIGN64 U64 Z3[PK256_LEN52];
+
+   /* temporary */
+   __ALIGN64 U64 U1[PK256_LEN52];
+   __ALIGN64 U64 U2[PK256_LEN52];
+   __ALIGN64 U64 S1[PK256_LEN52];
+   __ALIGN64 U64 S2[PK256_LEN52];
+   __ALIGN64 U64  H[PK256_LEN52];
+   __ALIGN64 U64  R[PK256_LEN52];
+
+   mul(S1, Y1, Z2);     /* S1 = Y1*Z2 */
+   sqr(U1, Z2);         /* U1 = Z2^2  */
+
+   mul(S2, Y2, Z1);     /* S2 = Y2*Z1 */
+   sqr(U2, Z1);         /* U2 = Z1^2 */
+
+   mul(S1, S1, U1);     /* S1 = Y1*Z2^3 */
+   mul(S2, S2, U2);     /* S2 = Y2*Z1^3 */
+
+   mul(U1, X1, U1);     /* U1 = X1*Z2^2 */
+   mul(U2, X2, U2);     /* U2 = X2*Z1^2 */
+
+   sub(R, S2, S1);      /* R = S2-S1 */
+   sub(H, U2, U1);      /* H = U2-U1 */
+
+   /* check if affine (p.x:p.y) == (q.x:q.y) and and do doubling if this happens */
+   __mb_mask x_are_equal = MB_FUNC_NAME(ifma_is_zero_pk256_)(H);
+   __mb_mask y_are_equal = MB_FUNC_NAME(ifma_is_zero_pk256_)(R);
+   __mb_mask points_are_equal = (x_are_equal & y_are_equal & (~p_at_infinity) & (~q_at_infinity));
+
+   SECP256K1_POINT P2;
+   MB_FUNC_NAME(set_point_to_infinity_)(&P2);
+   if (points_are_equal) {
+      MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(&P2, p);
+   }
+
+   mul(Z3, Z1, Z2);     /* Z3 = Z1*Z2 */
+   sqr(U2, H);          /* U2 = H^2 */
+   mul(Z3, Z3, H);      /* Z3 = (Z1*Z2)*H */
+   sqr(S2, R);          /* S2 = R^2 */
+   mul(H, H, U2);       /* H = H^3 */
+
+   mul(U1, U1, U2);     /* U1 = U1*H^2 */
+   sub(X3, S2, H);      /* X3 = R^2 - H^3 */
+   mul2(U2, U1);        /* U2 = 2*U1*H^2 */
+   mul(S1, S1, H);      /* S1 = S1*H^3 */
+   sub(X3, X3, U2);     /* X3 = (R^2 - H^3) -2*U1*H^2 */
+
+   sub(Y3, U1, X3);     /* Y3 = R*(U1*H^2 - X3) -S1*H^3 */
+   mul(Y3, Y3, R);
+   sub(Y3, Y3, S1);
+
+   /* T = p_at_infinity? q : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(X3, X3, p_at_infinity, q->X);
+   MB_FUNC_NAME(mask_mov_FE256_)(Y3, Y3, p_at_infinity, q->Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(Z3, Z3, p_at_infinity, q->Z);
+   /* T = q_at_infinity? p : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(X3, X3, q_at_infinity, p->X);
+   MB_FUNC_NAME(mask_mov_FE256_)(Y3, Y3, q_at_infinity, p->Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(Z3, Z3, q_at_infinity, p->Z);
+
+   /* r = points_are_equal? P2 : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(r->X, X3, points_are_equal, P2.X);
+   MB_FUNC_NAME(mask_mov_FE256_)(r->Y, Y3, points_are_equal, P2.Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(r->Z, Z3, points_are_equal, P2.Z);
+}
+
+/* to Montgomery conversion constant
+// r = 2^(PK256_LEN52*DIGIT_SIZE) mod pk256
+*/
+__ALIGN64 static const int64u pk256_r_mb[PK256_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x0000001000003d10) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+const U64* MB_FUNC_NAME(ifma_ec_secp256k1_coord_one_)(void)
+{
+   return (U64*)pk256_r_mb;
+}
+
+/*
+// R(X3:Y3:Z3) = P(X1:Y1:Z1) + Q(X2:Y2:Z2=1)
+//
+// formulas:
+//    A = X1          B = X2*Z1^2     C = Y1          D = Y2*Z1^3
+//    E = B-X1        F = D-Y1
+//    X3= -E^3 -2*X1*E^2 + F^2
+//    Y3= -Y1*E^3 + F*(X1*E^2 -X3)
+//    Z3= Z1*E
+//
+// cost: 3S+8M+7A
+*/
+void MB_FUNC_NAME(ifma_ec_secp256k1_add_point_affine_)(SECP256K1_POINT* r, const SECP256K1_POINT* p, const SECP256K1_POINT_AFFINE* q)
+{
+   /* coordinates of p (projective) */
+   const U64* X1 = p->X;
+   const U64* Y1 = p->Y;
+   const U64* Z1 = p->Z;
+   __mb_mask p_at_infinity = MB_FUNC_NAME(is_zero_point_cordinate_)(p->Z);
+
+   /* coordinates of q (affine) */
+   const U64* X2 = q->x;
+   const U64* Y2 = q->y;
+   __mb_mask q_at_infinity = MB_FUNC_NAME(is_zero_FE256_)(q->x)
+                           & MB_FUNC_NAME(is_zero_FE256_)(q->y);
+
+   /* coordinates of temp point T(X3:Y3:Z3) */
+   __ALIGN64 U64 X3[PK256_LEN52];
+   __ALIGN64 U64 Y3[PK256_LEN52];
+   __ALIGN64 U64 Z3[PK256_LEN52];
+
+   __ALIGN64 U64 U2[PK256_LEN52];
+   __ALIGN64 U64 S2[PK256_LEN52];
+   __ALIGN64 U64 H[PK256_LEN52];
+   __ALIGN64 U64 R[PK256_LEN52];
+
+   sqr(R, Z1);             // R = Z1^2
+   mul(S2, Y2, Z1);        // S2 = Y2*Z1
+   mul(U2, X2, R);         // U2 = X2*Z1^2
+   mul(S2, S2, R);         // S2 = Y2*Z1^3
+
+   sub(H, U2, X1);         // H = U2-X1
+   sub(R, S2, Y1);         // R = S2-Y1
+
+   /* check if affine (p.x:p.y) == (q.x:q.y) and and do doubling if this happens */
+   __mb_mask points_are_equal = MB_FUNC_NAME(ifma_is_zero_pk256_)(H)
+                              & MB_FUNC_NAME(ifma_is_zero_pk256_)(R)
+                              & (~p_at_infinity) & (~q_at_infinity);
+   SECP256K1_POINT P2;
+   MB_FUNC_NAME(set_point_to_infinity_)(&P2);
+   if (points_are_equal) {
+      MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(&P2, p);
+   }
+
+   mul(Z3, H, Z1);         // Z3 = H*Z1
+
+   sqr(U2, H);             // U2 = H^2
+   sqr(S2, R);             // S2 = R^2
+   mul(H, H, U2);          // H = H^3
+
+   mul(U2, U2, X1);        // U2 = X1*H^2
+
+   mul(Y3, H, Y1);         // T = Y1*H^3
+
+   mul2(X3, U2);           // X3 = 2*X1*H^2
+   sub(X3, S2, X3);        // X3 = R^2 - 2*X1*H^2
+   sub(X3, X3, H);         // X3 = R^2 - 2*X1*H^2 -H^3
+
+   sub(U2, U2, X3);        // U2 = X1*H^2 - X3
+   mul(U2, U2, R);         // U2 = R*(X1*H^2 - X3)
+   sub(Y3, U2, Y3);        // Y3 = -Y1*H^3 + R*(X1*H^2 - X3)
+
+   /* T = p_at_infinity? q : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(X3, X3, p_at_infinity, q->x);
+   MB_FUNC_NAME(mask_mov_FE256_)(Y3, Y3, p_at_infinity, q->y);
+   MB_FUNC_NAME(mask_mov_FE256_)(Z3, Z3, p_at_infinity, (U64*)pk256_r_mb);
+   /* T = q_at_infinity? p : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(X3, X3, q_at_infinity, p->X);
+   MB_FUNC_NAME(mask_mov_FE256_)(Y3, Y3, q_at_infinity, p->Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(Z3, Z3, q_at_infinity, p->Z);
+
+   /* r = points_are_equal? P2 : T */
+   MB_FUNC_NAME(mask_mov_FE256_)(r->X, X3, points_are_equal, P2.X);
+   MB_FUNC_NAME(mask_mov_FE256_)(r->Y, Y3, points_are_equal, P2.Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(r->Z, Z3, points_are_equal, P2.Z);
+}
+
+void MB_FUNC_NAME(get_secp256k1_ec_affine_coords_)(U64 x[], U64 y[], const SECP256K1_POINT* P)
+{
+   __ALIGN64 U64 invZ1[PK256_LEN52];
+   __ALIGN64 U64 invZn[PK256_LEN52];
+
+   /* 1/Z and 1/Z^2 */
+   MB_FUNC_NAME(ifma_aminv52_pk256_)(invZ1, P->Z);
+   MB_FUNC_NAME(ifma_ams52_pk256_)(invZn, invZ1);
+
+   /* if affine P.x requested */
+   if(x)
+      MB_FUNC_NAME(ifma_amm52_pk256_)(x, P->X, invZn);
+
+   /* if affine P.y requested */
+   if(y) {
+      MB_FUNC_NAME(ifma_amm52_pk256_)(invZn, invZn, invZ1);
+      MB_FUNC_NAME(ifma_amm52_pk256_)(y, P->Y, invZn);
+   }
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Variable-time double scalar multiplication (public scalars only).
+//
+// The endomorphism phi(x,y) = (beta*x, y) acts as [lambda] on the points of the curve,
+// so [k]P = [k1]P + [k2]phi(P), where k1 and k2 are half-size scalars.
+// [g]G + [k]P is computed by Straus' method over 4 half-size scalars:
+// the 128 doublings are shared, all the pre-computed tables are fetched by gather.
+*/
+
+#define VT_WIN_SIZE  (5)
+#define VT_N_ENTRY   (1<<(VT_WIN_SIZE-1))
+
+/* [i+1]*G and phi([i+1]*G), i=0,..,VT_N_ENTRY-1 (affine, Montgomery domain) */
+__ALIGN64 static const SINGLE_SECP256K1_POINT_AFFINE ifma_ec_secp256k1_bp_precomp[VT_N_ENTRY] = {
+   {{0x0002e5ad87e22bc9,0x000329bc66dbd736,0x000fd129c231e295,0x000f48979f48c033,0x0000981e643e9089}, {0x000a6d393dbaebec,0x000d1f1dc64db15e,0x00019c1368dfc5d5,0x0002d670b6b59aac,0x0000f3f851fd4a58}},
+   {{0x00040ca710490bff,0x000c88b285a04e06,0x00014040471354af,0x000e23ce0b62e1e0,0x0000918623ccba0e}, {0x000d6232facd0763,0x00067dc75ce17d12,0x000a2cc6584fd251,0x0003134b3a0f64bd,0x0000c7f7712157b9}},
+   {{0x000d4bc65fea9a69,0x000b22eb7bc42379,0x000985972066ceaf,0x0000ad5940d07385,0x0000497730fcdf4c}, {0x000b0b0913f56603,0x000dc5a1f91faf18,0x000885650ac4964c,0x000c76cc6048bd84,0x0000ec28dcd9215e}},
+   {{0x00013e8bf6a0c3a1,0x000d3b9b132f3daa,0x000b379e037571e4,0x0009b7de9fbe79f9,0x0000957e6951ca76}, {0x000e87e9bf5ebdd4,0x000f9400d1361372,0x0006a1839746dd1b,0x0002b9c3e5bac23d,0x0000c9a2dbb209e0}},
+   {{0x00047fd3ea19dae8,0x000ddc284cda2123,0x000dd41dd58d7334,0x00096f20ce358572,0x0000ed284d3aae7f}, {0x000784810dfda241,0x0008aad35cc59e5e,0x0008dbfd259aaa8d,0x0000c0011d0b107f,0x0000fd437ae58363}},
+   {{0x000e0903568f6ed5,0x00075355fe43d409,0x000b5b366534e4de,0x000a735d84dcf301,0x0000c8088490f91f}, {0x0000bf9c6a6b4ca0,0x000d82ae93be5dee,0x000c737a77ba780a,0x0009c3b9a0411797,0x0000175b14f2060a}},
+   {{0x000e5671aa4cc535,0x000716c087c407ec,0x0001d6bd5ca934f8,0x0006e04da362224e,0x0000f402433d7386}, {0x000d1130a77da2ec,0x0009f10972634777,0x00091ab04879d763,0x00073bf2fd13d872,0x00008043a670ba1a}},
+   {{0x0006206fe0b4b81c,0x000bfa606728f231,0x000408c8b7a060c0,0x000a8c376af358ab,0x00003088630cfa83}, {0x0003c71c52c2ee38,0x0004ece7dd34ceb0,0x000ea48b27b292c9,0x00086075193c47f1,0x00005b43f9979490}},
+   {{0x0006d276afd5c5c8,0x000f1ed7f74c46cc,0x0004b253d6edd9e7,0x000a728cec72c7f6,0x00007d71c6bf4d02}, {0x000d4ae268d25a40,0x000659794d80b2a0,0x000793574aec108c,0x00097cf0176bede6,0x0000156339094cef}},
+   {{0x0002988d778459ee,0x0002be40abcd55ca,0x000a2464f8c5126a,0x000b4870b8c02ede,0x00008cf0172cea73}, {0x000fd68e49bc2350,0x00015d4daacc6136,0x000deea914663602,0x000b2e60333362dd,0x0000d3a934a99edd}},
+   {{0x000c79024a7a2cf9,0x000993493bb804f0,0x00049a3c1349ebdf,0x000953d28558b5bb,0x0000d888be8bce5a}, {0x00022e37beacf4c0,0x0000f899acaa4343,0x00041572a755db98,0x000ac87cb76bd27b,0x0000e92c06d7705f}},
+   {{0x000e5817095e8ca5,0x0009b5f4abaeb915,0x0006bde735b0037a,0x000c5e5cc8065afd,0x0000a1ba91650a32}, {0x000cf5c450a1aab6,0x000e16ce529f0c75,0x000c736512a531f7,0x000c42c11a025902,0x00001aa286044355}},
+   {{0x00006c5659892337,0x000646aec93fd59a,0x0002a9988d35438e,0x000f7b5b370e50a0,0x0000065f32baff18}, {0x0007536f5d446895,0x0002948a3b411481,0x00013f5af0f73d05,0x000984db37e3a6c0,0x000095e4c3399b24}},
+   {{0x000ce60511995738,0x0005078e2e491e9c,0x0000c28c8f82a304,0x000ea215e738ff05,0x0000482dda73ed47}, {0x000a54d2c7e181d8,0x00015309b645dfea,0x000900c729df244f,0x00012eccaac1084b,0x000075e4a09819b1}},
+   {{0x0008da348620d8b3,0x00043ff3bffdd51e,0x000180a0ea9b1742,0x0002b18fe0d087f9,0x000029cf6f36a78a}, {0x00094e77cf90bcdf,0x000b5ca29845364e,0x000703fc8d97359f,0x000c3e1442e0ed9e,0x0000384d03b4965b}},
+   {{0x00085199fe24a9ab,0x0002cf43dec541a3,0x000f3f45a78d7716,0x000948952ed69488,0x00007f2007d526d9}, {0x000bfb8d7528988a,0x00008855c928b252,0x00031ad7535538b9,0x0003c0e6e1d02ce6,0x000046b9ec0f2e97}},
+};
+__ALIGN64 static const SINGLE_SECP256K1_POINT_AFFINE ifma_ec_secp256k1_bp_phi_precomp[VT_N_ENTRY] = {
+   {{0x0001bdb70357f26a,0x0008aa5bf5e1e074,0x0003e663f4fc1865,0x00007a356b7dfa23,0x0000d6e161a3afea}, {0x000a6d393dbaebec,0x000d1f1dc64db15e,0x00019c1368dfc5d5,0x0002d670b6b59aac,0x0000f3f851fd4a58}},
+   {{0x000ef8d7a4e6abc5,0x00023926d37d8338,0x000490995138d9de,0x00088538cba79830,0x0000729895b89b30}, {0x000d6232facd0763,0x00067dc75ce17d12,0x000a2cc6584fd251,0x0003134b3a0f64bd,0x0000c7f7712157b9}},
+   {{0x0007aee78e6e0b12,0x0005e7aacf1b9334,0x00054af940bf4f2d,0x00092757a32dcf71,0x0000940b775e96d3}, {0x000b0b0913f56603,0x000dc5a1f91faf18,0x000885650ac4964c,0x000c76cc6048bd84,0x0000ec28dcd9215e}},
+   {{0x000027596f8698de,0x000a0b563268f242,0x0007a22a10f0e567,0x00000fe0210185b0,0x000008cd188cf9a9}, {0x000e87e9bf5ebdd4,0x000f9400d1361372,0x0006a1839746dd1b,0x0002b9c3e5bac23d,0x0000c9a2dbb209e0}},
+   {{0x0005135c0a1e78a2,0x00040f9fbb1d6401,0x0005b40e389b740c,0x0004bbd3cc9b69ef,0x0000681a0c6a4b34}, {0x000784810dfda241,0x0008aad35cc59e5e,0x0008dbfd259aaa8d,0x0000c0011d0b107f,0x0000fd437ae58363}},
+   {{0x000d14993963c4e5,0x0000e574fa7ae296,0x000a4f1c63c9d755,0x000b3f81c0d43e51,0x000048ffb79666b2}, {0x0000bf9c6a6b4ca0,0x000d82ae93be5dee,0x000c737a77ba780a,0x0009c3b9a0411797,0x0000175b14f2060a}},
+   {{0x000b89a6dcb60d36,0x000818778c1c7ad8,0x000be84e28e57f96,0x00086e70e2e4ee08,0x0000c21991e5d348}, {0x000d1130a77da2ec,0x0009f10972634777,0x00091ab04879d763,0x00073bf2fd13d872,0x00008043a670ba1a}},
+   {{0x000e5d7b752d813c,0x0005f6e1e98a593b,0x000966ef9e71aee0,0x0004f0bc0146718d,0x00007f08319b591d}, {0x0003c71c52c2ee38,0x0004ece7dd34ceb0,0x000ea48b27b292c9,0x00086075193c47f1,0x00005b43f9979490}},
+   {{0x0005472f48e9cb96,0x0007e0d1705d1dd0,0x000cae5ca38f44c7,0x0001efda202285b3,0x0000448396e605f2}, {0x000d4ae268d25a40,0x000659794d80b2a0,0x000793574aec108c,0x00097cf0176bede6,0x0000156339094cef}},
+   {{0x000acaf43c788e61,0x00021914544f9686,0x000c03f00cc569df,0x00089a891abcefd4,0x0000064f0edb88cd}, {0x000fd68e49bc2350,0x00015d4daacc6136,0x000deea914663602,0x000b2e60333362dd,0x0000d3a934a99edd}},
+   {{0x000ef67bed7d809d,0x00032f399648b044,0x000d8688cd2473bb,0x00090ae872510f70,0x0000e7a0d16c5c75}, {0x00022e37beacf4c0,0x0000f899acaa4343,0x00041572a755db98,0x000ac87cb76bd27b,0x0000e92c06d7705f}},
+   {{0x00022ef1419a39df,0x000ca13fbdace5cd,0x000a6e22c25b4d03,0x000ee3ebe5474219,0x000014e7f083100a}, {0x000cf5c450a1aab6,0x000e16ce529f0c75,0x000c736512a531f7,0x000c42c11a025902,0x00001aa286044355}},
+   {{0x000f97b7c82c57f3,0x0004b38c7ade2504,0x0001758c343b1190,0x0006a240ddad5dee,0x00003e63baa02646}, {0x0007536f5d446895,0x0002948a3b411481,0x00013f5af0f73d05,0x000984db37e3a6c0,0x000095e4c3399b24}},
+   {{0x000fde556428fcf2,0x0003d5dfdbfba0fa,0x000f232ba17f5da1,0x0003d7c322ad2678,0x00008fb501b4a6a4}, {0x000a54d2c7e181d8,0x00015309b645dfea,0x000900c729df244f,0x00012eccaac1084b,0x000075e4a09819b1}},
+   {{0x000dc0bb2061769e,0x0005aafb04762b42,0x0007907a7e230d33,0x0007c52749bfb2cc,0x00000c93d09ca6cb}, {0x00094e77cf90bcdf,0x000b5ca29845364e,0x000703fc8d97359f,0x000c3e1442e0ed9e,0x0000384d03b4965b}},
+   {{0x000be16d1833e9ee,0x00008044ff4a9b44,0x00094fac0e85490a,0x000f734b94de4dee,0x00003e163e175632}, {0x000bfb8d7528988a,0x00008855c928b252,0x00031ad7535538b9,0x0003c0e6e1d02ce6,0x000046b9ec0f2e97}},
+};
+
+/* beta (cube root of unity mod pk256) in Montgomery domain */
+__ALIGN64 static const int64u mont_beta_pk256_mb[PK256_LEN52][8] = {
+   { REP8_DECL(0x000361cfe818af97) },
+   { REP8_DECL(0x00031c4b80af58a4) },
+   { REP8_DECL(0x0002e390503fde16) },
+   { REP8_DECL(0x000d53f8e98978d0) },
+   { REP8_DECL(0x0000a4a36aebcbb3) }
+};
+
+__INLINE void MB_FUNC_NAME(booth_recode_vt_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, VT_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(VT_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* window of the scalar (radix 2^64) at the bit position */
+__INLINE U64 MB_FUNC_NAME(get_wvalue_)(const U64 scalar[], int bit)
+{
+   U64 idx_mask = set1( (1<<(VT_WIN_SIZE+1))-1 );
+   U64 wvalue;
+
+   if(bit) {
+      int chunk_no = (bit-1)/64;
+      int chunk_shift = (bit-1)%64;
+
+      wvalue = loadu64(&scalar[chunk_no]);
+      #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+      {
+      U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+      U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+      wvalue = or64(t_lo_, t_hi_);
+      }
+      #else
+      wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+      #endif
+      wvalue = and64(wvalue, idx_mask);
+   }
+   else {
+      wvalue = loadu64(&scalar[0]);
+      wvalue = and64( slli64(wvalue, 1), idx_mask);
+   }
+   return wvalue;
+}
+
+/* gather point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_)(SECP256K1_POINT* r, const SECP256K1_POINT tbl[], U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset of the lane */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(SECP256K1_POINT)/sizeof(int64u)));
+   offset = add64(offset, lane_idx64());
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<PK256_LEN52; n++) {
+      r->X[n] = mask_gather64(zero, k, offset, tbl[0].X+n);
+      r->Y[n] = mask_gather64(zero, k, offset, tbl[0].Y+n);
+      r->Z[n] = mask_gather64(zero, k, offset, tbl[0].Z+n);
+   }
+}
+
+/* gather affine point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_affine_)(SECP256K1_POINT_AFFINE* r, const SINGLE_SECP256K1_POINT_AFFINE* tbl, U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(SINGLE_SECP256K1_POINT_AFFINE)/sizeof(int64u)));
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<PK256_LEN52; n++) {
+      r->x[n] = mask_gather64(zero, k, offset, tbl->x+n);
+      r->y[n] = mask_gather64(zero, k, offset, tbl->y+n);
+   }
+}
+
+/* half-size scalar (less than 2^GLV_BITSIZE) from radix 2^52 into radix 2^64 (with zero top chunk) */
+__INLINE void MB_FUNC_NAME(glv_to_radix64_)(U64 r[], const U64 k[])
+{
+   r[0] = or64(k[0], slli64(k[1], DIGIT_SIZE));
+   r[1] = or64(srli64(k[1], 64-DIGIT_SIZE), slli64(k[2], 2*DIGIT_SIZE-64));
+   r[2] = get_zero64();
+}
+
+void MB_FUNC_NAME(ifma_ec_secp256k1_mul2_point_vartime_)(SECP256K1_POINT* r, const U64 g_scalar[], const SECP256K1_POINT* p, const U64 p_scalar[])
+{
+   /* pre-computed tables: tbl[n] = [n+1]*p, tbl_phi[n] = phi([n+1]*p) */
+   __ALIGN64 SECP256K1_POINT tbl[VT_N_ENTRY];
+   __ALIGN64 SECP256K1_POINT tbl_phi[VT_N_ENTRY];
+
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].X, p->X);
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].Y, p->Y);
+   MB_FUNC_NAME(mov_FE256_)(tbl[0].Z, p->Z);
+   MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(&tbl[1], p);
+
+   int n;
+   for(n=1; n < VT_N_ENTRY/2; n++) {
+      MB_FUNC_NAME(ifma_ec_secp256k1_add_point_)(&tbl[2*n], &tbl[2*n-1], p);
+      MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(&tbl[2*n+1], &tbl[n]);
+   }
+   for(n=0; n < VT_N_ENTRY; n++) {
+      mul(tbl_phi[n].X, tbl[n].X, (U64*)mont_beta_pk256_mb);
+      MB_FUNC_NAME(mov_FE256_)(tbl_phi[n].Y, tbl[n].Y);
+      MB_FUNC_NAME(mov_FE256_)(tbl_phi[n].Z, tbl[n].Z);
+   }
+
+   /* g = g1 + g2*lambda, k = k1 + k2*lambda */
+   __ALIGN64 U64 k1[PK256_LEN52];
+   __ALIGN64 U64 k2[PK256_LEN52];
+   __ALIGN64 U64 scalar[4][GLV_LEN64+1];
+   __mb_mask scalar_neg[4];
+
+   MB_FUNC_NAME(ifma_glv_split52_nk256_)(k1, &scalar_neg[0], k2, &scalar_neg[1], g_scalar);
+   MB_FUNC_NAME(glv_to_radix64_)(scalar[0], k1);
+   MB_FUNC_NAME(glv_to_radix64_)(scalar[1], k2);
+   MB_FUNC_NAME(ifma_glv_split52_nk256_)(k1, &scalar_neg[2], k2, &scalar_neg[3], p_scalar);
+   MB_FUNC_NAME(glv_to_radix64_)(scalar[2], k1);
+   MB_FUNC_NAME(glv_to_radix64_)(scalar[3], k2);
+
+   SECP256K1_POINT R;
+   SECP256K1_POINT T;
+   SECP256K1_POINT_AFFINE A;
+   U64 Ty[PK256_LEN52];
+
+   U64  dvalue;
+   __mb_mask dsign, dmask;
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   /*
+   // point (LR) multiplication
+   */
+   const int top_bit = GLV_BITSIZE-(GLV_BITSIZE % VT_WIN_SIZE);
+   int bit;
+   for(bit=top_bit; bit>=0; bit-=VT_WIN_SIZE) {
+      /* doubling */
+      if(bit != top_bit) {
+         for(n=0; n<VT_WIN_SIZE; n++)
+            MB_FUNC_NAME(ifma_ec_secp256k1_dbl_point_)(&R, &R);
+      }
+
+      for(n=0; n<4; n++) {
+         MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, MB_FUNC_NAME(get_wvalue_)(scalar[n], bit));
+         dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+         /* nothing to accumulate in any lane */
+         if(!dmask)
+            continue;
+
+         /* sign of the digit and sign of the half-size scalar */
+         dsign ^= scalar_neg[n];
+
+         /* base point G and phi(G) */
+         if(n<2) {
+            MB_FUNC_NAME(gather_point_affine_)(&A, (0==n)? ifma_ec_secp256k1_bp_precomp : ifma_ec_secp256k1_bp_phi_precomp, dvalue, dmask);
+
+            /* A = dsign? -A : A */
+            MB_FUNC_NAME(ifma_neg52_pk256_)(Ty, A.y);
+            MB_FUNC_NAME(secure_mask_mov_FE256_)(A.y, A.y, dsign, Ty);
+
+            /* R += A */
+            MB_FUNC_NAME(ifma_ec_secp256k1_add_point_affine_)(&R, &R, &A);
+         }
+         /* point p and phi(p) */
+         else {
+            MB_FUNC_NAME(gather_point_)(&T, (2==n)? tbl : tbl_phi, dvalue, dmask);
+
+            /* T = dsign? -T : T */
+            MB_FUNC_NAME(ifma_neg52_pk256_)(Ty, T.Y);
+            MB_FUNC_NAME(secure_mask_mov_FE256_)(T.Y, T.Y, dsign, Ty);
+
+            /* R += T */
+            MB_FUNC_NAME(ifma_ec_secp256k1_add_point_)(&R, &R, &T);
+         }
+      }
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE256_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE256_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE256_)(r->Z, R.Z);
+}
+#undef VT_N_ENTRY
+#undef VT_WIN_SIZE
+
+/* secp256k1 parameters: mont(b) */
+__ALIGN64 static const int64u mont_b_pk256_mb[PK256_LEN52][8] = {
+   { REP8_DECL(0x000000700001ab70) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+/*
+// We have a curve defined by a Weierstrass equation: y^2 = x^3 + b.
+//
+// The points are considered in Jacobian projective coordinates
+// where  (X, Y, Z)  represents  (x, y) = (X/Z^2, Y/Z^3).
+// Substituting this and multiplying by  Z^6  transforms the above equation into
+//      Y^2 = X^3 + b*Z^6
+// To test this, we add up the right-hand side in 'rh'.
+*/
+__mb_mask MB_FUNC_NAME(ifma_is_on_curve_pk256_)(const SECP256K1_POINT* p, int use_jproj_coords)
+{
+   U64 rh[PK256_LEN52];
+   U64 tmp[PK256_LEN52];
+
+   /* rh := X^3 */
+   MB_FUNC_NAME(ifma_ams52_pk256_)(rh, p->X);
+   MB_FUNC_NAME(ifma_amm52_pk256_)(rh, rh, p->X);
+
+   /* if Z!=1, then rh = X^3 + b*Z^6 */
+   if(use_jproj_coords) {
+      MB_FUNC_NAME(ifma_ams52_pk256_)(tmp, p->Z);        /* tmp = Z^2 */
+      MB_FUNC_NAME(ifma_amm52_pk256_)(tmp, tmp, p->Z);   /* tmp = Z^3 */
+      MB_FUNC_NAME(ifma_ams52_pk256_)(tmp, tmp);         /* tmp = Z^6 */
+      MB_FUNC_NAME(ifma_amm52_pk256_)(tmp, tmp, (U64*)mont_b_pk256_mb);
+      MB_FUNC_NAME(ifma_add52_pk256_)(rh, rh, tmp);      /* rh = X^3 + b*Z^6 */
+   }
+   /* if Z==1, then rh = X^3 + b */
+   else {
+      MB_FUNC_NAME(ifma_add52_pk256_)(rh, rh, (U64*)mont_b_pk256_mb);
+   }
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(rh, rh);
+
+   /* rl = tmp = Y^2 */
+   MB_FUNC_NAME(ifma_ams52_pk256_)(tmp, p->Y);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(tmp, tmp);
+
+   /* mask = rl==rh */
+   __mb_mask is_on_curve_mask = MB_FUNC_NAME(cmp_eq_FE256_)(tmp, rh);
+
+   return is_on_curve_mask;
+}
+
+/*
+// Computes y-coordinate of the EC point by its x-coordinate:
+//      y = sqrt(x^3 + b)
+// Returns mask of lanes the square root exists for.
+//
+// note: x and y are in Montgomery domain, y is any of two roots
+*/
+__mb_mask MB_FUNC_NAME(ifma_decompress_y_pk256_)(U64 y[], const U64 x[])
+{
+   U64 rh[PK256_LEN52], tmp[PK256_LEN52];
+
+   /* rh = x^3 + b */
+   MB_FUNC_NAME(ifma_ams52_pk256_)(rh, x);
+   MB_FUNC_NAME(ifma_amm52_pk256_)(rh, rh, x);
+   MB_FUNC_NAME(ifma_add52_pk256_)(rh, rh, (U64*)mont_b_pk256_mb);
+
+   /* y = rh^((p+1)/4) */
+   MB_FUNC_NAME(ifma_amsqrt52_pk256_)(y, rh);
+
+   /* mask = y^2==rh */
+   MB_FUNC_NAME(ifma_ams52_pk256_)(tmp, y);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(tmp, tmp);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(rh, rh);
+
+   return MB_FUNC_NAME(cmp_eq_FE256_)(tmp, rh);
+}
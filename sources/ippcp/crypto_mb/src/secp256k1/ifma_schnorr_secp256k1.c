@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_secp256k1.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/secp256k1/ifma_ecpoint_secp256k1.h>
+#include <internal/sha/sha2_mb8.h>
+
+/*
+// SHA256 state after processing of the prefix SHA256("BIP0340/challenge") || SHA256("BIP0340/challenge")
+// of the tagged hash (BIP-340)
+*/
+static const int32u bip340_challenge_midstate[8] = {
+   0x9CECBA11, 0x23925381, 0x11679112, 0xD1627E0F, 0x97C87550, 0x003CC765, 0x90F61164, 0x33E9B66A };
+
+#define BIP340_TAG_PREFIX_LEN (2*SHA256_DIGEST_SIZE)
+
+/*
+// computes challenge
+//    e = int(hash_BIP0340/challenge(bytes(r) || bytes(P) || m)) mod nk256
+// of the buffers with ok status
+*/
+static void secp256k1_schnorr_challenge_mb8(U64 e[],
+                                            const int8u* const pa_sign_r[8],
+                                            const int8u* const pa_pubx[8],
+                                            const int8u* const pa_msg[8],
+                                            const int msg_len[8],
+                                            mbx_status status)
+{
+   __ALIGN64 sha256_hash_mb8 hash;
+   __ALIGN64 int8u prefix[8][SHA256_MSG_BLOCK_SIZE];
+   __ALIGN64 int8u digest[8][SHA256_DIGEST_SIZE];
+   int8u* prefix_pa[8];
+   int8u* digest_pa[8];
+   int prefix_len[8];
+   int i, buf_no;
+
+   for(i=0; i<8; i++)
+      _mm256_storeu_si256((__m256i*)hash[i], _mm256_set1_epi32((int)bip340_challenge_midstate[i]));
+
+   /* bytes(r) || bytes(P) is exactly one block */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      prefix_pa[buf_no] = prefix[buf_no];
+      digest_pa[buf_no] = NULL;
+      prefix_len[buf_no] = 0;
+
+      if(MBX_STATUS_OK!=MBX_GET_STS(status, buf_no))
+         continue;
+
+      for(i=0; i<PK256_LEN8; i++) {
+         prefix[buf_no][i] = pa_sign_r[buf_no][i];
+         prefix[buf_no][PK256_LEN8+i] = pa_pubx[buf_no][i];
+      }
+      prefix_len[buf_no] = SHA256_MSG_BLOCK_SIZE;
+      digest_pa[buf_no] = digest[buf_no];
+   }
+
+   sha256_avx512_mb8(hash, (const int8u* const*)prefix_pa, prefix_len);
+   sha256_msg_digest_cont_mb8(digest_pa, hash, BIP340_TAG_PREFIX_LEN+SHA256_MSG_BLOCK_SIZE, pa_msg, msg_len);
+
+   ifma_HexStr8_to_mb8((int64u (*)[8])e, (const int8u* const*)digest_pa, PK256_BITSIZE);
+   MB_FUNC_NAME(ifma_fastred52_pnk256_)(e, e);
+}
+
+/*
+// BIP-340 signature verification algorithm:
+//    P = lift_x(px)
+//    R = [s]G - [e]P
+//    R != O, has_even_y(R) and x(R) == r
+*/
+static __mb_mask secp256k1_schnorr_verify_mb8(const U64 sign_r[],
+                                              const U64 sign_s[],
+                                              const U64 e[],
+                                              const U64 pubx[])
+{
+   SECP256K1_POINT P;
+   __ALIGN64 U64 T[PK256_LEN52];
+
+   MB_FUNC_NAME(ifma_tomont52_pk256_)(P.X, pubx);
+   MB_FUNC_NAME(mov_FE256_)(P.Z, MB_FUNC_NAME(ifma_ec_secp256k1_coord_one_)());
+
+   /* P must be on the curve */
+   __mb_mask signature_err_mask = ~MB_FUNC_NAME(ifma_decompress_y_pk256_)(P.Y, P.X);
+
+   /* -P = (x, p-y) with odd y, as soon lift_x() chooses even one */
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(T, P.Y);
+   __mb_mask y_even = cmpeq64_mask(and64_const(T[0], 1), get_zero64());
+   MB_FUNC_NAME(ifma_neg52_pk256_)(T, P.Y);
+   MB_FUNC_NAME(mask_mov_FE256_)(P.Y, P.Y, y_even, T);
+
+   /* R = [s]G + [e](-P) */
+   SECP256K1_POINT R;
+   MB_FUNC_NAME(ifma_ec_secp256k1_mul2_point_vartime_)(&R, sign_s, &P, e);
+
+   /* R != O */
+   signature_err_mask |= MB_FUNC_NAME(is_zero_point_cordinate_)(R.Z);
+
+   __ALIGN64 U64 x[PK256_LEN52];
+   __ALIGN64 U64 y[PK256_LEN52];
+   MB_FUNC_NAME(get_secp256k1_ec_affine_coords_)(x, y, &R);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(x, x);
+   MB_FUNC_NAME(ifma_frommont52_pk256_)(y, y);
+
+   /* has_even_y(R) */
+   signature_err_mask |= ~cmpeq64_mask(and64_const(y[0], 1), get_zero64());
+   /* x(R) == r */
+   signature_err_mask |= ~MB_FUNC_NAME(cmp_eq_FE256_)(x, sign_r);
+
+   return signature_err_mask;
+}
+
+/*
+// Verifies BIP-340 Schnorr signature
+// pa_sign_r[]       array of pointers to the r-components of the signatures (32 bytes, big endian)
+// pa_sign_s[]       array of pointers to the s-components of the signatures (32 bytes, big endian)
+// pa_msg[]          array of pointers to the messages that have been signed
+// msg_len[]         array of messages length
+// pa_pubx[]         array of pointers to the signer's x-only public keys (32 bytes, big endian)
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_secp256k1_schnorr_verify_mb8(const int8u* const pa_sign_r[8],
+                                            const int8u* const pa_sign_s[8],
+                                            const int8u* const pa_msg[8],
+                                                     const int msg_len[8],
+                                            const int8u* const pa_pubx[8],
+                                                  int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_pubx || NULL==pa_msg || NULL==msg_len || NULL==pa_sign_r || NULL==pa_sign_s) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int8u* pubx = pa_pubx[buf_no];
+      const int8u* msg = pa_msg[buf_no];
+      const int8u* r = pa_sign_r[buf_no];
+      const int8u* s = pa_sign_s[buf_no];
+
+      /* if any of pointer NULL set error status (empty message is allowed) */
+      if(NULL==pubx || (NULL==msg && 0!=msg_len[buf_no]) || NULL==r || NULL==s) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(0>msg_len[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 U64 pubx[PK256_LEN52];
+   __ALIGN64 U64 sign_r[PK256_LEN52];
+   __ALIGN64 U64 sign_s[PK256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])pubx, pa_pubx, PK256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_r, pa_sign_r, PK256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_s, pa_sign_s, PK256_BITSIZE);
+
+   /* px < pk256, r < pk256, s < nk256 */
+   status |= MBX_SET_STS_BY_MASK(status, ~MB_FUNC_NAME(ifma_cmp_lt_pk256_)(pubx), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, ~MB_FUNC_NAME(ifma_cmp_lt_pk256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, ~MB_FUNC_NAME(ifma_cmp_lt_nk256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 U64 e[PK256_LEN52];
+   secp256k1_schnorr_challenge_mb8(e, pa_sign_r, pa_pubx, pa_msg, msg_len, status);
+
+   __mb_mask signature_err_mask = secp256k1_schnorr_verify_mb8(sign_r, sign_s, e, pubx);
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   return status;
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/sha/sha3_mb8.h>
+
+#include <immintrin.h>
+
+#define KECCAK_ROUNDS  (24)
+
+/* round constants */
+__ALIGN64 static const int64u keccak_rc[KECCAK_ROUNDS] = {
+   0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+   0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+   0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+   0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+   0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+   0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* Boolean functions: XOR5 = a^b^c^d^e, CHI(a,b,c) = a^(~b&c) */
+#define XOR5(A,B,C,D,E) _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64((A), (B), (C), 0x96), (D), (E), 0x96)
+#define CHI(A,B,C)      _mm512_ternarylogic_epi64((A), (B), (C), 0xD2)
+
+/* 8 independent states are processed in parallel, word [x+5*y] of the state of buffer j is in lane j of a(x+5*y) */
+void keccak_f1600_avx512_mb8(int64u state[][8], __mmask8 mb_mask)
+{
+   __m512i a00, a01, a02, a03, a04,
+           a05, a06, a07, a08, a09,
+           a10, a11, a12, a13, a14,
+           a15, a16, a17, a18, a19,
+           a20, a21, a22, a23, a24;
+   __m512i b00, b01, b02, b03, b04,
+           b05, b06, b07, b08, b09,
+           b10, b11, b12, b13, b14,
+           b15, b16, b17, b18, b19,
+           b20, b21, b22, b23, b24;
+   __m512i C0, C1, C2, C3, C4;
+   __m512i D0, D1, D2, D3, D4;
+
+   a00 = _mm512_loadu_si512(state[0]);
+   a01 = _mm512_loadu_si512(state[1]);
+   a02 = _mm512_loadu_si512(state[2]);
+   a03 = _mm512_loadu_si512(state[3]);
+   a04 = _mm512_loadu_si512(state[4]);
+   a05 = _mm512_loadu_si512(state[5]);
+   a06 = _mm512_loadu_si512(state[6]);
+   a07 = _mm512_loadu_si512(state[7]);
+   a08 = _mm512_loadu_si512(state[8]);
+   a09 = _mm512_loadu_si512(state[9]);
+   a10 = _mm512_loadu_si512(state[10]);
+   a11 = _mm512_loadu_si512(state[11]);
+   a12 = _mm512_loadu_si512(state[12]);
+   a13 = _mm512_loadu_si512(state[13]);
+   a14 = _mm512_loadu_si512(state[14]);
+   a15 = _mm512_loadu_si512(state[15]);
+   a16 = _mm512_loadu_si512(state[16]);
+   a17 = _mm512_loadu_si512(state[17]);
+   a18 = _mm512_loadu_si512(state[18]);
+   a19 = _mm512_loadu_si512(state[19]);
+   a20 = _mm512_loadu_si512(state[20]);
+   a21 = _mm512_loadu_si512(state[21]);
+   a22 = _mm512_loadu_si512(state[22]);
+   a23 = _mm512_loadu_si512(state[23]);
+   a24 = _mm512_loadu_si512(state[24]);
+
+   for(int rnd=0; rnd<KECCAK_ROUNDS; rnd++) {
+      /* theta */
+      C0 = XOR5(a00, a05, a10, a15, a20);
+      C1 = XOR5(a01, a06, a11, a16, a21);
+      C2 = XOR5(a02, a07, a12, a17, a22);
+      C3 = XOR5(a03, a08, a13, a18, a23);
+      C4 = XOR5(a04, a09, a14, a19, a24);
+      D0 = _mm512_xor_si512(C4, _mm512_rol_epi64(C1, 1));
+      D1 = _mm512_xor_si512(C0, _mm512_rol_epi64(C2, 1));
+      D2 = _mm512_xor_si512(C1, _mm512_rol_epi64(C3, 1));
+      D3 = _mm512_xor_si512(C2, _mm512_rol_epi64(C4, 1));
+      D4 = _mm512_xor_si512(C3, _mm512_rol_epi64(C0, 1));
+
+      /* rho and pi */
+      b00 = _mm512_xor_si512(a00, D0);
+      b10 = _mm512_rol_epi64(_mm512_xor_si512(a01, D1), 1);
+      b20 = _mm512_rol_epi64(_mm512_xor_si512(a02, D2), 62);
+      b05 = _mm512_rol_epi64(_mm512_xor_si512(a03, D3), 28);
+      b15 = _mm512_rol_epi64(_mm512_xor_si512(a04, D4), 27);
+      b16 = _mm512_rol_epi64(_mm512_xor_si512(a05, D0), 36);
+      b01 = _mm512_rol_epi64(_mm512_xor_si512(a06, D1), 44);
+      b11 = _mm512_rol_epi64(_mm512_xor_si512(a07, D2), 6);
+      b21 = _mm512_rol_epi64(_mm512_xor_si512(a08, D3), 55);
+      b06 = _mm512_rol_epi64(_mm512_xor_si512(a09, D4), 20);
+      b07 = _mm512_rol_epi64(_mm512_xor_si512(a10, D0), 3);
+      b17 = _mm512_rol_epi64(_mm512_xor_si512(a11, D1), 10);
+      b02 = _mm512_rol_epi64(_mm512_xor_si512(a12, D2), 43);
+      b12 = _mm512_rol_epi64(_mm512_xor_si512(a13, D3), 25);
+      b22 = _mm512_rol_epi64(_mm512_xor_si512(a14, D4), 39);
+      b23 = _mm512_rol_epi64(_mm512_xor_si512(a15, D0), 41);
+      b08 = _mm512_rol_epi64(_mm512_xor_si512(a16, D1), 45);
+      b18 = _mm512_rol_epi64(_mm512_xor_si512(a17, D2), 15);
+      b03 = _mm512_rol_epi64(_mm512_xor_si512(a18, D3), 21);
+      b13 = _mm512_rol_epi64(_mm512_xor_si512(a19, D4), 8);
+      b14 = _mm512_rol_epi64(_mm512_xor_si512(a20, D0), 18);
+      b24 = _mm512_rol_epi64(_mm512_xor_si512(a21, D1), 2);
+      b09 = _mm512_rol_epi64(_mm512_xor_si512(a22, D2), 61);
+      b19 = _mm512_rol_epi64(_mm512_xor_si512(a23, D3), 56);
+      b04 = _mm512_rol_epi64(_mm512_xor_si512(a24, D4), 14);
+
+      /* chi */
+      a00 = CHI(b00, b01, b02);
+      a01 = CHI(b01, b02, b03);
+      a02 = CHI(b02, b03, b04);
+      a03 = CHI(b03, b04, b00);
+      a04 = CHI(b04, b00, b01);
+      a05 = CHI(b05, b06, b07);
+      a06 = CHI(b06, b07, b08);
+      a07 = CHI(b07, b08, b09);
+      a08 = CHI(b08, b09, b05);
+      a09 = CHI(b09, b05, b06);
+      a10 = CHI(b10, b11, b12);
+      a11 = CHI(b11, b12, b13);
+      a12 = CHI(b12, b13, b14);
+      a13 = CHI(b13, b14, b10);
+      a14 = CHI(b14, b10, b11);
+      a15 = CHI(b15, b16, b17);
+      a16 = CHI(b16, b17, b18);
+      a17 = CHI(b17, b18, b19);
+      a18 = CHI(b18, b19, b15);
+      a19 = CHI(b19, b15, b16);
+      a20 = CHI(b20, b21, b22);
+      a21 = CHI(b21, b22, b23);
+      a22 = CHI(b22, b23, b24);
+      a23 = CHI(b23, b24, b20);
+      a24 = CHI(b24, b20, b21);
+
+      /* iota */
+      a00 = _mm512_xor_si512(a00, _mm512_set1_epi64((long long)keccak_rc[rnd]));
+   }
+
+   _mm512_mask_storeu_epi64(state[0], mb_mask, a00);
+   _mm512_mask_storeu_epi64(state[1], mb_mask, a01);
+   _mm512_mask_storeu_epi64(state[2], mb_mask, a02);
+   _mm512_mask_storeu_epi64(state[3], mb_mask, a03);
+   _mm512_mask_storeu_epi64(state[4], mb_mask, a04);
+   _mm512_mask_storeu_epi64(state[5], mb_mask, a05);
+   _mm512_mask_storeu_epi64(state[6], mb_mask, a06);
+   _mm512_mask_storeu_epi64(state[7], mb_mask, a07);
+   _mm512_mask_storeu_epi64(state[8], mb_mask, a08);
+   _mm512_mask_storeu_epi64(state[9], mb_mask, a09);
+   _mm512_mask_storeu_epi64(state[10], mb_mask, a10);
+   _mm512_mask_storeu_epi64(state[11], mb_mask, a11);
+   _mm512_mask_storeu_epi64(state[12], mb_mask, a12);
+   _mm512_mask_storeu_epi64(state[13], mb_mask, a13);
+   _mm512_mask_storeu_epi64(state[14], mb_mask, a14);
+   _mm512_mask_storeu_epi64(state[15], mb_mask, a15);
+   _mm512_mask_storeu_epi64(state[16], mb_mask, a16);
+   _mm512_mask_storeu_epi64(state[17], mb_mask, a17);
+   _mm512_mask_storeu_epi64(state[18], mb_mask, a18);
+   _mm512_mask_storeu_epi64(state[19], mb_mask, a19);
+   _mm512_mask_storeu_epi64(state[20], mb_mask, a20);
+   _mm512_mask_storeu_epi64(state[21], mb_mask, a21);
+   _mm512_mask_storeu_epi64(state[22], mb_mask, a22);
+   _mm512_mask_storeu_epi64(state[23], mb_mask, a23);
+   _mm512_mask_storeu_epi64(state[24], mb_mask, a24);
+}
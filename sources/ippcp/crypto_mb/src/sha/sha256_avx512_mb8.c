@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/sha/sha2_mb8.h>
+
+__ALIGN64 static const int32u sha256_cnt[] = {
+   0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+   0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+   0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+   0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+   0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+   0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+   0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+   0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/* change endian */
+static __ALIGN64 const int8u swapBytes32[] = { 3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+                                               3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12 };
+
+#define SIMD_ENDIANNESS32(x) _mm256_shuffle_epi8((x), _mm256_loadu_si256((__m256i*)swapBytes32))
+
+/* Boolean functions: Ch(x,y,z) = (x&y)^(~x&z), Maj(x,y,z) = (x&y)^(x&z)^(y&z) */
+#define CH(X,Y,Z)  _mm256_ternarylogic_epi32((X), (Y), (Z), 0xCA)
+#define MAJ(X,Y,Z) _mm256_ternarylogic_epi32((X), (Y), (Z), 0xE8)
+
+/* Sigma functions */
+#define SUM0(X) _mm256_ternarylogic_epi32(_mm256_ror_epi32((X), 2), _mm256_ror_epi32((X),13), _mm256_ror_epi32((X),22), 0x96)
+#define SUM1(X) _mm256_ternarylogic_epi32(_mm256_ror_epi32((X), 6), _mm256_ror_epi32((X),11), _mm256_ror_epi32((X),25), 0x96)
+#define SIG0(X) _mm256_ternarylogic_epi32(_mm256_ror_epi32((X), 7), _mm256_ror_epi32((X),18), _mm256_srli_epi32((X), 3), 0x96)
+#define SIG1(X) _mm256_ternarylogic_epi32(_mm256_ror_epi32((X),17), _mm256_ror_epi32((X),19), _mm256_srli_epi32((X),10), 0x96)
+
+/* Update W: W[t] = SIG1(W[t-2]) + W[t-7] + SIG0(W[t-15]) + W[t-16] */
+#define WUPDATE(nr, W) \
+   (W[(nr)&15] = _mm256_add_epi32(_mm256_add_epi32(SIG1(W[((nr)-2)&15]), W[((nr)-7)&15]), \
+                                  _mm256_add_epi32(SIG0(W[((nr)-15)&15]), W[(nr)&15])))
+
+/* SHA256 step */
+#define STEP_SHA256(nr, A,B,C,D,E,F,G,H, W) {\
+   __m256i T1 = _mm256_add_epi32(_mm256_add_epi32(H, SUM1(E)), CH(E, F, G));\
+   T1 = _mm256_add_epi32(_mm256_add_epi32(T1, _mm256_set1_epi32((int)sha256_cnt[nr])), W[(nr)&15]);\
+   __m256i T2 = _mm256_add_epi32(SUM0(A), MAJ(A, B, C));\
+   H = G;                          \
+   G = F;                          \
+   F = E;                          \
+   E = _mm256_add_epi32(D, T1);    \
+   D = C;                          \
+   C = B;                          \
+   B = A;                          \
+   A = _mm256_add_epi32(T1, T2);   \
+}
+
+void sha256_avx512_mb8(int32u hash_pa[][8], const int8u* const msg_pa[8], int len[8])
+{
+   int t;
+
+   __m256i W[16];
+   __m256i Vi[8];
+   __m256i A, B, C, D, E, F, G, H;
+
+   /* local pointers to data and lengths */
+   __m512i loc_data = _mm512_loadu_si512((__m512i*)msg_pa);
+   __m256i loc_len = _mm256_loadu_si256((__m256i*)len);
+
+   /* processing mask: buffers of non-zero length */
+   __mmask8 mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+
+   /* Load hash value */
+   Vi[0] = _mm256_loadu_si256((__m256i*)hash_pa);
+   Vi[1] = _mm256_loadu_si256((__m256i*)(hash_pa + 1));
+   Vi[2] = _mm256_loadu_si256((__m256i*)(hash_pa + 2));
+   Vi[3] = _mm256_loadu_si256((__m256i*)(hash_pa + 3));
+   Vi[4] = _mm256_loadu_si256((__m256i*)(hash_pa + 4));
+   Vi[5] = _mm256_loadu_si256((__m256i*)(hash_pa + 5));
+   Vi[6] = _mm256_loadu_si256((__m256i*)(hash_pa + 6));
+   Vi[7] = _mm256_loadu_si256((__m256i*)(hash_pa + 7));
+
+   /* Loop over the message */
+   while(mb_mask) {
+      /* Gather (transpose) the message block, data of not processed buffers are not loaded */
+      for(t=0; t<16; t++) {
+         __m512i addr = _mm512_add_epi64(loc_data, _mm512_set1_epi64(t*(int)sizeof(int32u)));
+         W[t] = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), mb_mask, addr, NULL, 1);
+         W[t] = SIMD_ENDIANNESS32(W[t]);
+      }
+
+      A = Vi[0]; B = Vi[1]; C = Vi[2]; D = Vi[3];
+      E = Vi[4]; F = Vi[5]; G = Vi[6]; H = Vi[7];
+
+      /* Compression function */
+      for(t=0; t<16; t++)
+         STEP_SHA256(t, A, B, C, D, E, F, G, H, W);
+      for(; t<64; t++) {
+         WUPDATE(t, W);
+         STEP_SHA256(t, A, B, C, D, E, F, G, H, W);
+      }
+
+      /* Update hash of processed buffers */
+      Vi[0] = _mm256_mask_add_epi32(Vi[0], mb_mask, A, Vi[0]);
+      Vi[1] = _mm256_mask_add_epi32(Vi[1], mb_mask, B, Vi[1]);
+      Vi[2] = _mm256_mask_add_epi32(Vi[2], mb_mask, C, Vi[2]);
+      Vi[3] = _mm256_mask_add_epi32(Vi[3], mb_mask, D, Vi[3]);
+      Vi[4] = _mm256_mask_add_epi32(Vi[4], mb_mask, E, Vi[4]);
+      Vi[5] = _mm256_mask_add_epi32(Vi[5], mb_mask, F, Vi[5]);
+      Vi[6] = _mm256_mask_add_epi32(Vi[6], mb_mask, G, Vi[6]);
+      Vi[7] = _mm256_mask_add_epi32(Vi[7], mb_mask, H, Vi[7]);
+
+      /* Update pointers to data, local lengths and mask */
+      loc_data = _mm512_mask_add_epi64(loc_data, mb_mask, loc_data, _mm512_set1_epi64(SHA256_MSG_BLOCK_SIZE));
+      loc_len = _mm256_mask_sub_epi32(loc_len, mb_mask, loc_len, _mm256_set1_epi32(SHA256_MSG_BLOCK_SIZE));
+      mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+   }
+
+   _mm256_storeu_si256((__m256i*)hash_pa, Vi[0]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 1), Vi[1]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 2), Vi[2]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 3), Vi[3]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 4), Vi[4]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 5), Vi[5]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 6), Vi[6]);
+   _mm256_storeu_si256((__m256i*)(hash_pa + 7), Vi[7]);
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/sha/sha2_mb8.h>
+
+static const int32u sha256_iv[] = {
+   0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19 };
+
+static const int64u sha384_iv[] = {
+   0xCBBB9D5DC1059ED8ULL, 0x629A292A367CD507ULL, 0x9159015A3070DD17ULL, 0x152FECD8F70E5939ULL,
+   0x67332667FFC00B31ULL, 0x8EB44A8768581511ULL, 0xDB0C2E0D64F98FA7ULL, 0x47B5481DBEFA4FA4ULL };
+
+const int64u sha512_iv[8] = {
+   0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
+   0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL, 0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL };
+
+/*
+// Prepare processing of the message:
+//    - full blocks of the message are processed directly from the message buffer (proc_len[])
+//    - the rest of message, 0x80 padding byte and message length (bitsize, big endian)
+//      are put into one or two blocks of the local tail buffer (tail_len[])
+//    - prefixLen bytes (multiple of the block size) already absorbed into the hash
+//      are accounted in the message length
+*/
+static void sha2_split_msg_mb8(int proc_len[8], int tail_len[8], int8u* tail_pa[8],
+                               int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8],
+                               int prefixLen, int blockSize, int lenRepr)
+{
+   int buf_no;
+   for(buf_no=0; buf_no<SHA2_NUM_BUFFERS8; buf_no++) {
+      int8u* tail = tail_pa[buf_no];
+      int msgLen, restLen, n;
+      int64u msgBitLen;
+
+      if(NULL==hash_pa[buf_no]) {
+         proc_len[buf_no] = 0;
+         tail_len[buf_no] = 0;
+         continue;
+      }
+
+      msgLen = (NULL==msg_pa[buf_no])? 0 : len[buf_no];
+      proc_len[buf_no] = msgLen & (-blockSize);
+      restLen = msgLen - proc_len[buf_no];
+      tail_len[buf_no] = (restLen + 1 + lenRepr <= blockSize)? blockSize : 2*blockSize;
+
+      for(n=0; n<restLen; n++)
+         tail[n] = msg_pa[buf_no][proc_len[buf_no] + n];
+      tail[n++] = 0x80;
+      for(; n<tail_len[buf_no]; n++)
+         tail[n] = 0;
+
+      /* message length in bits (big endian) */
+      msgBitLen = ((int64u)prefixLen + (int64u)msgLen) << 3;
+      for(n=0; n<(int)sizeof(int64u); n++)
+         tail[tail_len[buf_no] - 1 - n] = (int8u)(msgBitLen >> (n*8));
+   }
+}
+
+void sha256_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8])
+{
+   __ALIGN64 sha256_hash_mb8 hash;
+   int i;
+
+   for(i=0; i<8; i++)
+      _mm256_storeu_si256((__m256i*)hash[i], _mm256_set1_epi32((int)sha256_iv[i]));
+
+   sha256_msg_digest_cont_mb8(hash_pa, hash, 0, msg_pa, len);
+}
+
+void sha256_msg_digest_cont_mb8(int8u* const hash_pa[8], sha256_hash_mb8 hash, int prefix_len,
+                                const int8u* const msg_pa[8], const int len[8])
+{
+   __ALIGN64 int8u tail[SHA2_NUM_BUFFERS8][SHA256_MSG_BLOCK_SIZE*2];
+   int8u* tail_pa[SHA2_NUM_BUFFERS8] = { tail[0], tail[1], tail[2], tail[3],
+                                         tail[4], tail[5], tail[6], tail[7] };
+   __ALIGN64 int proc_len[SHA2_NUM_BUFFERS8];
+   __ALIGN64 int tail_len[SHA2_NUM_BUFFERS8];
+   int i, buf_no;
+
+   sha2_split_msg_mb8(proc_len, tail_len, tail_pa, hash_pa, msg_pa, len, prefix_len, SHA256_MSG_BLOCK_SIZE, (int)SHA256_MSG_LEN_REPR);
+
+   sha256_avx512_mb8(hash, msg_pa, proc_len);
+   sha256_avx512_mb8(hash, (const int8u* const*)tail_pa, tail_len);
+
+   /* store hash (big endian) */
+   for(buf_no=0; buf_no<SHA2_NUM_BUFFERS8; buf_no++) {
+      int8u* out = hash_pa[buf_no];
+      if(NULL==out)
+         continue;
+      for(i=0; i<SHA256_DIGEST_SIZE/(int)sizeof(int32u); i++) {
+         int32u h = hash[i][buf_no];
+         out[4*i+0] = (int8u)(h>>24);
+         out[4*i+1] = (int8u)(h>>16);
+         out[4*i+2] = (int8u)(h>>8);
+         out[4*i+3] = (int8u)h;
+      }
+   }
+
+   /* clear copy of the message tail */
+   for(buf_no=0; buf_no<SHA2_NUM_BUFFERS8; buf_no++) {
+      _mm512_storeu_si512(tail[buf_no], _mm512_setzero_si512());
+      _mm512_storeu_si512(tail[buf_no]+SHA256_MSG_BLOCK_SIZE, _mm512_setzero_si512());
+   }
+}
+
+static void sha512_family_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8],
+                                         const int64u iv[8], int digestSize)
+{
+   __ALIGN64 sha512_hash_mb8 hash;
+   __ALIGN64 int8u tail[SHA2_NUM_BUFFERS8][SHA512_MSG_BLOCK_SIZE*2];
+   int8u* tail_pa[SHA2_NUM_BUFFERS8] = { tail[0], tail[1], tail[2], tail[3],
+                                         tail[4], tail[5], tail[6], tail[7] };
+   __ALIGN64 int proc_len[SHA2_NUM_BUFFERS8];
+   __ALIGN64 int tail_len[SHA2_NUM_BUFFERS8];
+   int i, n, buf_no;
+
+   for(i=0; i<8; i++)
+      _mm512_storeu_si512(hash[i], _mm512_set1_epi64((long long)iv[i]));
+
+   sha2_split_msg_mb8(proc_len, tail_len, tail_pa, hash_pa, msg_pa, len, 0, SHA512_MSG_BLOCK_SIZE, (int)SHA512_MSG_LEN_REPR);
+
+   sha512_avx512_mb8(hash, msg_pa, proc_len);
+   sha512_avx512_mb8(hash, (const int8u* const*)tail_pa, tail_len);
+
+   /* store hash (big endian) */
+   for(buf_no=0; buf_no<SHA2_NUM_BUFFERS8; buf_no++) {
+      int8u* out = hash_pa[buf_no];
+      if(NULL==out)
+         continue;
+      for(i=0; i<digestSize/(int)sizeof(int64u); i++) {
+         int64u h = hash[i][buf_no];
+         for(n=0; n<(int)sizeof(int64u); n++)
+            out[8*i+n] = (int8u)(h >> (56-8*n));
+      }
+   }
+
+   /* clear copy of the message tail */
+   for(buf_no=0; buf_no<SHA2_NUM_BUFFERS8; buf_no++) {
+      for(n=0; n<SHA512_MSG_BLOCK_SIZE*2; n+=64)
+         _mm512_storeu_si512(tail[buf_no]+n, _mm512_setzero_si512());
+   }
+}
+
+void sha384_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8])
+{
+   sha512_family_msg_digest_mb8(hash_pa, msg_pa, len, sha384_iv, SHA384_DIGEST_SIZE);
+}
+
+void sha512_msg_digest_mb8(int8u* const hash_pa[8], const int8u* const msg_pa[8], const int len[8])
+{
+   sha512_family_msg_digest_mb8(hash_pa, msg_pa, len, sha512_iv, SHA512_DIGEST_SIZE);
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <internal/sha/sha2_mb8.h>
+
+__ALIGN64 static const int64u sha512_cnt[] = {
+   0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+   0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL, 0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+   0xD807AA98A3030242ULL, 0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+   0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+   0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL, 0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+   0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+   0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+   0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL, 0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+   0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+   0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+   0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL, 0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+   0xD192E819D6EF5218ULL, 0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+   0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+   0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL, 0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+   0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+   0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+   0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL, 0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+   0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+   0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+   0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL, 0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
+};
+
+/* change endian */
+static __ALIGN64 const int8u swapBytes64[] = { 7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8 };
+
+#define SIMD_ENDIANNESS64(x) _mm512_shuffle_epi8((x), _mm512_loadu_si512((__m512i*)swapBytes64))
+
+/* Boolean functions: Ch(x,y,z) = (x&y)^(~x&z), Maj(x,y,z) = (x&y)^(x&z)^(y&z) */
+#define CH(X,Y,Z)  _mm512_ternarylogic_epi64((X), (Y), (Z), 0xCA)
+#define MAJ(X,Y,Z) _mm512_ternarylogic_epi64((X), (Y), (Z), 0xE8)
+
+/* Sigma functions */
+#define SUM0(X) _mm512_ternarylogic_epi64(_mm512_ror_epi64((X),28), _mm512_ror_epi64((X),34), _mm512_ror_epi64((X),39), 0x96)
+#define SUM1(X) _mm512_ternarylogic_epi64(_mm512_ror_epi64((X),14), _mm512_ror_epi64((X),18), _mm512_ror_epi64((X),41), 0x96)
+#define SIG0(X) _mm512_ternarylogic_epi64(_mm512_ror_epi64((X), 1), _mm512_ror_epi64((X), 8), _mm512_srli_epi64((X), 7), 0x96)
+#define SIG1(X) _mm512_ternarylogic_epi64(_mm512_ror_epi64((X),19), _mm512_ror_epi64((X),61), _mm512_srli_epi64((X), 6), 0x96)
+
+/* Update W: W[t] = SIG1(W[t-2]) + W[t-7] + SIG0(W[t-15]) + W[t-16] */
+#define WUPDATE(nr, W) \
+   (W[(nr)&15] = _mm512_add_epi64(_mm512_add_epi64(SIG1(W[((nr)-2)&15]), W[((nr)-7)&15]), \
+                                  _mm512_add_epi64(SIG0(W[((nr)-15)&15]), W[(nr)&15])))
+
+/* SHA512 step */
+#define STEP_SHA512(nr, A,B,C,D,E,F,G,H, W) {\
+   __m512i T1 = _mm512_add_epi64(_mm512_add_epi64(H, SUM1(E)), CH(E, F, G));\
+   T1 = _mm512_add_epi64(_mm512_add_epi64(T1, _mm512_set1_epi64((long long)sha512_cnt[nr])), W[(nr)&15]);\
+   __m512i T2 = _mm512_add_epi64(SUM0(A), MAJ(A, B, C));\
+   H = G;                          \
+   G = F;                          \
+   F = E;                          \
+   E = _mm512_add_epi64(D, T1);    \
+   D = C;                          \
+   C = B;                          \
+   B = A;                          \
+   A = _mm512_add_epi64(T1, T2);   \
+}
+
+void sha512_avx512_mb8(int64u hash_pa[][8], const int8u* const msg_pa[8], int len[8])
+{
+   int t;
+
+   __m512i W[16];
+   __m512i Vi[8];
+   __m512i A, B, C, D, E, F, G, H;
+
+   /* local pointers to data and lengths */
+   __m512i loc_data = _mm512_loadu_si512((__m512i*)msg_pa);
+   __m256i loc_len = _mm256_loadu_si256((__m256i*)len);
+
+   /* processing mask: buffers of non-zero length */
+   __mmask8 mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+
+   /* Load hash value */
+   Vi[0] = _mm512_loadu_si512((__m512i*)hash_pa);
+   Vi[1] = _mm512_loadu_si512((__m512i*)(hash_pa + 1));
+   Vi[2] = _mm512_loadu_si512((__m512i*)(hash_pa + 2));
+   Vi[3] = _mm512_loadu_si512((__m512i*)(hash_pa + 3));
+   Vi[4] = _mm512_loadu_si512((__m512i*)(hash_pa + 4));
+   Vi[5] = _mm512_loadu_si512((__m512i*)(hash_pa + 5));
+   Vi[6] = _mm512_loadu_si512((__m512i*)(hash_pa + 6));
+   Vi[7] = _mm512_loadu_si512((__m512i*)(hash_pa + 7));
+
+   /* Loop over the message */
+   while(mb_mask) {
+      /* Gather (transpose) the message block, data of not processed buffers are not loaded */
+      for(t=0; t<16; t++) {
+         __m512i addr = _mm512_add_epi64(loc_data, _mm512_set1_epi64(t*(int)sizeof(int64u)));
+         W[t] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mb_mask, addr, NULL, 1);
+         W[t] = SIMD_ENDIANNESS64(W[t]);
+      }
+
+      A = Vi[0]; B = Vi[1]; C = Vi[2]; D = Vi[3];
+      E = Vi[4]; F = Vi[5]; G = Vi[6]; H = Vi[7];
+
+      /* Compression function */
+      for(t=0; t<16; t++)
+         STEP_SHA512(t, A, B, C, D, E, F, G, H, W);
+      for(; t<80; t++) {
+         WUPDATE(t, W);
+         STEP_SHA512(t, A, B, C, D, E, F, G, H, W);
+      }
+
+      /* Update hash of processed buffers */
+      Vi[0] = _mm512_mask_add_epi64(Vi[0], mb_mask, A, Vi[0]);
+      Vi[1] = _mm512_mask_add_epi64(Vi[1], mb_mask, B, Vi[1]);
+      Vi[2] = _mm512_mask_add_epi64(Vi[2], mb_mask, C, Vi[2]);
+      Vi[3] = _mm512_mask_add_epi64(Vi[3], mb_mask, D, Vi[3]);
+      Vi[4] = _mm512_mask_add_epi64(Vi[4], mb_mask, E, Vi[4]);
+      Vi[5] = _mm512_mask_add_epi64(Vi[5], mb_mask, F, Vi[5]);
+      Vi[6] = _mm512_mask_add_epi64(Vi[6], mb_mask, G, Vi[6]);
+      Vi[7] = _mm512_mask_add_epi64(Vi[7], mb_mask, H, Vi[7]);
+
+      /* Update pointers to data, local lengths and mask */
+      loc_data = _mm512_mask_add_epi64(loc_data, mb_mask, loc_data, _mm512_set1_epi64(SHA512_MSG_BLOCK_SIZE));
+      loc_len = _mm256_mask_sub_epi32(loc_len, mb_mask, loc_len, _mm256_set1_epi32(SHA512_MSG_BLOCK_SIZE));
+      mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+   }
+
+   _mm512_storeu_si512((__m512i*)hash_pa, Vi[0]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 1), Vi[1]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 2), Vi[2]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 3), Vi[3]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 4), Vi[4]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 5), Vi[5]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 6), Vi[6]);
+   _mm512_storeu_si512((__m512i*)(hash_pa + 7), Vi[7]);
+}
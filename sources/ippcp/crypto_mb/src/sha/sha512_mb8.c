@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/sha512.h>
+
+#include <internal/sha/sha2_mb8.h>
+#include <internal/common/ifma_defs.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+static void sha512_mask_init_mb8(SHA512_CTX_mb8* p_state, __mmask8 mb_mask)
+{
+   int i;
+
+   for(i=0; i<SHA512_NUM_BUFFERS8; i++) {
+      if((mb_mask >> i) & 1) {
+         p_state->msg_buff_idx[i] = 0;
+         p_state->msg_len[i] = 0;
+         _mm512_storeu_si512(p_state->msg_buffer[i], _mm512_setzero_si512());
+         _mm512_storeu_si512(p_state->msg_buffer[i]+64, _mm512_setzero_si512());
+      }
+   }
+
+   for(i=0; i<8; i++)
+      _mm512_storeu_si512(p_state->msg_hash[i], _mm512_mask_set1_epi64(_mm512_loadu_si512(p_state->msg_hash[i]), mb_mask, (long long)sha512_iv[i]));
+}
+
+DLL_PUBLIC
+mbx_status mbx_sha512_init_mb8(SHA512_CTX_mb8* p_state)
+{
+   mbx_status status = 0;
+
+   /* test state pointer */
+   if(NULL==p_state) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   sha512_mask_init_mb8(p_state, 0xFF);
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sha512_update_mb8(const int8u* const msg_pa[8], const int len[8], SHA512_CTX_mb8* p_state)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==msg_pa || NULL==len || NULL==p_state) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* blocks completed in the internal buffers */
+   __ALIGN64 int buff_len[SHA512_NUM_BUFFERS8];
+   const int8u* buff_pa[SHA512_NUM_BUFFERS8];
+   /* whole blocks processed directly from the input */
+   __ALIGN64 int proc_len[SHA512_NUM_BUFFERS8];
+   const int8u* proc_pa[SHA512_NUM_BUFFERS8];
+   /* the rest of input kept in the internal buffers */
+   int rest_len[SHA512_NUM_BUFFERS8];
+
+   for(buf_no=0; buf_no<SHA512_NUM_BUFFERS8; buf_no++) {
+      const int8u* src = msg_pa[buf_no];
+      int8u* buffer = p_state->msg_buffer[buf_no];
+      int idx = p_state->msg_buff_idx[buf_no];
+      int n = len[buf_no];
+
+      buff_pa[buf_no] = buffer;
+      buff_len[buf_no] = 0;
+      proc_pa[buf_no] = src;
+      proc_len[buf_no] = 0;
+      rest_len[buf_no] = 0;
+
+      if(0 > n) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      if(0 == n)
+         continue;
+      if(NULL == src) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+
+      p_state->msg_len[buf_no] += (int64u)n;
+
+      /* complete the block partially filled by the previous update */
+      if(idx) {
+         int k = (n < SHA512_MSG_BLOCK_SIZE - idx)? n : SHA512_MSG_BLOCK_SIZE - idx;
+         for(int j=0; j<k; j++)
+            buffer[idx+j] = src[j];
+         idx += k;
+         src += k;
+         n -= k;
+         if(SHA512_MSG_BLOCK_SIZE == idx) {
+            buff_len[buf_no] = SHA512_MSG_BLOCK_SIZE;
+            idx = 0;
+         }
+      }
+
+      /* whole blocks of the input, the rest is kept in the internal buffer */
+      proc_pa[buf_no] = src;
+      proc_len[buf_no] = n & (-SHA512_MSG_BLOCK_SIZE);
+      rest_len[buf_no] = n - proc_len[buf_no];
+      if(rest_len[buf_no])
+         idx = rest_len[buf_no];
+
+      p_state->msg_buff_idx[buf_no] = idx;
+   }
+
+   /* completed internal blocks precede the input blocks */
+   sha512_avx512_mb8(p_state->msg_hash, buff_pa, buff_len);
+   sha512_avx512_mb8(p_state->msg_hash, proc_pa, proc_len);
+
+   /* the internal buffers are free now, store the rest of input */
+   for(buf_no=0; buf_no<SHA512_NUM_BUFFERS8; buf_no++) {
+      if(rest_len[buf_no]) {
+         const int8u* src = proc_pa[buf_no] + proc_len[buf_no];
+         for(int j=0; j<rest_len[buf_no]; j++)
+            p_state->msg_buffer[buf_no][j] = src[j];
+      }
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sha512_final_mb8(int8u* hash_pa[8], SHA512_CTX_mb8* p_state)
+{
+   mbx_status status = 0;
+   int i, n, buf_no;
+
+   /* test input pointers */
+   if(NULL==hash_pa || NULL==p_state) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* the rest of message, 0x80 padding byte and message length (bitsize, big endian) */
+   __ALIGN64 int8u tail[SHA512_NUM_BUFFERS8][SHA512_MSG_BLOCK_SIZE*2];
+   const int8u* tail_pa[SHA512_NUM_BUFFERS8] = { tail[0], tail[1], tail[2], tail[3],
+                                                 tail[4], tail[5], tail[6], tail[7] };
+   __ALIGN64 int tail_len[SHA512_NUM_BUFFERS8];
+   __mmask8 mb_mask = 0;
+
+   for(buf_no=0; buf_no<SHA512_NUM_BUFFERS8; buf_no++) {
+      int idx = p_state->msg_buff_idx[buf_no];
+      int64u msgLen = p_state->msg_len[buf_no];
+
+      if(NULL==hash_pa[buf_no]) {
+         tail_len[buf_no] = 0;
+         continue;
+      }
+      mb_mask |= (__mmask8)(1 << buf_no);
+
+      tail_len[buf_no] = (idx + 1 + (int)SHA512_MSG_LEN_REPR <= SHA512_MSG_BLOCK_SIZE)? SHA512_MSG_BLOCK_SIZE : 2*SHA512_MSG_BLOCK_SIZE;
+
+      for(n=0; n<idx; n++)
+         tail[buf_no][n] = p_state->msg_buffer[buf_no][n];
+      tail[buf_no][n++] = 0x80;
+      for(; n<tail_len[buf_no]; n++)
+         tail[buf_no][n] = 0;
+
+      /* 128-bit message length in bits */
+      for(n=0; n<(int)sizeof(int64u); n++) {
+         tail[buf_no][tail_len[buf_no] - 1 - n] = (int8u)((msgLen << 3) >> (n*8));
+         tail[buf_no][tail_len[buf_no] - 1 - (int)sizeof(int64u) - n] = (int8u)((msgLen >> 61) >> (n*8));
+      }
+   }
+
+   sha512_avx512_mb8(p_state->msg_hash, tail_pa, tail_len);
+
+   /* store hash (big endian) */
+   for(buf_no=0; buf_no<SHA512_NUM_BUFFERS8; buf_no++) {
+      int8u* out = hash_pa[buf_no];
+      if(NULL==out)
+         continue;
+      for(i=0; i<SHA512_DIGEST_SIZE/(int)sizeof(int64u); i++) {
+         int64u h = p_state->msg_hash[i][buf_no];
+         for(n=0; n<(int)sizeof(int64u); n++)
+            out[8*i+n] = (int8u)(h >> (56-8*n));
+      }
+   }
+
+   /* clear copy of the message tail and re-init finalized buffers */
+   MB_FUNC_NAME(zero_)((int64u(*)[8])tail, sizeof(tail)/sizeof(U64));
+   sha512_mask_init_mb8(p_state, mb_mask);
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sha512_msg_digest_mb8(const int8u* const msg_pa[8], const int len[8], int8u* hash_pa[8])
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==msg_pa || NULL==len || NULL==hash_pa) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* buffers with incorrect parameters are not hashed */
+   int8u* loc_hash_pa[SHA512_NUM_BUFFERS8];
+
+   for(buf_no=0; buf_no<SHA512_NUM_BUFFERS8; buf_no++) {
+      loc_hash_pa[buf_no] = NULL;
+
+      if(NULL==hash_pa[buf_no] || (len[buf_no] && NULL==msg_pa[buf_no]))
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      else if(0 > len[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      else
+         loc_hash_pa[buf_no] = hash_pa[buf_no];
+   }
+
+   if(MBX_IS_ANY_OK_STS(status))
+      sha512_msg_digest_mb8(loc_hash_pa, msg_pa, len);
+
+   return status;
+}
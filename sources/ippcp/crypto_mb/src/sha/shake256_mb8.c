@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/sha/sha3_mb8.h>
+
+#include <immintrin.h>
+
+/* byte i of the state of buffer j */
+#define STATE_BYTE(ST, I, J)  (((int8u*)&((ST)[(I)/8][(J)]))[(I)%8])
+
+void shake256_init_mb8(shake256_state_mb8* p_state)
+{
+   int i;
+   for(i=0; i<KECCAK_STATE_WORDS; i++)
+      _mm512_storeu_si512(p_state->state[i], _mm512_setzero_si512());
+   for(i=0; i<SHA3_NUM_BUFFERS8; i++)
+      p_state->pos[i] = 0;
+}
+
+void shake256_update_mb8(const int8u* const msg_pa[8], const int len[8], shake256_state_mb8* p_state)
+{
+   const int8u* src[SHA3_NUM_BUFFERS8];
+   int rest[SHA3_NUM_BUFFERS8];
+   int buf_no;
+
+   for(buf_no=0; buf_no<SHA3_NUM_BUFFERS8; buf_no++) {
+      src[buf_no] = msg_pa[buf_no];
+      rest[buf_no] = (NULL==msg_pa[buf_no] || len[buf_no]<0)? 0 : len[buf_no];
+   }
+
+   for(;;) {
+      __mmask8 full_mask = 0;
+      int any_rest = 0;
+
+      /* absorb up to the end of the current block of every buffer */
+      for(buf_no=0; buf_no<SHA3_NUM_BUFFERS8; buf_no++) {
+         int pos = p_state->pos[buf_no];
+         int n = SHAKE256_RATE - pos;
+         n = (rest[buf_no] < n)? rest[buf_no] : n;
+
+         /* bytes up to the word boundary, whole words, the tail */
+         for(; n>0 && (pos%8); n--, pos++)
+            STATE_BYTE(p_state->state, pos, buf_no) ^= *src[buf_no]++;
+         for(; n>=8; n-=8, pos+=8, src[buf_no]+=8)
+            p_state->state[pos/8][buf_no] ^= *(const int64u*)src[buf_no];
+         for(; n>0; n--, pos++)
+            STATE_BYTE(p_state->state, pos, buf_no) ^= *src[buf_no]++;
+
+         rest[buf_no] -= pos - p_state->pos[buf_no];
+         p_state->pos[buf_no] = pos;
+
+         if(SHAKE256_RATE==pos) {
+            full_mask |= (__mmask8)(1 << buf_no);
+            p_state->pos[buf_no] = 0;
+         }
+         any_rest |= rest[buf_no];
+      }
+
+      /* completed blocks are permuted at once */
+      if(full_mask)
+         keccak_f1600_avx512_mb8(p_state->state, full_mask);
+
+      if(0==any_rest)
+         break;
+   }
+}
+
+void shake256_final_mb8(int8u* const out_pa[8], int out_len, shake256_state_mb8* p_state)
+{
+   int buf_no;
+
+   /* SHAKE domain separation and padding: 0x1F ... 0x80 */
+   for(buf_no=0; buf_no<SHA3_NUM_BUFFERS8; buf_no++) {
+      STATE_BYTE(p_state->state, p_state->pos[buf_no], buf_no) ^= 0x1F;
+      STATE_BYTE(p_state->state, SHAKE256_RATE-1, buf_no) ^= 0x80;
+   }
+
+   /* squeeze */
+   for(int offset=0; offset<out_len; offset+=SHAKE256_RATE) {
+      keccak_f1600_avx512_mb8(p_state->state, 0xFF);
+
+      int n = out_len - offset;
+      n = (n > SHAKE256_RATE)? SHAKE256_RATE : n;
+      for(buf_no=0; buf_no<SHA3_NUM_BUFFERS8; buf_no++) {
+         if(NULL==out_pa[buf_no])
+            continue;
+         for(int i=0; i<n; i++)
+            out_pa[buf_no][offset+i] = STATE_BYTE(p_state->state, i, buf_no);
+      }
+   }
+}
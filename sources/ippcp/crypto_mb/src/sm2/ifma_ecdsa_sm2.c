@@ -21,6 +21,7 @@
 #include <internal/common/ifma_defs.h>
 #include <internal/common/ifma_cvt52.h>
 #include <internal/sm2/ifma_ecpoint_sm2.h>
+#include <internal/sm2/ifma_hash_sm2.h>
 #include <internal/sm3/sm3_mb8.h>
 #include <internal/rsa/ifma_rsa_arith.h>
 
@@ -32,69 +33,12 @@
 #endif
 #endif
 
-/* constants for Z digest computation */
-/* EC SM2 equation coeficient a, big endian */
-static const int8u a[]  = "\xFF\xFF\xFF\xFE\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x00\x00\x00\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFC";
-/* EC SM2 equation coeficient b, big endian */
-static const int8u b[]  = "\x28\xE9\xFA\x9E\x9D\x9F\x5E\x34\x4D\x5A\x9E\x4B\xCF\x65\x09\xA7\xF3\x97\x89\xF5\x15\xAB\x8F\x92\xDD\xBC\xBD\x41\x4D\x94\x0E\x93";
-/* x coordinate of the EC SM2 generator point in affine coordinates, big endian */
-static const int8u xG[] = "\x32\xC4\xAE\x2C\x1F\x19\x81\x19\x5F\x99\x04\x46\x6A\x39\xC9\x94\x8F\xE3\x0B\xBF\xF2\x66\x0B\xE1\x71\x5A\x45\x89\x33\x4C\x74\xC7";
-/* y coordinate of the EC SM2 generator point in affine coordinates, big endian */
-static const int8u yG[] = "\xBC\x37\x36\xA2\xF4\xF6\x77\x9C\x59\xBD\xCE\xE3\x6B\x69\x21\x53\xD0\xA9\x87\x7C\xC6\x2A\x47\x40\x02\xDF\x32\xE5\x21\x39\xF0\xA0";
-
-static const int8u * pa_a[]  = {REP8_DECL( a)};
-static const int8u * pa_b[]  = {REP8_DECL( b)};
-static const int8u * pa_xG[] = {REP8_DECL(xG)};
-static const int8u * pa_yG[] = {REP8_DECL(yG)};
-
-static int len_2[8]  = {REP8_DECL( 2)};
 static int len_32[8] = {REP8_DECL(32)};
 
 /*
 // common functions
 */
 
-/* compute Z digest = SM3( ENTL || ID || a || b ||xG || yG || xA || yA ) */
-static void sm2_ecdsa_compute_z_digest(int8u* pa_z_digest[8],
-                                 const int8u* pa_user_id[8],
-                                    const int user_id_len[8],
-                                 const int8u* pa_pubx[8],
-                                 const int8u* pa_puby[8])
-{
-   SM3_CTX_mb8 ctx;
-   SM3_CTX_mb8* p_ctx = &ctx;
-
-   sm3_init_mb8(p_ctx);
-
-   int8u entl_data[8][2];
-   const int8u* pa_entl[8];
-
-   for (int i = 0; i < 8; ++i)
-   {
-      int entl = ((user_id_len[i] * 8) & 0xFFFF);
-
-      entl_data[i][1] = entl & 0xFF;
-      entl_data[i][0] = entl >> 8;
-
-      pa_entl[i] = &(entl_data[i][0]);
-   }
-
-   sm3_update_mb8(pa_entl, len_2, p_ctx);
-
-   sm3_update_mb8(pa_user_id, (int *)user_id_len, p_ctx);
-
-   sm3_update_mb8(pa_a,  len_32, p_ctx);
-   sm3_update_mb8(pa_b,  len_32, p_ctx);
-   sm3_update_mb8(pa_xG, len_32, p_ctx);
-   sm3_update_mb8(pa_yG, len_32, p_ctx);
-
-   sm3_update_mb8(pa_pubx, len_32, p_ctx);
-   sm3_update_mb8(pa_puby, len_32, p_ctx);
-
-   sm3_final_mb8(pa_z_digest, p_ctx);
-   return;
-}
-
 static void sm2_ecdsa_compute_msg_digest(int8u* pa_msg_digest[8],
                                    const int8u* pa_z_digest[8],
                                    const int8u* pa_msg[8],
@@ -271,15 +215,15 @@ static mbx_status sm2_ecdsa_verify_mb8(U64 sign_r[],
    sign_s[PSM2_LEN64] = get_zero64();
 
    SM2_POINT sG;
-   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(&sG, sign_s); /* [s]G */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_vartime_)(&sG, sign_s); /* [s]G */
 
    /* convert t to scalar - t */
    ifma_mb8_to_BNU(pa_tmp, (const int64u(*)[8])t, PSM2_BITSIZE);
    ifma_BNU_transpose_copy((int64u(*)[8])t, (const int64u(**))pa_tmp, PSM2_BITSIZE);
    t[PSM2_LEN64] = get_zero64();
 
-   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(P, P, t);         /* [t]P */
-   MB_FUNC_NAME(ifma_ec_sm2_add_point_)(P, P, &sG);       /* P = [s]G + [t]P */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_vartime_)(P, P, t);         /* [t]P */
+   MB_FUNC_NAME(ifma_ec_sm2_add_point_)(P, P, &sG);               /* P = [s]G + [t]P */
 
    __ALIGN64 U64 sign_r_restored[PSM2_LEN52];
 
@@ -427,7 +371,7 @@ mbx_status mbx_sm2_ecdsa_sign_mb8(int8u* pa_sign_r[8],
    int8u* pa_msg_digest[8] = {msg_digest[0], msg_digest[1], msg_digest[2], msg_digest[3], msg_digest[4], msg_digest[5], msg_digest[6], msg_digest[7]};
 
    /* compute z digest */
-   sm2_ecdsa_compute_z_digest(pa_msg_digest,
+   sm2_compute_z_digest_mb8(pa_msg_digest,
               (const int8u **)pa_user_id,
                  (const int *)user_id_len_checked,
               (const int8u **)pa_rev_bytes_pubX,
@@ -580,7 +524,7 @@ mbx_status mbx_sm2_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
    int8u* pa_msg_digest[8] = {msg_digest[0], msg_digest[1], msg_digest[2], msg_digest[3], msg_digest[4], msg_digest[5], msg_digest[6], msg_digest[7]};
 
    /* compute z digest */
-   sm2_ecdsa_compute_z_digest(pa_msg_digest,
+   sm2_compute_z_digest_mb8(pa_msg_digest,
               (const int8u **)pa_user_id,
                  (const int *)user_id_len_checked,
               (const int8u **)pa_rev_bytes_pubX,
@@ -712,7 +656,7 @@ mbx_status mbx_sm2_ecdsa_sign_ssl_mb8(int8u* pa_sign_r[8],
    int8u* pa_msg_digest[8] = {msg_digest[0], msg_digest[1], msg_digest[2], msg_digest[3], msg_digest[4], msg_digest[5], msg_digest[6], msg_digest[7]};
 
    /* compute z digest */
-   sm2_ecdsa_compute_z_digest(pa_msg_digest,
+   sm2_compute_z_digest_mb8(pa_msg_digest,
               (const int8u **)pa_user_id,
                  (const int *)user_id_len_checked,
               (const int8u **)pa_rev_bytes_pubX,
@@ -861,7 +805,7 @@ mbx_status mbx_sm2_ecdsa_verify_ssl_mb8(const ECDSA_SIG* const pa_sig[8],
    int8u* pa_msg_digest[8] = {msg_digest[0], msg_digest[1], msg_digest[2], msg_digest[3], msg_digest[4], msg_digest[5], msg_digest[6], msg_digest[7]};
 
    /* compute z digest */
-   sm2_ecdsa_compute_z_digest(pa_msg_digest,
+   sm2_compute_z_digest_mb8(pa_msg_digest,
               (const int8u **)pa_user_id,
                  (const int *)user_id_len_checked,
               (const int8u **)pa_rev_bytes_pubX,
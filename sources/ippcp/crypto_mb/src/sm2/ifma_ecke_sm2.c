@@ -0,0 +1,611 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+#include <internal/sm2/ifma_hash_sm2.h>
+#include <internal/sm3/sm3_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#ifndef BN_OPENSSL_DISABLE
+#include <openssl/bn.h>
+#endif
+
+/*
+// SM2 key exchange protocol (GB/T 32918.3-2016, 6.2)
+//
+// requester (A):                              responder (B):
+//    x1` = 2^w + (x1 & (2^w - 1))                x2` = 2^w + (x2 & (2^w - 1))
+//    tA  = (dA + x1`*rA) mod n                   tB  = (dB + x2`*rB) mod n
+//    U   = [h*tA](PB + [x2`]RB)                  V   = [h*tB](PA + [x1`]RA)
+//    KA  = KDF(xU || yU || ZA || ZB, klen)       KB  = KDF(xV || yV || ZA || ZB, klen)
+//
+// where RA = (x1,y1) and RB = (x2,y2) are the ephemeral public keys, w = 127 and h = 1.
+// Key confirmation:
+//    S1 = SB = SM3(0x02 || y || SM3(x || ZA || ZB || x1 || y1 || x2 || y2))
+//    S2 = SA = SM3(0x03 || y || SM3(x || ZA || ZB || x1 || y1 || x2 || y2))
+*/
+#define SM2_KE_DIGEST_LEN  (SM3_SIZE_IN_BITS/8)
+
+/* x` = 2^127 + (x & (2^127 - 1)), x in regular domain */
+static void sm2_ke_reduce_x2w(U64 r[], const U64 x[])
+{
+   r[0] = x[0];
+   r[1] = x[1];
+   /* 127 = 2*DIGIT_SIZE + 23 */
+   r[2] = or64(and64_const(x[2], (1ULL << 23) - 1), set1(1ULL << 23));
+   r[3] = get_zero64();
+   r[4] = get_zero64();
+}
+
+/* radix 2^52 value -> zero padded scalar */
+static void sm2_ke_to_scalar(U64 scalar[], const U64 a[])
+{
+   __ALIGN64 int64u tmp[8][PSM2_LEN64];
+   int64u* pa_tmp[8] = {tmp[0], tmp[1], tmp[2], tmp[3],
+                        tmp[4], tmp[5], tmp[6], tmp[7]};
+
+   ifma_mb8_to_BNU(pa_tmp, (const int64u(*)[8])a, PSM2_BITSIZE);
+   ifma_BNU_transpose_copy((int64u (*)[8])scalar, (const int64u(**))pa_tmp, PSM2_BITSIZE);
+   scalar[PSM2_LEN64] = get_zero64();
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])tmp, sizeof(tmp)/sizeof(U64));
+}
+
+/* check party's point and convert it to Montgomery domain */
+static mbx_status sm2_ke_process_point(SM2_POINT* P, int use_jproj_coords, mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   if(use_jproj_coords)
+      status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+   else
+      MB_FUNC_NAME(mov_FESM2_)(P->Z, (U64*)ones);
+
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->X, P->X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Y, P->Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Z, P->Z);
+
+   /* check if P does not belong to EC */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(P, use_jproj_coords);
+   /* set points out of EC to infinity */
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(P, not_on_curve_mask);
+   /* update status */
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   return status;
+}
+
+/* affine coordinates of the Montgomery Jacobian point P, regular domain */
+static void sm2_ke_affine(U64 x[], U64 y[], const SM2_POINT* P)
+{
+   MB_FUNC_NAME(get_sm2_ec_affine_coords_)(x, y, P);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(x, x);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(y, y);
+}
+
+/* store affine point as big endian x || y */
+static void sm2_ke_store_xy(int8u* pa_xy[8], const U64 x[], const U64 y[])
+{
+   int8u* pa_y[8];
+   for(int i = 0; i < 8; i++)
+      pa_y[i] = pa_xy[i] + PSM2_LEN8;
+
+   ifma_mb8_to_HexStr8(pa_xy, (const int64u (*)[8])x, PSM2_BITSIZE);
+   ifma_mb8_to_HexStr8(pa_y,  (const int64u (*)[8])y, PSM2_BITSIZE);
+}
+
+/*
+// skey, eph_skey   - own private and ephemeral private keys, radix 2^52 (cleared here)
+// P, R             - party's public and ephemeral public keys, regular domain
+*/
+static mbx_status sm2_key_exchange_mb8(int8u* const pa_shared_key[8],
+                                          const int shared_key_len[8],
+                                       int8u* const pa_conf_self[8],
+                                       int8u* const pa_conf_peer[8],
+                                 const int8u* const pa_z_self[8],
+                                 const int8u* const pa_z_peer[8],
+                                                U64 skey[],
+                                                U64 eph_skey[],
+                                          SM2_POINT* P,
+                                                int use_jproj_pub,
+                                          SM2_POINT* R,
+                                                int use_jproj_eph,
+                               enum MBX_SM2_KE_ROLE role,
+                                         mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   status = sm2_ke_process_point(P, use_jproj_pub, status);
+   status = sm2_ke_process_point(R, use_jproj_eph, status);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 U64 scalar[PSM2_LEN64+1];
+
+   /* own ephemeral public key Rs = [r]G */
+   SM2_POINT Rs;
+   sm2_ke_to_scalar(scalar, eph_skey);
+   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(&Rs, scalar);
+
+   __ALIGN64 U64 xs[PSM2_LEN52], ys[PSM2_LEN52];
+   __ALIGN64 U64 xp[PSM2_LEN52], yp[PSM2_LEN52];
+   sm2_ke_affine(xs, ys, &Rs);
+   sm2_ke_affine(xp, yp, R);
+
+   /* t = (d + x`*r) mod n */
+   __ALIGN64 U64 x2w[PSM2_LEN52];
+   __ALIGN64 U64 t[PSM2_LEN52];
+   sm2_ke_reduce_x2w(x2w, xs);
+   MB_FUNC_NAME(ifma_tomont52_nsm2_)(x2w, x2w);
+   MB_FUNC_NAME(ifma_tomont52_nsm2_)(eph_skey, eph_skey);
+   MB_FUNC_NAME(ifma_tomont52_nsm2_)(skey, skey);
+   MB_FUNC_NAME(ifma_amm52_nsm2_)(t, x2w, eph_skey);
+   MB_FUNC_NAME(ifma_add52_nsm2_)(t, t, skey);
+   MB_FUNC_NAME(ifma_frommont52_nsm2_)(t, t);
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])skey, PSM2_LEN52);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])eph_skey, PSM2_LEN52);
+
+   /* Q = P + [x`]R, x` of the party is public */
+   SM2_POINT Q;
+   sm2_ke_reduce_x2w(x2w, xp);
+   sm2_ke_to_scalar(scalar, x2w);
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_vartime_)(&Q, R, scalar);
+   MB_FUNC_NAME(ifma_ec_sm2_add_point_)(&Q, &Q, P);
+
+   /* U = [h*t]Q, h = 1 */
+   SM2_POINT U;
+   sm2_ke_to_scalar(scalar, t);
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&U, &Q, scalar);
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])t, PSM2_LEN52);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])scalar, PSM2_LEN64+1);
+
+   /* U must not be infinity */
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(is_zero_point_cordinate_)(U.Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      MB_FUNC_NAME(zero_)((int64u (*)[8])&U, sizeof(U)/sizeof(U64));
+      return status;
+   }
+
+   __ALIGN64 U64 xu[PSM2_LEN52], yu[PSM2_LEN52];
+   sm2_ke_affine(xu, yu, &U);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&U, sizeof(U)/sizeof(U64));
+
+   /* ZA and ZB in protocol order */
+   const int8u* const* pa_za = (MBX_SM2_KE_REQUESTER == role)? pa_z_self : pa_z_peer;
+   const int8u* const* pa_zb = (MBX_SM2_KE_REQUESTER == role)? pa_z_peer : pa_z_self;
+
+   /*
+   // buffer layout:
+   //    xU || yU || ZA || ZB                          - KDF input
+   //    xU || ZA || ZB || x1 || y1 || x2 || y2        - confirmation digest input
+   */
+   #define XY_LEN   (2*PSM2_LEN8)
+   #define KDF_LEN  (XY_LEN + 2*SM2_KE_DIGEST_LEN)
+   #define CONF_LEN (PSM2_LEN8 + 2*SM2_KE_DIGEST_LEN + 2*XY_LEN)
+
+   __ALIGN64 int8u buf[8][CONF_LEN + PSM2_LEN8];
+   int8u* pa_buf[8] = {buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], buf[7]};
+
+   sm2_ke_store_xy(pa_buf, xu, yu);
+
+   int key_len[8];
+   int8u* pa_key[8];
+   for(int i = 0; i < 8; i++) {
+      int ok = (MBX_STATUS_OK == MBX_GET_STS(status, i));
+      for(int j = 0; j < SM2_KE_DIGEST_LEN; j++) {
+         buf[i][XY_LEN + j] = ok? pa_za[i][j] : 0;
+         buf[i][XY_LEN + SM2_KE_DIGEST_LEN + j] = ok? pa_zb[i][j] : 0;
+      }
+      key_len[i] = ok? shared_key_len[i] : 0;
+      pa_key[i]  = ok? pa_shared_key[i] : NULL;
+   }
+
+   /* K = KDF(xU || yU || ZA || ZB, klen) */
+   sm2_kdf_mb8(pa_key, NULL, key_len, (const int8u**)pa_buf, KDF_LEN);
+
+   if(NULL != pa_conf_self || NULL != pa_conf_peer) {
+      /* rearrange to xU || ZA || ZB || x1 || y1 || x2 || y2 */
+      int8u* pa_r1[8];
+      int8u* pa_r2[8];
+      for(int i = 0; i < 8; i++) {
+         for(int j = 0; j < 2*SM2_KE_DIGEST_LEN; j++)
+            buf[i][PSM2_LEN8 + j] = buf[i][XY_LEN + j];
+         pa_r1[i] = buf[i] + PSM2_LEN8 + 2*SM2_KE_DIGEST_LEN;
+         pa_r2[i] = pa_r1[i] + XY_LEN;
+      }
+      sm2_ke_store_xy((MBX_SM2_KE_REQUESTER == role)? pa_r1 : pa_r2, xs, ys);
+      sm2_ke_store_xy((MBX_SM2_KE_REQUESTER == role)? pa_r2 : pa_r1, xp, yp);
+
+      /* h = SM3(xU || ZA || ZB || x1 || y1 || x2 || y2) */
+      __ALIGN64 int8u h[8][1 + PSM2_LEN8 + SM2_KE_DIGEST_LEN];
+      int8u* pa_h[8] = {h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7]};
+      int8u* pa_hd[8];
+      int len_conf[8] = {REP8_DECL(CONF_LEN)};
+      int len_s[8]    = {REP8_DECL(1 + PSM2_LEN8 + SM2_KE_DIGEST_LEN)};
+
+      for(int i = 0; i < 8; i++)
+         pa_hd[i] = h[i] + 1 + PSM2_LEN8;
+      sm3_msg_digest_mb8((const int8u**)pa_buf, len_conf, pa_hd);
+
+      /* 0x0? || yU || h */
+      int8u* pa_yu[8];
+      for(int i = 0; i < 8; i++)
+         pa_yu[i] = h[i] + 1;
+      ifma_mb8_to_HexStr8(pa_yu, (const int64u (*)[8])yu, PSM2_BITSIZE);
+
+      __ALIGN64 int8u s[2][8][SM2_KE_DIGEST_LEN];
+      int8u* pa_s[2][8] = {{s[0][0], s[0][1], s[0][2], s[0][3], s[0][4], s[0][5], s[0][6], s[0][7]},
+                           {s[1][0], s[1][1], s[1][2], s[1][3], s[1][4], s[1][5], s[1][6], s[1][7]}};
+
+      /* s[0] = S1 = SB, s[1] = S2 = SA */
+      for(int n = 0; n < 2; n++) {
+         for(int i = 0; i < 8; i++)
+            h[i][0] = (int8u)(0x02 + n);
+         sm3_msg_digest_mb8((const int8u**)pa_h, len_s, pa_s[n]);
+      }
+
+      int self = (MBX_SM2_KE_REQUESTER == role)? 1 : 0;
+      for(int i = 0; i < 8; i++) {
+         if(MBX_STATUS_OK != MBX_GET_STS(status, i))
+            continue;
+         for(int j = 0; j < SM2_KE_DIGEST_LEN; j++) {
+            if(pa_conf_self && pa_conf_self[i])
+               pa_conf_self[i][j] = s[self][i][j];
+            if(pa_conf_peer && pa_conf_peer[i])
+               pa_conf_peer[i][j] = s[1-self][i][j];
+         }
+      }
+      MB_FUNC_NAME(zero_)((int64u (*)[8])h, sizeof(h)/sizeof(U64));
+   }
+
+   #undef XY_LEN
+   #undef KDF_LEN
+   #undef CONF_LEN
+
+   /* clear shared secrets */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])buf, sizeof(buf)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])xu, PSM2_LEN52);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])yu, PSM2_LEN52);
+
+   return status;
+}
+
+/* check the part of the parameters common for int64u and BIGNUM APIs */
+static mbx_status sm2_ke_check_params(const int shared_key_len[8],
+                                      int8u* const pa_shared_key[8],
+                                const int8u* const pa_z_self[8],
+                                const int8u* const pa_z_peer[8],
+                              enum MBX_SM2_KE_ROLE role)
+{
+   mbx_status status = 0;
+
+   if(MBX_SM2_KE_REQUESTER != role && MBX_SM2_KE_RESPONDER != role)
+      return MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   for(int buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_shared_key[buf_no] || NULL==pa_z_self[buf_no] || NULL==pa_z_peer[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(shared_key_len[buf_no] <= 0)
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+   return status;
+}
+
+#ifndef BN_OPENSSL_DISABLE
+DLL_PUBLIC
+mbx_status mbx_sm2_user_id_digest_ssl_mb8(int8u* pa_z_digest[8],
+                              const int8u* const pa_user_id[8],
+                                       const int user_id_len[8],
+                             const BIGNUM* const pa_pubx[8],
+                             const BIGNUM* const pa_puby[8],
+                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_z_digest || NULL==pa_user_id || NULL==user_id_len || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   int user_id_len_checked[8];
+   __ALIGN64 int8u xy[8][2*PSM2_LEN8];
+   int8u* pa_x[8];
+   int8u* pa_y[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      user_id_len_checked[buf_no] = 0;
+      pa_x[buf_no] = xy[buf_no];
+      pa_y[buf_no] = xy[buf_no] + PSM2_LEN8;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_z_digest[buf_no] || NULL==pa_user_id[buf_no] || NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if((user_id_len[buf_no] > 0xFFFF) || (user_id_len[buf_no] < 0)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      if(BN_num_bits(pa_pubx[buf_no]) > PSM2_BITSIZE || BN_num_bits(pa_puby[buf_no]) > PSM2_BITSIZE) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      user_id_len_checked[buf_no] = user_id_len[buf_no];
+      BN_bn2binpad(pa_pubx[buf_no], pa_x[buf_no], PSM2_LEN8);
+      BN_bn2binpad(pa_puby[buf_no], pa_y[buf_no], PSM2_LEN8);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 int8u z[8][SM2_KE_DIGEST_LEN];
+   int8u* pa_z[8] = {z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7]};
+
+   sm2_compute_z_digest_mb8(pa_z, (const int8u**)pa_user_id, user_id_len_checked, (const int8u**)pa_x, (const int8u**)pa_y);
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK == MBX_GET_STS(status, buf_no)) {
+         for(int j = 0; j < SM2_KE_DIGEST_LEN; j++)
+            pa_z_digest[buf_no][j] = z[buf_no][j];
+      }
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sm2_key_exchange_ssl_mb8(int8u* pa_shared_key[8],
+                                    const int shared_key_len[8],
+                                       int8u* pa_conf_self[8],
+                                       int8u* pa_conf_peer[8],
+                           const int8u* const pa_z_self[8],
+                           const int8u* const pa_z_peer[8],
+                          const BIGNUM* const pa_skey[8],
+                          const BIGNUM* const pa_eph_skey[8],
+                          const BIGNUM* const pa_pubx[8],
+                          const BIGNUM* const pa_puby[8],
+                          const BIGNUM* const pa_pubz[8],
+                          const BIGNUM* const pa_eph_pubx[8],
+                          const BIGNUM* const pa_eph_puby[8],
+                          const BIGNUM* const pa_eph_pubz[8],
+                         enum MBX_SM2_KE_ROLE role,
+                                       int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the input is in Jacobian projective coordinates */
+   int use_jproj_pub = NULL!=pa_pubz;
+   int use_jproj_eph = NULL!=pa_eph_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_shared_key || NULL==shared_key_len || NULL==pa_z_self || NULL==pa_z_peer ||
+      NULL==pa_skey || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby || NULL==pa_eph_pubx || NULL==pa_eph_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   status = sm2_ke_check_params(shared_key_len, pa_shared_key, pa_z_self, pa_z_peer, role);
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_skey[buf_no] || NULL==pa_eph_skey[buf_no] ||
+         NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no] || (use_jproj_pub && NULL==pa_pubz[buf_no]) ||
+         NULL==pa_eph_pubx[buf_no] || NULL==pa_eph_puby[buf_no] || (use_jproj_eph && NULL==pa_eph_pubz[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* load and check private keys: 0 < d,r < n */
+   __ALIGN64 U64 skey[PSM2_LEN52];
+   __ALIGN64 U64 eph_skey[PSM2_LEN52];
+
+   ifma_BN_to_mb8((int64u (*)[8])skey, pa_skey, PSM2_BITSIZE);
+   ifma_BN_to_mb8((int64u (*)[8])eph_skey, pa_eph_skey, PSM2_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nsm2_)(skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nsm2_)(eph_skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status)) {
+      SM2_POINT P, R;
+
+      ifma_BN_to_mb8((int64u (*)[8])P.X, pa_pubx, PSM2_BITSIZE);
+      ifma_BN_to_mb8((int64u (*)[8])P.Y, pa_puby, PSM2_BITSIZE);
+      if(use_jproj_pub)
+         ifma_BN_to_mb8((int64u (*)[8])P.Z, pa_pubz, PSM2_BITSIZE);
+
+      ifma_BN_to_mb8((int64u (*)[8])R.X, pa_eph_pubx, PSM2_BITSIZE);
+      ifma_BN_to_mb8((int64u (*)[8])R.Y, pa_eph_puby, PSM2_BITSIZE);
+      if(use_jproj_eph)
+         ifma_BN_to_mb8((int64u (*)[8])R.Z, pa_eph_pubz, PSM2_BITSIZE);
+
+      status = sm2_key_exchange_mb8(pa_shared_key, shared_key_len, pa_conf_self, pa_conf_peer,
+                                    pa_z_self, pa_z_peer, skey, eph_skey,
+                                    &P, use_jproj_pub, &R, use_jproj_eph, role, status);
+   }
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])skey, sizeof(skey)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])eph_skey, sizeof(eph_skey)/sizeof(U64));
+
+   return status;
+}
+#endif // BN_OPENSSL_DISABLE
+
+DLL_PUBLIC
+mbx_status mbx_sm2_user_id_digest_mb8(int8u* pa_z_digest[8],
+                          const int8u* const pa_user_id[8],
+                                   const int user_id_len[8],
+                         const int64u* const pa_pubx[8],
+                         const int64u* const pa_puby[8],
+                                      int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_z_digest || NULL==pa_user_id || NULL==user_id_len || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   int user_id_len_checked[8];
+   __ALIGN64 int8u xy[8][2*PSM2_LEN8];
+   int8u* pa_x[8];
+   int8u* pa_y[8];
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      user_id_len_checked[buf_no] = 0;
+      pa_x[buf_no] = xy[buf_no];
+      pa_y[buf_no] = xy[buf_no] + PSM2_LEN8;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_z_digest[buf_no] || NULL==pa_user_id[buf_no] || NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if((user_id_len[buf_no] > 0xFFFF) || (user_id_len[buf_no] < 0)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         continue;
+      }
+      user_id_len_checked[buf_no] = user_id_len[buf_no];
+
+      /* coordinates to big endian */
+      for(int j = 0; j < PSM2_LEN8; j++) {
+         pa_x[buf_no][j] = ((const int8u*)pa_pubx[buf_no])[PSM2_LEN8 - 1 - j];
+         pa_y[buf_no][j] = ((const int8u*)pa_puby[buf_no])[PSM2_LEN8 - 1 - j];
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   __ALIGN64 int8u z[8][SM2_KE_DIGEST_LEN];
+   int8u* pa_z[8] = {z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7]};
+
+   sm2_compute_z_digest_mb8(pa_z, (const int8u**)pa_user_id, user_id_len_checked, (const int8u**)pa_x, (const int8u**)pa_y);
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(MBX_STATUS_OK == MBX_GET_STS(status, buf_no)) {
+         for(int j = 0; j < SM2_KE_DIGEST_LEN; j++)
+            pa_z_digest[buf_no][j] = z[buf_no][j];
+      }
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sm2_key_exchange_mb8(int8u* pa_shared_key[8],
+                                const int shared_key_len[8],
+                                   int8u* pa_conf_self[8],
+                                   int8u* pa_conf_peer[8],
+                       const int8u* const pa_z_self[8],
+                       const int8u* const pa_z_peer[8],
+                      const int64u* const pa_skey[8],
+                      const int64u* const pa_eph_skey[8],
+                      const int64u* const pa_pubx[8],
+                      const int64u* const pa_puby[8],
+                      const int64u* const pa_pubz[8],
+                      const int64u* const pa_eph_pubx[8],
+                      const int64u* const pa_eph_puby[8],
+                      const int64u* const pa_eph_pubz[8],
+                     enum MBX_SM2_KE_ROLE role,
+                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the input is in Jacobian projective coordinates */
+   int use_jproj_pub = NULL!=pa_pubz;
+   int use_jproj_eph = NULL!=pa_eph_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_shared_key || NULL==shared_key_len || NULL==pa_z_self || NULL==pa_z_peer ||
+      NULL==pa_skey || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby || NULL==pa_eph_pubx || NULL==pa_eph_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   status = sm2_ke_check_params(shared_key_len, pa_shared_key, pa_z_self, pa_z_peer, role);
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_skey[buf_no] || NULL==pa_eph_skey[buf_no] ||
+         NULL==pa_pubx[buf_no] || NULL==pa_puby[buf_no] || (use_jproj_pub && NULL==pa_pubz[buf_no]) ||
+         NULL==pa_eph_pubx[buf_no] || NULL==pa_eph_puby[buf_no] || (use_jproj_eph && NULL==pa_eph_pubz[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* load and check private keys: 0 < d,r < n */
+   __ALIGN64 U64 skey[PSM2_LEN52];
+   __ALIGN64 U64 eph_skey[PSM2_LEN52];
+
+   ifma_BNU_to_mb8((int64u (*)[8])skey, pa_skey, PSM2_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])eph_skey, pa_eph_skey, PSM2_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nsm2_)(skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_nsm2_)(eph_skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status)) {
+      SM2_POINT P, R;
+
+      ifma_BNU_to_mb8((int64u (*)[8])P.X, pa_pubx, PSM2_BITSIZE);
+      ifma_BNU_to_mb8((int64u (*)[8])P.Y, pa_puby, PSM2_BITSIZE);
+      if(use_jproj_pub)
+         ifma_BNU_to_mb8((int64u (*)[8])P.Z, pa_pubz, PSM2_BITSIZE);
+
+      ifma_BNU_to_mb8((int64u (*)[8])R.X, pa_eph_pubx, PSM2_BITSIZE);
+      ifma_BNU_to_mb8((int64u (*)[8])R.Y, pa_eph_puby, PSM2_BITSIZE);
+      if(use_jproj_eph)
+         ifma_BNU_to_mb8((int64u (*)[8])R.Z, pa_eph_pubz, PSM2_BITSIZE);
+
+      status = sm2_key_exchange_mb8(pa_shared_key, shared_key_len, pa_conf_self, pa_conf_peer,
+                                    pa_z_self, pa_z_peer, skey, eph_skey,
+                                    &P, use_jproj_pub, &R, use_jproj_eph, role, status);
+   }
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])skey, sizeof(skey)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])eph_skey, sizeof(eph_skey)/sizeof(U64));
+
+   return status;
+}
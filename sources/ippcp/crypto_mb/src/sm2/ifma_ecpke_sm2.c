@@ -0,0 +1,510 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+#include <internal/sm2/ifma_hash_sm2.h>
+#include <internal/sm3/sm3_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#ifndef BN_OPENSSL_DISABLE
+#include <openssl/bn.h>
+#endif
+
+/*
+// SM2 public key encryption (GB/T 32918.4-2016)
+//
+// ciphertext layout: C1 || C3 || C2, where
+//    C1 = 04 || x1 || y1     - uncompressed ephemeral point [k]G
+//    C3 = SM3(x2 || M || y2) - message digest
+//    C2 = M ^ KDF(x2 || y2)  - masked message
+*/
+#define SM2_PKE_C3_LEN     (SM3_SIZE_IN_BITS/8)
+#define SM2_PKE_C1_OFFSET  (0)
+#define SM2_PKE_C3_OFFSET  (SM2_PKE_C1_OFFSET + 1 + 2*PSM2_LEN8)
+#define SM2_PKE_C2_OFFSET  (SM2_PKE_C3_OFFSET + SM2_PKE_C3_LEN)
+
+static int len_32[8] = {REP8_DECL(32)};
+
+/* compute C3 = SM3(x2 || M || y2) */
+static void sm2_pke_compute_c3(int8u* pa_c3[8],
+                         const int8u* const pa_z[8],
+                         const int8u* const pa_msg[8],
+                                  const int msg_len[8])
+{
+   __ALIGN64 SM3_CTX_mb8 ctx;
+
+   const int8u* pa_y2[8];
+   for(int i = 0; i < 8; i++)
+      pa_y2[i] = pa_z[i] + PSM2_LEN8;
+
+   sm3_init_mb8(&ctx);
+   sm3_update_mb8(pa_z, len_32, &ctx);
+   sm3_update_mb8(pa_msg, (int*)msg_len, &ctx);
+   sm3_update_mb8(pa_y2, len_32, &ctx);
+   sm3_final_mb8(pa_c3, &ctx);
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&ctx, sizeof(ctx)/sizeof(U64));
+}
+
+/* store affine (x, y) of the Montgomery Jacobian point P into pa_xy[i] as x || y, big endian */
+static void sm2_pke_store_affine(int8u* const pa_xy[8], SM2_POINT* P)
+{
+   int8u* pa_y[8];
+   for(int i = 0; i < 8; i++)
+      pa_y[i] = pa_xy[i]? pa_xy[i] + PSM2_LEN8 : NULL;
+
+   MB_FUNC_NAME(get_sm2_ec_affine_coords_)(P->X, P->Y, P);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(P->X, P->X);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(P->Y, P->Y);
+
+   ifma_mb8_to_HexStr8(pa_xy, (const int64u (*)[8])P->X, PSM2_BITSIZE);
+   ifma_mb8_to_HexStr8(pa_y,  (const int64u (*)[8])P->Y, PSM2_BITSIZE);
+}
+
+/*
+// P - party's public key, regular domain (checked and converted here)
+// secretz - ephemeral private keys (zero padded scalars)
+*/
+static mbx_status sm2_encrypt_mb8(int8u* const pa_cipher[8],
+                            const int8u* const pa_msg[8],
+                                     const int msg_len[8],
+                                           U64 secretz[],
+                                     SM2_POINT* P,
+                                           int use_jproj_coords,
+                                    mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+   if(use_jproj_coords) {
+      status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(P->Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+      /* party's public key at infinity is not acceptable */
+      status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(is_zero_FESM2_)(P->Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+   else
+      MB_FUNC_NAME(mov_FESM2_)(P->Z, (U64*)ones);
+
+   /* convert to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->X, P->X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Y, P->Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P->Z, P->Z);
+
+   /* check if P does not belong to EC */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(P, use_jproj_coords);
+   /* set points out of EC to infinity */
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(P, not_on_curve_mask);
+   /* update status */
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* active lanes */
+   int len[8];
+   int8u* pa_c1[8];
+   const int8u* pa_m[8];
+   int8u* pa_c2[8];
+   for(int i = 0; i < 8; i++) {
+      int ok = (MBX_STATUS_OK == MBX_GET_STS(status, i));
+      len[i]   = ok? msg_len[i] : 0;
+      pa_c1[i] = ok? pa_cipher[i] + SM2_PKE_C1_OFFSET + 1 : NULL;
+      pa_m[i]  = ok? pa_msg[i] : NULL;
+      pa_c2[i] = ok? pa_cipher[i] + SM2_PKE_C2_OFFSET : NULL;
+   }
+
+   SM2_POINT R;
+
+   /* C1 = [k]G */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(&R, secretz);
+   sm2_pke_store_affine(pa_c1, &R);
+
+   /* (x2, y2) = [k]P */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&R, P, secretz);
+
+   __ALIGN64 int8u z[8][2*PSM2_LEN8];
+   int8u* pa_z[8] = {z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7]};
+   sm2_pke_store_affine(pa_z, &R);
+
+   /* C2 = M ^ KDF(x2 || y2, klen) */
+   sm2_kdf_mb8(pa_c2, pa_m, len, (const int8u**)pa_z, 2*PSM2_LEN8);
+
+   /* C3 = SM3(x2 || M || y2) */
+   __ALIGN64 int8u c3[8][SM2_PKE_C3_LEN];
+   int8u* pa_c3[8] = {c3[0], c3[1], c3[2], c3[3], c3[4], c3[5], c3[6], c3[7]};
+   sm2_pke_compute_c3(pa_c3, (const int8u**)pa_z, pa_m, len);
+
+   for(int i = 0; i < 8; i++) {
+      if(MBX_STATUS_OK == MBX_GET_STS(status, i)) {
+         pa_cipher[i][SM2_PKE_C1_OFFSET] = 0x04;
+         for(int j = 0; j < SM2_PKE_C3_LEN; j++)
+            pa_cipher[i][SM2_PKE_C3_OFFSET + j] = c3[i][j];
+      }
+   }
+
+   /* clear shared secrets */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])z, sizeof(z)/sizeof(U64));
+
+   return status;
+}
+
+/*
+// secretz - own private keys (zero padded scalars)
+*/
+static mbx_status sm2_decrypt_mb8(int8u* const pa_msg[8],
+                            const int8u* const pa_cipher[8],
+                                     const int cipher_len[8],
+                                           U64 secretz[],
+                                    mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   /* C1 format and ciphertext length */
+   const int8u* pa_c1x[8];
+   const int8u* pa_c1y[8];
+   for(int i = 0; i < 8; i++) {
+      pa_c1x[i] = NULL;
+      pa_c1y[i] = NULL;
+      if(MBX_STATUS_OK == MBX_GET_STS(status, i)) {
+         if(cipher_len[i] < SM2_PKE_C2_OFFSET || 0x04 != pa_cipher[i][SM2_PKE_C1_OFFSET])
+            status = MBX_SET_STS(status, i, MBX_STATUS_MISMATCH_PARAM_ERR);
+         else {
+            pa_c1x[i] = pa_cipher[i] + SM2_PKE_C1_OFFSET + 1;
+            pa_c1y[i] = pa_c1x[i] + PSM2_LEN8;
+         }
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   SM2_POINT C1;
+
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.X, pa_c1x, PSM2_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.Y, pa_c1y, PSM2_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(C1.X), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_psm2_)(C1.Y), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* convert to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.X, C1.X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Y, C1.Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Z, (U64*)ones);
+
+   /* check if C1 does not belong to EC */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(&C1, 0);
+   /* set points out of EC to infinity */
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(&C1, not_on_curve_mask);
+   /* update status */
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* active lanes */
+   int len[8];
+   const int8u* pa_c2[8];
+   int8u* pa_m[8];
+   for(int i = 0; i < 8; i++) {
+      int ok = (MBX_STATUS_OK == MBX_GET_STS(status, i));
+      len[i]   = ok? cipher_len[i] - SM2_PKE_C2_OFFSET : 0;
+      pa_c2[i] = ok? pa_cipher[i] + SM2_PKE_C2_OFFSET : NULL;
+      pa_m[i]  = ok? pa_msg[i] : NULL;
+   }
+
+   /* (x2, y2) = [d]C1 */
+   SM2_POINT R;
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&R, &C1, secretz);
+
+   __ALIGN64 int8u z[8][2*PSM2_LEN8];
+   int8u* pa_z[8] = {z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7]};
+   sm2_pke_store_affine(pa_z, &R);
+
+   /* M' = C2 ^ KDF(x2 || y2, klen) */
+   sm2_kdf_mb8(pa_m, pa_c2, len, (const int8u**)pa_z, 2*PSM2_LEN8);
+
+   /* u = SM3(x2 || M' || y2) */
+   __ALIGN64 int8u u[8][SM2_PKE_C3_LEN];
+   int8u* pa_u[8] = {u[0], u[1], u[2], u[3], u[4], u[5], u[6], u[7]};
+   sm2_pke_compute_c3(pa_u, (const int8u**)pa_z, (const int8u**)pa_m, len);
+
+   /* check u == C3, wipe out the message otherwise */
+   for(int i = 0; i < 8; i++) {
+      if(MBX_STATUS_OK == MBX_GET_STS(status, i)) {
+         int8u diff = 0;
+         for(int j = 0; j < SM2_PKE_C3_LEN; j++)
+            diff |= u[i][j] ^ pa_cipher[i][SM2_PKE_C3_OFFSET + j];
+
+         if(diff) {
+            for(int j = 0; j < len[i]; j++)
+               pa_msg[i][j] = 0;
+            status = MBX_SET_STS(status, i, MBX_STATUS_MISMATCH_PARAM_ERR);
+         }
+      }
+   }
+
+   /* clear shared secrets */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])z, sizeof(z)/sizeof(U64));
+
+   return status;
+}
+
+#ifndef BN_OPENSSL_DISABLE
+/*
+// Encrypts message by SM2 public key encryption scheme
+// pa_cipher[]       array of pointers to the ciphertexts (msg_len[i] + SM2_PKE_OVERHEAD bytes each)
+// pa_msg[]          array of pointers to the messages are being encrypted
+// msg_len[]         array of messages length
+// pa_eph_skey[]     array of pointers to the ephemeral private keys
+// pa_pubx[]         array of pointers to the party's public keys X-coordinates
+// pa_puby[]         array of pointers to the party's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the party's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_sm2_encrypt_ssl_mb8(int8u* pa_cipher[8],
+                       const int8u* const pa_msg[8],
+                                const int msg_len[8],
+                      const BIGNUM* const pa_eph_skey[8],
+                      const BIGNUM* const pa_pubx[8],
+                      const BIGNUM* const pa_puby[8],
+                      const BIGNUM* const pa_pubz[8],
+                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_cipher || NULL==pa_msg || NULL==msg_len || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int8u* cipher = pa_cipher[buf_no];
+      const int8u* msg = pa_msg[buf_no];
+      const BIGNUM* skey = pa_eph_skey[buf_no];
+      const BIGNUM* pubx = pa_pubx[buf_no];
+      const BIGNUM* puby = pa_puby[buf_no];
+      const BIGNUM* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==cipher || NULL==msg || NULL==skey || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(msg_len[buf_no] < 0)
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* zero padded ephemeral keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BN_transpose_copy((int64u (*)[8])secretz, (const BIGNUM**)pa_eph_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status |= MBX_SET_STS_BY_MASK(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status)) {
+      SM2_POINT P;
+
+      /* set party's public */
+      ifma_BN_to_mb8((int64u (*)[8])P.X, (const BIGNUM* (*))pa_pubx, PSM2_BITSIZE); /* P-> radix 2^52 */
+      ifma_BN_to_mb8((int64u (*)[8])P.Y, (const BIGNUM* (*))pa_puby, PSM2_BITSIZE);
+      if(use_jproj_coords)
+         ifma_BN_to_mb8((int64u (*)[8])P.Z, (const BIGNUM* (*))pa_pubz, PSM2_BITSIZE);
+
+      status = sm2_encrypt_mb8(pa_cipher, pa_msg, msg_len, secretz, &P, use_jproj_coords, status);
+   }
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   return status;
+}
+
+/*
+// Decrypts ciphertext by SM2 public key encryption scheme
+// pa_msg[]          array of pointers to the decrypted messages (cipher_len[i] - SM2_PKE_OVERHEAD bytes each)
+// pa_cipher[]       array of pointers to the ciphertexts
+// cipher_len[]      array of ciphertexts length
+// pa_skey[]         array of pointers to the own private keys
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status mbx_sm2_decrypt_ssl_mb8(int8u* pa_msg[8],
+                       const int8u* const pa_cipher[8],
+                                const int cipher_len[8],
+                      const BIGNUM* const pa_skey[8],
+                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_msg || NULL==pa_cipher || NULL==cipher_len || NULL==pa_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_msg[buf_no] || NULL==pa_cipher[buf_no] || NULL==pa_skey[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* zero padded private keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BN_transpose_copy((int64u (*)[8])secretz, (const BIGNUM**)pa_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status |= MBX_SET_STS_BY_MASK(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status))
+      status = sm2_decrypt_mb8(pa_msg, pa_cipher, cipher_len, secretz, status);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   return status;
+}
+#endif // BN_OPENSSL_DISABLE
+
+DLL_PUBLIC
+mbx_status mbx_sm2_encrypt_mb8(int8u* pa_cipher[8],
+                   const int8u* const pa_msg[8],
+                            const int msg_len[8],
+                  const int64u* const pa_eph_skey[8],
+                  const int64u* const pa_pubx[8],
+                  const int64u* const pa_puby[8],
+                  const int64u* const pa_pubz[8],
+                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_cipher || NULL==pa_msg || NULL==msg_len || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int8u* cipher = pa_cipher[buf_no];
+      const int8u* msg = pa_msg[buf_no];
+      const int64u* skey = pa_eph_skey[buf_no];
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==cipher || NULL==msg || NULL==skey || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(msg_len[buf_no] < 0)
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* zero padded ephemeral keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])secretz, (const int64u**)pa_eph_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status |= MBX_SET_STS_BY_MASK(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status)) {
+      SM2_POINT P;
+
+      /* set party's public */
+      ifma_BNU_to_mb8((int64u (*)[8])P.X, (const int64u* (*))pa_pubx, PSM2_BITSIZE); /* P-> radix 2^52 */
+      ifma_BNU_to_mb8((int64u (*)[8])P.Y, (const int64u* (*))pa_puby, PSM2_BITSIZE);
+      if(use_jproj_coords)
+         ifma_BNU_to_mb8((int64u (*)[8])P.Z, (const int64u* (*))pa_pubz, PSM2_BITSIZE);
+
+      status = sm2_encrypt_mb8(pa_cipher, pa_msg, msg_len, secretz, &P, use_jproj_coords, status);
+   }
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status mbx_sm2_decrypt_mb8(int8u* pa_msg[8],
+                   const int8u* const pa_cipher[8],
+                            const int cipher_len[8],
+                  const int64u* const pa_skey[8],
+                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_msg || NULL==pa_cipher || NULL==cipher_len || NULL==pa_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(NULL==pa_msg[buf_no] || NULL==pa_cipher[buf_no] || NULL==pa_skey[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* zero padded private keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])secretz, (const int64u**)pa_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status |= MBX_SET_STS_BY_MASK(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(MBX_IS_ANY_OK_STS(status))
+      status = sm2_decrypt_mb8(pa_msg, pa_cipher, cipher_len, secretz, status);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   return status;
+}
@@ -627,6 +627,223 @@ void MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(SM2_POINT* r, const U64 scalar[])
    /* clear stubs of secret scalar */
    clear_secret_context(&wvalue, &dvalue, &dsign);
 }
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Variable-time point multiplications.
+//
+// Intended for public scalars only (ECDSA signature verification):
+//    - pre-computed points are fetched by gather rather than by scanning the whole table
+//    - accumulation is skipped if digits of all lanes are zero
+*/
+
+#define VT_WIN_SIZE  (5)
+
+__INLINE void MB_FUNC_NAME(booth_recode_vt_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, VT_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(VT_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* gather point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_)(SM2_POINT* r, const SM2_POINT tbl[], U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset of the lane */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(SM2_POINT)/sizeof(int64u)));
+   offset = add64(offset, lane_idx64());
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<PSM2_LEN52; n++) {
+      r->X[n] = mask_gather64(zero, k, offset, tbl[0].X+n);
+      r->Y[n] = mask_gather64(zero, k, offset, tbl[0].Y+n);
+      r->Z[n] = mask_gather64(zero, k, offset, tbl[0].Z+n);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_sm2_mul_point_vartime_)(SM2_POINT* r, const SM2_POINT* p, const U64 scalar[])
+{
+   /* pre-computed table */
+   __ALIGN64 SM2_POINT tbl[1<<(VT_WIN_SIZE-1)];
+
+   /* tbl[n] = [n+1]*p */
+   MB_FUNC_NAME(mov_FESM2_)(tbl[0].X, p->X);
+   MB_FUNC_NAME(mov_FESM2_)(tbl[0].Y, p->Y);
+   MB_FUNC_NAME(mov_FESM2_)(tbl[0].Z, p->Z);
+   MB_FUNC_NAME(ifma_ec_sm2_dbl_point_)(&tbl[1], p);
+
+   int n;
+   for(n=1; n < (1<<(VT_WIN_SIZE-1))/2; n++) {
+      MB_FUNC_NAME(ifma_ec_sm2_add_point_)(&tbl[2*n], &tbl[2*n-1], p);
+      MB_FUNC_NAME(ifma_ec_sm2_dbl_point_)(&tbl[2*n+1], &tbl[n]);
+   }
+
+   SM2_POINT R;
+   SM2_POINT T;
+   U64 Ty[PSM2_LEN52];
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   /*
+   // point (LR) multiplication
+   */
+   U64 idx_mask = set1( (1<<(VT_WIN_SIZE+1))-1 );
+   int bit = PSM2_BITSIZE-(PSM2_BITSIZE % VT_WIN_SIZE);
+   int chunk_no = (bit-1)/64;
+   int chunk_shift = (bit-1)%64;
+
+   /* first window */
+   wvalue = loadu64(&scalar[chunk_no]);
+   wvalue = and64( srli64(wvalue, chunk_shift), idx_mask);
+
+   MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+   dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+   MB_FUNC_NAME(gather_point_)(&R, tbl, dvalue, dmask);
+
+   MB_FUNC_NAME(ifma_neg52_psm2_)(Ty, R.Y);
+   MB_FUNC_NAME(secure_mask_mov_FESM2_)(R.Y, R.Y, dsign, Ty);
+
+   for(bit-=VT_WIN_SIZE; bit>=0; bit-=VT_WIN_SIZE) {
+      /* doubling */
+      for(n=0; n<VT_WIN_SIZE; n++)
+         MB_FUNC_NAME(ifma_ec_sm2_dbl_point_)(&R, &R);
+
+      /* window */
+      if(bit) {
+         chunk_no = (bit-1)/64;
+         chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_vt_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      MB_FUNC_NAME(gather_point_)(&T, tbl, dvalue, dmask);
+
+      /* T = dsign? -T : T */
+      MB_FUNC_NAME(ifma_neg52_psm2_)(Ty, T.Y);
+      MB_FUNC_NAME(secure_mask_mov_FESM2_)(T.Y, T.Y, dsign, Ty);
+
+      /* acumulate T */
+      MB_FUNC_NAME(ifma_ec_sm2_add_point_)(&R, &R, &T);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FESM2_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FESM2_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FESM2_)(r->Z, R.Z);
+}
+#undef VT_WIN_SIZE
+
+/* gather affine point (lanes out of mask k get the point at infinity) */
+__INLINE void MB_FUNC_NAME(gather_point_affine_)(SM2_POINT_AFFINE* r, const SINGLE_SM2_POINT_AFFINE* tbl, U64 idx, __mb_mask k)
+{
+   /* decrement index (the table does not contain [0]*P) and convert it into qword offset */
+   U64 offset = mul52lo(sub64(idx, set1(1)), set1(sizeof(SINGLE_SM2_POINT_AFFINE)/sizeof(int64u)));
+
+   U64 zero = get_zero64();
+   int n;
+   for(n=0; n<PSM2_LEN52; n++) {
+      r->x[n] = mask_gather64(zero, k, offset, tbl->x+n);
+      r->y[n] = mask_gather64(zero, k, offset, tbl->y+n);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_vartime_)(SM2_POINT* r, const U64 scalar[])
+{
+   /* pre-computed table of base powers */
+   SINGLE_SM2_POINT_AFFINE* tbl = &ifma_ec_sm2_bp_precomp[0][0];
+
+   SM2_POINT R;
+   SM2_POINT_AFFINE A;
+   U64 Ty[PSM2_LEN52];
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   /*
+   // base point (RL) multiplication
+   */
+   U64  wvalue, dvalue;
+   __mb_mask dsign, dmask;
+
+   U64 idx_mask = set1( (1<<(BP_WIN_SIZE+1))-1 );
+   int bit;
+   for(bit=0; bit<=PSM2_BITSIZE; bit+=BP_WIN_SIZE, tbl+=BP_N_ENTRY) {
+      if(bit) {
+         int chunk_no = (bit-1)/64;
+         int chunk_shift = (bit-1)%64;
+
+         wvalue = loadu64(&scalar[chunk_no]);
+         #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+         {
+         U64 t_lo_ = srlv64(wvalue, set64(chunk_shift));
+         U64 t_hi_ = sllv64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+         wvalue = or64(t_lo_, t_hi_);
+         }
+         #else
+         wvalue = shrdv64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+         #endif
+         wvalue = and64(wvalue, idx_mask);
+      }
+      else {
+         wvalue = loadu64(&scalar[0]);
+         wvalue = and64( slli64(wvalue, 1), idx_mask);
+      }
+
+      MB_FUNC_NAME(booth_recode_bp_)(&dsign, &dvalue, wvalue);
+      dmask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+      /* nothing to accumulate in any lane */
+      if(!dmask)
+         continue;
+
+      MB_FUNC_NAME(gather_point_affine_)(&A, tbl, dvalue, dmask);
+
+      /* A = dsign? -A : A */
+      MB_FUNC_NAME(ifma_neg52_psm2_)(Ty, A.y);
+      MB_FUNC_NAME(secure_mask_mov_FESM2_)(A.y, A.y, dsign, Ty);
+
+      /* R += A */
+      MB_FUNC_NAME(ifma_ec_sm2_add_point_affine_)(&R, &R, &A);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FESM2_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FESM2_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FESM2_)(r->Z, R.Z);
+}
 #undef BP_WIN_SIZE
 
 /* SM2 parameters: mont(a), mont(b) */
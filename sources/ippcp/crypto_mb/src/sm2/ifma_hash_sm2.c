@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/sm2/ifma_hash_sm2.h>
+#include <internal/sm3/sm3_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+/* constants for Z digest computation */
+/* EC SM2 equation coeficient a, big endian */
+static const int8u a[]  = "\xFF\xFF\xFF\xFE\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x00\x00\x00\x00\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFC";
+/* EC SM2 equation coeficient b, big endian */
+static const int8u b[]  = "\x28\xE9\xFA\x9E\x9D\x9F\x5E\x34\x4D\x5A\x9E\x4B\xCF\x65\x09\xA7\xF3\x97\x89\xF5\x15\xAB\x8F\x92\xDD\xBC\xBD\x41\x4D\x94\x0E\x93";
+/* x coordinate of the EC SM2 generator point in affine coordinates, big endian */
+static const int8u xG[] = "\x32\xC4\xAE\x2C\x1F\x19\x81\x19\x5F\x99\x04\x46\x6A\x39\xC9\x94\x8F\xE3\x0B\xBF\xF2\x66\x0B\xE1\x71\x5A\x45\x89\x33\x4C\x74\xC7";
+/* y coordinate of the EC SM2 generator point in affine coordinates, big endian */
+static const int8u yG[] = "\xBC\x37\x36\xA2\xF4\xF6\x77\x9C\x59\xBD\xCE\xE3\x6B\x69\x21\x53\xD0\xA9\x87\x7C\xC6\x2A\x47\x40\x02\xDF\x32\xE5\x21\x39\xF0\xA0";
+
+static const int8u * pa_a[]  = {REP8_DECL( a)};
+static const int8u * pa_b[]  = {REP8_DECL( b)};
+static const int8u * pa_xG[] = {REP8_DECL(xG)};
+static const int8u * pa_yG[] = {REP8_DECL(yG)};
+
+static int len_2[8]  = {REP8_DECL( 2)};
+static int len_4[8]  = {REP8_DECL( 4)};
+static int len_32[8] = {REP8_DECL(32)};
+
+/* compute Z digest = SM3( ENTL || ID || a || b ||xG || yG || xA || yA ) */
+void sm2_compute_z_digest_mb8(int8u* pa_z_digest[8],
+                        const int8u* pa_user_id[8],
+                           const int user_id_len[8],
+                        const int8u* pa_pubx[8],
+                        const int8u* pa_puby[8])
+{
+   SM3_CTX_mb8 ctx;
+   SM3_CTX_mb8* p_ctx = &ctx;
+
+   sm3_init_mb8(p_ctx);
+
+   int8u entl_data[8][2];
+   const int8u* pa_entl[8];
+
+   for (int i = 0; i < 8; ++i)
+   {
+      int entl = ((user_id_len[i] * 8) & 0xFFFF);
+
+      entl_data[i][1] = entl & 0xFF;
+      entl_data[i][0] = entl >> 8;
+
+      pa_entl[i] = &(entl_data[i][0]);
+   }
+
+   sm3_update_mb8(pa_entl, len_2, p_ctx);
+
+   sm3_update_mb8(pa_user_id, (int *)user_id_len, p_ctx);
+
+   sm3_update_mb8(pa_a,  len_32, p_ctx);
+   sm3_update_mb8(pa_b,  len_32, p_ctx);
+   sm3_update_mb8(pa_xG, len_32, p_ctx);
+   sm3_update_mb8(pa_yG, len_32, p_ctx);
+
+   sm3_update_mb8(pa_pubx, len_32, p_ctx);
+   sm3_update_mb8(pa_puby, len_32, p_ctx);
+
+   sm3_final_mb8(pa_z_digest, p_ctx);
+   return;
+}
+
+/*
+// KDF: t(ct) = SM3(Z || ct), ct = 1, 2, ...
+//
+// Z is the same length in all lanes, so SM3 state after Z is computed once
+// and each 32-byte block of key stream then costs hashing of the 4-byte counter only.
+*/
+#define SM2_KDF_BLOCK_LEN  (SM3_SIZE_IN_BITS/8)
+
+void sm2_kdf_mb8(int8u* const pa_out[8],
+           const int8u* const pa_inp[8],
+                    const int len[8],
+           const int8u* const pa_z[8],
+                          int z_len)
+{
+   int max_len = 0;
+   for(int i = 0; i < 8; i++)
+      max_len = (len[i] > max_len)? len[i] : max_len;
+
+   if(0 == max_len)
+      return;
+
+   int len_z[8] = {REP8_DECL(z_len)};
+
+   __ALIGN64 SM3_CTX_mb8 z_ctx;
+   __ALIGN64 SM3_CTX_mb8 ctx;
+
+   sm3_init_mb8(&z_ctx);
+   sm3_update_mb8(pa_z, len_z, &z_ctx);
+
+   __ALIGN64 int8u t[8][SM2_KDF_BLOCK_LEN];
+   int8u* pa_t[8] = {t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7]};
+
+   int8u ct_be[4];
+   const int8u* pa_ct[8] = {REP8_DECL(ct_be)};
+
+   int32u ct = 1;
+   for(int offset = 0; offset < max_len; offset += SM2_KDF_BLOCK_LEN, ct++) {
+      ct_be[0] = (int8u)(ct >> 24);
+      ct_be[1] = (int8u)(ct >> 16);
+      ct_be[2] = (int8u)(ct >> 8);
+      ct_be[3] = (int8u)(ct);
+
+      /* t = SM3(Z || ct) */
+      ctx = z_ctx;
+      sm3_update_mb8(pa_ct, len_4, &ctx);
+      sm3_final_mb8(pa_t, &ctx);
+
+      for(int i = 0; i < 8; i++) {
+         int n = len[i] - offset;
+         n = (n > SM2_KDF_BLOCK_LEN)? SM2_KDF_BLOCK_LEN : n;
+         if(pa_inp) {
+            for(int j = 0; j < n; j++)
+               pa_out[i][offset + j] = pa_inp[i][offset + j] ^ t[i][j];
+         }
+         else {
+            for(int j = 0; j < n; j++)
+               pa_out[i][offset + j] = t[i][j];
+         }
+      }
+   }
+
+   /* clear key stream */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])t, sizeof(t)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&ctx, sizeof(ctx)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&z_ctx, sizeof(z_ctx)/sizeof(U64));
+}
@@ -94,12 +94,12 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
             M512(loc_src) = _mm512_add_epi64(M512(loc_src), _mm512_cvtepu32_epi64(M256(p_proc_len)));
 
             processed_mask = _mm256_cmp_epi32_mask(idx, _mm256_set1_epi32(SM3_MSG_BLOCK_SIZE), _MM_CMPINT_EQ);
-            proc_len = _mm256_mask_set1_epi32(proc_len, processed_mask, SM3_MSG_BLOCK_SIZE);
+            proc_len = _mm256_maskz_set1_epi32(processed_mask, SM3_MSG_BLOCK_SIZE);
 
             /* update digest if at least one buffer is full */
             if (processed_mask) {
                 sm3_avx512_mb8(HASH_VALUE(p_state), (const int8u **)p_buffer, p_proc_len);
-                idx = _mm256_mask_set1_epi32(idx, ~_mm256_cmp_epi32_mask(proc_len, M256(&zero_buffer), 2), _MM_CMPINT_EQ);
+                idx = _mm256_mask_set1_epi32(idx, ~_mm256_cmp_epi32_mask(proc_len, M256(&zero_buffer), _MM_CMPINT_LE), 0);
             }
         }
 
@@ -120,8 +120,10 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
         if (processed_mask) {
             for (i = 0; i < SM3_NUM_BUFFERS8; i++) {
                 /* copy from input stream to the internal buffer as match as possible */
-                __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
-                _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                if ((processed_mask >> i) & 0x1) {
+                    __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
+                    _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                }
             }
 
             idx = _mm256_maskz_add_epi32(0xFF, idx, loc_len);
@@ -0,0 +1,659 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+* 
+* http://www.apache.org/licenses/LICENSE-2.0
+* 
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+* 
+*******************************************************************************/
+
+/*
+// X25519 for the platforms without AVX512-IFMA.
+//
+// 4-lane AVX2 Montgomery ladder (RFC7748), field elements are in 2^25.5 radix:
+// 10 limbs of 26,25,26,25,... bits, limb i holds the bits [ceil(25.5*i), ceil(25.5*(i+1))).
+//
+// Limbs bounds kept by the ladder:
+//    - mul/sqr/mul121665 results (carried) are < 2^26 (even) and < 2^25+2^17 (odd limbs)
+//    - add and sub (a-b+2p) results are < 3*2^26 (even) and < 3*2^25 (odd limbs)
+// so that 19*b (b is operand of the multiplication) fits 32 bits
+// and 10 accumulated 64-bit products do not overflow.
+*/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/x25519.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_math.h>
+#include <internal/common/cpu_dispatch.h>
+#include <internal/x25519/avx2_x25519.h>
+
+#define FE25_LEN  (10)
+#define MASK26    (((int64u)1<<26) -1)
+#define MASK25    (((int64u)1<<25) -1)
+
+/* 2*p in 2^25.5 radix */
+#define P2_0      (2*(MASK26-18))
+#define P2_EVEN   (2*MASK26)
+#define P2_ODD    (2*MASK25)
+
+__INLINE void fe25_copy(U64x4 r[], const U64x4 a[])
+{
+   for(int i=0; i<FE25_LEN; i++)
+      r[i] = a[i];
+}
+
+__INLINE void fe25_set(U64x4 r[], int64u a)
+{
+   r[0] = set1x4(a);
+   for(int i=1; i<FE25_LEN; i++)
+      r[i] = get_zero64x4();
+}
+
+/* r = a+b */
+__INLINE void fe25_add(U64x4 r[], const U64x4 a[], const U64x4 b[])
+{
+   for(int i=0; i<FE25_LEN; i++)
+      r[i] = add64x4(a[i], b[i]);
+}
+
+/* r = a-b+2p, b is carried */
+__INLINE void fe25_sub(U64x4 r[], const U64x4 a[], const U64x4 b[])
+{
+   r[0] = sub64x4(add64x4(a[0], set1x4(P2_0)), b[0]);
+   for(int i=1; i<FE25_LEN; i++)
+      r[i] = sub64x4(add64x4(a[i], set1x4((i&1)? P2_ODD : P2_EVEN)), b[i]);
+}
+
+/* swap a and b if mask is set */
+__INLINE void fe25_cswap(U64x4 a[], U64x4 b[], U64x4 mask)
+{
+   for(int i=0; i<FE25_LEN; i++) {
+      U64x4 t = and64x4(xor64x4(a[i], b[i]), mask);
+      a[i] = xor64x4(a[i], t);
+      b[i] = xor64x4(b[i], t);
+   }
+}
+
+__INLINE U64x4 mul19(U64x4 a)
+{
+   return add64x4(add64x4(slli64x4(a, 4), slli64x4(a, 1)), a);
+}
+
+/* carry propagation of 64-bit accumulators, two interleaved chains */
+__INLINE void fe25_carry(U64x4 r[], U64x4 h[])
+{
+   const U64x4 m26 = set1x4(MASK26);
+   const U64x4 m25 = set1x4(MASK25);
+   U64x4 c;
+
+   #define CARRY(i, bits, mask) \
+      c = srli64x4(h[i], (bits)); h[i+1] = add64x4(h[i+1], c); h[i] = and64x4(h[i], (mask));
+
+   CARRY(0, 26, m26) CARRY(4, 26, m26)
+   CARRY(1, 25, m25) CARRY(5, 25, m25)
+   CARRY(2, 26, m26) CARRY(6, 26, m26)
+   CARRY(3, 25, m25) CARRY(7, 25, m25)
+   CARRY(4, 26, m26) CARRY(8, 26, m26)
+   c = srli64x4(h[9], 25); h[0] = add64x4(h[0], mul19(c)); h[9] = and64x4(h[9], m25);
+   CARRY(0, 26, m26)
+
+   #undef CARRY
+
+   for(int i=0; i<FE25_LEN; i++)
+      r[i] = h[i];
+}
+
+#define MADD(acc, x, y) (acc) = add64x4((acc), mul32x4((x), (y)))
+
+/* r = a*b */
+static void fe25_mul(U64x4 r[], const U64x4 a[], const U64x4 b[])
+{
+   U64x4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+   U64x4 b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4], b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9];
+
+   /* product of two odd limbs is at 2^(25.5*(i+j)+1), wrapped products are multiplied by 19 */
+   U64x4 a1_2 = add64x4(a1, a1), a3_2 = add64x4(a3, a3), a5_2 = add64x4(a5, a5), a7_2 = add64x4(a7, a7), a9_2 = add64x4(a9, a9);
+   U64x4 b1_19 = mul19(b1), b2_19 = mul19(b2), b3_19 = mul19(b3), b4_19 = mul19(b4), b5_19 = mul19(b5);
+   U64x4 b6_19 = mul19(b6), b7_19 = mul19(b7), b8_19 = mul19(b8), b9_19 = mul19(b9);
+
+   U64x4 h[FE25_LEN];
+   h[0] = mul32x4(a0, b0);
+   MADD(h[0], a1_2, b9_19);
+   MADD(h[0], a2, b8_19);
+   MADD(h[0], a3_2, b7_19);
+   MADD(h[0], a4, b6_19);
+   MADD(h[0], a5_2, b5_19);
+   MADD(h[0], a6, b4_19);
+   MADD(h[0], a7_2, b3_19);
+   MADD(h[0], a8, b2_19);
+   MADD(h[0], a9_2, b1_19);
+   h[1] = mul32x4(a0, b1);
+   MADD(h[1], a1, b0);
+   MADD(h[1], a2, b9_19);
+   MADD(h[1], a3, b8_19);
+   MADD(h[1], a4, b7_19);
+   MADD(h[1], a5, b6_19);
+   MADD(h[1], a6, b5_19);
+   MADD(h[1], a7, b4_19);
+   MADD(h[1], a8, b3_19);
+   MADD(h[1], a9, b2_19);
+   h[2] = mul32x4(a0, b2);
+   MADD(h[2], a1_2, b1);
+   MADD(h[2], a2, b0);
+   MADD(h[2], a3_2, b9_19);
+   MADD(h[2], a4, b8_19);
+   MADD(h[2], a5_2, b7_19);
+   MADD(h[2], a6, b6_19);
+   MADD(h[2], a7_2, b5_19);
+   MADD(h[2], a8, b4_19);
+   MADD(h[2], a9_2, b3_19);
+   h[3] = mul32x4(a0, b3);
+   MADD(h[3], a1, b2);
+   MADD(h[3], a2, b1);
+   MADD(h[3], a3, b0);
+   MADD(h[3], a4, b9_19);
+   MADD(h[3], a5, b8_19);
+   MADD(h[3], a6, b7_19);
+   MADD(h[3], a7, b6_19);
+   MADD(h[3], a8, b5_19);
+   MADD(h[3], a9, b4_19);
+   h[4] = mul32x4(a0, b4);
+   MADD(h[4], a1_2, b3);
+   MADD(h[4], a2, b2);
+   MADD(h[4], a3_2, b1);
+   MADD(h[4], a4, b0);
+   MADD(h[4], a5_2, b9_19);
+   MADD(h[4], a6, b8_19);
+   MADD(h[4], a7_2, b7_19);
+   MADD(h[4], a8, b6_19);
+   MADD(h[4], a9_2, b5_19);
+   h[5] = mul32x4(a0, b5);
+   MADD(h[5], a1, b4);
+   MADD(h[5], a2, b3);
+   MADD(h[5], a3, b2);
+   MADD(h[5], a4, b1);
+   MADD(h[5], a5, b0);
+   MADD(h[5], a6, b9_19);
+   MADD(h[5], a7, b8_19);
+   MADD(h[5], a8, b7_19);
+   MADD(h[5], a9, b6_19);
+   h[6] = mul32x4(a0, b6);
+   MADD(h[6], a1_2, b5);
+   MADD(h[6], a2, b4);
+   MADD(h[6], a3_2, b3);
+   MADD(h[6], a4, b2);
+   MADD(h[6], a5_2, b1);
+   MADD(h[6], a6, b0);
+   MADD(h[6], a7_2, b9_19);
+   MADD(h[6], a8, b8_19);
+   MADD(h[6], a9_2, b7_19);
+   h[7] = mul32x4(a0, b7);
+   MADD(h[7], a1, b6);
+   MADD(h[7], a2, b5);
+   MADD(h[7], a3, b4);
+   MADD(h[7], a4, b3);
+   MADD(h[7], a5, b2);
+   MADD(h[7], a6, b1);
+   MADD(h[7], a7, b0);
+   MADD(h[7], a8, b9_19);
+   MADD(h[7], a9, b8_19);
+   h[8] = mul32x4(a0, b8);
+   MADD(h[8], a1_2, b7);
+   MADD(h[8], a2, b6);
+   MADD(h[8], a3_2, b5);
+   MADD(h[8], a4, b4);
+   MADD(h[8], a5_2, b3);
+   MADD(h[8], a6, b2);
+   MADD(h[8], a7_2, b1);
+   MADD(h[8], a8, b0);
+   MADD(h[8], a9_2, b9_19);
+   h[9] = mul32x4(a0, b9);
+   MADD(h[9], a1, b8);
+   MADD(h[9], a2, b7);
+   MADD(h[9], a3, b6);
+   MADD(h[9], a4, b5);
+   MADD(h[9], a5, b4);
+   MADD(h[9], a6, b3);
+   MADD(h[9], a7, b2);
+   MADD(h[9], a8, b1);
+   MADD(h[9], a9, b0);
+
+   fe25_carry(r, h);
+}
+
+/* r = a^2 */
+static void fe25_sqr(U64x4 r[], const U64x4 a[])
+{
+   U64x4 a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+
+   /* cross products are doubled, doubled twice if both limbs are odd */
+   U64x4 a0_2 = add64x4(a0, a0), a1_2 = add64x4(a1, a1), a2_2 = add64x4(a2, a2), a3_2 = add64x4(a3, a3), a4_2 = add64x4(a4, a4);
+   U64x4 a5_2 = add64x4(a5, a5), a6_2 = add64x4(a6, a6), a7_2 = add64x4(a7, a7), a8_2 = add64x4(a8, a8), a9_2 = add64x4(a9, a9);
+   U64x4 a1_4 = add64x4(a1_2, a1_2), a3_4 = add64x4(a3_2, a3_2), a5_4 = add64x4(a5_2, a5_2), a7_4 = add64x4(a7_2, a7_2);
+   U64x4 a5_19 = mul19(a5), a6_19 = mul19(a6), a7_19 = mul19(a7), a8_19 = mul19(a8), a9_19 = mul19(a9);
+
+   U64x4 h[FE25_LEN];
+   h[0] = mul32x4(a0, a0);
+   MADD(h[0], a1_4, a9_19);
+   MADD(h[0], a2_2, a8_19);
+   MADD(h[0], a3_4, a7_19);
+   MADD(h[0], a4_2, a6_19);
+   MADD(h[0], a5_2, a5_19);
+   h[1] = mul32x4(a0_2, a1);
+   MADD(h[1], a2_2, a9_19);
+   MADD(h[1], a3_2, a8_19);
+   MADD(h[1], a4_2, a7_19);
+   MADD(h[1], a5_2, a6_19);
+   h[2] = mul32x4(a0_2, a2);
+   MADD(h[2], a1_2, a1);
+   MADD(h[2], a3_4, a9_19);
+   MADD(h[2], a4_2, a8_19);
+   MADD(h[2], a5_4, a7_19);
+   MADD(h[2], a6, a6_19);
+   h[3] = mul32x4(a0_2, a3);
+   MADD(h[3], a1_2, a2);
+   MADD(h[3], a4_2, a9_19);
+   MADD(h[3], a5_2, a8_19);
+   MADD(h[3], a6_2, a7_19);
+   h[4] = mul32x4(a0_2, a4);
+   MADD(h[4], a1_4, a3);
+   MADD(h[4], a2, a2);
+   MADD(h[4], a5_4, a9_19);
+   MADD(h[4], a6_2, a8_19);
+   MADD(h[4], a7_2, a7_19);
+   h[5] = mul32x4(a0_2, a5);
+   MADD(h[5], a1_2, a4);
+   MADD(h[5], a2_2, a3);
+   MADD(h[5], a6_2, a9_19);
+   MADD(h[5], a7_2, a8_19);
+   h[6] = mul32x4(a0_2, a6);
+   MADD(h[6], a1_4, a5);
+   MADD(h[6], a2_2, a4);
+   MADD(h[6], a3_2, a3);
+   MADD(h[6], a7_4, a9_19);
+   MADD(h[6], a8, a8_19);
+   h[7] = mul32x4(a0_2, a7);
+   MADD(h[7], a1_2, a6);
+   MADD(h[7], a2_2, a5);
+   MADD(h[7], a3_2, a4);
+   MADD(h[7], a8_2, a9_19);
+   h[8] = mul32x4(a0_2, a8);
+   MADD(h[8], a1_4, a7);
+   MADD(h[8], a2_2, a6);
+   MADD(h[8], a3_4, a5);
+   MADD(h[8], a4, a4);
+   MADD(h[8], a9_2, a9_19);
+   h[9] = mul32x4(a0_2, a9);
+   MADD(h[9], a1_2, a8);
+   MADD(h[9], a2_2, a7);
+   MADD(h[9], a3_2, a6);
+   MADD(h[9], a4_2, a5);
+
+   fe25_carry(r, h);
+}
+
+#undef MADD
+
+/* r = a^(2^n) */
+static void fe25_sqr_n(U64x4 r[], const U64x4 a[], int n)
+{
+   fe25_sqr(r, a);
+   while(--n)
+      fe25_sqr(r, r);
+}
+
+/* r = 121665*a */
+static void fe25_mul121665(U64x4 r[], const U64x4 a[])
+{
+   U64x4 h[FE25_LEN];
+   for(int i=0; i<FE25_LEN; i++)
+      h[i] = mul32x4(a[i], set1x4(121665));
+   fe25_carry(r, h);
+}
+
+/* r = a^(p-2) */
+static void fe25_inv(U64x4 r[], const U64x4 z[])
+{
+   U64x4 t0[FE25_LEN], t1[FE25_LEN], t2[FE25_LEN], t3[FE25_LEN];
+
+   fe25_sqr(t0, z);              /* 2 */
+   fe25_sqr_n(t1, t0, 2);        /* 8 */
+   fe25_mul(t1, z, t1);          /* 9 */
+   fe25_mul(t0, t0, t1);         /* 11 */
+   fe25_sqr(t2, t0);             /* 22 */
+   fe25_mul(t1, t1, t2);         /* 2^5 -1 */
+   fe25_sqr_n(t2, t1, 5);
+   fe25_mul(t1, t2, t1);         /* 2^10 -1 */
+   fe25_sqr_n(t2, t1, 10);
+   fe25_mul(t2, t2, t1);         /* 2^20 -1 */
+   fe25_sqr_n(t3, t2, 20);
+   fe25_mul(t2, t3, t2);         /* 2^40 -1 */
+   fe25_sqr_n(t2, t2, 10);
+   fe25_mul(t1, t2, t1);         /* 2^50 -1 */
+   fe25_sqr_n(t2, t1, 50);
+   fe25_mul(t2, t2, t1);         /* 2^100 -1 */
+   fe25_sqr_n(t3, t2, 100);
+   fe25_mul(t2, t3, t2);         /* 2^200 -1 */
+   fe25_sqr_n(t2, t2, 50);
+   fe25_mul(t1, t2, t1);         /* 2^250 -1 */
+   fe25_sqr_n(t1, t1, 5);        /* 2^255 -32 */
+   fe25_mul(r, t1, t0);          /* 2^255 -21 */
+}
+
+/* 255-bit little-endian value (the most significant bit is masked) -> fe25 */
+static void fe25_from_bytes(U64x4 r[], const int8u* const pa_inp[MB4_WIDTH])
+{
+   __ALIGN64 int64u w[4][MB4_WIDTH];
+   for(int n=0; n<MB4_WIDTH; n++) {
+      for(int k=0; k<4; k++) {
+         int64u d = 0;
+         if(NULL!=pa_inp[n]) {
+            for(int b=7; b>=0; b--)
+               d = (d<<8) | pa_inp[n][k*8+b];
+         }
+         w[k][n] = d;
+      }
+   }
+   U64x4 w0 = loadu64x4(w[0]);
+   U64x4 w1 = loadu64x4(w[1]);
+   U64x4 w2 = loadu64x4(w[2]);
+   U64x4 w3 = loadu64x4(w[3]);
+   const U64x4 m26 = set1x4(MASK26);
+   const U64x4 m25 = set1x4(MASK25);
+
+   r[0] = and64x4(w0, m26);
+   r[1] = and64x4(srli64x4(w0, 26), m25);
+   r[2] = and64x4(or64x4(srli64x4(w0, 51), slli64x4(w1, 13)), m26);
+   r[3] = and64x4(srli64x4(w1, 13), m25);
+   r[4] = and64x4(srli64x4(w1, 38), m26);
+   r[5] = and64x4(w2, m25);
+   r[6] = and64x4(srli64x4(w2, 25), m26);
+   r[7] = and64x4(or64x4(srli64x4(w2, 51), slli64x4(w3, 13)), m25);
+   r[8] = and64x4(srli64x4(w3, 12), m26);
+   r[9] = and64x4(srli64x4(w3, 38), m25);
+
+   /* clear copy of the input */
+   for(int k=0; k<4; k++)
+      storeu64x4(w[k], get_zero64x4());
+}
+
+/* fe25 (carried) -> canonical 32-byte little-endian value */
+static void fe25_to_bytes(int8u* const pa_out[MB4_WIDTH], const U64x4 a[])
+{
+   const U64x4 m26 = set1x4(MASK26);
+   const U64x4 m25 = set1x4(MASK25);
+   U64x4 h[FE25_LEN];
+   int i;
+
+   /* a < 2*p: q = (a+19) >> 255 and a-q*p is canonical */
+   U64x4 q = srli64x4(add64x4(a[0], set1x4(19)), 26);
+   for(i=1; i<FE25_LEN; i++)
+      q = srli64x4(add64x4(a[i], q), (i&1)? 25 : 26);
+
+   h[0] = add64x4(a[0], mul19(q));
+   for(i=1; i<FE25_LEN; i++)
+      h[i] = a[i];
+   for(i=0; i<FE25_LEN-1; i++) {
+      h[i+1] = add64x4(h[i+1], srli64x4(h[i], (i&1)? 25 : 26));
+      h[i] = and64x4(h[i], (i&1)? m25 : m26);
+   }
+   h[9] = and64x4(h[9], m25);
+
+   __ALIGN64 int64u w[4][MB4_WIDTH];
+   storeu64x4(w[0], or64x4(or64x4(h[0], slli64x4(h[1], 26)), slli64x4(h[2], 51)));
+   storeu64x4(w[1], or64x4(or64x4(srli64x4(h[2], 13), slli64x4(h[3], 13)), slli64x4(h[4], 38)));
+   storeu64x4(w[2], or64x4(or64x4(h[5], slli64x4(h[6], 25)), slli64x4(h[7], 51)));
+   storeu64x4(w[3], or64x4(or64x4(srli64x4(h[7], 13), slli64x4(h[8], 12)), slli64x4(h[9], 38)));
+
+   for(int n=0; n<MB4_WIDTH; n++) {
+      if(NULL==pa_out[n])
+         continue;
+      for(int k=0; k<4; k++)
+         for(int b=0; b<8; b++)
+            pa_out[n][k*8+b] = (int8u)(w[k][n] >> (b*8));
+   }
+}
+
+/* decode 4 private keys into scalars according to RFC7748 */
+static void x25519_scalar_mb4(U64x4 scalar[4], const int8u* const pa_private_key[MB4_WIDTH])
+{
+   __ALIGN64 int64u s[4][MB4_WIDTH];
+   for(int n=0; n<MB4_WIDTH; n++) {
+      for(int k=0; k<4; k++) {
+         int64u d = 0;
+         if(NULL!=pa_private_key[n]) {
+            for(int b=7; b>=0; b--)
+               d = (d<<8) | pa_private_key[n][k*8+b];
+         }
+         s[k][n] = d;
+      }
+   }
+   for(int k=0; k<4; k++) {
+      scalar[k] = loadu64x4(s[k]);
+      storeu64x4(s[k], get_zero64x4());
+   }
+   scalar[0] = and64x4(scalar[0], set1x4(0xfffffffffffffff8));
+   scalar[3] = and64x4(scalar[3], set1x4(0x7fffffffffffffff));
+   scalar[3] = or64x4(scalar[3], set1x4(0x4000000000000000));
+}
+
+/* Montgomery ladder: u-coordinate of [scalar]*U */
+static void x25519_ladder_mb4(U64x4 r[], const U64x4 scalar[4], const U64x4 x1[])
+{
+   U64x4 x2[FE25_LEN], z2[FE25_LEN], x3[FE25_LEN], z3[FE25_LEN];
+   U64x4 A[FE25_LEN], AA[FE25_LEN], B[FE25_LEN], BB[FE25_LEN], E[FE25_LEN];
+   U64x4 C[FE25_LEN], D[FE25_LEN];
+
+   fe25_set(x2, 1);
+   fe25_set(z2, 0);
+   fe25_copy(x3, x1);
+   fe25_set(z3, 1);
+
+   U64x4 swap = get_zero64x4();
+
+   for(int t=254; t>=0; t--) {
+      U64x4 k = bit0_mask64x4(srl64x4(scalar[t/64], t%64));
+
+      swap = xor64x4(swap, k);
+      fe25_cswap(x2, x3, swap);
+      fe25_cswap(z2, z3, swap);
+      swap = k;
+
+      fe25_add(A, x2, z2);       /* A = x2+z2           */
+      fe25_sub(B, x2, z2);       /* B = x2-z2           */
+      fe25_add(C, x3, z3);       /* C = x3+z3           */
+      fe25_sub(D, x3, z3);       /* D = x3-z3           */
+      fe25_sqr(AA, A);           /* AA = A^2            */
+      fe25_sqr(BB, B);           /* BB = B^2            */
+      fe25_mul(D, D, A);         /* DA = D*A            */
+      fe25_mul(C, C, B);         /* CB = C*B            */
+      fe25_sub(E, AA, BB);       /* E = AA-BB           */
+      fe25_add(A, D, C);         /* DA+CB               */
+      fe25_sub(B, D, C);         /* DA-CB               */
+      fe25_sqr(x3, A);           /* x3 = (DA+CB)^2      */
+      fe25_sqr(B, B);
+      fe25_mul(z3, x1, B);       /* z3 = x1*(DA-CB)^2   */
+      fe25_mul(x2, AA, BB);      /* x2 = AA*BB          */
+      fe25_mul121665(A, E);
+      fe25_add(A, A, AA);
+      fe25_mul(z2, E, A);        /* z2 = E*(AA+a24*E)   */
+   }
+   fe25_cswap(x2, x3, swap);
+   fe25_cswap(z2, z3, swap);
+
+   fe25_inv(z2, z2);
+   fe25_mul(r, x2, z2);
+
+   /* clear secret dependent data */
+   swap = get_zero64x4();
+   fe25_set(x3, 0);
+   fe25_set(z3, 0);
+}
+
+/* shared secret of 4 lanes, returns mask of the lanes having all-zero result */
+static int8u x25519_mb4(int8u* const pa_shared_key[MB4_WIDTH],
+                  const int8u* const pa_private_key[MB4_WIDTH],
+                  const int8u* const pa_public_key[MB4_WIDTH])
+{
+   U64x4 scalar[4];
+   U64x4 u[FE25_LEN];
+   U64x4 r[FE25_LEN];
+
+   x25519_scalar_mb4(scalar, pa_private_key);
+   /* RFC7748: the most significant bit of the u-coordinate is masked by fe25_from_bytes() */
+   fe25_from_bytes(u, pa_public_key);
+
+   x25519_ladder_mb4(r, scalar, u);
+   fe25_to_bytes(pa_shared_key, r);
+
+   /* test shared secret: all-zero output results when the input is a point of small order */
+   int8u zero_mask = 0;
+   for(int n=0; n<MB4_WIDTH; n++) {
+      int8u sum = 0;
+      if(NULL!=pa_shared_key[n]) {
+         for(int b=0; b<32; b++)
+            sum |= pa_shared_key[n][b];
+      }
+      zero_mask |= (int8u)((0==sum) << n);
+   }
+
+   /* clear copy of the secret keys and result */
+   for(int k=0; k<4; k++)
+      scalar[k] = get_zero64x4();
+   fe25_set(r, 0);
+
+   return zero_mask;
+}
+
+/* public key of 4 lanes: [scalar]*9 */
+static void x25519_public_key_mb4(int8u* const pa_public_key[MB4_WIDTH],
+                            const int8u* const pa_private_key[MB4_WIDTH])
+{
+   U64x4 scalar[4];
+   U64x4 u[FE25_LEN];
+   U64x4 r[FE25_LEN];
+
+   x25519_scalar_mb4(scalar, pa_private_key);
+   fe25_set(u, 9);
+
+   x25519_ladder_mb4(r, scalar, u);
+   fe25_to_bytes(pa_public_key, r);
+
+   /* clear copy of the secret keys */
+   for(int k=0; k<4; k++)
+      scalar[k] = get_zero64x4();
+}
+
+mbx_status avx2_x25519_mb8(int8u* const pa_shared_key[8],
+                     const int8u* const pa_private_key[8],
+                     const int8u* const pa_public_key[8])
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_shared_key || NULL==pa_private_key || NULL==pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   int8u* shared[8];
+   const int8u* own_private[8];
+   const int8u* party_public[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      shared[buf_no] = pa_shared_key[buf_no];
+      own_private[buf_no] = pa_private_key[buf_no];
+      party_public[buf_no] = pa_public_key[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==shared[buf_no] || NULL==own_private[buf_no] || NULL==party_public[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         shared[buf_no] = NULL;
+         own_private[buf_no] = NULL;
+         party_public[buf_no] = NULL;
+      }
+   }
+
+   /* process the batch by halves */
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      if(NULL==shared[buf_no] && NULL==shared[buf_no+1] && NULL==shared[buf_no+2] && NULL==shared[buf_no+3])
+         continue;
+
+      int8u zero_mask = x25519_mb4(shared+buf_no, own_private+buf_no, party_public+buf_no);
+      for(int n=0; n<MB4_WIDTH; n++) {
+         if(NULL!=shared[buf_no+n] && ((zero_mask>>n) &1))
+            status = MBX_SET_STS(status, buf_no+n, MBX_STATUS_LOW_ORDER_ERR);
+      }
+   }
+
+   return status;
+}
+
+mbx_status avx2_x25519_public_key_mb8(int8u* const pa_public_key[8],
+                                const int8u* const pa_private_key[8])
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_private_key || NULL==pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   int8u* public[8];
+   const int8u* own_private[8];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      public[buf_no] = pa_public_key[buf_no];
+      own_private[buf_no] = pa_private_key[buf_no];
+
+      /* if any of pointer NULL set error status and exclude the lane */
+      if(NULL==public[buf_no] || NULL==own_private[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         public[buf_no] = NULL;
+         own_private[buf_no] = NULL;
+      }
+   }
+
+   /* process the batch by halves */
+   for(buf_no=0; buf_no<8; buf_no+=MB4_WIDTH) {
+      if(NULL==public[buf_no] && NULL==public[buf_no+1] && NULL==public[buf_no+2] && NULL==public[buf_no+3])
+         continue;
+      x25519_public_key_mb4(public+buf_no, own_private+buf_no);
+   }
+
+   return status;
+}
+
+/*
+// public entry points
+*/
+DLL_PUBLIC
+mbx_status mbx_x25519_mb8(int8u* const pa_shared_key[8],
+                    const int8u* const pa_private_key[8],
+                    const int8u* const pa_public_key[8])
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_x25519_mb8(pa_shared_key, pa_private_key, pa_public_key);
+   return ifma_x25519_mb8(pa_shared_key, pa_private_key, pa_public_key);
+}
+
+DLL_PUBLIC
+mbx_status mbx_x25519_public_key_mb8(int8u* const pa_public_key[8],
+                               const int8u* const pa_private_key[8])
+{
+   if(MBX_ISA_AVX2==mbx_kernels_isa())
+      return avx2_x25519_public_key_mb8(pa_public_key, pa_private_key);
+   return ifma_x25519_public_key_mb8(pa_public_key, pa_private_key);
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/x25519/avx2_x25519.h>
+
+#include <internal/ed25519/ifma_arith_p25519.h>
+#include <internal/ed25519/ifma_arith_ed25519.h>
+
+/*
+// X25519 public key is u-coordinate of [scalar]*G on Curve25519.
+//
+// Curve25519 is birationally equivalent to edwards25519, the base points correspond each other
+// and u = (1+y)/(1-y) = (Z+Y)/(Z-Y) (RFC 7748, 4.1). So [scalar]*G is computed by the fixed-base
+// comb of the ed25519 code (precomputed table of the base point multiples) instead of the ladder.
+*/
+mbx_status MB_FUNC_NAME(ifma_x25519_public_key_)(int8u* const pa_public_key[8],
+                                     const int8u* const pa_private_key[8])
+{
+   mbx_status status = 0;
+
+    /* test input pointers */
+    if(NULL==pa_private_key || NULL==pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int64u* own_private = (const int64u*) pa_private_key[buf_no];
+      const int64u* party_public = (const int64u*) pa_public_key[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==own_private || NULL==party_public) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+   }
+
+   /* continue processing if there are correct parameters */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+
+      /* convert private to to MB8 and decode */
+      __ALIGN64 U64 scalar_mb8[FE_LEN64];
+      ifma_BNU_transpose_copy((int64u (*)[8])scalar_mb8, (const int64u * const*)pa_private_key, 256);
+      /* decode keys into scalars according to RFC7748 */
+      scalar_mb8[0] = and64_const(scalar_mb8[0], 0xfffffffffffffff8);
+      scalar_mb8[3] = and64_const(scalar_mb8[3], 0x7fffffffffffffff);
+      scalar_mb8[3] = or64(scalar_mb8[3], set64(0x4000000000000000));
+
+      /* r = [scalar]*G on edwards25519 */
+      __ALIGN64 ge52_ext_mb r;
+      ifma_ed25519_mul_basepoint(&r, scalar_mb8);
+
+      /* u = (Z+Y)/(Z-Y), Z-Y is never zero because clamped scalar is not multiple of the base point order */
+      __ALIGN64 fe52_mb U;
+      __ALIGN64 fe52_mb W;
+      fe52_add(U, r.Z, r.Y);
+      fe52_sub(W, r.Z, r.Y);
+      fe52_inv(W, W);
+      fe52_mul(U, U, W);
+      fe52_red(U, U);
+
+      /* convert result back */
+      ifma_mb8_to_BNU((int64u * const*)pa_public_key, (const int64u (*)[8])U, 256);
+
+      /* clear secret */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalar_mb8, sizeof(scalar_mb8)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u (*)[8])&r, sizeof(r)/sizeof(U64));
+   }
+
+   return status;
+}
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright (C) 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the 'License');
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an 'AS IS' BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*******************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/x448.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ed448/ifma_arith_p448.h>
+
+/*
+// X448 (RFC 7748): Montgomery ladder over GF(p448) in radix 2^52 and Montgomery domain
+*/
+
+/* a24 = (156326-2)/4, multiplication by the plain constant keeps Montgomery domain */
+#define A24_X448  (39081)
+
+/* base point u = 5 */
+__ALIGN64 static const int64u u5_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(5) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) }
+};
+
+#define fe52_add  MB_FUNC_NAME(ifma_ladd52_p448_)
+#define fe52_sub  MB_FUNC_NAME(ifma_lsub52_p448_)
+#define fe52_mulc MB_FUNC_NAME(ifma_mulc52_p448_)
+#define fe52_mul  MB_FUNC_NAME(ifma_amm52_p448_)
+#define fe52_sqr  MB_FUNC_NAME(ifma_ams52_p448_)
+
+/*
+// out = [scalar]*u, u is in Montgomery domain, out is fully reduced and is out of Montgomery domain
+//
+// Sums and differences of the ladder are not reduced (lazy add and sub),
+// every one of them is consumed by multiplication which brings the value back to [0, 2*p448).
+*/
+static void x448_scalar_mul(U64 out[], const U64 scalar[], const U64 u[])
+{
+   __ALIGN64 U64 x2[P448_LEN52], z2[P448_LEN52];
+   __ALIGN64 U64 x3[P448_LEN52], z3[P448_LEN52];
+   __ALIGN64 U64 A[P448_LEN52], AA[P448_LEN52];
+   __ALIGN64 U64 B[P448_LEN52], BB[P448_LEN52];
+   __ALIGN64 U64 C[P448_LEN52], D[P448_LEN52];
+   __ALIGN64 U64 E[P448_LEN52];
+
+   MB_FUNC_NAME(mov_FE448_)(x2, MB_FUNC_NAME(ifma_one52_p448_)());
+   MB_FUNC_NAME(zero_FE448_)(z2);
+   MB_FUNC_NAME(mov_FE448_)(x3, u);
+   MB_FUNC_NAME(mov_FE448_)(z3, MB_FUNC_NAME(ifma_one52_p448_)());
+
+   __mb_mask swap = get_mask(0);
+
+   U64 e = get_zero64();
+   int bitpos;
+   for (bitpos=P448_BITSIZE-1; bitpos>=0; bitpos--) {
+      if(63==(bitpos%64))
+         e = loadu64(&scalar[bitpos/64]);
+
+      __mb_mask b = cmp64_mask(e, get_zero64(), _MM_CMPINT_LT);
+
+      swap = mask_xor(swap, b);
+      MB_FUNC_NAME(mask_swap_FE448_)(x2, x3, swap);
+      MB_FUNC_NAME(mask_swap_FE448_)(z2, z3, swap);
+      swap = b;
+
+      fe52_add(A, x2, z2);       /* A  = x2+z2      */
+      fe52_sub(B, x2, z2);       /* B  = x2-z2      */
+      fe52_add(C, x3, z3);       /* C  = x3+z3      */
+      fe52_sub(D, x3, z3);       /* D  = x3-z3      */
+      fe52_sqr(AA, A);           /* AA = A^2        */
+      fe52_sqr(BB, B);           /* BB = B^2        */
+      fe52_mul(D, D, A);         /* DA = D*A        */
+      fe52_mul(C, C, B);         /* CB = C*B        */
+      fe52_sub(E, AA, BB);       /* E  = AA-BB      */
+      fe52_add(x3, D, C);        /* x3 = (DA+CB)^2  */
+      fe52_sqr(x3, x3);
+      fe52_sub(z3, D, C);        /* z3 = u*(DA-CB)^2 */
+      fe52_sqr(z3, z3);
+      fe52_mul(z3, z3, u);
+      fe52_mul(x2, AA, BB);      /* x2 = AA*BB      */
+      fe52_mulc(z2, E, A24_X448);
+      fe52_add(z2, z2, AA);      /* z2 = E*(AA + a24*E) */
+      fe52_mul(z2, z2, E);
+
+      e = slli64(e, 1);
+   }
+   MB_FUNC_NAME(mask_swap_FE448_)(x2, x3, swap);
+   MB_FUNC_NAME(mask_swap_FE448_)(z2, z3, swap);
+
+   /* out = x2/z2 */
+   MB_FUNC_NAME(ifma_aminv52_p448_)(z2, z2);
+   fe52_mul(out, x2, z2);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(out, out);
+}
+
+/* convert private keys to MB8 and decode into scalars according to RFC7748 */
+static void x448_decode_scalar(U64 scalar[], const int8u* const pa_private_key[8])
+{
+   ifma_BNU_transpose_copy((int64u (*)[8])scalar, (const int64u * const*)pa_private_key, P448_BITSIZE);
+   scalar[0] = and64_const(scalar[0], 0xfffffffffffffffc);
+   scalar[P448_LEN64-1] = or64(scalar[P448_LEN64-1], set64((long long)0x8000000000000000));
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_x448_)(int8u* const pa_shared_key[8],
+                             const int8u* const pa_private_key[8],
+                             const int8u* const pa_public_key[8])
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_shared_key || NULL==pa_private_key || NULL==pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_shared_key[buf_no] || NULL==pa_private_key[buf_no] || NULL==pa_public_key[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   /* continue processing if there are correct parameters */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      __ALIGN64 U64 scalar_mb8[P448_LEN64];
+      __ALIGN64 U64 u_mb8[P448_LEN52];
+      __ALIGN64 U64 shared_mb8[P448_LEN52];
+
+      x448_decode_scalar(scalar_mb8, pa_private_key);
+
+      /* get peer's public keys, convert to MB8 and to Montgomery domain (non-canonical values are reduced) */
+      ifma_BNU_to_mb8((int64u (*)[8])u_mb8, (const int64u * const*)pa_public_key, P448_BITSIZE);
+      MB_FUNC_NAME(ifma_tomont52_p448_)(u_mb8, u_mb8);
+
+      /* point multiplication */
+      x448_scalar_mul(shared_mb8, scalar_mb8, u_mb8);
+
+      /* test shared secret before return; all-zero output results when the input is a point of small order. */
+      __mb_mask stt_mask = MB_FUNC_NAME(is_zero_FE448_)(shared_mb8);
+      status |= MBX_SET_STS_BY_MASK(status, stt_mask, MBX_STATUS_LOW_ORDER_ERR);
+
+      /* convert result back */
+      ifma_mb8_to_BNU((int64u* const *)pa_shared_key, (const int64u (*)[8])shared_mb8, P448_BITSIZE);
+
+      /* clear computed shared keys and copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])shared_mb8, sizeof(shared_mb8)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalar_mb8, sizeof(scalar_mb8)/sizeof(U64));
+   }
+
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status MB_FUNC_NAME(mbx_x448_public_key_)(int8u* const pa_public_key[8],
+                                        const int8u* const pa_private_key[8])
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_private_key || NULL==pa_public_key) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_private_key[buf_no] || NULL==pa_public_key[buf_no])
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+   }
+
+   /* continue processing if there are correct parameters */
+   if( MBX_IS_ANY_OK_STS(status) ) {
+      __ALIGN64 U64 scalar_mb8[P448_LEN64];
+      __ALIGN64 U64 u_mb8[P448_LEN52];
+      __ALIGN64 U64 public_mb8[P448_LEN52];
+
+      x448_decode_scalar(scalar_mb8, pa_private_key);
+
+      /* base point */
+      MB_FUNC_NAME(ifma_tomont52_p448_)(u_mb8, (U64*)u5_mb);
+
+      /* point multiplication */
+      x448_scalar_mul(public_mb8, scalar_mb8, u_mb8);
+
+      /* convert result back */
+      ifma_mb8_to_BNU((int64u* const *)pa_public_key, (const int64u (*)[8])public_mb8, P448_BITSIZE);
+
+      /* clear copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalar_mb8, sizeof(scalar_mb8)/sizeof(U64));
+   }
+
+   return status;
+}
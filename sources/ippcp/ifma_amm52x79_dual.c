@@ -0,0 +1,148 @@
+ /*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include "owncp.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+#include <immintrin.h>
+
+#include "pcpngmontexpstuff_avx512.h"
+#include "ifma_rsa_arith.h"
+
+#define LEN52 (80) /* 79 digits + 1 zero pad */
+
+/* R += lo/hi(X[]*Bc), X[] is 10 zmm in memory */
+#define FMA52x80(fma, R, X, Bc) \
+    R##0 = fma(R##0, _mm512_loadu_si512((X) + 8*0), Bc); \
+    R##1 = fma(R##1, _mm512_loadu_si512((X) + 8*1), Bc); \
+    R##2 = fma(R##2, _mm512_loadu_si512((X) + 8*2), Bc); \
+    R##3 = fma(R##3, _mm512_loadu_si512((X) + 8*3), Bc); \
+    R##4 = fma(R##4, _mm512_loadu_si512((X) + 8*4), Bc); \
+    R##5 = fma(R##5, _mm512_loadu_si512((X) + 8*5), Bc); \
+    R##6 = fma(R##6, _mm512_loadu_si512((X) + 8*6), Bc); \
+    R##7 = fma(R##7, _mm512_loadu_si512((X) + 8*7), Bc); \
+    R##8 = fma(R##8, _mm512_loadu_si512((X) + 8*8), Bc); \
+    R##9 = fma(R##9, _mm512_loadu_si512((X) + 8*9), Bc);
+
+/* shift R by 1 digit, the carry of the dropped digit goes to the next one */
+#define SHIFT52x80(R, ZERO) { \
+    __m512i tmp = _mm512_maskz_srli_epi64(0x01, R##0, EXP_DIGIT_SIZE_AVX512); \
+    R##0 = _mm512_alignr_epi64(R##1, R##0, 1); \
+    R##1 = _mm512_alignr_epi64(R##2, R##1, 1); \
+    R##2 = _mm512_alignr_epi64(R##3, R##2, 1); \
+    R##3 = _mm512_alignr_epi64(R##4, R##3, 1); \
+    R##4 = _mm512_alignr_epi64(R##5, R##4, 1); \
+    R##5 = _mm512_alignr_epi64(R##6, R##5, 1); \
+    R##6 = _mm512_alignr_epi64(R##7, R##6, 1); \
+    R##7 = _mm512_alignr_epi64(R##8, R##7, 1); \
+    R##8 = _mm512_alignr_epi64(R##9, R##8, 1); \
+    R##9 = _mm512_alignr_epi64(ZERO, R##9, 1); \
+    R##0 = _mm512_add_epi64(R##0, tmp); \
+}
+
+#define STORE52x80(out, R) \
+    _mm512_storeu_si512((out) + 8*0, R##0); \
+    _mm512_storeu_si512((out) + 8*1, R##1); \
+    _mm512_storeu_si512((out) + 8*2, R##2); \
+    _mm512_storeu_si512((out) + 8*3, R##3); \
+    _mm512_storeu_si512((out) + 8*4, R##4); \
+    _mm512_storeu_si512((out) + 8*5, R##5); \
+    _mm512_storeu_si512((out) + 8*6, R##6); \
+    _mm512_storeu_si512((out) + 8*7, R##7); \
+    _mm512_storeu_si512((out) + 8*8, R##8); \
+    _mm512_mask_storeu_epi64((out) + 8*9, 0x7F, R##9);
+
+__INLINE void normalize52x79(Ipp64u out[LEN52])
+{
+    Ipp64u acc = 0;
+    int i;
+    for (i=0; i<79; i++) {
+        acc += out[i];
+        out[i] = acc & EXP_DIGIT_MASK_AVX512;
+        acc >>= EXP_DIGIT_SIZE_AVX512;
+    }
+    out[79] = 0;
+}
+
+/*
+ * Almost Montgomery Multiplication in 2^52-radix
+ *
+ *   Implements two independent interleaved multiplications
+ *   on 512-bit registers.
+ *   Data represented as 2 80-qwords arrays in 2^52-radix
+ *   (79 digits, the last qword is zero).
+ *
+ *   Accumulators of both operations stay in registers, operands
+ *   are read from memory.
+ *
+ */
+IPP_OWN_DEFN(void, ifma512_amm52x79_dual, (Ipp64u out[2][LEN52],
+                                     const Ipp64u a  [2][LEN52],
+                                     const Ipp64u b  [2][LEN52],
+                                     const Ipp64u m  [2][LEN52],
+                                     const Ipp64u k0 [2]))
+{
+    const __m512i ZERO = _mm512_setzero_si512();
+    const __m512i K_0 = _mm512_set1_epi64((Ipp64s)k0[0]);
+    const __m512i K_1 = _mm512_set1_epi64((Ipp64s)k0[1]);
+
+    const Ipp64u *a_0 = a[0], *b_0 = b[0], *m_0 = m[0];
+    const Ipp64u *a_1 = a[1], *b_1 = b[1], *m_1 = m[1];
+
+    __m512i R0_0, R0_1, R0_2, R0_3, R0_4, R0_5, R0_6, R0_7, R0_8, R0_9;
+    __m512i R1_0, R1_1, R1_2, R1_3, R1_4, R1_5, R1_6, R1_7, R1_8, R1_9;
+    R0_0 = R0_1 = R0_2 = R0_3 = R0_4 = R0_5 = R0_6 = R0_7 = R0_8 = R0_9 = ZERO;
+    R1_0 = R1_1 = R1_2 = R1_3 = R1_4 = R1_5 = R1_6 = R1_7 = R1_8 = R1_9 = ZERO;
+
+    int i;
+    for (i=0; i<79; i++) {
+        __m512i Bi_0 = _mm512_set1_epi64((Ipp64s)b_0[i]);   /* broadcast(b[i]) */
+        __m512i Bi_1 = _mm512_set1_epi64((Ipp64s)b_1[i]);
+        __m512i Yi_0, Yi_1;
+
+        /* R += A*Bi (lo) */
+        FMA52x80(_mm512_madd52lo_epu64, R0_, a_0, Bi_0)
+        FMA52x80(_mm512_madd52lo_epu64, R1_, a_1, Bi_1)
+
+        /* Yi = R0*K, broadcast Yi */
+        Yi_0 = _mm512_permutexvar_epi64(ZERO, _mm512_madd52lo_epu64(ZERO, K_0, R0_0));
+        Yi_1 = _mm512_permutexvar_epi64(ZERO, _mm512_madd52lo_epu64(ZERO, K_1, R1_0));
+
+        /* R += M*Yi (lo) */
+        FMA52x80(_mm512_madd52lo_epu64, R0_, m_0, Yi_0)
+        FMA52x80(_mm512_madd52lo_epu64, R1_, m_1, Yi_1)
+
+        /* shift R */
+        SHIFT52x80(R0_, ZERO)
+        SHIFT52x80(R1_, ZERO)
+
+        /* R += A*Bi + M*Yi (hi) */
+        FMA52x80(_mm512_madd52hi_epu64, R0_, a_0, Bi_0)
+        FMA52x80(_mm512_madd52hi_epu64, R1_, a_1, Bi_1)
+        FMA52x80(_mm512_madd52hi_epu64, R0_, m_0, Yi_0)
+        FMA52x80(_mm512_madd52hi_epu64, R1_, m_1, Yi_1)
+    }
+
+    /* store de-normalized result and normalize */
+    STORE52x80(out[0], R0_)
+    STORE52x80(out[1], R1_)
+    normalize52x79(out[0]);
+    normalize52x79(out[1]);
+}
+
+#endif
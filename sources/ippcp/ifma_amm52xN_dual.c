@@ -0,0 +1,165 @@
+ /*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include "owncp.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+#include <immintrin.h>
+
+#include "pcpngmontexpstuff_avx512.h"
+#include "ifma_rsa_arith.h"
+
+/*
+ * Almost Montgomery Multiplication in 2^52-radix
+ *
+ *   Implements two independent interleaved multiplications
+ *   of arbitrary length (up to EXP_DUAL_MAX_LEN_AVX512 digits).
+ *   Data represented as 2 arrays of EXP_DUAL_STRIDE_AVX512(len) qwords
+ *   in 2^52-radix, digits above len are zero.
+ *
+ *   Accumulators are kept in memory, so the kernel is suitable for
+ *   the moduli which do not fit into the register file.
+ *
+ */
+IPP_OWN_DEFN(void, ifma512_amm52xN_dual, (Ipp64u* out,
+                                    const Ipp64u* a,
+                                    const Ipp64u* b,
+                                    const Ipp64u* m,
+                                    const Ipp64u  k0[2],
+                                          int len))
+{
+    const __mmask8 k1 = 0x02;   /* mask of the 2-nd element */
+    const __m512i zero = _mm512_setzero_si512();
+
+    int stride = EXP_DUAL_STRIDE_AVX512(len);
+
+    const Ipp64u* a_0 = a;
+    const Ipp64u* b_0 = b;
+    const Ipp64u* m_0 = m;
+    const Ipp64u* a_1 = a + stride;
+    const Ipp64u* b_1 = b + stride;
+    const Ipp64u* m_1 = m + stride;
+
+    /* de-normalized accumulators */
+    __ALIGN64 Ipp64u res_0[EXP_DUAL_MAX_LEN_AVX512];
+    __ALIGN64 Ipp64u res_1[EXP_DUAL_MAX_LEN_AVX512];
+
+    int n, i;
+    for (i=0; i<stride; i+=8) {
+        _mm512_store_si512(res_0+i, zero);
+        _mm512_store_si512(res_1+i, zero);
+    }
+
+    for (n=0; n<len; n++) {
+        /* compute and broadcast y = (r[0]+a[0]*b[n])*k0 */
+        Ipp64u y_0 = ((res_0[0] + a_0[0]*b_0[n]) * k0[0]) & EXP_DIGIT_MASK_AVX512;
+        Ipp64u y_1 = ((res_1[0] + a_1[0]*b_1[n]) * k0[1]) & EXP_DIGIT_MASK_AVX512;
+        __m512i yn_0 = _mm512_set1_epi64((Ipp64s)y_0);
+        __m512i yn_1 = _mm512_set1_epi64((Ipp64s)y_1);
+
+        /* broadcast b[n] digit */
+        __m512i bn_0 = _mm512_set1_epi64((Ipp64s)b_0[n]);
+        __m512i bn_1 = _mm512_set1_epi64((Ipp64s)b_1[n]);
+
+        __m512i rp_0, ap_0, mp_0, d_0;
+        __m512i rp_1, ap_1, mp_1, d_1;
+
+        /* r[0] += a[0]*b + m[0]*y */
+        __m512i ri_0 = _mm512_load_si512(res_0);
+        __m512i ai_0 = _mm512_loadu_si512(a_0);
+        __m512i mi_0 = _mm512_loadu_si512(m_0);
+        __m512i ri_1 = _mm512_load_si512(res_1);
+        __m512i ai_1 = _mm512_loadu_si512(a_1);
+        __m512i mi_1 = _mm512_loadu_si512(m_1);
+        ri_0 = _mm512_madd52lo_epu64(ri_0, ai_0, bn_0);
+        ri_1 = _mm512_madd52lo_epu64(ri_1, ai_1, bn_1);
+        ri_0 = _mm512_madd52lo_epu64(ri_0, mi_0, yn_0);
+        ri_1 = _mm512_madd52lo_epu64(ri_1, mi_1, yn_1);
+
+        /* shift r[0] by 1 digit */
+        d_0 = _mm512_srli_epi64(ri_0, EXP_DIGIT_SIZE_AVX512);
+        d_1 = _mm512_srli_epi64(ri_1, EXP_DIGIT_SIZE_AVX512);
+        d_0 = _mm512_shuffle_epi32(d_0, 0x44);
+        d_1 = _mm512_shuffle_epi32(d_1, 0x44);
+        d_0 = _mm512_mask_add_epi64(ri_0, k1, ri_0, d_0);
+        d_1 = _mm512_mask_add_epi64(ri_1, k1, ri_1, d_1);
+
+        for (i=8; i<stride; i+=8) {
+            ri_0 = _mm512_load_si512(res_0+i);
+            ri_1 = _mm512_load_si512(res_1+i);
+            ap_0 = ai_0;
+            ap_1 = ai_1;
+            ai_0 = _mm512_loadu_si512(a_0+i);
+            ai_1 = _mm512_loadu_si512(a_1+i);
+            mp_0 = mi_0;
+            mp_1 = mi_1;
+            mi_0 = _mm512_loadu_si512(m_0+i);
+            mi_1 = _mm512_loadu_si512(m_1+i);
+
+            /* r[] += lo(a[]*b + m[]*y) */
+            ri_0 = _mm512_madd52lo_epu64(ri_0, ai_0, bn_0);
+            ri_1 = _mm512_madd52lo_epu64(ri_1, ai_1, bn_1);
+            ri_0 = _mm512_madd52lo_epu64(ri_0, mi_0, yn_0);
+            ri_1 = _mm512_madd52lo_epu64(ri_1, mi_1, yn_1);
+
+            /* shift r[] by 1 digit */
+            rp_0 = _mm512_alignr_epi64(ri_0, d_0, 1);
+            rp_1 = _mm512_alignr_epi64(ri_1, d_1, 1);
+            d_0 = ri_0;
+            d_1 = ri_1;
+
+            /* r[] += hi(a[]*b + m[]*y) */
+            rp_0 = _mm512_madd52hi_epu64(rp_0, ap_0, bn_0);
+            rp_1 = _mm512_madd52hi_epu64(rp_1, ap_1, bn_1);
+            rp_0 = _mm512_madd52hi_epu64(rp_0, mp_0, yn_0);
+            rp_1 = _mm512_madd52hi_epu64(rp_1, mp_1, yn_1);
+            _mm512_store_si512(res_0+i-8, rp_0);
+            _mm512_store_si512(res_1+i-8, rp_1);
+        }
+        ri_0 = _mm512_alignr_epi64(zero, d_0, 1);
+        ri_1 = _mm512_alignr_epi64(zero, d_1, 1);
+        ri_0 = _mm512_madd52hi_epu64(ri_0, ai_0, bn_0);
+        ri_1 = _mm512_madd52hi_epu64(ri_1, ai_1, bn_1);
+        ri_0 = _mm512_madd52hi_epu64(ri_0, mi_0, yn_0);
+        ri_1 = _mm512_madd52hi_epu64(ri_1, mi_1, yn_1);
+        _mm512_store_si512(res_0+i-8, ri_0);
+        _mm512_store_si512(res_1+i-8, ri_1);
+    }
+
+    /* normalization */
+    {
+        Ipp64u acc_0 = 0;
+        Ipp64u acc_1 = 0;
+        Ipp64u* out_0 = out;
+        Ipp64u* out_1 = out + stride;
+        for (n=0; n<len; n++) {
+            acc_0 += res_0[n];
+            acc_1 += res_1[n];
+            out_0[n] = acc_0 & EXP_DIGIT_MASK_AVX512;
+            out_1[n] = acc_1 & EXP_DIGIT_MASK_AVX512;
+            acc_0 >>= EXP_DIGIT_SIZE_AVX512;
+            acc_1 >>= EXP_DIGIT_SIZE_AVX512;
+        }
+        for (; n<stride; n++) {
+            out_0[n] = 0;
+            out_1[n] = 0;
+        }
+    }
+}
+
+#endif
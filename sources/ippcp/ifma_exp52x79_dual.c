@@ -0,0 +1,195 @@
+ /*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include "owncp.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+#include <immintrin.h>
+
+#include "pcptool.h"
+
+#include "pcpngmontexpstuff_avx512.h"
+#include "ifma_rsa_arith.h"
+
+#define BITSIZE_MODULUS (4096)
+#define LEN52           (NUMBER_OF_DIGITS(BITSIZE_MODULUS+2,52)+1)  // 80 (79 + zero pad)
+#define LEN64           (NUMBER_OF_DIGITS(BITSIZE_MODULUS,64))      // 64
+
+#define EXP_WIN_SIZE (5U)
+#define EXP_WIN_MASK ((1U<<EXP_WIN_SIZE) - 1)
+
+#define DAMM ifma512_amm52x79_dual
+
+__INLINE void extract_multiplier_n(Ipp64u *red_Y,
+                             const Ipp64u red_table[1U << EXP_WIN_SIZE][2][LEN52],
+                                   int red_table_idx, int tbl_idx)
+{
+    __m512i idx = _mm512_set1_epi64(red_table_idx);
+    __m512i cur_idx = _mm512_setzero_si512();
+
+    __m512i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    t0 = t1 = t2 = t3 = t4 = t5 = t6 = t7 = t8 = t9 = _mm512_setzero_si512();
+
+    for (int t = 0; t < (1 << EXP_WIN_SIZE); ++t, cur_idx = _mm512_add_epi64(cur_idx, _mm512_set1_epi64(1))) {
+        __mmask8 m = _mm512_cmp_epi64_mask(idx, cur_idx, _MM_CMPINT_EQ);
+
+        t0 = _mm512_mask_xor_epi64(t0, m, t0, _mm512_loadu_si512(&red_table[t][tbl_idx][8*0]));
+        t1 = _mm512_mask_xor_epi64(t1, m, t1, _mm512_loadu_si512(&red_table[t][tbl_idx][8*1]));
+        t2 = _mm512_mask_xor_epi64(t2, m, t2, _mm512_loadu_si512(&red_table[t][tbl_idx][8*2]));
+        t3 = _mm512_mask_xor_epi64(t3, m, t3, _mm512_loadu_si512(&red_table[t][tbl_idx][8*3]));
+        t4 = _mm512_mask_xor_epi64(t4, m, t4, _mm512_loadu_si512(&red_table[t][tbl_idx][8*4]));
+        t5 = _mm512_mask_xor_epi64(t5, m, t5, _mm512_loadu_si512(&red_table[t][tbl_idx][8*5]));
+        t6 = _mm512_mask_xor_epi64(t6, m, t6, _mm512_loadu_si512(&red_table[t][tbl_idx][8*6]));
+        t7 = _mm512_mask_xor_epi64(t7, m, t7, _mm512_loadu_si512(&red_table[t][tbl_idx][8*7]));
+        t8 = _mm512_mask_xor_epi64(t8, m, t8, _mm512_loadu_si512(&red_table[t][tbl_idx][8*8]));
+        t9 = _mm512_mask_xor_epi64(t9, m, t9, _mm512_loadu_si512(&red_table[t][tbl_idx][8*9]));
+    }
+
+    /* Clear index */
+    idx = _mm512_xor_si512(idx, idx);
+
+    _mm512_storeu_si512(&red_Y[8*0], t0);
+    _mm512_storeu_si512(&red_Y[8*1], t1);
+    _mm512_storeu_si512(&red_Y[8*2], t2);
+    _mm512_storeu_si512(&red_Y[8*3], t3);
+    _mm512_storeu_si512(&red_Y[8*4], t4);
+    _mm512_storeu_si512(&red_Y[8*5], t5);
+    _mm512_storeu_si512(&red_Y[8*6], t6);
+    _mm512_storeu_si512(&red_Y[8*7], t7);
+    _mm512_storeu_si512(&red_Y[8*8], t8);
+    _mm512_storeu_si512(&red_Y[8*9], t9);
+}
+
+
+// Dual exponentiation in Montgomery domain.
+IPP_OWN_DEFN (void, ifma512_exp52x79_dual, (Ipp64u out    [2][LEN52],
+                                      const Ipp64u base   [2][LEN52],
+                                      const Ipp64u *exp   [2], // 2x64
+                                      const Ipp64u modulus[2][LEN52],
+                                      const Ipp64u toMont [2][LEN52],
+                                      const Ipp64u k0     [2]))
+{
+    /* allocate stack for red(undant) result Y and multiplier X */
+    __ALIGN64 Ipp64u red_Y[2][LEN52];
+    __ALIGN64 Ipp64u red_X[2][LEN52];
+
+    /* allocate expanded exponent */
+    __ALIGN64 Ipp64u expz[2][LEN64+1];
+
+    /* pre-computed table of base powers */
+    __ALIGN64 Ipp64u red_table[1U << EXP_WIN_SIZE][2][LEN52];
+
+    int idx;
+
+    ZEXPAND_BNU((Ipp64u*)red_Y, 0, 2 * LEN52);
+    ZEXPAND_BNU((Ipp64u*)red_table, 0, 2 * LEN52 * (1 << EXP_WIN_SIZE));
+    ZEXPAND_BNU((Ipp64u*)red_X, 0, 2 * LEN52);
+
+    red_X[0][0] = 1;
+    red_X[1][0] = 1;
+
+    /*
+    // compute table of powers base^i, i=0, ..., (2^EXP_WIN_SIZE) -1
+    //    table[0] = mont(x^0) = mont(1)
+    //    table[1] = mont(x^1) = mont(x)
+    */
+    DAMM(red_table[0], (const Ipp64u(*)[LEN52])red_X, toMont, modulus, k0);
+    DAMM(red_table[1], base,  toMont, modulus, k0);
+
+    for (idx = 1; idx < (1 << EXP_WIN_SIZE) / 2; idx++) {
+        DAMM(red_table[2*idx+0], (const Ipp64u(*)[LEN52])red_table[1*idx], (const Ipp64u(*)[LEN52])red_table[1*idx], modulus, k0);
+        DAMM(red_table[2*idx+1], (const Ipp64u(*)[LEN52])red_table[2*idx], (const Ipp64u(*)[LEN52])red_table[1], modulus, k0);
+    }
+
+    /* copy and expand exponents */
+    ZEXPAND_COPY_BNU(expz[0], LEN64+1, exp[0], LEN64);
+    ZEXPAND_COPY_BNU(expz[1], LEN64+1, exp[1], LEN64);
+
+    /* exponentiation */
+    {
+        int rem = BITSIZE_MODULUS % EXP_WIN_SIZE;
+        int delta = rem ? rem : EXP_WIN_SIZE;
+        Ipp64u table_idx_mask = EXP_WIN_MASK;
+
+        int exp_bit_no = BITSIZE_MODULUS - delta;
+        int exp_chunk_no = exp_bit_no / 64;
+        int exp_chunk_shift = exp_bit_no % 64;
+
+        /* process 1-st exp window - just init result */
+        Ipp64u red_table_idx_0 = expz[0][exp_chunk_no];
+        Ipp64u red_table_idx_1 = expz[1][exp_chunk_no];
+        red_table_idx_0 = red_table_idx_0 >> exp_chunk_shift;
+        red_table_idx_1 = red_table_idx_1 >> exp_chunk_shift;
+
+        extract_multiplier_n(red_Y[0], (const Ipp64u(*)[2][LEN52])red_table, (int)red_table_idx_0, 0);
+        extract_multiplier_n(red_Y[1], (const Ipp64u(*)[2][LEN52])red_table, (int)red_table_idx_1, 1);
+
+        /* process other exp windows */
+        for (exp_bit_no -= EXP_WIN_SIZE; exp_bit_no >= 0; exp_bit_no -= EXP_WIN_SIZE) {
+            /* extract pre-computed multiplier from the table */
+            {
+                Ipp64u T;
+                exp_chunk_no = exp_bit_no / 64;
+                exp_chunk_shift = exp_bit_no % 64;
+                {
+                    red_table_idx_0 = expz[0][exp_chunk_no];
+                    T = expz[0][exp_chunk_no + 1];
+
+                    red_table_idx_0 = red_table_idx_0 >> exp_chunk_shift;
+                    T = exp_chunk_shift == 0 ? 0 : T << (64 - exp_chunk_shift);
+                    red_table_idx_0 = (red_table_idx_0 ^ T) & table_idx_mask;
+
+                    extract_multiplier_n(red_X[0], (const Ipp64u(*)[2][LEN52])red_table, (int)red_table_idx_0, 0);
+                }
+                {
+                    red_table_idx_1 = expz[1][exp_chunk_no];
+                    T = expz[1][exp_chunk_no + 1];
+
+                    red_table_idx_1 = red_table_idx_1 >> exp_chunk_shift;
+                    T = exp_chunk_shift == 0 ? 0 : T << (64 - exp_chunk_shift);
+                    red_table_idx_1 = (red_table_idx_1 ^ T) & table_idx_mask;
+
+                    extract_multiplier_n(red_X[1], (const Ipp64u(*)[2][LEN52])red_table, (int)red_table_idx_1, 1);
+                }
+
+            }
+
+            /* series of squaring */
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_Y, modulus, k0);
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_Y, modulus, k0);
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_Y, modulus, k0);
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_Y, modulus, k0);
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_Y, modulus, k0);
+
+            DAMM(red_Y, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_X, modulus, k0);
+        }
+    }
+
+    /* clear exponents */
+    PurgeBlock((Ipp64u*)expz, 2*(LEN64+1)*(int)sizeof(Ipp64u));
+
+    /* convert result back in regular 2^52 domain */
+    ZEXPAND_BNU((Ipp64u*)red_X, 0, 2*LEN52);
+    red_X[0][0] = 1;
+    red_X[1][0] = 1;
+    DAMM(out, (const Ipp64u(*)[LEN52])red_Y, (const Ipp64u(*)[LEN52])red_X, modulus, k0);
+
+    PurgeBlock((Ipp64u*)red_Y, 2*LEN52*(int)sizeof(Ipp64u));
+}
+
+#endif
@@ -0,0 +1,169 @@
+ /*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an 'AS IS' BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * 
+ *******************************************************************************/
+
+#include "owncp.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+#include <immintrin.h>
+
+#include "pcptool.h"
+
+#include "pcpngmontexpstuff_avx512.h"
+#include "ifma_rsa_arith.h"
+
+#define MAX_LEN52  (EXP_DUAL_MAX_LEN_AVX512)
+#define MAX_LEN64  (NUMBER_OF_DIGITS(EXP_DUAL_MAX_LEN_AVX512*52,64))
+
+#define EXP_WIN_SIZE ((unsigned)EXP_DUAL_WIN_SIZE_AVX512)
+#define EXP_WIN_MASK ((1U<<EXP_WIN_SIZE) - 1)
+
+#define DAMM(out, a, b) ifma512_amm52xN_dual((out), (a), (b), modulus, k0, len)
+
+/* entry t of the table holds both operations: red_table + t*2*stride */
+__INLINE void extract_multiplier_n(Ipp64u *red_Y,
+                             const Ipp64u *red_table, int stride,
+                                   int red_table_idx, int tbl_idx)
+{
+    __m512i idx = _mm512_set1_epi64(red_table_idx);
+
+    for (int i = 0; i < stride; i += 8) {
+        __m512i cur_idx = _mm512_setzero_si512();
+        __m512i t0 = _mm512_setzero_si512();
+        const Ipp64u* p = red_table + tbl_idx*stride + i;
+
+        for (int t = 0; t < (1 << EXP_WIN_SIZE); ++t, p += 2*stride, cur_idx = _mm512_add_epi64(cur_idx, _mm512_set1_epi64(1))) {
+            __mmask8 m = _mm512_cmp_epi64_mask(idx, cur_idx, _MM_CMPINT_EQ);
+            t0 = _mm512_mask_xor_epi64(t0, m, t0, _mm512_loadu_si512(p));
+        }
+        _mm512_storeu_si512(red_Y + i, t0);
+    }
+
+    /* Clear index */
+    idx = _mm512_xor_si512(idx, idx);
+}
+
+__INLINE Ipp64u get_window(const Ipp64u *expz, int exp_bit_no)
+{
+    int exp_chunk_no = exp_bit_no / 64;
+    int exp_chunk_shift = exp_bit_no % 64;
+
+    Ipp64u idx = expz[exp_chunk_no];
+    Ipp64u T = expz[exp_chunk_no + 1];
+
+    idx = idx >> exp_chunk_shift;
+    T = exp_chunk_shift == 0 ? 0 : T << (64 - exp_chunk_shift);
+    return (idx ^ T) & EXP_WIN_MASK;
+}
+
+/*
+ * Dual exponentiation in Montgomery domain of arbitrary length.
+ *
+ *   All the operands are 2 arrays of EXP_DUAL_STRIDE_AVX512(len) qwords,
+ *   len = NUMBER_OF_DIGITS(modulusBits+2, 52) <= EXP_DUAL_MAX_LEN_AVX512.
+ *   The table of base powers (EXP_DUAL_TABLE_LEN_AVX512(len) qwords) is
+ *   provided by the caller in pTable.
+ */
+IPP_OWN_DEFN (void, ifma512_exp52xN_dual, (Ipp64u *out,
+                                     const Ipp64u *base,
+                                     const Ipp64u *exp[2],
+                                     const Ipp64u *modulus,
+                                     const Ipp64u *toMont,
+                                     const Ipp64u k0[2],
+                                           int modulusBits,
+                                           Ipp64u *pTable))
+{
+    int len = NUMBER_OF_DIGITS(modulusBits+2, EXP_DIGIT_SIZE_AVX512);
+    int len64 = NUMBER_OF_DIGITS(modulusBits, 64);
+    int stride = EXP_DUAL_STRIDE_AVX512(len);
+
+    /* allocate stack for red(undant) result Y and multiplier X */
+    __ALIGN64 Ipp64u red_Y[2*MAX_LEN52];
+    __ALIGN64 Ipp64u red_X[2*MAX_LEN52];
+
+    /* allocate expanded exponent */
+    __ALIGN64 Ipp64u expz[2][MAX_LEN64+1];
+
+    /* pre-computed table of base powers */
+    Ipp64u *red_table = pTable;
+
+    int idx;
+
+    ZEXPAND_BNU(red_Y, 0, 2*stride);
+    ZEXPAND_BNU(red_X, 0, 2*stride);
+
+    red_X[0] = 1;
+    red_X[stride] = 1;
+
+    /*
+    // compute table of powers base^i, i=0, ..., (2^EXP_WIN_SIZE) -1
+    //    table[0] = mont(x^0) = mont(1)
+    //    table[1] = mont(x^1) = mont(x)
+    */
+    DAMM(red_table + 0*2*stride, red_X, toMont);
+    DAMM(red_table + 1*2*stride, base,  toMont);
+
+    for (idx = 1; idx < (1 << EXP_WIN_SIZE) / 2; idx++) {
+        DAMM(red_table + (2*idx+0)*2*stride, red_table + idx*2*stride, red_table + idx*2*stride);
+        DAMM(red_table + (2*idx+1)*2*stride, red_table + (2*idx)*2*stride, red_table + 1*2*stride);
+    }
+
+    /* copy and expand exponents */
+    ZEXPAND_COPY_BNU(expz[0], MAX_LEN64+1, exp[0], len64);
+    ZEXPAND_COPY_BNU(expz[1], MAX_LEN64+1, exp[1], len64);
+
+    /* exponentiation */
+    {
+        int rem = modulusBits % EXP_WIN_SIZE;
+        int delta = rem ? rem : EXP_WIN_SIZE;
+
+        int exp_bit_no = modulusBits - delta;
+
+        /* process 1-st exp window - just init result */
+        extract_multiplier_n(red_Y,        red_table, stride, (int)get_window(expz[0], exp_bit_no), 0);
+        extract_multiplier_n(red_Y+stride, red_table, stride, (int)get_window(expz[1], exp_bit_no), 1);
+
+        /* process other exp windows */
+        for (exp_bit_no -= EXP_WIN_SIZE; exp_bit_no >= 0; exp_bit_no -= EXP_WIN_SIZE) {
+            /* extract pre-computed multiplier from the table */
+            extract_multiplier_n(red_X,        red_table, stride, (int)get_window(expz[0], exp_bit_no), 0);
+            extract_multiplier_n(red_X+stride, red_table, stride, (int)get_window(expz[1], exp_bit_no), 1);
+
+            /* series of squaring */
+            DAMM(red_Y, red_Y, red_Y);
+            DAMM(red_Y, red_Y, red_Y);
+            DAMM(red_Y, red_Y, red_Y);
+            DAMM(red_Y, red_Y, red_Y);
+
+            DAMM(red_Y, red_Y, red_X);
+        }
+    }
+
+    /* clear exponents */
+    PurgeBlock((Ipp64u*)expz, 2*(MAX_LEN64+1)*(int)sizeof(Ipp64u));
+
+    /* convert result back in regular 2^52 domain */
+    ZEXPAND_BNU(red_X, 0, 2*stride);
+    red_X[0] = 1;
+    red_X[stride] = 1;
+    DAMM(out, red_Y, red_X);
+
+    PurgeBlock(red_Y, 2*stride*(int)sizeof(Ipp64u));
+    PurgeBlock(red_table, (1 << EXP_WIN_SIZE)*2*stride*(int)sizeof(Ipp64u));
+}
+
+#endif
@@ -27,12 +27,17 @@
 IPP_OWN_DEFN (cpSize, gsMontDualExpWinBuffer_avx512, (int modulusBits))
 {
    cpSize redNum = numofVariable_avx512(modulusBits);
-   /* Reg (ymm) capacity = 4 qwords */
-   cpSize redBufferNum = numofVariableBuff_avx512(redNum, 4);
-   return redBufferNum * 2 * 8;
+   /* Reg (zmm) capacity = 8 qwords, enough for ymm-based kernels too */
+   cpSize redBufferNum = numofVariableBuff_avx512(redNum, 8);
+   cpSize bufferNum = redBufferNum * 2 * 8;
+   /* the generic kernel takes the table of base powers from the buffer */
+   if (modulusBits > 4096)
+      bufferNum += EXP_DUAL_TABLE_LEN_AVX512(redNum);
+   return bufferNum;
 }
 
 IPP_OWN_FUNPTR (void, AMM52, (Ipp64u *out, const Ipp64u *a, const Ipp64u *b, const Ipp64u *m, Ipp64u k0))
+IPP_OWN_FUNPTR (void, DAMM52, (Ipp64u *out, const Ipp64u *a, const Ipp64u *b, const Ipp64u *m, const Ipp64u k0[2]))
 IPP_OWN_FUNPTR (void, DEXP52, (Ipp64u* out, const Ipp64u* base, const Ipp64u* exp[2], const Ipp64u* modulus, const Ipp64u* pMont, const Ipp64u k0[2]))
 
 IPP_OWN_DEFN (cpSize, gsMontDualExpWin_BNU_sscm_avx512, (BNU_CHUNK_T* dataY[2],
@@ -62,17 +67,24 @@ IPP_OWN_DEFN (cpSize, gsMontDualExpWin_BNU_sscm_avx512, (BNU_CHUNK_T* dataY[2],
     */
    int modulusBitSize = BITSIZE_BNU(modulus[0], modulusSize[0]);
    int redLen = NUMBER_OF_DIGITS(modulusBitSize + 2, EXP_DIGIT_SIZE_AVX512);
-   /* For ymm-based implementation reg capacity = 4 qwords */
-   int redBufferLen = numofVariableBuff_avx512(redLen, 4);
+   /* For ymm-based implementation reg capacity = 4 qwords, for zmm-based = 8 qwords */
+   int redBufferLen = numofVariableBuff_avx512(redLen, (modulusBitSize > 2048) ? 8 : 4);
 
    /* Allocate buffers */
    BNU_CHUNK_T* redX      = pBuffer;
    BNU_CHUNK_T* redM      = redX     + 2*redBufferLen;
    BNU_CHUNK_T* redRR     = redM     + 2*redBufferLen;
    BNU_CHUNK_T* redCoeff  = redRR    + 2*redBufferLen;
-   BNU_CHUNK_T* redBuffer = redCoeff +   redBufferLen;
+   BNU_CHUNK_T* redBuffer = redCoeff + 2*redBufferLen;
+   BNU_CHUNK_T* redTable  = redBuffer +  redBufferLen;
 
+   /*
+    * Sizes without single-operation kernel compute RR' of both moduli
+    * by dual kernel, the generic dual kernels are used if neither
+    * ammFunc nor dammFunc is set.
+    */
    AMM52 ammFunc = NULL;
+   DAMM52 dammFunc = NULL;
    DEXP52 dexpFunc = NULL;
    switch (modulusBitSize) {
       case 1024:
@@ -87,7 +99,14 @@ IPP_OWN_DEFN (cpSize, gsMontDualExpWin_BNU_sscm_avx512, (BNU_CHUNK_T* dataY[2],
          ammFunc = ifma256_amm52x40;
          dexpFunc = (DEXP52)ifma256_exp52x40_dual;
          break;
+      case 4096:
+         dammFunc = (DAMM52)ifma512_amm52x79_dual;
+         dexpFunc = (DEXP52)ifma512_exp52x79_dual;
+         break;
       default:
+         /* Larger moduli are processed by the generic kernels */
+         if (modulusBitSize > 4096 && redLen <= EXP_DUAL_MAX_LEN_AVX512)
+            break;
          /* Other modulus sizes not supported. This function shall not be called for them. */
          return 0;
    }
@@ -117,11 +136,28 @@ IPP_OWN_DEFN (cpSize, gsMontDualExpWin_BNU_sscm_avx512, (BNU_CHUNK_T* dataY[2],
        */
       ZEXPAND_COPY_BNU(redBuffer, redBufferLen, rr[i], modulusSize[i]);
       regular_dig52(redRR + i*redBufferLen, redBufferLen, redBuffer, modulusBitSize);
-      ammFunc(redRR + i*redBufferLen, redRR + i*redBufferLen, redRR + i*redBufferLen, redM + i*redBufferLen, k0[i]);
-      ammFunc(redRR + i*redBufferLen, redRR + i*redBufferLen, redCoeff, redM + i*redBufferLen, k0[i]);
+      if (ammFunc) {
+         ammFunc(redRR + i*redBufferLen, redRR + i*redBufferLen, redRR + i*redBufferLen, redM + i*redBufferLen, k0[i]);
+         ammFunc(redRR + i*redBufferLen, redRR + i*redBufferLen, redCoeff, redM + i*redBufferLen, k0[i]);
+      }
+   }
+
+   if (!ammFunc) {
+      COPY_BNU(redCoeff + redBufferLen, redCoeff, redBufferLen);
+      if (dammFunc) {
+         dammFunc(redRR, redRR, redRR, redM, k0);
+         dammFunc(redRR, redRR, redCoeff, redM, k0);
+      }
+      else {
+         ifma512_amm52xN_dual(redRR, redRR, redRR, redM, k0, redLen);
+         ifma512_amm52xN_dual(redRR, redRR, redCoeff, redM, k0, redLen);
+      }
    }
 
-   dexpFunc(redRR, redX, dataE, redM, redRR, k0);
+   if (dexpFunc)
+      dexpFunc(redRR, redX, dataE, redM, redRR, k0);
+   else
+      ifma512_exp52xN_dual(redRR, redX, dataE, redM, redRR, k0, modulusBitSize, redTable);
 
    /* Convert result back to regular domain */
    for (int i = 0; i < 2; i++)
@@ -58,6 +58,27 @@
 #define ifma256_ams52x40_dual OWNAPI(ifma256_ams52x40_dual)
   IPP_OWN_DECL(void, ifma256_ams52x40_dual, (Ipp64u out[2][40], const Ipp64u a[2][40], const Ipp64u m[2][40], const Ipp64u k0[2]))
 
+/*
+ * Dual Almost Montgomery Multiplication on 512-bit registers
+ * (two independent operations and data arrays)
+ */
+#define ifma512_amm52x79_dual OWNAPI(ifma512_amm52x79_dual)
+  IPP_OWN_DECL(void, ifma512_amm52x79_dual, (Ipp64u out[2][80], const Ipp64u a[2][80], const Ipp64u b[2][80], const Ipp64u m[2][80], const Ipp64u k0[2]))
+
+/*
+ * Dual Almost Montgomery Multiplication of arbitrary length
+ * (len digits, each operation occupies EXP_DUAL_STRIDE_AVX512(len) qwords)
+ */
+#define EXP_DUAL_MAX_LEN_AVX512     (160)
+#define EXP_DUAL_STRIDE_AVX512(len) (((len)+7) & ~7)
+
+/* window of ifma512_exp52xN_dual and size (qwords) of its table of base powers */
+#define EXP_DUAL_WIN_SIZE_AVX512       (4)
+#define EXP_DUAL_TABLE_LEN_AVX512(len) ((1 << EXP_DUAL_WIN_SIZE_AVX512) * 2 * EXP_DUAL_STRIDE_AVX512(len))
+
+#define ifma512_amm52xN_dual OWNAPI(ifma512_amm52xN_dual)
+  IPP_OWN_DECL(void, ifma512_amm52xN_dual, (Ipp64u* out, const Ipp64u* a, const Ipp64u* b, const Ipp64u* m, const Ipp64u k0[2], int len))
+
 
 /* Exponentiation */
 #define ifma256_exp52x20 OWNAPI(ifma256_exp52x20)
@@ -93,5 +114,23 @@
                                         const Ipp64u toMont [2][40],
                                         const Ipp64u k0     [2]))
 
+#define ifma512_exp52x79_dual OWNAPI(ifma512_exp52x79_dual)
+  IPP_OWN_DECL (void, ifma512_exp52x79_dual, (Ipp64u out    [2][80],
+                                        const Ipp64u base   [2][80],
+                                        const Ipp64u *exp   [2], // 2x64
+                                        const Ipp64u modulus[2][80],
+                                        const Ipp64u toMont [2][80],
+                                        const Ipp64u k0     [2]))
+
+#define ifma512_exp52xN_dual OWNAPI(ifma512_exp52xN_dual)
+  IPP_OWN_DECL (void, ifma512_exp52xN_dual, (Ipp64u *out,
+                                       const Ipp64u *base,
+                                       const Ipp64u *exp[2],
+                                       const Ipp64u *modulus,
+                                       const Ipp64u *toMont,
+                                       const Ipp64u k0[2],
+                                             int modulusBits,
+                                             Ipp64u *pTable)) // EXP_DUAL_TABLE_LEN_AVX512 qwords
+
 #endif // #if(_IPP32E>=_IPP32E_K1)
 #endif // #ifndef _IFMA_RSA_ARITH_H_
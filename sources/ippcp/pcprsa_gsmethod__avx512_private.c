@@ -55,7 +55,7 @@ IPP_OWN_DEFN (gsMethod_RSA*, gsMethod_RSA_avx512_private, (void))
 }
 
 #define RSA_DUAL_EXP_AVX512_MIN_BITSIZE 2048
-#define RSA_DUAL_EXP_AVX512_MAX_BITSIZE 4096
+#define RSA_DUAL_EXP_AVX512_MAX_BITSIZE 16384
 
 IPP_OWN_DEFN (gsMethod_RSA*, gsMethod_RSA_avx512_crt_private, (int privExpBitSize)) {
    static gsMethod_RSA m = {
@@ -68,14 +68,17 @@ IPP_OWN_DEFN (gsMethod_RSA*, gsMethod_RSA_avx512_crt_private, (int privExpBitSiz
    if (IsFeatureEnabled(ippCPUID_AVX512IFMA)) {
       ngMontDualExp dexpFunc = NULL;
       switch (privExpBitSize) {
-         /* RSA 2k,3k,4k only supported */
+         /* RSA 2k,3k,4k,8k and up to 16k supported */
          case 1024:
          case 1536:
          case 2048:
+         case 4096:
             dexpFunc = gsMontDualExpWin_BNU_sscm_avx512;
             break;
          default:
-            dexpFunc = NULL;
+            dexpFunc = (4096 < privExpBitSize && privExpBitSize <= RSA_DUAL_EXP_AVX512_MAX_BITSIZE/2)
+                     ? gsMontDualExpWin_BNU_sscm_avx512
+                     : NULL;
       }
       m.dualExpFun = dexpFunc;
    }